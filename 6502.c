@@ -12,12 +12,17 @@
 //externally supplied functions
 extern uint8_t read6502(uint16_t address);
 extern void write6502(uint16_t address, uint8_t value);
+//opcode fetch: the byte at address, OPDESC_STOP to stop before it runs or
+//OPDESC_NATIVE when the bus has already done the work of the routine there
+extern uint16_t fetch6502(uint16_t address);
 
 //6502 defines
 // #define UNDOCUMENTED //when this is defined, undocumented opcodes are handled.
                      //otherwise, they're simply treated as NOPs.
 
+#ifndef M6502_NMOS  //define M6502_NMOS to build the original NMOS 6502
 #define CPU_65C02    // allows 65C02 instructions
+#endif
 //#define NES_CPU      //when this is defined, the binary-coded decimal (BCD)
                      //status flag is not honored by ADC and SBC. the 2A03
                      //CPU in the Nintendo Entertainment System does not
@@ -74,39 +79,90 @@ extern void write6502(uint16_t address, uint8_t value);
 }
 
 
+//define M6502_TLS as _Thread_local before including this file to give
+//every host thread its own CPU, so several machines can run in parallel
+#ifndef M6502_TLS
+#define M6502_TLS
+#endif
+
+#ifdef M6502_CORE_ONLY
+//only the instruction set: the registers and the functions that do not
+//depend on it come from another translation unit with the full core, so
+//two variants can run the same CPU, see 6502nmos.c
+extern M6502_TLS uint16_t pc;
+extern M6502_TLS uint8_t sp, a, x, y, status;
+extern M6502_TLS uint64_t instructions;
+extern M6502_TLS uint32_t clockticks6502, clockgoal6502;
+extern M6502_TLS uint16_t oldpc, ea, reladdr, value, result;
+extern M6502_TLS uint8_t opcode, oldstatus;
+extern M6502_TLS uint8_t trapped6502;
+extern M6502_TLS uint8_t stop6502;
+extern M6502_TLS uint8_t penaltyop, penaltyaddr;
+extern M6502_TLS uint8_t callexternal;
+extern M6502_TLS void (*loopexternal)();
+extern M6502_TLS uint32_t (*hostcallexternal)(uint8_t service);
+#else
 //6502 CPU registers
-uint16_t pc;
-uint8_t sp, a, x, y, status = FLAG_CONSTANT;
+M6502_TLS uint16_t pc;
+M6502_TLS uint8_t sp, a, x, y, status = FLAG_CONSTANT;
 
 
 //helper variables
-uint64_t instructions = 0; //keep track of total instructions executed
-uint32_t clockticks6502 = 0, clockgoal6502 = 0;
-uint16_t oldpc, ea, reladdr, value, result;
-uint8_t opcode, oldstatus;
+M6502_TLS uint64_t instructions = 0; //keep track of total instructions executed
+M6502_TLS uint32_t clockticks6502 = 0, clockgoal6502 = 0;
+M6502_TLS uint16_t oldpc, ea, reladdr, value, result;
+M6502_TLS uint8_t opcode, oldstatus;
+M6502_TLS uint8_t trapped6502 = 0; //set when the CPU branched or jumped to itself
+M6502_TLS uint8_t stop6502 = 0; //why exec6502() returned early, STOP6502_*
+M6502_TLS uint32_t (*hostcallexternal)(uint8_t service) = 0; //see hookhostcall()
+#endif
+
+//what exec6502() returns
+#define STOP6502_BUDGET 0 //ran the cycles it was given
+#define STOP6502_TRAP   1 //branched or jumped to itself
+#define STOP6502_BREAK  2 //execution breakpoint, pc is on the instruction
+#define STOP6502_WATCH  3 //watchpoint, after the instruction that hit it
+#define STOP6502_WAI    4 //WAI, pc is after it: idle until an interrupt is due
+#define STOP6502_STP    5 //STP, pc stays on it until a reset
+#define STOP6502_HOST   6 //halt6502(STOP6502_HOST) from a hook or device
+
+//end exec6502() after the current instruction. exec6502() clears the
+//reason when it starts
+static void halt6502(uint8_t reason) {
+    stop6502 = reason;
+    clockgoal6502 = clockticks6502;
+}
+
+//a branch or jump to itself is how test images like the Klaus suite stop:
+//flag it and end exec6502() there, so runners need no per-instruction hook
+static void trap6502() {
+    trapped6502 = 1;
+    halt6502(STOP6502_TRAP);
+}
 
 //a few general functions used by various other functions
-void push16(uint16_t pushval) {
+static void push16(uint16_t pushval) {
     write6502(BASE_STACK + sp, (pushval >> 8) & 0xFF);
     write6502(BASE_STACK + ((sp - 1) & 0xFF), pushval & 0xFF);
     sp -= 2;
 }
 
-void push8(uint8_t pushval) {
+static void push8(uint8_t pushval) {
     write6502(BASE_STACK + sp--, pushval);
 }
 
-uint16_t pull16() {
+static uint16_t pull16() {
     uint16_t temp16;
     temp16 = read6502(BASE_STACK + ((sp + 1) & 0xFF)) | ((uint16_t)read6502(BASE_STACK + ((sp + 2) & 0xFF)) << 8);
     sp += 2;
     return(temp16);
 }
 
-uint8_t pull8() {
+static uint8_t pull8() {
     return (read6502(BASE_STACK + ++sp));
 }
 
+#ifndef M6502_CORE_ONLY
 void reset6502() {
     pc = (uint16_t)read6502(0xFFFC) | ((uint16_t)read6502(0xFFFD) << 8);
     a = 0;
@@ -114,12 +170,30 @@ void reset6502() {
     y = 0;
     sp = 0xFD;
     status |= FLAG_CONSTANT;
+    trapped6502 = 0;
 }
+#endif
+
 
+//everything dispatch needs to know about an opcode, packed in one entry,
+//see opdesc6502_init()
+typedef struct {
+    void (*mode)();     //addressing mode
+    void (*handler)();  //instruction
+    uint8_t ticks;      //base cycles
+} opdesc6502_t;
 
-static void (*addrtable[256])();
-static void (*optable[256])();
-uint8_t penaltyop, penaltyaddr;
+//fetch6502() answers this instead of an opcode to stop in front of it
+#define OPDESC_STOP 0x100
+//and this once it has run the routine at address natively, registers,
+//return and cycles included, so that nothing is left to do
+#define OPDESC_NATIVE 0x101
+
+static opdesc6502_t opdesc6502[258];
+
+#ifndef M6502_CORE_ONLY
+M6502_TLS uint8_t penaltyop, penaltyaddr;
+#endif
 
 //addressing mode functions, calculates effective addresses
 static void imp() { //implied
@@ -156,10 +230,12 @@ static void rel() { //relative for branch ops (8-bit immediate value, sign-exten
     if (reladdr & 0x80) reladdr |= 0xFF00;
 }
 
+#ifdef CPU_65C02
 static void rel2() { //relative for bbr (8-bit immediate value, sign-extended)
     reladdr = (uint16_t)read6502(pc+1);
     if (reladdr & 0x80) reladdr |= 0xFF00;
 }
+#endif
 
 static void abso() { //absolute
     ea = (uint16_t)read6502(pc) | ((uint16_t)read6502(pc+1) << 8);
@@ -193,13 +269,18 @@ static void absy() { //absolute,Y
 }
 
 static void ind() { //indirect
-    uint16_t eahelp/*, eahelp2*/;
+    uint16_t eahelp, eahelp2;
     eahelp = (uint16_t)read6502(pc) | (uint16_t)((uint16_t)read6502(pc+1) << 8);
-    //eahelp2 = (eahelp & 0xFF00) | ((eahelp + 1) & 0x00FF); //replicate 6502 page-boundary wraparound bug
-    ea = (uint16_t)read6502(eahelp) | ((uint16_t)read6502(eahelp +1) << 8);
+#ifdef CPU_65C02
+    eahelp2 = eahelp + 1;
+#else
+    eahelp2 = (eahelp & 0xFF00) | ((eahelp + 1) & 0x00FF); //replicate 6502 page-boundary wraparound bug
+#endif
+    ea = (uint16_t)read6502(eahelp) | ((uint16_t)read6502(eahelp2) << 8);
     pc += 2;
 }
 
+#ifdef CPU_65C02
 static void aindx() { //indirect
     uint16_t eahelp;
     eahelp = (uint16_t)read6502(pc) | (uint16_t)((uint16_t)read6502(pc+1) << 8);
@@ -207,6 +288,7 @@ static void aindx() { //indirect
     ea = (uint16_t)read6502(eahelp+x) | ((uint16_t)read6502(eahelp +1 + x) << 8);
     pc += 2;
 }
+#endif
 
 static void indx() { // (indirect,X)
     uint16_t eahelp;
@@ -228,12 +310,12 @@ static void indy() { // (indirect),Y
 }
 
 static uint16_t getvalue() {
-    if (addrtable[opcode] == acc) return((uint16_t)a);
+    if (opdesc6502[opcode].mode == acc) return((uint16_t)a);
         else return((uint16_t)read6502(ea));
 }
 
 static void putvalue(uint16_t saveval) {
-    if (addrtable[opcode] == acc) a = (uint8_t)(saveval & 0x00FF);
+    if (opdesc6502[opcode].mode == acc) a = (uint8_t)(saveval & 0x00FF);
         else write6502(ea, (saveval & 0x00FF));
 }
 
@@ -257,13 +339,13 @@ static void adc() {
         if (s >= 160) {
             status |= FLAG_CARRY;
             if (((status & FLAG_OVERFLOW) != 0) && (s >= 0x180)) {
-                status &= !FLAG_OVERFLOW;
+                status &= ~FLAG_OVERFLOW;
             }
             s += 0x60;
         } else {
-            status &= !FLAG_CARRY;
+            status &= ~FLAG_CARRY;
             if ((status & FLAG_OVERFLOW) != 0 && (s < 0x80)) {
-                status &= !FLAG_OVERFLOW;
+                status &= ~FLAG_OVERFLOW;
             }
         }
         result = (uint8_t)(s & 0xFF);
@@ -319,6 +401,7 @@ static void bcc() {
         pc += reladdr;
         if ((oldpc & 0xFF00) != (pc & 0xFF00)) clockticks6502 += 2; //check if jump crossed a page boundary
             else clockticks6502++;
+        if (reladdr == 0xFFFE) trap6502();
     }
 }
 
@@ -328,6 +411,7 @@ static void bcs() {
         pc += reladdr;
         if ((oldpc & 0xFF00) != (pc & 0xFF00)) clockticks6502 += 2; //check if jump crossed a page boundary
             else clockticks6502++;
+        if (reladdr == 0xFFFE) trap6502();
     }
 }
 
@@ -337,6 +421,7 @@ static void beq() {
         pc += reladdr;
         if ((oldpc & 0xFF00) != (pc & 0xFF00)) clockticks6502 += 2; //check if jump crossed a page boundary
             else clockticks6502++;
+        if (reladdr == 0xFFFE) trap6502();
     }
 }
 
@@ -348,7 +433,7 @@ static void bit() {
     
 #ifdef CPU_65C02
     // BIt immediate does not affect N nor V flags
-    if (addrtable[opcode] != imm) {
+    if (opdesc6502[opcode].mode != imm) {
 #endif
         status = (status & 0x3F) | (uint8_t)(value & 0xC0);
 #ifdef CPU_65C02
@@ -363,6 +448,7 @@ static void bmi() {
         pc += reladdr;
         if ((oldpc & 0xFF00) != (pc & 0xFF00)) clockticks6502 += 2; //check if jump crossed a page boundary
             else clockticks6502++;
+        if (reladdr == 0xFFFE) trap6502();
     }
 }
 
@@ -372,6 +458,7 @@ static void bne() {
         pc += reladdr;
         if ((oldpc & 0xFF00) != (pc & 0xFF00)) clockticks6502 += 2; //check if jump crossed a page boundary
             else clockticks6502++;
+        if (reladdr == 0xFFFE) trap6502();
     }
 }
 
@@ -381,6 +468,7 @@ static void bpl() {
         pc += reladdr;
         if ((oldpc & 0xFF00) != (pc & 0xFF00)) clockticks6502 += 2; //check if jump crossed a page boundary
             else clockticks6502++;
+        if (reladdr == 0xFFFE) trap6502();
     }
 }
 
@@ -401,6 +489,7 @@ static void bvc() {
         pc += reladdr;
         if ((oldpc & 0xFF00) != (pc & 0xFF00)) clockticks6502 += 2; //check if jump crossed a page boundary
             else clockticks6502++;
+        if (reladdr == 0xFFFE) trap6502();
     }
 }
 
@@ -410,6 +499,7 @@ static void bvs() {
         pc += reladdr;
         if ((oldpc & 0xFF00) != (pc & 0xFF00)) clockticks6502 += 2; //check if jump crossed a page boundary
             else clockticks6502++;
+        if (reladdr == 0xFFFE) trap6502();
     }
 }
 
@@ -523,6 +613,7 @@ static void iny() {
 }
 
 static void jmp() {
+    if (ea == (uint16_t)(pc - 3)) trap6502();
     pc = ea;
 }
 
@@ -637,7 +728,7 @@ static void ror() {
 }
 
 static void rti() {
-    status = pull8();
+    status = pull8() | FLAG_CONSTANT;
     value = pull16();
     pc = value;
 }
@@ -835,6 +926,7 @@ static void tya() {
         pc += reladdr;
         if ((oldpc & 0xFF00) != (pc & 0xFF00)) clockticks6502 += 2; //check if jump crossed a page boundary
             else clockticks6502++;
+        if (reladdr == 0xFFFE) trap6502();
     }
 
     static void stz() {
@@ -883,6 +975,7 @@ static void tya() {
         oldpc = pc;
         if ((value & (1 << b)) == 0) {
             pc += reladdr;
+            if (reladdr == 0xFFFD) trap6502();
         }
         
         if ((oldpc & 0xFF00) != (pc & 0xFF00)) clockticks6502 += 2; //check if jump crossed a page boundary
@@ -896,6 +989,7 @@ static void tya() {
         oldpc = pc;
         if ((value & (1 << b)) != 0) {
             pc += reladdr;
+            if (reladdr == 0xFFFD) trap6502();
         }
         
         if ((oldpc & 0xFF00) != (pc & 0xFF00)) clockticks6502 += 2; //check if jump crossed a page boundary
@@ -1015,6 +1109,21 @@ static void tya() {
     }
     
 
+    static void wai() {
+        halt6502(STOP6502_WAI);
+    }
+
+    static void stp() {
+        pc--;
+        halt6502(STOP6502_STP);
+    }
+
+    //$42 and a service byte (WDM on the 65816): a host call when a handler
+    //is hooked, the two-byte NOP it always was otherwise
+    static void hcall() {
+        if (hostcallexternal) clockticks6502 += (*hostcallexternal)(read6502(ea));
+    }
+
     #define abson rel2
     #define absxn rel2
     #define absyn rel2
@@ -1025,21 +1134,33 @@ static void tya() {
     #define absxn absx
     #define absyn absy
     #define bra nop
+    #define wai nop
+    #define stp dcp
+    #define hcall nop
+
+    //the NMOS table gives these opcodes the operand of the NOP they are
+    #define stz nop
+    #define tsb nop
+    #define trb nop
+    #define phx nop
+    #define plx nop
+    #define phy nop
+    #define ply nop
 
     #define bbr0 slo
-    #define bbr1 rla
+    #define bbr1 slo
     #define bbr2 rla
-    #define bbr3 sre
+    #define bbr3 rla
     #define bbr4 sre
-    #define bbr5 rra
+    #define bbr5 sre
     #define bbr6 rra
-    #define bbr7 sax
-    #define bbs0 nop
+    #define bbr7 rra
+    #define bbs0 sax
     #define bbs1 lax
     #define bbs2 lax
-    #define bbs3 dcp
+    #define bbs3 lax
     #define bbs4 dcp
-    #define bbs5 isb
+    #define bbs5 dcp
     #define bbs6 isb
     #define bbs7 isb
 
@@ -1063,7 +1184,7 @@ static void tya() {
 
 
 #ifdef CPU_65C02
-    static void (*addrtable[256])() = {
+    static void (*const addrtable[256])() = {
 /*        |  0  |  1  |   2   |  3  |  4  |  5  |  6  |  7  |  8  |  9  |  A  |  B  |  C  |  D  |  E  |  F  |     */
 /* 0 */     imp, indx,  imm,   imp,   zp,   zp,   zp,   zp,  imp,  imm,  acc,  imp,  abso, abso, abso, abson, /* 0 */
 /* 1 */     rel, indy,  indzp, imp,   zp,  zpx,  zpx,   zp,  imp, absy,  acc,  imp,  abso, absx, absx, absxn, /* 1 */
@@ -1084,7 +1205,7 @@ static void tya() {
 };
 
 #else
-static void (*addrtable[256])() = {
+static void (*const addrtable[256])() = {
 /*        |  0  |  1  |   2   |  3  |  4  |  5  |  6  |  7  |  8  |  9  |  A  |  B  |  C  |  D  |  E  |  F  |     */
 /* 0 */     imp, indx,  imm,   indx,   zp,   zp,   zp,   zp,  imp,  imm,  acc,  imm, abso, abso, abso, abson, /* 0 */
 /* 1 */     rel, indy,  indzp, indy,   zp,  zpx,  zpx,  zpx,  imp, absy,  acc, absy, abso, absx, absx, absxn, /* 1 */
@@ -1105,13 +1226,13 @@ static void (*addrtable[256])() = {
 };
 #endif
 
-static void (*optable[256])() = {
+static void (*const optable[256])() = {
 /*        |  0  |  1  |  2  |  3  |  4  |  5  |  6  |  7  |  8  |  9  |  A  |  B  |  C  |  D  |  E  |  F  |      */
 /* 0 */      brk,  ora,  nop,  slo,  tsb,  ora,  asl,  rmb0,  php,  ora,  asl,  nop,  tsb,  ora,  asl,  bbr0, /* 0 */
 /* 1 */      bpl,  ora,  ora,  slo,  trb,  ora,  asl,  rmb1,  clc,  ora,  inc,  slo,  trb,  ora,  asl,  bbr1, /* 1 */
 /* 2 */      jsr,  and,  nop,  rla,  bit,  and,  rol,  rmb2,  plp,  and,  rol,  nop,  bit,  and,  rol,  bbr2, /* 2 */
 /* 3 */      bmi,  and,  and,  rla,  bit,  and,  rol,  rmb3,  sec,  and,  dec,  rla,  bit,  and,  rol,  bbr3, /* 3 */
-/* 4 */      rti,  eor,  nop,  sre,  nop,  eor,  lsr,  rmb4,  pha,  eor,  lsr,  nop,  jmp,  eor,  lsr,  bbr4, /* 4 */
+/* 4 */      rti,  eor, hcall, sre,  nop,  eor,  lsr,  rmb4,  pha,  eor,  lsr,  nop,  jmp,  eor,  lsr,  bbr4, /* 4 */
 /* 5 */      bvc,  eor,  eor,  sre,  nop,  eor,  lsr,  rmb5,  cli,  eor,  phy,  sre,  nop,  eor,  lsr,  bbr5, /* 5 */
 /* 6 */      rts,  adc,  nop,  rra,  stz,  adc,  ror,  rmb6,  pla,  adc,  ror,  nop,  jmp,  adc,  ror,  bbr6, /* 6 */
 /* 7 */      bvs,  adc,  adc,  rra,  stz,  adc,  ror,  rmb7,  sei,  adc,  ply,  rra,  jmp,  adc,  ror,  bbr7, /* 7 */
@@ -1119,13 +1240,13 @@ static void (*optable[256])() = {
 /* 9 */      bcc,  sta,  sta,  nop,  sty,  sta,  stx,  smb1,  tya,  sta,  txs,  nop,  stz,  sta,  stz,  bbs1, /* 9 */
 /* A */      ldy,  lda,  ldx,  lax,  ldy,  lda,  ldx,  smb2,  tay,  lda,  tax,  nop,  ldy,  lda,  ldx,  bbs2, /* A */
 /* B */      bcs,  lda,  lda,  lax,  ldy,  lda,  ldx,  smb3,  clv,  lda,  tsx,  lax,  ldy,  lda,  ldx,  bbs3, /* B */
-/* C */      cpy,  cmp,  nop,  dcp,  cpy,  cmp,  dec,  smb4,  iny,  cmp,  dex,  nop,  cpy,  cmp,  dec,  bbs4, /* C */
-/* D */      bne,  cmp,  cmp,  dcp,  nop,  cmp,  dec,  smb5,  cld,  cmp,  phx,  dcp,  nop,  cmp,  dec,  bbs5, /* D */
+/* C */      cpy,  cmp,  nop,  dcp,  cpy,  cmp,  dec,  smb4,  iny,  cmp,  dex,  wai,  cpy,  cmp,  dec,  bbs4, /* C */
+/* D */      bne,  cmp,  cmp,  dcp,  nop,  cmp,  dec,  smb5,  cld,  cmp,  phx,  stp,  nop,  cmp,  dec,  bbs5, /* D */
 /* E */      cpx,  sbc,  nop,  isb,  cpx,  sbc,  inc,  smb6,  inx,  sbc,  nop,  nop,  cpx,  sbc,  inc,  bbs6, /* E */
 /* F */      beq,  sbc,  sbc,  isb,  nop,  sbc,  inc,  smb7,  sed,  sbc,  plx,  isb,  nop,  sbc,  inc,  bbs7  /* F */
 };
 
-static const uint32_t ticktable[256] = {
+static const uint8_t ticktable[256] = {
 /*        |  0  |  1  |  2  |  3  |  4  |  5  |  6  |  7  |  8  |  9  |  A  |  B  |  C  |  D  |  E  |  F  |     */
 /* 0 */      7,    6,    2,    8,    5,    3,    5,    5,    3,    2,    2,    2,    6,    4,    6,    6,  /* 0 */
 /* 1 */      2,    5,    5,    8,    5,    4,    6,    6,    2,    4,    2,    7,    6,    4,    7,    7,  /* 1 */
@@ -1145,7 +1266,39 @@ static const uint32_t ticktable[256] = {
 /* F */      2,    5,    5,    8,    4,    4,    6,    6,    2,    4,    3,    7,    4,    4,    7,    7   /* F */
 };
 
+//the descriptor behind OPDESC_STOP: undo the fetch and count nothing
+static void fetchstop() {
+    pc--;
+    instructions--;
+    halt6502(STOP6502_BREAK);
+}
+
+//the descriptor behind OPDESC_NATIVE: the routine counts as one instruction
+static void fetchnative() {
+}
+
+//the tables above are the readable source and stay in flash on the RP2040;
+//dispatch reads only opdesc6502[], which is in SRAM (.bss) there, so one
+//opcode costs one entry instead of lookups in three tables
+__attribute__((constructor)) static void opdesc6502_init() {
+    for (int op = 0; op < 256; op++) {
+        opdesc6502_t *d = &opdesc6502[op];
+        d->mode = addrtable[op];
+        d->handler = optable[op];
+        d->ticks = ticktable[op];
+    }
+#ifndef CPU_65C02
+    //NOPs on the NMOS part that share a handler with a 65C02 instruction:
+    //INC A, DEC A, BIT zp,X, BIT abs,X, JMP (abs,X) and BIT #
+    static const uint8_t nops[] = { 0x1A, 0x3A, 0x34, 0x3C, 0x7C, 0x89 };
+    for (uint32_t i = 0; i < sizeof(nops); i++) opdesc6502[nops[i]].handler = nop;
+#endif
+    opdesc6502[OPDESC_STOP] = (opdesc6502_t){ imp, fetchstop, 0 };
+    opdesc6502[OPDESC_NATIVE] = (opdesc6502_t){ imp, fetchnative, 0 };
+}
+
 
+#ifndef M6502_CORE_ONLY
 void nmi6502() {
     push16(pc);
     push8(status);
@@ -1165,39 +1318,47 @@ void irq6502() {
     pc = (uint16_t)read6502(0xFFFE) | ((uint16_t)read6502(0xFFFF) << 8);
 }
 
-uint8_t callexternal = 0;
-void (*loopexternal)();
+M6502_TLS uint8_t callexternal = 0;
+M6502_TLS void (*loopexternal)();
+#endif
 
-void exec6502(uint32_t tickcount) {
+//run for tickcount cycles, or until something stops the CPU first.
+//returns why it stopped, a STOP6502_* reason
+uint8_t exec6502(uint32_t tickcount) {
     clockgoal6502 += tickcount;
+    stop6502 = STOP6502_BUDGET;
 
     while (clockticks6502 < clockgoal6502) {
-        opcode = read6502(pc++);
+        uint16_t op = fetch6502(pc++);
 
+        const opdesc6502_t *d = &opdesc6502[op];
+        opcode = (uint8_t)op;
         penaltyop = 0;
         penaltyaddr = 0;
 
-        (*addrtable[opcode])();
-        (*optable[opcode])();
-        clockticks6502 += ticktable[opcode];
+        (*d->mode)();
+        (*d->handler)();
+        clockticks6502 += d->ticks;
         if (penaltyop && penaltyaddr) clockticks6502++;
 
         instructions++;
 
         if (callexternal) (*loopexternal)();
     }
-
+    return stop6502;
 }
 
 void step6502() {
-    opcode = read6502(pc++);
-    
+    uint16_t op = fetch6502(pc++);
+
+    const opdesc6502_t *d = &opdesc6502[op];
+    opcode = (uint8_t)op;
     penaltyop = 0;
     penaltyaddr = 0;
 
-    (*addrtable[opcode])();
-    (*optable[opcode])();
-    clockticks6502 += ticktable[opcode];
+    (*d->mode)();
+    (*d->handler)();
+    clockticks6502 += d->ticks;
     if (penaltyop && penaltyaddr) clockticks6502++;
     clockgoal6502 = clockticks6502;
 
@@ -1206,9 +1367,59 @@ void step6502() {
     if (callexternal) (*loopexternal)();
 }
 
+#ifndef M6502_CORE_ONLY
+//route host calls ($42 and a service byte) to funcptr, which runs the
+//service and returns the cycles it took. NULL makes them NOPs again
+void hookhostcall(uint32_t (*funcptr)(uint8_t service)) {
+    hostcallexternal = funcptr;
+}
+
 void hookexternal(void *funcptr) {
     if (funcptr != (void *)NULL) {
         loopexternal = funcptr;
         callexternal = 1;
     } else callexternal = 0;
-}
\ No newline at end of file
+}
+//CPU context, lets one CPU be switched between several machines
+typedef struct {
+    uint16_t pc;
+    uint8_t sp, a, x, y, status;
+    uint64_t instructions;
+    uint32_t clockticks6502, clockgoal6502;
+    uint8_t trapped6502, stop6502;
+    uint8_t callexternal;
+    void (*loopexternal)();
+} context6502_t;
+
+void save6502(context6502_t *ctx) {
+    ctx->pc = pc;
+    ctx->sp = sp;
+    ctx->a = a;
+    ctx->x = x;
+    ctx->y = y;
+    ctx->status = status;
+    ctx->instructions = instructions;
+    ctx->clockticks6502 = clockticks6502;
+    ctx->clockgoal6502 = clockgoal6502;
+    ctx->trapped6502 = trapped6502;
+    ctx->stop6502 = stop6502;
+    ctx->callexternal = callexternal;
+    ctx->loopexternal = loopexternal;
+}
+
+void load6502(const context6502_t *ctx) {
+    pc = ctx->pc;
+    sp = ctx->sp;
+    a = ctx->a;
+    x = ctx->x;
+    y = ctx->y;
+    status = ctx->status;
+    instructions = ctx->instructions;
+    clockticks6502 = ctx->clockticks6502;
+    clockgoal6502 = ctx->clockgoal6502;
+    trapped6502 = ctx->trapped6502;
+    stop6502 = ctx->stop6502;
+    callexternal = ctx->callexternal;
+    loopexternal = ctx->loopexternal;
+}
+#endif
@@ -0,0 +1,5473 @@
+/********************************************************
+NMOS 6502 functional test, written by 6502_test.py
+
+2946 vectors at $0700, one instruction each. Starts at $0400,
+passes at $04AB and traps at $04A8 on the first check
+that fails; the vector it was on is at ($00).
+********************************************************/
+
+unsigned char __6502_functional_test_bin[] = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xd8, 0xa2, 0xff, 0x9a, 0xa9, 0x00, 0x85, 0x00,
+  0xa9, 0x07, 0x85, 0x01, 0xa0, 0x13, 0xb1, 0x00, 0x99, 0x50, 0x00, 0x88,
+  0x10, 0xf8, 0xa5, 0x63, 0xf0, 0x03, 0x4c, 0xab, 0x04, 0xa5, 0x50, 0x8d,
+  0x00, 0x05, 0xa5, 0x51, 0x8d, 0x01, 0x05, 0xa5, 0x52, 0x8d, 0x02, 0x05,
+  0xa5, 0x57, 0x85, 0x30, 0x8d, 0x00, 0x03, 0x8d, 0x00, 0x01, 0xa9, 0x05,
+  0x8d, 0x01, 0x01, 0xa9, 0x06, 0x8d, 0x02, 0x01, 0xa5, 0x58, 0x85, 0x42,
+  0xa5, 0x59, 0x85, 0x43, 0xa6, 0x54, 0xa4, 0x55, 0xa5, 0x56, 0x48, 0xa5,
+  0x53, 0x28, 0x4c, 0x00, 0x05, 0x08, 0x85, 0x70, 0x86, 0x71, 0x84, 0x72,
+  0x68, 0x85, 0x73, 0xba, 0x86, 0x74, 0xa2, 0xff, 0x9a, 0xd8, 0xa5, 0x70,
+  0xc5, 0x5a, 0xd0, 0x3c, 0xa5, 0x71, 0xc5, 0x5b, 0xd0, 0x36, 0xa5, 0x72,
+  0xc5, 0x5c, 0xd0, 0x30, 0xa5, 0x73, 0x25, 0x5e, 0xc5, 0x5d, 0xd0, 0x28,
+  0xa5, 0x74, 0xc5, 0x5f, 0xd0, 0x22, 0xa5, 0x30, 0xc5, 0x60, 0xd0, 0x1c,
+  0xad, 0x00, 0x03, 0xc5, 0x61, 0xd0, 0x15, 0xad, 0xff, 0x01, 0xc5, 0x62,
+  0xd0, 0x0e, 0x18, 0xa5, 0x00, 0x69, 0x14, 0x85, 0x00, 0x90, 0x02, 0xe6,
+  0x01, 0x4c, 0x0c, 0x04, 0x4c, 0xa8, 0x04, 0x4c, 0xab, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c,
+  0x55, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xe8, 0x4c, 0x55, 0x04, 0x00, 0xe8, 0x4c, 0x55, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x48, 0x4e, 0x5b, 0xe7, 0xbb, 0x62,
+  0x00, 0x03, 0x4e, 0x5c, 0xe7, 0x3d, 0xff, 0xfc, 0x62, 0x62, 0x05, 0x00,
+  0x00, 0x48, 0x48, 0x8a, 0x3f, 0xea, 0xa5, 0xba, 0x00, 0x03, 0x8a, 0x40,
+  0xea, 0x35, 0xff, 0xfc, 0xba, 0xba, 0x05, 0x00, 0x00, 0x48, 0x48, 0x69,
+  0x81, 0xd0, 0x23, 0xd3, 0x00, 0x03, 0x69, 0x82, 0xd0, 0xb5, 0xff, 0xfc,
+  0xd3, 0xd3, 0x05, 0x00, 0x00, 0x48, 0x48, 0xef, 0xc5, 0x8b, 0x25, 0xc3,
+  0x00, 0x03, 0xef, 0xc6, 0x8b, 0xb5, 0xff, 0xfc, 0xc3, 0xc3, 0x05, 0x00,
+  0x01, 0x40, 0x48, 0x04, 0x00, 0xb1, 0xa5, 0x40, 0x4f, 0x02, 0x44, 0x00,
+  0xb1, 0x35, 0xff, 0xfe, 0x40, 0x40, 0x44, 0x00, 0x01, 0x40, 0x48, 0x7a,
+  0x00, 0x0e, 0x34, 0x3f, 0xf2, 0x02, 0x7f, 0x00, 0x0e, 0x34, 0xff, 0xfe,
+  0x3f, 0x3f, 0x7f, 0x00, 0x01, 0x3f, 0x48, 0x40, 0x01, 0x61, 0xcc, 0x0f,
+  0x9f, 0x02, 0x4f, 0x01, 0x61, 0x7c, 0xff, 0xfe, 0x0f, 0x0f, 0x4f, 0x00,
+  0x01, 0x3f, 0x48, 0x70, 0x01, 0xb1, 0x9f, 0xc0, 0x4f, 0x02, 0xf0, 0x01,
+  0xb1, 0xbd, 0xff, 0xfe, 0xc0, 0xc0, 0xf0, 0x00, 0x01, 0xc1, 0x48, 0x7d,
+  0x7f, 0x81, 0x42, 0x0f, 0x7f, 0x02, 0x7f, 0x7f, 0x81, 0x70, 0xff, 0xfe,
+  0x0f, 0x0f, 0x7f, 0x00, 0x01, 0xc1, 0x48, 0xeb, 0x7f, 0x0a, 0x44, 0x02,
+  0xf6, 0x02, 0xeb, 0x7f, 0x0a, 0xf4, 0xff, 0xfe, 0x02, 0x02, 0xeb, 0x00,
+  0x01, 0x6b, 0x48, 0xb3, 0xd5, 0xa8, 0x1c, 0x7f, 0x58, 0x02, 0xff, 0xd5,
+  0xa8, 0xbc, 0xff, 0xfe, 0x7f, 0x7f, 0xff, 0x00, 0x01, 0x6b, 0x48, 0xbd,
+  0xd5, 0xfa, 0x2f, 0x0f, 0x06, 0x02, 0xbf, 0xd5, 0xfa, 0xbd, 0xff, 0xfe,
+  0x0f, 0x0f, 0xbf, 0x00, 0x01, 0x41, 0x48, 0x35, 0xff, 0x12, 0x1d, 0x80,
+  0xee, 0x02, 0xb5, 0xff, 0x12, 0xbd, 0xff, 0xfe, 0x80, 0x80, 0xb5, 0x00,
+  0x01, 0x41, 0x48, 0x8d, 0xff, 0xd6, 0xd0, 0x02, 0x2a, 0x02, 0x8f, 0xff,
+  0xd6, 0xf0, 0xff, 0xfe, 0x02, 0x02, 0x8f, 0x00, 0x03, 0x40, 0x48, 0x04,
+  0x00, 0x74, 0x78, 0xff, 0x8c, 0x02, 0xfe, 0x00, 0x74, 0xf9, 0xff, 0xfe,
+  0xff, 0xfe, 0xfe, 0x00, 0x03, 0x40, 0x48, 0x8c, 0x00, 0xd5, 0xc1, 0x80,
+  0x2b, 0x02, 0x8c, 0x00, 0xd5, 0xf1, 0xff, 0xfe, 0x80, 0x00, 0x8c, 0x00,
+  0x03, 0x3f, 0x48, 0x46, 0x01, 0x78, 0xd7, 0xaa, 0x88, 0x02, 0x56, 0x01,
+  0x78, 0x75, 0xff, 0xfe, 0xaa, 0x54, 0x56, 0x00, 0x03, 0x3f, 0x48, 0xbd,
+  0x01, 0xdf, 0x1c, 0x02, 0x21, 0x02, 0xbd, 0x01, 0xdf, 0xbc, 0xff, 0xfe,
+  0x02, 0x04, 0xbd, 0x00, 0x03, 0xc1, 0x48, 0xc3, 0x7f, 0x14, 0xf6, 0x5b,
+  0xec, 0x02, 0xf7, 0x7f, 0x14, 0xf4, 0xff, 0xfe, 0x5b, 0xb6, 0xf7, 0x00,
+  0x03, 0xc1, 0x48, 0x6e, 0x7f, 0xea, 0x05, 0x7f, 0x16, 0x02, 0xfe, 0x7f,
+  0xea, 0xb4, 0xff, 0xfe, 0x7f, 0xfe, 0xfe, 0x00, 0x03, 0x6b, 0x48, 0x07,
+  0xd5, 0x96, 0xf3, 0xff, 0x6a, 0x02, 0xff, 0xd5, 0x96, 0xf1, 0xff, 0xfe,
+  0xff, 0xfe, 0xff, 0x00, 0x03, 0x6b, 0x48, 0x42, 0xd5, 0x73, 0x54, 0x40,
+  0x8d, 0x02, 0xc2, 0xd5, 0x73, 0xf4, 0xff, 0xfe, 0x40, 0x80, 0xc2, 0x00,
+  0x03, 0x41, 0x48, 0x66, 0xff, 0x07, 0xab, 0x81, 0xf9, 0x02, 0x66, 0xff,
+  0x07, 0x39, 0xff, 0xfe, 0x81, 0x02, 0x66, 0x00, 0x03, 0x41, 0x48, 0x3b,
+  0xff, 0xe4, 0x97, 0x00, 0x1c, 0x02, 0x3b, 0xff, 0xe4, 0x34, 0xff, 0xfe,
+  0x00, 0x00, 0x3b, 0x00, 0x04, 0x30, 0x48, 0x26, 0x8c, 0xa6, 0x81, 0x41,
+  0x5a, 0x02, 0x26, 0x8c, 0xa6, 0xb1, 0xff, 0xfe, 0x41, 0x41, 0x26, 0x00,
+  0x04, 0x30, 0x48, 0xc2, 0x51, 0x23, 0xde, 0xff, 0xdd, 0x02, 0xc2, 0x51,
+  0x23, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xc2, 0x00, 0x04, 0x30, 0x48, 0x15,
+  0x39, 0xf2, 0x18, 0x81, 0x0e, 0x02, 0x15, 0x39, 0xf2, 0x38, 0xff, 0xfe,
+  0x81, 0x81, 0x15, 0x00, 0x04, 0x30, 0x48, 0x6c, 0x85, 0xc1, 0x6a, 0x3f,
+  0x3f, 0x02, 0x6c, 0x85, 0xc1, 0x7a, 0xff, 0xfe, 0x3f, 0x3f, 0x6c, 0x00,
+  0x05, 0x30, 0x48, 0xd3, 0x0b, 0x6d, 0xfa, 0x0f, 0x93, 0x02, 0xdf, 0x0b,
+  0x6d, 0xf8, 0xff, 0xfe, 0x0f, 0x0f, 0xdf, 0x00, 0x05, 0x30, 0x48, 0x19,
+  0x7a, 0x94, 0x26, 0x02, 0x6c, 0x02, 0x1b, 0x7a, 0x94, 0x34, 0xff, 0xfe,
+  0x02, 0x02, 0x1b, 0x00, 0x05, 0x30, 0x48, 0x3b, 0x01, 0x78, 0x00, 0x00,
+  0x88, 0x02, 0x3b, 0x01, 0x78, 0x30, 0xff, 0xfe, 0x00, 0x00, 0x3b, 0x00,
+  0x05, 0x30, 0x48, 0xe3, 0xb5, 0x11, 0xac, 0xfe, 0xef, 0x02, 0xff, 0xb5,
+  0x11, 0xbc, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x00, 0x05, 0x30, 0x48, 0xa2,
+  0x4b, 0xb8, 0xc8, 0xc0, 0x48, 0x02, 0xe2, 0x4b, 0xb8, 0xf8, 0xff, 0xfe,
+  0xc0, 0xc0, 0xe2, 0x00, 0x05, 0x30, 0x48, 0xf2, 0x41, 0x1a, 0x4a, 0xff,
+  0xe6, 0x02, 0xff, 0x41, 0x1a, 0xf8, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x00,
+  0x06, 0x30, 0x48, 0xe0, 0x3c, 0x65, 0xe6, 0x02, 0x9b, 0x02, 0xe0, 0x3c,
+  0x65, 0x74, 0xff, 0xfe, 0x04, 0x02, 0xe0, 0x00, 0x06, 0x30, 0x48, 0x4a,
+  0x87, 0xf4, 0x44, 0xc0, 0x0c, 0x02, 0x4a, 0x87, 0xf4, 0xf5, 0xff, 0xfe,
+  0x80, 0xc0, 0x4a, 0x00, 0x06, 0x30, 0x48, 0x00, 0x63, 0xb8, 0x1a, 0x02,
+  0x48, 0x02, 0x00, 0x63, 0xb8, 0x38, 0xff, 0xfe, 0x04, 0x02, 0x00, 0x00,
+  0x06, 0x30, 0x48, 0x29, 0xe7, 0xe9, 0x53, 0x02, 0x17, 0x02, 0x29, 0xe7,
+  0xe9, 0x70, 0xff, 0xfe, 0x04, 0x02, 0x29, 0x00, 0x06, 0x30, 0x48, 0x04,
+  0x33, 0xa7, 0xf9, 0x80, 0x59, 0x02, 0x04, 0x33, 0xa7, 0x7b, 0xff, 0xfe,
+  0x00, 0x80, 0x04, 0x00, 0x06, 0x30, 0x48, 0xaf, 0x4e, 0x39, 0xad, 0x02,
+  0xc7, 0x02, 0xaf, 0x4e, 0x39, 0x3c, 0xff, 0xfe, 0x04, 0x02, 0xaf, 0x00,
+  0x07, 0x30, 0x48, 0x93, 0xec, 0xdd, 0xb1, 0xfe, 0x23, 0x02, 0xff, 0xec,
+  0xdd, 0xb1, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0x00, 0x07, 0x30, 0x48, 0x25,
+  0xc6, 0x06, 0x08, 0xff, 0xfa, 0x02, 0xff, 0xc6, 0x06, 0xb9, 0xff, 0xfe,
+  0xfe, 0xff, 0xff, 0x00, 0x07, 0x30, 0x48, 0x92, 0xfe, 0xbf, 0xae, 0x7f,
+  0x41, 0x02, 0xfe, 0xfe, 0xbf, 0xbc, 0xff, 0xfe, 0xfe, 0x7f, 0xfe, 0x00,
+  0x07, 0x30, 0x48, 0x67, 0xad, 0xe2, 0x3c, 0x22, 0x1e, 0x02, 0x67, 0xad,
+  0xe2, 0x3c, 0xff, 0xfe, 0x44, 0x22, 0x67, 0x00, 0x07, 0x30, 0x48, 0x58,
+  0x76, 0x17, 0x6d, 0x40, 0xe9, 0x02, 0xd8, 0x76, 0x17, 0xfc, 0xff, 0xfe,
+  0x80, 0x40, 0xd8, 0x00, 0x07, 0x30, 0x48, 0xba, 0x8c, 0xfe, 0xa7, 0x01,
+  0x02, 0x02, 0xba, 0x8c, 0xfe, 0xb4, 0xff, 0xfe, 0x02, 0x01, 0xba, 0x00,
+  0x08, 0x48, 0x48, 0x5b, 0xae, 0x6f, 0x26, 0x81, 0x91, 0x02, 0x5b, 0xae,
+  0x6f, 0x36, 0xff, 0xfc, 0x81, 0x81, 0x36, 0x00, 0x08, 0x48, 0x48, 0xf6,
+  0x2e, 0xfb, 0x58, 0xc0, 0x05, 0x02, 0xf6, 0x2e, 0xfb, 0x78, 0xff, 0xfc,
+  0xc0, 0xc0, 0x78, 0x00, 0x08, 0x48, 0x48, 0x3d, 0x5a, 0xca, 0x48, 0x80,
+  0x36, 0x02, 0x3d, 0x5a, 0xca, 0x78, 0xff, 0xfc, 0x80, 0x80, 0x78, 0x00,
+  0x08, 0x48, 0x48, 0x45, 0xc1, 0x0d, 0x9c, 0x02, 0xf3, 0x02, 0x45, 0xc1,
+  0x0d, 0xbc, 0xff, 0xfc, 0x02, 0x02, 0xbc, 0x00, 0x08, 0x48, 0x48, 0x8b,
+  0x3c, 0xfd, 0xa4, 0xff, 0x03, 0x02, 0x8b, 0x3c, 0xfd, 0xb4, 0xff, 0xfc,
+  0xff, 0xff, 0xb4, 0x00, 0x08, 0x48, 0x48, 0xa3, 0x27, 0xb3, 0x5d, 0x00,
+  0x4d, 0x02, 0xa3, 0x27, 0xb3, 0x7d, 0xff, 0xfc, 0x00, 0x00, 0x7d, 0x00,
+  0x09, 0x00, 0x48, 0x00, 0x7c, 0xed, 0xca, 0x60, 0x00, 0x03, 0x00, 0x7c,
+  0xed, 0x7a, 0xff, 0xfe, 0x60, 0x60, 0x00, 0x00, 0x09, 0x0f, 0x48, 0x00,
+  0xb1, 0x2d, 0x51, 0x0c, 0x00, 0x03, 0x0f, 0xb1, 0x2d, 0x71, 0xff, 0xfe,
+  0x0c, 0x0c, 0x0f, 0x00, 0x09, 0x40, 0x48, 0x00, 0x8f, 0xd8, 0xb9, 0x24,
+  0x00, 0x03, 0x40, 0x8f, 0xd8, 0x39, 0xff, 0xfe, 0x24, 0x24, 0x40, 0x00,
+  0x09, 0x80, 0x48, 0x00, 0xd8, 0x0a, 0xd4, 0x03, 0x00, 0x03, 0x80, 0xd8,
+  0x0a, 0xf4, 0xff, 0xfe, 0x03, 0x03, 0x80, 0x00, 0x09, 0xfe, 0x48, 0x00,
+  0xb0, 0x49, 0xba, 0x4b, 0x00, 0x03, 0xfe, 0xb0, 0x49, 0xb8, 0xff, 0xfe,
+  0x4b, 0x4b, 0xfe, 0x00, 0x09, 0x00, 0x48, 0x01, 0xbb, 0x97, 0xf0, 0x7a,
+  0x00, 0x03, 0x01, 0xbb, 0x97, 0x70, 0xff, 0xfe, 0x7a, 0x7a, 0x01, 0x00,
+  0x09, 0x0f, 0x48, 0x01, 0x8e, 0x29, 0xc9, 0x11, 0x00, 0x03, 0x0f, 0x8e,
+  0x29, 0x79, 0xff, 0xfe, 0x11, 0x11, 0x0f, 0x00, 0x09, 0x40, 0x48, 0x01,
+  0xb6, 0x22, 0x6a, 0x70, 0x00, 0x03, 0x41, 0xb6, 0x22, 0x78, 0xff, 0xfe,
+  0x70, 0x70, 0x41, 0x00, 0x09, 0x80, 0x48, 0x01, 0x6b, 0xf8, 0x7f, 0x66,
+  0x00, 0x03, 0x81, 0x6b, 0xf8, 0xfd, 0xff, 0xfe, 0x66, 0x66, 0x81, 0x00,
+  0x09, 0xfe, 0x48, 0x01, 0xb2, 0xdd, 0x3a, 0x5b, 0x00, 0x03, 0xff, 0xb2,
+  0xdd, 0xb8, 0xff, 0xfe, 0x5b, 0x5b, 0xff, 0x00, 0x09, 0x00, 0x48, 0x0f,
+  0x6b, 0xdd, 0xf5, 0x58, 0x00, 0x03, 0x0f, 0x6b, 0xdd, 0x75, 0xff, 0xfe,
+  0x58, 0x58, 0x0f, 0x00, 0x09, 0x0f, 0x48, 0x0f, 0xff, 0x01, 0xf9, 0x9d,
+  0x00, 0x03, 0x0f, 0xff, 0x01, 0x79, 0xff, 0xfe, 0x9d, 0x9d, 0x0f, 0x00,
+  0x09, 0x40, 0x48, 0x0f, 0xbc, 0x5e, 0x5a, 0xba, 0x00, 0x03, 0x4f, 0xbc,
+  0x5e, 0x78, 0xff, 0xfe, 0xba, 0xba, 0x4f, 0x00, 0x09, 0x80, 0x48, 0x0f,
+  0x1a, 0x02, 0x46, 0xba, 0x00, 0x03, 0x8f, 0x1a, 0x02, 0xf4, 0xff, 0xfe,
+  0xba, 0xba, 0x8f, 0x00, 0x09, 0xfe, 0x48, 0x0f, 0x86, 0x70, 0x34, 0x90,
+  0x00, 0x03, 0xff, 0x86, 0x70, 0xb4, 0xff, 0xfe, 0x90, 0x90, 0xff, 0x00,
+  0x09, 0x00, 0x48, 0x3f, 0x25, 0x28, 0xee, 0xa7, 0x00, 0x03, 0x3f, 0x25,
+  0x28, 0x7c, 0xff, 0xfe, 0xa7, 0xa7, 0x3f, 0x00, 0x09, 0x0f, 0x48, 0x3f,
+  0x3a, 0x78, 0x4a, 0x75, 0x00, 0x03, 0x3f, 0x3a, 0x78, 0x78, 0xff, 0xfe,
+  0x75, 0x75, 0x3f, 0x00, 0x09, 0x40, 0x48, 0x3f, 0xf8, 0xff, 0xfe, 0x58,
+  0x00, 0x03, 0x7f, 0xf8, 0xff, 0x7c, 0xff, 0xfe, 0x58, 0x58, 0x7f, 0x00,
+  0x09, 0x80, 0x48, 0x3f, 0x6d, 0x8a, 0x21, 0xda, 0x00, 0x03, 0xbf, 0x6d,
+  0x8a, 0xb1, 0xff, 0xfe, 0xda, 0xda, 0xbf, 0x00, 0x09, 0xfe, 0x48, 0x3f,
+  0xcf, 0x97, 0x1f, 0x36, 0x00, 0x03, 0xff, 0xcf, 0x97, 0xbd, 0xff, 0xfe,
+  0x36, 0x36, 0xff, 0x00, 0x09, 0x00, 0x48, 0x40, 0x5a, 0x7d, 0xe4, 0x7f,
+  0x00, 0x03, 0x40, 0x5a, 0x7d, 0x74, 0xff, 0xfe, 0x7f, 0x7f, 0x40, 0x00,
+  0x09, 0x0f, 0x48, 0x40, 0x7e, 0x63, 0x8e, 0x90, 0x00, 0x03, 0x4f, 0x7e,
+  0x63, 0x3c, 0xff, 0xfe, 0x90, 0x90, 0x4f, 0x00, 0x09, 0x40, 0x48, 0x40,
+  0x3c, 0x99, 0x1b, 0x10, 0x00, 0x03, 0x40, 0x3c, 0x99, 0x39, 0xff, 0xfe,
+  0x10, 0x10, 0x40, 0x00, 0x09, 0x80, 0x48, 0x40, 0x0c, 0x03, 0x32, 0x99,
+  0x00, 0x03, 0xc0, 0x0c, 0x03, 0xb0, 0xff, 0xfe, 0x99, 0x99, 0xc0, 0x00,
+  0x09, 0xfe, 0x48, 0x40, 0x89, 0xb5, 0xe3, 0x9a, 0x00, 0x03, 0xfe, 0x89,
+  0xb5, 0xf1, 0xff, 0xfe, 0x9a, 0x9a, 0xfe, 0x00, 0x09, 0x00, 0x48, 0x7f,
+  0xb3, 0x3f, 0x08, 0xe4, 0x00, 0x03, 0x7f, 0xb3, 0x3f, 0x38, 0xff, 0xfe,
+  0xe4, 0xe4, 0x7f, 0x00, 0x09, 0x0f, 0x48, 0x7f, 0x34, 0x5d, 0xa5, 0xa3,
+  0x00, 0x03, 0x7f, 0x34, 0x5d, 0x35, 0xff, 0xfe, 0xa3, 0xa3, 0x7f, 0x00,
+  0x09, 0x40, 0x48, 0x7f, 0xec, 0x59, 0x51, 0x20, 0x00, 0x03, 0x7f, 0xec,
+  0x59, 0x71, 0xff, 0xfe, 0x20, 0x20, 0x7f, 0x00, 0x09, 0x80, 0x48, 0x7f,
+  0xd5, 0x7f, 0x55, 0x7e, 0x00, 0x03, 0xff, 0xd5, 0x7f, 0xf5, 0xff, 0xfe,
+  0x7e, 0x7e, 0xff, 0x00, 0x09, 0xfe, 0x48, 0x7f, 0x51, 0xfc, 0x1b, 0x7e,
+  0x00, 0x03, 0xff, 0x51, 0xfc, 0xb9, 0xff, 0xfe, 0x7e, 0x7e, 0xff, 0x00,
+  0x09, 0x00, 0x48, 0x80, 0xe7, 0x70, 0xc1, 0x38, 0x00, 0x03, 0x80, 0xe7,
+  0x70, 0xf1, 0xff, 0xfe, 0x38, 0x38, 0x80, 0x00, 0x09, 0x0f, 0x48, 0x80,
+  0x97, 0xaf, 0x47, 0x1c, 0x00, 0x03, 0x8f, 0x97, 0xaf, 0xf5, 0xff, 0xfe,
+  0x1c, 0x1c, 0x8f, 0x00, 0x09, 0x40, 0x48, 0x80, 0xb1, 0xb4, 0xe4, 0xae,
+  0x00, 0x03, 0xc0, 0xb1, 0xb4, 0xf4, 0xff, 0xfe, 0xae, 0xae, 0xc0, 0x00,
+  0x09, 0x80, 0x48, 0x80, 0xfc, 0x7c, 0x73, 0xea, 0x00, 0x03, 0x80, 0xfc,
+  0x7c, 0xf1, 0xff, 0xfe, 0xea, 0xea, 0x80, 0x00, 0x09, 0xfe, 0x48, 0x80,
+  0x70, 0xd3, 0xb8, 0xaf, 0x00, 0x03, 0xfe, 0x70, 0xd3, 0xb8, 0xff, 0xfe,
+  0xaf, 0xaf, 0xfe, 0x00, 0x09, 0x00, 0x48, 0x81, 0x3a, 0x8b, 0xfa, 0x61,
+  0x00, 0x03, 0x81, 0x3a, 0x8b, 0xf8, 0xff, 0xfe, 0x61, 0x61, 0x81, 0x00,
+  0x09, 0x0f, 0x48, 0x81, 0xbb, 0x94, 0xfe, 0x5a, 0x00, 0x03, 0x8f, 0xbb,
+  0x94, 0xfc, 0xff, 0xfe, 0x5a, 0x5a, 0x8f, 0x00, 0x09, 0x40, 0x48, 0x81,
+  0x02, 0xda, 0x01, 0xa6, 0x00, 0x03, 0xc1, 0x02, 0xda, 0xb1, 0xff, 0xfe,
+  0xa6, 0xa6, 0xc1, 0x00, 0x09, 0x80, 0x48, 0x81, 0xb6, 0x53, 0xd2, 0x39,
+  0x00, 0x03, 0x81, 0xb6, 0x53, 0xf0, 0xff, 0xfe, 0x39, 0x39, 0x81, 0x00,
+  0x09, 0xfe, 0x48, 0x81, 0xb7, 0x4a, 0x78, 0xef, 0x00, 0x03, 0xff, 0xb7,
+  0x4a, 0xf8, 0xff, 0xfe, 0xef, 0xef, 0xff, 0x00, 0x09, 0x00, 0x48, 0xfe,
+  0x1a, 0xfa, 0x8a, 0xa2, 0x00, 0x03, 0xfe, 0x1a, 0xfa, 0xb8, 0xff, 0xfe,
+  0xa2, 0xa2, 0xfe, 0x00, 0x09, 0x0f, 0x48, 0xfe, 0x38, 0x92, 0x54, 0x06,
+  0x00, 0x03, 0xff, 0x38, 0x92, 0xf4, 0xff, 0xfe, 0x06, 0x06, 0xff, 0x00,
+  0x09, 0x40, 0x48, 0xfe, 0xab, 0x37, 0xa3, 0xc2, 0x00, 0x03, 0xfe, 0xab,
+  0x37, 0xb1, 0xff, 0xfe, 0xc2, 0xc2, 0xfe, 0x00, 0x09, 0x80, 0x48, 0xfe,
+  0xac, 0xaa, 0x49, 0x6f, 0x00, 0x03, 0xfe, 0xac, 0xaa, 0xf9, 0xff, 0xfe,
+  0x6f, 0x6f, 0xfe, 0x00, 0x09, 0xfe, 0x48, 0xfe, 0x1c, 0x51, 0x2a, 0x9a,
+  0x00, 0x03, 0xfe, 0x1c, 0x51, 0xb8, 0xff, 0xfe, 0x9a, 0x9a, 0xfe, 0x00,
+  0x09, 0x00, 0x48, 0xff, 0xd9, 0x47, 0xcd, 0x67, 0x00, 0x03, 0xff, 0xd9,
+  0x47, 0xfd, 0xff, 0xfe, 0x67, 0x67, 0xff, 0x00, 0x09, 0x0f, 0x48, 0xff,
+  0x5f, 0x74, 0xe8, 0x50, 0x00, 0x03, 0xff, 0x5f, 0x74, 0xf8, 0xff, 0xfe,
+  0x50, 0x50, 0xff, 0x00, 0x09, 0x40, 0x48, 0xff, 0xcd, 0x7c, 0xb2, 0xe4,
+  0x00, 0x03, 0xff, 0xcd, 0x7c, 0xb0, 0xff, 0xfe, 0xe4, 0xe4, 0xff, 0x00,
+  0x09, 0x80, 0x48, 0xff, 0x72, 0xbb, 0x46, 0xe9, 0x00, 0x03, 0xff, 0x72,
+  0xbb, 0xf4, 0xff, 0xfe, 0xe9, 0xe9, 0xff, 0x00, 0x09, 0xfe, 0x48, 0xff,
+  0xb1, 0x7e, 0x90, 0x2b, 0x00, 0x03, 0xff, 0xb1, 0x7e, 0xb0, 0xff, 0xfe,
+  0x2b, 0x2b, 0xff, 0x00, 0x0a, 0x48, 0x48, 0x4e, 0x7d, 0xa7, 0x55, 0xaa,
+  0x59, 0x02, 0x9c, 0x7d, 0xa7, 0xf4, 0xff, 0xfd, 0xaa, 0xaa, 0x9c, 0x00,
+  0x0a, 0x48, 0x48, 0xc9, 0xd6, 0x2f, 0x8a, 0x81, 0xd1, 0x02, 0x92, 0xd6,
+  0x2f, 0xb9, 0xff, 0xfd, 0x81, 0x81, 0x92, 0x00, 0x0a, 0x48, 0x48, 0x2c,
+  0xad, 0xad, 0x94, 0x81, 0x53, 0x02, 0x58, 0xad, 0xad, 0x34, 0xff, 0xfd,
+  0x81, 0x81, 0x58, 0x00, 0x0a, 0x48, 0x48, 0x45, 0x29, 0xf7, 0x05, 0xfe,
+  0x09, 0x02, 0x8a, 0x29, 0xf7, 0xb4, 0xff, 0xfd, 0xfe, 0xfe, 0x8a, 0x00,
+  0x0a, 0x48, 0x48, 0xc0, 0x10, 0xd7, 0x23, 0xff, 0x29, 0x02, 0x80, 0x10,
+  0xd7, 0xb1, 0xff, 0xfd, 0xff, 0xff, 0x80, 0x00, 0x0a, 0x48, 0x48, 0xe2,
+  0x88, 0x4d, 0xb3, 0x01, 0xb3, 0x02, 0xc4, 0x88, 0x4d, 0xb1, 0xff, 0xfd,
+  0x01, 0x01, 0xc4, 0x00, 0x0c, 0x00, 0x03, 0x06, 0x6f, 0xda, 0x46, 0xc7,
+  0x26, 0x02, 0x06, 0x6f, 0xda, 0x76, 0xff, 0xff, 0xc7, 0xc7, 0x76, 0x00,
+  0x0c, 0x00, 0x03, 0x5a, 0xc5, 0x93, 0x3f, 0xc0, 0x6d, 0x02, 0x5a, 0xc5,
+  0x93, 0x3f, 0xff, 0xff, 0xc0, 0xc0, 0x3f, 0x00, 0x0c, 0x00, 0x03, 0x66,
+  0xa5, 0x4b, 0x10, 0xbb, 0xb5, 0x02, 0x66, 0xa5, 0x4b, 0x30, 0xff, 0xff,
+  0xbb, 0xbb, 0x30, 0x00, 0x0c, 0x00, 0x03, 0x21, 0x52, 0xbb, 0x1f, 0x00,
+  0x45, 0x02, 0x21, 0x52, 0xbb, 0x3f, 0xff, 0xff, 0x00, 0x00, 0x3f, 0x00,
+  0x0d, 0x00, 0x03, 0xaa, 0x81, 0xf8, 0x20, 0xfe, 0x08, 0x02, 0xfe, 0x81,
+  0xf8, 0xb0, 0xff, 0xff, 0xfe, 0xfe, 0xb0, 0x00, 0x0d, 0x00, 0x03, 0xd7,
+  0x6a, 0xc1, 0x20, 0x3f, 0x3f, 0x02, 0xff, 0x6a, 0xc1, 0xb0, 0xff, 0xff,
+  0x3f, 0x3f, 0xb0, 0x00, 0x0d, 0x00, 0x03, 0x84, 0x14, 0x75, 0x49, 0x0f,
+  0x8b, 0x02, 0x8f, 0x14, 0x75, 0xf9, 0xff, 0xff, 0x0f, 0x0f, 0xf9, 0x00,
+  0x0d, 0x00, 0x03, 0x77, 0xcb, 0x4f, 0xe9, 0x40, 0xb1, 0x02, 0x77, 0xcb,
+  0x4f, 0x79, 0xff, 0xff, 0x40, 0x40, 0x79, 0x00, 0x0d, 0x00, 0x03, 0x6f,
+  0x31, 0xdd, 0xe7, 0x0f, 0x23, 0x02, 0x6f, 0x31, 0xdd, 0x75, 0xff, 0xff,
+  0x0f, 0x0f, 0x75, 0x00, 0x0d, 0x00, 0x03, 0x00, 0x2a, 0x9c, 0xc7, 0x80,
+  0x64, 0x02, 0x80, 0x2a, 0x9c, 0xf5, 0xff, 0xff, 0x80, 0x80, 0xf5, 0x00,
+  0x0e, 0x00, 0x03, 0xd7, 0x69, 0xd9, 0xfa, 0x40, 0x27, 0x02, 0xd7, 0x69,
+  0xd9, 0xf8, 0xff, 0xff, 0x40, 0x80, 0xf8, 0x00, 0x0e, 0x00, 0x03, 0xf1,
+  0xd1, 0x95, 0x1c, 0x01, 0x6b, 0x02, 0xf1, 0xd1, 0x95, 0x3c, 0xff, 0xff,
+  0x01, 0x02, 0x3c, 0x00, 0x0e, 0x00, 0x03, 0xcf, 0x73, 0x2e, 0x90, 0xaa,
+  0xd2, 0x02, 0xcf, 0x73, 0x2e, 0x31, 0xff, 0xff, 0xaa, 0x54, 0x31, 0x00,
+  0x0e, 0x00, 0x03, 0x7d, 0x70, 0x71, 0xa5, 0xaa, 0x8f, 0x02, 0x7d, 0x70,
+  0x71, 0x35, 0xff, 0xff, 0xaa, 0x54, 0x35, 0x00, 0x0e, 0x00, 0x03, 0xc1,
+  0x8d, 0xc0, 0x31, 0x00, 0x40, 0x02, 0xc1, 0x8d, 0xc0, 0x32, 0xff, 0xff,
+  0x00, 0x00, 0x32, 0x00, 0x0e, 0x00, 0x03, 0xcf, 0xd5, 0xa7, 0x6c, 0x9d,
+  0x59, 0x02, 0xcf, 0xd5, 0xa7, 0x7d, 0xff, 0xff, 0x9d, 0x3a, 0x7d, 0x00,
+  0x0f, 0x00, 0x03, 0xf0, 0x56, 0x05, 0x09, 0x81, 0xfb, 0x02, 0xf2, 0x56,
+  0x05, 0xb9, 0xff, 0xff, 0x81, 0x02, 0xb9, 0x00, 0x0f, 0x00, 0x03, 0xe0,
+  0x4e, 0x18, 0x0c, 0x01, 0xe8, 0x02, 0xe2, 0x4e, 0x18, 0xbc, 0xff, 0xff,
+  0x01, 0x02, 0xbc, 0x00, 0x0f, 0x00, 0x03, 0x4d, 0x97, 0x2b, 0xa7, 0x3f,
+  0xd5, 0x02, 0x7f, 0x97, 0x2b, 0x34, 0xff, 0xff, 0x3f, 0x7e, 0x34, 0x00,
+  0x0f, 0x00, 0x03, 0x9f, 0x33, 0xf7, 0xe7, 0x0f, 0x09, 0x02, 0x9f, 0x33,
+  0xf7, 0xf4, 0xff, 0xff, 0x0f, 0x1e, 0xf4, 0x00, 0x0f, 0x00, 0x03, 0x0c,
+  0x09, 0xf3, 0xf9, 0x3b, 0x0d, 0x02, 0x7e, 0x09, 0xf3, 0x78, 0xff, 0xff,
+  0x3b, 0x76, 0x78, 0x00, 0x0f, 0x00, 0x03, 0x8c, 0x07, 0xed, 0xda, 0x3f,
+  0x13, 0x02, 0xfe, 0x07, 0xed, 0xf8, 0xff, 0xff, 0x3f, 0x7e, 0xf8, 0x00,
+  0x10, 0x01, 0x48, 0x28, 0xde, 0x35, 0xd6, 0x96, 0x00, 0x03, 0x28, 0xde,
+  0x35, 0xf6, 0xff, 0xfe, 0x96, 0x96, 0x28, 0x00, 0x10, 0x01, 0x48, 0xb4,
+  0x18, 0x18, 0xc1, 0x2c, 0x00, 0x03, 0xb4, 0x18, 0x18, 0xf1, 0xff, 0xfe,
+  0x2c, 0x2c, 0xb4, 0x00, 0x10, 0x01, 0x48, 0xb0, 0x30, 0x9c, 0x22, 0x5b,
+  0x00, 0x03, 0xb0, 0x30, 0x9c, 0x32, 0xff, 0xff, 0x5b, 0x5b, 0x32, 0x00,
+  0x10, 0x01, 0x48, 0x75, 0x13, 0xc4, 0x3c, 0xd8, 0x00, 0x03, 0x75, 0x13,
+  0xc4, 0x3c, 0xff, 0xff, 0xd8, 0xd8, 0x3c, 0x00, 0x10, 0x01, 0x48, 0xe2,
+  0x99, 0xf3, 0x38, 0x0b, 0x00, 0x03, 0xe2, 0x99, 0xf3, 0x38, 0xff, 0xff,
+  0x0b, 0x0b, 0x38, 0x00, 0x10, 0x01, 0x48, 0x4f, 0x68, 0x07, 0xc8, 0x1c,
+  0x00, 0x03, 0x4f, 0x68, 0x07, 0xf8, 0xff, 0xfe, 0x1c, 0x1c, 0x4f, 0x00,
+  0x10, 0x01, 0x48, 0xd9, 0xa8, 0x70, 0xc5, 0xcc, 0x00, 0x03, 0xd9, 0xa8,
+  0x70, 0xf5, 0xff, 0xfe, 0xcc, 0xcc, 0xd9, 0x00, 0x10, 0x01, 0x48, 0x1e,
+  0xcb, 0x49, 0xcf, 0x2e, 0x00, 0x03, 0x1e, 0xcb, 0x49, 0xff, 0xff, 0xfe,
+  0x2e, 0x2e, 0x1e, 0x00, 0x10, 0x01, 0x48, 0x4e, 0x65, 0x7a, 0x87, 0xdb,
+  0x00, 0x03, 0x4e, 0x65, 0x7a, 0xb7, 0xff, 0xfe, 0xdb, 0xdb, 0x4e, 0x00,
+  0x10, 0x01, 0x48, 0x6c, 0x12, 0x81, 0xec, 0x81, 0x00, 0x03, 0x6c, 0x12,
+  0x81, 0xfc, 0xff, 0xfe, 0x81, 0x81, 0x6c, 0x00, 0x10, 0x01, 0x48, 0x52,
+  0x87, 0xfb, 0x0e, 0x2d, 0x00, 0x03, 0x52, 0x87, 0xfb, 0x3e, 0xff, 0xff,
+  0x2d, 0x2d, 0x3e, 0x00, 0x10, 0x01, 0x48, 0x51, 0xf9, 0x62, 0xcd, 0xde,
+  0x00, 0x03, 0x51, 0xf9, 0x62, 0xfd, 0xff, 0xfe, 0xde, 0xde, 0x51, 0x00,
+  0x10, 0x01, 0x48, 0xf6, 0x94, 0x11, 0x2c, 0x85, 0x00, 0x03, 0xf6, 0x94,
+  0x11, 0x3c, 0xff, 0xff, 0x85, 0x85, 0x3c, 0x00, 0x10, 0x01, 0x48, 0xfb,
+  0x5b, 0xb2, 0x27, 0x3a, 0x00, 0x03, 0xfb, 0x5b, 0xb2, 0x37, 0xff, 0xff,
+  0x3a, 0x3a, 0x37, 0x00, 0x10, 0x01, 0x48, 0x2b, 0xec, 0xf1, 0x2d, 0x25,
+  0x00, 0x03, 0x2b, 0xec, 0xf1, 0x3d, 0xff, 0xff, 0x25, 0x25, 0x3d, 0x00,
+  0x10, 0x01, 0x48, 0x31, 0x0e, 0xa3, 0xcf, 0x67, 0x00, 0x03, 0x31, 0x0e,
+  0xa3, 0xff, 0xff, 0xfe, 0x67, 0x67, 0x31, 0x00, 0x10, 0x01, 0x48, 0x5b,
+  0xf7, 0xaa, 0x6c, 0x10, 0x00, 0x03, 0x5b, 0xf7, 0xaa, 0x7c, 0xff, 0xff,
+  0x10, 0x10, 0x7c, 0x00, 0x10, 0x01, 0x48, 0x84, 0xf3, 0x48, 0xde, 0xc4,
+  0x00, 0x03, 0x84, 0xf3, 0x48, 0xfe, 0xff, 0xfe, 0xc4, 0xc4, 0x84, 0x00,
+  0x10, 0x01, 0x48, 0x6e, 0xa3, 0xd2, 0x8e, 0x09, 0x00, 0x03, 0x6e, 0xa3,
+  0xd2, 0xbe, 0xff, 0xfe, 0x09, 0x09, 0x6e, 0x00, 0x10, 0x01, 0x48, 0x31,
+  0x33, 0x10, 0xbf, 0x5d, 0x00, 0x03, 0x31, 0x33, 0x10, 0xbf, 0xff, 0xfe,
+  0x5d, 0x5d, 0x31, 0x00, 0x10, 0x00, 0x48, 0xc9, 0x48, 0xdd, 0x75, 0xa1,
+  0x00, 0x03, 0xc9, 0x48, 0xdd, 0x75, 0xff, 0xfe, 0xa1, 0xa1, 0xc9, 0x00,
+  0x10, 0x00, 0x48, 0xa1, 0x2b, 0x1c, 0x8b, 0xd0, 0x00, 0x03, 0xa1, 0x2b,
+  0x1c, 0xbb, 0xff, 0xfe, 0xd0, 0xd0, 0xa1, 0x00, 0x10, 0x00, 0x48, 0xcd,
+  0xf5, 0xa3, 0x5b, 0x9d, 0x00, 0x03, 0xcd, 0xf5, 0xa3, 0x7b, 0xff, 0xfe,
+  0x9d, 0x9d, 0xcd, 0x00, 0x10, 0x00, 0x48, 0x07, 0xa4, 0xd4, 0x0b, 0x9d,
+  0x00, 0x03, 0x07, 0xa4, 0xd4, 0x3b, 0xff, 0xfe, 0x9d, 0x9d, 0x07, 0x00,
+  0x11, 0x42, 0x48, 0xd8, 0x11, 0x00, 0xf9, 0x7f, 0x00, 0x03, 0xff, 0x11,
+  0x00, 0xf9, 0xff, 0xfe, 0x7f, 0x7f, 0xff, 0x00, 0x11, 0x42, 0x48, 0x05,
+  0x97, 0x00, 0x10, 0xaa, 0x00, 0x03, 0xaf, 0x97, 0x00, 0xb0, 0xff, 0xfe,
+  0xaa, 0xaa, 0xaf, 0x00, 0x11, 0x42, 0x48, 0xed, 0x36, 0x01, 0x44, 0x01,
+  0xff, 0x02, 0xed, 0x36, 0x01, 0xf4, 0xff, 0xfe, 0x01, 0x01, 0xed, 0x00,
+  0x11, 0x42, 0x48, 0x4c, 0xb1, 0x01, 0xb7, 0x40, 0xff, 0x02, 0x4c, 0xb1,
+  0x01, 0x35, 0xff, 0xfe, 0x40, 0x40, 0x4c, 0x00, 0x11, 0x42, 0x48, 0xdf,
+  0xc2, 0x7f, 0x3e, 0x99, 0x81, 0x02, 0xdf, 0xc2, 0x7f, 0xbc, 0xff, 0xfe,
+  0x99, 0x99, 0xdf, 0x00, 0x11, 0x42, 0x48, 0x68, 0x6e, 0x7f, 0xf3, 0x0f,
+  0x81, 0x02, 0x6f, 0x6e, 0x7f, 0x71, 0xff, 0xfe, 0x0f, 0x0f, 0x6f, 0x00,
+  0x11, 0x42, 0x48, 0x16, 0x95, 0xd5, 0xad, 0xc0, 0x2b, 0x02, 0xd6, 0x95,
+  0xd5, 0xbd, 0xff, 0xfe, 0xc0, 0xc0, 0xd6, 0x00, 0x11, 0x42, 0x48, 0xea,
+  0xe0, 0xd5, 0x4e, 0x7f, 0x2b, 0x02, 0xff, 0xe0, 0xd5, 0xfc, 0xff, 0xfe,
+  0x7f, 0x7f, 0xff, 0x00, 0x11, 0x42, 0x48, 0x50, 0x33, 0xff, 0xf7, 0xc0,
+  0x01, 0x02, 0xd0, 0x33, 0xff, 0xf5, 0xff, 0xfe, 0xc0, 0xc0, 0xd0, 0x00,
+  0x11, 0x42, 0x48, 0xe0, 0x5a, 0xff, 0x65, 0xff, 0x01, 0x02, 0xff, 0x5a,
+  0xff, 0xf5, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x00, 0x13, 0x42, 0x48, 0x9f,
+  0xba, 0x00, 0x55, 0x40, 0x00, 0x03, 0x9f, 0xba, 0x00, 0xf4, 0xff, 0xfe,
+  0x40, 0x80, 0x9f, 0x00, 0x13, 0x42, 0x48, 0x9c, 0xe6, 0x00, 0xdb, 0xc0,
+  0x00, 0x03, 0x9c, 0xe6, 0x00, 0xf9, 0xff, 0xfe, 0xc0, 0x80, 0x9c, 0x00,
+  0x13, 0x42, 0x48, 0xbd, 0xf8, 0x01, 0x9b, 0x01, 0xff, 0x02, 0xbf, 0xf8,
+  0x01, 0xb8, 0xff, 0xfe, 0x01, 0x02, 0xbf, 0x00, 0x13, 0x42, 0x48, 0x20,
+  0x49, 0x01, 0xcb, 0x40, 0xff, 0x02, 0xa0, 0x49, 0x01, 0xf8, 0xff, 0xfe,
+  0x40, 0x80, 0xa0, 0x00, 0x13, 0x42, 0x48, 0xe7, 0x77, 0x7f, 0x59, 0xff,
+  0x81, 0x02, 0xff, 0x77, 0x7f, 0xf9, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x00,
+  0x13, 0x42, 0x48, 0x9a, 0xce, 0x7f, 0xae, 0x7f, 0x81, 0x02, 0xfe, 0xce,
+  0x7f, 0xbc, 0xff, 0xfe, 0x7f, 0xfe, 0xfe, 0x00, 0x13, 0x42, 0x48, 0x70,
+  0x4d, 0xd5, 0x39, 0x00, 0x2b, 0x02, 0x70, 0x4d, 0xd5, 0x38, 0xff, 0xfe,
+  0x00, 0x00, 0x70, 0x00, 0x13, 0x42, 0x48, 0x33, 0xf7, 0xd5, 0xfd, 0x01,
+  0x2b, 0x02, 0x33, 0xf7, 0xd5, 0x7c, 0xff, 0xfe, 0x01, 0x02, 0x33, 0x00,
+  0x13, 0x42, 0x48, 0xe1, 0x31, 0xff, 0xa3, 0x02, 0x01, 0x02, 0xe5, 0x31,
+  0xff, 0xb0, 0xff, 0xfe, 0x02, 0x04, 0xe5, 0x00, 0x13, 0x42, 0x48, 0xd8,
+  0xb9, 0xff, 0x8e, 0xfe, 0x01, 0x02, 0xfc, 0xb9, 0xff, 0xbd, 0xff, 0xfe,
+  0xfe, 0xfc, 0xfc, 0x00, 0x14, 0x30, 0x48, 0xf5, 0x00, 0x6a, 0x42, 0x70,
+  0x96, 0x02, 0xf5, 0x00, 0x6a, 0x72, 0xff, 0xfe, 0x70, 0x70, 0xf5, 0x00,
+  0x14, 0x30, 0x48, 0xe9, 0x00, 0x49, 0x78, 0x3f, 0xb7, 0x02, 0xe9, 0x00,
+  0x49, 0x78, 0xff, 0xfe, 0x3f, 0x3f, 0xe9, 0x00, 0x14, 0x2f, 0x48, 0xf9,
+  0x01, 0xa0, 0x09, 0x80, 0x60, 0x02, 0xf9, 0x01, 0xa0, 0x39, 0xff, 0xfe,
+  0x80, 0x80, 0xf9, 0x00, 0x14, 0x2f, 0x48, 0x73, 0x01, 0xb8, 0x26, 0xfe,
+  0x48, 0x02, 0x73, 0x01, 0xb8, 0x36, 0xff, 0xfe, 0xfe, 0xfe, 0x73, 0x00,
+  0x14, 0xb1, 0x48, 0xb9, 0x7f, 0x8b, 0x70, 0x7f, 0x75, 0x02, 0xb9, 0x7f,
+  0x8b, 0x70, 0xff, 0xfe, 0x7f, 0x7f, 0xb9, 0x00, 0x14, 0xb1, 0x48, 0xc1,
+  0x7f, 0x6b, 0x5c, 0xc0, 0x95, 0x02, 0xc1, 0x7f, 0x6b, 0x7c, 0xff, 0xfe,
+  0xc0, 0xc0, 0xc1, 0x00, 0x14, 0x5b, 0x48, 0x70, 0xd5, 0x90, 0x28, 0x7f,
+  0x70, 0x02, 0x70, 0xd5, 0x90, 0x38, 0xff, 0xfe, 0x7f, 0x7f, 0x70, 0x00,
+  0x14, 0x5b, 0x48, 0x36, 0xd5, 0x5f, 0x36, 0xb6, 0xa1, 0x02, 0x36, 0xd5,
+  0x5f, 0x36, 0xff, 0xfe, 0xb6, 0xb6, 0x36, 0x00, 0x14, 0x31, 0x48, 0x4c,
+  0xff, 0x26, 0x68, 0x01, 0xda, 0x02, 0x4c, 0xff, 0x26, 0x78, 0xff, 0xfe,
+  0x01, 0x01, 0x4c, 0x00, 0x14, 0x31, 0x48, 0xe7, 0xff, 0xe2, 0x3e, 0x81,
+  0x1e, 0x02, 0xe7, 0xff, 0xe2, 0x3e, 0xff, 0xfe, 0x81, 0x81, 0xe7, 0x00,
+  0x15, 0x30, 0x48, 0x0f, 0x00, 0xf6, 0x91, 0xbc, 0x0a, 0x02, 0xbf, 0x00,
+  0xf6, 0xb1, 0xff, 0xfe, 0xbc, 0xbc, 0xbf, 0x00, 0x15, 0x30, 0x48, 0xe7,
+  0x00, 0x14, 0x19, 0x00, 0xec, 0x02, 0xe7, 0x00, 0x14, 0xb9, 0xff, 0xfe,
+  0x00, 0x00, 0xe7, 0x00, 0x15, 0x2f, 0x48, 0xa1, 0x01, 0x0e, 0xbd, 0x3f,
+  0xf2, 0x02, 0xbf, 0x01, 0x0e, 0xbd, 0xff, 0xfe, 0x3f, 0x3f, 0xbf, 0x00,
+  0x15, 0x2f, 0x48, 0x12, 0x01, 0x11, 0x66, 0xfe, 0xef, 0x02, 0xfe, 0x01,
+  0x11, 0xf4, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0x00, 0x15, 0xb1, 0x48, 0xd4,
+  0x7f, 0xbc, 0x1a, 0xc0, 0x44, 0x02, 0xd4, 0x7f, 0xbc, 0xb8, 0xff, 0xfe,
+  0xc0, 0xc0, 0xd4, 0x00, 0x15, 0xb1, 0x48, 0x83, 0x7f, 0x70, 0x1e, 0xc0,
+  0x90, 0x02, 0xc3, 0x7f, 0x70, 0xbc, 0xff, 0xfe, 0xc0, 0xc0, 0xc3, 0x00,
+  0x15, 0x5b, 0x48, 0xb8, 0xd5, 0x22, 0x0e, 0xaa, 0xde, 0x02, 0xba, 0xd5,
+  0x22, 0xbc, 0xff, 0xfe, 0xaa, 0xaa, 0xba, 0x00, 0x15, 0x5b, 0x48, 0x90,
+  0xd5, 0x96, 0x81, 0x00, 0x6a, 0x02, 0x90, 0xd5, 0x96, 0xb1, 0xff, 0xfe,
+  0x00, 0x00, 0x90, 0x00, 0x15, 0x31, 0x48, 0x59, 0xff, 0x55, 0x94, 0x7f,
+  0xab, 0x02, 0x7f, 0xff, 0x55, 0x34, 0xff, 0xfe, 0x7f, 0x7f, 0x7f, 0x00,
+  0x15, 0x31, 0x48, 0xdd, 0xff, 0x67, 0x80, 0x41, 0x99, 0x02, 0xdd, 0xff,
+  0x67, 0xb0, 0xff, 0xfe, 0x41, 0x41, 0xdd, 0x00, 0x16, 0x30, 0x48, 0x86,
+  0x00, 0x82, 0x74, 0xff, 0x7e, 0x02, 0x86, 0x00, 0x82, 0xf5, 0xff, 0xfe,
+  0xfe, 0xff, 0x86, 0x00, 0x16, 0x30, 0x48, 0x70, 0x00, 0x0e, 0x9e, 0xfe,
+  0xf2, 0x02, 0x70, 0x00, 0x0e, 0xbd, 0xff, 0xfe, 0xfc, 0xfe, 0x70, 0x00,
+  0x16, 0x2f, 0x48, 0xa0, 0x01, 0x3a, 0x56, 0x3f, 0xc6, 0x02, 0xa0, 0x01,
+  0x3a, 0x74, 0xff, 0xfe, 0x7e, 0x3f, 0xa0, 0x00, 0x16, 0x2f, 0x48, 0x6d,
+  0x01, 0xb9, 0x8b, 0xfe, 0x47, 0x02, 0x6d, 0x01, 0xb9, 0xb9, 0xff, 0xfe,
+  0xfc, 0xfe, 0x6d, 0x00, 0x16, 0xb1, 0x48, 0x27, 0x7f, 0xfd, 0x40, 0xaa,
+  0x03, 0x02, 0x27, 0x7f, 0xfd, 0x71, 0xff, 0xfe, 0x54, 0xaa, 0x27, 0x00,
+  0x16, 0xb1, 0x48, 0xd1, 0x7f, 0x2c, 0x99, 0x49, 0xd4, 0x02, 0xd1, 0x7f,
+  0x2c, 0xb8, 0xff, 0xfe, 0x92, 0x49, 0xd1, 0x00, 0x16, 0x5b, 0x48, 0x8d,
+  0xd5, 0x81, 0x8c, 0x00, 0x7f, 0x02, 0x8d, 0xd5, 0x81, 0x3e, 0xff, 0xfe,
+  0x00, 0x00, 0x8d, 0x00, 0x16, 0x5b, 0x48, 0xe2, 0xd5, 0x99, 0xa3, 0x40,
+  0x67, 0x02, 0xe2, 0xd5, 0x99, 0xb0, 0xff, 0xfe, 0x80, 0x40, 0xe2, 0x00,
+  0x16, 0x31, 0x48, 0x25, 0xff, 0x0e, 0x39, 0x7f, 0xf2, 0x02, 0x25, 0xff,
+  0x0e, 0xb8, 0xff, 0xfe, 0xfe, 0x7f, 0x25, 0x00, 0x16, 0x31, 0x48, 0x7c,
+  0xff, 0x7f, 0xb6, 0xa6, 0x81, 0x02, 0x7c, 0xff, 0x7f, 0x35, 0xff, 0xfe,
+  0x4c, 0xa6, 0x7c, 0x00, 0x17, 0x30, 0x48, 0x91, 0x00, 0x36, 0x36, 0x00,
+  0xca, 0x02, 0x91, 0x00, 0x36, 0xb4, 0xff, 0xfe, 0x00, 0x00, 0x91, 0x00,
+  0x17, 0x30, 0x48, 0x88, 0x00, 0xce, 0x57, 0x00, 0x32, 0x02, 0x88, 0x00,
+  0xce, 0xf4, 0xff, 0xfe, 0x00, 0x00, 0x88, 0x00, 0x17, 0x2f, 0x48, 0x65,
+  0x01, 0xb6, 0x7e, 0x02, 0x4a, 0x02, 0x65, 0x01, 0xb6, 0x7c, 0xff, 0xfe,
+  0x04, 0x02, 0x65, 0x00, 0x17, 0x2f, 0x48, 0x24, 0x01, 0xdd, 0xbd, 0xff,
+  0x23, 0x02, 0xfe, 0x01, 0xdd, 0xbd, 0xff, 0xfe, 0xfe, 0xff, 0xfe, 0x00,
+  0x17, 0xb1, 0x48, 0xf5, 0x7f, 0xed, 0xbd, 0xaa, 0x13, 0x02, 0xf5, 0x7f,
+  0xed, 0xbd, 0xff, 0xfe, 0x54, 0xaa, 0xf5, 0x00, 0x17, 0xb1, 0x48, 0x8c,
+  0x7f, 0x98, 0x61, 0xaa, 0x68, 0x02, 0xdc, 0x7f, 0x98, 0xf1, 0xff, 0xfe,
+  0x54, 0xaa, 0xdc, 0x00, 0x17, 0x5b, 0x48, 0xa8, 0xd5, 0x0d, 0xb6, 0xc0,
+  0xf3, 0x02, 0xa8, 0xd5, 0x0d, 0xb5, 0xff, 0xfe, 0x80, 0xc0, 0xa8, 0x00,
+  0x17, 0x5b, 0x48, 0xbb, 0xd5, 0x50, 0x9c, 0x97, 0xb0, 0x02, 0xbf, 0xd5,
+  0x50, 0xbd, 0xff, 0xfe, 0x2e, 0x97, 0xbf, 0x00, 0x17, 0x31, 0x48, 0x09,
+  0xff, 0x08, 0xc4, 0x7f, 0xf8, 0x02, 0xff, 0xff, 0x08, 0xf4, 0xff, 0xfe,
+  0xfe, 0x7f, 0xff, 0x00, 0x17, 0x31, 0x48, 0x39, 0xff, 0x2a, 0x5b, 0xc0,
+  0xd6, 0x02, 0xb9, 0xff, 0x2a, 0xf9, 0xff, 0xfe, 0x80, 0xc0, 0xb9, 0x00,
+  0x18, 0x48, 0x48, 0x39, 0x65, 0x5d, 0x87, 0x40, 0xa3, 0x02, 0x39, 0x65,
+  0x5d, 0xb6, 0xff, 0xfd, 0x40, 0x40, 0x39, 0x00, 0x18, 0x48, 0x48, 0xd0,
+  0xb1, 0x7b, 0x25, 0xaa, 0x85, 0x02, 0xd0, 0xb1, 0x7b, 0x34, 0xff, 0xfd,
+  0xaa, 0xaa, 0xd0, 0x00, 0x18, 0x48, 0x48, 0xba, 0xf6, 0x8c, 0x32, 0x41,
+  0x74, 0x02, 0xba, 0xf6, 0x8c, 0x32, 0xff, 0xfd, 0x41, 0x41, 0xba, 0x00,
+  0x18, 0x48, 0x48, 0x23, 0x82, 0xc0, 0x36, 0x7f, 0x40, 0x02, 0x23, 0x82,
+  0xc0, 0x36, 0xff, 0xfd, 0x7f, 0x7f, 0x23, 0x00, 0x18, 0x48, 0x48, 0x8d,
+  0xcf, 0x7d, 0xcc, 0xaa, 0x83, 0x02, 0x8d, 0xcf, 0x7d, 0xfc, 0xff, 0xfd,
+  0xaa, 0xaa, 0x8d, 0x00, 0x18, 0x48, 0x48, 0x01, 0xad, 0x9f, 0xb0, 0x00,
+  0x61, 0x02, 0x01, 0xad, 0x9f, 0xb0, 0xff, 0xfd, 0x00, 0x00, 0x01, 0x00,
+  0x19, 0x00, 0x03, 0xdc, 0x09, 0x00, 0x2e, 0xff, 0x00, 0x03, 0xff, 0x09,
+  0x00, 0xbc, 0xff, 0xff, 0xff, 0xff, 0xbc, 0x00, 0x19, 0x00, 0x03, 0x29,
+  0x7d, 0x00, 0x2d, 0x7f, 0x00, 0x03, 0x7f, 0x7d, 0x00, 0x3d, 0xff, 0xff,
+  0x7f, 0x7f, 0x3d, 0x00, 0x19, 0xff, 0x02, 0x81, 0xf7, 0x01, 0xea, 0x01,
+  0xff, 0x02, 0x81, 0xf7, 0x01, 0xf8, 0xff, 0xff, 0x01, 0x01, 0xf8, 0x00,
+  0x19, 0xff, 0x02, 0x49, 0x89, 0x01, 0x35, 0xc0, 0xff, 0x02, 0xc9, 0x89,
+  0x01, 0xb5, 0xff, 0xff, 0xc0, 0xc0, 0xb5, 0x00, 0x19, 0x81, 0x02, 0xaf,
+  0xaf, 0x7f, 0x90, 0x3f, 0x81, 0x02, 0xbf, 0xaf, 0x7f, 0xb0, 0xff, 0xff,
+  0x3f, 0x3f, 0xb0, 0x00, 0x19, 0x81, 0x02, 0xf1, 0x65, 0x7f, 0x12, 0x81,
+  0x81, 0x02, 0xf1, 0x65, 0x7f, 0xb0, 0xff, 0xff, 0x81, 0x81, 0xb0, 0x00,
+  0x19, 0x2b, 0x02, 0xb6, 0x9e, 0xd5, 0x9e, 0x00, 0x2b, 0x02, 0xb6, 0x9e,
+  0xd5, 0xbc, 0xff, 0xff, 0x00, 0x00, 0xbc, 0x00, 0x19, 0x2b, 0x02, 0x87,
+  0x8d, 0xd5, 0xd0, 0x3f, 0x2b, 0x02, 0xbf, 0x8d, 0xd5, 0xf0, 0xff, 0xff,
+  0x3f, 0x3f, 0xf0, 0x00, 0x19, 0x01, 0x02, 0xb3, 0x62, 0xff, 0xf9, 0x0f,
+  0x01, 0x02, 0xbf, 0x62, 0xff, 0xf9, 0xff, 0xff, 0x0f, 0x0f, 0xf9, 0x00,
+  0x19, 0x01, 0x02, 0x98, 0xf0, 0xff, 0x32, 0x3f, 0x01, 0x02, 0xbf, 0xf0,
+  0xff, 0xb0, 0xff, 0xff, 0x3f, 0x3f, 0xb0, 0x00, 0x1a, 0x48, 0x48, 0x77,
+  0xcb, 0x1c, 0x13, 0x3f, 0xe4, 0x02, 0x77, 0xcb, 0x1c, 0x33, 0xff, 0xfd,
+  0x3f, 0x3f, 0x77, 0x00, 0x1a, 0x48, 0x48, 0x6c, 0x05, 0x88, 0xd0, 0xff,
+  0x78, 0x02, 0x6c, 0x05, 0x88, 0xf0, 0xff, 0xfd, 0xff, 0xff, 0x6c, 0x00,
+  0x1a, 0x48, 0x48, 0xce, 0x09, 0xab, 0x31, 0x41, 0x55, 0x02, 0xce, 0x09,
+  0xab, 0x31, 0xff, 0xfd, 0x41, 0x41, 0xce, 0x00, 0x1a, 0x48, 0x48, 0x23,
+  0x1e, 0xf7, 0x78, 0xaa, 0x09, 0x02, 0x23, 0x1e, 0xf7, 0x78, 0xff, 0xfd,
+  0xaa, 0xaa, 0x23, 0x00, 0x1b, 0x00, 0x03, 0x07, 0x45, 0x00, 0xf7, 0x01,
+  0x00, 0x03, 0x07, 0x45, 0x00, 0x74, 0xff, 0xff, 0x01, 0x02, 0x74, 0x00,
+  0x1b, 0x00, 0x03, 0x5a, 0x9e, 0x00, 0xd1, 0x02, 0x00, 0x03, 0x5e, 0x9e,
+  0x00, 0x70, 0xff, 0xff, 0x02, 0x04, 0x70, 0x00, 0x1b, 0xff, 0x02, 0xcd,
+  0x1e, 0x01, 0x65, 0xaa, 0xff, 0x02, 0xdd, 0x1e, 0x01, 0xf5, 0xff, 0xff,
+  0xaa, 0x54, 0xf5, 0x00, 0x1b, 0xff, 0x02, 0x7b, 0xc2, 0x01, 0xfa, 0x81,
+  0xff, 0x02, 0x7b, 0xc2, 0x01, 0x79, 0xff, 0xff, 0x81, 0x02, 0x79, 0x00,
+  0x1b, 0x81, 0x02, 0x80, 0xcb, 0x7f, 0xc9, 0x01, 0x81, 0x02, 0x82, 0xcb,
+  0x7f, 0xf8, 0xff, 0xff, 0x01, 0x02, 0xf8, 0x00, 0x1b, 0x81, 0x02, 0xf0,
+  0x06, 0x7f, 0x34, 0xfe, 0x81, 0x02, 0xfc, 0x06, 0x7f, 0xb5, 0xff, 0xff,
+  0xfe, 0xfc, 0xb5, 0x00, 0x1b, 0x2b, 0x02, 0xbf, 0x58, 0xd5, 0xa7, 0x40,
+  0x2b, 0x02, 0xbf, 0x58, 0xd5, 0xb4, 0xff, 0xff, 0x40, 0x80, 0xb4, 0x00,
+  0x1b, 0x2b, 0x02, 0x56, 0x09, 0xd5, 0x73, 0x7f, 0x2b, 0x02, 0xfe, 0x09,
+  0xd5, 0xf0, 0xff, 0xff, 0x7f, 0xfe, 0xf0, 0x00, 0x1b, 0x01, 0x02, 0x19,
+  0x2d, 0xff, 0xe9, 0x80, 0x01, 0x02, 0x19, 0x2d, 0xff, 0x79, 0xff, 0xff,
+  0x80, 0x00, 0x79, 0x00, 0x1b, 0x01, 0x02, 0x75, 0xaa, 0xff, 0xba, 0x7f,
+  0x01, 0x02, 0xff, 0xaa, 0xff, 0xb8, 0xff, 0xff, 0x7f, 0xfe, 0xb8, 0x00,
+  0x1c, 0x00, 0x03, 0x4a, 0x00, 0xcc, 0xdd, 0x80, 0x34, 0x02, 0x4a, 0x00,
+  0xcc, 0xfd, 0xff, 0xff, 0x80, 0x80, 0xfd, 0x00, 0x1c, 0x00, 0x03, 0x6e,
+  0x00, 0x67, 0xb0, 0x41, 0x99, 0x02, 0x6e, 0x00, 0x67, 0xb0, 0xff, 0xff,
+  0x41, 0x41, 0xb0, 0x00, 0x1c, 0xff, 0x02, 0x8f, 0x01, 0xdd, 0x4f, 0xc0,
+  0x23, 0x02, 0x8f, 0x01, 0xdd, 0x7f, 0xff, 0xff, 0xc0, 0xc0, 0x7f, 0x00,
+  0x1c, 0xff, 0x02, 0x5e, 0x01, 0x6b, 0xa1, 0x02, 0x95, 0x02, 0x5e, 0x01,
+  0x6b, 0xb1, 0xff, 0xff, 0x02, 0x02, 0xb1, 0x00, 0x1c, 0x81, 0x02, 0x60,
+  0x7f, 0xbd, 0x84, 0xc0, 0x43, 0x02, 0x60, 0x7f, 0xbd, 0xb4, 0xff, 0xff,
+  0xc0, 0xc0, 0xb4, 0x00, 0x1c, 0x81, 0x02, 0xd5, 0x7f, 0x9c, 0xab, 0xaa,
+  0x64, 0x02, 0xd5, 0x7f, 0x9c, 0xbb, 0xff, 0xff, 0xaa, 0xaa, 0xbb, 0x00,
+  0x1c, 0x2b, 0x02, 0x96, 0xd5, 0x13, 0x82, 0x01, 0xed, 0x02, 0x96, 0xd5,
+  0x13, 0xb2, 0xff, 0xff, 0x01, 0x01, 0xb2, 0x00, 0x1c, 0x2b, 0x02, 0x27,
+  0xd5, 0x3e, 0xb5, 0x0e, 0xc2, 0x02, 0x27, 0xd5, 0x3e, 0xb5, 0xff, 0xff,
+  0x0e, 0x0e, 0xb5, 0x00, 0x1c, 0x01, 0x02, 0x22, 0xff, 0x6d, 0x17, 0x00,
+  0x93, 0x02, 0x22, 0xff, 0x6d, 0x37, 0xff, 0xff, 0x00, 0x00, 0x37, 0x00,
+  0x1c, 0x01, 0x02, 0x89, 0xff, 0x7d, 0xcd, 0xc0, 0x83, 0x02, 0x89, 0xff,
+  0x7d, 0xfd, 0xff, 0xff, 0xc0, 0xc0, 0xfd, 0x00, 0x1d, 0x00, 0x03, 0xbf,
+  0x00, 0x72, 0x7d, 0x0f, 0x8e, 0x02, 0xbf, 0x00, 0x72, 0xfd, 0xff, 0xff,
+  0x0f, 0x0f, 0xfd, 0x00, 0x1d, 0x00, 0x03, 0xc7, 0x00, 0x56, 0x6d, 0x81,
+  0xaa, 0x02, 0xc7, 0x00, 0x56, 0xfd, 0xff, 0xff, 0x81, 0x81, 0xfd, 0x00,
+  0x1d, 0xff, 0x02, 0x39, 0x01, 0x4c, 0x66, 0xc0, 0xb4, 0x02, 0xf9, 0x01,
+  0x4c, 0xf4, 0xff, 0xff, 0xc0, 0xc0, 0xf4, 0x00, 0x1d, 0xff, 0x02, 0x28,
+  0x01, 0x09, 0x3d, 0xc0, 0xf7, 0x02, 0xe8, 0x01, 0x09, 0xbd, 0xff, 0xff,
+  0xc0, 0xc0, 0xbd, 0x00, 0x1d, 0x81, 0x02, 0x0c, 0x7f, 0xc4, 0x19, 0x81,
+  0x3c, 0x02, 0x8d, 0x7f, 0xc4, 0xb9, 0xff, 0xff, 0x81, 0x81, 0xb9, 0x00,
+  0x1d, 0x81, 0x02, 0xe4, 0x7f, 0xa0, 0x4f, 0x02, 0x60, 0x02, 0xe6, 0x7f,
+  0xa0, 0xfd, 0xff, 0xff, 0x02, 0x02, 0xfd, 0x00, 0x1d, 0x2b, 0x02, 0xf7,
+  0xd5, 0x4d, 0xb1, 0xfe, 0xb3, 0x02, 0xff, 0xd5, 0x4d, 0xb1, 0xff, 0xff,
+  0xfe, 0xfe, 0xb1, 0x00, 0x1d, 0x2b, 0x02, 0x6c, 0xd5, 0x45, 0x9b, 0x41,
+  0xbb, 0x02, 0x6d, 0xd5, 0x45, 0x39, 0xff, 0xff, 0x41, 0x41, 0x39, 0x00,
+  0x1d, 0x01, 0x02, 0x1a, 0xff, 0x87, 0x78, 0x40, 0x79, 0x02, 0x5a, 0xff,
+  0x87, 0x78, 0xff, 0xff, 0x40, 0x40, 0x78, 0x00, 0x1d, 0x01, 0x02, 0x84,
+  0xff, 0xff, 0xa3, 0x81, 0x01, 0x02, 0x85, 0xff, 0xff, 0xb1, 0xff, 0xff,
+  0x81, 0x81, 0xb1, 0x00, 0x1e, 0x00, 0x03, 0x54, 0x00, 0xb7, 0x8d, 0x01,
+  0x49, 0x02, 0x54, 0x00, 0xb7, 0x3c, 0xff, 0xff, 0x01, 0x02, 0x3c, 0x00,
+  0x1e, 0x00, 0x03, 0x3e, 0x00, 0xc5, 0xdb, 0x81, 0x3b, 0x02, 0x3e, 0x00,
+  0xc5, 0x79, 0xff, 0xff, 0x81, 0x02, 0x79, 0x00, 0x1e, 0xff, 0x02, 0x27,
+  0x01, 0xb0, 0xa7, 0x3f, 0x50, 0x02, 0x27, 0x01, 0xb0, 0x34, 0xff, 0xff,
+  0x3f, 0x7e, 0x34, 0x00, 0x1e, 0xff, 0x02, 0x99, 0x01, 0x83, 0x35, 0x70,
+  0x7d, 0x02, 0x99, 0x01, 0x83, 0xb4, 0xff, 0xff, 0x70, 0xe0, 0xb4, 0x00,
+  0x1e, 0x81, 0x02, 0xee, 0x7f, 0x5d, 0xc9, 0xff, 0xa3, 0x02, 0xee, 0x7f,
+  0x5d, 0xf9, 0xff, 0xff, 0xff, 0xfe, 0xf9, 0x00, 0x1e, 0x81, 0x02, 0x61,
+  0x7f, 0x20, 0xc4, 0x0f, 0xe0, 0x02, 0x61, 0x7f, 0x20, 0x74, 0xff, 0xff,
+  0x0f, 0x1e, 0x74, 0x00, 0x1e, 0x2b, 0x02, 0x47, 0xd5, 0x96, 0xb8, 0x00,
+  0x6a, 0x02, 0x47, 0xd5, 0x96, 0x3a, 0xff, 0xff, 0x00, 0x00, 0x3a, 0x00,
+  0x1e, 0x2b, 0x02, 0x05, 0xd5, 0x81, 0xa0, 0x81, 0x7f, 0x02, 0x05, 0xd5,
+  0x81, 0x31, 0xff, 0xff, 0x81, 0x02, 0x31, 0x00, 0x1e, 0x01, 0x02, 0x2c,
+  0xff, 0x00, 0x7a, 0xfe, 0x00, 0x03, 0x2c, 0xff, 0x00, 0xf9, 0xff, 0xff,
+  0xfe, 0xfc, 0xf9, 0x00, 0x1e, 0x01, 0x02, 0x56, 0xff, 0xb8, 0x88, 0xc0,
+  0x48, 0x02, 0x56, 0xff, 0xb8, 0xb9, 0xff, 0xff, 0xc0, 0x80, 0xb9, 0x00,
+  0x1f, 0x00, 0x03, 0x86, 0x00, 0x16, 0xd0, 0xee, 0xea, 0x02, 0xde, 0x00,
+  0x16, 0xf1, 0xff, 0xff, 0xee, 0xdc, 0xf1, 0x00, 0x1f, 0x00, 0x03, 0x08,
+  0x00, 0xd5, 0xac, 0x00, 0x2b, 0x02, 0x08, 0x00, 0xd5, 0x3c, 0xff, 0xff,
+  0x00, 0x00, 0x3c, 0x00, 0x1f, 0xff, 0x02, 0x4a, 0x01, 0xbb, 0x5b, 0xc1,
+  0x45, 0x02, 0xca, 0x01, 0xbb, 0xf9, 0xff, 0xff, 0xc1, 0x82, 0xf9, 0x00,
+  0x1f, 0xff, 0x02, 0x74, 0x01, 0x25, 0xc6, 0xaa, 0xdb, 0x02, 0x74, 0x01,
+  0x25, 0x75, 0xff, 0xff, 0xaa, 0x54, 0x75, 0x00, 0x1f, 0x81, 0x02, 0x73,
+  0x7f, 0x66, 0x34, 0x02, 0x9a, 0x02, 0x77, 0x7f, 0x66, 0x34, 0xff, 0xff,
+  0x02, 0x04, 0x34, 0x00, 0x1f, 0x81, 0x02, 0xd3, 0x7f, 0x69, 0x96, 0x80,
+  0x97, 0x02, 0xd3, 0x7f, 0x69, 0xb5, 0xff, 0xff, 0x80, 0x00, 0xb5, 0x00,
+  0x1f, 0x2b, 0x02, 0x83, 0xd5, 0xbb, 0x79, 0x41, 0x45, 0x02, 0x83, 0xd5,
+  0xbb, 0xf8, 0xff, 0xff, 0x41, 0x82, 0xf8, 0x00, 0x1f, 0x2b, 0x02, 0x81,
+  0xd5, 0x58, 0x54, 0xff, 0xa8, 0x02, 0xff, 0xd5, 0x58, 0xf5, 0xff, 0xff,
+  0xff, 0xfe, 0xf5, 0x00, 0x1f, 0x01, 0x02, 0xf3, 0xff, 0xdc, 0x96, 0x81,
+  0x24, 0x02, 0xf3, 0xff, 0xdc, 0xb5, 0xff, 0xff, 0x81, 0x02, 0xb5, 0x00,
+  0x1f, 0x01, 0x02, 0x2c, 0xff, 0x52, 0xc8, 0x01, 0xae, 0x02, 0x2e, 0xff,
+  0x52, 0x78, 0xff, 0xff, 0x01, 0x02, 0x78, 0x00, 0x20, 0x00, 0x06, 0x94,
+  0xd5, 0xb7, 0x86, 0xdc, 0x00, 0x03, 0x94, 0xd6, 0xb7, 0xb4, 0xff, 0xfd,
+  0xdc, 0xdc, 0x05, 0x00, 0x20, 0x00, 0x06, 0x8c, 0x59, 0x90, 0xd9, 0xcf,
+  0x00, 0x03, 0x8c, 0x5a, 0x90, 0x79, 0xff, 0xfd, 0xcf, 0xcf, 0x05, 0x00,
+  0x20, 0x00, 0x06, 0x59, 0x69, 0x6c, 0xdf, 0x77, 0x00, 0x03, 0x59, 0x6a,
+  0x6c, 0x7d, 0xff, 0xfd, 0x77, 0x77, 0x05, 0x00, 0x20, 0x00, 0x06, 0x95,
+  0xbb, 0x0e, 0x0f, 0x83, 0x00, 0x03, 0x95, 0xbc, 0x0e, 0xbd, 0xff, 0xfd,
+  0x83, 0x83, 0x05, 0x00, 0x21, 0x40, 0x48, 0xfd, 0x00, 0xc5, 0x3c, 0xaa,
+  0x3b, 0x02, 0xa8, 0x00, 0xc5, 0xbc, 0xff, 0xfe, 0xaa, 0xaa, 0xa8, 0x00,
+  0x21, 0x40, 0x48, 0x77, 0x00, 0xda, 0xaa, 0x02, 0x26, 0x02, 0x02, 0x00,
+  0xda, 0x38, 0xff, 0xfe, 0x02, 0x02, 0x02, 0x00, 0x21, 0x3f, 0x48, 0xcd,
+  0x01, 0x5d, 0x57, 0xaa, 0xa3, 0x02, 0x88, 0x01, 0x5d, 0xf5, 0xff, 0xfe,
+  0xaa, 0xaa, 0x88, 0x00, 0x21, 0x3f, 0x48, 0x47, 0x01, 0x7f, 0xa5, 0x5c,
+  0x81, 0x02, 0x44, 0x01, 0x7f, 0x35, 0xff, 0xfe, 0x5c, 0x5c, 0x44, 0x00,
+  0x21, 0xc1, 0x48, 0xe3, 0x7f, 0xb6, 0xbe, 0xff, 0x4a, 0x02, 0xe3, 0x7f,
+  0xb6, 0xbc, 0xff, 0xfe, 0xff, 0xff, 0xe3, 0x00, 0x21, 0xc1, 0x48, 0xf9,
+  0x7f, 0x50, 0xb8, 0x0f, 0xb0, 0x02, 0x09, 0x7f, 0x50, 0x38, 0xff, 0xfe,
+  0x0f, 0x0f, 0x09, 0x00, 0x21, 0x6b, 0x48, 0xb8, 0xd5, 0xc9, 0xae, 0x22,
+  0x37, 0x02, 0x20, 0xd5, 0xc9, 0x3c, 0xff, 0xfe, 0x22, 0x22, 0x20, 0x00,
+  0x21, 0x6b, 0x48, 0xf9, 0xd5, 0xbe, 0x97, 0x02, 0x42, 0x02, 0x00, 0xd5,
+  0xbe, 0x37, 0xff, 0xfe, 0x02, 0x02, 0x00, 0x00, 0x21, 0x41, 0x48, 0x7a,
+  0xff, 0x04, 0x56, 0x81, 0xfc, 0x02, 0x00, 0xff, 0x04, 0x76, 0xff, 0xfe,
+  0x81, 0x81, 0x00, 0x00, 0x21, 0x41, 0x48, 0x14, 0xff, 0xa4, 0x63, 0x01,
+  0x5c, 0x02, 0x00, 0xff, 0xa4, 0x73, 0xff, 0xfe, 0x01, 0x01, 0x00, 0x00,
+  0x23, 0x40, 0x48, 0x84, 0x00, 0xa5, 0xff, 0x00, 0x5b, 0x02, 0x00, 0x00,
+  0xa5, 0x7e, 0xff, 0xfe, 0x00, 0x01, 0x00, 0x00, 0x23, 0x40, 0x48, 0x30,
+  0x00, 0x04, 0x3d, 0xc0, 0xfc, 0x02, 0x00, 0x00, 0x04, 0x3f, 0xff, 0xfe,
+  0xc0, 0x81, 0x00, 0x00, 0x23, 0x3f, 0x48, 0x1a, 0x01, 0xdb, 0x11, 0x40,
+  0x25, 0x02, 0x00, 0x01, 0xdb, 0x32, 0xff, 0xfe, 0x40, 0x81, 0x00, 0x00,
+  0x23, 0x3f, 0x48, 0xeb, 0x01, 0x03, 0x21, 0xfe, 0xfd, 0x02, 0xe9, 0x01,
+  0x03, 0xb1, 0xff, 0xfe, 0xfe, 0xfd, 0xe9, 0x00, 0x23, 0xc1, 0x48, 0x9c,
+  0x7f, 0x29, 0x73, 0xa0, 0xd7, 0x02, 0x00, 0x7f, 0x29, 0x73, 0xff, 0xfe,
+  0xa0, 0x41, 0x00, 0x00, 0x23, 0xc1, 0x48, 0x26, 0x7f, 0x6b, 0x7e, 0x80,
+  0x95, 0x02, 0x00, 0x7f, 0x6b, 0x7f, 0xff, 0xfe, 0x80, 0x00, 0x00, 0x00,
+  0x23, 0x6b, 0x48, 0x04, 0xd5, 0x42, 0x73, 0xaa, 0xbe, 0x02, 0x04, 0xd5,
+  0x42, 0x71, 0xff, 0xfe, 0xaa, 0x55, 0x04, 0x00, 0x23, 0x6b, 0x48, 0x2d,
+  0xd5, 0x2f, 0xdc, 0x3f, 0xd1, 0x02, 0x2c, 0xd5, 0x2f, 0x7c, 0xff, 0xfe,
+  0x3f, 0x7e, 0x2c, 0x00, 0x23, 0x41, 0x48, 0x0b, 0xff, 0xa6, 0xc8, 0x0f,
+  0x5a, 0x02, 0x0a, 0xff, 0xa6, 0x78, 0xff, 0xfe, 0x0f, 0x1e, 0x0a, 0x00,
+  0x23, 0x41, 0x48, 0x3f, 0xff, 0xe7, 0x26, 0x41, 0x19, 0x02, 0x02, 0xff,
+  0xe7, 0x34, 0xff, 0xfe, 0x41, 0x82, 0x02, 0x00, 0x24, 0x30, 0x48, 0x43,
+  0x2b, 0x15, 0x54, 0x00, 0xeb, 0x02, 0x43, 0x2b, 0x15, 0x36, 0xff, 0xfe,
+  0x00, 0x00, 0x43, 0x00, 0x24, 0x30, 0x48, 0x24, 0x21, 0xb4, 0xa8, 0xfe,
+  0x4c, 0x02, 0x24, 0x21, 0xb4, 0xf8, 0xff, 0xfe, 0xfe, 0xfe, 0x24, 0x00,
+  0x24, 0x30, 0x48, 0xcf, 0xf6, 0xec, 0x93, 0xc4, 0x14, 0x02, 0xcf, 0xf6,
+  0xec, 0xf1, 0xff, 0xfe, 0xc4, 0xc4, 0xcf, 0x00, 0x24, 0x30, 0x48, 0x21,
+  0x49, 0xdf, 0xfb, 0xaa, 0x21, 0x02, 0x21, 0x49, 0xdf, 0xb9, 0xff, 0xfe,
+  0xaa, 0xaa, 0x21, 0x00, 0x24, 0x30, 0x48, 0x1f, 0x6e, 0xbe, 0x22, 0x0f,
+  0x42, 0x02, 0x1f, 0x6e, 0xbe, 0x30, 0xff, 0xfe, 0x0f, 0x0f, 0x1f, 0x00,
+  0x24, 0x30, 0x48, 0x75, 0x64, 0x5c, 0x5b, 0x3a, 0xa4, 0x02, 0x75, 0x64,
+  0x5c, 0x39, 0xff, 0xfe, 0x3a, 0x3a, 0x75, 0x00, 0x25, 0x30, 0x48, 0x43,
+  0x1d, 0xf8, 0x8d, 0xfe, 0x08, 0x02, 0x42, 0x1d, 0xf8, 0x3d, 0xff, 0xfe,
+  0xfe, 0xfe, 0x42, 0x00, 0x25, 0x30, 0x48, 0x17, 0xc8, 0x3d, 0xc3, 0x81,
+  0xc3, 0x02, 0x01, 0xc8, 0x3d, 0x71, 0xff, 0xfe, 0x81, 0x81, 0x01, 0x00,
+  0x25, 0x30, 0x48, 0x20, 0x4a, 0x57, 0x9f, 0xc0, 0xa9, 0x02, 0x00, 0x4a,
+  0x57, 0x3f, 0xff, 0xfe, 0xc0, 0xc0, 0x00, 0x00, 0x25, 0x30, 0x48, 0x11,
+  0x78, 0x12, 0xa8, 0xaa, 0xee, 0x02, 0x00, 0x78, 0x12, 0x3a, 0xff, 0xfe,
+  0xaa, 0xaa, 0x00, 0x00, 0x25, 0x30, 0x48, 0xaa, 0x33, 0x0c, 0x4a, 0x99,
+  0xf4, 0x02, 0x88, 0x33, 0x0c, 0xf8, 0xff, 0xfe, 0x99, 0x99, 0x88, 0x00,
+  0x25, 0x30, 0x48, 0x3f, 0x50, 0x50, 0x95, 0x3f, 0xb0, 0x02, 0x3f, 0x50,
+  0x50, 0x35, 0xff, 0xfe, 0x3f, 0x3f, 0x3f, 0x00, 0x26, 0x30, 0x48, 0xe7,
+  0xaf, 0x0a, 0x9f, 0x80, 0xf6, 0x02, 0xe7, 0xaf, 0x0a, 0x3d, 0xff, 0xfe,
+  0x01, 0x80, 0xe7, 0x00, 0x26, 0x30, 0x48, 0x27, 0xbc, 0xff, 0x3a, 0x3f,
+  0x01, 0x02, 0x27, 0xbc, 0xff, 0x38, 0xff, 0xfe, 0x7e, 0x3f, 0x27, 0x00,
+  0x26, 0x30, 0x48, 0x9f, 0x14, 0x82, 0x35, 0x0f, 0x7e, 0x02, 0x9f, 0x14,
+  0x82, 0x34, 0xff, 0xfe, 0x1f, 0x0f, 0x9f, 0x00, 0x26, 0x30, 0x48, 0x32,
+  0x68, 0x1f, 0x21, 0x02, 0xe1, 0x02, 0x32, 0x68, 0x1f, 0x30, 0xff, 0xfe,
+  0x05, 0x02, 0x32, 0x00, 0x26, 0x30, 0x48, 0xd0, 0x95, 0x40, 0xbe, 0xff,
+  0xc0, 0x02, 0xd0, 0x95, 0x40, 0xbd, 0xff, 0xfe, 0xfe, 0xff, 0xd0, 0x00,
+  0x26, 0x30, 0x48, 0x17, 0x19, 0x4a, 0x4d, 0xff, 0xb6, 0x02, 0x17, 0x19,
+  0x4a, 0xfd, 0xff, 0xfe, 0xff, 0xff, 0x17, 0x00, 0x27, 0x30, 0x48, 0xcb,
+  0xca, 0x13, 0x25, 0x3f, 0xed, 0x02, 0x4b, 0xca, 0x13, 0x34, 0xff, 0xfe,
+  0x7f, 0x3f, 0x4b, 0x00, 0x27, 0x30, 0x48, 0x6f, 0x8b, 0x63, 0x08, 0x3f,
+  0x9d, 0x02, 0x6e, 0x8b, 0x63, 0x38, 0xff, 0xfe, 0x7e, 0x3f, 0x6e, 0x00,
+  0x27, 0x30, 0x48, 0x5a, 0x83, 0x94, 0x3c, 0x80, 0x6c, 0x02, 0x00, 0x83,
+  0x94, 0x3f, 0xff, 0xfe, 0x00, 0x80, 0x00, 0x00, 0x27, 0x30, 0x48, 0xe9,
+  0x4c, 0x57, 0x83, 0x40, 0xa9, 0x02, 0x81, 0x4c, 0x57, 0xb0, 0xff, 0xfe,
+  0x81, 0x40, 0x81, 0x00, 0x27, 0x30, 0x48, 0x8f, 0xcc, 0xd5, 0x95, 0xad,
+  0x2b, 0x02, 0x0b, 0xcc, 0xd5, 0x35, 0xff, 0xfe, 0x5b, 0xad, 0x0b, 0x00,
+  0x27, 0x30, 0x48, 0x55, 0x04, 0x6b, 0x19, 0xaa, 0x95, 0x02, 0x55, 0x04,
+  0x6b, 0x39, 0xff, 0xfe, 0x55, 0xaa, 0x55, 0x00, 0x28, 0x48, 0x48, 0x9b,
+  0x0e, 0x82, 0x8a, 0x01, 0x7e, 0x02, 0x9b, 0x0e, 0x82, 0x31, 0xff, 0xfe,
+  0x01, 0x01, 0x9b, 0x00, 0x28, 0x48, 0x48, 0x04, 0x27, 0x5b, 0x78, 0x41,
+  0xa5, 0x02, 0x04, 0x27, 0x5b, 0x71, 0xff, 0xfe, 0x41, 0x41, 0x04, 0x00,
+  0x28, 0x48, 0x48, 0xca, 0x55, 0x1f, 0xe2, 0x3f, 0xe1, 0x02, 0xca, 0x55,
+  0x1f, 0x3f, 0xff, 0xfe, 0x3f, 0x3f, 0xca, 0x00, 0x28, 0x48, 0x48, 0x43,
+  0x60, 0x82, 0x1a, 0xfe, 0x7e, 0x02, 0x43, 0x60, 0x82, 0xfe, 0xff, 0xfe,
+  0xfe, 0xfe, 0x43, 0x00, 0x28, 0x48, 0x48, 0xa5, 0x17, 0x94, 0xa3, 0xff,
+  0x6c, 0x02, 0xa5, 0x17, 0x94, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xa5, 0x00,
+  0x28, 0x48, 0x48, 0xa5, 0x19, 0x4a, 0x22, 0x00, 0xb6, 0x02, 0xa5, 0x19,
+  0x4a, 0x30, 0xff, 0xfe, 0x00, 0x00, 0xa5, 0x00, 0x29, 0x00, 0x48, 0x00,
+  0xfa, 0x46, 0x9a, 0xf7, 0x00, 0x03, 0x00, 0xfa, 0x46, 0x3a, 0xff, 0xfe,
+  0xf7, 0xf7, 0x00, 0x00, 0x29, 0x0f, 0x48, 0x00, 0xff, 0x0d, 0x0e, 0xbd,
+  0x00, 0x03, 0x00, 0xff, 0x0d, 0x3e, 0xff, 0xfe, 0xbd, 0xbd, 0x00, 0x00,
+  0x29, 0x40, 0x48, 0x00, 0xa2, 0xec, 0x22, 0xf2, 0x00, 0x03, 0x00, 0xa2,
+  0xec, 0x32, 0xff, 0xfe, 0xf2, 0xf2, 0x00, 0x00, 0x29, 0x80, 0x48, 0x00,
+  0x41, 0x18, 0xe5, 0x1d, 0x00, 0x03, 0x00, 0x41, 0x18, 0x77, 0xff, 0xfe,
+  0x1d, 0x1d, 0x00, 0x00, 0x29, 0xfe, 0x48, 0x00, 0x42, 0xc5, 0x78, 0xb5,
+  0x00, 0x03, 0x00, 0x42, 0xc5, 0x7a, 0xff, 0xfe, 0xb5, 0xb5, 0x00, 0x00,
+  0x29, 0x00, 0x48, 0x01, 0x14, 0x49, 0xb7, 0x83, 0x00, 0x03, 0x00, 0x14,
+  0x49, 0x37, 0xff, 0xfe, 0x83, 0x83, 0x00, 0x00, 0x29, 0x0f, 0x48, 0x01,
+  0x67, 0x22, 0x01, 0x5c, 0x00, 0x03, 0x01, 0x67, 0x22, 0x31, 0xff, 0xfe,
+  0x5c, 0x5c, 0x01, 0x00, 0x29, 0x40, 0x48, 0x01, 0x9e, 0xaf, 0x95, 0x34,
+  0x00, 0x03, 0x00, 0x9e, 0xaf, 0x37, 0xff, 0xfe, 0x34, 0x34, 0x00, 0x00,
+  0x29, 0x80, 0x48, 0x01, 0x00, 0x10, 0x72, 0x00, 0x00, 0x03, 0x00, 0x00,
+  0x10, 0x72, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x29, 0xfe, 0x48, 0x01,
+  0x2b, 0x71, 0x38, 0x5f, 0x00, 0x03, 0x00, 0x2b, 0x71, 0x3a, 0xff, 0xfe,
+  0x5f, 0x5f, 0x00, 0x00, 0x29, 0x00, 0x48, 0x0f, 0x2d, 0x92, 0x31, 0x04,
+  0x00, 0x03, 0x00, 0x2d, 0x92, 0x33, 0xff, 0xfe, 0x04, 0x04, 0x00, 0x00,
+  0x29, 0x0f, 0x48, 0x0f, 0x74, 0xcb, 0x9f, 0x69, 0x00, 0x03, 0x0f, 0x74,
+  0xcb, 0x3d, 0xff, 0xfe, 0x69, 0x69, 0x0f, 0x00, 0x29, 0x40, 0x48, 0x0f,
+  0x23, 0x79, 0x49, 0x2c, 0x00, 0x03, 0x00, 0x23, 0x79, 0x7b, 0xff, 0xfe,
+  0x2c, 0x2c, 0x00, 0x00, 0x29, 0x80, 0x48, 0x0f, 0xa7, 0x45, 0xa7, 0x29,
+  0x00, 0x03, 0x00, 0xa7, 0x45, 0x37, 0xff, 0xfe, 0x29, 0x29, 0x00, 0x00,
+  0x29, 0xfe, 0x48, 0x0f, 0xf0, 0xe5, 0x0a, 0xcd, 0x00, 0x03, 0x0e, 0xf0,
+  0xe5, 0x38, 0xff, 0xfe, 0xcd, 0xcd, 0x0e, 0x00, 0x29, 0x00, 0x48, 0x3f,
+  0x9b, 0x4f, 0xdc, 0x01, 0x00, 0x03, 0x00, 0x9b, 0x4f, 0x7e, 0xff, 0xfe,
+  0x01, 0x01, 0x00, 0x00, 0x29, 0x0f, 0x48, 0x3f, 0x0a, 0x00, 0x31, 0xd7,
+  0x00, 0x03, 0x0f, 0x0a, 0x00, 0x31, 0xff, 0xfe, 0xd7, 0xd7, 0x0f, 0x00,
+  0x29, 0x40, 0x48, 0x3f, 0x47, 0x2a, 0x0b, 0x41, 0x00, 0x03, 0x00, 0x47,
+  0x2a, 0x3b, 0xff, 0xfe, 0x41, 0x41, 0x00, 0x00, 0x29, 0x80, 0x48, 0x3f,
+  0xb1, 0x8e, 0x88, 0x8a, 0x00, 0x03, 0x00, 0xb1, 0x8e, 0x3a, 0xff, 0xfe,
+  0x8a, 0x8a, 0x00, 0x00, 0x29, 0xfe, 0x48, 0x3f, 0xc2, 0xc9, 0xcd, 0x13,
+  0x00, 0x03, 0x3e, 0xc2, 0xc9, 0x7d, 0xff, 0xfe, 0x13, 0x13, 0x3e, 0x00,
+  0x29, 0x00, 0x48, 0x40, 0xce, 0x39, 0x8f, 0x91, 0x00, 0x03, 0x00, 0xce,
+  0x39, 0x3f, 0xff, 0xfe, 0x91, 0x91, 0x00, 0x00, 0x29, 0x0f, 0x48, 0x40,
+  0x28, 0x8f, 0x9c, 0x21, 0x00, 0x03, 0x00, 0x28, 0x8f, 0x3e, 0xff, 0xfe,
+  0x21, 0x21, 0x00, 0x00, 0x29, 0x40, 0x48, 0x40, 0x6e, 0x57, 0x2e, 0xc1,
+  0x00, 0x03, 0x40, 0x6e, 0x57, 0x3c, 0xff, 0xfe, 0xc1, 0xc1, 0x40, 0x00,
+  0x29, 0x80, 0x48, 0x40, 0xca, 0x12, 0x1f, 0x51, 0x00, 0x03, 0x00, 0xca,
+  0x12, 0x3f, 0xff, 0xfe, 0x51, 0x51, 0x00, 0x00, 0x29, 0xfe, 0x48, 0x40,
+  0xf6, 0xad, 0xaa, 0x86, 0x00, 0x03, 0x40, 0xf6, 0xad, 0x38, 0xff, 0xfe,
+  0x86, 0x86, 0x40, 0x00, 0x29, 0x00, 0x48, 0x7f, 0x92, 0xa3, 0x8f, 0x0d,
+  0x00, 0x03, 0x00, 0x92, 0xa3, 0x3f, 0xff, 0xfe, 0x0d, 0x0d, 0x00, 0x00,
+  0x29, 0x0f, 0x48, 0x7f, 0x55, 0x2c, 0x1e, 0x8a, 0x00, 0x03, 0x0f, 0x55,
+  0x2c, 0x3c, 0xff, 0xfe, 0x8a, 0x8a, 0x0f, 0x00, 0x29, 0x40, 0x48, 0x7f,
+  0xcb, 0xe4, 0x5b, 0xd7, 0x00, 0x03, 0x40, 0xcb, 0xe4, 0x79, 0xff, 0xfe,
+  0xd7, 0xd7, 0x40, 0x00, 0x29, 0x80, 0x48, 0x7f, 0xe2, 0xa2, 0x5b, 0x77,
+  0x00, 0x03, 0x00, 0xe2, 0xa2, 0x7b, 0xff, 0xfe, 0x77, 0x77, 0x00, 0x00,
+  0x29, 0xfe, 0x48, 0x7f, 0xc9, 0x53, 0xf1, 0x9c, 0x00, 0x03, 0x7e, 0xc9,
+  0x53, 0x71, 0xff, 0xfe, 0x9c, 0x9c, 0x7e, 0x00, 0x29, 0x00, 0x48, 0x80,
+  0xe0, 0x9a, 0x1f, 0x85, 0x00, 0x03, 0x00, 0xe0, 0x9a, 0x3f, 0xff, 0xfe,
+  0x85, 0x85, 0x00, 0x00, 0x29, 0x0f, 0x48, 0x80, 0x5e, 0xd4, 0x32, 0x7f,
+  0x00, 0x03, 0x00, 0x5e, 0xd4, 0x32, 0xff, 0xfe, 0x7f, 0x7f, 0x00, 0x00,
+  0x29, 0x40, 0x48, 0x80, 0x81, 0x84, 0x40, 0x7b, 0x00, 0x03, 0x00, 0x81,
+  0x84, 0x72, 0xff, 0xfe, 0x7b, 0x7b, 0x00, 0x00, 0x29, 0x80, 0x48, 0x80,
+  0x28, 0x1e, 0x49, 0xe1, 0x00, 0x03, 0x80, 0x28, 0x1e, 0xf9, 0xff, 0xfe,
+  0xe1, 0xe1, 0x80, 0x00, 0x29, 0xfe, 0x48, 0x80, 0x10, 0xda, 0x8b, 0xe6,
+  0x00, 0x03, 0x80, 0x10, 0xda, 0xb9, 0xff, 0xfe, 0xe6, 0xe6, 0x80, 0x00,
+  0x29, 0x00, 0x48, 0x81, 0x0e, 0xa4, 0x2e, 0x06, 0x00, 0x03, 0x00, 0x0e,
+  0xa4, 0x3e, 0xff, 0xfe, 0x06, 0x06, 0x00, 0x00, 0x29, 0x0f, 0x48, 0x81,
+  0x18, 0x17, 0xd9, 0x92, 0x00, 0x03, 0x01, 0x18, 0x17, 0x79, 0xff, 0xfe,
+  0x92, 0x92, 0x01, 0x00, 0x29, 0x40, 0x48, 0x81, 0xc7, 0xdd, 0x5e, 0x69,
+  0x00, 0x03, 0x00, 0xc7, 0xdd, 0x7e, 0xff, 0xfe, 0x69, 0x69, 0x00, 0x00,
+  0x29, 0x80, 0x48, 0x81, 0x5d, 0x33, 0xba, 0x94, 0x00, 0x03, 0x80, 0x5d,
+  0x33, 0xb8, 0xff, 0xfe, 0x94, 0x94, 0x80, 0x00, 0x29, 0xfe, 0x48, 0x81,
+  0x2f, 0xd8, 0xa3, 0x2e, 0x00, 0x03, 0x80, 0x2f, 0xd8, 0xb1, 0xff, 0xfe,
+  0x2e, 0x2e, 0x80, 0x00, 0x29, 0x00, 0x48, 0xfe, 0x1b, 0xa7, 0x71, 0xe3,
+  0x00, 0x03, 0x00, 0x1b, 0xa7, 0x73, 0xff, 0xfe, 0xe3, 0xe3, 0x00, 0x00,
+  0x29, 0x0f, 0x48, 0xfe, 0x6a, 0x91, 0xe8, 0xbf, 0x00, 0x03, 0x0e, 0x6a,
+  0x91, 0x78, 0xff, 0xfe, 0xbf, 0xbf, 0x0e, 0x00, 0x29, 0x40, 0x48, 0xfe,
+  0x75, 0x7f, 0xbb, 0x05, 0x00, 0x03, 0x40, 0x75, 0x7f, 0x39, 0xff, 0xfe,
+  0x05, 0x05, 0x40, 0x00, 0x29, 0x80, 0x48, 0xfe, 0x69, 0x68, 0x4d, 0xd9,
+  0x00, 0x03, 0x80, 0x69, 0x68, 0xfd, 0xff, 0xfe, 0xd9, 0xd9, 0x80, 0x00,
+  0x29, 0xfe, 0x48, 0xfe, 0x10, 0x3e, 0xa9, 0xc3, 0x00, 0x03, 0xfe, 0x10,
+  0x3e, 0xb9, 0xff, 0xfe, 0xc3, 0xc3, 0xfe, 0x00, 0x29, 0x00, 0x48, 0xff,
+  0x35, 0xad, 0xff, 0xe1, 0x00, 0x03, 0x00, 0x35, 0xad, 0x7f, 0xff, 0xfe,
+  0xe1, 0xe1, 0x00, 0x00, 0x29, 0x0f, 0x48, 0xff, 0xb7, 0x43, 0xd9, 0xda,
+  0x00, 0x03, 0x0f, 0xb7, 0x43, 0x79, 0xff, 0xfe, 0xda, 0xda, 0x0f, 0x00,
+  0x29, 0x40, 0x48, 0xff, 0xa3, 0xdb, 0x2a, 0x33, 0x00, 0x03, 0x40, 0xa3,
+  0xdb, 0x38, 0xff, 0xfe, 0x33, 0x33, 0x40, 0x00, 0x29, 0x80, 0x48, 0xff,
+  0xcf, 0xc5, 0x24, 0x9b, 0x00, 0x03, 0x80, 0xcf, 0xc5, 0xb4, 0xff, 0xfe,
+  0x9b, 0x9b, 0x80, 0x00, 0x29, 0xfe, 0x48, 0xff, 0xa5, 0x66, 0x55, 0x4f,
+  0x00, 0x03, 0xfe, 0xa5, 0x66, 0xf5, 0xff, 0xfe, 0x4f, 0x4f, 0xfe, 0x00,
+  0x2a, 0x48, 0x48, 0xf1, 0xff, 0x86, 0xb5, 0x7f, 0x7a, 0x02, 0xe3, 0xff,
+  0x86, 0xb5, 0xff, 0xfd, 0x7f, 0x7f, 0xe3, 0x00, 0x2a, 0x48, 0x48, 0xb0,
+  0x78, 0x48, 0xd3, 0x7f, 0xb8, 0x02, 0x61, 0x78, 0x48, 0x71, 0xff, 0xfd,
+  0x7f, 0x7f, 0x61, 0x00, 0x2a, 0x48, 0x48, 0xa2, 0x03, 0xc0, 0xaa, 0x00,
+  0x40, 0x02, 0x44, 0x03, 0xc0, 0x39, 0xff, 0xfd, 0x00, 0x00, 0x44, 0x00,
+  0x2a, 0x48, 0x48, 0x11, 0x6e, 0xd6, 0xbe, 0xc0, 0x2a, 0x02, 0x22, 0x6e,
+  0xd6, 0x3c, 0xff, 0xfd, 0xc0, 0xc0, 0x22, 0x00, 0x2a, 0x48, 0x48, 0x29,
+  0x31, 0xd9, 0x10, 0xaa, 0x27, 0x02, 0x52, 0x31, 0xd9, 0x30, 0xff, 0xfd,
+  0xaa, 0xaa, 0x52, 0x00, 0x2a, 0x48, 0x48, 0xd0, 0xdf, 0x9b, 0x6e, 0x0f,
+  0x65, 0x02, 0xa0, 0xdf, 0x9b, 0xfd, 0xff, 0xfd, 0x0f, 0x0f, 0xa0, 0x00,
+  0x2c, 0x00, 0x03, 0x8a, 0xd5, 0xcc, 0x52, 0x80, 0x34, 0x02, 0x8a, 0xd5,
+  0xcc, 0xb0, 0xff, 0xff, 0x80, 0x80, 0xb0, 0x00, 0x2c, 0x00, 0x03, 0x06,
+  0x5e, 0xd9, 0x1d, 0xff, 0x27, 0x02, 0x06, 0x5e, 0xd9, 0xfd, 0xff, 0xff,
+  0xff, 0xff, 0xfd, 0x00, 0x2c, 0x00, 0x03, 0x97, 0x4b, 0xa5, 0x78, 0x00,
+  0x5b, 0x02, 0x97, 0x4b, 0xa5, 0x3a, 0xff, 0xff, 0x00, 0x00, 0x3a, 0x00,
+  0x2c, 0x00, 0x03, 0xb3, 0x09, 0x7d, 0x79, 0xfe, 0x83, 0x02, 0xb3, 0x09,
+  0x7d, 0xf9, 0xff, 0xff, 0xfe, 0xfe, 0xf9, 0x00, 0x2c, 0x00, 0x03, 0xce,
+  0x34, 0x83, 0xa4, 0x00, 0x7d, 0x02, 0xce, 0x34, 0x83, 0x36, 0xff, 0xff,
+  0x00, 0x00, 0x36, 0x00, 0x2c, 0x00, 0x03, 0x79, 0xc0, 0x81, 0x59, 0x41,
+  0x7f, 0x02, 0x79, 0xc0, 0x81, 0x79, 0xff, 0xff, 0x41, 0x41, 0x79, 0x00,
+  0x2d, 0x00, 0x03, 0x9b, 0xf5, 0xa6, 0xfc, 0x41, 0x5a, 0x02, 0x01, 0xf5,
+  0xa6, 0x7c, 0xff, 0xff, 0x41, 0x41, 0x7c, 0x00, 0x2d, 0x00, 0x03, 0x2e,
+  0x00, 0x4d, 0x29, 0xaa, 0xb3, 0x02, 0x2a, 0x00, 0x4d, 0x39, 0xff, 0xff,
+  0xaa, 0xaa, 0x39, 0x00, 0x2d, 0x00, 0x03, 0x5d, 0xa3, 0x2b, 0x40, 0xaa,
+  0xd5, 0x02, 0x08, 0xa3, 0x2b, 0x70, 0xff, 0xff, 0xaa, 0xaa, 0x70, 0x00,
+  0x2d, 0x00, 0x03, 0x91, 0x2c, 0xbc, 0x8c, 0x00, 0x44, 0x02, 0x00, 0x2c,
+  0xbc, 0x3e, 0xff, 0xff, 0x00, 0x00, 0x3e, 0x00, 0x2d, 0x00, 0x03, 0x1b,
+  0x92, 0x44, 0xa4, 0xaa, 0xbc, 0x02, 0x0a, 0x92, 0x44, 0x34, 0xff, 0xff,
+  0xaa, 0xaa, 0x34, 0x00, 0x2d, 0x00, 0x03, 0x1a, 0x30, 0xcf, 0x9e, 0xaa,
+  0x31, 0x02, 0x0a, 0x30, 0xcf, 0x3c, 0xff, 0xff, 0xaa, 0xaa, 0x3c, 0x00,
+  0x2e, 0x00, 0x03, 0x4f, 0x29, 0x9d, 0x0f, 0x40, 0x63, 0x02, 0x4f, 0x29,
+  0x9d, 0xbc, 0xff, 0xff, 0x40, 0x81, 0xbc, 0x00, 0x2e, 0x00, 0x03, 0x90,
+  0xab, 0xea, 0xee, 0x7f, 0x16, 0x02, 0x90, 0xab, 0xea, 0xfc, 0xff, 0xff,
+  0x7f, 0xfe, 0xfc, 0x00, 0x2e, 0x00, 0x03, 0x22, 0xd0, 0xba, 0xa8, 0xaa,
+  0x46, 0x02, 0x22, 0xd0, 0xba, 0x39, 0xff, 0xff, 0xaa, 0x54, 0x39, 0x00,
+  0x2e, 0x00, 0x03, 0x60, 0x18, 0x85, 0x9f, 0x40, 0x7b, 0x02, 0x60, 0x18,
+  0x85, 0xbc, 0xff, 0xff, 0x40, 0x81, 0xbc, 0x00, 0x2e, 0x00, 0x03, 0xc4,
+  0xa4, 0x90, 0x8d, 0xff, 0x70, 0x02, 0xc4, 0xa4, 0x90, 0xbd, 0xff, 0xff,
+  0xff, 0xff, 0xbd, 0x00, 0x2e, 0x00, 0x03, 0x45, 0x7f, 0xd6, 0x7c, 0x40,
+  0x2a, 0x02, 0x45, 0x7f, 0xd6, 0xfc, 0xff, 0xff, 0x40, 0x80, 0xfc, 0x00,
+  0x2f, 0x00, 0x03, 0xd5, 0xc5, 0xb5, 0x2b, 0x3f, 0x4b, 0x02, 0x55, 0xc5,
+  0xb5, 0x38, 0xff, 0xff, 0x3f, 0x7f, 0x38, 0x00, 0x2f, 0x00, 0x03, 0x87,
+  0xcc, 0x5d, 0x73, 0x7f, 0xa3, 0x02, 0x87, 0xcc, 0x5d, 0xf0, 0xff, 0xff,
+  0x7f, 0xff, 0xf0, 0x00, 0x2f, 0x00, 0x03, 0xd9, 0x75, 0x3b, 0xa5, 0xaa,
+  0xc5, 0x02, 0x51, 0x75, 0x3b, 0x35, 0xff, 0xff, 0xaa, 0x55, 0x35, 0x00,
+  0x2f, 0x00, 0x03, 0xdc, 0xa4, 0x69, 0x31, 0x01, 0x97, 0x02, 0x00, 0xa4,
+  0x69, 0x32, 0xff, 0xff, 0x01, 0x03, 0x32, 0x00, 0x2f, 0x00, 0x03, 0x1f,
+  0xfe, 0x94, 0xfa, 0xe6, 0x6c, 0x02, 0x0c, 0xfe, 0x94, 0x79, 0xff, 0xff,
+  0xe6, 0xcc, 0x79, 0x00, 0x2f, 0x00, 0x03, 0xde, 0xd7, 0xff, 0x41, 0xff,
+  0x01, 0x02, 0xde, 0xd7, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x00,
+  0x30, 0x01, 0x48, 0x01, 0x29, 0x0b, 0x7a, 0xf1, 0x00, 0x03, 0x01, 0x29,
+  0x0b, 0x7a, 0xff, 0xfe, 0xf1, 0xf1, 0x01, 0x00, 0x30, 0x01, 0x48, 0x41,
+  0xd7, 0xcd, 0xd7, 0xdf, 0x00, 0x03, 0x41, 0xd7, 0xcd, 0xf7, 0xff, 0xff,
+  0xdf, 0xdf, 0xf7, 0x00, 0x30, 0x01, 0x48, 0x1c, 0x5c, 0x90, 0xca, 0xe4,
+  0x00, 0x03, 0x1c, 0x5c, 0x90, 0xfa, 0xff, 0xff, 0xe4, 0xe4, 0xfa, 0x00,
+  0x30, 0x01, 0x48, 0x38, 0x08, 0x83, 0x34, 0xee, 0x00, 0x03, 0x38, 0x08,
+  0x83, 0x34, 0xff, 0xfe, 0xee, 0xee, 0x38, 0x00, 0x30, 0x01, 0x48, 0x81,
+  0x07, 0x28, 0xcc, 0x3e, 0x00, 0x03, 0x81, 0x07, 0x28, 0xfc, 0xff, 0xff,
+  0x3e, 0x3e, 0xfc, 0x00, 0x30, 0x01, 0x48, 0x56, 0x89, 0x8f, 0x0e, 0x8f,
+  0x00, 0x03, 0x56, 0x89, 0x8f, 0x3e, 0xff, 0xfe, 0x8f, 0x8f, 0x56, 0x00,
+  0x30, 0x01, 0x48, 0x75, 0x04, 0xd4, 0x73, 0x7c, 0x00, 0x03, 0x75, 0x04,
+  0xd4, 0x73, 0xff, 0xfe, 0x7c, 0x7c, 0x75, 0x00, 0x30, 0x01, 0x48, 0xb8,
+  0x83, 0x00, 0x69, 0x63, 0x00, 0x03, 0xb8, 0x83, 0x00, 0x79, 0xff, 0xfe,
+  0x63, 0x63, 0xb8, 0x00, 0x30, 0x01, 0x48, 0xb0, 0x09, 0x1c, 0xa8, 0xea,
+  0x00, 0x03, 0xb0, 0x09, 0x1c, 0xb8, 0xff, 0xff, 0xea, 0xea, 0xb8, 0x00,
+  0x30, 0x01, 0x48, 0x3a, 0xb6, 0x47, 0xc6, 0xd8, 0x00, 0x03, 0x3a, 0xb6,
+  0x47, 0xf6, 0xff, 0xff, 0xd8, 0xd8, 0xf6, 0x00, 0x30, 0x01, 0x48, 0xec,
+  0x80, 0xfa, 0xfb, 0xa7, 0x00, 0x03, 0xec, 0x80, 0xfa, 0xfb, 0xff, 0xff,
+  0xa7, 0xa7, 0xfb, 0x00, 0x30, 0x01, 0x48, 0x2a, 0x3e, 0xa9, 0xc6, 0x26,
+  0x00, 0x03, 0x2a, 0x3e, 0xa9, 0xf6, 0xff, 0xff, 0x26, 0x26, 0xf6, 0x00,
+  0x30, 0x01, 0x48, 0x17, 0xdc, 0x78, 0x13, 0x9b, 0x00, 0x03, 0x17, 0xdc,
+  0x78, 0x33, 0xff, 0xfe, 0x9b, 0x9b, 0x17, 0x00, 0x30, 0x01, 0x48, 0x83,
+  0xa5, 0xaf, 0xd2, 0xac, 0x00, 0x03, 0x83, 0xa5, 0xaf, 0xf2, 0xff, 0xff,
+  0xac, 0xac, 0xf2, 0x00, 0x30, 0x01, 0x48, 0xae, 0xf1, 0x49, 0xe0, 0x22,
+  0x00, 0x03, 0xae, 0xf1, 0x49, 0xf0, 0xff, 0xff, 0x22, 0x22, 0xf0, 0x00,
+  0x30, 0x01, 0x48, 0xf4, 0xd4, 0x6e, 0x3f, 0xc3, 0x00, 0x03, 0xf4, 0xd4,
+  0x6e, 0x3f, 0xff, 0xfe, 0xc3, 0xc3, 0xf4, 0x00, 0x30, 0x01, 0x48, 0x45,
+  0xb5, 0x8a, 0x69, 0xa7, 0x00, 0x03, 0x45, 0xb5, 0x8a, 0x79, 0xff, 0xfe,
+  0xa7, 0xa7, 0x45, 0x00, 0x30, 0x01, 0x48, 0x89, 0x42, 0x3f, 0x6d, 0xf7,
+  0x00, 0x03, 0x89, 0x42, 0x3f, 0x7d, 0xff, 0xfe, 0xf7, 0xf7, 0x89, 0x00,
+  0x30, 0x01, 0x48, 0x23, 0x59, 0x93, 0xd6, 0x38, 0x00, 0x03, 0x23, 0x59,
+  0x93, 0xf6, 0xff, 0xff, 0x38, 0x38, 0xf6, 0x00, 0x30, 0x01, 0x48, 0x93,
+  0xf8, 0x3d, 0x9c, 0x92, 0x00, 0x03, 0x93, 0xf8, 0x3d, 0xbc, 0xff, 0xff,
+  0x92, 0x92, 0xbc, 0x00, 0x30, 0x00, 0x48, 0xc8, 0xa3, 0x9d, 0xaf, 0x0d,
+  0x00, 0x03, 0xc8, 0xa3, 0x9d, 0xbf, 0xff, 0xfe, 0x0d, 0x0d, 0xc8, 0x00,
+  0x30, 0x00, 0x48, 0x55, 0xff, 0x02, 0x34, 0xa6, 0x00, 0x03, 0x55, 0xff,
+  0x02, 0x34, 0xff, 0xfe, 0xa6, 0xa6, 0x55, 0x00, 0x30, 0x00, 0x48, 0x43,
+  0xc5, 0x65, 0x12, 0x0c, 0x00, 0x03, 0x43, 0xc5, 0x65, 0x32, 0xff, 0xfe,
+  0x0c, 0x0c, 0x43, 0x00, 0x30, 0x00, 0x48, 0x35, 0x37, 0xc1, 0x43, 0x11,
+  0x00, 0x03, 0x35, 0x37, 0xc1, 0x73, 0xff, 0xfe, 0x11, 0x11, 0x35, 0x00,
+  0x31, 0x42, 0x48, 0xc4, 0xa8, 0x00, 0x08, 0x01, 0x00, 0x03, 0x00, 0xa8,
+  0x00, 0x3a, 0xff, 0xfe, 0x01, 0x01, 0x00, 0x00, 0x31, 0x42, 0x48, 0x82,
+  0xfc, 0x00, 0x15, 0x3f, 0x00, 0x03, 0x02, 0xfc, 0x00, 0x35, 0xff, 0xfe,
+  0x3f, 0x3f, 0x02, 0x00, 0x31, 0x42, 0x48, 0xbe, 0x0d, 0x01, 0x64, 0x01,
+  0xff, 0x02, 0x00, 0x0d, 0x01, 0x76, 0xff, 0xfe, 0x01, 0x01, 0x00, 0x00,
+  0x31, 0x42, 0x48, 0xca, 0x93, 0x01, 0xb3, 0x41, 0xff, 0x02, 0x40, 0x93,
+  0x01, 0x31, 0xff, 0xfe, 0x41, 0x41, 0x40, 0x00, 0x31, 0x42, 0x48, 0x3c,
+  0x3a, 0x7f, 0x7d, 0x01, 0x81, 0x02, 0x00, 0x3a, 0x7f, 0x7f, 0xff, 0xfe,
+  0x01, 0x01, 0x00, 0x00, 0x31, 0x42, 0x48, 0xc8, 0xe1, 0x7f, 0xae, 0x40,
+  0x81, 0x02, 0x40, 0xe1, 0x7f, 0x3c, 0xff, 0xfe, 0x40, 0x40, 0x40, 0x00,
+  0x31, 0x42, 0x48, 0xa0, 0x32, 0xd5, 0x8c, 0x80, 0x2b, 0x02, 0x80, 0x32,
+  0xd5, 0xbc, 0xff, 0xfe, 0x80, 0x80, 0x80, 0x00, 0x31, 0x42, 0x48, 0xe3,
+  0xbe, 0xd5, 0xfd, 0xf3, 0x2b, 0x02, 0xe3, 0xbe, 0xd5, 0xfd, 0xff, 0xfe,
+  0xf3, 0xf3, 0xe3, 0x00, 0x31, 0x42, 0x48, 0x65, 0xd9, 0xff, 0x04, 0xaa,
+  0x01, 0x02, 0x20, 0xd9, 0xff, 0x34, 0xff, 0xfe, 0xaa, 0xaa, 0x20, 0x00,
+  0x31, 0x42, 0x48, 0x7e, 0xdf, 0xff, 0x02, 0xff, 0x01, 0x02, 0x7e, 0xdf,
+  0xff, 0x30, 0xff, 0xfe, 0xff, 0xff, 0x7e, 0x00, 0x33, 0x42, 0x48, 0x7f,
+  0xd2, 0x00, 0x20, 0x7f, 0x00, 0x03, 0x7e, 0xd2, 0x00, 0x30, 0xff, 0xfe,
+  0x7f, 0xfe, 0x7e, 0x00, 0x33, 0x42, 0x48, 0x4f, 0xc6, 0x00, 0x70, 0x80,
+  0x00, 0x03, 0x00, 0xc6, 0x00, 0x73, 0xff, 0xfe, 0x80, 0x00, 0x00, 0x00,
+  0x33, 0x42, 0x48, 0x8f, 0x40, 0x01, 0x34, 0xfe, 0xff, 0x02, 0x8c, 0x40,
+  0x01, 0xb5, 0xff, 0xfe, 0xfe, 0xfc, 0x8c, 0x00, 0x33, 0x42, 0x48, 0x2a,
+  0xcf, 0x01, 0x5d, 0xfe, 0xff, 0x02, 0x28, 0xcf, 0x01, 0x7d, 0xff, 0xfe,
+  0xfe, 0xfd, 0x28, 0x00, 0x33, 0x42, 0x48, 0x9b, 0xb9, 0x7f, 0x94, 0x01,
+  0x81, 0x02, 0x02, 0xb9, 0x7f, 0x34, 0xff, 0xfe, 0x01, 0x02, 0x02, 0x00,
+  0x33, 0x42, 0x48, 0xa3, 0x06, 0x7f, 0x67, 0x81, 0x81, 0x02, 0x03, 0x06,
+  0x7f, 0x75, 0xff, 0xfe, 0x81, 0x03, 0x03, 0x00, 0x33, 0x42, 0x48, 0x55,
+  0x61, 0xd5, 0x26, 0x0f, 0x2b, 0x02, 0x14, 0x61, 0xd5, 0x34, 0xff, 0xfe,
+  0x0f, 0x1e, 0x14, 0x00, 0x33, 0x42, 0x48, 0xf3, 0x77, 0xd5, 0x0f, 0x41,
+  0x2b, 0x02, 0x83, 0x77, 0xd5, 0xbc, 0xff, 0xfe, 0x41, 0x83, 0x83, 0x00,
+  0x33, 0x42, 0x48, 0x46, 0x51, 0xff, 0x10, 0xfe, 0x01, 0x02, 0x44, 0x51,
+  0xff, 0x31, 0xff, 0xfe, 0xfe, 0xfc, 0x44, 0x00, 0x33, 0x42, 0x48, 0xfa,
+  0x62, 0xff, 0xe3, 0x0f, 0x01, 0x02, 0x1a, 0x62, 0xff, 0x70, 0xff, 0xfe,
+  0x0f, 0x1f, 0x1a, 0x00, 0x34, 0x30, 0x48, 0xee, 0x00, 0x75, 0x45, 0x81,
+  0x8b, 0x02, 0xee, 0x00, 0x75, 0x75, 0xff, 0xfe, 0x81, 0x81, 0xee, 0x00,
+  0x34, 0x30, 0x48, 0x6e, 0x00, 0x1d, 0x43, 0x0f, 0xe3, 0x02, 0x6e, 0x00,
+  0x1d, 0x73, 0xff, 0xfe, 0x0f, 0x0f, 0x6e, 0x00, 0x34, 0x2f, 0x48, 0xd0,
+  0x01, 0x90, 0xd4, 0x81, 0x70, 0x02, 0xd0, 0x01, 0x90, 0xf4, 0xff, 0xfe,
+  0x81, 0x81, 0xd0, 0x00, 0x34, 0x2f, 0x48, 0xe4, 0x01, 0x81, 0x70, 0x02,
+  0x7f, 0x02, 0xe4, 0x01, 0x81, 0x70, 0xff, 0xfe, 0x02, 0x02, 0xe4, 0x00,
+  0x34, 0xb1, 0x48, 0x9f, 0x7f, 0xa4, 0x86, 0x81, 0x5c, 0x02, 0x9f, 0x7f,
+  0xa4, 0xb6, 0xff, 0xfe, 0x81, 0x81, 0x9f, 0x00, 0x34, 0xb1, 0x48, 0x12,
+  0x7f, 0xe9, 0xf0, 0x3f, 0x17, 0x02, 0x12, 0x7f, 0xe9, 0xf0, 0xff, 0xfe,
+  0x3f, 0x3f, 0x12, 0x00, 0x34, 0x5b, 0x48, 0xe7, 0xd5, 0xf2, 0xe0, 0x01,
+  0x0e, 0x02, 0xe7, 0xd5, 0xf2, 0xf0, 0xff, 0xfe, 0x01, 0x01, 0xe7, 0x00,
+  0x34, 0x5b, 0x48, 0x19, 0xd5, 0x50, 0xbe, 0x7f, 0xb0, 0x02, 0x19, 0xd5,
+  0x50, 0xbe, 0xff, 0xfe, 0x7f, 0x7f, 0x19, 0x00, 0x34, 0x31, 0x48, 0xc7,
+  0xff, 0x48, 0x0c, 0x7f, 0xb8, 0x02, 0xc7, 0xff, 0x48, 0x3c, 0xff, 0xfe,
+  0x7f, 0x7f, 0xc7, 0x00, 0x34, 0x31, 0x48, 0x95, 0xff, 0x42, 0x10, 0x41,
+  0xbe, 0x02, 0x95, 0xff, 0x42, 0x30, 0xff, 0xfe, 0x41, 0x41, 0x95, 0x00,
+  0x35, 0x30, 0x48, 0x0a, 0x00, 0x59, 0x28, 0x3f, 0xa7, 0x02, 0x0a, 0x00,
+  0x59, 0x38, 0xff, 0xfe, 0x3f, 0x3f, 0x0a, 0x00, 0x35, 0x30, 0x48, 0x87,
+  0x00, 0xb4, 0xa0, 0x00, 0x4c, 0x02, 0x00, 0x00, 0xb4, 0x32, 0xff, 0xfe,
+  0x00, 0x00, 0x00, 0x00, 0x35, 0x2f, 0x48, 0x98, 0x01, 0x53, 0x22, 0x01,
+  0xad, 0x02, 0x00, 0x01, 0x53, 0x32, 0xff, 0xfe, 0x01, 0x01, 0x00, 0x00,
+  0x35, 0x2f, 0x48, 0x66, 0x01, 0xb5, 0xdf, 0x41, 0x4b, 0x02, 0x40, 0x01,
+  0xb5, 0x7d, 0xff, 0xfe, 0x41, 0x41, 0x40, 0x00, 0x35, 0xb1, 0x48, 0xa5,
+  0x7f, 0x02, 0x71, 0x0f, 0xfe, 0x02, 0x05, 0x7f, 0x02, 0x71, 0xff, 0xfe,
+  0x0f, 0x0f, 0x05, 0x00, 0x35, 0xb1, 0x48, 0x08, 0x7f, 0x38, 0x06, 0x02,
+  0xc8, 0x02, 0x00, 0x7f, 0x38, 0x36, 0xff, 0xfe, 0x02, 0x02, 0x00, 0x00,
+  0x35, 0x5b, 0x48, 0x74, 0xd5, 0x82, 0xf9, 0x80, 0x7e, 0x02, 0x00, 0xd5,
+  0x82, 0x7b, 0xff, 0xfe, 0x80, 0x80, 0x00, 0x00, 0x35, 0x5b, 0x48, 0xca,
+  0xd5, 0xca, 0x8d, 0x7f, 0x36, 0x02, 0x4a, 0xd5, 0xca, 0x3d, 0xff, 0xfe,
+  0x7f, 0x7f, 0x4a, 0x00, 0x35, 0x31, 0x48, 0x7e, 0xff, 0x19, 0x9b, 0xf1,
+  0xe7, 0x02, 0x70, 0xff, 0x19, 0x39, 0xff, 0xfe, 0xf1, 0xf1, 0x70, 0x00,
+  0x35, 0x31, 0x48, 0x10, 0xff, 0xb9, 0x89, 0x7f, 0x47, 0x02, 0x10, 0xff,
+  0xb9, 0x39, 0xff, 0xfe, 0x7f, 0x7f, 0x10, 0x00, 0x36, 0x30, 0x48, 0x57,
+  0x00, 0x6f, 0x04, 0x02, 0x91, 0x02, 0x57, 0x00, 0x6f, 0x34, 0xff, 0xfe,
+  0x04, 0x02, 0x57, 0x00, 0x36, 0x30, 0x48, 0x22, 0x00, 0xe2, 0x79, 0x46,
+  0x1e, 0x02, 0x22, 0x00, 0xe2, 0xf8, 0xff, 0xfe, 0x8d, 0x46, 0x22, 0x00,
+  0x36, 0x2f, 0x48, 0x8b, 0x01, 0x32, 0x0e, 0x4b, 0xce, 0x02, 0x8b, 0x01,
+  0x32, 0xbc, 0xff, 0xfe, 0x96, 0x4b, 0x8b, 0x00, 0x36, 0x2f, 0x48, 0x49,
+  0x01, 0xde, 0x0f, 0xca, 0x22, 0x02, 0x49, 0x01, 0xde, 0xbd, 0xff, 0xfe,
+  0x95, 0xca, 0x49, 0x00, 0x36, 0xb1, 0x48, 0x33, 0x7f, 0x6b, 0x40, 0x80,
+  0x95, 0x02, 0x33, 0x7f, 0x6b, 0x73, 0xff, 0xfe, 0x00, 0x80, 0x33, 0x00,
+  0x36, 0xb1, 0x48, 0x5b, 0x7f, 0x63, 0xd1, 0xc0, 0x9d, 0x02, 0x5b, 0x7f,
+  0x63, 0xf1, 0xff, 0xfe, 0x81, 0xc0, 0x5b, 0x00, 0x36, 0x5b, 0x48, 0x47,
+  0xd5, 0xba, 0x0e, 0x81, 0x46, 0x02, 0x47, 0xd5, 0xba, 0x3d, 0xff, 0xfe,
+  0x02, 0x81, 0x47, 0x00, 0x36, 0x5b, 0x48, 0xe9, 0xd5, 0x77, 0x8f, 0xff,
+  0x89, 0x02, 0xe9, 0xd5, 0x77, 0xbd, 0xff, 0xfe, 0xff, 0xff, 0xe9, 0x00,
+  0x36, 0x31, 0x48, 0xa6, 0xff, 0x41, 0x00, 0xfe, 0xbf, 0x02, 0xa6, 0xff,
+  0x41, 0xb1, 0xff, 0xfe, 0xfc, 0xfe, 0xa6, 0x00, 0x36, 0x31, 0x48, 0xca,
+  0xff, 0x55, 0x3b, 0x3f, 0xab, 0x02, 0xca, 0xff, 0x55, 0x38, 0xff, 0xfe,
+  0x7f, 0x3f, 0xca, 0x00, 0x37, 0x30, 0x48, 0x20, 0x00, 0x57, 0xbf, 0x00,
+  0xa9, 0x02, 0x00, 0x00, 0x57, 0x3e, 0xff, 0xfe, 0x01, 0x00, 0x00, 0x00,
+  0x37, 0x30, 0x48, 0x0d, 0x00, 0x9c, 0x55, 0xc0, 0x64, 0x02, 0x01, 0x00,
+  0x9c, 0x75, 0xff, 0xfe, 0x81, 0xc0, 0x01, 0x00, 0x37, 0x2f, 0x48, 0xa6,
+  0x01, 0xf4, 0x27, 0xaa, 0x0c, 0x02, 0x04, 0x01, 0xf4, 0x35, 0xff, 0xfe,
+  0x55, 0xaa, 0x04, 0x00, 0x37, 0x2f, 0x48, 0xca, 0x01, 0xfe, 0xd4, 0x41,
+  0x02, 0x02, 0x82, 0x01, 0xfe, 0xf4, 0xff, 0xfe, 0x82, 0x41, 0x82, 0x00,
+  0x37, 0xb1, 0x48, 0xc9, 0x7f, 0xed, 0x3d, 0x80, 0x13, 0x02, 0x01, 0x7f,
+  0xed, 0x3d, 0xff, 0xfe, 0x01, 0x80, 0x01, 0x00, 0x37, 0xb1, 0x48, 0x3c,
+  0x7f, 0x16, 0x46, 0x81, 0xea, 0x02, 0x00, 0x7f, 0x16, 0x77, 0xff, 0xfe,
+  0x02, 0x81, 0x00, 0x00, 0x37, 0x5b, 0x48, 0x08, 0xd5, 0x54, 0xb2, 0x21,
+  0xac, 0x02, 0x00, 0xd5, 0x54, 0x32, 0xff, 0xfe, 0x42, 0x21, 0x00, 0x00,
+  0x37, 0x5b, 0x48, 0x6a, 0xd5, 0x45, 0x42, 0x02, 0xbb, 0x02, 0x00, 0xd5,
+  0x45, 0x72, 0xff, 0xfe, 0x04, 0x02, 0x00, 0x00, 0x37, 0x31, 0x48, 0x75,
+  0xff, 0x2b, 0xb7, 0x00, 0xd5, 0x02, 0x01, 0xff, 0x2b, 0x34, 0xff, 0xfe,
+  0x01, 0x00, 0x01, 0x00, 0x37, 0x31, 0x48, 0x3c, 0xff, 0x8f, 0xbf, 0xf5,
+  0x71, 0x02, 0x28, 0xff, 0x8f, 0x3d, 0xff, 0xfe, 0xeb, 0xf5, 0x28, 0x00,
+  0x38, 0x48, 0x48, 0xad, 0x63, 0xce, 0xaf, 0x00, 0x32, 0x02, 0xad, 0x63,
+  0xce, 0xbf, 0xff, 0xfd, 0x00, 0x00, 0xad, 0x00, 0x38, 0x48, 0x48, 0xc4,
+  0x86, 0xe8, 0xb3, 0xfe, 0x18, 0x02, 0xc4, 0x86, 0xe8, 0xb3, 0xff, 0xfd,
+  0xfe, 0xfe, 0xc4, 0x00, 0x38, 0x48, 0x48, 0xd4, 0x2a, 0x93, 0x27, 0x02,
+  0x6d, 0x02, 0xd4, 0x2a, 0x93, 0x37, 0xff, 0xfd, 0x02, 0x02, 0xd4, 0x00,
+  0x38, 0x48, 0x48, 0x00, 0x06, 0x88, 0x14, 0x3f, 0x78, 0x02, 0x00, 0x06,
+  0x88, 0x35, 0xff, 0xfd, 0x3f, 0x3f, 0x00, 0x00, 0x38, 0x48, 0x48, 0xc6,
+  0x79, 0x66, 0x65, 0xff, 0x9a, 0x02, 0xc6, 0x79, 0x66, 0x75, 0xff, 0xfd,
+  0xff, 0xff, 0xc6, 0x00, 0x38, 0x48, 0x48, 0x4b, 0xe0, 0x53, 0xfa, 0xfe,
+  0xad, 0x02, 0x4b, 0xe0, 0x53, 0xfb, 0xff, 0xfd, 0xfe, 0xfe, 0x4b, 0x00,
+  0x39, 0x00, 0x03, 0xa3, 0xff, 0x00, 0xe8, 0xfe, 0x00, 0x03, 0xa2, 0xff,
+  0x00, 0xf8, 0xff, 0xff, 0xfe, 0xfe, 0xf8, 0x00, 0x39, 0x00, 0x03, 0xf5,
+  0x9e, 0x00, 0x94, 0x40, 0x00, 0x03, 0x40, 0x9e, 0x00, 0x34, 0xff, 0xff,
+  0x40, 0x40, 0x34, 0x00, 0x39, 0xff, 0x02, 0x40, 0x55, 0x01, 0x74, 0x80,
+  0xff, 0x02, 0x00, 0x55, 0x01, 0x76, 0xff, 0xff, 0x80, 0x80, 0x76, 0x00,
+  0x39, 0xff, 0x02, 0x02, 0x05, 0x01, 0x4b, 0x80, 0xff, 0x02, 0x00, 0x05,
+  0x01, 0x7b, 0xff, 0xff, 0x80, 0x80, 0x7b, 0x00, 0x39, 0x81, 0x02, 0xe9,
+  0x92, 0x7f, 0x6b, 0x80, 0x81, 0x02, 0x80, 0x92, 0x7f, 0xf9, 0xff, 0xff,
+  0x80, 0x80, 0xf9, 0x00, 0x39, 0x81, 0x02, 0xcc, 0xdc, 0x7f, 0x61, 0x7f,
+  0x81, 0x02, 0x4c, 0xdc, 0x7f, 0x71, 0xff, 0xff, 0x7f, 0x7f, 0x71, 0x00,
+  0x39, 0x2b, 0x02, 0x95, 0xfa, 0xd5, 0x7c, 0x7f, 0x2b, 0x02, 0x15, 0xfa,
+  0xd5, 0x7c, 0xff, 0xff, 0x7f, 0x7f, 0x7c, 0x00, 0x39, 0x2b, 0x02, 0xcc,
+  0x78, 0xd5, 0x6e, 0x41, 0x2b, 0x02, 0x40, 0x78, 0xd5, 0x7c, 0xff, 0xff,
+  0x41, 0x41, 0x7c, 0x00, 0x39, 0x01, 0x02, 0xac, 0x11, 0xff, 0x26, 0x3f,
+  0x01, 0x02, 0x2c, 0x11, 0xff, 0x34, 0xff, 0xff, 0x3f, 0x3f, 0x34, 0x00,
+  0x39, 0x01, 0x02, 0xb3, 0x5f, 0xff, 0x37, 0x41, 0x01, 0x02, 0x01, 0x5f,
+  0xff, 0x35, 0xff, 0xff, 0x41, 0x41, 0x35, 0x00, 0x3a, 0x48, 0x48, 0x4d,
+  0x60, 0xe1, 0xa9, 0x7f, 0x1f, 0x02, 0x4d, 0x60, 0xe1, 0xb9, 0xff, 0xfd,
+  0x7f, 0x7f, 0x4d, 0x00, 0x3a, 0x48, 0x48, 0xc7, 0xd1, 0x4d, 0xae, 0x01,
+  0xb3, 0x02, 0xc7, 0xd1, 0x4d, 0xbe, 0xff, 0xfd, 0x01, 0x01, 0xc7, 0x00,
+  0x3a, 0x48, 0x48, 0xb3, 0xe9, 0xc5, 0xd2, 0x81, 0x3b, 0x02, 0xb3, 0xe9,
+  0xc5, 0xf2, 0xff, 0xfd, 0x81, 0x81, 0xb3, 0x00, 0x3a, 0x48, 0x48, 0x0e,
+  0x52, 0x12, 0x4d, 0xaa, 0xee, 0x02, 0x0e, 0x52, 0x12, 0x7d, 0xff, 0xfd,
+  0xaa, 0xaa, 0x0e, 0x00, 0x3b, 0x00, 0x03, 0x56, 0x10, 0x00, 0xf0, 0x41,
+  0x00, 0x03, 0x02, 0x10, 0x00, 0x70, 0xff, 0xff, 0x41, 0x82, 0x70, 0x00,
+  0x3b, 0x00, 0x03, 0x68, 0x0a, 0x00, 0xbf, 0x76, 0x00, 0x03, 0x68, 0x0a,
+  0x00, 0x3c, 0xff, 0xff, 0x76, 0xed, 0x3c, 0x00, 0x3b, 0xff, 0x02, 0xfe,
+  0xd7, 0x01, 0xff, 0x00, 0xff, 0x02, 0x00, 0xd7, 0x01, 0x7e, 0xff, 0xff,
+  0x00, 0x01, 0x7e, 0x00, 0x3b, 0xff, 0x02, 0x1b, 0x54, 0x01, 0x86, 0xfe,
+  0xff, 0x02, 0x18, 0x54, 0x01, 0x35, 0xff, 0xff, 0xfe, 0xfc, 0x35, 0x00,
+  0x3b, 0x81, 0x02, 0x45, 0x97, 0x7f, 0xac, 0xff, 0x81, 0x02, 0x44, 0x97,
+  0x7f, 0x3d, 0xff, 0xff, 0xff, 0xfe, 0x3d, 0x00, 0x3b, 0x81, 0x02, 0x19,
+  0x00, 0x7f, 0x59, 0x3f, 0x81, 0x02, 0x19, 0x00, 0x7f, 0x78, 0xff, 0xff,
+  0x3f, 0x7f, 0x78, 0x00, 0x3b, 0x2b, 0x02, 0xfa, 0xed, 0xd5, 0x2c, 0x80,
+  0x2b, 0x02, 0x00, 0xed, 0xd5, 0x3f, 0xff, 0xff, 0x80, 0x00, 0x3f, 0x00,
+  0x3b, 0x2b, 0x02, 0xe7, 0x2c, 0xd5, 0xb4, 0x81, 0x2b, 0x02, 0x02, 0x2c,
+  0xd5, 0x35, 0xff, 0xff, 0x81, 0x02, 0x35, 0x00, 0x3b, 0x01, 0x02, 0x59,
+  0xb0, 0xff, 0x43, 0x80, 0x01, 0x02, 0x01, 0xb0, 0xff, 0x71, 0xff, 0xff,
+  0x80, 0x01, 0x71, 0x00, 0x3b, 0x01, 0x02, 0x30, 0xce, 0xff, 0xcc, 0xc3,
+  0x01, 0x02, 0x00, 0xce, 0xff, 0x7f, 0xff, 0xff, 0xc3, 0x86, 0x7f, 0x00,
+  0x3c, 0x00, 0x03, 0x61, 0x00, 0x32, 0x74, 0x40, 0xce, 0x02, 0x61, 0x00,
+  0x32, 0x74, 0xff, 0xff, 0x40, 0x40, 0x74, 0x00, 0x3c, 0x00, 0x03, 0xbb,
+  0x00, 0x80, 0x41, 0x81, 0x80, 0x02, 0xbb, 0x00, 0x80, 0x71, 0xff, 0xff,
+  0x81, 0x81, 0x71, 0x00, 0x3c, 0xff, 0x02, 0xa1, 0x01, 0xc3, 0xc0, 0x80,
+  0x3d, 0x02, 0xa1, 0x01, 0xc3, 0xf0, 0xff, 0xff, 0x80, 0x80, 0xf0, 0x00,
+  0x3c, 0xff, 0x02, 0x26, 0x01, 0x75, 0x49, 0x7f, 0x8b, 0x02, 0x26, 0x01,
+  0x75, 0x79, 0xff, 0xff, 0x7f, 0x7f, 0x79, 0x00, 0x3c, 0x81, 0x02, 0x6b,
+  0x7f, 0x01, 0xf0, 0x3f, 0xff, 0x02, 0x6b, 0x7f, 0x01, 0xf0, 0xff, 0xff,
+  0x3f, 0x3f, 0xf0, 0x00, 0x3c, 0x81, 0x02, 0x74, 0x7f, 0x69, 0xbc, 0xfe,
+  0x97, 0x02, 0x74, 0x7f, 0x69, 0xbc, 0xff, 0xff, 0xfe, 0xfe, 0xbc, 0x00,
+  0x3c, 0x2b, 0x02, 0xb3, 0xd5, 0x95, 0xa7, 0x02, 0x6b, 0x02, 0xb3, 0xd5,
+  0x95, 0xb7, 0xff, 0xff, 0x02, 0x02, 0xb7, 0x00, 0x3c, 0x2b, 0x02, 0x0c,
+  0xd5, 0x3f, 0xf7, 0xc0, 0xc1, 0x02, 0x0c, 0xd5, 0x3f, 0xf7, 0xff, 0xff,
+  0xc0, 0xc0, 0xf7, 0x00, 0x3c, 0x01, 0x02, 0x3f, 0xff, 0x6f, 0xeb, 0x40,
+  0x91, 0x02, 0x3f, 0xff, 0x6f, 0xfb, 0xff, 0xff, 0x40, 0x40, 0xfb, 0x00,
+  0x3c, 0x01, 0x02, 0x59, 0xff, 0xa8, 0xc5, 0xfe, 0x58, 0x02, 0x59, 0xff,
+  0xa8, 0xf5, 0xff, 0xff, 0xfe, 0xfe, 0xf5, 0x00, 0x3d, 0x00, 0x03, 0xcc,
+  0x00, 0x96, 0xce, 0x00, 0x6a, 0x02, 0x00, 0x00, 0x96, 0x7e, 0xff, 0xff,
+  0x00, 0x00, 0x7e, 0x00, 0x3d, 0x00, 0x03, 0x53, 0x00, 0x36, 0xc3, 0xfe,
+  0xca, 0x02, 0x52, 0x00, 0x36, 0x71, 0xff, 0xff, 0xfe, 0xfe, 0x71, 0x00,
+  0x3d, 0xff, 0x02, 0x93, 0x01, 0xc8, 0xc7, 0xc0, 0x38, 0x02, 0x80, 0x01,
+  0xc8, 0xf5, 0xff, 0xff, 0xc0, 0xc0, 0xf5, 0x00, 0x3d, 0xff, 0x02, 0x27,
+  0x01, 0x85, 0xae, 0x3f, 0x7b, 0x02, 0x27, 0x01, 0x85, 0x3c, 0xff, 0xff,
+  0x3f, 0x3f, 0x3c, 0x00, 0x3d, 0x81, 0x02, 0x78, 0x7f, 0xe3, 0x14, 0x40,
+  0x1d, 0x02, 0x40, 0x7f, 0xe3, 0x34, 0xff, 0xff, 0x40, 0x40, 0x34, 0x00,
+  0x3d, 0x81, 0x02, 0x54, 0x7f, 0xe6, 0x4f, 0xff, 0x1a, 0x02, 0x54, 0x7f,
+  0xe6, 0x7d, 0xff, 0xff, 0xff, 0xff, 0x7d, 0x00, 0x3d, 0x2b, 0x02, 0xa2,
+  0xd5, 0x82, 0xbb, 0xc0, 0x7e, 0x02, 0x80, 0xd5, 0x82, 0xb9, 0xff, 0xff,
+  0xc0, 0xc0, 0xb9, 0x00, 0x3d, 0x2b, 0x02, 0x2e, 0xd5, 0x5b, 0x35, 0x00,
+  0xa5, 0x02, 0x00, 0xd5, 0x5b, 0x37, 0xff, 0xff, 0x00, 0x00, 0x37, 0x00,
+  0x3d, 0x01, 0x02, 0x62, 0xff, 0x13, 0x6c, 0x7f, 0xed, 0x02, 0x62, 0xff,
+  0x13, 0x7c, 0xff, 0xff, 0x7f, 0x7f, 0x7c, 0x00, 0x3d, 0x01, 0x02, 0x30,
+  0xff, 0x0c, 0x2f, 0x0f, 0xf4, 0x02, 0x00, 0xff, 0x0c, 0x3f, 0xff, 0xff,
+  0x0f, 0x0f, 0x3f, 0x00, 0x3e, 0x00, 0x03, 0xe3, 0x00, 0xb4, 0x9b, 0xaa,
+  0x4c, 0x02, 0xe3, 0x00, 0xb4, 0x39, 0xff, 0xff, 0xaa, 0x55, 0x39, 0x00,
+  0x3e, 0x00, 0x03, 0x11, 0x00, 0x9d, 0x0d, 0x02, 0x63, 0x02, 0x11, 0x00,
+  0x9d, 0x3c, 0xff, 0xff, 0x02, 0x05, 0x3c, 0x00, 0x3e, 0xff, 0x02, 0x78,
+  0x01, 0xdb, 0x31, 0x02, 0x25, 0x02, 0x78, 0x01, 0xdb, 0x30, 0xff, 0xff,
+  0x02, 0x05, 0x30, 0x00, 0x3e, 0xff, 0x02, 0x7f, 0x01, 0x9c, 0x92, 0xfe,
+  0x64, 0x02, 0x7f, 0x01, 0x9c, 0xb1, 0xff, 0xff, 0xfe, 0xfc, 0xb1, 0x00,
+  0x3e, 0x81, 0x02, 0x61, 0x7f, 0x74, 0x78, 0x81, 0x8c, 0x02, 0x61, 0x7f,
+  0x74, 0x79, 0xff, 0xff, 0x81, 0x02, 0x79, 0x00, 0x3e, 0x81, 0x02, 0xce,
+  0x7f, 0xe6, 0x40, 0x01, 0x1a, 0x02, 0xce, 0x7f, 0xe6, 0x70, 0xff, 0xff,
+  0x01, 0x02, 0x70, 0x00, 0x3e, 0x2b, 0x02, 0x22, 0xd5, 0x00, 0xd2, 0x81,
+  0x00, 0x03, 0x22, 0xd5, 0x00, 0x71, 0xff, 0xff, 0x81, 0x02, 0x71, 0x00,
+  0x3e, 0x2b, 0x02, 0xca, 0xd5, 0x96, 0xf9, 0x0f, 0x6a, 0x02, 0xca, 0xd5,
+  0x96, 0x78, 0xff, 0xff, 0x0f, 0x1f, 0x78, 0x00, 0x3e, 0x01, 0x02, 0xe0,
+  0xff, 0x0a, 0x06, 0x81, 0xf6, 0x02, 0xe0, 0xff, 0x0a, 0x35, 0xff, 0xff,
+  0x81, 0x02, 0x35, 0x00, 0x3e, 0x01, 0x02, 0xae, 0xff, 0x97, 0x47, 0x41,
+  0x69, 0x02, 0xae, 0xff, 0x97, 0xf4, 0xff, 0xff, 0x41, 0x83, 0xf4, 0x00,
+  0x3f, 0x00, 0x03, 0x2d, 0x00, 0x9d, 0xfc, 0x41, 0x63, 0x02, 0x00, 0x00,
+  0x9d, 0x7e, 0xff, 0xff, 0x41, 0x82, 0x7e, 0x00, 0x3f, 0x00, 0x03, 0xbe,
+  0x00, 0x53, 0x15, 0x3f, 0xad, 0x02, 0x3e, 0x00, 0x53, 0x34, 0xff, 0xff,
+  0x3f, 0x7f, 0x34, 0x00, 0x3f, 0xff, 0x02, 0x40, 0x01, 0x03, 0x6a, 0x41,
+  0xfd, 0x02, 0x00, 0x01, 0x03, 0x7a, 0xff, 0xff, 0x41, 0x82, 0x7a, 0x00,
+  0x3f, 0xff, 0x02, 0x5b, 0x01, 0x87, 0xed, 0xfe, 0x79, 0x02, 0x59, 0x01,
+  0x87, 0x7d, 0xff, 0xff, 0xfe, 0xfd, 0x7d, 0x00, 0x3f, 0x81, 0x02, 0xae,
+  0x7f, 0xfe, 0xf9, 0x00, 0x02, 0x02, 0x00, 0x7f, 0xfe, 0x7a, 0xff, 0xff,
+  0x00, 0x01, 0x7a, 0x00, 0x3f, 0x81, 0x02, 0x4e, 0x7f, 0x71, 0xa7, 0xc0,
+  0x8f, 0x02, 0x00, 0x7f, 0x71, 0x37, 0xff, 0xff, 0xc0, 0x81, 0x37, 0x00,
+  0x3f, 0x2b, 0x02, 0xf7, 0xd5, 0xbd, 0x28, 0xc0, 0x43, 0x02, 0x80, 0xd5,
+  0xbd, 0xb9, 0xff, 0xff, 0xc0, 0x80, 0xb9, 0x00, 0x3f, 0x2b, 0x02, 0xbf,
+  0xd5, 0x44, 0xbc, 0x81, 0xbc, 0x02, 0x02, 0xd5, 0x44, 0x3d, 0xff, 0xff,
+  0x81, 0x02, 0x3d, 0x00, 0x3f, 0x01, 0x02, 0xe7, 0xff, 0xc1, 0x5d, 0x81,
+  0x3f, 0x02, 0x03, 0xff, 0xc1, 0x7d, 0xff, 0xff, 0x81, 0x03, 0x7d, 0x00,
+  0x3f, 0x01, 0x02, 0xe5, 0xff, 0x0e, 0x54, 0x01, 0xf2, 0x02, 0x00, 0xff,
+  0x0e, 0x76, 0xff, 0xff, 0x01, 0x02, 0x76, 0x00, 0x40, 0x48, 0x48, 0xca,
+  0x4f, 0x6b, 0xa8, 0xf9, 0x00, 0x03, 0xca, 0x50, 0x6b, 0x79, 0xff, 0x02,
+  0xf9, 0xf9, 0xa8, 0x00, 0x40, 0x48, 0x48, 0xab, 0x83, 0x8b, 0xe4, 0x16,
+  0x00, 0x03, 0xab, 0x84, 0x8b, 0xb4, 0xff, 0x02, 0x16, 0x16, 0xe4, 0x00,
+  0x40, 0x48, 0x48, 0x6c, 0x10, 0xe3, 0x8f, 0xdb, 0x00, 0x03, 0x6c, 0x11,
+  0xe3, 0x79, 0xff, 0x02, 0xdb, 0xdb, 0x8f, 0x00, 0x40, 0x48, 0x48, 0xea,
+  0x11, 0x8a, 0xd4, 0x29, 0x00, 0x03, 0xea, 0x12, 0x8a, 0x39, 0xff, 0x02,
+  0x29, 0x29, 0xd4, 0x00, 0x41, 0x40, 0x48, 0xd6, 0x00, 0xef, 0xe9, 0x09,
+  0x11, 0x02, 0xdf, 0x00, 0xef, 0xf9, 0xff, 0xfe, 0x09, 0x09, 0xdf, 0x00,
+  0x41, 0x40, 0x48, 0x97, 0x00, 0xff, 0xac, 0x01, 0x01, 0x02, 0x96, 0x00,
+  0xff, 0xbc, 0xff, 0xfe, 0x01, 0x01, 0x96, 0x00, 0x41, 0x3f, 0x48, 0xa6,
+  0x01, 0x43, 0x24, 0x3f, 0xbd, 0x02, 0x99, 0x01, 0x43, 0xb4, 0xff, 0xfe,
+  0x3f, 0x3f, 0x99, 0x00, 0x41, 0x3f, 0x48, 0x37, 0x01, 0xfb, 0x0a, 0x40,
+  0x05, 0x02, 0x77, 0x01, 0xfb, 0x38, 0xff, 0xfe, 0x40, 0x40, 0x77, 0x00,
+  0x41, 0xc1, 0x48, 0x7e, 0x7f, 0x09, 0x2e, 0x7f, 0xf7, 0x02, 0x01, 0x7f,
+  0x09, 0x3c, 0xff, 0xfe, 0x7f, 0x7f, 0x01, 0x00, 0x41, 0xc1, 0x48, 0xe0,
+  0x7f, 0xab, 0x3f, 0xff, 0x55, 0x02, 0x1f, 0x7f, 0xab, 0x3d, 0xff, 0xfe,
+  0xff, 0xff, 0x1f, 0x00, 0x41, 0x6b, 0x48, 0x25, 0xd5, 0xbc, 0xf7, 0x80,
+  0x44, 0x02, 0xa5, 0xd5, 0xbc, 0xf5, 0xff, 0xfe, 0x80, 0x80, 0xa5, 0x00,
+  0x41, 0x6b, 0x48, 0x3e, 0xd5, 0xe8, 0x84, 0x02, 0x18, 0x02, 0x3c, 0xd5,
+  0xe8, 0x34, 0xff, 0xfe, 0x02, 0x02, 0x3c, 0x00, 0x41, 0x41, 0x48, 0xb3,
+  0xff, 0xba, 0x45, 0x00, 0x46, 0x02, 0xb3, 0xff, 0xba, 0xf5, 0xff, 0xfe,
+  0x00, 0x00, 0xb3, 0x00, 0x41, 0x41, 0x48, 0xea, 0xff, 0x36, 0xa4, 0x00,
+  0xca, 0x02, 0xea, 0xff, 0x36, 0xb4, 0xff, 0xfe, 0x00, 0x00, 0xea, 0x00,
+  0x43, 0x40, 0x48, 0xe3, 0x00, 0xd2, 0x2e, 0x02, 0x2e, 0x02, 0xe2, 0x00,
+  0xd2, 0xbc, 0xff, 0xfe, 0x02, 0x01, 0xe2, 0x00, 0x43, 0x40, 0x48, 0x54,
+  0x00, 0x38, 0x0f, 0xff, 0xc8, 0x02, 0x2b, 0x00, 0x38, 0x3d, 0xff, 0xfe,
+  0xff, 0x7f, 0x2b, 0x00, 0x43, 0x3f, 0x48, 0x72, 0x01, 0x98, 0x2c, 0x81,
+  0x68, 0x02, 0x32, 0x01, 0x98, 0x3d, 0xff, 0xfe, 0x81, 0x40, 0x32, 0x00,
+  0x43, 0x3f, 0x48, 0xae, 0x01, 0x0c, 0x85, 0x0f, 0xf4, 0x02, 0xa9, 0x01,
+  0x0c, 0xb5, 0xff, 0xfe, 0x0f, 0x07, 0xa9, 0x00, 0x43, 0xc1, 0x48, 0x04,
+  0x7f, 0x1a, 0x97, 0xc0, 0xe6, 0x02, 0x64, 0x7f, 0x1a, 0x34, 0xff, 0xfe,
+  0xc0, 0x60, 0x64, 0x00, 0x43, 0xc1, 0x48, 0x1e, 0x7f, 0xe0, 0xb6, 0x02,
+  0x20, 0x02, 0x1f, 0x7f, 0xe0, 0x34, 0xff, 0xfe, 0x02, 0x01, 0x1f, 0x00,
+  0x43, 0x6b, 0x48, 0xfd, 0xd5, 0xd0, 0x61, 0x80, 0x30, 0x02, 0xbd, 0xd5,
+  0xd0, 0xf0, 0xff, 0xfe, 0x80, 0x40, 0xbd, 0x00, 0x43, 0x6b, 0x48, 0x0d,
+  0xd5, 0xa0, 0x33, 0xfe, 0x60, 0x02, 0x72, 0xd5, 0xa0, 0x30, 0xff, 0xfe,
+  0xfe, 0x7f, 0x72, 0x00, 0x43, 0x41, 0x48, 0xd8, 0xff, 0x16, 0x26, 0x81,
+  0xea, 0x02, 0x98, 0xff, 0x16, 0xb5, 0xff, 0xfe, 0x81, 0x40, 0x98, 0x00,
+  0x43, 0x41, 0x48, 0x8b, 0xff, 0xf0, 0xff, 0x31, 0x10, 0x02, 0x93, 0xff,
+  0xf0, 0xfd, 0xff, 0xfe, 0x31, 0x18, 0x93, 0x00, 0x44, 0x30, 0x48, 0x9a,
+  0x8c, 0x3e, 0x41, 0x41, 0xc2, 0x02, 0x9a, 0x8c, 0x3e, 0x71, 0xff, 0xfe,
+  0x41, 0x41, 0x9a, 0x00, 0x44, 0x30, 0x48, 0xbe, 0x15, 0x95, 0x6a, 0x81,
+  0x6b, 0x02, 0xbe, 0x15, 0x95, 0x7a, 0xff, 0xfe, 0x81, 0x81, 0xbe, 0x00,
+  0x44, 0x30, 0x48, 0x7b, 0xa5, 0x91, 0x1a, 0x01, 0x6f, 0x02, 0x7b, 0xa5,
+  0x91, 0x3a, 0xff, 0xfe, 0x01, 0x01, 0x7b, 0x00, 0x44, 0x30, 0x48, 0xdb,
+  0x68, 0x36, 0x24, 0x81, 0xca, 0x02, 0xdb, 0x68, 0x36, 0x34, 0xff, 0xfe,
+  0x81, 0x81, 0xdb, 0x00, 0x45, 0x30, 0x48, 0xe1, 0xc0, 0x04, 0x00, 0xaa,
+  0xfc, 0x02, 0x4b, 0xc0, 0x04, 0x30, 0xff, 0xfe, 0xaa, 0xaa, 0x4b, 0x00,
+  0x45, 0x30, 0x48, 0xd7, 0x88, 0x5c, 0x4b, 0xaa, 0xa4, 0x02, 0x7d, 0x88,
+  0x5c, 0x79, 0xff, 0xfe, 0xaa, 0xaa, 0x7d, 0x00, 0x45, 0x30, 0x48, 0x4f,
+  0x19, 0x1f, 0x37, 0xff, 0xe1, 0x02, 0xb0, 0x19, 0x1f, 0xb5, 0xff, 0xfe,
+  0xff, 0xff, 0xb0, 0x00, 0x45, 0x30, 0x48, 0x68, 0x61, 0xd3, 0x97, 0xb8,
+  0x2d, 0x02, 0xd0, 0x61, 0xd3, 0xb5, 0xff, 0xfe, 0xb8, 0xb8, 0xd0, 0x00,
+  0x45, 0x30, 0x48, 0x19, 0xab, 0x7d, 0x49, 0x02, 0x83, 0x02, 0x1b, 0xab,
+  0x7d, 0x79, 0xff, 0xfe, 0x02, 0x02, 0x1b, 0x00, 0x45, 0x30, 0x48, 0xb0,
+  0x3a, 0x09, 0x86, 0xea, 0xf7, 0x02, 0x5a, 0x3a, 0x09, 0x34, 0xff, 0xfe,
+  0xea, 0xea, 0x5a, 0x00, 0x46, 0x30, 0x48, 0x70, 0xd8, 0x27, 0xfb, 0x3f,
+  0xd9, 0x02, 0x70, 0xd8, 0x27, 0x79, 0xff, 0xfe, 0x1f, 0x3f, 0x70, 0x00,
+  0x46, 0x30, 0x48, 0xbc, 0xba, 0x20, 0x77, 0x41, 0xe0, 0x02, 0xbc, 0xba,
+  0x20, 0x75, 0xff, 0xfe, 0x20, 0x41, 0xbc, 0x00, 0x46, 0x30, 0x48, 0xf5,
+  0x4d, 0x54, 0x4d, 0x02, 0xac, 0x02, 0xf5, 0x4d, 0x54, 0x7c, 0xff, 0xfe,
+  0x01, 0x02, 0xf5, 0x00, 0x46, 0x30, 0x48, 0x41, 0xf1, 0x55, 0x7d, 0x40,
+  0xab, 0x02, 0x41, 0xf1, 0x55, 0x7c, 0xff, 0xfe, 0x20, 0x40, 0x41, 0x00,
+  0x46, 0x30, 0x48, 0xf6, 0x3a, 0x01, 0x96, 0xc0, 0xff, 0x02, 0xf6, 0x3a,
+  0x01, 0x34, 0xff, 0xfe, 0x60, 0xc0, 0xf6, 0x00, 0x46, 0x30, 0x48, 0x55,
+  0x92, 0x78, 0xdd, 0x7f, 0x88, 0x02, 0x55, 0x92, 0x78, 0x7d, 0xff, 0xfe,
+  0x3f, 0x7f, 0x55, 0x00, 0x47, 0x30, 0x48, 0xe0, 0x99, 0x45, 0xfe, 0x41,
+  0xbb, 0x02, 0xc0, 0x99, 0x45, 0xfd, 0xff, 0xfe, 0x20, 0x41, 0xc0, 0x00,
+  0x47, 0x30, 0x48, 0x85, 0x88, 0x94, 0xf4, 0x02, 0x6c, 0x02, 0x84, 0x88,
+  0x94, 0xf4, 0xff, 0xfe, 0x01, 0x02, 0x84, 0x00, 0x47, 0x30, 0x48, 0xac,
+  0x40, 0x77, 0xe4, 0xfe, 0x89, 0x02, 0xd3, 0x40, 0x77, 0xf4, 0xff, 0xfe,
+  0x7f, 0xfe, 0xd3, 0x00, 0x47, 0x30, 0x48, 0x73, 0x61, 0x85, 0x4d, 0x01,
+  0x7b, 0x02, 0x73, 0x61, 0x85, 0x7d, 0xff, 0xfe, 0x00, 0x01, 0x73, 0x00,
+  0x47, 0x30, 0x48, 0x03, 0xe9, 0x59, 0xaa, 0xfe, 0xa7, 0x02, 0x7c, 0xe9,
+  0x59, 0x38, 0xff, 0xfe, 0x7f, 0xfe, 0x7c, 0x00, 0x47, 0x30, 0x48, 0x6e,
+  0xac, 0x02, 0xc6, 0x00, 0xfe, 0x02, 0x6e, 0xac, 0x02, 0x74, 0xff, 0xfe,
+  0x00, 0x00, 0x6e, 0x00, 0x48, 0x48, 0x48, 0xf3, 0xda, 0x0e, 0x1d, 0xaa,
+  0xf2, 0x02, 0xf3, 0xda, 0x0e, 0x3d, 0xff, 0xfc, 0xaa, 0xaa, 0xf3, 0x00,
+  0x48, 0x48, 0x48, 0xa9, 0x87, 0x41, 0x70, 0x81, 0xbf, 0x02, 0xa9, 0x87,
+  0x41, 0x70, 0xff, 0xfc, 0x81, 0x81, 0xa9, 0x00, 0x48, 0x48, 0x48, 0x6f,
+  0xf3, 0xf3, 0x6c, 0x3f, 0x0d, 0x02, 0x6f, 0xf3, 0xf3, 0x7c, 0xff, 0xfc,
+  0x3f, 0x3f, 0x6f, 0x00, 0x48, 0x48, 0x48, 0x3f, 0x99, 0x43, 0x13, 0x41,
+  0xbd, 0x02, 0x3f, 0x99, 0x43, 0x33, 0xff, 0xfc, 0x41, 0x41, 0x3f, 0x00,
+  0x48, 0x48, 0x48, 0x17, 0x20, 0x6a, 0x56, 0x41, 0x96, 0x02, 0x17, 0x20,
+  0x6a, 0x76, 0xff, 0xfc, 0x41, 0x41, 0x17, 0x00, 0x48, 0x48, 0x48, 0x3e,
+  0xd2, 0x9d, 0xbb, 0x41, 0x63, 0x02, 0x3e, 0xd2, 0x9d, 0xbb, 0xff, 0xfc,
+  0x41, 0x41, 0x3e, 0x00, 0x49, 0x00, 0x48, 0x00, 0x7e, 0x5f, 0xfc, 0x10,
+  0x00, 0x03, 0x00, 0x7e, 0x5f, 0x7e, 0xff, 0xfe, 0x10, 0x10, 0x00, 0x00,
+  0x49, 0x0f, 0x48, 0x00, 0x64, 0x03, 0xbd, 0x45, 0x00, 0x03, 0x0f, 0x64,
+  0x03, 0x3d, 0xff, 0xfe, 0x45, 0x45, 0x0f, 0x00, 0x49, 0x40, 0x48, 0x00,
+  0x95, 0x24, 0x24, 0x1f, 0x00, 0x03, 0x40, 0x95, 0x24, 0x34, 0xff, 0xfe,
+  0x1f, 0x1f, 0x40, 0x00, 0x49, 0x80, 0x48, 0x00, 0x40, 0x29, 0x99, 0xac,
+  0x00, 0x03, 0x80, 0x40, 0x29, 0xb9, 0xff, 0xfe, 0xac, 0xac, 0x80, 0x00,
+  0x49, 0xfe, 0x48, 0x00, 0xf9, 0x4f, 0xd4, 0xd3, 0x00, 0x03, 0xfe, 0xf9,
+  0x4f, 0xf4, 0xff, 0xfe, 0xd3, 0xd3, 0xfe, 0x00, 0x49, 0x00, 0x48, 0x01,
+  0xa1, 0xc1, 0x72, 0xb5, 0x00, 0x03, 0x01, 0xa1, 0xc1, 0x70, 0xff, 0xfe,
+  0xb5, 0xb5, 0x01, 0x00, 0x49, 0x0f, 0x48, 0x01, 0xe6, 0x00, 0xca, 0xc9,
+  0x00, 0x03, 0x0e, 0xe6, 0x00, 0x78, 0xff, 0xfe, 0xc9, 0xc9, 0x0e, 0x00,
+  0x49, 0x40, 0x48, 0x01, 0x0d, 0x33, 0x29, 0x5e, 0x00, 0x03, 0x41, 0x0d,
+  0x33, 0x39, 0xff, 0xfe, 0x5e, 0x5e, 0x41, 0x00, 0x49, 0x80, 0x48, 0x01,
+  0xfc, 0xb7, 0x44, 0x43, 0x00, 0x03, 0x81, 0xfc, 0xb7, 0xf4, 0xff, 0xfe,
+  0x43, 0x43, 0x81, 0x00, 0x49, 0xfe, 0x48, 0x01, 0xfe, 0xae, 0xa9, 0x88,
+  0x00, 0x03, 0xff, 0xfe, 0xae, 0xb9, 0xff, 0xfe, 0x88, 0x88, 0xff, 0x00,
+  0x49, 0x00, 0x48, 0x0f, 0x0a, 0x95, 0x22, 0xe4, 0x00, 0x03, 0x0f, 0x0a,
+  0x95, 0x30, 0xff, 0xfe, 0xe4, 0xe4, 0x0f, 0x00, 0x49, 0x0f, 0x48, 0x0f,
+  0x16, 0xa9, 0x0b, 0x2a, 0x00, 0x03, 0x00, 0x16, 0xa9, 0x3b, 0xff, 0xfe,
+  0x2a, 0x2a, 0x00, 0x00, 0x49, 0x40, 0x48, 0x0f, 0xba, 0xf3, 0x9c, 0x42,
+  0x00, 0x03, 0x4f, 0xba, 0xf3, 0x3c, 0xff, 0xfe, 0x42, 0x42, 0x4f, 0x00,
+  0x49, 0x80, 0x48, 0x0f, 0x1a, 0x2f, 0xa6, 0x6a, 0x00, 0x03, 0x8f, 0x1a,
+  0x2f, 0xb4, 0xff, 0xfe, 0x6a, 0x6a, 0x8f, 0x00, 0x49, 0xfe, 0x48, 0x0f,
+  0x8a, 0x8f, 0xf7, 0x80, 0x00, 0x03, 0xf1, 0x8a, 0x8f, 0xf5, 0xff, 0xfe,
+  0x80, 0x80, 0xf1, 0x00, 0x49, 0x00, 0x48, 0x3f, 0xdc, 0x3e, 0xcd, 0x19,
+  0x00, 0x03, 0x3f, 0xdc, 0x3e, 0x7d, 0xff, 0xfe, 0x19, 0x19, 0x3f, 0x00,
+  0x49, 0x0f, 0x48, 0x3f, 0x20, 0x9f, 0x4e, 0xed, 0x00, 0x03, 0x30, 0x20,
+  0x9f, 0x7c, 0xff, 0xfe, 0xed, 0xed, 0x30, 0x00, 0x49, 0x40, 0x48, 0x3f,
+  0xaf, 0xb9, 0x33, 0x92, 0x00, 0x03, 0x7f, 0xaf, 0xb9, 0x31, 0xff, 0xfe,
+  0x92, 0x92, 0x7f, 0x00, 0x49, 0x80, 0x48, 0x3f, 0x97, 0x34, 0x1b, 0x79,
+  0x00, 0x03, 0xbf, 0x97, 0x34, 0xb9, 0xff, 0xfe, 0x79, 0x79, 0xbf, 0x00,
+  0x49, 0xfe, 0x48, 0x3f, 0x5c, 0xdb, 0x55, 0x9a, 0x00, 0x03, 0xc1, 0x5c,
+  0xdb, 0xf5, 0xff, 0xfe, 0x9a, 0x9a, 0xc1, 0x00, 0x49, 0x00, 0x48, 0x40,
+  0x43, 0x79, 0xc3, 0x56, 0x00, 0x03, 0x40, 0x43, 0x79, 0x71, 0xff, 0xfe,
+  0x56, 0x56, 0x40, 0x00, 0x49, 0x0f, 0x48, 0x40, 0xe4, 0x16, 0x41, 0x9e,
+  0x00, 0x03, 0x4f, 0xe4, 0x16, 0x71, 0xff, 0xfe, 0x9e, 0x9e, 0x4f, 0x00,
+  0x49, 0x40, 0x48, 0x40, 0x87, 0x72, 0xa8, 0x48, 0x00, 0x03, 0x00, 0x87,
+  0x72, 0x3a, 0xff, 0xfe, 0x48, 0x48, 0x00, 0x00, 0x49, 0x80, 0x48, 0x40,
+  0xe2, 0xbb, 0xfa, 0x23, 0x00, 0x03, 0xc0, 0xe2, 0xbb, 0xf8, 0xff, 0xfe,
+  0x23, 0x23, 0xc0, 0x00, 0x49, 0xfe, 0x48, 0x40, 0xa6, 0xba, 0x51, 0xa5,
+  0x00, 0x03, 0xbe, 0xa6, 0xba, 0xf1, 0xff, 0xfe, 0xa5, 0xa5, 0xbe, 0x00,
+  0x49, 0x00, 0x48, 0x7f, 0xd7, 0xde, 0x65, 0xb6, 0x00, 0x03, 0x7f, 0xd7,
+  0xde, 0x75, 0xff, 0xfe, 0xb6, 0xb6, 0x7f, 0x00, 0x49, 0x0f, 0x48, 0x7f,
+  0xaf, 0xb8, 0x45, 0x82, 0x00, 0x03, 0x70, 0xaf, 0xb8, 0x75, 0xff, 0xfe,
+  0x82, 0x82, 0x70, 0x00, 0x49, 0x40, 0x48, 0x7f, 0x4a, 0x70, 0x59, 0xc8,
+  0x00, 0x03, 0x3f, 0x4a, 0x70, 0x79, 0xff, 0xfe, 0xc8, 0xc8, 0x3f, 0x00,
+  0x49, 0x80, 0x48, 0x7f, 0x93, 0xdd, 0x1e, 0xe4, 0x00, 0x03, 0xff, 0x93,
+  0xdd, 0xbc, 0xff, 0xfe, 0xe4, 0xe4, 0xff, 0x00, 0x49, 0xfe, 0x48, 0x7f,
+  0xaa, 0xc1, 0x0f, 0xbc, 0x00, 0x03, 0x81, 0xaa, 0xc1, 0xbd, 0xff, 0xfe,
+  0xbc, 0xbc, 0x81, 0x00, 0x49, 0x00, 0x48, 0x80, 0x33, 0xa5, 0xdd, 0x46,
+  0x00, 0x03, 0x80, 0x33, 0xa5, 0xfd, 0xff, 0xfe, 0x46, 0x46, 0x80, 0x00,
+  0x49, 0x0f, 0x48, 0x80, 0x73, 0xb1, 0xb6, 0xbc, 0x00, 0x03, 0x8f, 0x73,
+  0xb1, 0xb4, 0xff, 0xfe, 0xbc, 0xbc, 0x8f, 0x00, 0x49, 0x40, 0x48, 0x80,
+  0xf0, 0xb1, 0xf5, 0x67, 0x00, 0x03, 0xc0, 0xf0, 0xb1, 0xf5, 0xff, 0xfe,
+  0x67, 0x67, 0xc0, 0x00, 0x49, 0x80, 0x48, 0x80, 0x1b, 0x04, 0x6d, 0x3c,
+  0x00, 0x03, 0x00, 0x1b, 0x04, 0x7f, 0xff, 0xfe, 0x3c, 0x3c, 0x00, 0x00,
+  0x49, 0xfe, 0x48, 0x80, 0x93, 0xc1, 0xc9, 0x63, 0x00, 0x03, 0x7e, 0x93,
+  0xc1, 0x79, 0xff, 0xfe, 0x63, 0x63, 0x7e, 0x00, 0x49, 0x00, 0x48, 0x81,
+  0xcf, 0x90, 0x1c, 0x8a, 0x00, 0x03, 0x81, 0xcf, 0x90, 0xbc, 0xff, 0xfe,
+  0x8a, 0x8a, 0x81, 0x00, 0x49, 0x0f, 0x48, 0x81, 0xc4, 0x2b, 0xaa, 0xeb,
+  0x00, 0x03, 0x8e, 0xc4, 0x2b, 0xb8, 0xff, 0xfe, 0xeb, 0xeb, 0x8e, 0x00,
+  0x49, 0x40, 0x48, 0x81, 0x4f, 0x23, 0x92, 0x61, 0x00, 0x03, 0xc1, 0x4f,
+  0x23, 0xb0, 0xff, 0xfe, 0x61, 0x61, 0xc1, 0x00, 0x49, 0x80, 0x48, 0x81,
+  0x29, 0xab, 0x2b, 0x40, 0x00, 0x03, 0x01, 0x29, 0xab, 0x39, 0xff, 0xfe,
+  0x40, 0x40, 0x01, 0x00, 0x49, 0xfe, 0x48, 0x81, 0xb4, 0x8b, 0x77, 0x98,
+  0x00, 0x03, 0x7f, 0xb4, 0x8b, 0x75, 0xff, 0xfe, 0x98, 0x98, 0x7f, 0x00,
+  0x49, 0x00, 0x48, 0xfe, 0xca, 0xc1, 0x5f, 0x06, 0x00, 0x03, 0xfe, 0xca,
+  0xc1, 0xfd, 0xff, 0xfe, 0x06, 0x06, 0xfe, 0x00, 0x49, 0x0f, 0x48, 0xfe,
+  0x10, 0xb2, 0x0e, 0xa6, 0x00, 0x03, 0xf1, 0x10, 0xb2, 0xbc, 0xff, 0xfe,
+  0xa6, 0xa6, 0xf1, 0x00, 0x49, 0x40, 0x48, 0xfe, 0x2a, 0xac, 0xe2, 0x02,
+  0x00, 0x03, 0xbe, 0x2a, 0xac, 0xf0, 0xff, 0xfe, 0x02, 0x02, 0xbe, 0x00,
+  0x49, 0x80, 0x48, 0xfe, 0x81, 0xb2, 0xc4, 0x47, 0x00, 0x03, 0x7e, 0x81,
+  0xb2, 0x74, 0xff, 0xfe, 0x47, 0x47, 0x7e, 0x00, 0x49, 0xfe, 0x48, 0xfe,
+  0xf4, 0x68, 0x07, 0xc0, 0x00, 0x03, 0x00, 0xf4, 0x68, 0x37, 0xff, 0xfe,
+  0xc0, 0xc0, 0x00, 0x00, 0x49, 0x00, 0x48, 0xff, 0x46, 0xb7, 0x5e, 0x69,
+  0x00, 0x03, 0xff, 0x46, 0xb7, 0xfc, 0xff, 0xfe, 0x69, 0x69, 0xff, 0x00,
+  0x49, 0x0f, 0x48, 0xff, 0xd0, 0xf9, 0x43, 0x4c, 0x00, 0x03, 0xf0, 0xd0,
+  0xf9, 0xf1, 0xff, 0xfe, 0x4c, 0x4c, 0xf0, 0x00, 0x49, 0x40, 0x48, 0xff,
+  0x5c, 0x1a, 0x29, 0x85, 0x00, 0x03, 0xbf, 0x5c, 0x1a, 0xb9, 0xff, 0xfe,
+  0x85, 0x85, 0xbf, 0x00, 0x49, 0x80, 0x48, 0xff, 0xa2, 0x47, 0x5c, 0x99,
+  0x00, 0x03, 0x7f, 0xa2, 0x47, 0x7c, 0xff, 0xfe, 0x99, 0x99, 0x7f, 0x00,
+  0x49, 0xfe, 0x48, 0xff, 0x8a, 0xdd, 0x07, 0xfa, 0x00, 0x03, 0x01, 0x8a,
+  0xdd, 0x35, 0xff, 0xfe, 0xfa, 0xfa, 0x01, 0x00, 0x4a, 0x48, 0x48, 0x83,
+  0x5f, 0xae, 0x63, 0xa6, 0x52, 0x02, 0x41, 0x5f, 0xae, 0x71, 0xff, 0xfd,
+  0xa6, 0xa6, 0x41, 0x00, 0x4a, 0x48, 0x48, 0x81, 0x2d, 0x08, 0xc6, 0x0f,
+  0xf8, 0x02, 0x40, 0x2d, 0x08, 0x75, 0xff, 0xfd, 0x0f, 0x0f, 0x40, 0x00,
+  0x4a, 0x48, 0x48, 0xdf, 0xdd, 0x5e, 0xf3, 0x01, 0xa2, 0x02, 0x6f, 0xdd,
+  0x5e, 0x71, 0xff, 0xfd, 0x01, 0x01, 0x6f, 0x00, 0x4a, 0x48, 0x48, 0x42,
+  0x08, 0x1d, 0x02, 0x3f, 0xe3, 0x02, 0x21, 0x08, 0x1d, 0x30, 0xff, 0xfd,
+  0x3f, 0x3f, 0x21, 0x00, 0x4a, 0x48, 0x48, 0xc1, 0x62, 0x6f, 0x94, 0x80,
+  0x91, 0x02, 0x60, 0x62, 0x6f, 0x35, 0xff, 0xfd, 0x80, 0x80, 0x60, 0x00,
+  0x4a, 0x48, 0x48, 0x01, 0x66, 0x95, 0x12, 0x0f, 0x6b, 0x02, 0x00, 0x66,
+  0x95, 0x33, 0xff, 0xfd, 0x0f, 0x0f, 0x00, 0x00, 0x4c, 0x00, 0x06, 0x08,
+  0x9d, 0xce, 0x4a, 0xa3, 0x00, 0x03, 0x08, 0x9e, 0xce, 0xf8, 0xff, 0xff,
+  0xa3, 0xa3, 0xf8, 0x00, 0x4c, 0x00, 0x06, 0x62, 0x5d, 0xb9, 0x3f, 0x48,
+  0x00, 0x03, 0x62, 0x5e, 0xb9, 0x3d, 0xff, 0xff, 0x48, 0x48, 0x3d, 0x00,
+  0x4c, 0x00, 0x06, 0x6b, 0xa6, 0x43, 0x69, 0x0a, 0x00, 0x03, 0x6b, 0xa7,
+  0x43, 0xf9, 0xff, 0xff, 0x0a, 0x0a, 0xf9, 0x00, 0x4c, 0x00, 0x06, 0x2c,
+  0xb0, 0x9f, 0x7a, 0x3f, 0x00, 0x03, 0x2c, 0xb1, 0x9f, 0xf8, 0xff, 0xff,
+  0x3f, 0x3f, 0xf8, 0x00, 0x4d, 0x00, 0x03, 0x1f, 0x54, 0xc4, 0x7c, 0x00,
+  0x3c, 0x02, 0x1f, 0x54, 0xc4, 0x7c, 0xff, 0xff, 0x00, 0x00, 0x7c, 0x00,
+  0x4d, 0x00, 0x03, 0xcb, 0x1d, 0x70, 0x3e, 0x81, 0x90, 0x02, 0x4a, 0x1d,
+  0x70, 0x3c, 0xff, 0xff, 0x81, 0x81, 0x3c, 0x00, 0x4d, 0x00, 0x03, 0x10,
+  0x8d, 0x64, 0x32, 0xc0, 0x9c, 0x02, 0xd0, 0x8d, 0x64, 0xb0, 0xff, 0xff,
+  0xc0, 0xc0, 0xb0, 0x00, 0x4d, 0x00, 0x03, 0x41, 0xeb, 0x45, 0xcc, 0x41,
+  0xbb, 0x02, 0x00, 0xeb, 0x45, 0x7e, 0xff, 0xff, 0x41, 0x41, 0x7e, 0x00,
+  0x4d, 0x00, 0x03, 0xee, 0x36, 0xdd, 0x8d, 0xc0, 0x23, 0x02, 0x2e, 0x36,
+  0xdd, 0x3d, 0xff, 0xff, 0xc0, 0xc0, 0x3d, 0x00, 0x4d, 0x00, 0x03, 0xb2,
+  0x10, 0x7a, 0xfd, 0x0f, 0x86, 0x02, 0xbd, 0x10, 0x7a, 0xfd, 0xff, 0xff,
+  0x0f, 0x0f, 0xfd, 0x00, 0x4e, 0x00, 0x03, 0x7c, 0x0a, 0x7f, 0x42, 0xaa,
+  0x81, 0x02, 0x7c, 0x0a, 0x7f, 0x70, 0xff, 0xff, 0xaa, 0x55, 0x70, 0x00,
+  0x4e, 0x00, 0x03, 0x51, 0x5d, 0xbe, 0xc8, 0x01, 0x42, 0x02, 0x51, 0x5d,
+  0xbe, 0x7b, 0xff, 0xff, 0x01, 0x00, 0x7b, 0x00, 0x4e, 0x00, 0x03, 0x31,
+  0x26, 0x37, 0x13, 0x81, 0xc9, 0x02, 0x31, 0x26, 0x37, 0x31, 0xff, 0xff,
+  0x81, 0x40, 0x31, 0x00, 0x4e, 0x00, 0x03, 0x17, 0x07, 0x9f, 0xc2, 0x0f,
+  0x61, 0x02, 0x17, 0x07, 0x9f, 0x71, 0xff, 0xff, 0x0f, 0x07, 0x71, 0x00,
+  0x4e, 0x00, 0x03, 0x5c, 0x6b, 0xb6, 0xef, 0x80, 0x4a, 0x02, 0x5c, 0x6b,
+  0xb6, 0x7c, 0xff, 0xff, 0x80, 0x40, 0x7c, 0x00, 0x4e, 0x00, 0x03, 0x07,
+  0xef, 0xaa, 0xcb, 0x02, 0x56, 0x02, 0x07, 0xef, 0xaa, 0x78, 0xff, 0xff,
+  0x02, 0x01, 0x78, 0x00, 0x4f, 0x00, 0x03, 0xd6, 0xb1, 0x53, 0x2c, 0x3f,
+  0xad, 0x02, 0xc9, 0xb1, 0x53, 0xbd, 0xff, 0xff, 0x3f, 0x1f, 0xbd, 0x00,
+  0x4f, 0x00, 0x03, 0xcb, 0x3d, 0xdf, 0x1b, 0x3f, 0x21, 0x02, 0xd4, 0x3d,
+  0xdf, 0xb9, 0xff, 0xff, 0x3f, 0x1f, 0xb9, 0x00, 0x4f, 0x00, 0x03, 0xf9,
+  0x73, 0x83, 0x8b, 0x01, 0x7d, 0x02, 0xf9, 0x73, 0x83, 0xb9, 0xff, 0xff,
+  0x01, 0x00, 0xb9, 0x00, 0x4f, 0x00, 0x03, 0xe0, 0x9a, 0x16, 0xee, 0x7f,
+  0xea, 0x02, 0xdf, 0x9a, 0x16, 0xfd, 0xff, 0xff, 0x7f, 0x3f, 0xfd, 0x00,
+  0x4f, 0x00, 0x03, 0x4e, 0x00, 0x4b, 0x01, 0xff, 0xb5, 0x02, 0x31, 0x00,
+  0x4b, 0x31, 0xff, 0xff, 0xff, 0x7f, 0x31, 0x00, 0x4f, 0x00, 0x03, 0x5c,
+  0xe8, 0x79, 0x5e, 0x7f, 0x87, 0x02, 0x63, 0xe8, 0x79, 0x7d, 0xff, 0xff,
+  0x7f, 0x3f, 0x7d, 0x00, 0x50, 0x01, 0x48, 0x28, 0x60, 0x0a, 0x48, 0x48,
+  0x00, 0x03, 0x28, 0x60, 0x0a, 0x78, 0xff, 0xfe, 0x48, 0x48, 0x28, 0x00,
+  0x50, 0x01, 0x48, 0x0e, 0x19, 0x39, 0xf0, 0xc9, 0x00, 0x03, 0x0e, 0x19,
+  0x39, 0xf0, 0xff, 0xfe, 0xc9, 0xc9, 0x0e, 0x00, 0x50, 0x01, 0x48, 0x62,
+  0xeb, 0x3b, 0x5b, 0x24, 0x00, 0x03, 0x62, 0xeb, 0x3b, 0x7b, 0xff, 0xfe,
+  0x24, 0x24, 0x62, 0x00, 0x50, 0x01, 0x48, 0xb1, 0x08, 0xb9, 0x94, 0xba,
+  0x00, 0x03, 0xb1, 0x08, 0xb9, 0xb4, 0xff, 0xff, 0xba, 0xba, 0xb4, 0x00,
+  0x50, 0x01, 0x48, 0xc9, 0x65, 0xe6, 0x68, 0x66, 0x00, 0x03, 0xc9, 0x65,
+  0xe6, 0x78, 0xff, 0xfe, 0x66, 0x66, 0xc9, 0x00, 0x50, 0x01, 0x48, 0xa4,
+  0x43, 0x08, 0x14, 0x13, 0x00, 0x03, 0xa4, 0x43, 0x08, 0x34, 0xff, 0xff,
+  0x13, 0x13, 0x34, 0x00, 0x50, 0x01, 0x48, 0x5f, 0x34, 0xb8, 0x81, 0x01,
+  0x00, 0x03, 0x5f, 0x34, 0xb8, 0xb1, 0xff, 0xff, 0x01, 0x01, 0xb1, 0x00,
+  0x50, 0x01, 0x48, 0x54, 0x29, 0x09, 0x8d, 0x68, 0x00, 0x03, 0x54, 0x29,
+  0x09, 0xbd, 0xff, 0xff, 0x68, 0x68, 0xbd, 0x00, 0x50, 0x01, 0x48, 0xa4,
+  0x6e, 0x8c, 0xd8, 0x76, 0x00, 0x03, 0xa4, 0x6e, 0x8c, 0xf8, 0xff, 0xfe,
+  0x76, 0x76, 0xa4, 0x00, 0x50, 0x01, 0x48, 0xff, 0x46, 0xad, 0x98, 0xf9,
+  0x00, 0x03, 0xff, 0x46, 0xad, 0xb8, 0xff, 0xff, 0xf9, 0xf9, 0xb8, 0x00,
+  0x50, 0x01, 0x48, 0xf2, 0xbd, 0x24, 0x2f, 0xda, 0x00, 0x03, 0xf2, 0xbd,
+  0x24, 0x3f, 0xff, 0xff, 0xda, 0xda, 0x3f, 0x00, 0x50, 0x01, 0x48, 0x2b,
+  0x2a, 0x80, 0x24, 0x29, 0x00, 0x03, 0x2b, 0x2a, 0x80, 0x34, 0xff, 0xff,
+  0x29, 0x29, 0x34, 0x00, 0x50, 0x01, 0x48, 0x3f, 0x7a, 0x90, 0x74, 0xb0,
+  0x00, 0x03, 0x3f, 0x7a, 0x90, 0x74, 0xff, 0xfe, 0xb0, 0xb0, 0x3f, 0x00,
+  0x50, 0x01, 0x48, 0x8c, 0xeb, 0xd1, 0xa4, 0x2c, 0x00, 0x03, 0x8c, 0xeb,
+  0xd1, 0xb4, 0xff, 0xff, 0x2c, 0x2c, 0xb4, 0x00, 0x50, 0x01, 0x48, 0xb2,
+  0x18, 0xea, 0x98, 0xae, 0x00, 0x03, 0xb2, 0x18, 0xea, 0xb8, 0xff, 0xff,
+  0xae, 0xae, 0xb8, 0x00, 0x50, 0x01, 0x48, 0x13, 0xf5, 0x3a, 0xc2, 0x82,
+  0x00, 0x03, 0x13, 0xf5, 0x3a, 0xf2, 0xff, 0xfe, 0x82, 0x82, 0x13, 0x00,
+  0x50, 0x01, 0x48, 0x37, 0xa4, 0x8f, 0x6a, 0x39, 0x00, 0x03, 0x37, 0xa4,
+  0x8f, 0x7a, 0xff, 0xfe, 0x39, 0x39, 0x37, 0x00, 0x50, 0x01, 0x48, 0x6c,
+  0xe7, 0x16, 0x8d, 0x16, 0x00, 0x03, 0x6c, 0xe7, 0x16, 0xbd, 0xff, 0xff,
+  0x16, 0x16, 0xbd, 0x00, 0x50, 0x01, 0x48, 0x1e, 0xed, 0x9b, 0xce, 0xee,
+  0x00, 0x03, 0x1e, 0xed, 0x9b, 0xfe, 0xff, 0xfe, 0xee, 0xee, 0x1e, 0x00,
+  0x50, 0x01, 0x48, 0xa9, 0x5e, 0xb2, 0x4f, 0xa3, 0x00, 0x03, 0xa9, 0x5e,
+  0xb2, 0x7f, 0xff, 0xfe, 0xa3, 0xa3, 0xa9, 0x00, 0x50, 0x00, 0x48, 0xaf,
+  0x6b, 0x88, 0x55, 0xf7, 0x00, 0x03, 0xaf, 0x6b, 0x88, 0x75, 0xff, 0xfe,
+  0xf7, 0xf7, 0xaf, 0x00, 0x50, 0x00, 0x48, 0x89, 0xf7, 0xb5, 0xa1, 0x15,
+  0x00, 0x03, 0x89, 0xf7, 0xb5, 0xb1, 0xff, 0xfe, 0x15, 0x15, 0x89, 0x00,
+  0x50, 0x00, 0x48, 0x78, 0xac, 0xef, 0x93, 0x9a, 0x00, 0x03, 0x78, 0xac,
+  0xef, 0xb3, 0xff, 0xfe, 0x9a, 0x9a, 0x78, 0x00, 0x50, 0x00, 0x48, 0x9a,
+  0x96, 0x7c, 0xd1, 0xf1, 0x00, 0x03, 0x9a, 0x96, 0x7c, 0xf1, 0xff, 0xfe,
+  0xf1, 0xf1, 0x9a, 0x00, 0x51, 0x42, 0x48, 0x4a, 0x12, 0x00, 0xf3, 0x01,
+  0x00, 0x03, 0x4b, 0x12, 0x00, 0x71, 0xff, 0xfe, 0x01, 0x01, 0x4b, 0x00,
+  0x51, 0x42, 0x48, 0xeb, 0xc6, 0x00, 0xfa, 0x0f, 0x00, 0x03, 0xe4, 0xc6,
+  0x00, 0xf8, 0xff, 0xfe, 0x0f, 0x0f, 0xe4, 0x00, 0x51, 0x42, 0x48, 0x42,
+  0xf3, 0x01, 0x46, 0x80, 0xff, 0x02, 0xc2, 0xf3, 0x01, 0xf4, 0xff, 0xfe,
+  0x80, 0x80, 0xc2, 0x00, 0x51, 0x42, 0x48, 0xc2, 0x8e, 0x01, 0x95, 0xfe,
+  0xff, 0x02, 0x3c, 0x8e, 0x01, 0x35, 0xff, 0xfe, 0xfe, 0xfe, 0x3c, 0x00,
+  0x51, 0x42, 0x48, 0x11, 0x30, 0x7f, 0x20, 0x41, 0x81, 0x02, 0x50, 0x30,
+  0x7f, 0x30, 0xff, 0xfe, 0x41, 0x41, 0x50, 0x00, 0x51, 0x42, 0x48, 0xc3,
+  0x7b, 0x7f, 0x0f, 0x01, 0x81, 0x02, 0xc2, 0x7b, 0x7f, 0xbd, 0xff, 0xfe,
+  0x01, 0x01, 0xc2, 0x00, 0x51, 0x42, 0x48, 0x1a, 0xca, 0xd5, 0x49, 0x3f,
+  0x2b, 0x02, 0x25, 0xca, 0xd5, 0x79, 0xff, 0xfe, 0x3f, 0x3f, 0x25, 0x00,
+  0x51, 0x42, 0x48, 0xc9, 0x17, 0xd5, 0x81, 0x7f, 0x2b, 0x02, 0xb6, 0x17,
+  0xd5, 0xb1, 0xff, 0xfe, 0x7f, 0x7f, 0xb6, 0x00, 0x51, 0x42, 0x48, 0xcb,
+  0x17, 0xff, 0xa3, 0x40, 0x01, 0x02, 0x8b, 0x17, 0xff, 0xb1, 0xff, 0xfe,
+  0x40, 0x40, 0x8b, 0x00, 0x51, 0x42, 0x48, 0xbb, 0x5a, 0xff, 0x2d, 0x81,
+  0x01, 0x02, 0x3a, 0x5a, 0xff, 0x3d, 0xff, 0xfe, 0x81, 0x81, 0x3a, 0x00,
+  0x53, 0x42, 0x48, 0x05, 0x84, 0x00, 0x54, 0x00, 0x00, 0x03, 0x05, 0x84,
+  0x00, 0x74, 0xff, 0xfe, 0x00, 0x00, 0x05, 0x00, 0x53, 0x42, 0x48, 0x13,
+  0x56, 0x00, 0xcd, 0x3f, 0x00, 0x03, 0x0c, 0x56, 0x00, 0x7d, 0xff, 0xfe,
+  0x3f, 0x1f, 0x0c, 0x00, 0x53, 0x42, 0x48, 0x85, 0x81, 0x01, 0xa5, 0x40,
+  0xff, 0x02, 0xa5, 0x81, 0x01, 0xb4, 0xff, 0xfe, 0x40, 0x20, 0xa5, 0x00,
+  0x53, 0x42, 0x48, 0x38, 0x7c, 0x01, 0x9c, 0xaa, 0xff, 0x02, 0x6d, 0x7c,
+  0x01, 0x3c, 0xff, 0xfe, 0xaa, 0x55, 0x6d, 0x00, 0x53, 0x42, 0x48, 0xd4,
+  0xa9, 0x7f, 0x74, 0xaa, 0x81, 0x02, 0x81, 0xa9, 0x7f, 0xf4, 0xff, 0xfe,
+  0xaa, 0x55, 0x81, 0x00, 0x53, 0x42, 0x48, 0x35, 0x33, 0x7f, 0x40, 0x02,
+  0x81, 0x02, 0x34, 0x33, 0x7f, 0x70, 0xff, 0xfe, 0x02, 0x01, 0x34, 0x00,
+  0x53, 0x42, 0x48, 0x8b, 0x49, 0xd5, 0x0c, 0xc0, 0x2b, 0x02, 0xeb, 0x49,
+  0xd5, 0xbc, 0xff, 0xfe, 0xc0, 0x60, 0xeb, 0x00, 0x53, 0x42, 0x48, 0x7a,
+  0x04, 0xd5, 0x1c, 0xfe, 0x2b, 0x02, 0x05, 0x04, 0xd5, 0x3c, 0xff, 0xfe,
+  0xfe, 0x7f, 0x05, 0x00, 0x53, 0x42, 0x48, 0xdf, 0xe7, 0xff, 0xd0, 0x02,
+  0x01, 0x02, 0xde, 0xe7, 0xff, 0xf0, 0xff, 0xfe, 0x02, 0x01, 0xde, 0x00,
+  0x53, 0x42, 0x48, 0xdc, 0xc4, 0xff, 0xb5, 0x7f, 0x01, 0x02, 0xe3, 0xc4,
+  0xff, 0xb5, 0xff, 0xfe, 0x7f, 0x3f, 0xe3, 0x00, 0x54, 0x30, 0x48, 0x39,
+  0x00, 0xe9, 0x86, 0xaa, 0x17, 0x02, 0x39, 0x00, 0xe9, 0xb6, 0xff, 0xfe,
+  0xaa, 0xaa, 0x39, 0x00, 0x54, 0x30, 0x48, 0xcc, 0x00, 0x2a, 0x29, 0x00,
+  0xd6, 0x02, 0xcc, 0x00, 0x2a, 0x39, 0xff, 0xfe, 0x00, 0x00, 0xcc, 0x00,
+  0x54, 0x2f, 0x48, 0xac, 0x01, 0x8c, 0x8e, 0x00, 0x74, 0x02, 0xac, 0x01,
+  0x8c, 0xbe, 0xff, 0xfe, 0x00, 0x00, 0xac, 0x00, 0x54, 0x2f, 0x48, 0xad,
+  0x01, 0x50, 0x7f, 0x80, 0xb0, 0x02, 0xad, 0x01, 0x50, 0x7f, 0xff, 0xfe,
+  0x80, 0x80, 0xad, 0x00, 0x54, 0xb1, 0x48, 0x87, 0x7f, 0xeb, 0x67, 0xfe,
+  0x15, 0x02, 0x87, 0x7f, 0xeb, 0x77, 0xff, 0xfe, 0xfe, 0xfe, 0x87, 0x00,
+  0x54, 0xb1, 0x48, 0x38, 0x7f, 0x85, 0x78, 0x02, 0x7b, 0x02, 0x38, 0x7f,
+  0x85, 0x78, 0xff, 0xfe, 0x02, 0x02, 0x38, 0x00, 0x54, 0x5b, 0x48, 0xfc,
+  0xd5, 0x3c, 0x1c, 0x0f, 0xc4, 0x02, 0xfc, 0xd5, 0x3c, 0x3c, 0xff, 0xfe,
+  0x0f, 0x0f, 0xfc, 0x00, 0x54, 0x5b, 0x48, 0x65, 0xd5, 0xd8, 0xb7, 0x81,
+  0x28, 0x02, 0x65, 0xd5, 0xd8, 0xb7, 0xff, 0xfe, 0x81, 0x81, 0x65, 0x00,
+  0x54, 0x31, 0x48, 0xb8, 0xff, 0xa4, 0x2d, 0xaa, 0x5c, 0x02, 0xb8, 0xff,
+  0xa4, 0x3d, 0xff, 0xfe, 0xaa, 0xaa, 0xb8, 0x00, 0x54, 0x31, 0x48, 0xcd,
+  0xff, 0xc7, 0xb1, 0x81, 0x39, 0x02, 0xcd, 0xff, 0xc7, 0xb1, 0xff, 0xfe,
+  0x81, 0x81, 0xcd, 0x00, 0x55, 0x30, 0x48, 0x89, 0x00, 0x79, 0xcb, 0x3f,
+  0x87, 0x02, 0xb6, 0x00, 0x79, 0xf9, 0xff, 0xfe, 0x3f, 0x3f, 0xb6, 0x00,
+  0x55, 0x30, 0x48, 0x3e, 0x00, 0xaf, 0xe3, 0x41, 0x51, 0x02, 0x7f, 0x00,
+  0xaf, 0x71, 0xff, 0xfe, 0x41, 0x41, 0x7f, 0x00, 0x55, 0x2f, 0x48, 0x52,
+  0x01, 0xe6, 0xf5, 0xfe, 0x1a, 0x02, 0xac, 0x01, 0xe6, 0xf5, 0xff, 0xfe,
+  0xfe, 0xfe, 0xac, 0x00, 0x55, 0x2f, 0x48, 0x93, 0x01, 0x8f, 0x6d, 0x41,
+  0x71, 0x02, 0xd2, 0x01, 0x8f, 0xfd, 0xff, 0xfe, 0x41, 0x41, 0xd2, 0x00,
+  0x55, 0xb1, 0x48, 0x4e, 0x7f, 0xc3, 0x79, 0x80, 0x3d, 0x02, 0xce, 0x7f,
+  0xc3, 0xf9, 0xff, 0xfe, 0x80, 0x80, 0xce, 0x00, 0x55, 0xb1, 0x48, 0xea,
+  0x7f, 0xc3, 0x51, 0x00, 0x3d, 0x02, 0xea, 0x7f, 0xc3, 0xf1, 0xff, 0xfe,
+  0x00, 0x00, 0xea, 0x00, 0x55, 0x5b, 0x48, 0x00, 0xd5, 0x6b, 0x0a, 0x7f,
+  0x95, 0x02, 0x7f, 0xd5, 0x6b, 0x38, 0xff, 0xfe, 0x7f, 0x7f, 0x7f, 0x00,
+  0x55, 0x5b, 0x48, 0xed, 0xd5, 0x77, 0xf8, 0x8f, 0x89, 0x02, 0x62, 0xd5,
+  0x77, 0x78, 0xff, 0xfe, 0x8f, 0x8f, 0x62, 0x00, 0x55, 0x31, 0x48, 0x09,
+  0xff, 0x94, 0x38, 0xbe, 0x6c, 0x02, 0xb7, 0xff, 0x94, 0xb8, 0xff, 0xfe,
+  0xbe, 0xbe, 0xb7, 0x00, 0x55, 0x31, 0x48, 0x36, 0xff, 0xd8, 0x60, 0xaa,
+  0x28, 0x02, 0x9c, 0xff, 0xd8, 0xf0, 0xff, 0xfe, 0xaa, 0xaa, 0x9c, 0x00,
+  0x56, 0x30, 0x48, 0x83, 0x00, 0xd3, 0x38, 0x0f, 0x2d, 0x02, 0x83, 0x00,
+  0xd3, 0x39, 0xff, 0xfe, 0x07, 0x0f, 0x83, 0x00, 0x56, 0x30, 0x48, 0xd8,
+  0x00, 0xaa, 0xa6, 0x80, 0x56, 0x02, 0xd8, 0x00, 0xaa, 0x34, 0xff, 0xfe,
+  0x40, 0x80, 0xd8, 0x00, 0x56, 0x2f, 0x48, 0x82, 0x01, 0xba, 0x2a, 0x5c,
+  0x46, 0x02, 0x82, 0x01, 0xba, 0x38, 0xff, 0xfe, 0x2e, 0x5c, 0x82, 0x00,
+  0x56, 0x2f, 0x48, 0x59, 0x01, 0x1b, 0xbf, 0xfe, 0xe5, 0x02, 0x59, 0x01,
+  0x1b, 0x3c, 0xff, 0xfe, 0x7f, 0xfe, 0x59, 0x00, 0x56, 0xb1, 0x48, 0x03,
+  0x7f, 0x60, 0xb7, 0x41, 0xa0, 0x02, 0x03, 0x7f, 0x60, 0x35, 0xff, 0xfe,
+  0x20, 0x41, 0x03, 0x00, 0x56, 0xb1, 0x48, 0x72, 0x7f, 0xb8, 0x9d, 0x0f,
+  0x48, 0x02, 0x72, 0x7f, 0xb8, 0x3d, 0xff, 0xfe, 0x07, 0x0f, 0x72, 0x00,
+  0x56, 0x5b, 0x48, 0x49, 0xd5, 0x86, 0x3a, 0x40, 0x7a, 0x02, 0x49, 0xd5,
+  0x86, 0x38, 0xff, 0xfe, 0x20, 0x40, 0x49, 0x00, 0x56, 0x5b, 0x48, 0x5c,
+  0xd5, 0x38, 0x4b, 0x01, 0xc8, 0x02, 0x5c, 0xd5, 0x38, 0x7b, 0xff, 0xfe,
+  0x00, 0x01, 0x5c, 0x00, 0x56, 0x31, 0x48, 0xd2, 0xff, 0x2f, 0xda, 0x81,
+  0xd1, 0x02, 0xd2, 0xff, 0x2f, 0x79, 0xff, 0xfe, 0x40, 0x81, 0xd2, 0x00,
+  0x56, 0x31, 0x48, 0x7b, 0xff, 0x19, 0xc9, 0xaa, 0xe7, 0x02, 0x7b, 0xff,
+  0x19, 0x78, 0xff, 0xfe, 0x55, 0xaa, 0x7b, 0x00, 0x57, 0x30, 0x48, 0x58,
+  0x00, 0xbd, 0xae, 0xff, 0x43, 0x02, 0x27, 0x00, 0xbd, 0x3d, 0xff, 0xfe,
+  0x7f, 0xff, 0x27, 0x00, 0x57, 0x30, 0x48, 0x50, 0x00, 0x0a, 0x0b, 0x41,
+  0xf6, 0x02, 0x70, 0x00, 0x0a, 0x39, 0xff, 0xfe, 0x20, 0x41, 0x70, 0x00,
+  0x57, 0x2f, 0x48, 0x74, 0x01, 0x7d, 0xc2, 0x3e, 0x83, 0x02, 0x6b, 0x01,
+  0x7d, 0x70, 0xff, 0xfe, 0x1f, 0x3e, 0x6b, 0x00, 0x57, 0x2f, 0x48, 0xdd,
+  0x01, 0x0c, 0x41, 0x81, 0xf4, 0x02, 0x9d, 0x01, 0x0c, 0xf1, 0xff, 0xfe,
+  0x40, 0x81, 0x9d, 0x00, 0x57, 0xb1, 0x48, 0x8c, 0x7f, 0x11, 0x63, 0x01,
+  0xef, 0x02, 0x8c, 0x7f, 0x11, 0xf1, 0xff, 0xfe, 0x00, 0x01, 0x8c, 0x00,
+  0x57, 0xb1, 0x48, 0x86, 0x7f, 0x98, 0x9e, 0xaa, 0x68, 0x02, 0xd3, 0x7f,
+  0x98, 0xbc, 0xff, 0xfe, 0x55, 0xaa, 0xd3, 0x00, 0x57, 0x5b, 0x48, 0xd3,
+  0xd5, 0x73, 0x12, 0xff, 0x8d, 0x02, 0xac, 0xd5, 0x73, 0xb1, 0xff, 0xfe,
+  0x7f, 0xff, 0xac, 0x00, 0x57, 0x5b, 0x48, 0xb0, 0xd5, 0x3e, 0x6c, 0x3f,
+  0xc2, 0x02, 0xaf, 0xd5, 0x3e, 0xfd, 0xff, 0xfe, 0x1f, 0x3f, 0xaf, 0x00,
+  0x57, 0x31, 0x48, 0x66, 0xff, 0x7e, 0x53, 0x02, 0x82, 0x02, 0x67, 0xff,
+  0x7e, 0x70, 0xff, 0xfe, 0x01, 0x02, 0x67, 0x00, 0x57, 0x31, 0x48, 0xaf,
+  0xff, 0xef, 0xcd, 0x7f, 0x11, 0x02, 0x90, 0xff, 0xef, 0xfd, 0xff, 0xfe,
+  0x3f, 0x7f, 0x90, 0x00, 0x58, 0x48, 0x48, 0x69, 0xab, 0x0c, 0xce, 0xff,
+  0xf4, 0x02, 0x69, 0xab, 0x0c, 0xfa, 0xff, 0xfd, 0xff, 0xff, 0x69, 0x00,
+  0x58, 0x48, 0x48, 0x61, 0x12, 0x8f, 0x5b, 0x7f, 0x71, 0x02, 0x61, 0x12,
+  0x8f, 0x7b, 0xff, 0xfd, 0x7f, 0x7f, 0x61, 0x00, 0x58, 0x48, 0x48, 0x74,
+  0xb1, 0x98, 0xc3, 0x3f, 0x68, 0x02, 0x74, 0xb1, 0x98, 0xf3, 0xff, 0xfd,
+  0x3f, 0x3f, 0x74, 0x00, 0x58, 0x48, 0x48, 0x39, 0xc9, 0x7a, 0x58, 0x0f,
+  0x86, 0x02, 0x39, 0xc9, 0x7a, 0x78, 0xff, 0xfd, 0x0f, 0x0f, 0x39, 0x00,
+  0x58, 0x48, 0x48, 0x13, 0xd7, 0xc6, 0x4c, 0x3f, 0x3a, 0x02, 0x13, 0xd7,
+  0xc6, 0x78, 0xff, 0xfd, 0x3f, 0x3f, 0x13, 0x00, 0x58, 0x48, 0x48, 0x96,
+  0x4e, 0x40, 0xda, 0x40, 0xc0, 0x02, 0x96, 0x4e, 0x40, 0xfa, 0xff, 0xfd,
+  0x40, 0x40, 0x96, 0x00, 0x59, 0x00, 0x03, 0x87, 0x8f, 0x00, 0x16, 0x80,
+  0x00, 0x03, 0x07, 0x8f, 0x00, 0x34, 0xff, 0xff, 0x80, 0x80, 0x34, 0x00,
+  0x59, 0x00, 0x03, 0xed, 0x11, 0x00, 0x19, 0x81, 0x00, 0x03, 0x6c, 0x11,
+  0x00, 0x39, 0xff, 0xff, 0x81, 0x81, 0x39, 0x00, 0x59, 0xff, 0x02, 0xd4,
+  0x50, 0x01, 0x46, 0x41, 0xff, 0x02, 0x95, 0x50, 0x01, 0xf4, 0xff, 0xff,
+  0x41, 0x41, 0xf4, 0x00, 0x59, 0xff, 0x02, 0x98, 0xb9, 0x01, 0x85, 0xc0,
+  0xff, 0x02, 0x58, 0xb9, 0x01, 0x35, 0xff, 0xff, 0xc0, 0xc0, 0x35, 0x00,
+  0x59, 0x81, 0x02, 0x62, 0xf1, 0x7f, 0x73, 0x0f, 0x81, 0x02, 0x6d, 0xf1,
+  0x7f, 0x71, 0xff, 0xff, 0x0f, 0x0f, 0x71, 0x00, 0x59, 0x81, 0x02, 0x33,
+  0xee, 0x7f, 0x98, 0x02, 0x81, 0x02, 0x31, 0xee, 0x7f, 0x38, 0xff, 0xff,
+  0x02, 0x02, 0x38, 0x00, 0x59, 0x2b, 0x02, 0xaa, 0x26, 0xd5, 0x1e, 0x81,
+  0x2b, 0x02, 0x2b, 0x26, 0xd5, 0x3c, 0xff, 0xff, 0x81, 0x81, 0x3c, 0x00,
+  0x59, 0x2b, 0x02, 0xca, 0x89, 0xd5, 0xa7, 0xfe, 0x2b, 0x02, 0x34, 0x89,
+  0xd5, 0x35, 0xff, 0xff, 0xfe, 0xfe, 0x35, 0x00, 0x59, 0x01, 0x02, 0xde,
+  0xfc, 0xff, 0x47, 0x41, 0x01, 0x02, 0x9f, 0xfc, 0xff, 0xf5, 0xff, 0xff,
+  0x41, 0x41, 0xf5, 0x00, 0x59, 0x01, 0x02, 0x56, 0x02, 0xff, 0x86, 0x41,
+  0x01, 0x02, 0x17, 0x02, 0xff, 0x34, 0xff, 0xff, 0x41, 0x41, 0x34, 0x00,
+  0x5a, 0x48, 0x48, 0x8f, 0x02, 0x93, 0xe7, 0x0f, 0x6d, 0x02, 0x8f, 0x02,
+  0x93, 0xf7, 0xff, 0xfd, 0x0f, 0x0f, 0x8f, 0x00, 0x5a, 0x48, 0x48, 0x01,
+  0xfd, 0x6a, 0xbc, 0xc0, 0x96, 0x02, 0x01, 0xfd, 0x6a, 0xbc, 0xff, 0xfd,
+  0xc0, 0xc0, 0x01, 0x00, 0x5a, 0x48, 0x48, 0xf6, 0x19, 0x38, 0x7b, 0xfe,
+  0xc8, 0x02, 0xf6, 0x19, 0x38, 0x7b, 0xff, 0xfd, 0xfe, 0xfe, 0xf6, 0x00,
+  0x5a, 0x48, 0x48, 0x1c, 0x1f, 0x1d, 0x80, 0x01, 0xe3, 0x02, 0x1c, 0x1f,
+  0x1d, 0xb0, 0xff, 0xfd, 0x01, 0x01, 0x1c, 0x00, 0x5b, 0x00, 0x03, 0xfb,
+  0xf2, 0x00, 0xcb, 0x3f, 0x00, 0x03, 0xe4, 0xf2, 0x00, 0xf9, 0xff, 0xff,
+  0x3f, 0x1f, 0xf9, 0x00, 0x5b, 0x00, 0x03, 0x73, 0xf1, 0x00, 0x05, 0x80,
+  0x00, 0x03, 0x33, 0xf1, 0x00, 0x34, 0xff, 0xff, 0x80, 0x40, 0x34, 0x00,
+  0x5b, 0xff, 0x02, 0xc9, 0x9a, 0x01, 0xc8, 0x93, 0xff, 0x02, 0x80, 0x9a,
+  0x01, 0xf9, 0xff, 0xff, 0x93, 0x49, 0xf9, 0x00, 0x5b, 0xff, 0x02, 0x03,
+  0x05, 0x01, 0x07, 0xaa, 0xff, 0x02, 0x56, 0x05, 0x01, 0x34, 0xff, 0xff,
+  0xaa, 0x55, 0x34, 0x00, 0x5b, 0x81, 0x02, 0xfd, 0x95, 0x7f, 0x81, 0xff,
+  0x81, 0x02, 0x82, 0x95, 0x7f, 0xb1, 0xff, 0xff, 0xff, 0x7f, 0xb1, 0x00,
+  0x5b, 0x81, 0x02, 0x7e, 0x62, 0x7f, 0xfa, 0xff, 0x81, 0x02, 0x01, 0x62,
+  0x7f, 0x79, 0xff, 0xff, 0xff, 0x7f, 0x79, 0x00, 0x5b, 0x2b, 0x02, 0x1a,
+  0x23, 0xd5, 0xfa, 0x7f, 0x2b, 0x02, 0x25, 0x23, 0xd5, 0x79, 0xff, 0xff,
+  0x7f, 0x3f, 0x79, 0x00, 0x5b, 0x2b, 0x02, 0x50, 0xa7, 0xd5, 0xfa, 0x3f,
+  0x2b, 0x02, 0x4f, 0xa7, 0xd5, 0x79, 0xff, 0xff, 0x3f, 0x1f, 0x79, 0x00,
+  0x5b, 0x01, 0x02, 0x52, 0x6a, 0xff, 0xbe, 0xff, 0x01, 0x02, 0x2d, 0x6a,
+  0xff, 0x3d, 0xff, 0xff, 0xff, 0x7f, 0x3d, 0x00, 0x5b, 0x01, 0x02, 0x59,
+  0x86, 0xff, 0x4a, 0xc1, 0x01, 0x02, 0x39, 0x86, 0xff, 0x79, 0xff, 0xff,
+  0xc1, 0x60, 0x79, 0x00, 0x5c, 0x00, 0x03, 0x09, 0x00, 0xa1, 0x40, 0x00,
+  0x5f, 0x02, 0x09, 0x00, 0xa1, 0x70, 0xff, 0xff, 0x00, 0x00, 0x70, 0x00,
+  0x5c, 0x00, 0x03, 0x75, 0x00, 0x27, 0x5b, 0x40, 0xd9, 0x02, 0x75, 0x00,
+  0x27, 0x7b, 0xff, 0xff, 0x40, 0x40, 0x7b, 0x00, 0x5c, 0xff, 0x02, 0x9c,
+  0x01, 0x7a, 0xcb, 0x00, 0x86, 0x02, 0x9c, 0x01, 0x7a, 0xfb, 0xff, 0xff,
+  0x00, 0x00, 0xfb, 0x00, 0x5c, 0xff, 0x02, 0xc8, 0x01, 0x57, 0x31, 0x41,
+  0xa9, 0x02, 0xc8, 0x01, 0x57, 0x31, 0xff, 0xff, 0x41, 0x41, 0x31, 0x00,
+  0x5c, 0x81, 0x02, 0x21, 0x7f, 0xd8, 0xb0, 0x0f, 0x28, 0x02, 0x21, 0x7f,
+  0xd8, 0xb0, 0xff, 0xff, 0x0f, 0x0f, 0xb0, 0x00, 0x5c, 0x81, 0x02, 0x57,
+  0x7f, 0xd7, 0xd2, 0xc0, 0x29, 0x02, 0x57, 0x7f, 0xd7, 0xf2, 0xff, 0xff,
+  0xc0, 0xc0, 0xf2, 0x00, 0x5c, 0x2b, 0x02, 0x95, 0xd5, 0x4f, 0xc7, 0x3f,
+  0xb1, 0x02, 0x95, 0xd5, 0x4f, 0xf7, 0xff, 0xff, 0x3f, 0x3f, 0xf7, 0x00,
+  0x5c, 0x2b, 0x02, 0x54, 0xd5, 0x2d, 0x78, 0x02, 0xd3, 0x02, 0x54, 0xd5,
+  0x2d, 0x78, 0xff, 0xff, 0x02, 0x02, 0x78, 0x00, 0x5c, 0x01, 0x02, 0x59,
+  0xff, 0x58, 0x80, 0xff, 0xa8, 0x02, 0x59, 0xff, 0x58, 0xb0, 0xff, 0xff,
+  0xff, 0xff, 0xb0, 0x00, 0x5c, 0x01, 0x02, 0xf2, 0xff, 0xab, 0xf9, 0x41,
+  0x55, 0x02, 0xf2, 0xff, 0xab, 0xf9, 0xff, 0xff, 0x41, 0x41, 0xf9, 0x00,
+  0x5d, 0x00, 0x03, 0x43, 0x00, 0x02, 0x4e, 0x81, 0xfe, 0x02, 0xc2, 0x00,
+  0x02, 0xfc, 0xff, 0xff, 0x81, 0x81, 0xfc, 0x00, 0x5d, 0x00, 0x03, 0x43,
+  0x00, 0x0c, 0xf0, 0x3f, 0xf4, 0x02, 0x7c, 0x00, 0x0c, 0x70, 0xff, 0xff,
+  0x3f, 0x3f, 0x70, 0x00, 0x5d, 0xff, 0x02, 0xe5, 0x01, 0xf7, 0x58, 0x81,
+  0x09, 0x02, 0x64, 0x01, 0xf7, 0x78, 0xff, 0xff, 0x81, 0x81, 0x78, 0x00,
+  0x5d, 0xff, 0x02, 0x10, 0x01, 0x77, 0x50, 0x3f, 0x89, 0x02, 0x2f, 0x01,
+  0x77, 0x70, 0xff, 0xff, 0x3f, 0x3f, 0x70, 0x00, 0x5d, 0x81, 0x02, 0x73,
+  0x7f, 0x20, 0x2e, 0x81, 0xe0, 0x02, 0xf2, 0x7f, 0x20, 0xbc, 0xff, 0xff,
+  0x81, 0x81, 0xbc, 0x00, 0x5d, 0x81, 0x02, 0xd8, 0x7f, 0xa9, 0x2c, 0x01,
+  0x57, 0x02, 0xd9, 0x7f, 0xa9, 0xbc, 0xff, 0xff, 0x01, 0x01, 0xbc, 0x00,
+  0x5d, 0x2b, 0x02, 0xd8, 0xd5, 0x1e, 0xde, 0x40, 0xe2, 0x02, 0x98, 0xd5,
+  0x1e, 0xfc, 0xff, 0xff, 0x40, 0x40, 0xfc, 0x00, 0x5d, 0x2b, 0x02, 0xc3,
+  0xd5, 0x59, 0x04, 0x0f, 0xa7, 0x02, 0xcc, 0xd5, 0x59, 0xb4, 0xff, 0xff,
+  0x0f, 0x0f, 0xb4, 0x00, 0x5d, 0x01, 0x02, 0x2f, 0xff, 0x7d, 0xa6, 0x80,
+  0x83, 0x02, 0xaf, 0xff, 0x7d, 0xb4, 0xff, 0xff, 0x80, 0x80, 0xb4, 0x00,
+  0x5d, 0x01, 0x02, 0x18, 0xff, 0xbb, 0x96, 0x0f, 0x45, 0x02, 0x17, 0xff,
+  0xbb, 0x34, 0xff, 0xff, 0x0f, 0x0f, 0x34, 0x00, 0x5e, 0x00, 0x03, 0xab,
+  0x00, 0xe7, 0x2d, 0x00, 0x19, 0x02, 0xab, 0x00, 0xe7, 0x3e, 0xff, 0xff,
+  0x00, 0x00, 0x3e, 0x00, 0x5e, 0x00, 0x03, 0x88, 0x00, 0xe7, 0xbe, 0x80,
+  0x19, 0x02, 0x88, 0x00, 0xe7, 0x3c, 0xff, 0xff, 0x80, 0x40, 0x3c, 0x00,
+  0x5e, 0xff, 0x02, 0x3f, 0x01, 0xec, 0x36, 0x3f, 0x14, 0x02, 0x3f, 0x01,
+  0xec, 0x35, 0xff, 0xff, 0x3f, 0x1f, 0x35, 0x00, 0x5e, 0xff, 0x02, 0x51,
+  0x01, 0xab, 0x19, 0x41, 0x55, 0x02, 0x51, 0x01, 0xab, 0x39, 0xff, 0xff,
+  0x41, 0x20, 0x39, 0x00, 0x5e, 0x81, 0x02, 0xa1, 0x7f, 0xc5, 0x2f, 0xaa,
+  0x3b, 0x02, 0xa1, 0x7f, 0xc5, 0x3c, 0xff, 0xff, 0xaa, 0x55, 0x3c, 0x00,
+  0x5e, 0x81, 0x02, 0xbc, 0x7f, 0xc7, 0x19, 0x40, 0x39, 0x02, 0xbc, 0x7f,
+  0xc7, 0x38, 0xff, 0xff, 0x40, 0x20, 0x38, 0x00, 0x5e, 0x2b, 0x02, 0x67,
+  0xd5, 0x0f, 0x69, 0x01, 0xf1, 0x02, 0x67, 0xd5, 0x0f, 0x7b, 0xff, 0xff,
+  0x01, 0x00, 0x7b, 0x00, 0x5e, 0x2b, 0x02, 0x91, 0xd5, 0x3c, 0x8d, 0x0f,
+  0xc4, 0x02, 0x91, 0xd5, 0x3c, 0x3d, 0xff, 0xff, 0x0f, 0x07, 0x3d, 0x00,
+  0x5e, 0x01, 0x02, 0x2d, 0xff, 0x3a, 0xdd, 0x80, 0xc6, 0x02, 0x2d, 0xff,
+  0x3a, 0x7c, 0xff, 0xff, 0x80, 0x40, 0x7c, 0x00, 0x5e, 0x01, 0x02, 0x9b,
+  0xff, 0xc7, 0xe5, 0x30, 0x39, 0x02, 0x9b, 0xff, 0xc7, 0x74, 0xff, 0xff,
+  0x30, 0x18, 0x74, 0x00, 0x5f, 0x00, 0x03, 0xc8, 0x00, 0x80, 0xe7, 0x02,
+  0x80, 0x02, 0xc9, 0x00, 0x80, 0xf4, 0xff, 0xff, 0x02, 0x01, 0xf4, 0x00,
+  0x5f, 0x00, 0x03, 0x78, 0x00, 0xd4, 0xe2, 0x0f, 0x2c, 0x02, 0x7f, 0x00,
+  0xd4, 0x71, 0xff, 0xff, 0x0f, 0x07, 0x71, 0x00, 0x5f, 0xff, 0x02, 0x01,
+  0x01, 0xed, 0xeb, 0x80, 0x13, 0x02, 0x41, 0x01, 0xed, 0x78, 0xff, 0xff,
+  0x80, 0x40, 0x78, 0x00, 0x5f, 0xff, 0x02, 0x62, 0x01, 0x69, 0x20, 0xff,
+  0x97, 0x02, 0x1d, 0x01, 0x69, 0x31, 0xff, 0xff, 0xff, 0x7f, 0x31, 0x00,
+  0x5f, 0x81, 0x02, 0xba, 0x7f, 0xf8, 0x98, 0x02, 0x08, 0x02, 0xbb, 0x7f,
+  0xf8, 0xb8, 0xff, 0xff, 0x02, 0x01, 0xb8, 0x00, 0x5f, 0x81, 0x02, 0xba,
+  0x7f, 0x92, 0x2c, 0xfe, 0x6e, 0x02, 0xc5, 0x7f, 0x92, 0xbc, 0xff, 0xff,
+  0xfe, 0x7f, 0xbc, 0x00, 0x5f, 0x2b, 0x02, 0x12, 0xd5, 0xf4, 0x04, 0x02,
+  0x0c, 0x02, 0x13, 0xd5, 0xf4, 0x34, 0xff, 0xff, 0x02, 0x01, 0x34, 0x00,
+  0x5f, 0x2b, 0x02, 0xe7, 0xd5, 0xf6, 0x8d, 0x41, 0x0a, 0x02, 0xc7, 0xd5,
+  0xf6, 0xbd, 0xff, 0xff, 0x41, 0x20, 0xbd, 0x00, 0x5f, 0x01, 0x02, 0xd7,
+  0xff, 0xfb, 0xe4, 0x40, 0x05, 0x02, 0xf7, 0xff, 0xfb, 0xf4, 0xff, 0xff,
+  0x40, 0x20, 0xf4, 0x00, 0x5f, 0x01, 0x02, 0xae, 0xff, 0x71, 0xc1, 0xff,
+  0x8f, 0x02, 0xd1, 0xff, 0x71, 0xf1, 0xff, 0xff, 0xff, 0x7f, 0xf1, 0x00,
+  0x60, 0x48, 0x48, 0x8e, 0x53, 0x95, 0x00, 0xff, 0x00, 0x03, 0x8e, 0x54,
+  0x95, 0x30, 0xff, 0x01, 0xff, 0xff, 0x00, 0x00, 0x60, 0x48, 0x48, 0x09,
+  0x8e, 0x43, 0x52, 0xff, 0x00, 0x03, 0x09, 0x8f, 0x43, 0xf0, 0xff, 0x01,
+  0xff, 0xff, 0x52, 0x00, 0x60, 0x48, 0x48, 0x90, 0x97, 0x37, 0x16, 0xff,
+  0x00, 0x03, 0x90, 0x98, 0x37, 0xb4, 0xff, 0x01, 0xff, 0xff, 0x16, 0x00,
+  0x60, 0x48, 0x48, 0x1a, 0x3a, 0xc5, 0x94, 0xff, 0x00, 0x03, 0x1a, 0x3b,
+  0xc5, 0x34, 0xff, 0x01, 0xff, 0xff, 0x94, 0x00, 0x61, 0x40, 0x48, 0x44,
+  0x00, 0xad, 0xe1, 0x3f, 0x53, 0x02, 0x84, 0x00, 0xad, 0xf0, 0xff, 0xfe,
+  0x3f, 0x3f, 0x84, 0x00, 0x61, 0x40, 0x48, 0x98, 0x00, 0xf4, 0x77, 0xaa,
+  0x0c, 0x02, 0x43, 0x00, 0xf4, 0x75, 0xff, 0xfe, 0xaa, 0xaa, 0x43, 0x00,
+  0x61, 0x3f, 0x48, 0x27, 0x01, 0xb3, 0xc2, 0x41, 0x4d, 0x02, 0x68, 0x01,
+  0xb3, 0x30, 0xff, 0xfe, 0x41, 0x41, 0x68, 0x00, 0x61, 0x3f, 0x48, 0x9d,
+  0x01, 0x86, 0x77, 0x0f, 0x7a, 0x02, 0xad, 0x01, 0x86, 0xb4, 0xff, 0xfe,
+  0x0f, 0x0f, 0xad, 0x00, 0x61, 0xc1, 0x48, 0x84, 0x7f, 0xb4, 0x76, 0xaa,
+  0x4c, 0x02, 0x2e, 0x7f, 0xb4, 0x75, 0xff, 0xfe, 0xaa, 0xaa, 0x2e, 0x00,
+  0x61, 0xc1, 0x48, 0x65, 0x7f, 0xdd, 0xc3, 0x02, 0x23, 0x02, 0x68, 0x7f,
+  0xdd, 0x30, 0xff, 0xfe, 0x02, 0x02, 0x68, 0x00, 0x61, 0x6b, 0x48, 0x68,
+  0xd5, 0x58, 0x25, 0x3f, 0xa8, 0x02, 0xa8, 0xd5, 0x58, 0xf4, 0xff, 0xfe,
+  0x3f, 0x3f, 0xa8, 0x00, 0x61, 0x6b, 0x48, 0x13, 0xd5, 0xd1, 0xf1, 0xac,
+  0x2f, 0x02, 0xc0, 0xd5, 0xd1, 0xb0, 0xff, 0xfe, 0xac, 0xac, 0xc0, 0x00,
+  0x61, 0x41, 0x48, 0xb9, 0xff, 0x8d, 0xd7, 0x81, 0x73, 0x02, 0x3b, 0xff,
+  0x8d, 0x75, 0xff, 0xfe, 0x81, 0x81, 0x3b, 0x00, 0x61, 0x41, 0x48, 0x7b,
+  0xff, 0x88, 0x14, 0x80, 0x78, 0x02, 0xfb, 0xff, 0x88, 0xb4, 0xff, 0xfe,
+  0x80, 0x80, 0xfb, 0x00, 0x63, 0x40, 0x48, 0x62, 0x00, 0xa8, 0xa4, 0x7f,
+  0x58, 0x02, 0xa2, 0x00, 0xa8, 0xf4, 0xff, 0xfe, 0x7f, 0x3f, 0xa2, 0x00,
+  0x63, 0x40, 0x48, 0x4c, 0x00, 0x16, 0xc5, 0xaa, 0xea, 0x02, 0x21, 0x00,
+  0x16, 0x35, 0xff, 0xfe, 0xaa, 0xd5, 0x21, 0x00, 0x63, 0x3f, 0x48, 0xd7,
+  0x01, 0xc7, 0xe6, 0x02, 0x39, 0x02, 0xd8, 0x01, 0xc7, 0xb4, 0xff, 0xfe,
+  0x02, 0x01, 0xd8, 0x00, 0x63, 0x3f, 0x48, 0xec, 0x01, 0x4e, 0x46, 0x7f,
+  0xb2, 0x02, 0x2c, 0x01, 0x4e, 0x35, 0xff, 0xfe, 0x7f, 0x3f, 0x2c, 0x00,
+  0x63, 0xc1, 0x48, 0x93, 0x7f, 0xc1, 0x37, 0x7f, 0x3f, 0x02, 0x53, 0x7f,
+  0xc1, 0x75, 0xff, 0xfe, 0x7f, 0xbf, 0x53, 0x00, 0x63, 0xc1, 0x48, 0xd2,
+  0x7f, 0xe4, 0xa0, 0x80, 0x1c, 0x02, 0x12, 0x7f, 0xe4, 0x31, 0xff, 0xfe,
+  0x80, 0x40, 0x12, 0x00, 0x63, 0x6b, 0x48, 0x2b, 0xd5, 0x98, 0x22, 0xfe,
+  0x68, 0x02, 0xaa, 0xd5, 0x98, 0xf0, 0xff, 0xfe, 0xfe, 0x7f, 0xaa, 0x00,
+  0x63, 0x6b, 0x48, 0x65, 0xd5, 0x01, 0xf7, 0xc0, 0xff, 0x02, 0x45, 0xd5,
+  0x01, 0x35, 0xff, 0xfe, 0xc0, 0xe0, 0x45, 0x00, 0x63, 0x41, 0x48, 0x47,
+  0xff, 0x58, 0xc6, 0x02, 0xa8, 0x02, 0x48, 0xff, 0x58, 0x34, 0xff, 0xfe,
+  0x02, 0x01, 0x48, 0x00, 0x63, 0x41, 0x48, 0x75, 0xff, 0x71, 0x44, 0x41,
+  0x8f, 0x02, 0x96, 0xff, 0x71, 0xf4, 0xff, 0xfe, 0x41, 0x20, 0x96, 0x00,
+  0x64, 0x30, 0x48, 0xa8, 0xd0, 0xad, 0xaf, 0x40, 0x53, 0x02, 0xa8, 0xd0,
+  0xad, 0xbf, 0xff, 0xfe, 0x40, 0x40, 0xa8, 0x00, 0x64, 0x30, 0x48, 0x9a,
+  0x1e, 0x09, 0xba, 0x00, 0xf7, 0x02, 0x9a, 0x1e, 0x09, 0xba, 0xff, 0xfe,
+  0x00, 0x00, 0x9a, 0x00, 0x64, 0x30, 0x48, 0xa5, 0x4c, 0x28, 0x80, 0xfe,
+  0xd8, 0x02, 0xa5, 0x4c, 0x28, 0xb0, 0xff, 0xfe, 0xfe, 0xfe, 0xa5, 0x00,
+  0x64, 0x30, 0x48, 0x8f, 0x84, 0x61, 0x51, 0x40, 0x9f, 0x02, 0x8f, 0x84,
+  0x61, 0x71, 0xff, 0xfe, 0x40, 0x40, 0x8f, 0x00, 0x65, 0x30, 0x48, 0xf7,
+  0x70, 0xbf, 0xa0, 0x40, 0x41, 0x02, 0x37, 0x70, 0xbf, 0x31, 0xff, 0xfe,
+  0x40, 0x40, 0x37, 0x00, 0x65, 0x30, 0x48, 0xe5, 0x12, 0x8d, 0x85, 0x0f,
+  0x73, 0x02, 0xf5, 0x12, 0x8d, 0xb4, 0xff, 0xfe, 0x0f, 0x0f, 0xf5, 0x00,
+  0x65, 0x30, 0x48, 0x59, 0x0e, 0x00, 0x10, 0x41, 0x00, 0x03, 0x9a, 0x0e,
+  0x00, 0xf0, 0xff, 0xfe, 0x41, 0x41, 0x9a, 0x00, 0x65, 0x30, 0x48, 0x3b,
+  0xc6, 0x17, 0xe2, 0xaa, 0xe9, 0x02, 0xe5, 0xc6, 0x17, 0xb0, 0xff, 0xfe,
+  0xaa, 0xaa, 0xe5, 0x00, 0x65, 0x30, 0x48, 0xc2, 0xb9, 0x3b, 0x87, 0x8f,
+  0xc5, 0x02, 0x52, 0xb9, 0x3b, 0x75, 0xff, 0xfe, 0x8f, 0x8f, 0x52, 0x00,
+  0x65, 0x30, 0x48, 0x5e, 0x9e, 0x38, 0x12, 0x01, 0xc8, 0x02, 0x5f, 0x9e,
+  0x38, 0x30, 0xff, 0xfe, 0x01, 0x01, 0x5f, 0x00, 0x66, 0x30, 0x48, 0xa0,
+  0x36, 0x72, 0x0d, 0x00, 0x8e, 0x02, 0xa0, 0x36, 0x72, 0xbc, 0xff, 0xfe,
+  0x80, 0x00, 0xa0, 0x00, 0x66, 0x30, 0x48, 0x75, 0x61, 0x04, 0x0f, 0xaa,
+  0xfc, 0x02, 0x75, 0x61, 0x04, 0xbc, 0xff, 0xfe, 0xd5, 0xaa, 0x75, 0x00,
+  0x66, 0x30, 0x48, 0x12, 0x69, 0x1a, 0xcf, 0x40, 0xe6, 0x02, 0x12, 0x69,
+  0x1a, 0xfc, 0xff, 0xfe, 0xa0, 0x40, 0x12, 0x00, 0x66, 0x30, 0x48, 0x91,
+  0x43, 0x21, 0x7a, 0x3f, 0xdf, 0x02, 0x91, 0x43, 0x21, 0x79, 0xff, 0xfe,
+  0x1f, 0x3f, 0x91, 0x00, 0x66, 0x30, 0x48, 0x4e, 0xb9, 0x99, 0x42, 0xc0,
+  0x67, 0x02, 0x4e, 0xb9, 0x99, 0x70, 0xff, 0xfe, 0x60, 0xc0, 0x4e, 0x00,
+  0x66, 0x30, 0x48, 0x27, 0xb9, 0x7a, 0x76, 0x40, 0x86, 0x02, 0x27, 0xb9,
+  0x7a, 0x74, 0xff, 0xfe, 0x20, 0x40, 0x27, 0x00, 0x67, 0x30, 0x48, 0x88,
+  0x6d, 0x06, 0x04, 0x40, 0xfa, 0x02, 0xa8, 0x6d, 0x06, 0xb4, 0xff, 0xfe,
+  0x20, 0x40, 0xa8, 0x00, 0x67, 0x30, 0x48, 0x64, 0xcc, 0x7f, 0x42, 0xaa,
+  0x81, 0x02, 0xb9, 0xcc, 0x7f, 0xf0, 0xff, 0xfe, 0x55, 0xaa, 0xb9, 0x00,
+  0x67, 0x30, 0x48, 0x15, 0x3b, 0x0d, 0x27, 0x81, 0xf3, 0x02, 0xd6, 0x3b,
+  0x0d, 0xb4, 0xff, 0xfe, 0xc0, 0x81, 0xd6, 0x00, 0x67, 0x30, 0x48, 0x71,
+  0x6c, 0xdf, 0xa5, 0x80, 0x21, 0x02, 0x31, 0x6c, 0xdf, 0x35, 0xff, 0xfe,
+  0xc0, 0x80, 0x31, 0x00, 0x67, 0x30, 0x48, 0x3e, 0xb9, 0x39, 0x11, 0xaa,
+  0xc7, 0x02, 0x13, 0xb9, 0x39, 0x31, 0xff, 0xfe, 0xd5, 0xaa, 0x13, 0x00,
+  0x67, 0x30, 0x48, 0x76, 0x06, 0x3d, 0xc1, 0x40, 0xc3, 0x02, 0x16, 0x06,
+  0x3d, 0x31, 0xff, 0xfe, 0xa0, 0x40, 0x16, 0x00, 0x68, 0x48, 0x48, 0xe8,
+  0x81, 0x21, 0xe5, 0x02, 0xdf, 0x02, 0x02, 0x81, 0x21, 0x75, 0xff, 0xfe,
+  0x02, 0x02, 0x02, 0x00, 0x68, 0x48, 0x48, 0x18, 0xd5, 0xae, 0x91, 0x00,
+  0x52, 0x02, 0x00, 0xd5, 0xae, 0x33, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00,
+  0x68, 0x48, 0x48, 0x89, 0x56, 0x0d, 0x35, 0xaa, 0xf3, 0x02, 0xaa, 0x56,
+  0x0d, 0xb5, 0xff, 0xfe, 0xaa, 0xaa, 0xaa, 0x00, 0x68, 0x48, 0x48, 0xfc,
+  0xc3, 0xb9, 0xf0, 0xaa, 0x47, 0x02, 0xaa, 0xc3, 0xb9, 0xf0, 0xff, 0xfe,
+  0xaa, 0xaa, 0xaa, 0x00, 0x68, 0x48, 0x48, 0xe3, 0x45, 0xcc, 0x5b, 0x80,
+  0x34, 0x02, 0x80, 0x45, 0xcc, 0xf9, 0xff, 0xfe, 0x80, 0x80, 0x80, 0x00,
+  0x68, 0x48, 0x48, 0x54, 0xf3, 0xd1, 0xf0, 0x01, 0x2f, 0x02, 0x01, 0xf3,
+  0xd1, 0x70, 0xff, 0xfe, 0x01, 0x01, 0x01, 0x00, 0x69, 0x00, 0x48, 0x00,
+  0xcc, 0xa3, 0x10, 0x5a, 0x00, 0x03, 0x00, 0xcc, 0xa3, 0x32, 0xff, 0xfe,
+  0x5a, 0x5a, 0x00, 0x00, 0x69, 0x01, 0x48, 0x00, 0x75, 0xdf, 0xf7, 0x09,
+  0x00, 0x03, 0x02, 0x75, 0xdf, 0x34, 0xff, 0xfe, 0x09, 0x09, 0x02, 0x00,
+  0x69, 0x0f, 0x48, 0x00, 0xbd, 0x86, 0x85, 0x2a, 0x00, 0x03, 0x10, 0xbd,
+  0x86, 0x34, 0xff, 0xfe, 0x2a, 0x2a, 0x10, 0x00, 0x69, 0x3f, 0x48, 0x00,
+  0xba, 0x74, 0x84, 0xca, 0x00, 0x03, 0x3f, 0xba, 0x74, 0x34, 0xff, 0xfe,
+  0xca, 0xca, 0x3f, 0x00, 0x69, 0x40, 0x48, 0x00, 0x53, 0x70, 0x05, 0xb2,
+  0x00, 0x03, 0x41, 0x53, 0x70, 0x34, 0xff, 0xfe, 0xb2, 0xb2, 0x41, 0x00,
+  0x69, 0x7f, 0x48, 0x00, 0xe8, 0xea, 0x41, 0x5e, 0x00, 0x03, 0x80, 0xe8,
+  0xea, 0xf0, 0xff, 0xfe, 0x5e, 0x5e, 0x80, 0x00, 0x69, 0x80, 0x48, 0x00,
+  0xff, 0xc1, 0xd4, 0x82, 0x00, 0x03, 0x80, 0xff, 0xc1, 0xb4, 0xff, 0xfe,
+  0x82, 0x82, 0x80, 0x00, 0x69, 0x81, 0x48, 0x00, 0xa4, 0xc9, 0x24, 0xcf,
+  0x00, 0x03, 0x81, 0xa4, 0xc9, 0xb4, 0xff, 0xfe, 0xcf, 0xcf, 0x81, 0x00,
+  0x69, 0xfe, 0x48, 0x00, 0x44, 0x27, 0x23, 0x2f, 0x00, 0x03, 0xff, 0x44,
+  0x27, 0xb0, 0xff, 0xfe, 0x2f, 0x2f, 0xff, 0x00, 0x69, 0xff, 0x48, 0x00,
+  0x2e, 0x96, 0xc0, 0x0d, 0x00, 0x03, 0xff, 0x2e, 0x96, 0xb0, 0xff, 0xfe,
+  0x0d, 0x0d, 0xff, 0x00, 0x69, 0x00, 0x48, 0x01, 0xaf, 0x23, 0x26, 0x79,
+  0x00, 0x03, 0x01, 0xaf, 0x23, 0x34, 0xff, 0xfe, 0x79, 0x79, 0x01, 0x00,
+  0x69, 0x01, 0x48, 0x01, 0x0b, 0xe3, 0x62, 0x01, 0x00, 0x03, 0x02, 0x0b,
+  0xe3, 0x30, 0xff, 0xfe, 0x01, 0x01, 0x02, 0x00, 0x69, 0x0f, 0x48, 0x01,
+  0xe3, 0x41, 0x57, 0x58, 0x00, 0x03, 0x11, 0xe3, 0x41, 0x34, 0xff, 0xfe,
+  0x58, 0x58, 0x11, 0x00, 0x69, 0x3f, 0x48, 0x01, 0xa5, 0xaf, 0x83, 0x3c,
+  0x00, 0x03, 0x41, 0xa5, 0xaf, 0x30, 0xff, 0xfe, 0x3c, 0x3c, 0x41, 0x00,
+  0x69, 0x40, 0x48, 0x01, 0x3e, 0x00, 0xc4, 0x77, 0x00, 0x03, 0x41, 0x3e,
+  0x00, 0x34, 0xff, 0xfe, 0x77, 0x77, 0x41, 0x00, 0x69, 0x7f, 0x48, 0x01,
+  0x2d, 0x1d, 0x51, 0xfb, 0x00, 0x03, 0x81, 0x2d, 0x1d, 0xf0, 0xff, 0xfe,
+  0xfb, 0xfb, 0x81, 0x00, 0x69, 0x80, 0x48, 0x01, 0xa1, 0x22, 0x45, 0x76,
+  0x00, 0x03, 0x82, 0xa1, 0x22, 0xb4, 0xff, 0xfe, 0x76, 0x76, 0x82, 0x00,
+  0x69, 0x81, 0x48, 0x01, 0xb5, 0x1f, 0xf0, 0x85, 0x00, 0x03, 0x82, 0xb5,
+  0x1f, 0xb0, 0xff, 0xfe, 0x85, 0x85, 0x82, 0x00, 0x69, 0xfe, 0x48, 0x01,
+  0x9e, 0x56, 0x16, 0xbc, 0x00, 0x03, 0xff, 0x9e, 0x56, 0xb4, 0xff, 0xfe,
+  0xbc, 0xbc, 0xff, 0x00, 0x69, 0xff, 0x48, 0x01, 0x24, 0x8c, 0xd1, 0x75,
+  0x00, 0x03, 0x01, 0x24, 0x8c, 0x31, 0xff, 0xfe, 0x75, 0x75, 0x01, 0x00,
+  0x69, 0x00, 0x48, 0x0f, 0x77, 0xa0, 0x15, 0xb1, 0x00, 0x03, 0x10, 0x77,
+  0xa0, 0x34, 0xff, 0xfe, 0xb1, 0xb1, 0x10, 0x00, 0x69, 0x01, 0x48, 0x0f,
+  0x1d, 0x7b, 0xa6, 0x82, 0x00, 0x03, 0x10, 0x1d, 0x7b, 0x34, 0xff, 0xfe,
+  0x82, 0x82, 0x10, 0x00, 0x69, 0x0f, 0x48, 0x0f, 0x32, 0xac, 0x00, 0x23,
+  0x00, 0x03, 0x1e, 0x32, 0xac, 0x30, 0xff, 0xfe, 0x23, 0x23, 0x1e, 0x00,
+  0x69, 0x3f, 0x48, 0x0f, 0xb9, 0xf9, 0x71, 0x0e, 0x00, 0x03, 0x4f, 0xb9,
+  0xf9, 0x30, 0xff, 0xfe, 0x0e, 0x0e, 0x4f, 0x00, 0x69, 0x40, 0x48, 0x0f,
+  0x2a, 0x23, 0xb1, 0xf0, 0x00, 0x03, 0x50, 0x2a, 0x23, 0x30, 0xff, 0xfe,
+  0xf0, 0xf0, 0x50, 0x00, 0x69, 0x7f, 0x48, 0x0f, 0xc9, 0xa3, 0x07, 0x9d,
+  0x00, 0x03, 0x8f, 0xc9, 0xa3, 0xf4, 0xff, 0xfe, 0x9d, 0x9d, 0x8f, 0x00,
+  0x69, 0x80, 0x48, 0x0f, 0xb4, 0x48, 0xc5, 0x27, 0x00, 0x03, 0x90, 0xb4,
+  0x48, 0xb4, 0xff, 0xfe, 0x27, 0x27, 0x90, 0x00, 0x69, 0x81, 0x48, 0x0f,
+  0x90, 0x6b, 0x84, 0x8f, 0x00, 0x03, 0x90, 0x90, 0x6b, 0xb4, 0xff, 0xfe,
+  0x8f, 0x8f, 0x90, 0x00, 0x69, 0xfe, 0x48, 0x0f, 0x8d, 0xa7, 0xa1, 0xd4,
+  0x00, 0x03, 0x0e, 0x8d, 0xa7, 0x31, 0xff, 0xfe, 0xd4, 0xd4, 0x0e, 0x00,
+  0x69, 0xff, 0x48, 0x0f, 0xd4, 0xdb, 0x51, 0x05, 0x00, 0x03, 0x0f, 0xd4,
+  0xdb, 0x31, 0xff, 0xfe, 0x05, 0x05, 0x0f, 0x00, 0x69, 0x00, 0x48, 0x3f,
+  0x7a, 0x06, 0xf5, 0xae, 0x00, 0x03, 0x40, 0x7a, 0x06, 0x34, 0xff, 0xfe,
+  0xae, 0xae, 0x40, 0x00, 0x69, 0x01, 0x48, 0x3f, 0x85, 0x70, 0x30, 0x90,
+  0x00, 0x03, 0x40, 0x85, 0x70, 0x30, 0xff, 0xfe, 0x90, 0x90, 0x40, 0x00,
+  0x69, 0x0f, 0x48, 0x3f, 0x4f, 0xd8, 0xb2, 0xe9, 0x00, 0x03, 0x4e, 0x4f,
+  0xd8, 0x30, 0xff, 0xfe, 0xe9, 0xe9, 0x4e, 0x00, 0x69, 0x3f, 0x48, 0x3f,
+  0x61, 0x3f, 0x17, 0x7a, 0x00, 0x03, 0x7f, 0x61, 0x3f, 0x34, 0xff, 0xfe,
+  0x7a, 0x7a, 0x7f, 0x00, 0x69, 0x40, 0x48, 0x3f, 0x70, 0x9d, 0x06, 0x8a,
+  0x00, 0x03, 0x7f, 0x70, 0x9d, 0x34, 0xff, 0xfe, 0x8a, 0x8a, 0x7f, 0x00,
+  0x69, 0x7f, 0x48, 0x3f, 0x5b, 0xc2, 0xf3, 0x5b, 0x00, 0x03, 0xbf, 0x5b,
+  0xc2, 0xf0, 0xff, 0xfe, 0x5b, 0x5b, 0xbf, 0x00, 0x69, 0x80, 0x48, 0x3f,
+  0xd5, 0xbf, 0x53, 0xa7, 0x00, 0x03, 0xc0, 0xd5, 0xbf, 0xb0, 0xff, 0xfe,
+  0xa7, 0xa7, 0xc0, 0x00, 0x69, 0x81, 0x48, 0x3f, 0x5f, 0x6b, 0xc5, 0x54,
+  0x00, 0x03, 0xc1, 0x5f, 0x6b, 0xb4, 0xff, 0xfe, 0x54, 0x54, 0xc1, 0x00,
+  0x69, 0xfe, 0x48, 0x3f, 0x0c, 0x35, 0x15, 0xc4, 0x00, 0x03, 0x3e, 0x0c,
+  0x35, 0x35, 0xff, 0xfe, 0xc4, 0xc4, 0x3e, 0x00, 0x69, 0xff, 0x48, 0x3f,
+  0xcf, 0x3e, 0x24, 0x73, 0x00, 0x03, 0x3e, 0xcf, 0x3e, 0x35, 0xff, 0xfe,
+  0x73, 0x73, 0x3e, 0x00, 0x69, 0x00, 0x48, 0x40, 0xf5, 0x45, 0x07, 0x82,
+  0x00, 0x03, 0x41, 0xf5, 0x45, 0x34, 0xff, 0xfe, 0x82, 0x82, 0x41, 0x00,
+  0x69, 0x01, 0x48, 0x40, 0xc2, 0x30, 0x36, 0x8e, 0x00, 0x03, 0x41, 0xc2,
+  0x30, 0x34, 0xff, 0xfe, 0x8e, 0x8e, 0x41, 0x00, 0x69, 0x0f, 0x48, 0x40,
+  0xb1, 0x65, 0xe2, 0x78, 0x00, 0x03, 0x4f, 0xb1, 0x65, 0x30, 0xff, 0xfe,
+  0x78, 0x78, 0x4f, 0x00, 0x69, 0x3f, 0x48, 0x40, 0x9e, 0x39, 0x30, 0x7e,
+  0x00, 0x03, 0x7f, 0x9e, 0x39, 0x30, 0xff, 0xfe, 0x7e, 0x7e, 0x7f, 0x00,
+  0x69, 0x40, 0x48, 0x40, 0xc3, 0x6b, 0x94, 0x12, 0x00, 0x03, 0x80, 0xc3,
+  0x6b, 0xf4, 0xff, 0xfe, 0x12, 0x12, 0x80, 0x00, 0x69, 0x7f, 0x48, 0x40,
+  0xe6, 0x06, 0xd2, 0x16, 0x00, 0x03, 0xbf, 0xe6, 0x06, 0xf0, 0xff, 0xfe,
+  0x16, 0x16, 0xbf, 0x00, 0x69, 0x80, 0x48, 0x40, 0x78, 0x24, 0xd7, 0x54,
+  0x00, 0x03, 0xc1, 0x78, 0x24, 0xb4, 0xff, 0xfe, 0x54, 0x54, 0xc1, 0x00,
+  0x69, 0x81, 0x48, 0x40, 0x29, 0xa5, 0x36, 0x19, 0x00, 0x03, 0xc1, 0x29,
+  0xa5, 0xb4, 0xff, 0xfe, 0x19, 0x19, 0xc1, 0x00, 0x69, 0xfe, 0x48, 0x40,
+  0x93, 0xa0, 0x00, 0x2b, 0x00, 0x03, 0x3e, 0x93, 0xa0, 0x31, 0xff, 0xfe,
+  0x2b, 0x2b, 0x3e, 0x00, 0x69, 0xff, 0x48, 0x40, 0xc5, 0xf0, 0x64, 0x35,
+  0x00, 0x03, 0x3f, 0xc5, 0xf0, 0x35, 0xff, 0xfe, 0x35, 0x35, 0x3f, 0x00,
+  0x69, 0x00, 0x48, 0x7f, 0x17, 0xe7, 0xf3, 0xa3, 0x00, 0x03, 0x80, 0x17,
+  0xe7, 0xf0, 0xff, 0xfe, 0xa3, 0xa3, 0x80, 0x00, 0x69, 0x01, 0x48, 0x7f,
+  0xac, 0xbf, 0x03, 0x2f, 0x00, 0x03, 0x81, 0xac, 0xbf, 0xf0, 0xff, 0xfe,
+  0x2f, 0x2f, 0x81, 0x00, 0x69, 0x0f, 0x48, 0x7f, 0x1e, 0x2a, 0x80, 0xf9,
+  0x00, 0x03, 0x8e, 0x1e, 0x2a, 0xf0, 0xff, 0xfe, 0xf9, 0xf9, 0x8e, 0x00,
+  0x69, 0x3f, 0x48, 0x7f, 0xb6, 0x51, 0xe2, 0x0a, 0x00, 0x03, 0xbe, 0xb6,
+  0x51, 0xf0, 0xff, 0xfe, 0x0a, 0x0a, 0xbe, 0x00, 0x69, 0x40, 0x48, 0x7f,
+  0x22, 0x90, 0xe5, 0x85, 0x00, 0x03, 0xc0, 0x22, 0x90, 0xf4, 0xff, 0xfe,
+  0x85, 0x85, 0xc0, 0x00, 0x69, 0x7f, 0x48, 0x7f, 0xbd, 0x07, 0x05, 0x44,
+  0x00, 0x03, 0xff, 0xbd, 0x07, 0xf4, 0xff, 0xfe, 0x44, 0x44, 0xff, 0x00,
+  0x69, 0x80, 0x48, 0x7f, 0xd9, 0x80, 0x66, 0x75, 0x00, 0x03, 0xff, 0xd9,
+  0x80, 0xb4, 0xff, 0xfe, 0x75, 0x75, 0xff, 0x00, 0x69, 0x81, 0x48, 0x7f,
+  0x96, 0xe6, 0x51, 0x10, 0x00, 0x03, 0x01, 0x96, 0xe6, 0x31, 0xff, 0xfe,
+  0x10, 0x10, 0x01, 0x00, 0x69, 0xfe, 0x48, 0x7f, 0x91, 0xa2, 0x21, 0xd9,
+  0x00, 0x03, 0x7e, 0x91, 0xa2, 0x31, 0xff, 0xfe, 0xd9, 0xd9, 0x7e, 0x00,
+  0x69, 0xff, 0x48, 0x7f, 0xd4, 0x6b, 0x26, 0x38, 0x00, 0x03, 0x7e, 0xd4,
+  0x6b, 0x35, 0xff, 0xfe, 0x38, 0x38, 0x7e, 0x00, 0x69, 0x00, 0x48, 0x80,
+  0x5f, 0x13, 0x26, 0x11, 0x00, 0x03, 0x80, 0x5f, 0x13, 0xb4, 0xff, 0xfe,
+  0x11, 0x11, 0x80, 0x00, 0x69, 0x01, 0x48, 0x80, 0x24, 0x83, 0xd7, 0xfb,
+  0x00, 0x03, 0x82, 0x24, 0x83, 0xb4, 0xff, 0xfe, 0xfb, 0xfb, 0x82, 0x00,
+  0x69, 0x0f, 0x48, 0x80, 0x57, 0x5e, 0x32, 0x55, 0x00, 0x03, 0x8f, 0x57,
+  0x5e, 0xb0, 0xff, 0xfe, 0x55, 0x55, 0x8f, 0x00, 0x69, 0x3f, 0x48, 0x80,
+  0x68, 0x95, 0x24, 0x7b, 0x00, 0x03, 0xbf, 0x68, 0x95, 0xb4, 0xff, 0xfe,
+  0x7b, 0x7b, 0xbf, 0x00, 0x69, 0x40, 0x48, 0x80, 0x70, 0x99, 0x45, 0xfe,
+  0x00, 0x03, 0xc1, 0x70, 0x99, 0xb4, 0xff, 0xfe, 0xfe, 0xfe, 0xc1, 0x00,
+  0x69, 0x7f, 0x48, 0x80, 0x16, 0x72, 0x67, 0xc5, 0x00, 0x03, 0x00, 0x16,
+  0x72, 0x37, 0xff, 0xfe, 0xc5, 0xc5, 0x00, 0x00, 0x69, 0x80, 0x48, 0x80,
+  0x43, 0x92, 0xb7, 0xcd, 0x00, 0x03, 0x01, 0x43, 0x92, 0x75, 0xff, 0xfe,
+  0xcd, 0xcd, 0x01, 0x00, 0x69, 0x81, 0x48, 0x80, 0xaa, 0x1a, 0xb0, 0xa6,
+  0x00, 0x03, 0x01, 0xaa, 0x1a, 0x71, 0xff, 0xfe, 0xa6, 0xa6, 0x01, 0x00,
+  0x69, 0xfe, 0x48, 0x80, 0xc2, 0x80, 0x77, 0xc4, 0x00, 0x03, 0x7f, 0xc2,
+  0x80, 0x75, 0xff, 0xfe, 0xc4, 0xc4, 0x7f, 0x00, 0x69, 0xff, 0x48, 0x80,
+  0xac, 0xbf, 0x67, 0x04, 0x00, 0x03, 0x80, 0xac, 0xbf, 0xb5, 0xff, 0xfe,
+  0x04, 0x04, 0x80, 0x00, 0x69, 0x00, 0x48, 0x81, 0xc2, 0x97, 0x64, 0x5d,
+  0x00, 0x03, 0x81, 0xc2, 0x97, 0xb4, 0xff, 0xfe, 0x5d, 0x5d, 0x81, 0x00,
+  0x69, 0x01, 0x48, 0x81, 0x78, 0xc2, 0x55, 0x49, 0x00, 0x03, 0x83, 0x78,
+  0xc2, 0xb4, 0xff, 0xfe, 0x49, 0x49, 0x83, 0x00, 0x69, 0x0f, 0x48, 0x81,
+  0x16, 0xfe, 0xc6, 0x76, 0x00, 0x03, 0x90, 0x16, 0xfe, 0xb4, 0xff, 0xfe,
+  0x76, 0x76, 0x90, 0x00, 0x69, 0x3f, 0x48, 0x81, 0x7c, 0xc9, 0x80, 0xc6,
+  0x00, 0x03, 0xc0, 0x7c, 0xc9, 0xb0, 0xff, 0xfe, 0xc6, 0xc6, 0xc0, 0x00,
+  0x69, 0x40, 0x48, 0x81, 0xf6, 0xe5, 0xb1, 0x07, 0x00, 0x03, 0xc2, 0xf6,
+  0xe5, 0xb0, 0xff, 0xfe, 0x07, 0x07, 0xc2, 0x00, 0x69, 0x7f, 0x48, 0x81,
+  0xa7, 0x9a, 0xa5, 0xa1, 0x00, 0x03, 0x01, 0xa7, 0x9a, 0x35, 0xff, 0xfe,
+  0xa1, 0xa1, 0x01, 0x00, 0x69, 0x80, 0x48, 0x81, 0x18, 0x0d, 0x01, 0x5e,
+  0x00, 0x03, 0x02, 0x18, 0x0d, 0x71, 0xff, 0xfe, 0x5e, 0x5e, 0x02, 0x00,
+  0x69, 0x81, 0x48, 0x81, 0xb6, 0x35, 0x34, 0xe6, 0x00, 0x03, 0x02, 0xb6,
+  0x35, 0x75, 0xff, 0xfe, 0xe6, 0xe6, 0x02, 0x00, 0x69, 0xfe, 0x48, 0x81,
+  0x5c, 0x90, 0x23, 0x22, 0x00, 0x03, 0x80, 0x5c, 0x90, 0xb1, 0xff, 0xfe,
+  0x22, 0x22, 0x80, 0x00, 0x69, 0xff, 0x48, 0x81, 0x0c, 0x80, 0x57, 0xce,
+  0x00, 0x03, 0x81, 0x0c, 0x80, 0xb5, 0xff, 0xfe, 0xce, 0xce, 0x81, 0x00,
+  0x69, 0x00, 0x48, 0xfe, 0x18, 0x9d, 0x42, 0xdf, 0x00, 0x03, 0xfe, 0x18,
+  0x9d, 0xb0, 0xff, 0xfe, 0xdf, 0xdf, 0xfe, 0x00, 0x69, 0x01, 0x48, 0xfe,
+  0x30, 0x56, 0xf1, 0xa3, 0x00, 0x03, 0x00, 0x30, 0x56, 0x33, 0xff, 0xfe,
+  0xa3, 0xa3, 0x00, 0x00, 0x69, 0x0f, 0x48, 0xfe, 0x51, 0xc9, 0x37, 0xb2,
+  0x00, 0x03, 0x0e, 0x51, 0xc9, 0x35, 0xff, 0xfe, 0xb2, 0xb2, 0x0e, 0x00,
+  0x69, 0x3f, 0x48, 0xfe, 0xdc, 0xce, 0x91, 0x17, 0x00, 0x03, 0x3e, 0xdc,
+  0xce, 0x31, 0xff, 0xfe, 0x17, 0x17, 0x3e, 0x00, 0x69, 0x40, 0x48, 0xfe,
+  0xae, 0xe5, 0x65, 0x31, 0x00, 0x03, 0x3f, 0xae, 0xe5, 0x35, 0xff, 0xfe,
+  0x31, 0x31, 0x3f, 0x00, 0x69, 0x7f, 0x48, 0xfe, 0xc6, 0x23, 0x20, 0xf8,
+  0x00, 0x03, 0x7d, 0xc6, 0x23, 0x31, 0xff, 0xfe, 0xf8, 0xf8, 0x7d, 0x00,
+  0x69, 0x80, 0x48, 0xfe, 0xd4, 0x9e, 0xd6, 0xa2, 0x00, 0x03, 0x7e, 0xd4,
+  0x9e, 0x75, 0xff, 0xfe, 0xa2, 0xa2, 0x7e, 0x00, 0x69, 0x81, 0x48, 0xfe,
+  0x46, 0xde, 0x20, 0x27, 0x00, 0x03, 0x7f, 0x46, 0xde, 0x71, 0xff, 0xfe,
+  0x27, 0x27, 0x7f, 0x00, 0x69, 0xfe, 0x48, 0xfe, 0x80, 0x74, 0xf7, 0x34,
+  0x00, 0x03, 0xfd, 0x80, 0x74, 0xb5, 0xff, 0xfe, 0x34, 0x34, 0xfd, 0x00,
+  0x69, 0xff, 0x48, 0xfe, 0x04, 0x44, 0x26, 0xe1, 0x00, 0x03, 0xfd, 0x04,
+  0x44, 0xb5, 0xff, 0xfe, 0xe1, 0xe1, 0xfd, 0x00, 0x69, 0x00, 0x48, 0xff,
+  0x32, 0xe3, 0x15, 0x39, 0x00, 0x03, 0x00, 0x32, 0xe3, 0x37, 0xff, 0xfe,
+  0x39, 0x39, 0x00, 0x00, 0x69, 0x01, 0x48, 0xff, 0xd0, 0x9f, 0x93, 0x3c,
+  0x00, 0x03, 0x01, 0xd0, 0x9f, 0x31, 0xff, 0xfe, 0x3c, 0x3c, 0x01, 0x00,
+  0x69, 0x0f, 0x48, 0xff, 0xa0, 0x4f, 0xe2, 0x9b, 0x00, 0x03, 0x0e, 0xa0,
+  0x4f, 0x31, 0xff, 0xfe, 0x9b, 0x9b, 0x0e, 0x00, 0x69, 0x3f, 0x48, 0xff,
+  0xf4, 0xf2, 0xa1, 0xb7, 0x00, 0x03, 0x3f, 0xf4, 0xf2, 0x31, 0xff, 0xfe,
+  0xb7, 0xb7, 0x3f, 0x00, 0x69, 0x40, 0x48, 0xff, 0x88, 0x68, 0x95, 0x59,
+  0x00, 0x03, 0x40, 0x88, 0x68, 0x35, 0xff, 0xfe, 0x59, 0x59, 0x40, 0x00,
+  0x69, 0x7f, 0x48, 0xff, 0xec, 0xb3, 0x57, 0x4d, 0x00, 0x03, 0x7f, 0xec,
+  0xb3, 0x35, 0xff, 0xfe, 0x4d, 0x4d, 0x7f, 0x00, 0x69, 0x80, 0x48, 0xff,
+  0x4f, 0x7b, 0x31, 0x2b, 0x00, 0x03, 0x80, 0x4f, 0x7b, 0xb1, 0xff, 0xfe,
+  0x2b, 0x2b, 0x80, 0x00, 0x69, 0x81, 0x48, 0xff, 0xfc, 0x2d, 0xb6, 0xbe,
+  0x00, 0x03, 0x80, 0xfc, 0x2d, 0xb5, 0xff, 0xfe, 0xbe, 0xbe, 0x80, 0x00,
+  0x69, 0xfe, 0x48, 0xff, 0x7b, 0x4c, 0x53, 0xaa, 0x00, 0x03, 0xfe, 0x7b,
+  0x4c, 0xb1, 0xff, 0xfe, 0xaa, 0xaa, 0xfe, 0x00, 0x69, 0xff, 0x48, 0xff,
+  0x8b, 0x39, 0x03, 0x77, 0x00, 0x03, 0xff, 0x8b, 0x39, 0xb1, 0xff, 0xfe,
+  0x77, 0x77, 0xff, 0x00, 0x6a, 0x48, 0x48, 0xa2, 0x74, 0x93, 0x89, 0x40,
+  0x6d, 0x02, 0xd1, 0x74, 0x93, 0xb8, 0xff, 0xfd, 0x40, 0x40, 0xd1, 0x00,
+  0x6a, 0x48, 0x48, 0x72, 0x7e, 0x13, 0x88, 0x00, 0xed, 0x02, 0x39, 0x7e,
+  0x13, 0x38, 0xff, 0xfd, 0x00, 0x00, 0x39, 0x00, 0x6a, 0x48, 0x48, 0x07,
+  0xe8, 0xfc, 0x28, 0x0f, 0x04, 0x02, 0x03, 0xe8, 0xfc, 0x39, 0xff, 0xfd,
+  0x0f, 0x0f, 0x03, 0x00, 0x6a, 0x48, 0x48, 0x32, 0xf9, 0x81, 0xd7, 0xfe,
+  0x7f, 0x02, 0x99, 0xf9, 0x81, 0xf4, 0xff, 0xfd, 0xfe, 0xfe, 0x99, 0x00,
+  0x6a, 0x48, 0x48, 0x93, 0x4a, 0xf3, 0x81, 0x3f, 0x0d, 0x02, 0xc9, 0x4a,
+  0xf3, 0xb1, 0xff, 0xfd, 0x3f, 0x3f, 0xc9, 0x00, 0x6a, 0x48, 0x48, 0x2d,
+  0x70, 0x59, 0xaf, 0x17, 0xa7, 0x02, 0x96, 0x70, 0x59, 0xbd, 0xff, 0xfd,
+  0x17, 0x17, 0x96, 0x00, 0x6c, 0xff, 0x02, 0x7b, 0xa5, 0x75, 0xf4, 0x99,
+  0x00, 0x03, 0x7b, 0xa6, 0x75, 0xf4, 0xff, 0xff, 0x99, 0x99, 0xf4, 0x00,
+  0x6c, 0x10, 0x02, 0x7b, 0xa5, 0x75, 0xf4, 0x99, 0x00, 0x03, 0x7b, 0xa6,
+  0x75, 0xf4, 0xff, 0xff, 0x99, 0x99, 0xf4, 0x00, 0x6c, 0xff, 0x02, 0xdd,
+  0x22, 0x41, 0xaf, 0xd1, 0x00, 0x03, 0xdd, 0x23, 0x41, 0x3d, 0xff, 0xff,
+  0xd1, 0xd1, 0x3d, 0x00, 0x6c, 0x10, 0x02, 0xdd, 0x22, 0x41, 0xaf, 0xd1,
+  0x00, 0x03, 0xdd, 0x23, 0x41, 0x3d, 0xff, 0xff, 0xd1, 0xd1, 0x3d, 0x00,
+  0x6c, 0xff, 0x02, 0x7d, 0xbd, 0x0c, 0x59, 0xd9, 0x00, 0x03, 0x7d, 0xbe,
+  0x0c, 0xf9, 0xff, 0xff, 0xd9, 0xd9, 0xf9, 0x00, 0x6c, 0x10, 0x02, 0x7d,
+  0xbd, 0x0c, 0x59, 0xd9, 0x00, 0x03, 0x7d, 0xbe, 0x0c, 0xf9, 0xff, 0xff,
+  0xd9, 0xd9, 0xf9, 0x00, 0x6c, 0xff, 0x02, 0x02, 0x49, 0xaa, 0xa3, 0x99,
+  0x00, 0x03, 0x02, 0x4a, 0xaa, 0x31, 0xff, 0xff, 0x99, 0x99, 0x31, 0x00,
+  0x6c, 0x10, 0x02, 0x02, 0x49, 0xaa, 0xa3, 0x99, 0x00, 0x03, 0x02, 0x4a,
+  0xaa, 0x31, 0xff, 0xff, 0x99, 0x99, 0x31, 0x00, 0x6d, 0x00, 0x03, 0xdc,
+  0x19, 0xb4, 0x64, 0xff, 0x4c, 0x02, 0xdb, 0x19, 0xb4, 0xb5, 0xff, 0xff,
+  0xff, 0xff, 0xb5, 0x00, 0x6d, 0x00, 0x03, 0x12, 0xa1, 0x00, 0xf7, 0xc0,
+  0x00, 0x03, 0xd3, 0xa1, 0x00, 0xb4, 0xff, 0xff, 0xc0, 0xc0, 0xb4, 0x00,
+  0x6d, 0x00, 0x03, 0x4b, 0xeb, 0xea, 0x46, 0x40, 0x16, 0x02, 0x8b, 0xeb,
+  0xea, 0xf4, 0xff, 0xff, 0x40, 0x40, 0xf4, 0x00, 0x6d, 0x00, 0x03, 0x37,
+  0x84, 0x6e, 0x44, 0x00, 0x92, 0x02, 0x37, 0x84, 0x6e, 0x34, 0xff, 0xff,
+  0x00, 0x00, 0x34, 0x00, 0x6d, 0x00, 0x03, 0x1a, 0x53, 0x54, 0xa7, 0x0f,
+  0xac, 0x02, 0x2a, 0x53, 0x54, 0x34, 0xff, 0xff, 0x0f, 0x0f, 0x34, 0x00,
+  0x6d, 0x00, 0x03, 0x84, 0xfc, 0xe2, 0xd0, 0xff, 0x1e, 0x02, 0x83, 0xfc,
+  0xe2, 0xb1, 0xff, 0xff, 0xff, 0xff, 0xb1, 0x00, 0x6e, 0x00, 0x03, 0x19,
+  0xf6, 0xf3, 0x45, 0xaa, 0x0d, 0x02, 0x19, 0xf6, 0xf3, 0xf4, 0xff, 0xff,
+  0xaa, 0xd5, 0xf4, 0x00, 0x6e, 0x00, 0x03, 0x6d, 0xd4, 0x84, 0x08, 0x00,
+  0x7c, 0x02, 0x6d, 0xd4, 0x84, 0x3a, 0xff, 0xff, 0x00, 0x00, 0x3a, 0x00,
+  0x6e, 0x00, 0x03, 0xe6, 0x48, 0x20, 0x2e, 0xff, 0xe0, 0x02, 0xe6, 0x48,
+  0x20, 0x3d, 0xff, 0xff, 0xff, 0x7f, 0x3d, 0x00, 0x6e, 0x00, 0x03, 0x26,
+  0x29, 0x2b, 0xff, 0x41, 0xd5, 0x02, 0x26, 0x29, 0x2b, 0xfd, 0xff, 0xff,
+  0x41, 0xa0, 0xfd, 0x00, 0x6e, 0x00, 0x03, 0xde, 0x68, 0x56, 0xa3, 0xff,
+  0xaa, 0x02, 0xde, 0x68, 0x56, 0xb1, 0xff, 0xff, 0xff, 0xff, 0xb1, 0x00,
+  0x6e, 0x00, 0x03, 0x22, 0xc2, 0x2e, 0x79, 0x3f, 0xd2, 0x02, 0x22, 0xc2,
+  0x2e, 0xf9, 0xff, 0xff, 0x3f, 0x9f, 0xf9, 0x00, 0x6f, 0x00, 0x03, 0xae,
+  0xda, 0x8f, 0x44, 0x02, 0x71, 0x02, 0xaf, 0xda, 0x8f, 0xb4, 0xff, 0xff,
+  0x02, 0x01, 0xb4, 0x00, 0x6f, 0x00, 0x03, 0x34, 0xa5, 0x8b, 0x16, 0xc0,
+  0x75, 0x02, 0x94, 0xa5, 0x8b, 0xf4, 0xff, 0xff, 0xc0, 0x60, 0xf4, 0x00,
+  0x6f, 0x00, 0x03, 0x21, 0x00, 0x7b, 0x03, 0x40, 0x85, 0x02, 0xc1, 0x00,
+  0x7b, 0xb0, 0xff, 0xff, 0x40, 0xa0, 0xb0, 0x00, 0x6f, 0x00, 0x03, 0x8c,
+  0x5a, 0x46, 0x87, 0x00, 0xba, 0x02, 0x0c, 0x5a, 0x46, 0x75, 0xff, 0xff,
+  0x00, 0x80, 0x75, 0x00, 0x6f, 0x00, 0x03, 0xca, 0x99, 0xc3, 0xe7, 0xfe,
+  0x3d, 0x02, 0xc9, 0x99, 0xc3, 0xb5, 0xff, 0xff, 0xfe, 0xff, 0xb5, 0x00,
+  0x6f, 0x00, 0x03, 0xe8, 0x29, 0x56, 0x75, 0x80, 0xaa, 0x02, 0xa8, 0x29,
+  0x56, 0xb5, 0xff, 0xff, 0x80, 0xc0, 0xb5, 0x00, 0x70, 0x01, 0x48, 0xdd,
+  0x8b, 0x2d, 0x4d, 0x94, 0x00, 0x03, 0xdd, 0x8b, 0x2d, 0x7d, 0xff, 0xff,
+  0x94, 0x94, 0x7d, 0x00, 0x70, 0x01, 0x48, 0xe5, 0xb6, 0x81, 0x00, 0xba,
+  0x00, 0x03, 0xe5, 0xb6, 0x81, 0x30, 0xff, 0xfe, 0xba, 0xba, 0xe5, 0x00,
+  0x70, 0x01, 0x48, 0xc4, 0x49, 0x1f, 0x79, 0x97, 0x00, 0x03, 0xc4, 0x49,
+  0x1f, 0x79, 0xff, 0xff, 0x97, 0x97, 0x79, 0x00, 0x70, 0x01, 0x48, 0x8a,
+  0x51, 0x3c, 0x17, 0x6a, 0x00, 0x03, 0x8a, 0x51, 0x3c, 0x37, 0xff, 0xfe,
+  0x6a, 0x6a, 0x8a, 0x00, 0x70, 0x01, 0x48, 0x13, 0x4e, 0x23, 0x9d, 0x2c,
+  0x00, 0x03, 0x13, 0x4e, 0x23, 0xbd, 0xff, 0xfe, 0x2c, 0x2c, 0x13, 0x00,
+  0x70, 0x01, 0x48, 0x1e, 0x31, 0x8d, 0x2a, 0xda, 0x00, 0x03, 0x1e, 0x31,
+  0x8d, 0x3a, 0xff, 0xfe, 0xda, 0xda, 0x1e, 0x00, 0x70, 0x01, 0x48, 0x2a,
+  0xf9, 0x93, 0x69, 0xfc, 0x00, 0x03, 0x2a, 0xf9, 0x93, 0x79, 0xff, 0xff,
+  0xfc, 0xfc, 0x79, 0x00, 0x70, 0x01, 0x48, 0x31, 0x91, 0x34, 0x8e, 0xfe,
+  0x00, 0x03, 0x31, 0x91, 0x34, 0xbe, 0xff, 0xfe, 0xfe, 0xfe, 0x31, 0x00,
+  0x70, 0x01, 0x48, 0x59, 0x22, 0xd6, 0xd1, 0x24, 0x00, 0x03, 0x59, 0x22,
+  0xd6, 0xf1, 0xff, 0xff, 0x24, 0x24, 0xf1, 0x00, 0x70, 0x01, 0x48, 0x66,
+  0x62, 0x5d, 0xba, 0xcd, 0x00, 0x03, 0x66, 0x62, 0x5d, 0xba, 0xff, 0xfe,
+  0xcd, 0xcd, 0x66, 0x00, 0x70, 0x01, 0x48, 0xe0, 0xe4, 0xe9, 0xd8, 0x17,
+  0x00, 0x03, 0xe0, 0xe4, 0xe9, 0xf8, 0xff, 0xff, 0x17, 0x17, 0xf8, 0x00,
+  0x70, 0x01, 0x48, 0x15, 0x2d, 0xba, 0x2e, 0x35, 0x00, 0x03, 0x15, 0x2d,
+  0xba, 0x3e, 0xff, 0xfe, 0x35, 0x35, 0x15, 0x00, 0x70, 0x01, 0x48, 0x23,
+  0x0c, 0x0d, 0xe9, 0x70, 0x00, 0x03, 0x23, 0x0c, 0x0d, 0xf9, 0xff, 0xff,
+  0x70, 0x70, 0xf9, 0x00, 0x70, 0x01, 0x48, 0x67, 0x60, 0x2f, 0x5d, 0xcf,
+  0x00, 0x03, 0x67, 0x60, 0x2f, 0x7d, 0xff, 0xff, 0xcf, 0xcf, 0x7d, 0x00,
+  0x70, 0x01, 0x48, 0x89, 0x82, 0x85, 0x82, 0xa5, 0x00, 0x03, 0x89, 0x82,
+  0x85, 0xb2, 0xff, 0xfe, 0xa5, 0xa5, 0x89, 0x00, 0x70, 0x01, 0x48, 0x25,
+  0xf4, 0xf0, 0x9e, 0x7b, 0x00, 0x03, 0x25, 0xf4, 0xf0, 0xbe, 0xff, 0xfe,
+  0x7b, 0x7b, 0x25, 0x00, 0x70, 0x01, 0x48, 0x47, 0xf9, 0xda, 0xc7, 0xed,
+  0x00, 0x03, 0x47, 0xf9, 0xda, 0xf7, 0xff, 0xff, 0xed, 0xed, 0xf7, 0x00,
+  0x70, 0x01, 0x48, 0x11, 0x4a, 0xf3, 0x9d, 0xb3, 0x00, 0x03, 0x11, 0x4a,
+  0xf3, 0xbd, 0xff, 0xfe, 0xb3, 0xb3, 0x11, 0x00, 0x70, 0x01, 0x48, 0x32,
+  0x5c, 0x1b, 0x7f, 0xf5, 0x00, 0x03, 0x32, 0x5c, 0x1b, 0x7f, 0xff, 0xff,
+  0xf5, 0xf5, 0x7f, 0x00, 0x70, 0x01, 0x48, 0x65, 0xd9, 0xf1, 0xbe, 0x2d,
+  0x00, 0x03, 0x65, 0xd9, 0xf1, 0xbe, 0xff, 0xfe, 0x2d, 0x2d, 0x65, 0x00,
+  0x70, 0x00, 0x48, 0x5f, 0xfe, 0x00, 0xf4, 0x32, 0x00, 0x03, 0x5f, 0xfe,
+  0x00, 0xf4, 0xff, 0xfe, 0x32, 0x32, 0x5f, 0x00, 0x70, 0x00, 0x48, 0xad,
+  0x06, 0xed, 0x48, 0x08, 0x00, 0x03, 0xad, 0x06, 0xed, 0x78, 0xff, 0xfe,
+  0x08, 0x08, 0xad, 0x00, 0x70, 0x00, 0x48, 0x77, 0xfe, 0x63, 0x9f, 0x12,
+  0x00, 0x03, 0x77, 0xfe, 0x63, 0xbf, 0xff, 0xfe, 0x12, 0x12, 0x77, 0x00,
+  0x70, 0x00, 0x48, 0x43, 0x21, 0x76, 0x16, 0x5c, 0x00, 0x03, 0x43, 0x21,
+  0x76, 0x36, 0xff, 0xfe, 0x5c, 0x5c, 0x43, 0x00, 0x71, 0x42, 0x48, 0x5e,
+  0xa1, 0x00, 0x84, 0xc0, 0x00, 0x03, 0x1e, 0xa1, 0x00, 0x35, 0xff, 0xfe,
+  0xc0, 0xc0, 0x1e, 0x00, 0x71, 0x42, 0x48, 0x35, 0xa6, 0x00, 0xa4, 0x0f,
+  0x00, 0x03, 0x44, 0xa6, 0x00, 0x34, 0xff, 0xfe, 0x0f, 0x0f, 0x44, 0x00,
+  0x71, 0x42, 0x48, 0xab, 0x5c, 0x01, 0x57, 0xc0, 0xff, 0x02, 0x6c, 0x5c,
+  0x01, 0x75, 0xff, 0xfe, 0xc0, 0xc0, 0x6c, 0x00, 0x71, 0x42, 0x48, 0xe6,
+  0xcb, 0x01, 0xc4, 0x01, 0xff, 0x02, 0xe7, 0xcb, 0x01, 0xb4, 0xff, 0xfe,
+  0x01, 0x01, 0xe7, 0x00, 0x71, 0x42, 0x48, 0xe1, 0x04, 0x7f, 0xa4, 0x58,
+  0x81, 0x02, 0x39, 0x04, 0x7f, 0x35, 0xff, 0xfe, 0x58, 0x58, 0x39, 0x00,
+  0x71, 0x42, 0x48, 0x12, 0xf5, 0x7f, 0xe4, 0x01, 0x81, 0x02, 0x13, 0xf5,
+  0x7f, 0x34, 0xff, 0xfe, 0x01, 0x01, 0x13, 0x00, 0x71, 0x42, 0x48, 0x2b,
+  0xa6, 0xd5, 0xd7, 0xaa, 0x2b, 0x02, 0xd6, 0xa6, 0xd5, 0xb4, 0xff, 0xfe,
+  0xaa, 0xaa, 0xd6, 0x00, 0x71, 0x42, 0x48, 0x0c, 0xa0, 0xd5, 0xd3, 0xc0,
+  0x2b, 0x02, 0xcd, 0xa0, 0xd5, 0xb0, 0xff, 0xfe, 0xc0, 0xc0, 0xcd, 0x00,
+  0x71, 0x42, 0x48, 0xa4, 0x0f, 0xff, 0x45, 0x8d, 0x01, 0x02, 0x32, 0x0f,
+  0xff, 0x75, 0xff, 0xfe, 0x8d, 0x8d, 0x32, 0x00, 0x71, 0x42, 0x48, 0x07,
+  0xc6, 0xff, 0xa2, 0xaa, 0x01, 0x02, 0xb1, 0xc6, 0xff, 0xb0, 0xff, 0xfe,
+  0xaa, 0xaa, 0xb1, 0x00, 0x73, 0x42, 0x48, 0x02, 0x48, 0x00, 0xc0, 0x7f,
+  0x00, 0x03, 0x42, 0x48, 0x00, 0x30, 0xff, 0xfe, 0x7f, 0x3f, 0x42, 0x00,
+  0x73, 0x42, 0x48, 0x78, 0x11, 0x00, 0x23, 0x00, 0x00, 0x03, 0xf8, 0x11,
+  0x00, 0xb0, 0xff, 0xfe, 0x00, 0x80, 0xf8, 0x00, 0x73, 0x42, 0x48, 0x97,
+  0x80, 0x01, 0x83, 0x81, 0xff, 0x02, 0x58, 0x80, 0x01, 0x71, 0xff, 0xfe,
+  0x81, 0xc0, 0x58, 0x00, 0x73, 0x42, 0x48, 0x6b, 0xde, 0x01, 0x11, 0x00,
+  0xff, 0x02, 0xeb, 0xde, 0x01, 0xb0, 0xff, 0xfe, 0x00, 0x80, 0xeb, 0x00,
+  0x73, 0x42, 0x48, 0x60, 0x43, 0x7f, 0x87, 0x00, 0x81, 0x02, 0xe0, 0x43,
+  0x7f, 0xb4, 0xff, 0xfe, 0x00, 0x80, 0xe0, 0x00, 0x73, 0x42, 0x48, 0x6b,
+  0xb5, 0x7f, 0x60, 0x02, 0x81, 0x02, 0x6c, 0xb5, 0x7f, 0x30, 0xff, 0xfe,
+  0x02, 0x01, 0x6c, 0x00, 0x73, 0x42, 0x48, 0x05, 0x03, 0xd5, 0xa1, 0x0f,
+  0x2b, 0x02, 0x8d, 0x03, 0xd5, 0xb0, 0xff, 0xfe, 0x0f, 0x87, 0x8d, 0x00,
+  0x73, 0x42, 0x48, 0x72, 0x6f, 0xd5, 0x56, 0xaa, 0x2b, 0x02, 0xc7, 0x6f,
+  0xd5, 0xf4, 0xff, 0xfe, 0xaa, 0x55, 0xc7, 0x00, 0x73, 0x42, 0x48, 0xe0,
+  0xb6, 0xff, 0xb7, 0x40, 0x01, 0x02, 0x80, 0xb6, 0xff, 0xb5, 0xff, 0xfe,
+  0x40, 0xa0, 0x80, 0x00, 0x73, 0x42, 0x48, 0xe4, 0xc6, 0xff, 0xa3, 0x40,
+  0x01, 0x02, 0x84, 0xc6, 0xff, 0xb1, 0xff, 0xfe, 0x40, 0xa0, 0x84, 0x00,
+  0x74, 0x30, 0x48, 0xac, 0x00, 0xb8, 0xb8, 0x3f, 0x48, 0x02, 0xac, 0x00,
+  0xb8, 0xb8, 0xff, 0xfe, 0x3f, 0x3f, 0xac, 0x00, 0x74, 0x30, 0x48, 0x9a,
+  0x00, 0xdf, 0x44, 0xfe, 0x21, 0x02, 0x9a, 0x00, 0xdf, 0x74, 0xff, 0xfe,
+  0xfe, 0xfe, 0x9a, 0x00, 0x74, 0x2f, 0x48, 0x5f, 0x01, 0xf8, 0x60, 0xc0,
+  0x08, 0x02, 0x5f, 0x01, 0xf8, 0x70, 0xff, 0xfe, 0xc0, 0xc0, 0x5f, 0x00,
+  0x74, 0x2f, 0x48, 0x95, 0x01, 0xcc, 0x13, 0x81, 0x34, 0x02, 0x95, 0x01,
+  0xcc, 0x33, 0xff, 0xfe, 0x81, 0x81, 0x95, 0x00, 0x74, 0xb1, 0x48, 0xe8,
+  0x7f, 0x52, 0x6b, 0x80, 0xae, 0x02, 0xe8, 0x7f, 0x52, 0x7b, 0xff, 0xfe,
+  0x80, 0x80, 0xe8, 0x00, 0x74, 0xb1, 0x48, 0x4c, 0x7f, 0x70, 0x02, 0x80,
+  0x90, 0x02, 0x4c, 0x7f, 0x70, 0x32, 0xff, 0xfe, 0x80, 0x80, 0x4c, 0x00,
+  0x74, 0x5b, 0x48, 0x87, 0xd5, 0xb8, 0x91, 0xc0, 0x48, 0x02, 0x87, 0xd5,
+  0xb8, 0xb1, 0xff, 0xfe, 0xc0, 0xc0, 0x87, 0x00, 0x74, 0x5b, 0x48, 0x7d,
+  0xd5, 0x4f, 0x82, 0x02, 0xb1, 0x02, 0x7d, 0xd5, 0x4f, 0xb2, 0xff, 0xfe,
+  0x02, 0x02, 0x7d, 0x00, 0x74, 0x31, 0x48, 0x73, 0xff, 0xc2, 0xc5, 0x02,
+  0x3e, 0x02, 0x73, 0xff, 0xc2, 0xf5, 0xff, 0xfe, 0x02, 0x02, 0x73, 0x00,
+  0x74, 0x31, 0x48, 0x9b, 0xff, 0x05, 0x96, 0x80, 0xfb, 0x02, 0x9b, 0xff,
+  0x05, 0xb6, 0xff, 0xfe, 0x80, 0x80, 0x9b, 0x00, 0x75, 0x30, 0x48, 0x07,
+  0x00, 0x40, 0xb7, 0xff, 0xc0, 0x02, 0x07, 0x00, 0x40, 0x35, 0xff, 0xfe,
+  0xff, 0xff, 0x07, 0x00, 0x75, 0x30, 0x48, 0x55, 0x00, 0xb9, 0x61, 0x81,
+  0x47, 0x02, 0xd7, 0x00, 0xb9, 0xb0, 0xff, 0xfe, 0x81, 0x81, 0xd7, 0x00,
+  0x75, 0x2f, 0x48, 0xbc, 0x01, 0x0d, 0x14, 0x01, 0xf3, 0x02, 0xbd, 0x01,
+  0x0d, 0xb4, 0xff, 0xfe, 0x01, 0x01, 0xbd, 0x00, 0x75, 0x2f, 0x48, 0x1e,
+  0x01, 0xea, 0xb0, 0xfe, 0x16, 0x02, 0x1c, 0x01, 0xea, 0x31, 0xff, 0xfe,
+  0xfe, 0xfe, 0x1c, 0x00, 0x75, 0xb1, 0x48, 0xfd, 0x7f, 0x00, 0x01, 0xc0,
+  0x00, 0x03, 0xbe, 0x7f, 0x00, 0xb1, 0xff, 0xfe, 0xc0, 0xc0, 0xbe, 0x00,
+  0x75, 0xb1, 0x48, 0x29, 0x7f, 0x96, 0xc5, 0x40, 0x6a, 0x02, 0x6a, 0x7f,
+  0x96, 0x34, 0xff, 0xfe, 0x40, 0x40, 0x6a, 0x00, 0x75, 0x5b, 0x48, 0xe9,
+  0xd5, 0x47, 0xc7, 0xff, 0xb9, 0x02, 0xe9, 0xd5, 0x47, 0xb5, 0xff, 0xfe,
+  0xff, 0xff, 0xe9, 0x00, 0x75, 0x5b, 0x48, 0x8b, 0xd5, 0x5c, 0x87, 0xcb,
+  0xa4, 0x02, 0x57, 0xd5, 0x5c, 0x75, 0xff, 0xfe, 0xcb, 0xcb, 0x57, 0x00,
+  0x75, 0x31, 0x48, 0x1a, 0xff, 0x62, 0x54, 0x41, 0x9e, 0x02, 0x5b, 0xff,
+  0x62, 0x34, 0xff, 0xfe, 0x41, 0x41, 0x5b, 0x00, 0x75, 0x31, 0x48, 0xc9,
+  0xff, 0x8f, 0xc1, 0x3f, 0x71, 0x02, 0x09, 0xff, 0x8f, 0x31, 0xff, 0xfe,
+  0x3f, 0x3f, 0x09, 0x00, 0x76, 0x30, 0x48, 0x94, 0x00, 0x6d, 0x62, 0x40,
+  0x93, 0x02, 0x94, 0x00, 0x6d, 0x70, 0xff, 0xfe, 0x20, 0x40, 0x94, 0x00,
+  0x76, 0x30, 0x48, 0x44, 0x00, 0x49, 0x13, 0xff, 0xb7, 0x02, 0x44, 0x00,
+  0x49, 0xb1, 0xff, 0xfe, 0xff, 0xff, 0x44, 0x00, 0x76, 0x2f, 0x48, 0x09,
+  0x01, 0xcf, 0x3f, 0xaa, 0x31, 0x02, 0x09, 0x01, 0xcf, 0xbc, 0xff, 0xfe,
+  0xd5, 0xaa, 0x09, 0x00, 0x76, 0x2f, 0x48, 0x35, 0x01, 0x5f, 0x4d, 0xaa,
+  0xa1, 0x02, 0x35, 0x01, 0x5f, 0xfc, 0xff, 0xfe, 0xd5, 0xaa, 0x35, 0x00,
+  0x76, 0xb1, 0x48, 0x15, 0x7f, 0x14, 0x2c, 0x0f, 0xec, 0x02, 0x15, 0x7f,
+  0x14, 0x3d, 0xff, 0xfe, 0x07, 0x0f, 0x15, 0x00, 0x76, 0xb1, 0x48, 0xde,
+  0x7f, 0x20, 0xc4, 0x81, 0xe0, 0x02, 0xde, 0x7f, 0x20, 0x75, 0xff, 0xfe,
+  0x40, 0x81, 0xde, 0x00, 0x76, 0x5b, 0x48, 0x30, 0xd5, 0xb7, 0xcc, 0xfe,
+  0x49, 0x02, 0x30, 0xd5, 0xb7, 0x7c, 0xff, 0xfe, 0x7f, 0xfe, 0x30, 0x00,
+  0x76, 0x5b, 0x48, 0x2e, 0xd5, 0x73, 0x81, 0x00, 0x8d, 0x02, 0x2e, 0xd5,
+  0x73, 0xb0, 0xff, 0xfe, 0x80, 0x00, 0x2e, 0x00, 0x76, 0x31, 0x48, 0xbd,
+  0xff, 0x2b, 0xf7, 0xfe, 0xd5, 0x02, 0xbd, 0xff, 0x2b, 0xf4, 0xff, 0xfe,
+  0xff, 0xfe, 0xbd, 0x00, 0x76, 0x31, 0x48, 0x36, 0xff, 0xa2, 0xd4, 0x01,
+  0x5e, 0x02, 0x36, 0xff, 0xa2, 0x77, 0xff, 0xfe, 0x00, 0x01, 0x36, 0x00,
+  0x77, 0x30, 0x48, 0x30, 0x00, 0xf6, 0xe4, 0x01, 0x0a, 0x02, 0x31, 0x00,
+  0xf6, 0x34, 0xff, 0xfe, 0x00, 0x01, 0x31, 0x00, 0x77, 0x30, 0x48, 0x87,
+  0x00, 0x25, 0xe6, 0xfe, 0xdb, 0x02, 0x06, 0x00, 0x25, 0x35, 0xff, 0xfe,
+  0x7f, 0xfe, 0x06, 0x00, 0x77, 0x2f, 0x48, 0xcb, 0x01, 0x8c, 0xb0, 0x01,
+  0x74, 0x02, 0xcc, 0x01, 0x8c, 0xb0, 0xff, 0xfe, 0x00, 0x01, 0xcc, 0x00,
+  0x77, 0x2f, 0x48, 0x52, 0x01, 0x44, 0xe2, 0xff, 0xbc, 0x02, 0xd2, 0x01,
+  0x44, 0xf0, 0xff, 0xfe, 0x7f, 0xff, 0xd2, 0x00, 0x77, 0xb1, 0x48, 0x51,
+  0x7f, 0x0a, 0x76, 0xe2, 0xf6, 0x02, 0xc2, 0x7f, 0x0a, 0xf4, 0xff, 0xfe,
+  0x71, 0xe2, 0xc2, 0x00, 0x77, 0xb1, 0x48, 0x4a, 0x7f, 0x37, 0xb6, 0x02,
+  0xc9, 0x02, 0x4b, 0x7f, 0x37, 0x34, 0xff, 0xfe, 0x01, 0x02, 0x4b, 0x00,
+  0x77, 0x5b, 0x48, 0xba, 0xd5, 0x99, 0x37, 0x00, 0x67, 0x02, 0x3a, 0xd5,
+  0x99, 0x75, 0xff, 0xfe, 0x80, 0x00, 0x3a, 0x00, 0x77, 0x5b, 0x48, 0xde,
+  0xd5, 0x34, 0xf1, 0x02, 0xcc, 0x02, 0x5f, 0xd5, 0x34, 0x71, 0xff, 0xfe,
+  0x81, 0x02, 0x5f, 0x00, 0x77, 0x31, 0x48, 0x3f, 0xff, 0x24, 0xb7, 0x81,
+  0xdc, 0x02, 0x00, 0xff, 0x24, 0x37, 0xff, 0xfe, 0xc0, 0x81, 0x00, 0x00,
+  0x77, 0x31, 0x48, 0x13, 0xff, 0xce, 0x37, 0x0f, 0x32, 0x02, 0x9b, 0xff,
+  0xce, 0xb4, 0xff, 0xfe, 0x87, 0x0f, 0x9b, 0x00, 0x78, 0x48, 0x48, 0x2d,
+  0xf3, 0x67, 0xac, 0xff, 0x99, 0x02, 0x2d, 0xf3, 0x67, 0xbc, 0xff, 0xfd,
+  0xff, 0xff, 0x2d, 0x00, 0x78, 0x48, 0x48, 0x60, 0x94, 0xf5, 0xf9, 0xc0,
+  0x0b, 0x02, 0x60, 0x94, 0xf5, 0xfd, 0xff, 0xfd, 0xc0, 0xc0, 0x60, 0x00,
+  0x78, 0x48, 0x48, 0xb1, 0x51, 0xe0, 0x4c, 0x89, 0x20, 0x02, 0xb1, 0x51,
+  0xe0, 0x7c, 0xff, 0xfd, 0x89, 0x89, 0xb1, 0x00, 0x78, 0x48, 0x48, 0xc8,
+  0x39, 0x86, 0x6a, 0x81, 0x7a, 0x02, 0xc8, 0x39, 0x86, 0x7e, 0xff, 0xfd,
+  0x81, 0x81, 0xc8, 0x00, 0x78, 0x48, 0x48, 0xa5, 0x8d, 0x7f, 0x4c, 0x3f,
+  0x81, 0x02, 0xa5, 0x8d, 0x7f, 0x7c, 0xff, 0xfd, 0x3f, 0x3f, 0xa5, 0x00,
+  0x78, 0x48, 0x48, 0xc3, 0x92, 0x92, 0x71, 0xaa, 0x6e, 0x02, 0xc3, 0x92,
+  0x92, 0x75, 0xff, 0xfd, 0xaa, 0xaa, 0xc3, 0x00, 0x79, 0x00, 0x03, 0xa8,
+  0x83, 0x00, 0xf7, 0x30, 0x00, 0x03, 0xd9, 0x83, 0x00, 0xb4, 0xff, 0xff,
+  0x30, 0x30, 0xb4, 0x00, 0x79, 0x00, 0x03, 0xbc, 0xd2, 0x00, 0xf6, 0x01,
+  0x00, 0x03, 0xbd, 0xd2, 0x00, 0xb4, 0xff, 0xff, 0x01, 0x01, 0xb4, 0x00,
+  0x79, 0xff, 0x02, 0xef, 0x1b, 0x01, 0x62, 0x01, 0xff, 0x02, 0xf0, 0x1b,
+  0x01, 0xb0, 0xff, 0xff, 0x01, 0x01, 0xb0, 0x00, 0x79, 0xff, 0x02, 0x70,
+  0x7f, 0x01, 0xd6, 0x3f, 0xff, 0x02, 0xaf, 0x7f, 0x01, 0xf4, 0xff, 0xff,
+  0x3f, 0x3f, 0xf4, 0x00, 0x79, 0x81, 0x02, 0x76, 0x68, 0x7f, 0x75, 0x3f,
+  0x81, 0x02, 0xb6, 0x68, 0x7f, 0xf4, 0xff, 0xff, 0x3f, 0x3f, 0xf4, 0x00,
+  0x79, 0x81, 0x02, 0x7b, 0x12, 0x7f, 0x10, 0x40, 0x81, 0x02, 0xbb, 0x12,
+  0x7f, 0xf0, 0xff, 0xff, 0x40, 0x40, 0xf0, 0x00, 0x79, 0x2b, 0x02, 0x00,
+  0x54, 0xd5, 0x57, 0x7f, 0x2b, 0x02, 0x80, 0x54, 0xd5, 0xf4, 0xff, 0xff,
+  0x7f, 0x7f, 0xf4, 0x00, 0x79, 0x2b, 0x02, 0x14, 0x36, 0xd5, 0x72, 0xaa,
+  0x2b, 0x02, 0xbe, 0x36, 0xd5, 0xb0, 0xff, 0xff, 0xaa, 0xaa, 0xb0, 0x00,
+  0x79, 0x01, 0x02, 0xb7, 0x11, 0xff, 0xf7, 0xfe, 0x01, 0x02, 0xb6, 0x11,
+  0xff, 0xb5, 0xff, 0xff, 0xfe, 0xfe, 0xb5, 0x00, 0x79, 0x01, 0x02, 0x63,
+  0x6e, 0xff, 0x62, 0x01, 0x01, 0x02, 0x64, 0x6e, 0xff, 0x30, 0xff, 0xff,
+  0x01, 0x01, 0x30, 0x00, 0x7a, 0x48, 0x48, 0x35, 0x48, 0x54, 0x68, 0x00,
+  0xac, 0x02, 0x35, 0x48, 0x54, 0x78, 0xff, 0xfd, 0x00, 0x00, 0x35, 0x00,
+  0x7a, 0x48, 0x48, 0x6f, 0x0a, 0x6e, 0xd0, 0x81, 0x92, 0x02, 0x6f, 0x0a,
+  0x6e, 0xf0, 0xff, 0xfd, 0x81, 0x81, 0x6f, 0x00, 0x7a, 0x48, 0x48, 0x07,
+  0x65, 0x05, 0xe0, 0xc0, 0xfb, 0x02, 0x07, 0x65, 0x05, 0xf0, 0xff, 0xfd,
+  0xc0, 0xc0, 0x07, 0x00, 0x7a, 0x48, 0x48, 0x58, 0xb7, 0xc6, 0x95, 0x3f,
+  0x3a, 0x02, 0x58, 0xb7, 0xc6, 0xb5, 0xff, 0xfd, 0x3f, 0x3f, 0x58, 0x00,
+  0x7b, 0x00, 0x03, 0x60, 0xce, 0x00, 0xc1, 0x19, 0x00, 0x03, 0xed, 0xce,
+  0x00, 0xb0, 0xff, 0xff, 0x19, 0x8c, 0xb0, 0x00, 0x7b, 0x00, 0x03, 0x4c,
+  0x0e, 0x00, 0xe0, 0x0f, 0x00, 0x03, 0x54, 0x0e, 0x00, 0x30, 0xff, 0xff,
+  0x0f, 0x07, 0x30, 0x00, 0x7b, 0xff, 0x02, 0xc0, 0x88, 0x01, 0x42, 0x41,
+  0xff, 0x02, 0xe1, 0x88, 0x01, 0xb0, 0xff, 0xff, 0x41, 0x20, 0xb0, 0x00,
+  0x7b, 0xff, 0x02, 0x3c, 0xc2, 0x01, 0x25, 0xd0, 0xff, 0x02, 0x24, 0xc2,
+  0x01, 0x35, 0xff, 0xff, 0xd0, 0xe8, 0x35, 0x00, 0x7b, 0x81, 0x02, 0x67,
+  0xe6, 0x7f, 0x47, 0x01, 0x81, 0x02, 0xe8, 0xe6, 0x7f, 0xb4, 0xff, 0xff,
+  0x01, 0x80, 0xb4, 0x00, 0x7b, 0x81, 0x02, 0x39, 0x5f, 0x7f, 0x36, 0x02,
+  0x81, 0x02, 0x3a, 0x5f, 0x7f, 0x34, 0xff, 0xff, 0x02, 0x01, 0x34, 0x00,
+  0x7b, 0x2b, 0x02, 0x8a, 0x51, 0xd5, 0x72, 0x41, 0x2b, 0x02, 0xab, 0x51,
+  0xd5, 0xb0, 0xff, 0xff, 0x41, 0x20, 0xb0, 0x00, 0x7b, 0x2b, 0x02, 0x74,
+  0xb1, 0xd5, 0x51, 0x81, 0x2b, 0x02, 0x35, 0xb1, 0xd5, 0x31, 0xff, 0xff,
+  0x81, 0xc0, 0x31, 0x00, 0x7b, 0x01, 0x02, 0xbb, 0xec, 0xff, 0x24, 0x02,
+  0x01, 0x02, 0xbc, 0xec, 0xff, 0xb4, 0xff, 0xff, 0x02, 0x01, 0xb4, 0x00,
+  0x7b, 0x01, 0x02, 0xdb, 0x54, 0xff, 0x34, 0xaa, 0x01, 0x02, 0x30, 0x54,
+  0xff, 0x35, 0xff, 0xff, 0xaa, 0x55, 0x35, 0x00, 0x7c, 0x00, 0x03, 0xaa,
+  0x00, 0x81, 0x77, 0x7f, 0x7f, 0x02, 0xaa, 0x00, 0x81, 0x77, 0xff, 0xff,
+  0x7f, 0x7f, 0x77, 0x00, 0x7c, 0x00, 0x03, 0xfb, 0x00, 0x77, 0xd3, 0x41,
+  0x89, 0x02, 0xfb, 0x00, 0x77, 0xf3, 0xff, 0xff, 0x41, 0x41, 0xf3, 0x00,
+  0x7c, 0xff, 0x02, 0x6b, 0x01, 0x42, 0x8a, 0x40, 0xbe, 0x02, 0x6b, 0x01,
+  0x42, 0xba, 0xff, 0xff, 0x40, 0x40, 0xba, 0x00, 0x7c, 0xff, 0x02, 0xfc,
+  0x01, 0x27, 0x2e, 0x3f, 0xd9, 0x02, 0xfc, 0x01, 0x27, 0x3e, 0xff, 0xff,
+  0x3f, 0x3f, 0x3e, 0x00, 0x7c, 0x81, 0x02, 0xa3, 0x7f, 0xf3, 0xc3, 0x02,
+  0x0d, 0x02, 0xa3, 0x7f, 0xf3, 0xf3, 0xff, 0xff, 0x02, 0x02, 0xf3, 0x00,
+  0x7c, 0x81, 0x02, 0x07, 0x7f, 0x54, 0x98, 0x7f, 0xac, 0x02, 0x07, 0x7f,
+  0x54, 0xb8, 0xff, 0xff, 0x7f, 0x7f, 0xb8, 0x00, 0x7c, 0x2b, 0x02, 0x5a,
+  0xd5, 0x80, 0xa7, 0x7f, 0x80, 0x02, 0x5a, 0xd5, 0x80, 0xb7, 0xff, 0xff,
+  0x7f, 0x7f, 0xb7, 0x00, 0x7c, 0x2b, 0x02, 0xf8, 0xd5, 0xf4, 0xd6, 0x0b,
+  0x0c, 0x02, 0xf8, 0xd5, 0xf4, 0xf6, 0xff, 0xff, 0x0b, 0x0b, 0xf6, 0x00,
+  0x7c, 0x01, 0x02, 0xe3, 0xff, 0xd7, 0x5d, 0xaa, 0x29, 0x02, 0xe3, 0xff,
+  0xd7, 0x7d, 0xff, 0xff, 0xaa, 0xaa, 0x7d, 0x00, 0x7c, 0x01, 0x02, 0xec,
+  0xff, 0x35, 0x02, 0x80, 0xcb, 0x02, 0xec, 0xff, 0x35, 0x32, 0xff, 0xff,
+  0x80, 0x80, 0x32, 0x00, 0x7d, 0x00, 0x03, 0xf2, 0x00, 0x87, 0x34, 0x00,
+  0x79, 0x02, 0xf2, 0x00, 0x87, 0xb4, 0xff, 0xff, 0x00, 0x00, 0xb4, 0x00,
+  0x7d, 0x00, 0x03, 0x1d, 0x00, 0x69, 0x65, 0xff, 0x97, 0x02, 0x1d, 0x00,
+  0x69, 0x35, 0xff, 0xff, 0xff, 0xff, 0x35, 0x00, 0x7d, 0xff, 0x02, 0x47,
+  0x01, 0xd7, 0x82, 0x41, 0x29, 0x02, 0x88, 0x01, 0xd7, 0xf0, 0xff, 0xff,
+  0x41, 0x41, 0xf0, 0x00, 0x7d, 0xff, 0x02, 0x15, 0x01, 0xdd, 0x14, 0x41,
+  0x23, 0x02, 0x56, 0x01, 0xdd, 0x34, 0xff, 0xff, 0x41, 0x41, 0x34, 0x00,
+  0x7d, 0x81, 0x02, 0x03, 0x7f, 0xe3, 0x67, 0x7f, 0x1d, 0x02, 0x83, 0x7f,
+  0xe3, 0xf4, 0xff, 0xff, 0x7f, 0x7f, 0xf4, 0x00, 0x7d, 0x81, 0x02, 0xbf,
+  0x7f, 0xfd, 0x50, 0x02, 0x03, 0x02, 0xc1, 0x7f, 0xfd, 0xb0, 0xff, 0xff,
+  0x02, 0x02, 0xb0, 0x00, 0x7d, 0x2b, 0x02, 0x65, 0xd5, 0x19, 0xd7, 0x40,
+  0xe7, 0x02, 0xa6, 0xd5, 0x19, 0xf4, 0xff, 0xff, 0x40, 0x40, 0xf4, 0x00,
+  0x7d, 0x2b, 0x02, 0x86, 0xd5, 0xef, 0x10, 0x41, 0x11, 0x02, 0xc7, 0xd5,
+  0xef, 0xb0, 0xff, 0xff, 0x41, 0x41, 0xb0, 0x00, 0x7d, 0x01, 0x02, 0xe6,
+  0xff, 0xa0, 0xb2, 0x7f, 0x60, 0x02, 0x65, 0xff, 0xa0, 0x31, 0xff, 0xff,
+  0x7f, 0x7f, 0x31, 0x00, 0x7d, 0x01, 0x02, 0xb9, 0xff, 0x50, 0xc6, 0x80,
+  0xb0, 0x02, 0x39, 0xff, 0x50, 0x75, 0xff, 0xff, 0x80, 0x80, 0x75, 0x00,
+  0x7e, 0x00, 0x03, 0xf2, 0x00, 0x3c, 0xfd, 0x81, 0xc4, 0x02, 0xf2, 0x00,
+  0x3c, 0xfd, 0xff, 0xff, 0x81, 0xc0, 0xfd, 0x00, 0x7e, 0x00, 0x03, 0x9f,
+  0x00, 0xed, 0x9c, 0x36, 0x13, 0x02, 0x9f, 0x00, 0xed, 0x3c, 0xff, 0xff,
+  0x36, 0x1b, 0x3c, 0x00, 0x7e, 0xff, 0x02, 0x2b, 0x01, 0x7f, 0x1a, 0x40,
+  0x81, 0x02, 0x2b, 0x01, 0x7f, 0x38, 0xff, 0xff, 0x40, 0x20, 0x38, 0x00,
+  0x7e, 0xff, 0x02, 0xac, 0x01, 0xbd, 0xac, 0x81, 0x43, 0x02, 0xac, 0x01,
+  0xbd, 0x3d, 0xff, 0xff, 0x81, 0x40, 0x3d, 0x00, 0x7e, 0x81, 0x02, 0xaa,
+  0x7f, 0xdf, 0x0c, 0x80, 0x21, 0x02, 0xaa, 0x7f, 0xdf, 0x3c, 0xff, 0xff,
+  0x80, 0x40, 0x3c, 0x00, 0x7e, 0x81, 0x02, 0x94, 0x7f, 0xb6, 0x4c, 0x00,
+  0x4a, 0x02, 0x94, 0x7f, 0xb6, 0x7e, 0xff, 0xff, 0x00, 0x00, 0x7e, 0x00,
+  0x7e, 0x2b, 0x02, 0xec, 0xd5, 0x67, 0x0a, 0x81, 0x99, 0x02, 0xec, 0xd5,
+  0x67, 0x39, 0xff, 0xff, 0x81, 0x40, 0x39, 0x00, 0x7e, 0x2b, 0x02, 0xb2,
+  0xd5, 0x8e, 0xde, 0x81, 0x72, 0x02, 0xb2, 0xd5, 0x8e, 0x7d, 0xff, 0xff,
+  0x81, 0x40, 0x7d, 0x00, 0x7e, 0x01, 0x02, 0xd3, 0xff, 0xb2, 0xb1, 0x80,
+  0x4e, 0x02, 0xd3, 0xff, 0xb2, 0xb0, 0xff, 0xff, 0x80, 0xc0, 0xb0, 0x00,
+  0x7e, 0x01, 0x02, 0x53, 0xff, 0x71, 0x20, 0x01, 0x8f, 0x02, 0x53, 0xff,
+  0x71, 0x33, 0xff, 0xff, 0x01, 0x00, 0x33, 0x00, 0x7f, 0x00, 0x03, 0x6e,
+  0x00, 0xfb, 0x63, 0x80, 0x05, 0x02, 0x2e, 0x00, 0xfb, 0x31, 0xff, 0xff,
+  0x80, 0xc0, 0x31, 0x00, 0x7f, 0x00, 0x03, 0x59, 0x00, 0x4a, 0xa3, 0x41,
+  0xb6, 0x02, 0xfa, 0x00, 0x4a, 0xb0, 0xff, 0xff, 0x41, 0xa0, 0xb0, 0x00,
+  0x7f, 0xff, 0x02, 0x60, 0x01, 0xa0, 0x24, 0x00, 0x60, 0x02, 0x60, 0x01,
+  0xa0, 0x34, 0xff, 0xff, 0x00, 0x00, 0x34, 0x00, 0x7f, 0xff, 0x02, 0xd8,
+  0x01, 0xea, 0x63, 0x0f, 0x16, 0x02, 0x60, 0x01, 0xea, 0x71, 0xff, 0xff,
+  0x0f, 0x87, 0x71, 0x00, 0x7f, 0x81, 0x02, 0xdc, 0x7f, 0xd2, 0xd6, 0x41,
+  0x2e, 0x02, 0xfd, 0x7f, 0xd2, 0xb4, 0xff, 0xff, 0x41, 0x20, 0xb4, 0x00,
+  0x7f, 0x81, 0x02, 0xd1, 0x7f, 0xe3, 0x72, 0x81, 0x1d, 0x02, 0x12, 0x7f,
+  0xe3, 0x31, 0xff, 0xff, 0x81, 0x40, 0x31, 0x00, 0x7f, 0x2b, 0x02, 0x26,
+  0xd5, 0xd3, 0xa0, 0x02, 0x2d, 0x02, 0x27, 0xd5, 0xd3, 0x30, 0xff, 0xff,
+  0x02, 0x01, 0x30, 0x00, 0x7f, 0x2b, 0x02, 0x56, 0xd5, 0x83, 0x74, 0x3f,
+  0x7d, 0x02, 0x76, 0xd5, 0x83, 0x34, 0xff, 0xff, 0x3f, 0x1f, 0x34, 0x00,
+  0x7f, 0x01, 0x02, 0xcb, 0xff, 0xd5, 0x43, 0x7e, 0x2b, 0x02, 0x8a, 0xff,
+  0xd5, 0xb1, 0xff, 0xff, 0x7e, 0xbf, 0xb1, 0x00, 0x7f, 0x01, 0x02, 0x8f,
+  0xff, 0xbd, 0xb6, 0xb0, 0x43, 0x02, 0xe7, 0xff, 0xbd, 0xb4, 0xff, 0xff,
+  0xb0, 0x58, 0xb4, 0x00, 0x80, 0x02, 0x48, 0x08, 0xa2, 0xe6, 0x78, 0x02,
+  0x1a, 0x02, 0x08, 0xa2, 0xe6, 0x78, 0xff, 0xfe, 0x02, 0x02, 0x08, 0x00,
+  0x80, 0x81, 0x48, 0xad, 0xe3, 0x80, 0xa6, 0x81, 0x80, 0x02, 0xad, 0xe3,
+  0x80, 0xb6, 0xff, 0xfe, 0x81, 0x81, 0xad, 0x00, 0x80, 0x01, 0x48, 0xd3,
+  0xda, 0xee, 0x37, 0x01, 0x12, 0x02, 0xd3, 0xda, 0xee, 0x37, 0xff, 0xfe,
+  0x01, 0x01, 0xd3, 0x00, 0x80, 0x00, 0x48, 0x96, 0xb6, 0x22, 0x7f, 0x00,
+  0xde, 0x02, 0x96, 0xb6, 0x22, 0x7f, 0xff, 0xfe, 0x00, 0x00, 0x96, 0x00,
+  0x81, 0x40, 0x48, 0x40, 0x00, 0xfa, 0xa5, 0x02, 0x06, 0x02, 0x40, 0x00,
+  0xfa, 0xb5, 0xff, 0xfe, 0x02, 0x40, 0x40, 0x00, 0x81, 0x40, 0x48, 0x68,
+  0x00, 0x62, 0x74, 0x00, 0x9e, 0x02, 0x68, 0x00, 0x62, 0x74, 0xff, 0xfe,
+  0x00, 0x68, 0x68, 0x00, 0x81, 0x3f, 0x48, 0x1d, 0x01, 0x2b, 0x23, 0xc0,
+  0xd5, 0x02, 0x1d, 0x01, 0x2b, 0x33, 0xff, 0xfe, 0xc0, 0x1d, 0x1d, 0x00,
+  0x81, 0x3f, 0x48, 0xca, 0x01, 0x63, 0x08, 0xfe, 0x9d, 0x02, 0xca, 0x01,
+  0x63, 0x38, 0xff, 0xfe, 0xfe, 0xca, 0xca, 0x00, 0x81, 0xc1, 0x48, 0xef,
+  0x7f, 0xb5, 0x4b, 0x01, 0x4b, 0x02, 0xef, 0x7f, 0xb5, 0x7b, 0xff, 0xfe,
+  0x01, 0xef, 0xef, 0x00, 0x81, 0xc1, 0x48, 0xcf, 0x7f, 0x17, 0xf8, 0x0f,
+  0xe9, 0x02, 0xcf, 0x7f, 0x17, 0xf8, 0xff, 0xfe, 0x0f, 0xcf, 0xcf, 0x00,
+  0x81, 0x6b, 0x48, 0x97, 0xd5, 0xc0, 0xb9, 0x3f, 0x40, 0x02, 0x97, 0xd5,
+  0xc0, 0xb9, 0xff, 0xfe, 0x3f, 0x97, 0x97, 0x00, 0x81, 0x6b, 0x48, 0x30,
+  0xd5, 0xd0, 0x75, 0x7f, 0x30, 0x02, 0x30, 0xd5, 0xd0, 0x75, 0xff, 0xfe,
+  0x7f, 0x30, 0x30, 0x00, 0x81, 0x41, 0x48, 0xf0, 0xff, 0x43, 0xb1, 0x3f,
+  0xbd, 0x02, 0xf0, 0xff, 0x43, 0xb1, 0xff, 0xfe, 0x3f, 0xf0, 0xf0, 0x00,
+  0x81, 0x41, 0x48, 0x89, 0xff, 0x5d, 0x89, 0xff, 0xa3, 0x02, 0x89, 0xff,
+  0x5d, 0xb9, 0xff, 0xfe, 0xff, 0x89, 0x89, 0x00, 0x82, 0x80, 0x48, 0x2d,
+  0x8e, 0x17, 0x87, 0x80, 0xe9, 0x02, 0x2d, 0x8e, 0x17, 0xb7, 0xff, 0xfe,
+  0x80, 0x80, 0x2d, 0x00, 0x82, 0x40, 0x48, 0x61, 0x65, 0xaf, 0x3a, 0x40,
+  0x51, 0x02, 0x61, 0x65, 0xaf, 0x3a, 0xff, 0xfe, 0x40, 0x40, 0x61, 0x00,
+  0x82, 0xfe, 0x48, 0x9f, 0xc5, 0xa9, 0x52, 0xfe, 0x57, 0x02, 0x9f, 0xc5,
+  0xa9, 0x72, 0xff, 0xfe, 0xfe, 0xfe, 0x9f, 0x00, 0x82, 0xfe, 0x48, 0x77,
+  0xa0, 0xb5, 0x2d, 0xfe, 0x4b, 0x02, 0x77, 0xa0, 0xb5, 0x3d, 0xff, 0xfe,
+  0xfe, 0xfe, 0x77, 0x00, 0x83, 0x40, 0x48, 0x66, 0x00, 0xb5, 0x06, 0x00,
+  0x4b, 0x02, 0x66, 0x00, 0xb5, 0x36, 0xff, 0xfe, 0x00, 0x00, 0x66, 0x00,
+  0x83, 0x40, 0x48, 0x23, 0x00, 0xf5, 0x9c, 0x80, 0x0b, 0x02, 0x23, 0x00,
+  0xf5, 0xbc, 0xff, 0xfe, 0x80, 0x00, 0x23, 0x00, 0x83, 0x3f, 0x48, 0x6e,
+  0x01, 0xd4, 0xb3, 0x40, 0x2c, 0x02, 0x6e, 0x01, 0xd4, 0xb3, 0xff, 0xfe,
+  0x40, 0x00, 0x6e, 0x00, 0x83, 0x3f, 0x48, 0x96, 0x01, 0xe7, 0x11, 0x3f,
+  0x19, 0x02, 0x96, 0x01, 0xe7, 0x31, 0xff, 0xfe, 0x3f, 0x00, 0x96, 0x00,
+  0x83, 0xc1, 0x48, 0x71, 0x7f, 0x78, 0xa1, 0xc0, 0x88, 0x02, 0x71, 0x7f,
+  0x78, 0xb1, 0xff, 0xfe, 0xc0, 0x71, 0x71, 0x00, 0x83, 0xc1, 0x48, 0x8b,
+  0x7f, 0xd3, 0x8d, 0x81, 0x2d, 0x02, 0x8b, 0x7f, 0xd3, 0xbd, 0xff, 0xfe,
+  0x81, 0x0b, 0x8b, 0x00, 0x83, 0x6b, 0x48, 0xcf, 0xd5, 0x34, 0xcc, 0xff,
+  0xcc, 0x02, 0xcf, 0xd5, 0x34, 0xfc, 0xff, 0xfe, 0xff, 0xc5, 0xcf, 0x00,
+  0x83, 0x6b, 0x48, 0xe2, 0xd5, 0x0c, 0xc4, 0x3f, 0xf4, 0x02, 0xe2, 0xd5,
+  0x0c, 0xf4, 0xff, 0xfe, 0x3f, 0xc0, 0xe2, 0x00, 0x83, 0x41, 0x48, 0xda,
+  0xff, 0x8e, 0xca, 0xaa, 0x72, 0x02, 0xda, 0xff, 0x8e, 0xfa, 0xff, 0xfe,
+  0xaa, 0xda, 0xda, 0x00, 0x83, 0x41, 0x48, 0x80, 0xff, 0xe3, 0xc8, 0xaa,
+  0x1d, 0x02, 0x80, 0xff, 0xe3, 0xf8, 0xff, 0xfe, 0xaa, 0x80, 0x80, 0x00,
+  0x84, 0x30, 0x48, 0x94, 0x47, 0x6c, 0x05, 0x02, 0x94, 0x02, 0x94, 0x47,
+  0x6c, 0x35, 0xff, 0xfe, 0x6c, 0x02, 0x94, 0x00, 0x84, 0x30, 0x48, 0x3e,
+  0xae, 0x39, 0xc1, 0xaa, 0xc7, 0x02, 0x3e, 0xae, 0x39, 0xf1, 0xff, 0xfe,
+  0x39, 0xaa, 0x3e, 0x00, 0x84, 0x30, 0x48, 0xba, 0xec, 0x8b, 0x18, 0xff,
+  0x75, 0x02, 0xba, 0xec, 0x8b, 0x38, 0xff, 0xfe, 0x8b, 0xff, 0xba, 0x00,
+  0x84, 0x30, 0x48, 0x29, 0x6e, 0xcb, 0xe9, 0x41, 0x35, 0x02, 0x29, 0x6e,
+  0xcb, 0xf9, 0xff, 0xfe, 0xcb, 0x41, 0x29, 0x00, 0x84, 0x30, 0x48, 0xcf,
+  0x59, 0x4b, 0xfe, 0xfe, 0xb5, 0x02, 0xcf, 0x59, 0x4b, 0xfe, 0xff, 0xfe,
+  0x4b, 0xfe, 0xcf, 0x00, 0x84, 0x30, 0x48, 0x8f, 0x11, 0xd5, 0x18, 0xc0,
+  0x2b, 0x02, 0x8f, 0x11, 0xd5, 0x38, 0xff, 0xfe, 0xd5, 0xc0, 0x8f, 0x00,
+  0x85, 0x30, 0x48, 0x57, 0x0b, 0x1b, 0xba, 0x80, 0xe5, 0x02, 0x57, 0x0b,
+  0x1b, 0xba, 0xff, 0xfe, 0x57, 0x80, 0x57, 0x00, 0x85, 0x30, 0x48, 0xd6,
+  0xe5, 0xce, 0x57, 0xff, 0x32, 0x02, 0xd6, 0xe5, 0xce, 0x77, 0xff, 0xfe,
+  0xd6, 0xff, 0xd6, 0x00, 0x85, 0x30, 0x48, 0xde, 0xe9, 0x98, 0x0d, 0x80,
+  0x68, 0x02, 0xde, 0xe9, 0x98, 0x3d, 0xff, 0xfe, 0xde, 0x80, 0xde, 0x00,
+  0x85, 0x30, 0x48, 0xb3, 0xcf, 0x59, 0x9b, 0x7f, 0xa7, 0x02, 0xb3, 0xcf,
+  0x59, 0xbb, 0xff, 0xfe, 0xb3, 0x7f, 0xb3, 0x00, 0x85, 0x30, 0x48, 0xf4,
+  0x22, 0xbc, 0xa0, 0x0f, 0x44, 0x02, 0xf4, 0x22, 0xbc, 0xb0, 0xff, 0xfe,
+  0xf4, 0x0f, 0xf4, 0x00, 0x85, 0x30, 0x48, 0xb1, 0xa6, 0xc7, 0x5f, 0x02,
+  0x39, 0x02, 0xb1, 0xa6, 0xc7, 0x7f, 0xff, 0xfe, 0xb1, 0x02, 0xb1, 0x00,
+  0x86, 0x30, 0x48, 0x27, 0xbb, 0xdf, 0xdc, 0xd2, 0x21, 0x02, 0x27, 0xbb,
+  0xdf, 0xfc, 0xff, 0xfe, 0xbb, 0xd2, 0x27, 0x00, 0x86, 0x30, 0x48, 0x53,
+  0x74, 0xbe, 0x6c, 0x80, 0x42, 0x02, 0x53, 0x74, 0xbe, 0x7c, 0xff, 0xfe,
+  0x74, 0x80, 0x53, 0x00, 0x86, 0x30, 0x48, 0x54, 0x73, 0xea, 0xe8, 0x62,
+  0x16, 0x02, 0x54, 0x73, 0xea, 0xf8, 0xff, 0xfe, 0x73, 0x62, 0x54, 0x00,
+  0x86, 0x30, 0x48, 0xae, 0xce, 0x12, 0xd7, 0x0f, 0xee, 0x02, 0xae, 0xce,
+  0x12, 0xf7, 0xff, 0xfe, 0xce, 0x0f, 0xae, 0x00, 0x86, 0x30, 0x48, 0x7f,
+  0xaf, 0x29, 0xc9, 0x74, 0xd7, 0x02, 0x7f, 0xaf, 0x29, 0xf9, 0xff, 0xfe,
+  0xaf, 0x74, 0x7f, 0x00, 0x86, 0x30, 0x48, 0x3c, 0x7a, 0x6f, 0xd8, 0xe9,
+  0x91, 0x02, 0x3c, 0x7a, 0x6f, 0xf8, 0xff, 0xfe, 0x7a, 0xe9, 0x3c, 0x00,
+  0x87, 0x30, 0x48, 0xb6, 0x46, 0xb4, 0x98, 0x0a, 0x4c, 0x02, 0xb6, 0x46,
+  0xb4, 0xb8, 0xff, 0xfe, 0x06, 0x0a, 0xb6, 0x00, 0x87, 0x30, 0x48, 0x07,
+  0xf2, 0xf7, 0x06, 0x02, 0x09, 0x02, 0x07, 0xf2, 0xf7, 0x36, 0xff, 0xfe,
+  0x02, 0x02, 0x07, 0x00, 0x87, 0x30, 0x48, 0x02, 0x69, 0xe2, 0x1b, 0x01,
+  0x1e, 0x02, 0x02, 0x69, 0xe2, 0x3b, 0xff, 0xfe, 0x00, 0x01, 0x02, 0x00,
+  0x87, 0x30, 0x48, 0xaa, 0xd8, 0xa0, 0xda, 0x3f, 0x60, 0x02, 0xaa, 0xd8,
+  0xa0, 0xfa, 0xff, 0xfe, 0x88, 0x3f, 0xaa, 0x00, 0x87, 0x30, 0x48, 0x3a,
+  0xe0, 0x1b, 0x01, 0x02, 0xe5, 0x02, 0x3a, 0xe0, 0x1b, 0x31, 0xff, 0xfe,
+  0x20, 0x02, 0x3a, 0x00, 0x87, 0x30, 0x48, 0x1a, 0xbe, 0xd8, 0xc1, 0x6d,
+  0x28, 0x02, 0x1a, 0xbe, 0xd8, 0xf1, 0xff, 0xfe, 0x1a, 0x6d, 0x1a, 0x00,
+  0x88, 0x48, 0x48, 0x67, 0x19, 0x36, 0x00, 0x01, 0xca, 0x02, 0x67, 0x19,
+  0x35, 0x30, 0xff, 0xfd, 0x01, 0x01, 0x67, 0x00, 0x88, 0x48, 0x48, 0x2f,
+  0xf1, 0xe5, 0xe4, 0x41, 0x1b, 0x02, 0x2f, 0xf1, 0xe4, 0xf4, 0xff, 0xfd,
+  0x41, 0x41, 0x2f, 0x00, 0x88, 0x48, 0x48, 0x8b, 0xb8, 0x83, 0x9f, 0x41,
+  0x7d, 0x02, 0x8b, 0xb8, 0x82, 0xbd, 0xff, 0xfd, 0x41, 0x41, 0x8b, 0x00,
+  0x88, 0x48, 0x48, 0x6d, 0x96, 0x7c, 0xdc, 0x41, 0x84, 0x02, 0x6d, 0x96,
+  0x7b, 0x7c, 0xff, 0xfd, 0x41, 0x41, 0x6d, 0x00, 0x88, 0x48, 0x48, 0x38,
+  0x0f, 0xef, 0x98, 0x41, 0x11, 0x02, 0x38, 0x0f, 0xee, 0xb8, 0xff, 0xfd,
+  0x41, 0x41, 0x38, 0x00, 0x88, 0x48, 0x48, 0xc8, 0x27, 0x24, 0xbb, 0x40,
+  0xdc, 0x02, 0xc8, 0x27, 0x23, 0x39, 0xff, 0xfd, 0x40, 0x40, 0xc8, 0x00,
+  0x89, 0x3f, 0x48, 0x25, 0x00, 0xf6, 0x90, 0x3f, 0x0a, 0x02, 0x25, 0x00,
+  0xf6, 0xb0, 0xff, 0xfe, 0x3f, 0x3f, 0x25, 0x00, 0x89, 0x0f, 0x48, 0x5f,
+  0x62, 0xa9, 0xb4, 0x0f, 0x57, 0x02, 0x5f, 0x62, 0xa9, 0xb4, 0xff, 0xfe,
+  0x0f, 0x0f, 0x5f, 0x00, 0x89, 0x01, 0x48, 0x9c, 0x05, 0xe3, 0x9f, 0x01,
+  0x1d, 0x02, 0x9c, 0x05, 0xe3, 0xbf, 0xff, 0xfe, 0x01, 0x01, 0x9c, 0x00,
+  0x89, 0xff, 0x48, 0xc0, 0x8f, 0x4e, 0x7c, 0xff, 0xb2, 0x02, 0xc0, 0x8f,
+  0x4e, 0x7c, 0xff, 0xfe, 0xff, 0xff, 0xc0, 0x00, 0x8a, 0x48, 0x48, 0x83,
+  0x29, 0x7b, 0xff, 0x01, 0x85, 0x02, 0x29, 0x29, 0x7b, 0x7d, 0xff, 0xfd,
+  0x01, 0x01, 0x29, 0x00, 0x8a, 0x48, 0x48, 0x7e, 0xf8, 0xa1, 0x01, 0xaa,
+  0x5f, 0x02, 0xf8, 0xf8, 0xa1, 0xb1, 0xff, 0xfd, 0xaa, 0xaa, 0xf8, 0x00,
+  0x8a, 0x48, 0x48, 0x6e, 0xa4, 0x2d, 0x6b, 0x2c, 0xd3, 0x02, 0xa4, 0xa4,
+  0x2d, 0xf9, 0xff, 0xfd, 0x2c, 0x2c, 0xa4, 0x00, 0x8a, 0x48, 0x48, 0x4f,
+  0xc8, 0x70, 0xc2, 0xff, 0x90, 0x02, 0xc8, 0xc8, 0x70, 0xf0, 0xff, 0xfd,
+  0xff, 0xff, 0xc8, 0x00, 0x8a, 0x48, 0x48, 0x55, 0x93, 0x31, 0x8b, 0x80,
+  0xcf, 0x02, 0x93, 0x93, 0x31, 0xb9, 0xff, 0xfd, 0x80, 0x80, 0x93, 0x00,
+  0x8a, 0x48, 0x48, 0x77, 0x36, 0x0f, 0x8a, 0x01, 0xf1, 0x02, 0x36, 0x36,
+  0x0f, 0x38, 0xff, 0xfd, 0x01, 0x01, 0x36, 0x00, 0x8c, 0x00, 0x03, 0xea,
+  0x7c, 0x27, 0xc1, 0xb3, 0xd9, 0x02, 0xea, 0x7c, 0x27, 0xf1, 0xff, 0xff,
+  0xb3, 0x27, 0xf1, 0x00, 0x8c, 0x00, 0x03, 0x2f, 0xc3, 0x5d, 0x66, 0x01,
+  0xa3, 0x02, 0x2f, 0xc3, 0x5d, 0x76, 0xff, 0xff, 0x01, 0x5d, 0x76, 0x00,
+  0x8c, 0x00, 0x03, 0x94, 0xbe, 0x0e, 0x10, 0x81, 0xf2, 0x02, 0x94, 0xbe,
+  0x0e, 0x30, 0xff, 0xff, 0x81, 0x0e, 0x30, 0x00, 0x8c, 0x00, 0x03, 0x91,
+  0xb9, 0xcd, 0x9a, 0x00, 0x33, 0x02, 0x91, 0xb9, 0xcd, 0xba, 0xff, 0xff,
+  0x00, 0xcd, 0xba, 0x00, 0x8c, 0x00, 0x03, 0xc8, 0xbb, 0xb0, 0x7b, 0x40,
+  0x50, 0x02, 0xc8, 0xbb, 0xb0, 0x7b, 0xff, 0xff, 0x40, 0xb0, 0x7b, 0x00,
+  0x8c, 0x00, 0x03, 0xe9, 0x70, 0xe7, 0xa3, 0xc0, 0x19, 0x02, 0xe9, 0x70,
+  0xe7, 0xb3, 0xff, 0xff, 0xc0, 0xe7, 0xb3, 0x00, 0x8d, 0x00, 0x03, 0xef,
+  0xff, 0xb6, 0x33, 0x40, 0x4a, 0x02, 0xef, 0xff, 0xb6, 0x33, 0xff, 0xff,
+  0x40, 0xef, 0x33, 0x00, 0x8d, 0x00, 0x03, 0x5e, 0x5d, 0xef, 0x1d, 0xea,
+  0x11, 0x02, 0x5e, 0x5d, 0xef, 0x3d, 0xff, 0xff, 0xea, 0x5e, 0x3d, 0x00,
+  0x8d, 0x00, 0x03, 0x44, 0xcb, 0x53, 0x14, 0xaa, 0xad, 0x02, 0x44, 0xcb,
+  0x53, 0x34, 0xff, 0xff, 0xaa, 0x44, 0x34, 0x00, 0x8d, 0x00, 0x03, 0x35,
+  0x5c, 0xb7, 0x6a, 0x0f, 0x49, 0x02, 0x35, 0x5c, 0xb7, 0x7a, 0xff, 0xff,
+  0x0f, 0x35, 0x7a, 0x00, 0x8d, 0x00, 0x03, 0x1b, 0xeb, 0xb8, 0x6a, 0x80,
+  0x48, 0x02, 0x1b, 0xeb, 0xb8, 0x7a, 0xff, 0xff, 0x80, 0x1b, 0x7a, 0x00,
+  0x8d, 0x00, 0x03, 0x59, 0x84, 0xdf, 0x43, 0xc0, 0x21, 0x02, 0x59, 0x84,
+  0xdf, 0x73, 0xff, 0xff, 0xc0, 0x59, 0x73, 0x00, 0x8e, 0x00, 0x03, 0xfc,
+  0xe5, 0xc6, 0xbb, 0x01, 0x3a, 0x02, 0xfc, 0xe5, 0xc6, 0xbb, 0xff, 0xff,
+  0x01, 0xe5, 0xbb, 0x00, 0x8e, 0x00, 0x03, 0xae, 0xe7, 0xfc, 0x6a, 0x3f,
+  0x04, 0x02, 0xae, 0xe7, 0xfc, 0x7a, 0xff, 0xff, 0x3f, 0xe7, 0x7a, 0x00,
+  0x8e, 0x00, 0x03, 0xce, 0x7c, 0xf4, 0xc0, 0x00, 0x0c, 0x02, 0xce, 0x7c,
+  0xf4, 0xf0, 0xff, 0xff, 0x00, 0x7c, 0xf0, 0x00, 0x8e, 0x00, 0x03, 0x1a,
+  0x5f, 0xec, 0x97, 0xfe, 0x14, 0x02, 0x1a, 0x5f, 0xec, 0xb7, 0xff, 0xff,
+  0xfe, 0x5f, 0xb7, 0x00, 0x8e, 0x00, 0x03, 0xb2, 0xc0, 0xc0, 0x4c, 0x00,
+  0x40, 0x02, 0xb2, 0xc0, 0xc0, 0x7c, 0xff, 0xff, 0x00, 0xc0, 0x7c, 0x00,
+  0x8e, 0x00, 0x03, 0x98, 0xc1, 0xa5, 0x83, 0x80, 0x5b, 0x02, 0x98, 0xc1,
+  0xa5, 0xb3, 0xff, 0xff, 0x80, 0xc1, 0xb3, 0x00, 0x8f, 0x00, 0x03, 0xa8,
+  0xc7, 0x1a, 0xd8, 0x80, 0xe6, 0x02, 0xa8, 0xc7, 0x1a, 0xf8, 0xff, 0xff,
+  0x80, 0x80, 0xf8, 0x00, 0x8f, 0x00, 0x03, 0x44, 0x96, 0xc0, 0x4f, 0x41,
+  0x40, 0x02, 0x44, 0x96, 0xc0, 0x7f, 0xff, 0xff, 0x41, 0x04, 0x7f, 0x00,
+  0x8f, 0x00, 0x03, 0xf5, 0xc0, 0x0b, 0x3f, 0x01, 0xf5, 0x02, 0xf5, 0xc0,
+  0x0b, 0x3f, 0xff, 0xff, 0x01, 0xc0, 0x3f, 0x00, 0x8f, 0x00, 0x03, 0xc7,
+  0x7a, 0x12, 0xda, 0x80, 0xee, 0x02, 0xc7, 0x7a, 0x12, 0xfa, 0xff, 0xff,
+  0x80, 0x42, 0xfa, 0x00, 0x8f, 0x00, 0x03, 0x81, 0x6d, 0x41, 0x7f, 0x01,
+  0xbf, 0x02, 0x81, 0x6d, 0x41, 0x7f, 0xff, 0xff, 0x01, 0x01, 0x7f, 0x00,
+  0x8f, 0x00, 0x03, 0xaa, 0x4a, 0xee, 0xce, 0x81, 0x12, 0x02, 0xaa, 0x4a,
+  0xee, 0xfe, 0xff, 0xff, 0x81, 0x0a, 0xfe, 0x00, 0x90, 0x01, 0x48, 0xa6,
+  0x1f, 0x12, 0xf3, 0xa6, 0x00, 0x03, 0xa6, 0x1f, 0x12, 0xf3, 0xff, 0xfe,
+  0xa6, 0xa6, 0xa6, 0x00, 0x90, 0x01, 0x48, 0x9a, 0xa0, 0xa4, 0xab, 0x27,
+  0x00, 0x03, 0x9a, 0xa0, 0xa4, 0xbb, 0xff, 0xfe, 0x27, 0x27, 0x9a, 0x00,
+  0x90, 0x01, 0x48, 0x1a, 0x1e, 0x4d, 0x6e, 0xb8, 0x00, 0x03, 0x1a, 0x1e,
+  0x4d, 0x7e, 0xff, 0xff, 0xb8, 0xb8, 0x7e, 0x00, 0x90, 0x01, 0x48, 0xac,
+  0xf1, 0xca, 0xe1, 0x41, 0x00, 0x03, 0xac, 0xf1, 0xca, 0xf1, 0xff, 0xfe,
+  0x41, 0x41, 0xac, 0x00, 0x90, 0x01, 0x48, 0x7d, 0x83, 0x25, 0xe1, 0x06,
+  0x00, 0x03, 0x7d, 0x83, 0x25, 0xf1, 0xff, 0xfe, 0x06, 0x06, 0x7d, 0x00,
+  0x90, 0x01, 0x48, 0xe4, 0xa9, 0xe1, 0x8e, 0xea, 0x00, 0x03, 0xe4, 0xa9,
+  0xe1, 0xbe, 0xff, 0xff, 0xea, 0xea, 0xbe, 0x00, 0x90, 0x01, 0x48, 0xf4,
+  0xf6, 0xaf, 0xaa, 0xe4, 0x00, 0x03, 0xf4, 0xf6, 0xaf, 0xba, 0xff, 0xff,
+  0xe4, 0xe4, 0xba, 0x00, 0x90, 0x01, 0x48, 0x0e, 0x1a, 0xc5, 0x81, 0x59,
+  0x00, 0x03, 0x0e, 0x1a, 0xc5, 0xb1, 0xff, 0xfe, 0x59, 0x59, 0x0e, 0x00,
+  0x90, 0x01, 0x48, 0xb8, 0xb9, 0x11, 0x1b, 0x98, 0x00, 0x03, 0xb8, 0xb9,
+  0x11, 0x3b, 0xff, 0xfe, 0x98, 0x98, 0xb8, 0x00, 0x90, 0x01, 0x48, 0xab,
+  0x49, 0x85, 0xf8, 0xb8, 0x00, 0x03, 0xab, 0x49, 0x85, 0xf8, 0xff, 0xff,
+  0xb8, 0xb8, 0xf8, 0x00, 0x90, 0x01, 0x48, 0xaa, 0x76, 0xf8, 0xb7, 0x33,
+  0x00, 0x03, 0xaa, 0x76, 0xf8, 0xb7, 0xff, 0xfe, 0x33, 0x33, 0xaa, 0x00,
+  0x90, 0x01, 0x48, 0x56, 0x0a, 0xe6, 0xb8, 0x9e, 0x00, 0x03, 0x56, 0x0a,
+  0xe6, 0xb8, 0xff, 0xff, 0x9e, 0x9e, 0xb8, 0x00, 0x90, 0x01, 0x48, 0xc2,
+  0x0b, 0xa6, 0xfe, 0x58, 0x00, 0x03, 0xc2, 0x0b, 0xa6, 0xfe, 0xff, 0xff,
+  0x58, 0x58, 0xfe, 0x00, 0x90, 0x01, 0x48, 0xa3, 0xaa, 0x90, 0xe7, 0x20,
+  0x00, 0x03, 0xa3, 0xaa, 0x90, 0xf7, 0xff, 0xfe, 0x20, 0x20, 0xa3, 0x00,
+  0x90, 0x01, 0x48, 0xb7, 0x89, 0xed, 0x95, 0x9e, 0x00, 0x03, 0xb7, 0x89,
+  0xed, 0xb5, 0xff, 0xfe, 0x9e, 0x9e, 0xb7, 0x00, 0x90, 0x01, 0x48, 0x90,
+  0xe7, 0xc1, 0x39, 0xf0, 0x00, 0x03, 0x90, 0xe7, 0xc1, 0x39, 0xff, 0xfe,
+  0xf0, 0xf0, 0x90, 0x00, 0x90, 0x01, 0x48, 0xf1, 0x0e, 0x24, 0x5e, 0x75,
+  0x00, 0x03, 0xf1, 0x0e, 0x24, 0x7e, 0xff, 0xff, 0x75, 0x75, 0x7e, 0x00,
+  0x90, 0x01, 0x48, 0x16, 0xb4, 0xbc, 0xbc, 0xe2, 0x00, 0x03, 0x16, 0xb4,
+  0xbc, 0xbc, 0xff, 0xff, 0xe2, 0xe2, 0xbc, 0x00, 0x90, 0x01, 0x48, 0xff,
+  0xb0, 0x17, 0x0f, 0x00, 0x00, 0x03, 0xff, 0xb0, 0x17, 0x3f, 0xff, 0xfe,
+  0x00, 0x00, 0xff, 0x00, 0x90, 0x01, 0x48, 0x49, 0x9d, 0x6e, 0x5c, 0x43,
+  0x00, 0x03, 0x49, 0x9d, 0x6e, 0x7c, 0xff, 0xff, 0x43, 0x43, 0x7c, 0x00,
+  0x90, 0x00, 0x48, 0x37, 0xd2, 0x9f, 0x7e, 0x5c, 0x00, 0x03, 0x37, 0xd2,
+  0x9f, 0x7e, 0xff, 0xfe, 0x5c, 0x5c, 0x37, 0x00, 0x90, 0x00, 0x48, 0xdf,
+  0x60, 0x47, 0x48, 0xca, 0x00, 0x03, 0xdf, 0x60, 0x47, 0x78, 0xff, 0xfe,
+  0xca, 0xca, 0xdf, 0x00, 0x90, 0x00, 0x48, 0x18, 0x5a, 0x3e, 0x57, 0x37,
+  0x00, 0x03, 0x18, 0x5a, 0x3e, 0x77, 0xff, 0xfe, 0x37, 0x37, 0x18, 0x00,
+  0x90, 0x00, 0x48, 0x73, 0x90, 0x91, 0x1d, 0x72, 0x00, 0x03, 0x73, 0x90,
+  0x91, 0x3d, 0xff, 0xfe, 0x72, 0x72, 0x73, 0x00, 0x91, 0x42, 0x48, 0x1f,
+  0x33, 0x00, 0x61, 0x40, 0x00, 0x03, 0x1f, 0x33, 0x00, 0x71, 0xff, 0xfe,
+  0x40, 0x1f, 0x1f, 0x00, 0x91, 0x42, 0x48, 0x95, 0x31, 0x00, 0xf0, 0xc0,
+  0x00, 0x03, 0x95, 0x31, 0x00, 0xf0, 0xff, 0xfe, 0xc0, 0x95, 0x95, 0x00,
+  0x91, 0x42, 0x48, 0xb0, 0x55, 0x01, 0xf3, 0x0f, 0xff, 0x02, 0xb0, 0x55,
+  0x01, 0xf3, 0xff, 0xfe, 0x0f, 0xb0, 0xb0, 0x00, 0x91, 0x42, 0x48, 0x20,
+  0x42, 0x01, 0xc7, 0x80, 0xff, 0x02, 0x20, 0x42, 0x01, 0xf7, 0xff, 0xfe,
+  0x80, 0x20, 0x20, 0x00, 0x91, 0x42, 0x48, 0xcd, 0xc5, 0x7f, 0xac, 0x0f,
+  0x81, 0x02, 0xcd, 0xc5, 0x7f, 0xbc, 0xff, 0xfe, 0x0f, 0xcd, 0xcd, 0x00,
+  0x91, 0x42, 0x48, 0x34, 0x7b, 0x7f, 0x4e, 0xe0, 0x81, 0x02, 0x34, 0x7b,
+  0x7f, 0x7e, 0xff, 0xfe, 0xe0, 0x34, 0x34, 0x00, 0x91, 0x42, 0x48, 0x74,
+  0xdb, 0xd5, 0xaf, 0x80, 0x2b, 0x02, 0x74, 0xdb, 0xd5, 0xbf, 0xff, 0xfe,
+  0x80, 0x74, 0x74, 0x00, 0x91, 0x42, 0x48, 0xe4, 0x30, 0xd5, 0x7a, 0x0f,
+  0x2b, 0x02, 0xe4, 0x30, 0xd5, 0x7a, 0xff, 0xfe, 0x0f, 0xe4, 0xe4, 0x00,
+  0x91, 0x42, 0x48, 0xea, 0x99, 0xff, 0x01, 0x7f, 0x01, 0x02, 0xea, 0x99,
+  0xff, 0x31, 0xff, 0xfe, 0x7f, 0xea, 0xea, 0x00, 0x91, 0x42, 0x48, 0x1e,
+  0xa3, 0xff, 0x9d, 0x81, 0x01, 0x02, 0x1e, 0xa3, 0xff, 0xbd, 0xff, 0xfe,
+  0x81, 0x1e, 0x1e, 0x00, 0x94, 0x30, 0x48, 0x0b, 0x00, 0x01, 0x88, 0x41,
+  0xff, 0x02, 0x0b, 0x00, 0x01, 0xb8, 0xff, 0xfe, 0x01, 0x41, 0x0b, 0x00,
+  0x94, 0x30, 0x48, 0x9a, 0x00, 0x62, 0x5d, 0xff, 0x9e, 0x02, 0x9a, 0x00,
+  0x62, 0x7d, 0xff, 0xfe, 0x62, 0xff, 0x9a, 0x00, 0x94, 0x2f, 0x48, 0xd1,
+  0x01, 0x46, 0xa5, 0x01, 0xba, 0x02, 0xd1, 0x01, 0x46, 0xb5, 0xff, 0xfe,
+  0x46, 0x01, 0xd1, 0x00, 0x94, 0x2f, 0x48, 0xec, 0x01, 0xb7, 0x19, 0x0f,
+  0x49, 0x02, 0xec, 0x01, 0xb7, 0x39, 0xff, 0xfe, 0xb7, 0x0f, 0xec, 0x00,
+  0x94, 0xb1, 0x48, 0x4e, 0x7f, 0xe3, 0x39, 0xaa, 0x1d, 0x02, 0x4e, 0x7f,
+  0xe3, 0x39, 0xff, 0xfe, 0xe3, 0xaa, 0x4e, 0x00, 0x94, 0xb1, 0x48, 0x68,
+  0x7f, 0xe0, 0xf0, 0xaa, 0x20, 0x02, 0x68, 0x7f, 0xe0, 0xf0, 0xff, 0xfe,
+  0xe0, 0xaa, 0x68, 0x00, 0x94, 0x5b, 0x48, 0x69, 0xd5, 0x75, 0x5c, 0xaa,
+  0x8b, 0x02, 0x69, 0xd5, 0x75, 0x7c, 0xff, 0xfe, 0x75, 0xaa, 0x69, 0x00,
+  0x94, 0x5b, 0x48, 0x58, 0xd5, 0xa5, 0x50, 0x00, 0x5b, 0x02, 0x58, 0xd5,
+  0xa5, 0x70, 0xff, 0xfe, 0xa5, 0x00, 0x58, 0x00, 0x94, 0x31, 0x48, 0x7a,
+  0xff, 0x2c, 0x08, 0xc0, 0xd4, 0x02, 0x7a, 0xff, 0x2c, 0x38, 0xff, 0xfe,
+  0x2c, 0xc0, 0x7a, 0x00, 0x94, 0x31, 0x48, 0x66, 0xff, 0x13, 0x6e, 0x00,
+  0xed, 0x02, 0x66, 0xff, 0x13, 0x7e, 0xff, 0xfe, 0x13, 0x00, 0x66, 0x00,
+  0x95, 0x30, 0x48, 0x44, 0x00, 0x96, 0x86, 0x01, 0x6a, 0x02, 0x44, 0x00,
+  0x96, 0xb6, 0xff, 0xfe, 0x44, 0x01, 0x44, 0x00, 0x95, 0x30, 0x48, 0xad,
+  0x00, 0x7c, 0xa2, 0x0f, 0x84, 0x02, 0xad, 0x00, 0x7c, 0xb2, 0xff, 0xfe,
+  0xad, 0x0f, 0xad, 0x00, 0x95, 0x2f, 0x48, 0x11, 0x01, 0xb8, 0x02, 0x3f,
+  0x48, 0x02, 0x11, 0x01, 0xb8, 0x32, 0xff, 0xfe, 0x11, 0x3f, 0x11, 0x00,
+  0x95, 0x2f, 0x48, 0x19, 0x01, 0x82, 0x01, 0xfe, 0x7e, 0x02, 0x19, 0x01,
+  0x82, 0x31, 0xff, 0xfe, 0x19, 0xfe, 0x19, 0x00, 0x95, 0xb1, 0x48, 0x86,
+  0x7f, 0x2a, 0xee, 0x41, 0xd6, 0x02, 0x86, 0x7f, 0x2a, 0xfe, 0xff, 0xfe,
+  0x86, 0x41, 0x86, 0x00, 0x95, 0xb1, 0x48, 0x12, 0x7f, 0x8d, 0x3f, 0xfe,
+  0x73, 0x02, 0x12, 0x7f, 0x8d, 0x3f, 0xff, 0xfe, 0x12, 0xfe, 0x12, 0x00,
+  0x95, 0x5b, 0x48, 0x93, 0xd5, 0x1c, 0x0b, 0xaa, 0xe4, 0x02, 0x93, 0xd5,
+  0x1c, 0x3b, 0xff, 0xfe, 0x93, 0xaa, 0x93, 0x00, 0x95, 0x5b, 0x48, 0xfa,
+  0xd5, 0x73, 0x9f, 0x6c, 0x8d, 0x02, 0xfa, 0xd5, 0x73, 0xbf, 0xff, 0xfe,
+  0xfa, 0x6c, 0xfa, 0x00, 0x95, 0x31, 0x48, 0xec, 0xff, 0xd7, 0xb7, 0x41,
+  0x29, 0x02, 0xec, 0xff, 0xd7, 0xb7, 0xff, 0xfe, 0xec, 0x41, 0xec, 0x00,
+  0x95, 0x31, 0x48, 0xaa, 0xff, 0x94, 0x62, 0x00, 0x6c, 0x02, 0xaa, 0xff,
+  0x94, 0x72, 0xff, 0xfe, 0xaa, 0x00, 0xaa, 0x00, 0x96, 0x30, 0x48, 0x7d,
+  0xea, 0x00, 0xb0, 0x0f, 0x00, 0x03, 0x7d, 0xea, 0x00, 0xb0, 0xff, 0xfe,
+  0xea, 0x0f, 0x7d, 0x00, 0x96, 0x30, 0x48, 0x7d, 0x1d, 0x00, 0x00, 0x0f,
+  0x00, 0x03, 0x7d, 0x1d, 0x00, 0x30, 0xff, 0xfe, 0x1d, 0x0f, 0x7d, 0x00,
+  0x96, 0x2f, 0x48, 0x5a, 0x6c, 0x01, 0x88, 0x41, 0xff, 0x02, 0x5a, 0x6c,
+  0x01, 0xb8, 0xff, 0xfe, 0x6c, 0x41, 0x5a, 0x00, 0x96, 0x2f, 0x48, 0xf2,
+  0xbf, 0x01, 0xfc, 0x00, 0xff, 0x02, 0xf2, 0xbf, 0x01, 0xfc, 0xff, 0xfe,
+  0xbf, 0x00, 0xf2, 0x00, 0x96, 0xb1, 0x48, 0xe6, 0xb2, 0x7f, 0x81, 0x7f,
+  0x81, 0x02, 0xe6, 0xb2, 0x7f, 0xb1, 0xff, 0xfe, 0xb2, 0x7f, 0xe6, 0x00,
+  0x96, 0xb1, 0x48, 0xa1, 0x15, 0x7f, 0xa8, 0x1e, 0x81, 0x02, 0xa1, 0x15,
+  0x7f, 0xb8, 0xff, 0xfe, 0x15, 0x1e, 0xa1, 0x00, 0x96, 0x5b, 0x48, 0x3d,
+  0xdd, 0xd5, 0x72, 0x00, 0x2b, 0x02, 0x3d, 0xdd, 0xd5, 0x72, 0xff, 0xfe,
+  0xdd, 0x00, 0x3d, 0x00, 0x96, 0x5b, 0x48, 0xea, 0x85, 0xd5, 0xf8, 0x02,
+  0x2b, 0x02, 0xea, 0x85, 0xd5, 0xf8, 0xff, 0xfe, 0x85, 0x02, 0xea, 0x00,
+  0x96, 0x31, 0x48, 0x5f, 0xcb, 0xff, 0x4f, 0x3f, 0x01, 0x02, 0x5f, 0xcb,
+  0xff, 0x7f, 0xff, 0xfe, 0xcb, 0x3f, 0x5f, 0x00, 0x96, 0x31, 0x48, 0xbc,
+  0x83, 0xff, 0xa8, 0x41, 0x01, 0x02, 0xbc, 0x83, 0xff, 0xb8, 0xff, 0xfe,
+  0x83, 0x41, 0xbc, 0x00, 0x97, 0x30, 0x48, 0x5b, 0xfa, 0x00, 0x5f, 0x40,
+  0x00, 0x03, 0x5b, 0xfa, 0x00, 0x7f, 0xff, 0xfe, 0x5a, 0x40, 0x5b, 0x00,
+  0x97, 0x30, 0x48, 0x6e, 0x73, 0x00, 0xf6, 0x02, 0x00, 0x03, 0x6e, 0x73,
+  0x00, 0xf6, 0xff, 0xfe, 0x62, 0x02, 0x6e, 0x00, 0x97, 0x2f, 0x48, 0x46,
+  0x47, 0x01, 0x23, 0x81, 0xff, 0x02, 0x46, 0x47, 0x01, 0x33, 0xff, 0xfe,
+  0x46, 0x81, 0x46, 0x00, 0x97, 0x2f, 0x48, 0x0f, 0x98, 0x01, 0x73, 0x80,
+  0xff, 0x02, 0x0f, 0x98, 0x01, 0x73, 0xff, 0xfe, 0x08, 0x80, 0x0f, 0x00,
+  0x97, 0xb1, 0x48, 0x19, 0x29, 0x7f, 0x80, 0x01, 0x81, 0x02, 0x19, 0x29,
+  0x7f, 0xb0, 0xff, 0xfe, 0x09, 0x01, 0x19, 0x00, 0x97, 0xb1, 0x48, 0x2d,
+  0x36, 0x7f, 0x54, 0x02, 0x81, 0x02, 0x2d, 0x36, 0x7f, 0x74, 0xff, 0xfe,
+  0x24, 0x02, 0x2d, 0x00, 0x97, 0x5b, 0x48, 0xd1, 0x87, 0xd5, 0xe9, 0x40,
+  0x2b, 0x02, 0xd1, 0x87, 0xd5, 0xf9, 0xff, 0xfe, 0x81, 0x40, 0xd1, 0x00,
+  0x97, 0x5b, 0x48, 0xff, 0xf7, 0xd5, 0x89, 0xfe, 0x2b, 0x02, 0xff, 0xf7,
+  0xd5, 0xb9, 0xff, 0xfe, 0xf7, 0xfe, 0xff, 0x00, 0x97, 0x31, 0x48, 0x91,
+  0x4d, 0xff, 0xad, 0x01, 0x01, 0x02, 0x91, 0x4d, 0xff, 0xbd, 0xff, 0xfe,
+  0x01, 0x01, 0x91, 0x00, 0x97, 0x31, 0x48, 0x30, 0xe7, 0xff, 0xf0, 0x02,
+  0x01, 0x02, 0x30, 0xe7, 0xff, 0xf0, 0xff, 0xfe, 0x20, 0x02, 0x30, 0x00,
+  0x98, 0x48, 0x48, 0x7c, 0xfb, 0x8b, 0x44, 0x41, 0x75, 0x02, 0x8b, 0xfb,
+  0x8b, 0xf4, 0xff, 0xfd, 0x41, 0x41, 0x8b, 0x00, 0x98, 0x48, 0x48, 0xb4,
+  0x50, 0x7e, 0xae, 0x02, 0x82, 0x02, 0x7e, 0x50, 0x7e, 0x3c, 0xff, 0xfd,
+  0x02, 0x02, 0x7e, 0x00, 0x98, 0x48, 0x48, 0x35, 0x6d, 0x6b, 0x23, 0x40,
+  0x95, 0x02, 0x6b, 0x6d, 0x6b, 0x31, 0xff, 0xfd, 0x40, 0x40, 0x6b, 0x00,
+  0x98, 0x48, 0x48, 0xeb, 0x30, 0x57, 0x26, 0xfe, 0xa9, 0x02, 0x57, 0x30,
+  0x57, 0x34, 0xff, 0xfd, 0xfe, 0xfe, 0x57, 0x00, 0x98, 0x48, 0x48, 0x5c,
+  0xb6, 0xb9, 0x80, 0x81, 0x47, 0x02, 0xb9, 0xb6, 0xb9, 0xb0, 0xff, 0xfd,
+  0x81, 0x81, 0xb9, 0x00, 0x98, 0x48, 0x48, 0xbc, 0x29, 0xfd, 0x7a, 0x41,
+  0x03, 0x02, 0xfd, 0x29, 0xfd, 0xf8, 0xff, 0xfd, 0x41, 0x41, 0xfd, 0x00,
+  0x99, 0x00, 0x03, 0x91, 0x3f, 0x00, 0xb9, 0x20, 0x00, 0x03, 0x91, 0x3f,
+  0x00, 0xb9, 0xff, 0xff, 0x20, 0x91, 0xb9, 0x00, 0x99, 0x00, 0x03, 0x24,
+  0xcc, 0x00, 0x2f, 0x40, 0x00, 0x03, 0x24, 0xcc, 0x00, 0x3f, 0xff, 0xff,
+  0x40, 0x24, 0x3f, 0x00, 0x99, 0xff, 0x02, 0xaa, 0x8b, 0x01, 0x3c, 0xc0,
+  0xff, 0x02, 0xaa, 0x8b, 0x01, 0x3c, 0xff, 0xff, 0xc0, 0xaa, 0x3c, 0x00,
+  0x99, 0xff, 0x02, 0x67, 0x9b, 0x01, 0x9a, 0xff, 0xff, 0x02, 0x67, 0x9b,
+  0x01, 0xba, 0xff, 0xff, 0xff, 0x67, 0xba, 0x00, 0x99, 0x81, 0x02, 0xc5,
+  0xc1, 0x7f, 0x35, 0x7f, 0x81, 0x02, 0xc5, 0xc1, 0x7f, 0x35, 0xff, 0xff,
+  0x7f, 0xc5, 0x35, 0x00, 0x99, 0x81, 0x02, 0x55, 0xae, 0x7f, 0x75, 0x01,
+  0x81, 0x02, 0x55, 0xae, 0x7f, 0x75, 0xff, 0xff, 0x01, 0x55, 0x75, 0x00,
+  0x99, 0x2b, 0x02, 0x93, 0x5e, 0xd5, 0x9e, 0x41, 0x2b, 0x02, 0x93, 0x5e,
+  0xd5, 0xbe, 0xff, 0xff, 0x41, 0x93, 0xbe, 0x00, 0x99, 0x2b, 0x02, 0x19,
+  0x25, 0xd5, 0x51, 0x01, 0x2b, 0x02, 0x19, 0x25, 0xd5, 0x71, 0xff, 0xff,
+  0x01, 0x19, 0x71, 0x00, 0x99, 0x01, 0x02, 0xd0, 0xc9, 0xff, 0x22, 0x00,
+  0x01, 0x02, 0xd0, 0xc9, 0xff, 0x32, 0xff, 0xff, 0x00, 0xd0, 0x32, 0x00,
+  0x99, 0x01, 0x02, 0x91, 0x89, 0xff, 0xc7, 0x81, 0x01, 0x02, 0x91, 0x89,
+  0xff, 0xf7, 0xff, 0xff, 0x81, 0x91, 0xf7, 0x00, 0x9a, 0x48, 0x48, 0xd0,
+  0xc6, 0xa9, 0xe9, 0x0f, 0x57, 0x02, 0xd0, 0xc6, 0xa9, 0xf9, 0xff, 0xc4,
+  0x0f, 0x0f, 0xe9, 0x00, 0x9a, 0x48, 0x48, 0xfb, 0x24, 0x2e, 0x4d, 0xad,
+  0xd2, 0x02, 0xfb, 0x24, 0x2e, 0x7d, 0xff, 0x22, 0xad, 0xad, 0x4d, 0x00,
+  0x9a, 0x48, 0x48, 0x33, 0x3d, 0xf3, 0x3a, 0x00, 0x0d, 0x02, 0x33, 0x3d,
+  0xf3, 0x3a, 0xff, 0x3b, 0x00, 0x00, 0x3a, 0x00, 0x9a, 0x48, 0x48, 0x05,
+  0xc2, 0x7a, 0xd3, 0x02, 0x86, 0x02, 0x05, 0xc2, 0x7a, 0xf3, 0xff, 0xc0,
+  0x02, 0x02, 0xd3, 0x00, 0x9a, 0x48, 0x48, 0x8a, 0x53, 0x23, 0xe2, 0x7f,
+  0xdd, 0x02, 0x8a, 0x53, 0x23, 0xf2, 0xff, 0x51, 0x7f, 0x7f, 0xe2, 0x00,
+  0x9a, 0x48, 0x48, 0x27, 0x09, 0xd8, 0x1e, 0xfe, 0x28, 0x02, 0x27, 0x09,
+  0xd8, 0x3e, 0xff, 0x07, 0xfe, 0xfe, 0x1e, 0x00, 0x9d, 0x00, 0x03, 0x23,
+  0x00, 0xbc, 0x14, 0xc0, 0x44, 0x02, 0x23, 0x00, 0xbc, 0x34, 0xff, 0xff,
+  0xc0, 0x23, 0x34, 0x00, 0x9d, 0x00, 0x03, 0x0b, 0x00, 0x54, 0x8d, 0x01,
+  0xac, 0x02, 0x0b, 0x00, 0x54, 0xbd, 0xff, 0xff, 0x01, 0x0b, 0xbd, 0x00,
+  0x9d, 0xff, 0x02, 0x33, 0x01, 0xc6, 0x57, 0x40, 0x3a, 0x02, 0x33, 0x01,
+  0xc6, 0x77, 0xff, 0xff, 0x40, 0x33, 0x77, 0x00, 0x9d, 0xff, 0x02, 0xbf,
+  0x01, 0x70, 0x1e, 0x3f, 0x90, 0x02, 0xbf, 0x01, 0x70, 0x3e, 0xff, 0xff,
+  0x3f, 0xbf, 0x3e, 0x00, 0x9d, 0x81, 0x02, 0x30, 0x7f, 0x99, 0x1d, 0x0f,
+  0x67, 0x02, 0x30, 0x7f, 0x99, 0x3d, 0xff, 0xff, 0x0f, 0x30, 0x3d, 0x00,
+  0x9d, 0x81, 0x02, 0x91, 0x7f, 0xc5, 0x30, 0x7f, 0x3b, 0x02, 0x91, 0x7f,
+  0xc5, 0x30, 0xff, 0xff, 0x7f, 0x91, 0x30, 0x00, 0x9d, 0x2b, 0x02, 0xd2,
+  0xd5, 0x4a, 0xc0, 0x01, 0xb6, 0x02, 0xd2, 0xd5, 0x4a, 0xf0, 0xff, 0xff,
+  0x01, 0xd2, 0xf0, 0x00, 0x9d, 0x2b, 0x02, 0xd0, 0xd5, 0xc6, 0x21, 0xfe,
+  0x3a, 0x02, 0xd0, 0xd5, 0xc6, 0x31, 0xff, 0xff, 0xfe, 0xd0, 0x31, 0x00,
+  0x9d, 0x01, 0x02, 0x0f, 0xff, 0x55, 0xfe, 0x41, 0xab, 0x02, 0x0f, 0xff,
+  0x55, 0xfe, 0xff, 0xff, 0x41, 0x0f, 0xfe, 0x00, 0x9d, 0x01, 0x02, 0x14,
+  0xff, 0xa5, 0xe7, 0x40, 0x5b, 0x02, 0x14, 0xff, 0xa5, 0xf7, 0xff, 0xff,
+  0x40, 0x14, 0xf7, 0x00, 0xa0, 0x02, 0x48, 0x92, 0xf5, 0x9d, 0x53, 0x02,
+  0x63, 0x02, 0x92, 0xf5, 0x02, 0x71, 0xff, 0xfe, 0x02, 0x02, 0x92, 0x00,
+  0xa0, 0xc0, 0x48, 0x85, 0x5b, 0x3d, 0x55, 0xc0, 0xc3, 0x02, 0x85, 0x5b,
+  0xc0, 0xf5, 0xff, 0xfe, 0xc0, 0xc0, 0x85, 0x00, 0xa0, 0x01, 0x48, 0x20,
+  0xb4, 0x25, 0x64, 0x01, 0xdb, 0x02, 0x20, 0xb4, 0x01, 0x74, 0xff, 0xfe,
+  0x01, 0x01, 0x20, 0x00, 0xa0, 0x0f, 0x48, 0x2c, 0x26, 0x52, 0x25, 0x0f,
+  0xae, 0x02, 0x2c, 0x26, 0x0f, 0x35, 0xff, 0xfe, 0x0f, 0x0f, 0x2c, 0x00,
+  0xa0, 0x3f, 0x48, 0xfd, 0x8b, 0xe4, 0xd0, 0x3f, 0x1c, 0x02, 0xfd, 0x8b,
+  0x3f, 0x70, 0xff, 0xfe, 0x3f, 0x3f, 0xfd, 0x00, 0xa0, 0xff, 0x48, 0x50,
+  0x83, 0xa4, 0x06, 0xff, 0x5c, 0x02, 0x50, 0x83, 0xff, 0xb4, 0xff, 0xfe,
+  0xff, 0xff, 0x50, 0x00, 0xa1, 0x40, 0x48, 0x52, 0x00, 0x36, 0xf9, 0x3f,
+  0xca, 0x02, 0x3f, 0x00, 0x36, 0x79, 0xff, 0xfe, 0x3f, 0x3f, 0x3f, 0x00,
+  0xa1, 0x40, 0x48, 0xb5, 0x00, 0x56, 0xc6, 0x7f, 0xaa, 0x02, 0x7f, 0x00,
+  0x56, 0x74, 0xff, 0xfe, 0x7f, 0x7f, 0x7f, 0x00, 0xa1, 0x3f, 0x48, 0x26,
+  0x01, 0xa8, 0xfa, 0xc0, 0x58, 0x02, 0xc0, 0x01, 0xa8, 0xf8, 0xff, 0xfe,
+  0xc0, 0xc0, 0xc0, 0x00, 0xa1, 0x3f, 0x48, 0x4e, 0x01, 0x35, 0x92, 0xff,
+  0xcb, 0x02, 0xff, 0x01, 0x35, 0xb0, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x00,
+  0xa1, 0xc1, 0x48, 0x6a, 0x7f, 0xcc, 0xee, 0x0f, 0x34, 0x02, 0x0f, 0x7f,
+  0xcc, 0x7c, 0xff, 0xfe, 0x0f, 0x0f, 0x0f, 0x00, 0xa1, 0xc1, 0x48, 0x73,
+  0x7f, 0x3f, 0x59, 0x41, 0xc1, 0x02, 0x41, 0x7f, 0x3f, 0x79, 0xff, 0xfe,
+  0x41, 0x41, 0x41, 0x00, 0xa1, 0x6b, 0x48, 0x34, 0xd5, 0x56, 0xb5, 0xfe,
+  0xaa, 0x02, 0xfe, 0xd5, 0x56, 0xb5, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0x00,
+  0xa1, 0x6b, 0x48, 0x66, 0xd5, 0x2b, 0x59, 0xaa, 0xd5, 0x02, 0xaa, 0xd5,
+  0x2b, 0xf9, 0xff, 0xfe, 0xaa, 0xaa, 0xaa, 0x00, 0xa1, 0x41, 0x48, 0x34,
+  0xff, 0xd8, 0xec, 0xc0, 0x28, 0x02, 0xc0, 0xff, 0xd8, 0xfc, 0xff, 0xfe,
+  0xc0, 0xc0, 0xc0, 0x00, 0xa1, 0x41, 0x48, 0x5a, 0xff, 0x1e, 0xed, 0x00,
+  0xe2, 0x02, 0x00, 0xff, 0x1e, 0x7f, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00,
+  0xa2, 0x02, 0x48, 0xde, 0x2a, 0x58, 0xd2, 0x02, 0xa8, 0x02, 0xde, 0x02,
+  0x58, 0x70, 0xff, 0xfe, 0x02, 0x02, 0xde, 0x00, 0xa2, 0x01, 0x48, 0x97,
+  0xe9, 0xc4, 0x8a, 0x01, 0x3c, 0x02, 0x97, 0x01, 0xc4, 0x38, 0xff, 0xfe,
+  0x01, 0x01, 0x97, 0x00, 0xa2, 0xff, 0x48, 0x52, 0x39, 0x38, 0x00, 0xff,
+  0xc8, 0x02, 0x52, 0xff, 0x38, 0xb0, 0xff, 0xfe, 0xff, 0xff, 0x52, 0x00,
+  0xa2, 0xaa, 0x48, 0x56, 0xbd, 0x5a, 0xbe, 0xaa, 0xa6, 0x02, 0x56, 0xaa,
+  0x5a, 0xbc, 0xff, 0xfe, 0xaa, 0xaa, 0x56, 0x00, 0xa2, 0xff, 0x48, 0xc6,
+  0x75, 0x0b, 0xed, 0xff, 0xf5, 0x02, 0xc6, 0xff, 0x0b, 0xfd, 0xff, 0xfe,
+  0xff, 0xff, 0xc6, 0x00, 0xa2, 0x81, 0x48, 0x4c, 0x42, 0x2e, 0xcc, 0x81,
+  0xd2, 0x02, 0x4c, 0x81, 0x2e, 0xfc, 0xff, 0xfe, 0x81, 0x81, 0x4c, 0x00,
+  0xa3, 0x40, 0x48, 0x8d, 0x00, 0x6f, 0xa4, 0x00, 0x91, 0x02, 0x00, 0x00,
+  0x6f, 0x36, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0xa3, 0x40, 0x48, 0x9c,
+  0x00, 0x7c, 0xeb, 0x01, 0x84, 0x02, 0x01, 0x01, 0x7c, 0x79, 0xff, 0xfe,
+  0x01, 0x01, 0x01, 0x00, 0xa3, 0x3f, 0x48, 0x88, 0x01, 0xed, 0xe9, 0x3f,
+  0x13, 0x02, 0x3f, 0x3f, 0xed, 0x79, 0xff, 0xfe, 0x3f, 0x3f, 0x3f, 0x00,
+  0xa3, 0x3f, 0x48, 0x29, 0x01, 0x9e, 0xaf, 0xb5, 0x62, 0x02, 0xb5, 0xb5,
+  0x9e, 0xbd, 0xff, 0xfe, 0xb5, 0xb5, 0xb5, 0x00, 0xa3, 0xc1, 0x48, 0xf0,
+  0x7f, 0xf2, 0xc5, 0xc0, 0x0e, 0x02, 0xc0, 0xc0, 0xf2, 0xf5, 0xff, 0xfe,
+  0xc0, 0xc0, 0xc0, 0x00, 0xa3, 0xc1, 0x48, 0x02, 0x7f, 0x63, 0xaa, 0x40,
+  0x9d, 0x02, 0x40, 0x40, 0x63, 0x38, 0xff, 0xfe, 0x40, 0x40, 0x40, 0x00,
+  0xa3, 0x6b, 0x48, 0x07, 0xd5, 0x7a, 0xb3, 0x81, 0x86, 0x02, 0x81, 0x81,
+  0x7a, 0xb1, 0xff, 0xfe, 0x81, 0x81, 0x81, 0x00, 0xa3, 0x6b, 0x48, 0xd7,
+  0xd5, 0x99, 0x4b, 0xff, 0x67, 0x02, 0xff, 0xff, 0x99, 0xf9, 0xff, 0xfe,
+  0xff, 0xff, 0xff, 0x00, 0xa3, 0x41, 0x48, 0xa8, 0xff, 0x9e, 0x5e, 0xff,
+  0x62, 0x02, 0xff, 0xff, 0x9e, 0xfc, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x00,
+  0xa3, 0x41, 0x48, 0xd4, 0xff, 0xb1, 0xe1, 0x3f, 0x4f, 0x02, 0x3f, 0x3f,
+  0xb1, 0x71, 0xff, 0xfe, 0x3f, 0x3f, 0x3f, 0x00, 0xa4, 0x30, 0x48, 0x83,
+  0x11, 0xc8, 0x40, 0x80, 0x38, 0x02, 0x83, 0x11, 0x80, 0xf0, 0xff, 0xfe,
+  0x80, 0x80, 0x83, 0x00, 0xa4, 0x30, 0x48, 0x37, 0xb3, 0xbf, 0x3e, 0x00,
+  0x41, 0x02, 0x37, 0xb3, 0x00, 0x3e, 0xff, 0xfe, 0x00, 0x00, 0x37, 0x00,
+  0xa4, 0x30, 0x48, 0x6b, 0xf0, 0xe4, 0x45, 0x41, 0x1c, 0x02, 0x6b, 0xf0,
+  0x41, 0x75, 0xff, 0xfe, 0x41, 0x41, 0x6b, 0x00, 0xa4, 0x30, 0x48, 0x1a,
+  0xac, 0x38, 0xab, 0xa4, 0xc8, 0x02, 0x1a, 0xac, 0xa4, 0xb9, 0xff, 0xfe,
+  0xa4, 0xa4, 0x1a, 0x00, 0xa4, 0x30, 0x48, 0x07, 0x0c, 0xe7, 0xad, 0x3f,
+  0x19, 0x02, 0x07, 0x0c, 0x3f, 0x3d, 0xff, 0xfe, 0x3f, 0x3f, 0x07, 0x00,
+  0xa4, 0x30, 0x48, 0x2e, 0xbc, 0xaa, 0xe8, 0x81, 0x56, 0x02, 0x2e, 0xbc,
+  0x81, 0xf8, 0xff, 0xfe, 0x81, 0x81, 0x2e, 0x00, 0xa5, 0x30, 0x48, 0xb5,
+  0x3e, 0x13, 0x48, 0xaa, 0xed, 0x02, 0xaa, 0x3e, 0x13, 0xf8, 0xff, 0xfe,
+  0xaa, 0xaa, 0xaa, 0x00, 0xa5, 0x30, 0x48, 0x9b, 0x26, 0x5e, 0x55, 0x7f,
+  0xa2, 0x02, 0x7f, 0x26, 0x5e, 0x75, 0xff, 0xfe, 0x7f, 0x7f, 0x7f, 0x00,
+  0xa5, 0x30, 0x48, 0xd2, 0x2b, 0xeb, 0x21, 0x40, 0x15, 0x02, 0x40, 0x2b,
+  0xeb, 0x31, 0xff, 0xfe, 0x40, 0x40, 0x40, 0x00, 0xa5, 0x30, 0x48, 0x8d,
+  0x79, 0xce, 0xc1, 0xff, 0x32, 0x02, 0xff, 0x79, 0xce, 0xf1, 0xff, 0xfe,
+  0xff, 0xff, 0xff, 0x00, 0xa5, 0x30, 0x48, 0x30, 0xf2, 0xb2, 0x6f, 0x00,
+  0x4e, 0x02, 0x00, 0xf2, 0xb2, 0x7f, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00,
+  0xa5, 0x30, 0x48, 0xf8, 0xbc, 0x4b, 0x5f, 0x01, 0xb5, 0x02, 0x01, 0xbc,
+  0x4b, 0x7d, 0xff, 0xfe, 0x01, 0x01, 0x01, 0x00, 0xa6, 0x30, 0x48, 0x83,
+  0x43, 0x60, 0x3b, 0x0f, 0xa0, 0x02, 0x83, 0x0f, 0x60, 0x39, 0xff, 0xfe,
+  0x0f, 0x0f, 0x83, 0x00, 0xa6, 0x30, 0x48, 0xe8, 0xd9, 0x07, 0x46, 0x40,
+  0xf9, 0x02, 0xe8, 0x40, 0x07, 0x74, 0xff, 0xfe, 0x40, 0x40, 0xe8, 0x00,
+  0xa6, 0x30, 0x48, 0xf8, 0x92, 0xcc, 0x76, 0xc0, 0x34, 0x02, 0xf8, 0xc0,
+  0xcc, 0xf4, 0xff, 0xfe, 0xc0, 0xc0, 0xf8, 0x00, 0xa6, 0x30, 0x48, 0x71,
+  0xec, 0xc8, 0x35, 0x81, 0x38, 0x02, 0x71, 0x81, 0xc8, 0xb5, 0xff, 0xfe,
+  0x81, 0x81, 0x71, 0x00, 0xa6, 0x30, 0x48, 0x73, 0xe6, 0x8c, 0xa8, 0x80,
+  0x74, 0x02, 0x73, 0x80, 0x8c, 0xb8, 0xff, 0xfe, 0x80, 0x80, 0x73, 0x00,
+  0xa6, 0x30, 0x48, 0x57, 0x99, 0x46, 0x05, 0xf0, 0xba, 0x02, 0x57, 0xf0,
+  0x46, 0xb5, 0xff, 0xfe, 0xf0, 0xf0, 0x57, 0x00, 0xa7, 0x30, 0x48, 0x82,
+  0x32, 0xe5, 0xc7, 0x00, 0x1b, 0x02, 0x00, 0x00, 0xe5, 0x77, 0xff, 0xfe,
+  0x00, 0x00, 0x00, 0x00, 0xa7, 0x30, 0x48, 0xbe, 0xdf, 0x37, 0xeb, 0xaa,
+  0xc9, 0x02, 0xaa, 0xaa, 0x37, 0xf9, 0xff, 0xfe, 0xaa, 0xaa, 0xaa, 0x00,
+  0xa7, 0x30, 0x48, 0x38, 0xe7, 0x1b, 0x50, 0x80, 0xe5, 0x02, 0x80, 0x80,
+  0x1b, 0xf0, 0xff, 0xfe, 0x80, 0x80, 0x80, 0x00, 0xa7, 0x30, 0x48, 0x8f,
+  0x03, 0xc1, 0x89, 0x02, 0x3f, 0x02, 0x02, 0x02, 0xc1, 0x39, 0xff, 0xfe,
+  0x02, 0x02, 0x02, 0x00, 0xa7, 0x30, 0x48, 0xde, 0x0a, 0x75, 0xd9, 0x7f,
+  0x8b, 0x02, 0x7f, 0x7f, 0x75, 0x79, 0xff, 0xfe, 0x7f, 0x7f, 0x7f, 0x00,
+  0xa7, 0x30, 0x48, 0x89, 0xd2, 0x50, 0x82, 0xaa, 0xb0, 0x02, 0xaa, 0xaa,
+  0x50, 0xb0, 0xff, 0xfe, 0xaa, 0xaa, 0xaa, 0x00, 0xa8, 0x48, 0x48, 0xd2,
+  0x3c, 0x4c, 0xf1, 0xc0, 0xb4, 0x02, 0xd2, 0x3c, 0xd2, 0xf1, 0xff, 0xfd,
+  0xc0, 0xc0, 0xd2, 0x00, 0xa8, 0x48, 0x48, 0x36, 0x6c, 0xfb, 0x60, 0x40,
+  0x05, 0x02, 0x36, 0x6c, 0x36, 0x70, 0xff, 0xfd, 0x40, 0x40, 0x36, 0x00,
+  0xa8, 0x48, 0x48, 0x96, 0xca, 0x4a, 0xab, 0x3f, 0xb6, 0x02, 0x96, 0xca,
+  0x96, 0xb9, 0xff, 0xfd, 0x3f, 0x3f, 0x96, 0x00, 0xa8, 0x48, 0x48, 0x9b,
+  0xef, 0x46, 0x0b, 0x3f, 0xba, 0x02, 0x9b, 0xef, 0x9b, 0xb9, 0xff, 0xfd,
+  0x3f, 0x3f, 0x9b, 0x00, 0xa8, 0x48, 0x48, 0x05, 0x19, 0xbe, 0x24, 0x80,
+  0x42, 0x02, 0x05, 0x19, 0x05, 0x34, 0xff, 0xfd, 0x80, 0x80, 0x05, 0x00,
+  0xa8, 0x48, 0x48, 0x85, 0x86, 0xee, 0x43, 0x80, 0x12, 0x02, 0x85, 0x86,
+  0x85, 0xf1, 0xff, 0xfd, 0x80, 0x80, 0x85, 0x00, 0xa9, 0x41, 0x48, 0xd3,
+  0x69, 0x21, 0x2b, 0x41, 0xdf, 0x02, 0x41, 0x69, 0x21, 0x39, 0xff, 0xfe,
+  0x41, 0x41, 0x41, 0x00, 0xa9, 0xfe, 0x48, 0xf6, 0x8b, 0x63, 0xf0, 0xfe,
+  0x9d, 0x02, 0xfe, 0x8b, 0x63, 0xf0, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0x00,
+  0xa9, 0xc0, 0x48, 0x75, 0xa3, 0xd0, 0x16, 0xc0, 0x30, 0x02, 0xc0, 0xa3,
+  0xd0, 0xb4, 0xff, 0xfe, 0xc0, 0xc0, 0xc0, 0x00, 0xa9, 0x01, 0x48, 0x49,
+  0x54, 0x93, 0x92, 0x01, 0x6d, 0x02, 0x01, 0x54, 0x93, 0x30, 0xff, 0xfe,
+  0x01, 0x01, 0x01, 0x00, 0xa9, 0x02, 0x48, 0xba, 0x61, 0x1d, 0x56, 0x02,
+  0xe3, 0x02, 0x02, 0x61, 0x1d, 0x74, 0xff, 0xfe, 0x02, 0x02, 0x02, 0x00,
+  0xa9, 0x41, 0x48, 0xeb, 0x5d, 0x1a, 0xb3, 0x41, 0xe6, 0x02, 0x41, 0x5d,
+  0x1a, 0x31, 0xff, 0xfe, 0x41, 0x41, 0x41, 0x00, 0xaa, 0x48, 0x48, 0x01,
+  0xdc, 0x03, 0xfd, 0x0f, 0xfd, 0x02, 0x01, 0x01, 0x03, 0x7d, 0xff, 0xfd,
+  0x0f, 0x0f, 0x01, 0x00, 0xaa, 0x48, 0x48, 0x97, 0x51, 0x33, 0xef, 0x81,
+  0xcd, 0x02, 0x97, 0x97, 0x33, 0xfd, 0xff, 0xfd, 0x81, 0x81, 0x97, 0x00,
+  0xaa, 0x48, 0x48, 0xde, 0xb3, 0xa3, 0x0f, 0x02, 0x5d, 0x02, 0xde, 0xde,
+  0xa3, 0xbd, 0xff, 0xfd, 0x02, 0x02, 0xde, 0x00, 0xaa, 0x48, 0x48, 0xf6,
+  0x94, 0xbf, 0xed, 0x41, 0x41, 0x02, 0xf6, 0xf6, 0xbf, 0xfd, 0xff, 0xfd,
+  0x41, 0x41, 0xf6, 0x00, 0xaa, 0x48, 0x48, 0x04, 0x17, 0x45, 0xba, 0x7f,
+  0xbb, 0x02, 0x04, 0x04, 0x45, 0x38, 0xff, 0xfd, 0x7f, 0x7f, 0x04, 0x00,
+  0xaa, 0x48, 0x48, 0x3f, 0x10, 0x78, 0x67, 0x3f, 0x88, 0x02, 0x3f, 0x3f,
+  0x78, 0x75, 0xff, 0xfd, 0x3f, 0x3f, 0x3f, 0x00, 0xac, 0x00, 0x03, 0xab,
+  0xf0, 0x7b, 0xaa, 0x3f, 0x85, 0x02, 0xab, 0xf0, 0x3f, 0x38, 0xff, 0xff,
+  0x3f, 0x3f, 0x38, 0x00, 0xac, 0x00, 0x03, 0x7b, 0x08, 0xf5, 0x64, 0x41,
+  0x0b, 0x02, 0x7b, 0x08, 0x41, 0x74, 0xff, 0xff, 0x41, 0x41, 0x74, 0x00,
+  0xac, 0x00, 0x03, 0x52, 0xbe, 0x86, 0x92, 0x3f, 0x7a, 0x02, 0x52, 0xbe,
+  0x3f, 0x30, 0xff, 0xff, 0x3f, 0x3f, 0x30, 0x00, 0xac, 0x00, 0x03, 0xfb,
+  0xd0, 0x85, 0x98, 0xf1, 0x7b, 0x02, 0xfb, 0xd0, 0xf1, 0xb8, 0xff, 0xff,
+  0xf1, 0xf1, 0xb8, 0x00, 0xac, 0x00, 0x03, 0x5f, 0xf5, 0x4d, 0xf6, 0x0f,
+  0xb3, 0x02, 0x5f, 0xf5, 0x0f, 0x74, 0xff, 0xff, 0x0f, 0x0f, 0x74, 0x00,
+  0xac, 0x00, 0x03, 0x61, 0xec, 0xce, 0x0d, 0xff, 0x32, 0x02, 0x61, 0xec,
+  0xff, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xbd, 0x00, 0xad, 0x00, 0x03, 0x24,
+  0x0d, 0x5b, 0xd6, 0xaa, 0xa5, 0x02, 0xaa, 0x0d, 0x5b, 0xf4, 0xff, 0xff,
+  0xaa, 0xaa, 0xf4, 0x00, 0xad, 0x00, 0x03, 0xc6, 0xb7, 0x07, 0x41, 0x81,
+  0xf9, 0x02, 0x81, 0xb7, 0x07, 0xf1, 0xff, 0xff, 0x81, 0x81, 0xf1, 0x00,
+  0xad, 0x00, 0x03, 0xd8, 0x2d, 0x7e, 0x68, 0x00, 0x82, 0x02, 0x00, 0x2d,
+  0x7e, 0x7a, 0xff, 0xff, 0x00, 0x00, 0x7a, 0x00, 0xad, 0x00, 0x03, 0x92,
+  0xc7, 0x25, 0xc2, 0x46, 0xdb, 0x02, 0x46, 0xc7, 0x25, 0x70, 0xff, 0xff,
+  0x46, 0x46, 0x70, 0x00, 0xad, 0x00, 0x03, 0xc3, 0xad, 0x16, 0x40, 0x7f,
+  0xea, 0x02, 0x7f, 0xad, 0x16, 0x70, 0xff, 0xff, 0x7f, 0x7f, 0x70, 0x00,
+  0xad, 0x00, 0x03, 0x07, 0x7e, 0x87, 0x7b, 0x3f, 0x79, 0x02, 0x3f, 0x7e,
+  0x87, 0x79, 0xff, 0xff, 0x3f, 0x3f, 0x79, 0x00, 0xae, 0x00, 0x03, 0x8f,
+  0xf1, 0x0f, 0x19, 0x01, 0xf1, 0x02, 0x8f, 0x01, 0x0f, 0x39, 0xff, 0xff,
+  0x01, 0x01, 0x39, 0x00, 0xae, 0x00, 0x03, 0xf6, 0xc9, 0xda, 0x44, 0x02,
+  0x26, 0x02, 0xf6, 0x02, 0xda, 0x74, 0xff, 0xff, 0x02, 0x02, 0x74, 0x00,
+  0xae, 0x00, 0x03, 0x22, 0xcb, 0xe4, 0xc9, 0xfe, 0x1c, 0x02, 0x22, 0xfe,
+  0xe4, 0xf9, 0xff, 0xff, 0xfe, 0xfe, 0xf9, 0x00, 0xae, 0x00, 0x03, 0xcb,
+  0xe8, 0xc0, 0x2c, 0x40, 0x40, 0x02, 0xcb, 0x40, 0xc0, 0x3c, 0xff, 0xff,
+  0x40, 0x40, 0x3c, 0x00, 0xae, 0x00, 0x03, 0xb1, 0x27, 0x63, 0x81, 0x3f,
+  0x9d, 0x02, 0xb1, 0x3f, 0x63, 0x31, 0xff, 0xff, 0x3f, 0x3f, 0x31, 0x00,
+  0xae, 0x00, 0x03, 0xf6, 0x6a, 0x4e, 0xe2, 0x41, 0xb2, 0x02, 0xf6, 0x41,
+  0x4e, 0x70, 0xff, 0xff, 0x41, 0x41, 0x70, 0x00, 0xaf, 0x00, 0x03, 0xd1,
+  0x1e, 0xf0, 0x64, 0x3f, 0x10, 0x02, 0x3f, 0x3f, 0xf0, 0x74, 0xff, 0xff,
+  0x3f, 0x3f, 0x74, 0x00, 0xaf, 0x00, 0x03, 0x62, 0xc2, 0x54, 0xeb, 0x7f,
+  0xac, 0x02, 0x7f, 0x7f, 0x54, 0x79, 0xff, 0xff, 0x7f, 0x7f, 0x79, 0x00,
+  0xaf, 0x00, 0x03, 0xef, 0xa6, 0x15, 0xb0, 0xff, 0xeb, 0x02, 0xff, 0xff,
+  0x15, 0xb0, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x00, 0xaf, 0x00, 0x03, 0x0b,
+  0xc4, 0x07, 0x98, 0x81, 0xf9, 0x02, 0x81, 0x81, 0x07, 0xb8, 0xff, 0xff,
+  0x81, 0x81, 0xb8, 0x00, 0xaf, 0x00, 0x03, 0xce, 0xb7, 0xa8, 0x43, 0x3f,
+  0x58, 0x02, 0x3f, 0x3f, 0xa8, 0x71, 0xff, 0xff, 0x3f, 0x3f, 0x71, 0x00,
+  0xaf, 0x00, 0x03, 0x80, 0x20, 0x52, 0x50, 0x0f, 0xae, 0x02, 0x0f, 0x0f,
+  0x52, 0x70, 0xff, 0xff, 0x0f, 0x0f, 0x70, 0x00, 0xb0, 0x01, 0x48, 0xec,
+  0x42, 0xe3, 0xe0, 0x64, 0x00, 0x03, 0xec, 0x42, 0xe3, 0xf0, 0xff, 0xfe,
+  0x64, 0x64, 0xec, 0x00, 0xb0, 0x01, 0x48, 0x8c, 0x75, 0x49, 0x47, 0x0e,
+  0x00, 0x03, 0x8c, 0x75, 0x49, 0x77, 0xff, 0xff, 0x0e, 0x0e, 0x77, 0x00,
+  0xb0, 0x01, 0x48, 0x10, 0x3a, 0xfc, 0x7d, 0xf8, 0x00, 0x03, 0x10, 0x3a,
+  0xfc, 0x7d, 0xff, 0xff, 0xf8, 0xf8, 0x7d, 0x00, 0xb0, 0x01, 0x48, 0x8a,
+  0x90, 0xcf, 0x92, 0x3c, 0x00, 0x03, 0x8a, 0x90, 0xcf, 0xb2, 0xff, 0xfe,
+  0x3c, 0x3c, 0x8a, 0x00, 0xb0, 0x01, 0x48, 0x8d, 0x7e, 0x31, 0x14, 0x48,
+  0x00, 0x03, 0x8d, 0x7e, 0x31, 0x34, 0xff, 0xfe, 0x48, 0x48, 0x8d, 0x00,
+  0xb0, 0x01, 0x48, 0x7e, 0x1c, 0x2b, 0xd5, 0x48, 0x00, 0x03, 0x7e, 0x1c,
+  0x2b, 0xf5, 0xff, 0xff, 0x48, 0x48, 0xf5, 0x00, 0xb0, 0x01, 0x48, 0xa7,
+  0x25, 0xc0, 0xf7, 0x15, 0x00, 0x03, 0xa7, 0x25, 0xc0, 0xf7, 0xff, 0xff,
+  0x15, 0x15, 0xf7, 0x00, 0xb0, 0x01, 0x48, 0x61, 0x8d, 0xc0, 0xd0, 0x73,
+  0x00, 0x03, 0x61, 0x8d, 0xc0, 0xf0, 0xff, 0xfe, 0x73, 0x73, 0x61, 0x00,
+  0xb0, 0x01, 0x48, 0xf8, 0x32, 0x37, 0xa8, 0xd1, 0x00, 0x03, 0xf8, 0x32,
+  0x37, 0xb8, 0xff, 0xfe, 0xd1, 0xd1, 0xf8, 0x00, 0xb0, 0x01, 0x48, 0xdd,
+  0x0e, 0x49, 0x7b, 0x3c, 0x00, 0x03, 0xdd, 0x0e, 0x49, 0x7b, 0xff, 0xff,
+  0x3c, 0x3c, 0x7b, 0x00, 0xb0, 0x01, 0x48, 0x2f, 0x6e, 0x28, 0xeb, 0xd7,
+  0x00, 0x03, 0x2f, 0x6e, 0x28, 0xfb, 0xff, 0xff, 0xd7, 0xd7, 0xfb, 0x00,
+  0xb0, 0x01, 0x48, 0x81, 0x15, 0x89, 0xce, 0x66, 0x00, 0x03, 0x81, 0x15,
+  0x89, 0xfe, 0xff, 0xfe, 0x66, 0x66, 0x81, 0x00, 0xb0, 0x01, 0x48, 0xe5,
+  0x35, 0xea, 0x0a, 0x45, 0x00, 0x03, 0xe5, 0x35, 0xea, 0x3a, 0xff, 0xfe,
+  0x45, 0x45, 0xe5, 0x00, 0xb0, 0x01, 0x48, 0x61, 0x2c, 0x96, 0xd9, 0xfc,
+  0x00, 0x03, 0x61, 0x2c, 0x96, 0xf9, 0xff, 0xff, 0xfc, 0xfc, 0xf9, 0x00,
+  0xb0, 0x01, 0x48, 0xfc, 0xc2, 0x25, 0x9e, 0x55, 0x00, 0x03, 0xfc, 0xc2,
+  0x25, 0xbe, 0xff, 0xfe, 0x55, 0x55, 0xfc, 0x00, 0xb0, 0x01, 0x48, 0x21,
+  0x22, 0xb4, 0x39, 0x62, 0x00, 0x03, 0x21, 0x22, 0xb4, 0x39, 0xff, 0xff,
+  0x62, 0x62, 0x39, 0x00, 0xb0, 0x01, 0x48, 0xc9, 0x38, 0xfb, 0x40, 0x55,
+  0x00, 0x03, 0xc9, 0x38, 0xfb, 0x70, 0xff, 0xfe, 0x55, 0x55, 0xc9, 0x00,
+  0xb0, 0x01, 0x48, 0x40, 0x21, 0x8e, 0x23, 0x0f, 0x00, 0x03, 0x40, 0x21,
+  0x8e, 0x33, 0xff, 0xff, 0x0f, 0x0f, 0x33, 0x00, 0xb0, 0x01, 0x48, 0xec,
+  0x72, 0xcc, 0x9d, 0xd9, 0x00, 0x03, 0xec, 0x72, 0xcc, 0xbd, 0xff, 0xff,
+  0xd9, 0xd9, 0xbd, 0x00, 0xb0, 0x01, 0x48, 0x68, 0x64, 0xbe, 0xc3, 0x97,
+  0x00, 0x03, 0x68, 0x64, 0xbe, 0xf3, 0xff, 0xff, 0x97, 0x97, 0xf3, 0x00,
+  0xb0, 0x00, 0x48, 0x0c, 0x69, 0xfc, 0xe3, 0x89, 0x00, 0x03, 0x0c, 0x69,
+  0xfc, 0xf3, 0xff, 0xfe, 0x89, 0x89, 0x0c, 0x00, 0xb0, 0x00, 0x48, 0x0c,
+  0xd2, 0xf1, 0x91, 0xd6, 0x00, 0x03, 0x0c, 0xd2, 0xf1, 0xb1, 0xff, 0xfe,
+  0xd6, 0xd6, 0x0c, 0x00, 0xb0, 0x00, 0x48, 0x98, 0x18, 0xfa, 0xa6, 0x3d,
+  0x00, 0x03, 0x98, 0x18, 0xfa, 0xb6, 0xff, 0xfe, 0x3d, 0x3d, 0x98, 0x00,
+  0xb0, 0x00, 0x48, 0xc6, 0x24, 0x27, 0xed, 0xe6, 0x00, 0x03, 0xc6, 0x24,
+  0x27, 0xfd, 0xff, 0xfe, 0xe6, 0xe6, 0xc6, 0x00, 0xb1, 0x42, 0x48, 0x4b,
+  0xb9, 0x00, 0x0d, 0x3f, 0x00, 0x03, 0x3f, 0xb9, 0x00, 0x3d, 0xff, 0xfe,
+  0x3f, 0x3f, 0x3f, 0x00, 0xb1, 0x42, 0x48, 0xab, 0x24, 0x00, 0x04, 0xaa,
+  0x00, 0x03, 0xaa, 0x24, 0x00, 0xb4, 0xff, 0xfe, 0xaa, 0xaa, 0xaa, 0x00,
+  0xb1, 0x42, 0x48, 0x07, 0xae, 0x01, 0xac, 0x01, 0xff, 0x02, 0x01, 0xae,
+  0x01, 0x3c, 0xff, 0xfe, 0x01, 0x01, 0x01, 0x00, 0xb1, 0x42, 0x48, 0x7e,
+  0x2f, 0x01, 0xac, 0x00, 0xff, 0x02, 0x00, 0x2f, 0x01, 0x3e, 0xff, 0xfe,
+  0x00, 0x00, 0x00, 0x00, 0xb1, 0x42, 0x48, 0xa6, 0x35, 0x7f, 0xc4, 0xfe,
+  0x81, 0x02, 0xfe, 0x35, 0x7f, 0xf4, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0x00,
+  0xb1, 0x42, 0x48, 0x49, 0x93, 0x7f, 0x4b, 0xbb, 0x81, 0x02, 0xbb, 0x93,
+  0x7f, 0xf9, 0xff, 0xfe, 0xbb, 0xbb, 0xbb, 0x00, 0xb1, 0x42, 0x48, 0x3f,
+  0x30, 0xd5, 0x78, 0x02, 0x2b, 0x02, 0x02, 0x30, 0xd5, 0x78, 0xff, 0xfe,
+  0x02, 0x02, 0x02, 0x00, 0xb1, 0x42, 0x48, 0xb5, 0xc0, 0xd5, 0xcb, 0x02,
+  0x2b, 0x02, 0x02, 0xc0, 0xd5, 0x79, 0xff, 0xfe, 0x02, 0x02, 0x02, 0x00,
+  0xb1, 0x42, 0x48, 0x69, 0xb5, 0xff, 0x09, 0xfe, 0x01, 0x02, 0xfe, 0xb5,
+  0xff, 0xb9, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0x00, 0xb1, 0x42, 0x48, 0xbf,
+  0xd4, 0xff, 0x7e, 0xaa, 0x01, 0x02, 0xaa, 0xd4, 0xff, 0xfc, 0xff, 0xfe,
+  0xaa, 0xaa, 0xaa, 0x00, 0xb3, 0x42, 0x48, 0x32, 0xf5, 0x00, 0x92, 0x80,
+  0x00, 0x03, 0x80, 0x80, 0x00, 0xb0, 0xff, 0xfe, 0x80, 0x80, 0x80, 0x00,
+  0xb3, 0x42, 0x48, 0x66, 0x53, 0x00, 0xdd, 0x0f, 0x00, 0x03, 0x0f, 0x0f,
+  0x00, 0x7d, 0xff, 0xfe, 0x0f, 0x0f, 0x0f, 0x00, 0xb3, 0x42, 0x48, 0x0c,
+  0x09, 0x01, 0xd3, 0x40, 0xff, 0x02, 0x40, 0x40, 0x01, 0x71, 0xff, 0xfe,
+  0x40, 0x40, 0x40, 0x00, 0xb3, 0x42, 0x48, 0xc8, 0x95, 0x01, 0x3e, 0x40,
+  0xff, 0x02, 0x40, 0x40, 0x01, 0x3c, 0xff, 0xfe, 0x40, 0x40, 0x40, 0x00,
+  0xb3, 0x42, 0x48, 0x84, 0x27, 0x7f, 0xae, 0x7f, 0x81, 0x02, 0x7f, 0x7f,
+  0x7f, 0x3c, 0xff, 0xfe, 0x7f, 0x7f, 0x7f, 0x00, 0xb3, 0x42, 0x48, 0xa5,
+  0xbc, 0x7f, 0x44, 0x80, 0x81, 0x02, 0x80, 0x80, 0x7f, 0xf4, 0xff, 0xfe,
+  0x80, 0x80, 0x80, 0x00, 0xb3, 0x42, 0x48, 0xcb, 0x32, 0xd5, 0x49, 0x0f,
+  0x2b, 0x02, 0x0f, 0x0f, 0xd5, 0x79, 0xff, 0xfe, 0x0f, 0x0f, 0x0f, 0x00,
+  0xb3, 0x42, 0x48, 0x54, 0x9c, 0xd5, 0x04, 0x3f, 0x2b, 0x02, 0x3f, 0x3f,
+  0xd5, 0x34, 0xff, 0xfe, 0x3f, 0x3f, 0x3f, 0x00, 0xb3, 0x42, 0x48, 0x13,
+  0x72, 0xff, 0x88, 0x0f, 0x01, 0x02, 0x0f, 0x0f, 0xff, 0x38, 0xff, 0xfe,
+  0x0f, 0x0f, 0x0f, 0x00, 0xb3, 0x42, 0x48, 0xa5, 0xfa, 0xff, 0xb7, 0x40,
+  0x01, 0x02, 0x40, 0x40, 0xff, 0x35, 0xff, 0xfe, 0x40, 0x40, 0x40, 0x00,
+  0xb4, 0x30, 0x48, 0x4c, 0x00, 0xbc, 0x92, 0x81, 0x44, 0x02, 0x4c, 0x00,
+  0x81, 0xb0, 0xff, 0xfe, 0x81, 0x81, 0x4c, 0x00, 0xb4, 0x30, 0x48, 0x7a,
+  0x00, 0x11, 0xce, 0xaa, 0xef, 0x02, 0x7a, 0x00, 0xaa, 0xfc, 0xff, 0xfe,
+  0xaa, 0xaa, 0x7a, 0x00, 0xb4, 0x2f, 0x48, 0xf6, 0x01, 0xef, 0xe3, 0x0f,
+  0x11, 0x02, 0xf6, 0x01, 0x0f, 0x71, 0xff, 0xfe, 0x0f, 0x0f, 0xf6, 0x00,
+  0xb4, 0x2f, 0x48, 0xc5, 0x01, 0xd1, 0xea, 0x19, 0x2f, 0x02, 0xc5, 0x01,
+  0x19, 0x78, 0xff, 0xfe, 0x19, 0x19, 0xc5, 0x00, 0xb4, 0xb1, 0x48, 0xaf,
+  0x7f, 0x33, 0x86, 0x40, 0xcd, 0x02, 0xaf, 0x7f, 0x40, 0x34, 0xff, 0xfe,
+  0x40, 0x40, 0xaf, 0x00, 0xb4, 0xb1, 0x48, 0xf8, 0x7f, 0xe8, 0xf1, 0x7f,
+  0x18, 0x02, 0xf8, 0x7f, 0x7f, 0x71, 0xff, 0xfe, 0x7f, 0x7f, 0xf8, 0x00,
+  0xb4, 0x5b, 0x48, 0xae, 0xd5, 0x70, 0xb0, 0x0f, 0x90, 0x02, 0xae, 0xd5,
+  0x0f, 0x30, 0xff, 0xfe, 0x0f, 0x0f, 0xae, 0x00, 0xb4, 0x5b, 0x48, 0x64,
+  0xd5, 0x66, 0x3a, 0x02, 0x9a, 0x02, 0x64, 0xd5, 0x02, 0x38, 0xff, 0xfe,
+  0x02, 0x02, 0x64, 0x00, 0xb4, 0x31, 0x48, 0x12, 0xff, 0xde, 0x09, 0x3f,
+  0x22, 0x02, 0x12, 0xff, 0x3f, 0x39, 0xff, 0xfe, 0x3f, 0x3f, 0x12, 0x00,
+  0xb4, 0x31, 0x48, 0xe7, 0xff, 0x72, 0x8b, 0x7f, 0x8e, 0x02, 0xe7, 0xff,
+  0x7f, 0x39, 0xff, 0xfe, 0x7f, 0x7f, 0xe7, 0x00, 0xb5, 0x30, 0x48, 0xbd,
+  0x00, 0xa2, 0x62, 0x3f, 0x5e, 0x02, 0x3f, 0x00, 0xa2, 0x70, 0xff, 0xfe,
+  0x3f, 0x3f, 0x3f, 0x00, 0xb5, 0x30, 0x48, 0xc1, 0x00, 0x6e, 0x40, 0x0f,
+  0x92, 0x02, 0x0f, 0x00, 0x6e, 0x70, 0xff, 0xfe, 0x0f, 0x0f, 0x0f, 0x00,
+  0xb5, 0x2f, 0x48, 0xba, 0x01, 0x08, 0x2c, 0x41, 0xf8, 0x02, 0x41, 0x01,
+  0x08, 0x3c, 0xff, 0xfe, 0x41, 0x41, 0x41, 0x00, 0xb5, 0x2f, 0x48, 0x75,
+  0x01, 0x2a, 0x39, 0x00, 0xd6, 0x02, 0x00, 0x01, 0x2a, 0x3b, 0xff, 0xfe,
+  0x00, 0x00, 0x00, 0x00, 0xb5, 0xb1, 0x48, 0xc2, 0x7f, 0x04, 0xa8, 0x40,
+  0xfc, 0x02, 0x40, 0x7f, 0x04, 0x38, 0xff, 0xfe, 0x40, 0x40, 0x40, 0x00,
+  0xb5, 0xb1, 0x48, 0x5c, 0x7f, 0x9e, 0xae, 0x40, 0x62, 0x02, 0x40, 0x7f,
+  0x9e, 0x3c, 0xff, 0xfe, 0x40, 0x40, 0x40, 0x00, 0xb5, 0x5b, 0x48, 0x42,
+  0xd5, 0x6b, 0xa0, 0x80, 0x95, 0x02, 0x80, 0xd5, 0x6b, 0xb0, 0xff, 0xfe,
+  0x80, 0x80, 0x80, 0x00, 0xb5, 0x5b, 0x48, 0xec, 0xd5, 0xa6, 0x8e, 0x00,
+  0x5a, 0x02, 0x00, 0xd5, 0xa6, 0x3e, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00,
+  0xb5, 0x31, 0x48, 0x15, 0xff, 0xbe, 0x06, 0x01, 0x42, 0x02, 0x01, 0xff,
+  0xbe, 0x34, 0xff, 0xfe, 0x01, 0x01, 0x01, 0x00, 0xb5, 0x31, 0x48, 0xe6,
+  0xff, 0x26, 0xa2, 0x7f, 0xda, 0x02, 0x7f, 0xff, 0x26, 0x30, 0xff, 0xfe,
+  0x7f, 0x7f, 0x7f, 0x00, 0xb6, 0x30, 0x48, 0x4d, 0xcf, 0x00, 0xd9, 0x40,
+  0x00, 0x03, 0x4d, 0x40, 0x00, 0x79, 0xff, 0xfe, 0x40, 0x40, 0x4d, 0x00,
+  0xb6, 0x30, 0x48, 0x1e, 0xa1, 0x00, 0x83, 0xc0, 0x00, 0x03, 0x1e, 0xc0,
+  0x00, 0xb1, 0xff, 0xfe, 0xc0, 0xc0, 0x1e, 0x00, 0xb6, 0x2f, 0x48, 0xbe,
+  0x88, 0x01, 0xf9, 0x01, 0xff, 0x02, 0xbe, 0x01, 0x01, 0x79, 0xff, 0xfe,
+  0x01, 0x01, 0xbe, 0x00, 0xb6, 0x2f, 0x48, 0x71, 0xdd, 0x01, 0x30, 0xff,
+  0xff, 0x02, 0x71, 0xff, 0x01, 0xb0, 0xff, 0xfe, 0xff, 0xff, 0x71, 0x00,
+  0xb6, 0xb1, 0x48, 0x1b, 0x3b, 0x7f, 0xa2, 0x00, 0x81, 0x02, 0x1b, 0x00,
+  0x7f, 0x32, 0xff, 0xfe, 0x00, 0x00, 0x1b, 0x00, 0xb6, 0xb1, 0x48, 0x82,
+  0x03, 0x7f, 0xde, 0xff, 0x81, 0x02, 0x82, 0xff, 0x7f, 0xfc, 0xff, 0xfe,
+  0xff, 0xff, 0x82, 0x00, 0xb6, 0x5b, 0x48, 0xb1, 0x9d, 0xd5, 0x6a, 0xaa,
+  0x2b, 0x02, 0xb1, 0xaa, 0xd5, 0xf8, 0xff, 0xfe, 0xaa, 0xaa, 0xb1, 0x00,
+  0xb6, 0x5b, 0x48, 0xb3, 0x9a, 0xd5, 0x1e, 0xf7, 0x2b, 0x02, 0xb3, 0xf7,
+  0xd5, 0xbc, 0xff, 0xfe, 0xf7, 0xf7, 0xb3, 0x00, 0xb6, 0x31, 0x48, 0x76,
+  0x88, 0xff, 0x61, 0x40, 0x01, 0x02, 0x76, 0x40, 0xff, 0x71, 0xff, 0xfe,
+  0x40, 0x40, 0x76, 0x00, 0xb6, 0x31, 0x48, 0x09, 0xc9, 0xff, 0x43, 0x0f,
+  0x01, 0x02, 0x09, 0x0f, 0xff, 0x71, 0xff, 0xfe, 0x0f, 0x0f, 0x09, 0x00,
+  0xb7, 0x30, 0x48, 0xf4, 0xda, 0x00, 0x49, 0x3f, 0x00, 0x03, 0x3f, 0x3f,
+  0x00, 0x79, 0xff, 0xfe, 0x3f, 0x3f, 0x3f, 0x00, 0xb7, 0x30, 0x48, 0x3f,
+  0xa5, 0x00, 0x19, 0x7f, 0x00, 0x03, 0x7f, 0x7f, 0x00, 0x39, 0xff, 0xfe,
+  0x7f, 0x7f, 0x7f, 0x00, 0xb7, 0x2f, 0x48, 0x2e, 0x85, 0x01, 0x36, 0x81,
+  0xff, 0x02, 0x81, 0x81, 0x01, 0xb4, 0xff, 0xfe, 0x81, 0x81, 0x81, 0x00,
+  0xb7, 0x2f, 0x48, 0xc4, 0x2f, 0x01, 0x02, 0x0f, 0xff, 0x02, 0x0f, 0x0f,
+  0x01, 0x30, 0xff, 0xfe, 0x0f, 0x0f, 0x0f, 0x00, 0xb7, 0xb1, 0x48, 0xfb,
+  0xc7, 0x7f, 0x85, 0x41, 0x81, 0x02, 0x41, 0x41, 0x7f, 0x35, 0xff, 0xfe,
+  0x41, 0x41, 0x41, 0x00, 0xb7, 0xb1, 0x48, 0x5e, 0x10, 0x7f, 0x3a, 0x41,
+  0x81, 0x02, 0x41, 0x41, 0x7f, 0x38, 0xff, 0xfe, 0x41, 0x41, 0x41, 0x00,
+  0xb7, 0x5b, 0x48, 0x9a, 0x55, 0xd5, 0xed, 0xff, 0x2b, 0x02, 0xff, 0xff,
+  0xd5, 0xfd, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x00, 0xb7, 0x5b, 0x48, 0x06,
+  0xf0, 0xd5, 0xf5, 0x40, 0x2b, 0x02, 0x40, 0x40, 0xd5, 0x75, 0xff, 0xfe,
+  0x40, 0x40, 0x40, 0x00, 0xb7, 0x31, 0x48, 0xc3, 0x1b, 0xff, 0x69, 0x81,
+  0x01, 0x02, 0x81, 0x81, 0xff, 0xf9, 0xff, 0xfe, 0x81, 0x81, 0x81, 0x00,
+  0xb7, 0x31, 0x48, 0x80, 0xd4, 0xff, 0x3a, 0x02, 0x01, 0x02, 0x02, 0x02,
+  0xff, 0x38, 0xff, 0xfe, 0x02, 0x02, 0x02, 0x00, 0xb8, 0x48, 0x48, 0xe5,
+  0xa0, 0x94, 0x40, 0xc0, 0x6c, 0x02, 0xe5, 0xa0, 0x94, 0x30, 0xff, 0xfd,
+  0xc0, 0xc0, 0xe5, 0x00, 0xb8, 0x48, 0x48, 0xa6, 0x30, 0x20, 0xab, 0xc0,
+  0xe0, 0x02, 0xa6, 0x30, 0x20, 0xbb, 0xff, 0xfd, 0xc0, 0xc0, 0xa6, 0x00,
+  0xb8, 0x48, 0x48, 0x77, 0x9e, 0x49, 0x5a, 0xff, 0xb7, 0x02, 0x77, 0x9e,
+  0x49, 0x3a, 0xff, 0xfd, 0xff, 0xff, 0x77, 0x00, 0xb8, 0x48, 0x48, 0x66,
+  0xf5, 0x19, 0x3f, 0x40, 0xe7, 0x02, 0x66, 0xf5, 0x19, 0x3f, 0xff, 0xfd,
+  0x40, 0x40, 0x66, 0x00, 0xb8, 0x48, 0x48, 0xc2, 0xdd, 0xf4, 0x17, 0xaa,
+  0x0c, 0x02, 0xc2, 0xdd, 0xf4, 0x37, 0xff, 0xfd, 0xaa, 0xaa, 0xc2, 0x00,
+  0xb8, 0x48, 0x48, 0x1e, 0x57, 0xe2, 0x71, 0xc0, 0x1e, 0x02, 0x1e, 0x57,
+  0xe2, 0x31, 0xff, 0xfd, 0xc0, 0xc0, 0x1e, 0x00, 0xb9, 0x00, 0x03, 0x2b,
+  0xce, 0x00, 0xe8, 0x7f, 0x00, 0x03, 0x7f, 0xce, 0x00, 0x78, 0xff, 0xff,
+  0x7f, 0x7f, 0x78, 0x00, 0xb9, 0x00, 0x03, 0xb7, 0x1f, 0x00, 0xbb, 0x00,
+  0x00, 0x03, 0x00, 0x1f, 0x00, 0x3b, 0xff, 0xff, 0x00, 0x00, 0x3b, 0x00,
+  0xb9, 0xff, 0x02, 0x6f, 0xc4, 0x01, 0x75, 0x00, 0xff, 0x02, 0x00, 0xc4,
+  0x01, 0x77, 0xff, 0xff, 0x00, 0x00, 0x77, 0x00, 0xb9, 0xff, 0x02, 0xad,
+  0x6d, 0x01, 0x49, 0x95, 0xff, 0x02, 0x95, 0x6d, 0x01, 0xf9, 0xff, 0xff,
+  0x95, 0x95, 0xf9, 0x00, 0xb9, 0x81, 0x02, 0x4d, 0xc6, 0x7f, 0x83, 0x7f,
+  0x81, 0x02, 0x7f, 0xc6, 0x7f, 0x31, 0xff, 0xff, 0x7f, 0x7f, 0x31, 0x00,
+  0xb9, 0x81, 0x02, 0xcf, 0x7f, 0x7f, 0x1e, 0xfe, 0x81, 0x02, 0xfe, 0x7f,
+  0x7f, 0xbc, 0xff, 0xff, 0xfe, 0xfe, 0xbc, 0x00, 0xb9, 0x2b, 0x02, 0x3b,
+  0xe3, 0xd5, 0xbc, 0x0f, 0x2b, 0x02, 0x0f, 0xe3, 0xd5, 0x3c, 0xff, 0xff,
+  0x0f, 0x0f, 0x3c, 0x00, 0xb9, 0x2b, 0x02, 0xd0, 0x89, 0xd5, 0x3e, 0x3f,
+  0x2b, 0x02, 0x3f, 0x89, 0xd5, 0x3c, 0xff, 0xff, 0x3f, 0x3f, 0x3c, 0x00,
+  0xb9, 0x01, 0x02, 0x27, 0x6e, 0xff, 0xa1, 0x01, 0x01, 0x02, 0x01, 0x6e,
+  0xff, 0x31, 0xff, 0xff, 0x01, 0x01, 0x31, 0x00, 0xb9, 0x01, 0x02, 0xed,
+  0xd6, 0xff, 0x2f, 0x7f, 0x01, 0x02, 0x7f, 0xd6, 0xff, 0x3d, 0xff, 0xff,
+  0x7f, 0x7f, 0x3d, 0x00, 0xba, 0x48, 0x48, 0x5e, 0x23, 0x38, 0x83, 0x31,
+  0xc8, 0x02, 0x5e, 0xff, 0x38, 0xb1, 0xff, 0xfd, 0x31, 0x31, 0x5e, 0x00,
+  0xba, 0x48, 0x48, 0xc8, 0x8f, 0xff, 0x00, 0x40, 0x01, 0x02, 0xc8, 0xff,
+  0xff, 0xb0, 0xff, 0xfd, 0x40, 0x40, 0xc8, 0x00, 0xba, 0x48, 0x48, 0x5b,
+  0x0d, 0x07, 0xd8, 0x32, 0xf9, 0x02, 0x5b, 0xff, 0x07, 0xf8, 0xff, 0xfd,
+  0x32, 0x32, 0x5b, 0x00, 0xba, 0x48, 0x48, 0x47, 0xea, 0x9a, 0x67, 0x81,
+  0x66, 0x02, 0x47, 0xff, 0x9a, 0xf5, 0xff, 0xfd, 0x81, 0x81, 0x47, 0x00,
+  0xba, 0x48, 0x48, 0x41, 0x4d, 0x7d, 0x9e, 0x01, 0x83, 0x02, 0x41, 0xff,
+  0x7d, 0xbc, 0xff, 0xfd, 0x01, 0x01, 0x41, 0x00, 0xba, 0x48, 0x48, 0x1f,
+  0xfd, 0x64, 0xfc, 0x3f, 0x9c, 0x02, 0x1f, 0xff, 0x64, 0xfc, 0xff, 0xfd,
+  0x3f, 0x3f, 0x1f, 0x00, 0xbc, 0x00, 0x03, 0x98, 0x00, 0x5b, 0x21, 0x41,
+  0xa5, 0x02, 0x98, 0x00, 0x41, 0x31, 0xff, 0xff, 0x41, 0x41, 0x31, 0x00,
+  0xbc, 0x00, 0x03, 0xe6, 0x00, 0x3c, 0xcc, 0x00, 0xc4, 0x02, 0xe6, 0x00,
+  0x00, 0x7e, 0xff, 0xff, 0x00, 0x00, 0x7e, 0x00, 0xbc, 0xff, 0x02, 0xd3,
+  0x01, 0x2f, 0x5a, 0x7f, 0xd1, 0x02, 0xd3, 0x01, 0x7f, 0x78, 0xff, 0xff,
+  0x7f, 0x7f, 0x78, 0x00, 0xbc, 0xff, 0x02, 0xfc, 0x01, 0x43, 0x9f, 0x80,
+  0xbd, 0x02, 0xfc, 0x01, 0x80, 0xbd, 0xff, 0xff, 0x80, 0x80, 0xbd, 0x00,
+  0xbc, 0x81, 0x02, 0x2e, 0x7f, 0x34, 0x73, 0x02, 0xcc, 0x02, 0x2e, 0x7f,
+  0x02, 0x71, 0xff, 0xff, 0x02, 0x02, 0x71, 0x00, 0xbc, 0x81, 0x02, 0xa4,
+  0x7f, 0xa4, 0x00, 0x7f, 0x5c, 0x02, 0xa4, 0x7f, 0x7f, 0x30, 0xff, 0xff,
+  0x7f, 0x7f, 0x30, 0x00, 0xbc, 0x2b, 0x02, 0xa7, 0xd5, 0x6e, 0x04, 0x01,
+  0x92, 0x02, 0xa7, 0xd5, 0x01, 0x34, 0xff, 0xff, 0x01, 0x01, 0x34, 0x00,
+  0xbc, 0x2b, 0x02, 0x56, 0xd5, 0x88, 0x37, 0xaa, 0x78, 0x02, 0x56, 0xd5,
+  0xaa, 0xb5, 0xff, 0xff, 0xaa, 0xaa, 0xb5, 0x00, 0xbc, 0x01, 0x02, 0xa9,
+  0xff, 0x1b, 0x46, 0x02, 0xe5, 0x02, 0xa9, 0xff, 0x02, 0x74, 0xff, 0xff,
+  0x02, 0x02, 0x74, 0x00, 0xbc, 0x01, 0x02, 0x1a, 0xff, 0x4f, 0x49, 0x80,
+  0xb1, 0x02, 0x1a, 0xff, 0x80, 0xf9, 0xff, 0xff, 0x80, 0x80, 0xf9, 0x00,
+  0xbd, 0x00, 0x03, 0xd1, 0x00, 0x39, 0xf8, 0x80, 0xc7, 0x02, 0x80, 0x00,
+  0x39, 0xf8, 0xff, 0xff, 0x80, 0x80, 0xf8, 0x00, 0xbd, 0x00, 0x03, 0xc7,
+  0x00, 0x33, 0xb8, 0xfe, 0xcd, 0x02, 0xfe, 0x00, 0x33, 0xb8, 0xff, 0xff,
+  0xfe, 0xfe, 0xb8, 0x00, 0xbd, 0xff, 0x02, 0xbd, 0x01, 0x1a, 0x81, 0x41,
+  0xe6, 0x02, 0x41, 0x01, 0x1a, 0x31, 0xff, 0xff, 0x41, 0x41, 0x31, 0x00,
+  0xbd, 0xff, 0x02, 0xba, 0x01, 0x36, 0x26, 0x02, 0xca, 0x02, 0x02, 0x01,
+  0x36, 0x34, 0xff, 0xff, 0x02, 0x02, 0x34, 0x00, 0xbd, 0x81, 0x02, 0x24,
+  0x7f, 0x69, 0x67, 0xfe, 0x97, 0x02, 0xfe, 0x7f, 0x69, 0xf5, 0xff, 0xff,
+  0xfe, 0xfe, 0xf5, 0x00, 0xbd, 0x81, 0x02, 0x01, 0x7f, 0x25, 0xd1, 0x01,
+  0xdb, 0x02, 0x01, 0x7f, 0x25, 0x71, 0xff, 0xff, 0x01, 0x01, 0x71, 0x00,
+  0xbd, 0x2b, 0x02, 0xb3, 0xd5, 0xaa, 0x91, 0x7f, 0x56, 0x02, 0x7f, 0xd5,
+  0xaa, 0x31, 0xff, 0xff, 0x7f, 0x7f, 0x31, 0x00, 0xbd, 0x2b, 0x02, 0xdb,
+  0xd5, 0x65, 0xc7, 0x81, 0x9b, 0x02, 0x81, 0xd5, 0x65, 0xf5, 0xff, 0xff,
+  0x81, 0x81, 0xf5, 0x00, 0xbd, 0x01, 0x02, 0xcd, 0xff, 0x70, 0x79, 0x01,
+  0x90, 0x02, 0x01, 0xff, 0x70, 0x79, 0xff, 0xff, 0x01, 0x01, 0x79, 0x00,
+  0xbd, 0x01, 0x02, 0x9d, 0xff, 0xf3, 0x09, 0x66, 0x0d, 0x02, 0x66, 0xff,
+  0xf3, 0x39, 0xff, 0xff, 0x66, 0x66, 0x39, 0x00, 0xbe, 0x00, 0x03, 0xdd,
+  0x70, 0x00, 0xe8, 0x81, 0x00, 0x03, 0xdd, 0x81, 0x00, 0xf8, 0xff, 0xff,
+  0x81, 0x81, 0xf8, 0x00, 0xbe, 0x00, 0x03, 0x68, 0xd9, 0x00, 0x74, 0xfe,
+  0x00, 0x03, 0x68, 0xfe, 0x00, 0xf4, 0xff, 0xff, 0xfe, 0xfe, 0xf4, 0x00,
+  0xbe, 0xff, 0x02, 0xaf, 0x74, 0x01, 0xca, 0x02, 0xff, 0x02, 0xaf, 0x02,
+  0x01, 0x78, 0xff, 0xff, 0x02, 0x02, 0x78, 0x00, 0xbe, 0xff, 0x02, 0x83,
+  0x2d, 0x01, 0x2d, 0x32, 0xff, 0x02, 0x83, 0x32, 0x01, 0x3d, 0xff, 0xff,
+  0x32, 0x32, 0x3d, 0x00, 0xbe, 0x81, 0x02, 0x3c, 0x5a, 0x7f, 0x92, 0x00,
+  0x81, 0x02, 0x3c, 0x00, 0x7f, 0x32, 0xff, 0xff, 0x00, 0x00, 0x32, 0x00,
+  0xbe, 0x81, 0x02, 0xc8, 0x45, 0x7f, 0xd4, 0xfe, 0x81, 0x02, 0xc8, 0xfe,
+  0x7f, 0xf4, 0xff, 0xff, 0xfe, 0xfe, 0xf4, 0x00, 0xbe, 0x2b, 0x02, 0xc7,
+  0x38, 0xd5, 0xaa, 0xaa, 0x2b, 0x02, 0xc7, 0xaa, 0xd5, 0xb8, 0xff, 0xff,
+  0xaa, 0xaa, 0xb8, 0x00, 0xbe, 0x2b, 0x02, 0x19, 0x11, 0xd5, 0xd6, 0xff,
+  0x2b, 0x02, 0x19, 0xff, 0xd5, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x00,
+  0xbe, 0x01, 0x02, 0x68, 0x6f, 0xff, 0x42, 0x9e, 0x01, 0x02, 0x68, 0x9e,
+  0xff, 0xf0, 0xff, 0xff, 0x9e, 0x9e, 0xf0, 0x00, 0xbe, 0x01, 0x02, 0x75,
+  0x99, 0xff, 0x3d, 0x02, 0x01, 0x02, 0x75, 0x02, 0xff, 0x3d, 0xff, 0xff,
+  0x02, 0x02, 0x3d, 0x00, 0xbf, 0x00, 0x03, 0xf1, 0xd1, 0x00, 0x5a, 0x48,
+  0x00, 0x03, 0x48, 0x48, 0x00, 0x78, 0xff, 0xff, 0x48, 0x48, 0x78, 0x00,
+  0xbf, 0x00, 0x03, 0xc9, 0x73, 0x00, 0xcd, 0x02, 0x00, 0x03, 0x02, 0x02,
+  0x00, 0x7d, 0xff, 0xff, 0x02, 0x02, 0x7d, 0x00, 0xbf, 0xff, 0x02, 0xf4,
+  0xd6, 0x01, 0xcc, 0x00, 0xff, 0x02, 0x00, 0x00, 0x01, 0x7e, 0xff, 0xff,
+  0x00, 0x00, 0x7e, 0x00, 0xbf, 0xff, 0x02, 0xbd, 0x57, 0x01, 0xbf, 0x7f,
+  0xff, 0x02, 0x7f, 0x7f, 0x01, 0x3d, 0xff, 0xff, 0x7f, 0x7f, 0x3d, 0x00,
+  0xbf, 0x81, 0x02, 0xc0, 0x9b, 0x7f, 0x62, 0x01, 0x81, 0x02, 0x01, 0x01,
+  0x7f, 0x70, 0xff, 0xff, 0x01, 0x01, 0x70, 0x00, 0xbf, 0x81, 0x02, 0x7b,
+  0xe2, 0x7f, 0x94, 0x02, 0x81, 0x02, 0x02, 0x02, 0x7f, 0x34, 0xff, 0xff,
+  0x02, 0x02, 0x34, 0x00, 0xbf, 0x2b, 0x02, 0xc0, 0xdb, 0xd5, 0xef, 0x80,
+  0x2b, 0x02, 0x80, 0x80, 0xd5, 0xfd, 0xff, 0xff, 0x80, 0x80, 0xfd, 0x00,
+  0xbf, 0x2b, 0x02, 0xfa, 0x6b, 0xd5, 0xf4, 0xff, 0x2b, 0x02, 0xff, 0xff,
+  0xd5, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x00, 0xbf, 0x01, 0x02, 0x01,
+  0x91, 0xff, 0x5d, 0x0f, 0x01, 0x02, 0x0f, 0x0f, 0xff, 0x7d, 0xff, 0xff,
+  0x0f, 0x0f, 0x7d, 0x00, 0xbf, 0x01, 0x02, 0x68, 0x70, 0xff, 0x81, 0x80,
+  0x01, 0x02, 0x80, 0x80, 0xff, 0xb1, 0xff, 0xff, 0x80, 0x80, 0xb1, 0x00,
+  0xc0, 0x00, 0x48, 0x00, 0xf0, 0x00, 0x30, 0xbc, 0x00, 0x03, 0x00, 0xf0,
+  0x00, 0x33, 0xff, 0xfe, 0xbc, 0xbc, 0x00, 0x00, 0xc0, 0x01, 0x48, 0x00,
+  0xf0, 0x00, 0x37, 0x4c, 0x00, 0x03, 0x00, 0xf0, 0x00, 0xb4, 0xff, 0xfe,
+  0x4c, 0x4c, 0x00, 0x00, 0xc0, 0x0f, 0x48, 0x00, 0x54, 0x00, 0x7b, 0xca,
+  0x00, 0x03, 0x00, 0x54, 0x00, 0xf8, 0xff, 0xfe, 0xca, 0xca, 0x00, 0x00,
+  0xc0, 0x3f, 0x48, 0x00, 0x4d, 0x00, 0xfd, 0x60, 0x00, 0x03, 0x00, 0x4d,
+  0x00, 0xfc, 0xff, 0xfe, 0x60, 0x60, 0x00, 0x00, 0xc0, 0x40, 0x48, 0x00,
+  0xb7, 0x00, 0xfe, 0x03, 0x00, 0x03, 0x00, 0xb7, 0x00, 0xfc, 0xff, 0xfe,
+  0x03, 0x03, 0x00, 0x00, 0xc0, 0x7f, 0x48, 0x00, 0x6f, 0x00, 0xfb, 0x4b,
+  0x00, 0x03, 0x00, 0x6f, 0x00, 0xf8, 0xff, 0xfe, 0x4b, 0x4b, 0x00, 0x00,
+  0xc0, 0x80, 0x48, 0x00, 0xd3, 0x00, 0xb2, 0xf0, 0x00, 0x03, 0x00, 0xd3,
+  0x00, 0xb0, 0xff, 0xfe, 0xf0, 0xf0, 0x00, 0x00, 0xc0, 0x81, 0x48, 0x00,
+  0xc8, 0x00, 0xb9, 0xbe, 0x00, 0x03, 0x00, 0xc8, 0x00, 0x38, 0xff, 0xfe,
+  0xbe, 0xbe, 0x00, 0x00, 0xc0, 0xfe, 0x48, 0x00, 0x98, 0x00, 0x25, 0x47,
+  0x00, 0x03, 0x00, 0x98, 0x00, 0x34, 0xff, 0xfe, 0x47, 0x47, 0x00, 0x00,
+  0xc0, 0xff, 0x48, 0x00, 0x2c, 0x00, 0xa0, 0x27, 0x00, 0x03, 0x00, 0x2c,
+  0x00, 0x30, 0xff, 0xfe, 0x27, 0x27, 0x00, 0x00, 0xc0, 0x00, 0x48, 0x01,
+  0xae, 0x01, 0x59, 0x36, 0x00, 0x03, 0x01, 0xae, 0x01, 0x79, 0xff, 0xfe,
+  0x36, 0x36, 0x01, 0x00, 0xc0, 0x01, 0x48, 0x01, 0xaa, 0x01, 0x3a, 0x65,
+  0x00, 0x03, 0x01, 0xaa, 0x01, 0x3b, 0xff, 0xfe, 0x65, 0x65, 0x01, 0x00,
+  0xc0, 0x0f, 0x48, 0x01, 0xf1, 0x01, 0xe3, 0xbe, 0x00, 0x03, 0x01, 0xf1,
+  0x01, 0xf0, 0xff, 0xfe, 0xbe, 0xbe, 0x01, 0x00, 0xc0, 0x3f, 0x48, 0x01,
+  0x05, 0x01, 0xd6, 0x7d, 0x00, 0x03, 0x01, 0x05, 0x01, 0xf4, 0xff, 0xfe,
+  0x7d, 0x7d, 0x01, 0x00, 0xc0, 0x40, 0x48, 0x01, 0x8c, 0x01, 0xe5, 0xd6,
+  0x00, 0x03, 0x01, 0x8c, 0x01, 0xf4, 0xff, 0xfe, 0xd6, 0xd6, 0x01, 0x00,
+  0xc0, 0x7f, 0x48, 0x01, 0x57, 0x01, 0xf1, 0xd3, 0x00, 0x03, 0x01, 0x57,
+  0x01, 0xf0, 0xff, 0xfe, 0xd3, 0xd3, 0x01, 0x00, 0xc0, 0x80, 0x48, 0x01,
+  0x8e, 0x01, 0xa8, 0x3a, 0x00, 0x03, 0x01, 0x8e, 0x01, 0xb8, 0xff, 0xfe,
+  0x3a, 0x3a, 0x01, 0x00, 0xc0, 0x81, 0x48, 0x01, 0xe4, 0x01, 0x36, 0xdd,
+  0x00, 0x03, 0x01, 0xe4, 0x01, 0xb4, 0xff, 0xfe, 0xdd, 0xdd, 0x01, 0x00,
+  0xc0, 0xfe, 0x48, 0x01, 0x3a, 0x01, 0x5e, 0xa5, 0x00, 0x03, 0x01, 0x3a,
+  0x01, 0x7c, 0xff, 0xfe, 0xa5, 0xa5, 0x01, 0x00, 0xc0, 0xff, 0x48, 0x01,
+  0x14, 0x01, 0x2b, 0x42, 0x00, 0x03, 0x01, 0x14, 0x01, 0x38, 0xff, 0xfe,
+  0x42, 0x42, 0x01, 0x00, 0xc0, 0x00, 0x48, 0x0f, 0x76, 0x0f, 0x25, 0x33,
+  0x00, 0x03, 0x0f, 0x76, 0x0f, 0x35, 0xff, 0xfe, 0x33, 0x33, 0x0f, 0x00,
+  0xc0, 0x01, 0x48, 0x0f, 0xf8, 0x0f, 0xde, 0xcf, 0x00, 0x03, 0x0f, 0xf8,
+  0x0f, 0x7d, 0xff, 0xfe, 0xcf, 0xcf, 0x0f, 0x00, 0xc0, 0x0f, 0x48, 0x0f,
+  0xee, 0x0f, 0x48, 0xcc, 0x00, 0x03, 0x0f, 0xee, 0x0f, 0x7b, 0xff, 0xfe,
+  0xcc, 0xcc, 0x0f, 0x00, 0xc0, 0x3f, 0x48, 0x0f, 0x6c, 0x0f, 0xcd, 0x2b,
+  0x00, 0x03, 0x0f, 0x6c, 0x0f, 0xfc, 0xff, 0xfe, 0x2b, 0x2b, 0x0f, 0x00,
+  0xc0, 0x40, 0x48, 0x0f, 0x7b, 0x0f, 0x7e, 0x8f, 0x00, 0x03, 0x0f, 0x7b,
+  0x0f, 0xfc, 0xff, 0xfe, 0x8f, 0x8f, 0x0f, 0x00, 0xc0, 0x7f, 0x48, 0x0f,
+  0x67, 0x0f, 0xe8, 0x26, 0x00, 0x03, 0x0f, 0x67, 0x0f, 0xf8, 0xff, 0xfe,
+  0x26, 0x26, 0x0f, 0x00, 0xc0, 0x80, 0x48, 0x0f, 0x71, 0x0f, 0xfe, 0xd3,
+  0x00, 0x03, 0x0f, 0x71, 0x0f, 0xfc, 0xff, 0xfe, 0xd3, 0xd3, 0x0f, 0x00,
+  0xc0, 0x81, 0x48, 0x0f, 0x52, 0x0f, 0xe0, 0x7b, 0x00, 0x03, 0x0f, 0x52,
+  0x0f, 0xf0, 0xff, 0xfe, 0x7b, 0x7b, 0x0f, 0x00, 0xc0, 0xfe, 0x48, 0x0f,
+  0x7c, 0x0f, 0x2a, 0x1d, 0x00, 0x03, 0x0f, 0x7c, 0x0f, 0x38, 0xff, 0xfe,
+  0x1d, 0x1d, 0x0f, 0x00, 0xc0, 0xff, 0x48, 0x0f, 0xd5, 0x0f, 0xcf, 0x00,
+  0x00, 0x03, 0x0f, 0xd5, 0x0f, 0x7c, 0xff, 0xfe, 0x00, 0x00, 0x0f, 0x00,
+  0xc0, 0x00, 0x48, 0x3f, 0xa1, 0x3f, 0x99, 0xaa, 0x00, 0x03, 0x3f, 0xa1,
+  0x3f, 0x39, 0xff, 0xfe, 0xaa, 0xaa, 0x3f, 0x00, 0xc0, 0x01, 0x48, 0x3f,
+  0x9f, 0x3f, 0x37, 0x05, 0x00, 0x03, 0x3f, 0x9f, 0x3f, 0x35, 0xff, 0xfe,
+  0x05, 0x05, 0x3f, 0x00, 0xc0, 0x0f, 0x48, 0x3f, 0x03, 0x3f, 0x17, 0x49,
+  0x00, 0x03, 0x3f, 0x03, 0x3f, 0x35, 0xff, 0xfe, 0x49, 0x49, 0x3f, 0x00,
+  0xc0, 0x3f, 0x48, 0x3f, 0x50, 0x3f, 0x15, 0xf6, 0x00, 0x03, 0x3f, 0x50,
+  0x3f, 0x37, 0xff, 0xfe, 0xf6, 0xf6, 0x3f, 0x00, 0xc0, 0x40, 0x48, 0x3f,
+  0x14, 0x3f, 0xa4, 0xac, 0x00, 0x03, 0x3f, 0x14, 0x3f, 0xb4, 0xff, 0xfe,
+  0xac, 0xac, 0x3f, 0x00, 0xc0, 0x7f, 0x48, 0x3f, 0xe7, 0x3f, 0x65, 0xdb,
+  0x00, 0x03, 0x3f, 0xe7, 0x3f, 0xf4, 0xff, 0xfe, 0xdb, 0xdb, 0x3f, 0x00,
+  0xc0, 0x80, 0x48, 0x3f, 0xc1, 0x3f, 0x2d, 0x34, 0x00, 0x03, 0x3f, 0xc1,
+  0x3f, 0xbc, 0xff, 0xfe, 0x34, 0x34, 0x3f, 0x00, 0xc0, 0x81, 0x48, 0x3f,
+  0xb8, 0x3f, 0x87, 0xea, 0x00, 0x03, 0x3f, 0xb8, 0x3f, 0xb4, 0xff, 0xfe,
+  0xea, 0xea, 0x3f, 0x00, 0xc0, 0xfe, 0x48, 0x3f, 0xfc, 0x3f, 0x53, 0x1b,
+  0x00, 0x03, 0x3f, 0xfc, 0x3f, 0x70, 0xff, 0xfe, 0x1b, 0x1b, 0x3f, 0x00,
+  0xc0, 0xff, 0x48, 0x3f, 0xb4, 0x3f, 0x49, 0xca, 0x00, 0x03, 0x3f, 0xb4,
+  0x3f, 0x78, 0xff, 0xfe, 0xca, 0xca, 0x3f, 0x00, 0xc0, 0x00, 0x48, 0x40,
+  0x75, 0x40, 0x30, 0x0b, 0x00, 0x03, 0x40, 0x75, 0x40, 0x31, 0xff, 0xfe,
+  0x0b, 0x0b, 0x40, 0x00, 0xc0, 0x01, 0x48, 0x40, 0x02, 0x40, 0x29, 0xd0,
+  0x00, 0x03, 0x40, 0x02, 0x40, 0x39, 0xff, 0xfe, 0xd0, 0xd0, 0x40, 0x00,
+  0xc0, 0x0f, 0x48, 0x40, 0x4e, 0x40, 0x8a, 0xd6, 0x00, 0x03, 0x40, 0x4e,
+  0x40, 0x39, 0xff, 0xfe, 0xd6, 0xd6, 0x40, 0x00, 0xc0, 0x3f, 0x48, 0x40,
+  0xf5, 0x40, 0x17, 0x2d, 0x00, 0x03, 0x40, 0xf5, 0x40, 0x35, 0xff, 0xfe,
+  0x2d, 0x2d, 0x40, 0x00, 0xc0, 0x40, 0x48, 0x40, 0x6f, 0x40, 0xbb, 0x66,
+  0x00, 0x03, 0x40, 0x6f, 0x40, 0x3b, 0xff, 0xfe, 0x66, 0x66, 0x40, 0x00,
+  0xc0, 0x7f, 0x48, 0x40, 0x37, 0x40, 0x60, 0x48, 0x00, 0x03, 0x40, 0x37,
+  0x40, 0xf0, 0xff, 0xfe, 0x48, 0x48, 0x40, 0x00, 0xc0, 0x80, 0x48, 0x40,
+  0xa3, 0x40, 0x3d, 0xce, 0x00, 0x03, 0x40, 0xa3, 0x40, 0xbc, 0xff, 0xfe,
+  0xce, 0xce, 0x40, 0x00, 0xc0, 0x81, 0x48, 0x40, 0x99, 0x40, 0x75, 0xef,
+  0x00, 0x03, 0x40, 0x99, 0x40, 0xf4, 0xff, 0xfe, 0xef, 0xef, 0x40, 0x00,
+  0xc0, 0xfe, 0x48, 0x40, 0xb9, 0x40, 0xe0, 0x45, 0x00, 0x03, 0x40, 0xb9,
+  0x40, 0x70, 0xff, 0xfe, 0x45, 0x45, 0x40, 0x00, 0xc0, 0xff, 0x48, 0x40,
+  0xff, 0x40, 0xda, 0x52, 0x00, 0x03, 0x40, 0xff, 0x40, 0x78, 0xff, 0xfe,
+  0x52, 0x52, 0x40, 0x00, 0xc0, 0x00, 0x48, 0x7f, 0x03, 0x7f, 0x82, 0xf5,
+  0x00, 0x03, 0x7f, 0x03, 0x7f, 0x31, 0xff, 0xfe, 0xf5, 0xf5, 0x7f, 0x00,
+  0xc0, 0x01, 0x48, 0x7f, 0x03, 0x7f, 0xa3, 0x2a, 0x00, 0x03, 0x7f, 0x03,
+  0x7f, 0x31, 0xff, 0xfe, 0x2a, 0x2a, 0x7f, 0x00, 0xc0, 0x0f, 0x48, 0x7f,
+  0x61, 0x7f, 0x7f, 0xc4, 0x00, 0x03, 0x7f, 0x61, 0x7f, 0x7d, 0xff, 0xfe,
+  0xc4, 0xc4, 0x7f, 0x00, 0xc0, 0x3f, 0x48, 0x7f, 0xa6, 0x7f, 0x9f, 0x61,
+  0x00, 0x03, 0x7f, 0xa6, 0x7f, 0x3d, 0xff, 0xfe, 0x61, 0x61, 0x7f, 0x00,
+  0xc0, 0x40, 0x48, 0x7f, 0x0d, 0x7f, 0xb7, 0x5a, 0x00, 0x03, 0x7f, 0x0d,
+  0x7f, 0x35, 0xff, 0xfe, 0x5a, 0x5a, 0x7f, 0x00, 0xc0, 0x7f, 0x48, 0x7f,
+  0x24, 0x7f, 0x30, 0xc5, 0x00, 0x03, 0x7f, 0x24, 0x7f, 0x33, 0xff, 0xfe,
+  0xc5, 0xc5, 0x7f, 0x00, 0xc0, 0x80, 0x48, 0x7f, 0x6a, 0x7f, 0xd7, 0x31,
+  0x00, 0x03, 0x7f, 0x6a, 0x7f, 0xf4, 0xff, 0xfe, 0x31, 0x31, 0x7f, 0x00,
+  0xc0, 0x81, 0x48, 0x7f, 0xcf, 0x7f, 0xb5, 0xa3, 0x00, 0x03, 0x7f, 0xcf,
+  0x7f, 0xb4, 0xff, 0xfe, 0xa3, 0xa3, 0x7f, 0x00, 0xc0, 0xfe, 0x48, 0x7f,
+  0x8c, 0x7f, 0x79, 0x5f, 0x00, 0x03, 0x7f, 0x8c, 0x7f, 0xf8, 0xff, 0xfe,
+  0x5f, 0x5f, 0x7f, 0x00, 0xc0, 0xff, 0x48, 0x7f, 0x2e, 0x7f, 0x6d, 0x7b,
+  0x00, 0x03, 0x7f, 0x2e, 0x7f, 0xfc, 0xff, 0xfe, 0x7b, 0x7b, 0x7f, 0x00,
+  0xc0, 0x00, 0x48, 0x80, 0x92, 0x80, 0x5c, 0x85, 0x00, 0x03, 0x80, 0x92,
+  0x80, 0xfd, 0xff, 0xfe, 0x85, 0x85, 0x80, 0x00, 0xc0, 0x01, 0x48, 0x80,
+  0xdc, 0x80, 0x90, 0xa6, 0x00, 0x03, 0x80, 0xdc, 0x80, 0x31, 0xff, 0xfe,
+  0xa6, 0xa6, 0x80, 0x00, 0xc0, 0x0f, 0x48, 0x80, 0x32, 0x80, 0xb3, 0xb3,
+  0x00, 0x03, 0x80, 0x32, 0x80, 0x31, 0xff, 0xfe, 0xb3, 0xb3, 0x80, 0x00,
+  0xc0, 0x3f, 0x48, 0x80, 0x0f, 0x80, 0x9f, 0x93, 0x00, 0x03, 0x80, 0x0f,
+  0x80, 0x3d, 0xff, 0xfe, 0x93, 0x93, 0x80, 0x00, 0xc0, 0x40, 0x48, 0x80,
+  0x74, 0x80, 0x2d, 0x3b, 0x00, 0x03, 0x80, 0x74, 0x80, 0x3d, 0xff, 0xfe,
+  0x3b, 0x3b, 0x80, 0x00, 0xc0, 0x7f, 0x48, 0x80, 0xc6, 0x80, 0xf1, 0xc7,
+  0x00, 0x03, 0x80, 0xc6, 0x80, 0x71, 0xff, 0xfe, 0xc7, 0xc7, 0x80, 0x00,
+  0xc0, 0x80, 0x48, 0x80, 0x90, 0x80, 0xfc, 0x7f, 0x00, 0x03, 0x80, 0x90,
+  0x80, 0x7f, 0xff, 0xfe, 0x7f, 0x7f, 0x80, 0x00, 0xc0, 0x81, 0x48, 0x80,
+  0x02, 0x80, 0xe3, 0x71, 0x00, 0x03, 0x80, 0x02, 0x80, 0xf0, 0xff, 0xfe,
+  0x71, 0x71, 0x80, 0x00, 0xc0, 0xfe, 0x48, 0x80, 0x0a, 0x80, 0xf5, 0x67,
+  0x00, 0x03, 0x80, 0x0a, 0x80, 0xf4, 0xff, 0xfe, 0x67, 0x67, 0x80, 0x00,
+  0xc0, 0xff, 0x48, 0x80, 0x22, 0x80, 0x55, 0xa1, 0x00, 0x03, 0x80, 0x22,
+  0x80, 0xf4, 0xff, 0xfe, 0xa1, 0xa1, 0x80, 0x00, 0xc0, 0x00, 0x48, 0x81,
+  0xa9, 0x81, 0xcf, 0xc8, 0x00, 0x03, 0x81, 0xa9, 0x81, 0xfd, 0xff, 0xfe,
+  0xc8, 0xc8, 0x81, 0x00, 0xc0, 0x01, 0x48, 0x81, 0x37, 0x81, 0xad, 0xd0,
+  0x00, 0x03, 0x81, 0x37, 0x81, 0xbd, 0xff, 0xfe, 0xd0, 0xd0, 0x81, 0x00,
+  0xc0, 0x0f, 0x48, 0x81, 0x2e, 0x81, 0x84, 0xbb, 0x00, 0x03, 0x81, 0x2e,
+  0x81, 0x35, 0xff, 0xfe, 0xbb, 0xbb, 0x81, 0x00, 0xc0, 0x3f, 0x48, 0x81,
+  0x93, 0x81, 0x93, 0x71, 0x00, 0x03, 0x81, 0x93, 0x81, 0x31, 0xff, 0xfe,
+  0x71, 0x71, 0x81, 0x00, 0xc0, 0x40, 0x48, 0x81, 0x75, 0x81, 0x57, 0x76,
+  0x00, 0x03, 0x81, 0x75, 0x81, 0x75, 0xff, 0xfe, 0x76, 0x76, 0x81, 0x00,
+  0xc0, 0x7f, 0x48, 0x81, 0xa6, 0x81, 0x3c, 0x48, 0x00, 0x03, 0x81, 0xa6,
+  0x81, 0x3d, 0xff, 0xfe, 0x48, 0x48, 0x81, 0x00, 0xc0, 0x80, 0x48, 0x81,
+  0x34, 0x81, 0x7f, 0x84, 0x00, 0x03, 0x81, 0x34, 0x81, 0x7d, 0xff, 0xfe,
+  0x84, 0x84, 0x81, 0x00, 0xc0, 0x81, 0x48, 0x81, 0xf4, 0x81, 0xbd, 0xe1,
+  0x00, 0x03, 0x81, 0xf4, 0x81, 0x3f, 0xff, 0xfe, 0xe1, 0xe1, 0x81, 0x00,
+  0xc0, 0xfe, 0x48, 0x81, 0x1e, 0x81, 0x0c, 0x9a, 0x00, 0x03, 0x81, 0x1e,
+  0x81, 0xbc, 0xff, 0xfe, 0x9a, 0x9a, 0x81, 0x00, 0xc0, 0xff, 0x48, 0x81,
+  0x25, 0x81, 0x34, 0xfb, 0x00, 0x03, 0x81, 0x25, 0x81, 0xb4, 0xff, 0xfe,
+  0xfb, 0xfb, 0x81, 0x00, 0xc0, 0x00, 0x48, 0xfe, 0xe9, 0xfe, 0x9e, 0xc7,
+  0x00, 0x03, 0xfe, 0xe9, 0xfe, 0xbd, 0xff, 0xfe, 0xc7, 0xc7, 0xfe, 0x00,
+  0xc0, 0x01, 0x48, 0xfe, 0x50, 0xfe, 0x0b, 0x38, 0x00, 0x03, 0xfe, 0x50,
+  0xfe, 0xb9, 0xff, 0xfe, 0x38, 0x38, 0xfe, 0x00, 0xc0, 0x0f, 0x48, 0xfe,
+  0xb5, 0xfe, 0x4c, 0x15, 0x00, 0x03, 0xfe, 0xb5, 0xfe, 0xfd, 0xff, 0xfe,
+  0x15, 0x15, 0xfe, 0x00, 0xc0, 0x3f, 0x48, 0xfe, 0xb9, 0xfe, 0xfd, 0x07,
+  0x00, 0x03, 0xfe, 0xb9, 0xfe, 0xfd, 0xff, 0xfe, 0x07, 0x07, 0xfe, 0x00,
+  0xc0, 0x40, 0x48, 0xfe, 0x31, 0xfe, 0x13, 0x39, 0x00, 0x03, 0xfe, 0x31,
+  0xfe, 0xb1, 0xff, 0xfe, 0x39, 0x39, 0xfe, 0x00, 0xc0, 0x7f, 0x48, 0xfe,
+  0xe2, 0xfe, 0x29, 0xd3, 0x00, 0x03, 0xfe, 0xe2, 0xfe, 0x39, 0xff, 0xfe,
+  0xd3, 0xd3, 0xfe, 0x00, 0xc0, 0x80, 0x48, 0xfe, 0x3f, 0xfe, 0x89, 0xb2,
+  0x00, 0x03, 0xfe, 0x3f, 0xfe, 0x39, 0xff, 0xfe, 0xb2, 0xb2, 0xfe, 0x00,
+  0xc0, 0x81, 0x48, 0xfe, 0x41, 0xfe, 0xd9, 0xbc, 0x00, 0x03, 0xfe, 0x41,
+  0xfe, 0x79, 0xff, 0xfe, 0xbc, 0xbc, 0xfe, 0x00, 0xc0, 0xfe, 0x48, 0xfe,
+  0x16, 0xfe, 0x8d, 0x4a, 0x00, 0x03, 0xfe, 0x16, 0xfe, 0x3f, 0xff, 0xfe,
+  0x4a, 0x4a, 0xfe, 0x00, 0xc0, 0xff, 0x48, 0xfe, 0x0d, 0xfe, 0x73, 0xe9,
+  0x00, 0x03, 0xfe, 0x0d, 0xfe, 0xf0, 0xff, 0xfe, 0xe9, 0xe9, 0xfe, 0x00,
+  0xc0, 0x00, 0x48, 0xff, 0x24, 0xff, 0x88, 0xa1, 0x00, 0x03, 0xff, 0x24,
+  0xff, 0xb9, 0xff, 0xfe, 0xa1, 0xa1, 0xff, 0x00, 0xc0, 0x01, 0x48, 0xff,
+  0xe6, 0xff, 0x26, 0xb8, 0x00, 0x03, 0xff, 0xe6, 0xff, 0xb5, 0xff, 0xfe,
+  0xb8, 0xb8, 0xff, 0x00, 0xc0, 0x0f, 0x48, 0xff, 0x9b, 0xff, 0x48, 0xb6,
+  0x00, 0x03, 0xff, 0x9b, 0xff, 0xf9, 0xff, 0xfe, 0xb6, 0xb6, 0xff, 0x00,
+  0xc0, 0x3f, 0x48, 0xff, 0x29, 0xff, 0x3e, 0xce, 0x00, 0x03, 0xff, 0x29,
+  0xff, 0xbd, 0xff, 0xfe, 0xce, 0xce, 0xff, 0x00, 0xc0, 0x40, 0x48, 0xff,
+  0x02, 0xff, 0x47, 0xd8, 0x00, 0x03, 0xff, 0x02, 0xff, 0xf5, 0xff, 0xfe,
+  0xd8, 0xd8, 0xff, 0x00, 0xc0, 0x7f, 0x48, 0xff, 0x6f, 0xff, 0x1d, 0x44,
+  0x00, 0x03, 0xff, 0x6f, 0xff, 0xbd, 0xff, 0xfe, 0x44, 0x44, 0xff, 0x00,
+  0xc0, 0x80, 0x48, 0xff, 0x29, 0xff, 0x48, 0xb8, 0x00, 0x03, 0xff, 0x29,
+  0xff, 0x79, 0xff, 0xfe, 0xb8, 0xb8, 0xff, 0x00, 0xc0, 0x81, 0x48, 0xff,
+  0x4d, 0xff, 0xeb, 0xbe, 0x00, 0x03, 0xff, 0x4d, 0xff, 0x79, 0xff, 0xfe,
+  0xbe, 0xbe, 0xff, 0x00, 0xc0, 0xfe, 0x48, 0xff, 0xe9, 0xff, 0x60, 0xef,
+  0x00, 0x03, 0xff, 0xe9, 0xff, 0x71, 0xff, 0xfe, 0xef, 0xef, 0xff, 0x00,
+  0xc0, 0xff, 0x48, 0xff, 0xab, 0xff, 0x86, 0x5e, 0x00, 0x03, 0xff, 0xab,
+  0xff, 0x37, 0xff, 0xfe, 0x5e, 0x5e, 0xff, 0x00, 0xc1, 0x40, 0x48, 0x2b,
+  0x00, 0x55, 0xbc, 0x7f, 0xab, 0x02, 0x2b, 0x00, 0x55, 0xbc, 0xff, 0xfe,
+  0x7f, 0x7f, 0x2b, 0x00, 0xc1, 0x40, 0x48, 0xba, 0x00, 0x70, 0xc9, 0x02,
+  0x90, 0x02, 0xba, 0x00, 0x70, 0xf9, 0xff, 0xfe, 0x02, 0x02, 0xba, 0x00,
+  0xc1, 0x3f, 0x48, 0xa4, 0x01, 0x2f, 0x52, 0x41, 0xd1, 0x02, 0xa4, 0x01,
+  0x2f, 0x71, 0xff, 0xfe, 0x41, 0x41, 0xa4, 0x00, 0xc1, 0x3f, 0x48, 0xfe,
+  0x01, 0xa6, 0x99, 0xff, 0x5a, 0x02, 0xfe, 0x01, 0xa6, 0xb8, 0xff, 0xfe,
+  0xff, 0xff, 0xfe, 0x00, 0xc1, 0xc1, 0x48, 0xcd, 0x7f, 0x53, 0x5e, 0x41,
+  0xad, 0x02, 0xcd, 0x7f, 0x53, 0xfd, 0xff, 0xfe, 0x41, 0x41, 0xcd, 0x00,
+  0xc1, 0xc1, 0x48, 0x34, 0x7f, 0x0c, 0x2d, 0xfe, 0xf4, 0x02, 0x34, 0x7f,
+  0x0c, 0x3c, 0xff, 0xfe, 0xfe, 0xfe, 0x34, 0x00, 0xc1, 0x6b, 0x48, 0x2f,
+  0xd5, 0xfd, 0x99, 0x60, 0x03, 0x02, 0x2f, 0xd5, 0xfd, 0xb8, 0xff, 0xfe,
+  0x60, 0x60, 0x2f, 0x00, 0xc1, 0x6b, 0x48, 0x62, 0xd5, 0x0e, 0xac, 0x3f,
+  0xf2, 0x02, 0x62, 0xd5, 0x0e, 0x3d, 0xff, 0xfe, 0x3f, 0x3f, 0x62, 0x00,
+  0xc1, 0x41, 0x48, 0x9c, 0xff, 0xad, 0x39, 0x7f, 0x53, 0x02, 0x9c, 0xff,
+  0xad, 0x39, 0xff, 0xfe, 0x7f, 0x7f, 0x9c, 0x00, 0xc1, 0x41, 0x48, 0xba,
+  0xff, 0x9d, 0x60, 0x80, 0x63, 0x02, 0xba, 0xff, 0x9d, 0x71, 0xff, 0xfe,
+  0x80, 0x80, 0xba, 0x00, 0xc2, 0x7f, 0x48, 0xd5, 0x67, 0x2d, 0xb8, 0x7f,
+  0xd3, 0x02, 0xd5, 0x67, 0x2d, 0xb8, 0xff, 0xfe, 0x7f, 0x7f, 0xd5, 0x00,
+  0xc2, 0x81, 0x48, 0x57, 0x32, 0x42, 0xcc, 0x81, 0xbe, 0x02, 0x57, 0x32,
+  0x42, 0xfc, 0xff, 0xfe, 0x81, 0x81, 0x57, 0x00, 0xc2, 0x00, 0x48, 0xf8,
+  0x74, 0xcf, 0x33, 0x00, 0x31, 0x02, 0xf8, 0x74, 0xcf, 0x33, 0xff, 0xfe,
+  0x00, 0x00, 0xf8, 0x00, 0xc2, 0x75, 0x48, 0x45, 0xce, 0x6b, 0x58, 0x75,
+  0x95, 0x02, 0x45, 0xce, 0x6b, 0x78, 0xff, 0xfe, 0x75, 0x75, 0x45, 0x00,
+  0xc3, 0x40, 0x48, 0x5b, 0x00, 0x1c, 0x0c, 0x01, 0xe4, 0x02, 0x5b, 0x00,
+  0x1c, 0x3d, 0xff, 0xfe, 0x01, 0x00, 0x5b, 0x00, 0xc3, 0x40, 0x48, 0x22,
+  0x00, 0x2f, 0x99, 0x00, 0xd1, 0x02, 0x22, 0x00, 0x2f, 0x38, 0xff, 0xfe,
+  0x00, 0xff, 0x22, 0x00, 0xc3, 0x3f, 0x48, 0x42, 0x01, 0x1c, 0x86, 0xfe,
+  0xe4, 0x02, 0x42, 0x01, 0x1c, 0x34, 0xff, 0xfe, 0xfe, 0xfd, 0x42, 0x00,
+  0xc3, 0x3f, 0x48, 0x3d, 0x01, 0x8c, 0xd0, 0xaa, 0x74, 0x02, 0x3d, 0x01,
+  0x8c, 0xf0, 0xff, 0xfe, 0xaa, 0xa9, 0x3d, 0x00, 0xc3, 0xc1, 0x48, 0x5f,
+  0x7f, 0xa1, 0x0f, 0x65, 0x5f, 0x02, 0x5f, 0x7f, 0xa1, 0xbc, 0xff, 0xfe,
+  0x65, 0x64, 0x5f, 0x00, 0xc3, 0xc1, 0x48, 0x31, 0x7f, 0x0b, 0x67, 0x01,
+  0xf5, 0x02, 0x31, 0x7f, 0x0b, 0x75, 0xff, 0xfe, 0x01, 0x00, 0x31, 0x00,
+  0xc3, 0x6b, 0x48, 0xc4, 0xd5, 0x84, 0xa5, 0x01, 0x7c, 0x02, 0xc4, 0xd5,
+  0x84, 0xb5, 0xff, 0xfe, 0x01, 0x00, 0xc4, 0x00, 0xc3, 0x6b, 0x48, 0x74,
+  0xd5, 0xbe, 0x76, 0xff, 0x42, 0x02, 0x74, 0xd5, 0xbe, 0x74, 0xff, 0xfe,
+  0xff, 0xfe, 0x74, 0x00, 0xc3, 0x41, 0x48, 0x6b, 0xff, 0xf5, 0xb1, 0x0f,
+  0x0b, 0x02, 0x6b, 0xff, 0xf5, 0x31, 0xff, 0xfe, 0x0f, 0x0e, 0x6b, 0x00,
+  0xc3, 0x41, 0x48, 0xd2, 0xff, 0x87, 0x0b, 0x02, 0x79, 0x02, 0xd2, 0xff,
+  0x87, 0xb9, 0xff, 0xfe, 0x02, 0x01, 0xd2, 0x00, 0xc4, 0x30, 0x48, 0xc7,
+  0x7b, 0xe0, 0x4f, 0x02, 0x20, 0x02, 0xc7, 0x7b, 0xe0, 0xfd, 0xff, 0xfe,
+  0x02, 0x02, 0xc7, 0x00, 0xc4, 0x30, 0x48, 0x47, 0x92, 0x36, 0xcc, 0x40,
+  0xca, 0x02, 0x47, 0x92, 0x36, 0xfc, 0xff, 0xfe, 0x40, 0x40, 0x47, 0x00,
+  0xc4, 0x30, 0x48, 0xea, 0x8b, 0xec, 0x3f, 0x41, 0x14, 0x02, 0xea, 0x8b,
+  0xec, 0xbd, 0xff, 0xfe, 0x41, 0x41, 0xea, 0x00, 0xc4, 0x30, 0x48, 0x29,
+  0xe1, 0xe2, 0xff, 0x41, 0x1e, 0x02, 0x29, 0xe1, 0xe2, 0xfd, 0xff, 0xfe,
+  0x41, 0x41, 0x29, 0x00, 0xc4, 0x30, 0x48, 0x93, 0xc3, 0x26, 0xfd, 0x00,
+  0xda, 0x02, 0x93, 0xc3, 0x26, 0x7d, 0xff, 0xfe, 0x00, 0x00, 0x93, 0x00,
+  0xc4, 0x30, 0x48, 0xdb, 0x02, 0x26, 0x3a, 0x40, 0xda, 0x02, 0xdb, 0x02,
+  0x26, 0xb8, 0xff, 0xfe, 0x40, 0x40, 0xdb, 0x00, 0xc5, 0x30, 0x48, 0x0a,
+  0x8a, 0x68, 0xb2, 0x80, 0x98, 0x02, 0x0a, 0x8a, 0x68, 0xb0, 0xff, 0xfe,
+  0x80, 0x80, 0x0a, 0x00, 0xc5, 0x30, 0x48, 0x89, 0x9a, 0x5a, 0xd4, 0x7f,
+  0xa6, 0x02, 0x89, 0x9a, 0x5a, 0x75, 0xff, 0xfe, 0x7f, 0x7f, 0x89, 0x00,
+  0xc5, 0x30, 0x48, 0xd0, 0xc1, 0x16, 0x9d, 0x00, 0xea, 0x02, 0xd0, 0xc1,
+  0x16, 0xbd, 0xff, 0xfe, 0x00, 0x00, 0xd0, 0x00, 0xc5, 0x30, 0x48, 0x09,
+  0x1b, 0x4a, 0x69, 0x80, 0xb6, 0x02, 0x09, 0x1b, 0x4a, 0xf8, 0xff, 0xfe,
+  0x80, 0x80, 0x09, 0x00, 0xc5, 0x30, 0x48, 0x4d, 0xe6, 0x3a, 0x05, 0x3f,
+  0xc6, 0x02, 0x4d, 0xe6, 0x3a, 0x35, 0xff, 0xfe, 0x3f, 0x3f, 0x4d, 0x00,
+  0xc5, 0x30, 0x48, 0xdc, 0xda, 0x66, 0x41, 0xff, 0x9a, 0x02, 0xdc, 0xda,
+  0x66, 0xf0, 0xff, 0xfe, 0xff, 0xff, 0xdc, 0x00, 0xc6, 0x30, 0x48, 0x52,
+  0x8c, 0x26, 0xad, 0x02, 0xda, 0x02, 0x52, 0x8c, 0x26, 0x3d, 0xff, 0xfe,
+  0x01, 0x02, 0x52, 0x00, 0xc6, 0x30, 0x48, 0xa6, 0x74, 0x78, 0xda, 0xc0,
+  0x88, 0x02, 0xa6, 0x74, 0x78, 0xf8, 0xff, 0xfe, 0xbf, 0xc0, 0xa6, 0x00,
+  0xc6, 0x30, 0x48, 0x27, 0x2a, 0x23, 0xea, 0x80, 0xdd, 0x02, 0x27, 0x2a,
+  0x23, 0x78, 0xff, 0xfe, 0x7f, 0x80, 0x27, 0x00, 0xc6, 0x30, 0x48, 0x43,
+  0x4b, 0xe2, 0x3d, 0xff, 0x1e, 0x02, 0x43, 0x4b, 0xe2, 0xbd, 0xff, 0xfe,
+  0xfe, 0xff, 0x43, 0x00, 0xc6, 0x30, 0x48, 0x24, 0x8c, 0x54, 0x27, 0xf4,
+  0xac, 0x02, 0x24, 0x8c, 0x54, 0xb5, 0xff, 0xfe, 0xf3, 0xf4, 0x24, 0x00,
+  0xc6, 0x30, 0x48, 0x22, 0x7c, 0xce, 0x8f, 0x00, 0x32, 0x02, 0x22, 0x7c,
+  0xce, 0xbd, 0xff, 0xfe, 0xff, 0x00, 0x22, 0x00, 0xc7, 0x30, 0x48, 0x95,
+  0x37, 0xc3, 0xfe, 0x41, 0x3d, 0x02, 0x95, 0x37, 0xc3, 0x7d, 0xff, 0xfe,
+  0x40, 0x41, 0x95, 0x00, 0xc7, 0x30, 0x48, 0x3e, 0xc6, 0x18, 0x50, 0xaa,
+  0xe8, 0x02, 0x3e, 0xc6, 0x18, 0xf0, 0xff, 0xfe, 0xa9, 0xaa, 0x3e, 0x00,
+  0xc7, 0x30, 0x48, 0x36, 0x81, 0xc9, 0xf9, 0x41, 0x37, 0x02, 0x36, 0x81,
+  0xc9, 0xf8, 0xff, 0xfe, 0x40, 0x41, 0x36, 0x00, 0xc7, 0x30, 0x48, 0x6b,
+  0x65, 0x5b, 0x2f, 0xaa, 0xa5, 0x02, 0x6b, 0x65, 0x5b, 0xbc, 0xff, 0xfe,
+  0xa9, 0xaa, 0x6b, 0x00, 0xc7, 0x30, 0x48, 0x11, 0xb2, 0x39, 0x31, 0xbb,
+  0xc7, 0x02, 0x11, 0xb2, 0x39, 0x30, 0xff, 0xfe, 0xba, 0xbb, 0x11, 0x00,
+  0xc7, 0x30, 0x48, 0x51, 0x51, 0x31, 0x41, 0x55, 0xcf, 0x02, 0x51, 0x51,
+  0x31, 0xf0, 0xff, 0xfe, 0x54, 0x55, 0x51, 0x00, 0xc8, 0x48, 0x48, 0xa2,
+  0xb2, 0x75, 0x31, 0x41, 0x8b, 0x02, 0xa2, 0xb2, 0x76, 0x31, 0xff, 0xfd,
+  0x41, 0x41, 0xa2, 0x00, 0xc8, 0x48, 0x48, 0x0e, 0xf6, 0xfb, 0xe6, 0x00,
+  0x05, 0x02, 0x0e, 0xf6, 0xfc, 0xf4, 0xff, 0xfd, 0x00, 0x00, 0x0e, 0x00,
+  0xc8, 0x48, 0x48, 0x81, 0xc6, 0x22, 0x12, 0xfe, 0xde, 0x02, 0x81, 0xc6,
+  0x23, 0x30, 0xff, 0xfd, 0xfe, 0xfe, 0x81, 0x00, 0xc8, 0x48, 0x48, 0xd3,
+  0xcc, 0xa6, 0xca, 0x3f, 0x5a, 0x02, 0xd3, 0xcc, 0xa7, 0xf8, 0xff, 0xfd,
+  0x3f, 0x3f, 0xd3, 0x00, 0xc8, 0x48, 0x48, 0xce, 0x46, 0xe6, 0x6b, 0xff,
+  0x1a, 0x02, 0xce, 0x46, 0xe7, 0xf9, 0xff, 0xfd, 0xff, 0xff, 0xce, 0x00,
+  0xc8, 0x48, 0x48, 0x07, 0xe8, 0x60, 0xc6, 0x0f, 0xa0, 0x02, 0x07, 0xe8,
+  0x61, 0x74, 0xff, 0xfd, 0x0f, 0x0f, 0x07, 0x00, 0xc9, 0x00, 0x48, 0x00,
+  0x20, 0x4c, 0x77, 0x5d, 0x00, 0x03, 0x00, 0x20, 0x4c, 0x77, 0xff, 0xfe,
+  0x5d, 0x5d, 0x00, 0x00, 0xc9, 0x01, 0x48, 0x00, 0xa9, 0x73, 0xff, 0xe7,
+  0x00, 0x03, 0x00, 0xa9, 0x73, 0xfc, 0xff, 0xfe, 0xe7, 0xe7, 0x00, 0x00,
+  0xc9, 0x0f, 0x48, 0x00, 0xdf, 0x3f, 0x8e, 0xcd, 0x00, 0x03, 0x00, 0xdf,
+  0x3f, 0xbc, 0xff, 0xfe, 0xcd, 0xcd, 0x00, 0x00, 0xc9, 0x3f, 0x48, 0x00,
+  0xe8, 0xf9, 0xf9, 0x76, 0x00, 0x03, 0x00, 0xe8, 0xf9, 0xf8, 0xff, 0xfe,
+  0x76, 0x76, 0x00, 0x00, 0xc9, 0x40, 0x48, 0x00, 0x79, 0x83, 0x1c, 0x9b,
+  0x00, 0x03, 0x00, 0x79, 0x83, 0xbc, 0xff, 0xfe, 0x9b, 0x9b, 0x00, 0x00,
+  0xc9, 0x7f, 0x48, 0x00, 0xda, 0x2d, 0x14, 0x4e, 0x00, 0x03, 0x00, 0xda,
+  0x2d, 0xb4, 0xff, 0xfe, 0x4e, 0x4e, 0x00, 0x00, 0xc9, 0x80, 0x48, 0x00,
+  0x51, 0xdf, 0x61, 0xbc, 0x00, 0x03, 0x00, 0x51, 0xdf, 0xf0, 0xff, 0xfe,
+  0xbc, 0xbc, 0x00, 0x00, 0xc9, 0x81, 0x48, 0x00, 0xd0, 0xb2, 0xf4, 0xf6,
+  0x00, 0x03, 0x00, 0xd0, 0xb2, 0x74, 0xff, 0xfe, 0xf6, 0xf6, 0x00, 0x00,
+  0xc9, 0xfe, 0x48, 0x00, 0x56, 0xba, 0x2f, 0x71, 0x00, 0x03, 0x00, 0x56,
+  0xba, 0x3c, 0xff, 0xfe, 0x71, 0x71, 0x00, 0x00, 0xc9, 0xff, 0x48, 0x00,
+  0x1a, 0x8f, 0x47, 0x25, 0x00, 0x03, 0x00, 0x1a, 0x8f, 0x74, 0xff, 0xfe,
+  0x25, 0x25, 0x00, 0x00, 0xc9, 0x00, 0x48, 0x01, 0x6d, 0xdd, 0xbc, 0xa6,
+  0x00, 0x03, 0x01, 0x6d, 0xdd, 0x3d, 0xff, 0xfe, 0xa6, 0xa6, 0x01, 0x00,
+  0xc9, 0x01, 0x48, 0x01, 0xd8, 0xea, 0xec, 0xbf, 0x00, 0x03, 0x01, 0xd8,
+  0xea, 0x7f, 0xff, 0xfe, 0xbf, 0xbf, 0x01, 0x00, 0xc9, 0x0f, 0x48, 0x01,
+  0x55, 0x8c, 0xf0, 0x6a, 0x00, 0x03, 0x01, 0x55, 0x8c, 0xf0, 0xff, 0xfe,
+  0x6a, 0x6a, 0x01, 0x00, 0xc9, 0x3f, 0x48, 0x01, 0x66, 0x26, 0x4f, 0xde,
+  0x00, 0x03, 0x01, 0x66, 0x26, 0xfc, 0xff, 0xfe, 0xde, 0xde, 0x01, 0x00,
+  0xc9, 0x40, 0x48, 0x01, 0x0d, 0xd6, 0x24, 0xf5, 0x00, 0x03, 0x01, 0x0d,
+  0xd6, 0xb4, 0xff, 0xfe, 0xf5, 0xf5, 0x01, 0x00, 0xc9, 0x7f, 0x48, 0x01,
+  0xf6, 0x08, 0xe6, 0xc7, 0x00, 0x03, 0x01, 0xf6, 0x08, 0xf4, 0xff, 0xfe,
+  0xc7, 0xc7, 0x01, 0x00, 0xc9, 0x80, 0x48, 0x01, 0x67, 0x73, 0x2d, 0xc4,
+  0x00, 0x03, 0x01, 0x67, 0x73, 0xbc, 0xff, 0xfe, 0xc4, 0xc4, 0x01, 0x00,
+  0xc9, 0x81, 0x48, 0x01, 0x22, 0x1c, 0x26, 0x93, 0x00, 0x03, 0x01, 0x22,
+  0x1c, 0xb4, 0xff, 0xfe, 0x93, 0x93, 0x01, 0x00, 0xc9, 0xfe, 0x48, 0x01,
+  0x59, 0x97, 0x31, 0x28, 0x00, 0x03, 0x01, 0x59, 0x97, 0x30, 0xff, 0xfe,
+  0x28, 0x28, 0x01, 0x00, 0xc9, 0xff, 0x48, 0x01, 0x23, 0x56, 0xb6, 0x34,
+  0x00, 0x03, 0x01, 0x23, 0x56, 0x34, 0xff, 0xfe, 0x34, 0x34, 0x01, 0x00,
+  0xc9, 0x00, 0x48, 0x0f, 0xb8, 0x03, 0x80, 0x6d, 0x00, 0x03, 0x0f, 0xb8,
+  0x03, 0x31, 0xff, 0xfe, 0x6d, 0x6d, 0x0f, 0x00, 0xc9, 0x01, 0x48, 0x0f,
+  0x4c, 0xb2, 0xc1, 0x90, 0x00, 0x03, 0x0f, 0x4c, 0xb2, 0x71, 0xff, 0xfe,
+  0x90, 0x90, 0x0f, 0x00, 0xc9, 0x0f, 0x48, 0x0f, 0x3c, 0x98, 0x3b, 0x6a,
+  0x00, 0x03, 0x0f, 0x3c, 0x98, 0x3b, 0xff, 0xfe, 0x6a, 0x6a, 0x0f, 0x00,
+  0xc9, 0x3f, 0x48, 0x0f, 0x20, 0x55, 0xd5, 0xde, 0x00, 0x03, 0x0f, 0x20,
+  0x55, 0xf4, 0xff, 0xfe, 0xde, 0xde, 0x0f, 0x00, 0xc9, 0x40, 0x48, 0x0f,
+  0x23, 0xd0, 0x71, 0xb1, 0x00, 0x03, 0x0f, 0x23, 0xd0, 0xf0, 0xff, 0xfe,
+  0xb1, 0xb1, 0x0f, 0x00, 0xc9, 0x7f, 0x48, 0x0f, 0x79, 0x88, 0xc3, 0xb1,
+  0x00, 0x03, 0x0f, 0x79, 0x88, 0xf0, 0xff, 0xfe, 0xb1, 0xb1, 0x0f, 0x00,
+  0xc9, 0x80, 0x48, 0x0f, 0xf3, 0xbf, 0x0b, 0x9d, 0x00, 0x03, 0x0f, 0xf3,
+  0xbf, 0xb8, 0xff, 0xfe, 0x9d, 0x9d, 0x0f, 0x00, 0xc9, 0x81, 0x48, 0x0f,
+  0x31, 0xd1, 0xce, 0x71, 0x00, 0x03, 0x0f, 0x31, 0xd1, 0xfc, 0xff, 0xfe,
+  0x71, 0x71, 0x0f, 0x00, 0xc9, 0xfe, 0x48, 0x0f, 0x25, 0x4a, 0x1b, 0x22,
+  0x00, 0x03, 0x0f, 0x25, 0x4a, 0x38, 0xff, 0xfe, 0x22, 0x22, 0x0f, 0x00,
+  0xc9, 0xff, 0x48, 0x0f, 0x7b, 0x4b, 0x4f, 0xc5, 0x00, 0x03, 0x0f, 0x7b,
+  0x4b, 0x7c, 0xff, 0xfe, 0xc5, 0xc5, 0x0f, 0x00, 0xc9, 0x00, 0x48, 0x3f,
+  0x91, 0xb2, 0x70, 0xbc, 0x00, 0x03, 0x3f, 0x91, 0xb2, 0x71, 0xff, 0xfe,
+  0xbc, 0xbc, 0x3f, 0x00, 0xc9, 0x01, 0x48, 0x3f, 0x41, 0x8e, 0x4d, 0x73,
+  0x00, 0x03, 0x3f, 0x41, 0x8e, 0x7d, 0xff, 0xfe, 0x73, 0x73, 0x3f, 0x00,
+  0xc9, 0x0f, 0x48, 0x3f, 0xb7, 0xd0, 0xfc, 0x21, 0x00, 0x03, 0x3f, 0xb7,
+  0xd0, 0x7d, 0xff, 0xfe, 0x21, 0x21, 0x3f, 0x00, 0xc9, 0x3f, 0x48, 0x3f,
+  0x7d, 0x75, 0x99, 0x68, 0x00, 0x03, 0x3f, 0x7d, 0x75, 0x3b, 0xff, 0xfe,
+  0x68, 0x68, 0x3f, 0x00, 0xc9, 0x40, 0x48, 0x3f, 0xa6, 0x7c, 0x91, 0xf0,
+  0x00, 0x03, 0x3f, 0xa6, 0x7c, 0xb0, 0xff, 0xfe, 0xf0, 0xf0, 0x3f, 0x00,
+  0xc9, 0x7f, 0x48, 0x3f, 0x72, 0x58, 0xdd, 0x29, 0x00, 0x03, 0x3f, 0x72,
+  0x58, 0xfc, 0xff, 0xfe, 0x29, 0x29, 0x3f, 0x00, 0xc9, 0x80, 0x48, 0x3f,
+  0xa1, 0x2e, 0x26, 0xb9, 0x00, 0x03, 0x3f, 0xa1, 0x2e, 0xb4, 0xff, 0xfe,
+  0xb9, 0xb9, 0x3f, 0x00, 0xc9, 0x81, 0x48, 0x3f, 0x4b, 0x43, 0x40, 0xb4,
+  0x00, 0x03, 0x3f, 0x4b, 0x43, 0xf0, 0xff, 0xfe, 0xb4, 0xb4, 0x3f, 0x00,
+  0xc9, 0xfe, 0x48, 0x3f, 0x8a, 0x5c, 0x6b, 0x92, 0x00, 0x03, 0x3f, 0x8a,
+  0x5c, 0x78, 0xff, 0xfe, 0x92, 0x92, 0x3f, 0x00, 0xc9, 0xff, 0x48, 0x3f,
+  0x1a, 0xf3, 0xaf, 0xc6, 0x00, 0x03, 0x3f, 0x1a, 0xf3, 0x3c, 0xff, 0xfe,
+  0xc6, 0xc6, 0x3f, 0x00, 0xc9, 0x00, 0x48, 0x40, 0xa7, 0x8a, 0x5a, 0x52,
+  0x00, 0x03, 0x40, 0xa7, 0x8a, 0x79, 0xff, 0xfe, 0x52, 0x52, 0x40, 0x00,
+  0xc9, 0x01, 0x48, 0x40, 0xb0, 0xc7, 0x20, 0x5a, 0x00, 0x03, 0x40, 0xb0,
+  0xc7, 0x31, 0xff, 0xfe, 0x5a, 0x5a, 0x40, 0x00, 0xc9, 0x0f, 0x48, 0x40,
+  0x56, 0x8d, 0x25, 0xbc, 0x00, 0x03, 0x40, 0x56, 0x8d, 0x35, 0xff, 0xfe,
+  0xbc, 0xbc, 0x40, 0x00, 0xc9, 0x3f, 0x48, 0x40, 0x97, 0xf1, 0xe2, 0x3e,
+  0x00, 0x03, 0x40, 0x97, 0xf1, 0x71, 0xff, 0xfe, 0x3e, 0x3e, 0x40, 0x00,
+  0xc9, 0x40, 0x48, 0x40, 0x08, 0xb6, 0xca, 0x3d, 0x00, 0x03, 0x40, 0x08,
+  0xb6, 0x7b, 0xff, 0xfe, 0x3d, 0x3d, 0x40, 0x00, 0xc9, 0x7f, 0x48, 0x40,
+  0x09, 0x7f, 0xe4, 0x84, 0x00, 0x03, 0x40, 0x09, 0x7f, 0xf4, 0xff, 0xfe,
+  0x84, 0x84, 0x40, 0x00, 0xc9, 0x80, 0x48, 0x40, 0x81, 0x89, 0xf2, 0x99,
+  0x00, 0x03, 0x40, 0x81, 0x89, 0xf0, 0xff, 0xfe, 0x99, 0x99, 0x40, 0x00,
+  0xc9, 0x81, 0x48, 0x40, 0x0f, 0x71, 0x13, 0x80, 0x00, 0x03, 0x40, 0x0f,
+  0x71, 0xb0, 0xff, 0xfe, 0x80, 0x80, 0x40, 0x00, 0xc9, 0xfe, 0x48, 0x40,
+  0xf4, 0xc1, 0x63, 0x6d, 0x00, 0x03, 0x40, 0xf4, 0xc1, 0x70, 0xff, 0xfe,
+  0x6d, 0x6d, 0x40, 0x00, 0xc9, 0xff, 0x48, 0x40, 0x84, 0x6d, 0xed, 0x11,
+  0x00, 0x03, 0x40, 0x84, 0x6d, 0x7c, 0xff, 0xfe, 0x11, 0x11, 0x40, 0x00,
+  0xc9, 0x00, 0x48, 0x7f, 0x33, 0xae, 0x87, 0xe8, 0x00, 0x03, 0x7f, 0x33,
+  0xae, 0x35, 0xff, 0xfe, 0xe8, 0xe8, 0x7f, 0x00, 0xc9, 0x01, 0x48, 0x7f,
+  0x92, 0x22, 0x2c, 0x4d, 0x00, 0x03, 0x7f, 0x92, 0x22, 0x3d, 0xff, 0xfe,
+  0x4d, 0x4d, 0x7f, 0x00, 0xc9, 0x0f, 0x48, 0x7f, 0x68, 0xd0, 0x14, 0xd5,
+  0x00, 0x03, 0x7f, 0x68, 0xd0, 0x35, 0xff, 0xfe, 0xd5, 0xd5, 0x7f, 0x00,
+  0xc9, 0x3f, 0x48, 0x7f, 0x2f, 0x8b, 0x87, 0x43, 0x00, 0x03, 0x7f, 0x2f,
+  0x8b, 0x35, 0xff, 0xfe, 0x43, 0x43, 0x7f, 0x00, 0xc9, 0x40, 0x48, 0x7f,
+  0x95, 0x40, 0xb2, 0x5a, 0x00, 0x03, 0x7f, 0x95, 0x40, 0x31, 0xff, 0xfe,
+  0x5a, 0x5a, 0x7f, 0x00, 0xc9, 0x7f, 0x48, 0x7f, 0xa4, 0xb6, 0x9d, 0xf7,
+  0x00, 0x03, 0x7f, 0xa4, 0xb6, 0x3f, 0xff, 0xfe, 0xf7, 0xf7, 0x7f, 0x00,
+  0xc9, 0x80, 0x48, 0x7f, 0x4f, 0x2c, 0xb7, 0xf9, 0x00, 0x03, 0x7f, 0x4f,
+  0x2c, 0xb4, 0xff, 0xfe, 0xf9, 0xf9, 0x7f, 0x00, 0xc9, 0x81, 0x48, 0x7f,
+  0x68, 0x06, 0x04, 0x7e, 0x00, 0x03, 0x7f, 0x68, 0x06, 0xb4, 0xff, 0xfe,
+  0x7e, 0x7e, 0x7f, 0x00, 0xc9, 0xfe, 0x48, 0x7f, 0x1b, 0x57, 0x80, 0x0b,
+  0x00, 0x03, 0x7f, 0x1b, 0x57, 0xb0, 0xff, 0xfe, 0x0b, 0x0b, 0x7f, 0x00,
+  0xc9, 0xff, 0x48, 0x7f, 0x81, 0x74, 0x87, 0x50, 0x00, 0x03, 0x7f, 0x81,
+  0x74, 0xb4, 0xff, 0xfe, 0x50, 0x50, 0x7f, 0x00, 0xc9, 0x00, 0x48, 0x80,
+  0x9d, 0xd7, 0x28, 0x9b, 0x00, 0x03, 0x80, 0x9d, 0xd7, 0xb9, 0xff, 0xfe,
+  0x9b, 0x9b, 0x80, 0x00, 0xc9, 0x01, 0x48, 0x80, 0xa5, 0x34, 0xcf, 0x62,
+  0x00, 0x03, 0x80, 0xa5, 0x34, 0x7d, 0xff, 0xfe, 0x62, 0x62, 0x80, 0x00,
+  0xc9, 0x0f, 0x48, 0x80, 0xc2, 0xec, 0x2c, 0x11, 0x00, 0x03, 0x80, 0xc2,
+  0xec, 0x3d, 0xff, 0xfe, 0x11, 0x11, 0x80, 0x00, 0xc9, 0x3f, 0x48, 0x80,
+  0x1b, 0xb3, 0xc9, 0xab, 0x00, 0x03, 0x80, 0x1b, 0xb3, 0x79, 0xff, 0xfe,
+  0xab, 0xab, 0x80, 0x00, 0xc9, 0x40, 0x48, 0x80, 0xba, 0x09, 0xd3, 0xd9,
+  0x00, 0x03, 0x80, 0xba, 0x09, 0x71, 0xff, 0xfe, 0xd9, 0xd9, 0x80, 0x00,
+  0xc9, 0x7f, 0x48, 0x80, 0x84, 0x88, 0x06, 0x41, 0x00, 0x03, 0x80, 0x84,
+  0x88, 0x35, 0xff, 0xfe, 0x41, 0x41, 0x80, 0x00, 0xc9, 0x80, 0x48, 0x80,
+  0xc2, 0xd3, 0x6d, 0x6c, 0x00, 0x03, 0x80, 0xc2, 0xd3, 0x7f, 0xff, 0xfe,
+  0x6c, 0x6c, 0x80, 0x00, 0xc9, 0x81, 0x48, 0x80, 0xd7, 0xc0, 0x3c, 0x90,
+  0x00, 0x03, 0x80, 0xd7, 0xc0, 0xbc, 0xff, 0xfe, 0x90, 0x90, 0x80, 0x00,
+  0xc9, 0xfe, 0x48, 0x80, 0x2b, 0xe0, 0x9a, 0xe3, 0x00, 0x03, 0x80, 0x2b,
+  0xe0, 0xb8, 0xff, 0xfe, 0xe3, 0xe3, 0x80, 0x00, 0xc9, 0xff, 0x48, 0x80,
+  0x4a, 0x13, 0x52, 0xd5, 0x00, 0x03, 0x80, 0x4a, 0x13, 0xf0, 0xff, 0xfe,
+  0xd5, 0xd5, 0x80, 0x00, 0xc9, 0x00, 0x48, 0x81, 0x13, 0x83, 0x15, 0x43,
+  0x00, 0x03, 0x81, 0x13, 0x83, 0xb5, 0xff, 0xfe, 0x43, 0x43, 0x81, 0x00,
+  0xc9, 0x01, 0x48, 0x81, 0xc1, 0x56, 0xdc, 0x48, 0x00, 0x03, 0x81, 0xc1,
+  0x56, 0xfd, 0xff, 0xfe, 0x48, 0x48, 0x81, 0x00, 0xc9, 0x0f, 0x48, 0x81,
+  0x8a, 0x5c, 0x5e, 0xae, 0x00, 0x03, 0x81, 0x8a, 0x5c, 0x7d, 0xff, 0xfe,
+  0xae, 0xae, 0x81, 0x00, 0xc9, 0x3f, 0x48, 0x81, 0xfc, 0xa6, 0x37, 0xe0,
+  0x00, 0x03, 0x81, 0xfc, 0xa6, 0x35, 0xff, 0xfe, 0xe0, 0xe0, 0x81, 0x00,
+  0xc9, 0x40, 0x48, 0x81, 0xb2, 0xd1, 0x35, 0x9d, 0x00, 0x03, 0x81, 0xb2,
+  0xd1, 0x35, 0xff, 0xfe, 0x9d, 0x9d, 0x81, 0x00, 0xc9, 0x7f, 0x48, 0x81,
+  0x02, 0xcd, 0xcd, 0xf4, 0x00, 0x03, 0x81, 0x02, 0xcd, 0x7d, 0xff, 0xfe,
+  0xf4, 0xf4, 0x81, 0x00, 0xc9, 0x80, 0x48, 0x81, 0x85, 0x7d, 0x5f, 0xf8,
+  0x00, 0x03, 0x81, 0x85, 0x7d, 0x7d, 0xff, 0xfe, 0xf8, 0xf8, 0x81, 0x00,
+  0xc9, 0x81, 0x48, 0x81, 0x0a, 0x98, 0x9f, 0x0a, 0x00, 0x03, 0x81, 0x0a,
+  0x98, 0x3f, 0xff, 0xfe, 0x0a, 0x0a, 0x81, 0x00, 0xc9, 0xfe, 0x48, 0x81,
+  0x8a, 0xf2, 0xaa, 0xb0, 0x00, 0x03, 0x81, 0x8a, 0xf2, 0xb8, 0xff, 0xfe,
+  0xb0, 0xb0, 0x81, 0x00, 0xc9, 0xff, 0x48, 0x81, 0x64, 0x1c, 0x58, 0x5a,
+  0x00, 0x03, 0x81, 0x64, 0x1c, 0xf8, 0xff, 0xfe, 0x5a, 0x5a, 0x81, 0x00,
+  0xc9, 0x00, 0x48, 0xfe, 0xb7, 0x88, 0x91, 0x23, 0x00, 0x03, 0xfe, 0xb7,
+  0x88, 0xb1, 0xff, 0xfe, 0x23, 0x23, 0xfe, 0x00, 0xc9, 0x01, 0x48, 0xfe,
+  0xbe, 0x12, 0x8c, 0x75, 0x00, 0x03, 0xfe, 0xbe, 0x12, 0xbd, 0xff, 0xfe,
+  0x75, 0x75, 0xfe, 0x00, 0xc9, 0x0f, 0x48, 0xfe, 0x72, 0xb8, 0xd7, 0x87,
+  0x00, 0x03, 0xfe, 0x72, 0xb8, 0xf5, 0xff, 0xfe, 0x87, 0x87, 0xfe, 0x00,
+  0xc9, 0x3f, 0x48, 0xfe, 0xc6, 0x33, 0x05, 0xc9, 0x00, 0x03, 0xfe, 0xc6,
+  0x33, 0xb5, 0xff, 0xfe, 0xc9, 0xc9, 0xfe, 0x00, 0xc9, 0x40, 0x48, 0xfe,
+  0xa6, 0x99, 0x5f, 0x85, 0x00, 0x03, 0xfe, 0xa6, 0x99, 0xfd, 0xff, 0xfe,
+  0x85, 0x85, 0xfe, 0x00, 0xc9, 0x7f, 0x48, 0xfe, 0x6b, 0x15, 0x24, 0x11,
+  0x00, 0x03, 0xfe, 0x6b, 0x15, 0x35, 0xff, 0xfe, 0x11, 0x11, 0xfe, 0x00,
+  0xc9, 0x80, 0x48, 0xfe, 0x28, 0xce, 0x6a, 0xa7, 0x00, 0x03, 0xfe, 0x28,
+  0xce, 0x79, 0xff, 0xfe, 0xa7, 0xa7, 0xfe, 0x00, 0xc9, 0x81, 0x48, 0xfe,
+  0xf1, 0xa5, 0xe0, 0xb0, 0x00, 0x03, 0xfe, 0xf1, 0xa5, 0x71, 0xff, 0xfe,
+  0xb0, 0xb0, 0xfe, 0x00, 0xc9, 0xfe, 0x48, 0xfe, 0x82, 0x14, 0x86, 0x99,
+  0x00, 0x03, 0xfe, 0x82, 0x14, 0x37, 0xff, 0xfe, 0x99, 0x99, 0xfe, 0x00,
+  0xc9, 0xff, 0x48, 0xfe, 0x88, 0x91, 0xc1, 0xea, 0x00, 0x03, 0xfe, 0x88,
+  0x91, 0xf0, 0xff, 0xfe, 0xea, 0xea, 0xfe, 0x00, 0xc9, 0x00, 0x48, 0xff,
+  0xae, 0xea, 0x77, 0x66, 0x00, 0x03, 0xff, 0xae, 0xea, 0xf5, 0xff, 0xfe,
+  0x66, 0x66, 0xff, 0x00, 0xc9, 0x01, 0x48, 0xff, 0x67, 0x88, 0xc6, 0xbd,
+  0x00, 0x03, 0xff, 0x67, 0x88, 0xf5, 0xff, 0xfe, 0xbd, 0xbd, 0xff, 0x00,
+  0xc9, 0x0f, 0x48, 0xff, 0x96, 0xe3, 0x3b, 0xdb, 0x00, 0x03, 0xff, 0x96,
+  0xe3, 0xb9, 0xff, 0xfe, 0xdb, 0xdb, 0xff, 0x00, 0xc9, 0x3f, 0x48, 0xff,
+  0x93, 0x22, 0x47, 0xa2, 0x00, 0x03, 0xff, 0x93, 0x22, 0xf5, 0xff, 0xfe,
+  0xa2, 0xa2, 0xff, 0x00, 0xc9, 0x40, 0x48, 0xff, 0x46, 0xb5, 0x92, 0x7e,
+  0x00, 0x03, 0xff, 0x46, 0xb5, 0xb1, 0xff, 0xfe, 0x7e, 0x7e, 0xff, 0x00,
+  0xc9, 0x7f, 0x48, 0xff, 0xff, 0x8c, 0x69, 0x33, 0x00, 0x03, 0xff, 0xff,
+  0x8c, 0xf9, 0xff, 0xfe, 0x33, 0x33, 0xff, 0x00, 0xc9, 0x80, 0x48, 0xff,
+  0x08, 0x82, 0x8c, 0x28, 0x00, 0x03, 0xff, 0x08, 0x82, 0x3d, 0xff, 0xfe,
+  0x28, 0x28, 0xff, 0x00, 0xc9, 0x81, 0x48, 0xff, 0x08, 0xdc, 0x6c, 0xfc,
+  0x00, 0x03, 0xff, 0x08, 0xdc, 0x7d, 0xff, 0xfe, 0xfc, 0xfc, 0xff, 0x00,
+  0xc9, 0xfe, 0x48, 0xff, 0x22, 0x6f, 0xae, 0xe4, 0x00, 0x03, 0xff, 0x22,
+  0x6f, 0x3d, 0xff, 0xfe, 0xe4, 0xe4, 0xff, 0x00, 0xc9, 0xff, 0x48, 0xff,
+  0xa1, 0xec, 0x20, 0x50, 0x00, 0x03, 0xff, 0xa1, 0xec, 0x33, 0xff, 0xfe,
+  0x50, 0x50, 0xff, 0x00, 0xca, 0x48, 0x48, 0xd8, 0xa4, 0xec, 0xad, 0xaa,
+  0x14, 0x02, 0xd8, 0xa3, 0xec, 0xbd, 0xff, 0xfd, 0xaa, 0xaa, 0xd8, 0x00,
+  0xca, 0x48, 0x48, 0xf3, 0xed, 0x96, 0x3b, 0x3f, 0x6a, 0x02, 0xf3, 0xec,
+  0x96, 0xb9, 0xff, 0xfd, 0x3f, 0x3f, 0xf3, 0x00, 0xca, 0x48, 0x48, 0x79,
+  0xe2, 0x9a, 0x9f, 0xaa, 0x66, 0x02, 0x79, 0xe1, 0x9a, 0xbd, 0xff, 0xfd,
+  0xaa, 0xaa, 0x79, 0x00, 0xca, 0x48, 0x48, 0x45, 0x03, 0x85, 0xdb, 0x0f,
+  0x7b, 0x02, 0x45, 0x02, 0x85, 0x79, 0xff, 0xfd, 0x0f, 0x0f, 0x45, 0x00,
+  0xca, 0x48, 0x48, 0xdd, 0x20, 0x4c, 0x40, 0xfe, 0xb4, 0x02, 0xdd, 0x1f,
+  0x4c, 0x70, 0xff, 0xfd, 0xfe, 0xfe, 0xdd, 0x00, 0xca, 0x48, 0x48, 0x51,
+  0xbe, 0xfc, 0x1d, 0x00, 0x04, 0x02, 0x51, 0xbd, 0xfc, 0xbd, 0xff, 0xfd,
+  0x00, 0x00, 0x51, 0x00, 0xcc, 0x00, 0x03, 0xbe, 0x3c, 0xed, 0xdb, 0x00,
+  0x13, 0x02, 0xbe, 0x3c, 0xed, 0xf9, 0xff, 0xff, 0x00, 0x00, 0xf9, 0x00,
+  0xcc, 0x00, 0x03, 0xcf, 0xe8, 0x5c, 0x49, 0x80, 0xa4, 0x02, 0xcf, 0xe8,
+  0x5c, 0xf8, 0xff, 0xff, 0x80, 0x80, 0xf8, 0x00, 0xcc, 0x00, 0x03, 0x96,
+  0xa3, 0x70, 0x75, 0xc0, 0x90, 0x02, 0x96, 0xa3, 0x70, 0xf4, 0xff, 0xff,
+  0xc0, 0xc0, 0xf4, 0x00, 0xcc, 0x00, 0x03, 0xb0, 0x7f, 0x87, 0x91, 0x7f,
+  0x79, 0x02, 0xb0, 0x7f, 0x87, 0x31, 0xff, 0xff, 0x7f, 0x7f, 0x31, 0x00,
+  0xcc, 0x00, 0x03, 0x3d, 0x27, 0x57, 0x27, 0x3f, 0xa9, 0x02, 0x3d, 0x27,
+  0x57, 0x35, 0xff, 0xff, 0x3f, 0x3f, 0x35, 0x00, 0xcc, 0x00, 0x03, 0x15,
+  0x78, 0x73, 0x6e, 0x02, 0x8d, 0x02, 0x15, 0x78, 0x73, 0x7d, 0xff, 0xff,
+  0x02, 0x02, 0x7d, 0x00, 0xcd, 0x00, 0x03, 0x2b, 0xad, 0x8b, 0x1e, 0x81,
+  0x75, 0x02, 0x2b, 0xad, 0x8b, 0xbc, 0xff, 0xff, 0x81, 0x81, 0xbc, 0x00,
+  0xcd, 0x00, 0x03, 0x20, 0xe5, 0xdd, 0x73, 0x01, 0x23, 0x02, 0x20, 0xe5,
+  0xdd, 0x71, 0xff, 0xff, 0x01, 0x01, 0x71, 0x00, 0xcd, 0x00, 0x03, 0x98,
+  0xec, 0xb1, 0xe9, 0x7f, 0x4f, 0x02, 0x98, 0xec, 0xb1, 0x79, 0xff, 0xff,
+  0x7f, 0x7f, 0x79, 0x00, 0xcd, 0x00, 0x03, 0x1b, 0xcd, 0xc9, 0xb3, 0x41,
+  0x37, 0x02, 0x1b, 0xcd, 0xc9, 0xb0, 0xff, 0xff, 0x41, 0x41, 0xb0, 0x00,
+  0xcd, 0x00, 0x03, 0x8c, 0x5f, 0x25, 0x92, 0x96, 0xdb, 0x02, 0x8c, 0x5f,
+  0x25, 0xb0, 0xff, 0xff, 0x96, 0x96, 0xb0, 0x00, 0xcd, 0x00, 0x03, 0x87,
+  0x74, 0xb6, 0xee, 0xc0, 0x4a, 0x02, 0x87, 0x74, 0xb6, 0xfc, 0xff, 0xff,
+  0xc0, 0xc0, 0xfc, 0x00, 0xce, 0x00, 0x03, 0xf3, 0x63, 0xef, 0x0c, 0x40,
+  0x11, 0x02, 0xf3, 0x63, 0xef, 0x3c, 0xff, 0xff, 0x40, 0x3f, 0x3c, 0x00,
+  0xce, 0x00, 0x03, 0x86, 0xb9, 0x7a, 0x1a, 0x80, 0x86, 0x02, 0x86, 0xb9,
+  0x7a, 0x38, 0xff, 0xff, 0x80, 0x7f, 0x38, 0x00, 0xce, 0x00, 0x03, 0xb5,
+  0xb8, 0xf0, 0x14, 0x3f, 0x10, 0x02, 0xb5, 0xb8, 0xf0, 0x34, 0xff, 0xff,
+  0x3f, 0x3e, 0x34, 0x00, 0xce, 0x00, 0x03, 0xf0, 0xbc, 0x78, 0x8a, 0x3f,
+  0x88, 0x02, 0xf0, 0xbc, 0x78, 0x38, 0xff, 0xff, 0x3f, 0x3e, 0x38, 0x00,
+  0xce, 0x00, 0x03, 0xf8, 0x78, 0x69, 0xee, 0x7f, 0x97, 0x02, 0xf8, 0x78,
+  0x69, 0x7c, 0xff, 0xff, 0x7f, 0x7e, 0x7c, 0x00, 0xce, 0x00, 0x03, 0x83,
+  0x33, 0xc9, 0x8d, 0x41, 0x37, 0x02, 0x83, 0x33, 0xc9, 0x3d, 0xff, 0xff,
+  0x41, 0x40, 0x3d, 0x00, 0xcf, 0x00, 0x03, 0xf0, 0x28, 0xb5, 0xd3, 0x41,
+  0x4b, 0x02, 0xf0, 0x28, 0xb5, 0xf1, 0xff, 0xff, 0x41, 0x40, 0xf1, 0x00,
+  0xcf, 0x00, 0x03, 0x59, 0x62, 0xda, 0x47, 0x3f, 0x26, 0x02, 0x59, 0x62,
+  0xda, 0x75, 0xff, 0xff, 0x3f, 0x3e, 0x75, 0x00, 0xcf, 0x00, 0x03, 0xb6,
+  0xab, 0xcf, 0x18, 0xaa, 0x31, 0x02, 0xb6, 0xab, 0xcf, 0x39, 0xff, 0xff,
+  0xaa, 0xa9, 0x39, 0x00, 0xcf, 0x00, 0x03, 0x1e, 0x86, 0x69, 0x5d, 0xfe,
+  0x97, 0x02, 0x1e, 0x86, 0x69, 0x7c, 0xff, 0xff, 0xfe, 0xfd, 0x7c, 0x00,
+  0xcf, 0x00, 0x03, 0x06, 0x1d, 0x8b, 0x6e, 0x7f, 0x75, 0x02, 0x06, 0x1d,
+  0x8b, 0xfc, 0xff, 0xff, 0x7f, 0x7e, 0xfc, 0x00, 0xcf, 0x00, 0x03, 0x7b,
+  0xe3, 0x6d, 0x9c, 0x7f, 0x93, 0x02, 0x7b, 0xe3, 0x6d, 0xbc, 0xff, 0xff,
+  0x7f, 0x7e, 0xbc, 0x00, 0xd0, 0x01, 0x48, 0xf4, 0x3b, 0xc9, 0x92, 0x19,
+  0x00, 0x03, 0xf4, 0x3b, 0xc9, 0xb2, 0xff, 0xfe, 0x19, 0x19, 0xf4, 0x00,
+  0xd0, 0x01, 0x48, 0xbe, 0x5a, 0x96, 0x30, 0x38, 0x00, 0x03, 0xbe, 0x5a,
+  0x96, 0x30, 0xff, 0xff, 0x38, 0x38, 0x30, 0x00, 0xd0, 0x01, 0x48, 0x00,
+  0x97, 0xc2, 0x2a, 0x65, 0x00, 0x03, 0x00, 0x97, 0xc2, 0x3a, 0xff, 0xfe,
+  0x65, 0x65, 0x00, 0x00, 0xd0, 0x01, 0x48, 0xb3, 0x93, 0x8a, 0xad, 0x1d,
+  0x00, 0x03, 0xb3, 0x93, 0x8a, 0xbd, 0xff, 0xff, 0x1d, 0x1d, 0xbd, 0x00,
+  0xd0, 0x01, 0x48, 0x67, 0x04, 0x59, 0x44, 0xbf, 0x00, 0x03, 0x67, 0x04,
+  0x59, 0x74, 0xff, 0xff, 0xbf, 0xbf, 0x74, 0x00, 0xd0, 0x01, 0x48, 0x1e,
+  0xa6, 0x6b, 0xb5, 0x7b, 0x00, 0x03, 0x1e, 0xa6, 0x6b, 0xb5, 0xff, 0xff,
+  0x7b, 0x7b, 0xb5, 0x00, 0xd0, 0x01, 0x48, 0x7a, 0xef, 0x66, 0xf4, 0x5e,
+  0x00, 0x03, 0x7a, 0xef, 0x66, 0xf4, 0xff, 0xff, 0x5e, 0x5e, 0xf4, 0x00,
+  0xd0, 0x01, 0x48, 0x70, 0xd1, 0x0b, 0x69, 0x60, 0x00, 0x03, 0x70, 0xd1,
+  0x0b, 0x79, 0xff, 0xff, 0x60, 0x60, 0x79, 0x00, 0xd0, 0x01, 0x48, 0x4b,
+  0xae, 0x75, 0xb2, 0x77, 0x00, 0x03, 0x4b, 0xae, 0x75, 0xb2, 0xff, 0xfe,
+  0x77, 0x77, 0x4b, 0x00, 0xd0, 0x01, 0x48, 0xb2, 0x98, 0xfe, 0x48, 0xe5,
+  0x00, 0x03, 0xb2, 0x98, 0xfe, 0x78, 0xff, 0xff, 0xe5, 0xe5, 0x78, 0x00,
+  0xd0, 0x01, 0x48, 0x99, 0x7f, 0xdc, 0x57, 0xb3, 0x00, 0x03, 0x99, 0x7f,
+  0xdc, 0x77, 0xff, 0xfe, 0xb3, 0xb3, 0x99, 0x00, 0xd0, 0x01, 0x48, 0x58,
+  0xa9, 0xc6, 0x8b, 0x6f, 0x00, 0x03, 0x58, 0xa9, 0xc6, 0xbb, 0xff, 0xfe,
+  0x6f, 0x6f, 0x58, 0x00, 0xd0, 0x01, 0x48, 0xee, 0x3a, 0xd3, 0x13, 0x7a,
+  0x00, 0x03, 0xee, 0x3a, 0xd3, 0x33, 0xff, 0xfe, 0x7a, 0x7a, 0xee, 0x00,
+  0xd0, 0x01, 0x48, 0xa9, 0x88, 0x94, 0x37, 0x1c, 0x00, 0x03, 0xa9, 0x88,
+  0x94, 0x37, 0xff, 0xfe, 0x1c, 0x1c, 0xa9, 0x00, 0xd0, 0x01, 0x48, 0x02,
+  0xc4, 0x48, 0x3a, 0x6d, 0x00, 0x03, 0x02, 0xc4, 0x48, 0x3a, 0xff, 0xfe,
+  0x6d, 0x6d, 0x02, 0x00, 0xd0, 0x01, 0x48, 0x4d, 0x23, 0x23, 0x7f, 0x58,
+  0x00, 0x03, 0x4d, 0x23, 0x23, 0x7f, 0xff, 0xfe, 0x58, 0x58, 0x4d, 0x00,
+  0xd0, 0x01, 0x48, 0x5a, 0xae, 0x9c, 0x8f, 0xc7, 0x00, 0x03, 0x5a, 0xae,
+  0x9c, 0xbf, 0xff, 0xfe, 0xc7, 0xc7, 0x5a, 0x00, 0xd0, 0x01, 0x48, 0x2c,
+  0x5e, 0x9f, 0x6f, 0x19, 0x00, 0x03, 0x2c, 0x5e, 0x9f, 0x7f, 0xff, 0xfe,
+  0x19, 0x19, 0x2c, 0x00, 0xd0, 0x01, 0x48, 0xaa, 0x19, 0xd8, 0x74, 0xa6,
+  0x00, 0x03, 0xaa, 0x19, 0xd8, 0x74, 0xff, 0xff, 0xa6, 0xa6, 0x74, 0x00,
+  0xd0, 0x01, 0x48, 0xc3, 0x08, 0x14, 0xaf, 0x1e, 0x00, 0x03, 0xc3, 0x08,
+  0x14, 0xbf, 0xff, 0xfe, 0x1e, 0x1e, 0xc3, 0x00, 0xd0, 0x00, 0x48, 0x65,
+  0xdb, 0x29, 0x89, 0xfc, 0x00, 0x03, 0x65, 0xdb, 0x29, 0xb9, 0xff, 0xfe,
+  0xfc, 0xfc, 0x65, 0x00, 0xd0, 0x00, 0x48, 0xd4, 0x91, 0x06, 0x71, 0xc3,
+  0x00, 0x03, 0xd4, 0x91, 0x06, 0x71, 0xff, 0xfe, 0xc3, 0xc3, 0xd4, 0x00,
+  0xd0, 0x00, 0x48, 0x49, 0x2b, 0xd8, 0x10, 0x40, 0x00, 0x03, 0x49, 0x2b,
+  0xd8, 0x30, 0xff, 0xfe, 0x40, 0x40, 0x49, 0x00, 0xd0, 0x00, 0x48, 0x3c,
+  0x67, 0x19, 0x78, 0xdc, 0x00, 0x03, 0x3c, 0x67, 0x19, 0x78, 0xff, 0xfe,
+  0xdc, 0xdc, 0x3c, 0x00, 0xd1, 0x42, 0x48, 0x4b, 0xef, 0x00, 0xfa, 0x40,
+  0x00, 0x03, 0x4b, 0xef, 0x00, 0x79, 0xff, 0xfe, 0x40, 0x40, 0x4b, 0x00,
+  0xd1, 0x42, 0x48, 0xc7, 0xee, 0x00, 0xc2, 0x00, 0x00, 0x03, 0xc7, 0xee,
+  0x00, 0xf1, 0xff, 0xfe, 0x00, 0x00, 0xc7, 0x00, 0xd1, 0x42, 0x48, 0xe9,
+  0x3a, 0x01, 0x1d, 0x00, 0xff, 0x02, 0xe9, 0x3a, 0x01, 0xbd, 0xff, 0xfe,
+  0x00, 0x00, 0xe9, 0x00, 0xd1, 0x42, 0x48, 0xe4, 0x13, 0x01, 0x0f, 0x3f,
+  0xff, 0x02, 0xe4, 0x13, 0x01, 0xbd, 0xff, 0xfe, 0x3f, 0x3f, 0xe4, 0x00,
+  0xd1, 0x42, 0x48, 0x72, 0xb6, 0x7f, 0x71, 0xfe, 0x81, 0x02, 0x72, 0xb6,
+  0x7f, 0x70, 0xff, 0xfe, 0xfe, 0xfe, 0x72, 0x00, 0xd1, 0x42, 0x48, 0x68,
+  0x22, 0x7f, 0xb5, 0xff, 0x81, 0x02, 0x68, 0x22, 0x7f, 0x34, 0xff, 0xfe,
+  0xff, 0xff, 0x68, 0x00, 0xd1, 0x42, 0x48, 0x80, 0x78, 0xd5, 0xd4, 0x0f,
+  0x2b, 0x02, 0x80, 0x78, 0xd5, 0x75, 0xff, 0xfe, 0x0f, 0x0f, 0x80, 0x00,
+  0xd1, 0x42, 0x48, 0xba, 0x12, 0xd5, 0x0f, 0xaa, 0x2b, 0x02, 0xba, 0x12,
+  0xd5, 0x3d, 0xff, 0xfe, 0xaa, 0xaa, 0xba, 0x00, 0xd1, 0x42, 0x48, 0x34,
+  0xda, 0xff, 0xcb, 0x7f, 0x01, 0x02, 0x34, 0xda, 0xff, 0xf8, 0xff, 0xfe,
+  0x7f, 0x7f, 0x34, 0x00, 0xd1, 0x42, 0x48, 0xc3, 0x42, 0xff, 0x6a, 0x81,
+  0x01, 0x02, 0xc3, 0x42, 0xff, 0x79, 0xff, 0xfe, 0x81, 0x81, 0xc3, 0x00,
+  0xd3, 0x42, 0x48, 0x26, 0x87, 0x00, 0x87, 0x02, 0x00, 0x03, 0x26, 0x87,
+  0x00, 0x35, 0xff, 0xfe, 0x02, 0x01, 0x26, 0x00, 0xd3, 0x42, 0x48, 0xf5,
+  0xb4, 0x00, 0xb0, 0x81, 0x00, 0x03, 0xf5, 0xb4, 0x00, 0x31, 0xff, 0xfe,
+  0x81, 0x80, 0xf5, 0x00, 0xd3, 0x42, 0x48, 0xb4, 0xfb, 0x01, 0x3f, 0x06,
+  0xff, 0x02, 0xb4, 0xfb, 0x01, 0xbd, 0xff, 0xfe, 0x06, 0x05, 0xb4, 0x00,
+  0xd3, 0x42, 0x48, 0xc8, 0x6e, 0x01, 0x78, 0x7f, 0xff, 0x02, 0xc8, 0x6e,
+  0x01, 0x79, 0xff, 0xfe, 0x7f, 0x7e, 0xc8, 0x00, 0xd3, 0x42, 0x48, 0xce,
+  0x79, 0x7f, 0x26, 0x0f, 0x81, 0x02, 0xce, 0x79, 0x7f, 0xb5, 0xff, 0xfe,
+  0x0f, 0x0e, 0xce, 0x00, 0xd3, 0x42, 0x48, 0xd9, 0x0e, 0x7f, 0xfa, 0x02,
+  0x81, 0x02, 0xd9, 0x0e, 0x7f, 0xf9, 0xff, 0xfe, 0x02, 0x01, 0xd9, 0x00,
+  0xd3, 0x42, 0x48, 0x55, 0x36, 0xd5, 0x2b, 0x00, 0x2b, 0x02, 0x55, 0x36,
+  0xd5, 0x38, 0xff, 0xfe, 0x00, 0xff, 0x55, 0x00, 0xd3, 0x42, 0x48, 0xbc,
+  0x2c, 0xd5, 0xcd, 0xff, 0x2b, 0x02, 0xbc, 0x2c, 0xd5, 0xfc, 0xff, 0xfe,
+  0xff, 0xfe, 0xbc, 0x00, 0xd3, 0x42, 0x48, 0x6e, 0x51, 0xff, 0x52, 0x0f,
+  0x01, 0x02, 0x6e, 0x51, 0xff, 0x71, 0xff, 0xfe, 0x0f, 0x0e, 0x6e, 0x00,
+  0xd3, 0x42, 0x48, 0xad, 0xe2, 0xff, 0x36, 0xff, 0x01, 0x02, 0xad, 0xe2,
+  0xff, 0xb4, 0xff, 0xfe, 0xff, 0xfe, 0xad, 0x00, 0xd4, 0x30, 0x48, 0x0d,
+  0x00, 0x68, 0x54, 0x7f, 0x98, 0x02, 0x0d, 0x00, 0x68, 0x74, 0xff, 0xfe,
+  0x7f, 0x7f, 0x0d, 0x00, 0xd4, 0x30, 0x48, 0x8e, 0x00, 0x66, 0x44, 0x02,
+  0x9a, 0x02, 0x8e, 0x00, 0x66, 0x74, 0xff, 0xfe, 0x02, 0x02, 0x8e, 0x00,
+  0xd4, 0x2f, 0x48, 0x38, 0x01, 0xa9, 0x40, 0x00, 0x57, 0x02, 0x38, 0x01,
+  0xa9, 0x70, 0xff, 0xfe, 0x00, 0x00, 0x38, 0x00, 0xd4, 0x2f, 0x48, 0xf1,
+  0x01, 0x31, 0xf6, 0x00, 0xcf, 0x02, 0xf1, 0x01, 0x31, 0xf6, 0xff, 0xfe,
+  0x00, 0x00, 0xf1, 0x00, 0xd4, 0xb1, 0x48, 0xee, 0x7f, 0xbf, 0x5d, 0x7f,
+  0x41, 0x02, 0xee, 0x7f, 0xbf, 0x7d, 0xff, 0xfe, 0x7f, 0x7f, 0xee, 0x00,
+  0xd4, 0xb1, 0x48, 0xfc, 0x7f, 0x78, 0xce, 0x40, 0x88, 0x02, 0xfc, 0x7f,
+  0x78, 0xfe, 0xff, 0xfe, 0x40, 0x40, 0xfc, 0x00, 0xd4, 0x5b, 0x48, 0x91,
+  0xd5, 0xaf, 0xaa, 0x02, 0x51, 0x02, 0x91, 0xd5, 0xaf, 0xba, 0xff, 0xfe,
+  0x02, 0x02, 0x91, 0x00, 0xd4, 0x5b, 0x48, 0x35, 0xd5, 0x6f, 0x07, 0x01,
+  0x91, 0x02, 0x35, 0xd5, 0x6f, 0x37, 0xff, 0xfe, 0x01, 0x01, 0x35, 0x00,
+  0xd4, 0x31, 0x48, 0xbe, 0xff, 0x81, 0xba, 0x41, 0x7f, 0x02, 0xbe, 0xff,
+  0x81, 0xba, 0xff, 0xfe, 0x41, 0x41, 0xbe, 0x00, 0xd4, 0x31, 0x48, 0x90,
+  0xff, 0xc8, 0x80, 0x41, 0x38, 0x02, 0x90, 0xff, 0xc8, 0xb0, 0xff, 0xfe,
+  0x41, 0x41, 0x90, 0x00, 0xd5, 0x30, 0x48, 0x4a, 0x00, 0x4c, 0x63, 0xaa,
+  0xb4, 0x02, 0x4a, 0x00, 0x4c, 0xf0, 0xff, 0xfe, 0xaa, 0xaa, 0x4a, 0x00,
+  0xd5, 0x30, 0x48, 0x81, 0x00, 0xd4, 0x72, 0xfe, 0x2c, 0x02, 0x81, 0x00,
+  0xd4, 0xf0, 0xff, 0xfe, 0xfe, 0xfe, 0x81, 0x00, 0xd5, 0x2f, 0x48, 0x5b,
+  0x01, 0x21, 0x02, 0x80, 0xdf, 0x02, 0x5b, 0x01, 0x21, 0xb0, 0xff, 0xfe,
+  0x80, 0x80, 0x5b, 0x00, 0xd5, 0x2f, 0x48, 0x45, 0x01, 0x84, 0xf2, 0x3f,
+  0x7c, 0x02, 0x45, 0x01, 0x84, 0x71, 0xff, 0xfe, 0x3f, 0x3f, 0x45, 0x00,
+  0xd5, 0xb1, 0x48, 0xdc, 0x7f, 0x5b, 0xed, 0x0f, 0xa5, 0x02, 0xdc, 0x7f,
+  0x5b, 0xfd, 0xff, 0xfe, 0x0f, 0x0f, 0xdc, 0x00, 0xd5, 0xb1, 0x48, 0xda,
+  0x7f, 0xb2, 0x3a, 0x41, 0x4e, 0x02, 0xda, 0x7f, 0xb2, 0xb9, 0xff, 0xfe,
+  0x41, 0x41, 0xda, 0x00, 0xd5, 0x5b, 0x48, 0x31, 0xd5, 0xf1, 0xcf, 0x1a,
+  0x0f, 0x02, 0x31, 0xd5, 0xf1, 0x7d, 0xff, 0xfe, 0x1a, 0x1a, 0x31, 0x00,
+  0xd5, 0x5b, 0x48, 0x8a, 0xd5, 0x19, 0x4b, 0x0f, 0xe7, 0x02, 0x8a, 0xd5,
+  0x19, 0x79, 0xff, 0xfe, 0x0f, 0x0f, 0x8a, 0x00, 0xd5, 0x31, 0x48, 0xd7,
+  0xff, 0xc6, 0x99, 0x81, 0x3a, 0x02, 0xd7, 0xff, 0xc6, 0x39, 0xff, 0xfe,
+  0x81, 0x81, 0xd7, 0x00, 0xd5, 0x31, 0x48, 0x2f, 0xff, 0xc2, 0xe1, 0x40,
+  0x3e, 0x02, 0x2f, 0xff, 0xc2, 0xf0, 0xff, 0xfe, 0x40, 0x40, 0x2f, 0x00,
+  0xd6, 0x30, 0x48, 0x63, 0x00, 0x35, 0xb0, 0x3f, 0xcb, 0x02, 0x63, 0x00,
+  0x35, 0x30, 0xff, 0xfe, 0x3e, 0x3f, 0x63, 0x00, 0xd6, 0x30, 0x48, 0x07,
+  0x00, 0xa2, 0xbe, 0x41, 0x5e, 0x02, 0x07, 0x00, 0xa2, 0x3c, 0xff, 0xfe,
+  0x40, 0x41, 0x07, 0x00, 0xd6, 0x2f, 0x48, 0x78, 0x01, 0x56, 0x16, 0xff,
+  0xaa, 0x02, 0x78, 0x01, 0x56, 0xb4, 0xff, 0xfe, 0xfe, 0xff, 0x78, 0x00,
+  0xd6, 0x2f, 0x48, 0xef, 0x01, 0xe3, 0x16, 0xff, 0x1d, 0x02, 0xef, 0x01,
+  0xe3, 0xb4, 0xff, 0xfe, 0xfe, 0xff, 0xef, 0x00, 0xd6, 0xb1, 0x48, 0xc8,
+  0x7f, 0x02, 0x17, 0x9d, 0xfe, 0x02, 0xc8, 0x7f, 0x02, 0xb5, 0xff, 0xfe,
+  0x9c, 0x9d, 0xc8, 0x00, 0xd6, 0xb1, 0x48, 0xbd, 0x7f, 0x15, 0x74, 0x3f,
+  0xeb, 0x02, 0xbd, 0x7f, 0x15, 0x74, 0xff, 0xfe, 0x3e, 0x3f, 0xbd, 0x00,
+  0xd6, 0x5b, 0x48, 0x40, 0xd5, 0x18, 0xbf, 0x7f, 0xe8, 0x02, 0x40, 0xd5,
+  0x18, 0x3d, 0xff, 0xfe, 0x7e, 0x7f, 0x40, 0x00, 0xd6, 0x5b, 0x48, 0xa7,
+  0xd5, 0x39, 0x92, 0xd2, 0xc7, 0x02, 0xa7, 0xd5, 0x39, 0xb0, 0xff, 0xfe,
+  0xd1, 0xd2, 0xa7, 0x00, 0xd6, 0x31, 0x48, 0xba, 0xff, 0xea, 0xf1, 0xfe,
+  0x16, 0x02, 0xba, 0xff, 0xea, 0xf1, 0xff, 0xfe, 0xfd, 0xfe, 0xba, 0x00,
+  0xd6, 0x31, 0x48, 0x99, 0xff, 0xd9, 0x5a, 0x27, 0x27, 0x02, 0x99, 0xff,
+  0xd9, 0x78, 0xff, 0xfe, 0x26, 0x27, 0x99, 0x00, 0xd7, 0x30, 0x48, 0x69,
+  0x00, 0x9b, 0xe6, 0x40, 0x65, 0x02, 0x69, 0x00, 0x9b, 0x75, 0xff, 0xfe,
+  0x3f, 0x40, 0x69, 0x00, 0xd7, 0x30, 0x48, 0xb4, 0x00, 0xfc, 0x58, 0x7f,
+  0x04, 0x02, 0xb4, 0x00, 0xfc, 0x79, 0xff, 0xfe, 0x7e, 0x7f, 0xb4, 0x00,
+  0xd7, 0x2f, 0x48, 0x7b, 0x01, 0x9f, 0x0e, 0x32, 0x61, 0x02, 0x7b, 0x01,
+  0x9f, 0x3d, 0xff, 0xfe, 0x31, 0x32, 0x7b, 0x00, 0xd7, 0x2f, 0x48, 0xa8,
+  0x01, 0xaf, 0x26, 0x00, 0x51, 0x02, 0xa8, 0x01, 0xaf, 0xb4, 0xff, 0xfe,
+  0xff, 0x00, 0xa8, 0x00, 0xd7, 0xb1, 0x48, 0x0f, 0x7f, 0x61, 0x08, 0x41,
+  0x9f, 0x02, 0x0f, 0x7f, 0x61, 0xb8, 0xff, 0xfe, 0x40, 0x41, 0x0f, 0x00,
+  0xd7, 0xb1, 0x48, 0xef, 0x7f, 0x60, 0xb7, 0x41, 0xa0, 0x02, 0xef, 0x7f,
+  0x60, 0xb5, 0xff, 0xfe, 0x40, 0x41, 0xef, 0x00, 0xd7, 0x5b, 0x48, 0x6d,
+  0xd5, 0x92, 0x22, 0xd3, 0x6e, 0x02, 0x6d, 0xd5, 0x92, 0xb0, 0xff, 0xfe,
+  0xd2, 0xd3, 0x6d, 0x00, 0xd7, 0x5b, 0x48, 0x75, 0xd5, 0x9a, 0x38, 0x41,
+  0x66, 0x02, 0x75, 0xd5, 0x9a, 0x39, 0xff, 0xfe, 0x40, 0x41, 0x75, 0x00,
+  0xd7, 0x31, 0x48, 0x54, 0xff, 0x6b, 0x5a, 0x40, 0x95, 0x02, 0x54, 0xff,
+  0x6b, 0x79, 0xff, 0xfe, 0x3f, 0x40, 0x54, 0x00, 0xd7, 0x31, 0x48, 0x85,
+  0xff, 0xd9, 0x20, 0x91, 0x27, 0x02, 0x85, 0xff, 0xd9, 0xb0, 0xff, 0xfe,
+  0x90, 0x91, 0x85, 0x00, 0xd8, 0x48, 0x48, 0xd9, 0x9c, 0x2f, 0x23, 0x01,
+  0xd1, 0x02, 0xd9, 0x9c, 0x2f, 0x33, 0xff, 0xfd, 0x01, 0x01, 0xd9, 0x00,
+  0xd8, 0x48, 0x48, 0x6f, 0x95, 0x34, 0xa6, 0x41, 0xcc, 0x02, 0x6f, 0x95,
+  0x34, 0xb6, 0xff, 0xfd, 0x41, 0x41, 0x6f, 0x00, 0xd8, 0x48, 0x48, 0x65,
+  0x02, 0x31, 0x6d, 0x81, 0xcf, 0x02, 0x65, 0x02, 0x31, 0x75, 0xff, 0xfd,
+  0x81, 0x81, 0x65, 0x00, 0xd8, 0x48, 0x48, 0x48, 0x75, 0xdd, 0x9e, 0x0f,
+  0x23, 0x02, 0x48, 0x75, 0xdd, 0xb6, 0xff, 0xfd, 0x0f, 0x0f, 0x48, 0x00,
+  0xd8, 0x48, 0x48, 0x76, 0x6d, 0x0e, 0xfa, 0x81, 0xf2, 0x02, 0x76, 0x6d,
+  0x0e, 0xf2, 0xff, 0xfd, 0x81, 0x81, 0x76, 0x00, 0xd8, 0x48, 0x48, 0x90,
+  0x30, 0x42, 0xbb, 0xfe, 0xbe, 0x02, 0x90, 0x30, 0x42, 0xb3, 0xff, 0xfd,
+  0xfe, 0xfe, 0x90, 0x00, 0xd9, 0x00, 0x03, 0xe4, 0x7e, 0x00, 0x95, 0x81,
+  0x00, 0x03, 0xe4, 0x7e, 0x00, 0x35, 0xff, 0xff, 0x81, 0x81, 0x35, 0x00,
+  0xd9, 0x00, 0x03, 0x35, 0x46, 0x00, 0xa2, 0x01, 0x00, 0x03, 0x35, 0x46,
+  0x00, 0x31, 0xff, 0xff, 0x01, 0x01, 0x31, 0x00, 0xd9, 0xff, 0x02, 0x81,
+  0x95, 0x01, 0xc6, 0x40, 0xff, 0x02, 0x81, 0x95, 0x01, 0x75, 0xff, 0xff,
+  0x40, 0x40, 0x75, 0x00, 0xd9, 0xff, 0x02, 0x52, 0x95, 0x01, 0x12, 0x41,
+  0xff, 0x02, 0x52, 0x95, 0x01, 0x31, 0xff, 0xff, 0x41, 0x41, 0x31, 0x00,
+  0xd9, 0x81, 0x02, 0xef, 0x64, 0x7f, 0xb0, 0x02, 0x81, 0x02, 0xef, 0x64,
+  0x7f, 0xb1, 0xff, 0xff, 0x02, 0x02, 0xb1, 0x00, 0xd9, 0x81, 0x02, 0xec,
+  0xb0, 0x7f, 0xb9, 0x0f, 0x81, 0x02, 0xec, 0xb0, 0x7f, 0xb9, 0xff, 0xff,
+  0x0f, 0x0f, 0xb9, 0x00, 0xd9, 0x2b, 0x02, 0xc7, 0xe0, 0xd5, 0x16, 0x7f,
+  0x2b, 0x02, 0xc7, 0xe0, 0xd5, 0x35, 0xff, 0xff, 0x7f, 0x7f, 0x35, 0x00,
+  0xd9, 0x2b, 0x02, 0xef, 0x42, 0xd5, 0x05, 0xff, 0x2b, 0x02, 0xef, 0x42,
+  0xd5, 0xb4, 0xff, 0xff, 0xff, 0xff, 0xb4, 0x00, 0xd9, 0x01, 0x02, 0x23,
+  0xd4, 0xff, 0xfc, 0x01, 0x01, 0x02, 0x23, 0xd4, 0xff, 0x7d, 0xff, 0xff,
+  0x01, 0x01, 0x7d, 0x00, 0xd9, 0x01, 0x02, 0xd2, 0xae, 0xff, 0x98, 0x3f,
+  0x01, 0x02, 0xd2, 0xae, 0xff, 0xb9, 0xff, 0xff, 0x3f, 0x3f, 0xb9, 0x00,
+  0xda, 0x48, 0x48, 0x71, 0xe7, 0x1c, 0xbe, 0x3f, 0xe4, 0x02, 0x71, 0xe7,
+  0x1c, 0xbe, 0xff, 0xfd, 0x3f, 0x3f, 0x71, 0x00, 0xda, 0x48, 0x48, 0xa5,
+  0x8c, 0x01, 0xe0, 0x81, 0xff, 0x02, 0xa5, 0x8c, 0x01, 0xf0, 0xff, 0xfd,
+  0x81, 0x81, 0xa5, 0x00, 0xda, 0x48, 0x48, 0xa0, 0x3f, 0x62, 0x42, 0x0f,
+  0x9e, 0x02, 0xa0, 0x3f, 0x62, 0x72, 0xff, 0xfd, 0x0f, 0x0f, 0xa0, 0x00,
+  0xda, 0x48, 0x48, 0x42, 0x5d, 0x11, 0x04, 0x01, 0xef, 0x02, 0x42, 0x5d,
+  0x11, 0x34, 0xff, 0xfd, 0x01, 0x01, 0x42, 0x00, 0xdb, 0x00, 0x03, 0xa3,
+  0xb3, 0x00, 0xfa, 0xff, 0x00, 0x03, 0xa3, 0xb3, 0x00, 0xf8, 0xff, 0xff,
+  0xff, 0xfe, 0xf8, 0x00, 0xdb, 0x00, 0x03, 0x40, 0x45, 0x00, 0x2e, 0x32,
+  0x00, 0x03, 0x40, 0x45, 0x00, 0x3d, 0xff, 0xff, 0x32, 0x31, 0x3d, 0x00,
+  0xdb, 0xff, 0x02, 0x84, 0xd0, 0x01, 0x78, 0x01, 0xff, 0x02, 0x84, 0xd0,
+  0x01, 0xf9, 0xff, 0xff, 0x01, 0x00, 0xf9, 0x00, 0xdb, 0xff, 0x02, 0x41,
+  0xc5, 0x01, 0xa1, 0xaa, 0xff, 0x02, 0x41, 0xc5, 0x01, 0xb0, 0xff, 0xff,
+  0xaa, 0xa9, 0xb0, 0x00, 0xdb, 0x81, 0x02, 0xa0, 0x4f, 0x7f, 0xc0, 0x0f,
+  0x81, 0x02, 0xa0, 0x4f, 0x7f, 0xf1, 0xff, 0xff, 0x0f, 0x0e, 0xf1, 0x00,
+  0xdb, 0x81, 0x02, 0xe3, 0x24, 0x7f, 0x5a, 0x00, 0x81, 0x02, 0xe3, 0x24,
+  0x7f, 0xf8, 0xff, 0xff, 0x00, 0xff, 0xf8, 0x00, 0xdb, 0x2b, 0x02, 0xcf,
+  0x43, 0xd5, 0x78, 0x0f, 0x2b, 0x02, 0xcf, 0x43, 0xd5, 0xf9, 0xff, 0xff,
+  0x0f, 0x0e, 0xf9, 0x00, 0xdb, 0x2b, 0x02, 0x66, 0xcd, 0xd5, 0x38, 0x02,
+  0x2b, 0x02, 0x66, 0xcd, 0xd5, 0x39, 0xff, 0xff, 0x02, 0x01, 0x39, 0x00,
+  0xdb, 0x01, 0x02, 0x9f, 0x7f, 0xff, 0x16, 0x9b, 0x01, 0x02, 0x9f, 0x7f,
+  0xff, 0x35, 0xff, 0xff, 0x9b, 0x9a, 0x35, 0x00, 0xdb, 0x01, 0x02, 0x63,
+  0xfb, 0xff, 0x84, 0x01, 0x01, 0x02, 0x63, 0xfb, 0xff, 0x35, 0xff, 0xff,
+  0x01, 0x00, 0x35, 0x00, 0xdc, 0x00, 0x03, 0x7f, 0x00, 0x7c, 0x10, 0xff,
+  0x84, 0x02, 0x7f, 0x00, 0x7c, 0x30, 0xff, 0xff, 0xff, 0xff, 0x30, 0x00,
+  0xdc, 0x00, 0x03, 0x11, 0x00, 0x58, 0xc8, 0xc0, 0xa8, 0x02, 0x11, 0x00,
+  0x58, 0xf8, 0xff, 0xff, 0xc0, 0xc0, 0xf8, 0x00, 0xdc, 0xff, 0x02, 0x42,
+  0x01, 0x7a, 0x2a, 0x3f, 0x86, 0x02, 0x42, 0x01, 0x7a, 0x3a, 0xff, 0xff,
+  0x3f, 0x3f, 0x3a, 0x00, 0xdc, 0xff, 0x02, 0x40, 0x01, 0x10, 0xf3, 0x0f,
+  0xf0, 0x02, 0x40, 0x01, 0x10, 0xf3, 0xff, 0xff, 0x0f, 0x0f, 0xf3, 0x00,
+  0xdc, 0x81, 0x02, 0xb7, 0x7f, 0x7b, 0xa3, 0x3f, 0x85, 0x02, 0xb7, 0x7f,
+  0x7b, 0xb3, 0xff, 0xff, 0x3f, 0x3f, 0xb3, 0x00, 0xdc, 0x81, 0x02, 0x30,
+  0x7f, 0x99, 0xca, 0xff, 0x67, 0x02, 0x30, 0x7f, 0x99, 0xfa, 0xff, 0xff,
+  0xff, 0xff, 0xfa, 0x00, 0xdc, 0x2b, 0x02, 0x4b, 0xd5, 0x2c, 0x6c, 0x02,
+  0xd4, 0x02, 0x4b, 0xd5, 0x2c, 0x7c, 0xff, 0xff, 0x02, 0x02, 0x7c, 0x00,
+  0xdc, 0x2b, 0x02, 0x94, 0xd5, 0xbe, 0x68, 0xc0, 0x42, 0x02, 0x94, 0xd5,
+  0xbe, 0x78, 0xff, 0xff, 0xc0, 0xc0, 0x78, 0x00, 0xdc, 0x01, 0x02, 0x6c,
+  0xff, 0xd3, 0x96, 0xff, 0x2d, 0x02, 0x6c, 0xff, 0xd3, 0xb6, 0xff, 0xff,
+  0xff, 0xff, 0xb6, 0x00, 0xdc, 0x01, 0x02, 0xd2, 0xff, 0xf0, 0x2b, 0xc0,
+  0x10, 0x02, 0xd2, 0xff, 0xf0, 0x3b, 0xff, 0xff, 0xc0, 0xc0, 0x3b, 0x00,
+  0xdd, 0x00, 0x03, 0xa1, 0x00, 0xc2, 0x9f, 0x58, 0x3e, 0x02, 0xa1, 0x00,
+  0xc2, 0x3d, 0xff, 0xff, 0x58, 0x58, 0x3d, 0x00, 0xdd, 0x00, 0x03, 0xb0,
+  0x00, 0x15, 0xc2, 0x41, 0xeb, 0x02, 0xb0, 0x00, 0x15, 0x71, 0xff, 0xff,
+  0x41, 0x41, 0x71, 0x00, 0xdd, 0xff, 0x02, 0xc3, 0x01, 0x04, 0xe7, 0x81,
+  0xfc, 0x02, 0xc3, 0x01, 0x04, 0x75, 0xff, 0xff, 0x81, 0x81, 0x75, 0x00,
+  0xdd, 0xff, 0x02, 0xa7, 0x01, 0x2f, 0x6e, 0x40, 0xd1, 0x02, 0xa7, 0x01,
+  0x2f, 0x7d, 0xff, 0xff, 0x40, 0x40, 0x7d, 0x00, 0xdd, 0x81, 0x02, 0xb0,
+  0x7f, 0x91, 0xd8, 0x00, 0x6f, 0x02, 0xb0, 0x7f, 0x91, 0xf9, 0xff, 0xff,
+  0x00, 0x00, 0xf9, 0x00, 0xdd, 0x81, 0x02, 0x38, 0x7f, 0x97, 0x73, 0x01,
+  0x69, 0x02, 0x38, 0x7f, 0x97, 0x71, 0xff, 0xff, 0x01, 0x01, 0x71, 0x00,
+  0xdd, 0x2b, 0x02, 0xb9, 0xd5, 0x84, 0xb5, 0xee, 0x7c, 0x02, 0xb9, 0xd5,
+  0x84, 0xb4, 0xff, 0xff, 0xee, 0xee, 0xb4, 0x00, 0xdd, 0x2b, 0x02, 0xa1,
+  0xd5, 0x57, 0xa7, 0x40, 0xa9, 0x02, 0xa1, 0xd5, 0x57, 0x35, 0xff, 0xff,
+  0x40, 0x40, 0x35, 0x00, 0xdd, 0x01, 0x02, 0x2b, 0xff, 0xc1, 0x24, 0x0f,
+  0x3f, 0x02, 0x2b, 0xff, 0xc1, 0x35, 0xff, 0xff, 0x0f, 0x0f, 0x35, 0x00,
+  0xdd, 0x01, 0x02, 0x7f, 0xff, 0x57, 0xb9, 0xc0, 0xa9, 0x02, 0x7f, 0xff,
+  0x57, 0xb8, 0xff, 0xff, 0xc0, 0xc0, 0xb8, 0x00, 0xde, 0x00, 0x03, 0x6d,
+  0x00, 0xda, 0xc7, 0x40, 0x26, 0x02, 0x6d, 0x00, 0xda, 0x75, 0xff, 0xff,
+  0x40, 0x3f, 0x75, 0x00, 0xde, 0x00, 0x03, 0xf1, 0x00, 0x76, 0xfc, 0xfe,
+  0x8a, 0x02, 0xf1, 0x00, 0x76, 0xfc, 0xff, 0xff, 0xfe, 0xfd, 0xfc, 0x00,
+  0xde, 0xff, 0x02, 0xa3, 0x01, 0x30, 0xa7, 0xc0, 0xd0, 0x02, 0xa3, 0x01,
+  0x30, 0xb5, 0xff, 0xff, 0xc0, 0xbf, 0xb5, 0x00, 0xde, 0xff, 0x02, 0x25,
+  0x01, 0xb9, 0x45, 0x00, 0x47, 0x02, 0x25, 0x01, 0xb9, 0xf5, 0xff, 0xff,
+  0x00, 0xff, 0xf5, 0x00, 0xde, 0x81, 0x02, 0x28, 0x7f, 0x62, 0xf9, 0x41,
+  0x9e, 0x02, 0x28, 0x7f, 0x62, 0x79, 0xff, 0xff, 0x41, 0x40, 0x79, 0x00,
+  0xde, 0x81, 0x02, 0x61, 0x7f, 0x70, 0x23, 0x0a, 0x90, 0x02, 0x61, 0x7f,
+  0x70, 0x31, 0xff, 0xff, 0x0a, 0x09, 0x31, 0x00, 0xde, 0x2b, 0x02, 0x35,
+  0xd5, 0xd5, 0x86, 0xfe, 0x2b, 0x02, 0x35, 0xd5, 0xd5, 0xb4, 0xff, 0xff,
+  0xfe, 0xfd, 0xb4, 0x00, 0xde, 0x2b, 0x02, 0x20, 0xd5, 0xa4, 0x66, 0x3f,
+  0x5c, 0x02, 0x20, 0xd5, 0xa4, 0x74, 0xff, 0xff, 0x3f, 0x3e, 0x74, 0x00,
+  0xde, 0x01, 0x02, 0x9a, 0xff, 0xb3, 0x0c, 0xc0, 0x4d, 0x02, 0x9a, 0xff,
+  0xb3, 0xbc, 0xff, 0xff, 0xc0, 0xbf, 0xbc, 0x00, 0xde, 0x01, 0x02, 0x96,
+  0xff, 0x36, 0x91, 0x02, 0xca, 0x02, 0x96, 0xff, 0x36, 0x31, 0xff, 0xff,
+  0x02, 0x01, 0x31, 0x00, 0xdf, 0x00, 0x03, 0xb0, 0x00, 0x72, 0xb8, 0x0f,
+  0x8e, 0x02, 0xb0, 0x00, 0x72, 0xb9, 0xff, 0xff, 0x0f, 0x0e, 0xb9, 0x00,
+  0xdf, 0x00, 0x03, 0x4a, 0x00, 0x08, 0xd5, 0x00, 0xf8, 0x02, 0x4a, 0x00,
+  0x08, 0x74, 0xff, 0xff, 0x00, 0xff, 0x74, 0x00, 0xdf, 0xff, 0x02, 0x6e,
+  0x01, 0xe3, 0xb1, 0x81, 0x1d, 0x02, 0x6e, 0x01, 0xe3, 0xb0, 0xff, 0xff,
+  0x81, 0x80, 0xb0, 0x00, 0xdf, 0xff, 0x02, 0xce, 0x01, 0xda, 0x9d, 0x80,
+  0x26, 0x02, 0xce, 0x01, 0xda, 0x3d, 0xff, 0xff, 0x80, 0x7f, 0x3d, 0x00,
+  0xdf, 0x81, 0x02, 0x02, 0x7f, 0x55, 0x86, 0x7f, 0xab, 0x02, 0x02, 0x7f,
+  0x55, 0xb4, 0xff, 0xff, 0x7f, 0x7e, 0xb4, 0x00, 0xdf, 0x81, 0x02, 0x62,
+  0x7f, 0xcf, 0x6f, 0xaa, 0x31, 0x02, 0x62, 0x7f, 0xcf, 0xfc, 0xff, 0xff,
+  0xaa, 0xa9, 0xfc, 0x00, 0xdf, 0x2b, 0x02, 0x47, 0xd5, 0x9c, 0x7a, 0x01,
+  0x64, 0x02, 0x47, 0xd5, 0x9c, 0x79, 0xff, 0xff, 0x01, 0x00, 0x79, 0x00,
+  0xdf, 0x2b, 0x02, 0x6d, 0xd5, 0x5d, 0x30, 0x0f, 0xa3, 0x02, 0x6d, 0xd5,
+  0x5d, 0x31, 0xff, 0xff, 0x0f, 0x0e, 0x31, 0x00, 0xdf, 0x01, 0x02, 0xbd,
+  0xff, 0xa3, 0x35, 0x18, 0x5d, 0x02, 0xbd, 0xff, 0xa3, 0xb5, 0xff, 0xff,
+  0x18, 0x17, 0xb5, 0x00, 0xdf, 0x01, 0x02, 0xc4, 0xff, 0xd0, 0x0a, 0x40,
+  0x30, 0x02, 0xc4, 0xff, 0xd0, 0xb9, 0xff, 0xff, 0x40, 0x3f, 0xb9, 0x00,
+  0xe0, 0x00, 0x48, 0x00, 0x00, 0xc7, 0xcb, 0x26, 0x00, 0x03, 0x00, 0x00,
+  0xc7, 0x7b, 0xff, 0xfe, 0x26, 0x26, 0x00, 0x00, 0xe0, 0x01, 0x48, 0x00,
+  0x00, 0xb9, 0xaf, 0x87, 0x00, 0x03, 0x00, 0x00, 0xb9, 0xbc, 0xff, 0xfe,
+  0x87, 0x87, 0x00, 0x00, 0xe0, 0x0f, 0x48, 0x00, 0x00, 0x58, 0xa8, 0xc8,
+  0x00, 0x03, 0x00, 0x00, 0x58, 0xb8, 0xff, 0xfe, 0xc8, 0xc8, 0x00, 0x00,
+  0xe0, 0x3f, 0x48, 0x00, 0x00, 0xbe, 0xb9, 0xc1, 0x00, 0x03, 0x00, 0x00,
+  0xbe, 0xb8, 0xff, 0xfe, 0xc1, 0xc1, 0x00, 0x00, 0xe0, 0x40, 0x48, 0x00,
+  0x00, 0x78, 0xb9, 0xf8, 0x00, 0x03, 0x00, 0x00, 0x78, 0xb8, 0xff, 0xfe,
+  0xf8, 0xf8, 0x00, 0x00, 0xe0, 0x7f, 0x48, 0x00, 0x00, 0x5e, 0x1d, 0x89,
+  0x00, 0x03, 0x00, 0x00, 0x5e, 0xbc, 0xff, 0xfe, 0x89, 0x89, 0x00, 0x00,
+  0xe0, 0x80, 0x48, 0x00, 0x00, 0xe4, 0xc0, 0x58, 0x00, 0x03, 0x00, 0x00,
+  0xe4, 0xf0, 0xff, 0xfe, 0x58, 0x58, 0x00, 0x00, 0xe0, 0x81, 0x48, 0x00,
+  0x00, 0x9b, 0x71, 0xfb, 0x00, 0x03, 0x00, 0x00, 0x9b, 0x70, 0xff, 0xfe,
+  0xfb, 0xfb, 0x00, 0x00, 0xe0, 0xfe, 0x48, 0x00, 0x00, 0x64, 0x41, 0x7a,
+  0x00, 0x03, 0x00, 0x00, 0x64, 0x70, 0xff, 0xfe, 0x7a, 0x7a, 0x00, 0x00,
+  0xe0, 0xff, 0x48, 0x00, 0x00, 0xca, 0x6a, 0x64, 0x00, 0x03, 0x00, 0x00,
+  0xca, 0x78, 0xff, 0xfe, 0x64, 0x64, 0x00, 0x00, 0xe0, 0x00, 0x48, 0x01,
+  0x01, 0x97, 0x86, 0x41, 0x00, 0x03, 0x01, 0x01, 0x97, 0x35, 0xff, 0xfe,
+  0x41, 0x41, 0x01, 0x00, 0xe0, 0x01, 0x48, 0x01, 0x01, 0x6b, 0x4b, 0x83,
+  0x00, 0x03, 0x01, 0x01, 0x6b, 0x7b, 0xff, 0xfe, 0x83, 0x83, 0x01, 0x00,
+  0xe0, 0x0f, 0x48, 0x01, 0x01, 0x1c, 0x11, 0x3a, 0x00, 0x03, 0x01, 0x01,
+  0x1c, 0xb0, 0xff, 0xfe, 0x3a, 0x3a, 0x01, 0x00, 0xe0, 0x3f, 0x48, 0x01,
+  0x01, 0xf7, 0xe8, 0x25, 0x00, 0x03, 0x01, 0x01, 0xf7, 0xf8, 0xff, 0xfe,
+  0x25, 0x25, 0x01, 0x00, 0xe0, 0x40, 0x48, 0x01, 0x01, 0xa1, 0x42, 0x19,
+  0x00, 0x03, 0x01, 0x01, 0xa1, 0xf0, 0xff, 0xfe, 0x19, 0x19, 0x01, 0x00,
+  0xe0, 0x7f, 0x48, 0x01, 0x01, 0xf4, 0x69, 0xfc, 0x00, 0x03, 0x01, 0x01,
+  0xf4, 0xf8, 0xff, 0xfe, 0xfc, 0xfc, 0x01, 0x00, 0xe0, 0x80, 0x48, 0x01,
+  0x01, 0xa9, 0xa9, 0x47, 0x00, 0x03, 0x01, 0x01, 0xa9, 0xb8, 0xff, 0xfe,
+  0x47, 0x47, 0x01, 0x00, 0xe0, 0x81, 0x48, 0x01, 0x01, 0x5d, 0x7e, 0xef,
+  0x00, 0x03, 0x01, 0x01, 0x5d, 0xfc, 0xff, 0xfe, 0xef, 0xef, 0x01, 0x00,
+  0xe0, 0xfe, 0x48, 0x01, 0x01, 0x9b, 0x07, 0x90, 0x00, 0x03, 0x01, 0x01,
+  0x9b, 0x34, 0xff, 0xfe, 0x90, 0x90, 0x01, 0x00, 0xe0, 0xff, 0x48, 0x01,
+  0x01, 0x3f, 0xc5, 0x71, 0x00, 0x03, 0x01, 0x01, 0x3f, 0x74, 0xff, 0xfe,
+  0x71, 0x71, 0x01, 0x00, 0xe0, 0x00, 0x48, 0x0f, 0x0f, 0x4f, 0x91, 0x4e,
+  0x00, 0x03, 0x0f, 0x0f, 0x4f, 0x31, 0xff, 0xfe, 0x4e, 0x4e, 0x0f, 0x00,
+  0xe0, 0x01, 0x48, 0x0f, 0x0f, 0x6b, 0xd2, 0xf5, 0x00, 0x03, 0x0f, 0x0f,
+  0x6b, 0x71, 0xff, 0xfe, 0xf5, 0xf5, 0x0f, 0x00, 0xe0, 0x0f, 0x48, 0x0f,
+  0x0f, 0xce, 0xa7, 0x50, 0x00, 0x03, 0x0f, 0x0f, 0xce, 0x37, 0xff, 0xfe,
+  0x50, 0x50, 0x0f, 0x00, 0xe0, 0x3f, 0x48, 0x0f, 0x0f, 0x2d, 0x31, 0x72,
+  0x00, 0x03, 0x0f, 0x0f, 0x2d, 0xb0, 0xff, 0xfe, 0x72, 0x72, 0x0f, 0x00,
+  0xe0, 0x40, 0x48, 0x0f, 0x0f, 0xf5, 0xa6, 0xa6, 0x00, 0x03, 0x0f, 0x0f,
+  0xf5, 0xb4, 0xff, 0xfe, 0xa6, 0xa6, 0x0f, 0x00, 0xe0, 0x7f, 0x48, 0x0f,
+  0x0f, 0x9e, 0x9a, 0xf2, 0x00, 0x03, 0x0f, 0x0f, 0x9e, 0xb8, 0xff, 0xfe,
+  0xf2, 0xf2, 0x0f, 0x00, 0xe0, 0x80, 0x48, 0x0f, 0x0f, 0xe5, 0x80, 0x35,
+  0x00, 0x03, 0x0f, 0x0f, 0xe5, 0xb0, 0xff, 0xfe, 0x35, 0x35, 0x0f, 0x00,
+  0xe0, 0x81, 0x48, 0x0f, 0x0f, 0x02, 0xde, 0xe6, 0x00, 0x03, 0x0f, 0x0f,
+  0x02, 0xfc, 0xff, 0xfe, 0xe6, 0xe6, 0x0f, 0x00, 0xe0, 0xfe, 0x48, 0x0f,
+  0x0f, 0x1f, 0xf6, 0x72, 0x00, 0x03, 0x0f, 0x0f, 0x1f, 0x74, 0xff, 0xfe,
+  0x72, 0x72, 0x0f, 0x00, 0xe0, 0xff, 0x48, 0x0f, 0x0f, 0xbc, 0xc0, 0x4f,
+  0x00, 0x03, 0x0f, 0x0f, 0xbc, 0x70, 0xff, 0xfe, 0x4f, 0x4f, 0x0f, 0x00,
+  0xe0, 0x00, 0x48, 0x3f, 0x3f, 0x50, 0x36, 0x33, 0x00, 0x03, 0x3f, 0x3f,
+  0x50, 0x35, 0xff, 0xfe, 0x33, 0x33, 0x3f, 0x00, 0xe0, 0x01, 0x48, 0x3f,
+  0x3f, 0xbd, 0x47, 0x05, 0x00, 0x03, 0x3f, 0x3f, 0xbd, 0x75, 0xff, 0xfe,
+  0x05, 0x05, 0x3f, 0x00, 0xe0, 0x0f, 0x48, 0x3f, 0x3f, 0xd2, 0x57, 0xe3,
+  0x00, 0x03, 0x3f, 0x3f, 0xd2, 0x75, 0xff, 0xfe, 0xe3, 0xe3, 0x3f, 0x00,
+  0xe0, 0x3f, 0x48, 0x3f, 0x3f, 0x1a, 0xe7, 0xfd, 0x00, 0x03, 0x3f, 0x3f,
+  0x1a, 0x77, 0xff, 0xfe, 0xfd, 0xfd, 0x3f, 0x00, 0xe0, 0x40, 0x48, 0x3f,
+  0x3f, 0x08, 0x92, 0x41, 0x00, 0x03, 0x3f, 0x3f, 0x08, 0xb0, 0xff, 0xfe,
+  0x41, 0x41, 0x3f, 0x00, 0xe0, 0x7f, 0x48, 0x3f, 0x3f, 0x3a, 0x66, 0x7c,
+  0x00, 0x03, 0x3f, 0x3f, 0x3a, 0xf4, 0xff, 0xfe, 0x7c, 0x7c, 0x3f, 0x00,
+  0xe0, 0x80, 0x48, 0x3f, 0x3f, 0xf0, 0x52, 0x0e, 0x00, 0x03, 0x3f, 0x3f,
+  0xf0, 0xf0, 0xff, 0xfe, 0x0e, 0x0e, 0x3f, 0x00, 0xe0, 0x81, 0x48, 0x3f,
+  0x3f, 0xdc, 0x77, 0x9f, 0x00, 0x03, 0x3f, 0x3f, 0xdc, 0xf4, 0xff, 0xfe,
+  0x9f, 0x9f, 0x3f, 0x00, 0xe0, 0xfe, 0x48, 0x3f, 0x3f, 0x73, 0x1f, 0x3e,
+  0x00, 0x03, 0x3f, 0x3f, 0x73, 0x3c, 0xff, 0xfe, 0x3e, 0x3e, 0x3f, 0x00,
+  0xe0, 0xff, 0x48, 0x3f, 0x3f, 0x52, 0x1e, 0x81, 0x00, 0x03, 0x3f, 0x3f,
+  0x52, 0x3c, 0xff, 0xfe, 0x81, 0x81, 0x3f, 0x00, 0xe0, 0x00, 0x48, 0x40,
+  0x40, 0xda, 0xab, 0xd1, 0x00, 0x03, 0x40, 0x40, 0xda, 0x39, 0xff, 0xfe,
+  0xd1, 0xd1, 0x40, 0x00, 0xe0, 0x01, 0x48, 0x40, 0x40, 0x25, 0x91, 0x68,
+  0x00, 0x03, 0x40, 0x40, 0x25, 0x31, 0xff, 0xfe, 0x68, 0x68, 0x40, 0x00,
+  0xe0, 0x0f, 0x48, 0x40, 0x40, 0x42, 0x2e, 0x19, 0x00, 0x03, 0x40, 0x40,
+  0x42, 0x3d, 0xff, 0xfe, 0x19, 0x19, 0x40, 0x00, 0xe0, 0x3f, 0x48, 0x40,
+  0x40, 0x0e, 0xbb, 0xda, 0x00, 0x03, 0x40, 0x40, 0x0e, 0x39, 0xff, 0xfe,
+  0xda, 0xda, 0x40, 0x00, 0xe0, 0x40, 0x48, 0x40, 0x40, 0x3a, 0x68, 0xff,
+  0x00, 0x03, 0x40, 0x40, 0x3a, 0x7b, 0xff, 0xfe, 0xff, 0xff, 0x40, 0x00,
+  0xe0, 0x7f, 0x48, 0x40, 0x40, 0x55, 0x45, 0x96, 0x00, 0x03, 0x40, 0x40,
+  0x55, 0xf4, 0xff, 0xfe, 0x96, 0x96, 0x40, 0x00, 0xe0, 0x80, 0x48, 0x40,
+  0x40, 0xc7, 0xc1, 0x00, 0x00, 0x03, 0x40, 0x40, 0xc7, 0xf0, 0xff, 0xfe,
+  0x00, 0x00, 0x40, 0x00, 0xe0, 0x81, 0x48, 0x40, 0x40, 0x84, 0x4b, 0x85,
+  0x00, 0x03, 0x40, 0x40, 0x84, 0xf8, 0xff, 0xfe, 0x85, 0x85, 0x40, 0x00,
+  0xe0, 0xfe, 0x48, 0x40, 0x40, 0x98, 0x4f, 0x2c, 0x00, 0x03, 0x40, 0x40,
+  0x98, 0x7c, 0xff, 0xfe, 0x2c, 0x2c, 0x40, 0x00, 0xe0, 0xff, 0x48, 0x40,
+  0x40, 0xb9, 0x09, 0x42, 0x00, 0x03, 0x40, 0x40, 0xb9, 0x38, 0xff, 0xfe,
+  0x42, 0x42, 0x40, 0x00, 0xe0, 0x00, 0x48, 0x7f, 0x7f, 0x0e, 0xbc, 0x07,
+  0x00, 0x03, 0x7f, 0x7f, 0x0e, 0x3d, 0xff, 0xfe, 0x07, 0x07, 0x7f, 0x00,
+  0xe0, 0x01, 0x48, 0x7f, 0x7f, 0xea, 0x70, 0x0e, 0x00, 0x03, 0x7f, 0x7f,
+  0xea, 0x71, 0xff, 0xfe, 0x0e, 0x0e, 0x7f, 0x00, 0xe0, 0x0f, 0x48, 0x7f,
+  0x7f, 0x55, 0x4c, 0xde, 0x00, 0x03, 0x7f, 0x7f, 0x55, 0x7d, 0xff, 0xfe,
+  0xde, 0xde, 0x7f, 0x00, 0xe0, 0x3f, 0x48, 0x7f, 0x7f, 0xc8, 0xeb, 0xf2,
+  0x00, 0x03, 0x7f, 0x7f, 0xc8, 0x79, 0xff, 0xfe, 0xf2, 0xf2, 0x7f, 0x00,
+  0xe0, 0x40, 0x48, 0x7f, 0x7f, 0x91, 0x34, 0x3b, 0x00, 0x03, 0x7f, 0x7f,
+  0x91, 0x35, 0xff, 0xfe, 0x3b, 0x3b, 0x7f, 0x00, 0xe0, 0x7f, 0x48, 0x7f,
+  0x7f, 0xbe, 0x1c, 0xd3, 0x00, 0x03, 0x7f, 0x7f, 0xbe, 0x3f, 0xff, 0xfe,
+  0xd3, 0xd3, 0x7f, 0x00, 0xe0, 0x80, 0x48, 0x7f, 0x7f, 0x7d, 0x01, 0x04,
+  0x00, 0x03, 0x7f, 0x7f, 0x7d, 0xb0, 0xff, 0xfe, 0x04, 0x04, 0x7f, 0x00,
+  0xe0, 0x81, 0x48, 0x7f, 0x7f, 0x15, 0x69, 0xfc, 0x00, 0x03, 0x7f, 0x7f,
+  0x15, 0xf8, 0xff, 0xfe, 0xfc, 0xfc, 0x7f, 0x00, 0xe0, 0xfe, 0x48, 0x7f,
+  0x7f, 0x43, 0x67, 0x73, 0x00, 0x03, 0x7f, 0x7f, 0x43, 0xf4, 0xff, 0xfe,
+  0x73, 0x73, 0x7f, 0x00, 0xe0, 0xff, 0x48, 0x7f, 0x7f, 0x09, 0xe3, 0x15,
+  0x00, 0x03, 0x7f, 0x7f, 0x09, 0xf0, 0xff, 0xfe, 0x15, 0x15, 0x7f, 0x00,
+  0xe0, 0x00, 0x48, 0x80, 0x80, 0xee, 0xd3, 0xbc, 0x00, 0x03, 0x80, 0x80,
+  0xee, 0xf1, 0xff, 0xfe, 0xbc, 0xbc, 0x80, 0x00, 0xe0, 0x01, 0x48, 0x80,
+  0x80, 0xca, 0xe9, 0x74, 0x00, 0x03, 0x80, 0x80, 0xca, 0x79, 0xff, 0xfe,
+  0x74, 0x74, 0x80, 0x00, 0xe0, 0x0f, 0x48, 0x80, 0x80, 0x08, 0x92, 0x00,
+  0x00, 0x03, 0x80, 0x80, 0x08, 0x31, 0xff, 0xfe, 0x00, 0x00, 0x80, 0x00,
+  0xe0, 0x3f, 0x48, 0x80, 0x80, 0x5e, 0x40, 0xf1, 0x00, 0x03, 0x80, 0x80,
+  0x5e, 0x71, 0xff, 0xfe, 0xf1, 0xf1, 0x80, 0x00, 0xe0, 0x40, 0x48, 0x80,
+  0x80, 0xaf, 0x1d, 0x3f, 0x00, 0x03, 0x80, 0x80, 0xaf, 0x3d, 0xff, 0xfe,
+  0x3f, 0x3f, 0x80, 0x00, 0xe0, 0x7f, 0x48, 0x80, 0x80, 0x13, 0xba, 0x38,
+  0x00, 0x03, 0x80, 0x80, 0x13, 0x39, 0xff, 0xfe, 0x38, 0x38, 0x80, 0x00,
+  0xe0, 0x80, 0x48, 0x80, 0x80, 0x5d, 0x9d, 0x4c, 0x00, 0x03, 0x80, 0x80,
+  0x5d, 0x3f, 0xff, 0xfe, 0x4c, 0x4c, 0x80, 0x00, 0xe0, 0x81, 0x48, 0x80,
+  0x80, 0x1f, 0x87, 0x62, 0x00, 0x03, 0x80, 0x80, 0x1f, 0xb4, 0xff, 0xfe,
+  0x62, 0x62, 0x80, 0x00, 0xe0, 0xfe, 0x48, 0x80, 0x80, 0x4a, 0x8c, 0x74,
+  0x00, 0x03, 0x80, 0x80, 0x4a, 0xbc, 0xff, 0xfe, 0x74, 0x74, 0x80, 0x00,
+  0xe0, 0xff, 0x48, 0x80, 0x80, 0xb1, 0x65, 0x79, 0x00, 0x03, 0x80, 0x80,
+  0xb1, 0xf4, 0xff, 0xfe, 0x79, 0x79, 0x80, 0x00, 0xe0, 0x00, 0x48, 0x81,
+  0x81, 0xc3, 0xe7, 0x9b, 0x00, 0x03, 0x81, 0x81, 0xc3, 0xf5, 0xff, 0xfe,
+  0x9b, 0x9b, 0x81, 0x00, 0xe0, 0x01, 0x48, 0x81, 0x81, 0x56, 0xf3, 0x51,
+  0x00, 0x03, 0x81, 0x81, 0x56, 0xf1, 0xff, 0xfe, 0x51, 0x51, 0x81, 0x00,
+  0xe0, 0x0f, 0x48, 0x81, 0x81, 0x85, 0x83, 0x52, 0x00, 0x03, 0x81, 0x81,
+  0x85, 0x31, 0xff, 0xfe, 0x52, 0x52, 0x81, 0x00, 0xe0, 0x3f, 0x48, 0x81,
+  0x81, 0x2c, 0xce, 0x18, 0x00, 0x03, 0x81, 0x81, 0x2c, 0x7d, 0xff, 0xfe,
+  0x18, 0x18, 0x81, 0x00, 0xe0, 0x40, 0x48, 0x81, 0x81, 0xd0, 0xd6, 0xb1,
+  0x00, 0x03, 0x81, 0x81, 0xd0, 0x75, 0xff, 0xfe, 0xb1, 0xb1, 0x81, 0x00,
+  0xe0, 0x7f, 0x48, 0x81, 0x81, 0xd0, 0x8a, 0x8a, 0x00, 0x03, 0x81, 0x81,
+  0xd0, 0x39, 0xff, 0xfe, 0x8a, 0x8a, 0x81, 0x00, 0xe0, 0x80, 0x48, 0x81,
+  0x81, 0x9f, 0x05, 0xfd, 0x00, 0x03, 0x81, 0x81, 0x9f, 0x35, 0xff, 0xfe,
+  0xfd, 0xfd, 0x81, 0x00, 0xe0, 0x81, 0x48, 0x81, 0x81, 0x4a, 0x87, 0x78,
+  0x00, 0x03, 0x81, 0x81, 0x4a, 0x37, 0xff, 0xfe, 0x78, 0x78, 0x81, 0x00,
+  0xe0, 0xfe, 0x48, 0x81, 0x81, 0x97, 0xd3, 0x20, 0x00, 0x03, 0x81, 0x81,
+  0x97, 0xf0, 0xff, 0xfe, 0x20, 0x20, 0x81, 0x00, 0xe0, 0xff, 0x48, 0x81,
+  0x81, 0xa5, 0x9f, 0x21, 0x00, 0x03, 0x81, 0x81, 0xa5, 0xbc, 0xff, 0xfe,
+  0x21, 0x21, 0x81, 0x00, 0xe0, 0x00, 0x48, 0xfe, 0xfe, 0x96, 0x86, 0xbf,
+  0x00, 0x03, 0xfe, 0xfe, 0x96, 0xb5, 0xff, 0xfe, 0xbf, 0xbf, 0xfe, 0x00,
+  0xe0, 0x01, 0x48, 0xfe, 0xfe, 0xa8, 0x4a, 0x64, 0x00, 0x03, 0xfe, 0xfe,
+  0xa8, 0xf9, 0xff, 0xfe, 0x64, 0x64, 0xfe, 0x00, 0xe0, 0x0f, 0x48, 0xfe,
+  0xfe, 0xe6, 0x75, 0x45, 0x00, 0x03, 0xfe, 0xfe, 0xe6, 0xf5, 0xff, 0xfe,
+  0x45, 0x45, 0xfe, 0x00, 0xe0, 0x3f, 0x48, 0xfe, 0xfe, 0x0c, 0x71, 0x05,
+  0x00, 0x03, 0xfe, 0xfe, 0x0c, 0xf1, 0xff, 0xfe, 0x05, 0x05, 0xfe, 0x00,
+  0xe0, 0x40, 0x48, 0xfe, 0xfe, 0x05, 0x5e, 0x0b, 0x00, 0x03, 0xfe, 0xfe,
+  0x05, 0xfd, 0xff, 0xfe, 0x0b, 0x0b, 0xfe, 0x00, 0xe0, 0x7f, 0x48, 0xfe,
+  0xfe, 0xec, 0x6c, 0xbb, 0x00, 0x03, 0xfe, 0xfe, 0xec, 0x7d, 0xff, 0xfe,
+  0xbb, 0xbb, 0xfe, 0x00, 0xe0, 0x80, 0x48, 0xfe, 0xfe, 0x4e, 0x25, 0x4d,
+  0x00, 0x03, 0xfe, 0xfe, 0x4e, 0x35, 0xff, 0xfe, 0x4d, 0x4d, 0xfe, 0x00,
+  0xe0, 0x81, 0x48, 0xfe, 0xfe, 0x42, 0x76, 0x9c, 0x00, 0x03, 0xfe, 0xfe,
+  0x42, 0x75, 0xff, 0xfe, 0x9c, 0x9c, 0xfe, 0x00, 0xe0, 0xfe, 0x48, 0xfe,
+  0xfe, 0xac, 0x93, 0xc6, 0x00, 0x03, 0xfe, 0xfe, 0xac, 0x33, 0xff, 0xfe,
+  0xc6, 0xc6, 0xfe, 0x00, 0xe0, 0xff, 0x48, 0xfe, 0xfe, 0x23, 0x5e, 0xb3,
+  0x00, 0x03, 0xfe, 0xfe, 0x23, 0xfc, 0xff, 0xfe, 0xb3, 0xb3, 0xfe, 0x00,
+  0xe0, 0x00, 0x48, 0xff, 0xff, 0x89, 0x87, 0x33, 0x00, 0x03, 0xff, 0xff,
+  0x89, 0xb5, 0xff, 0xfe, 0x33, 0x33, 0xff, 0x00, 0xe0, 0x01, 0x48, 0xff,
+  0xff, 0x33, 0x4a, 0xbc, 0x00, 0x03, 0xff, 0xff, 0x33, 0xf9, 0xff, 0xfe,
+  0xbc, 0xbc, 0xff, 0x00, 0xe0, 0x0f, 0x48, 0xff, 0xff, 0x88, 0xf1, 0x99,
+  0x00, 0x03, 0xff, 0xff, 0x88, 0xf1, 0xff, 0xfe, 0x99, 0x99, 0xff, 0x00,
+  0xe0, 0x3f, 0x48, 0xff, 0xff, 0x59, 0xc5, 0xe5, 0x00, 0x03, 0xff, 0xff,
+  0x59, 0xf5, 0xff, 0xfe, 0xe5, 0xe5, 0xff, 0x00, 0xe0, 0x40, 0x48, 0xff,
+  0xff, 0x5d, 0x80, 0xb2, 0x00, 0x03, 0xff, 0xff, 0x5d, 0xb1, 0xff, 0xfe,
+  0xb2, 0xb2, 0xff, 0x00, 0xe0, 0x7f, 0x48, 0xff, 0xff, 0xd8, 0xf9, 0x56,
+  0x00, 0x03, 0xff, 0xff, 0xd8, 0xf9, 0xff, 0xfe, 0x56, 0x56, 0xff, 0x00,
+  0xe0, 0x80, 0x48, 0xff, 0xff, 0xa1, 0x58, 0x56, 0x00, 0x03, 0xff, 0xff,
+  0xa1, 0x79, 0xff, 0xfe, 0x56, 0x56, 0xff, 0x00, 0xe0, 0x81, 0x48, 0xff,
+  0xff, 0x3b, 0xc0, 0xb1, 0x00, 0x03, 0xff, 0xff, 0x3b, 0x71, 0xff, 0xfe,
+  0xb1, 0xb1, 0xff, 0x00, 0xe0, 0xfe, 0x48, 0xff, 0xff, 0x1b, 0x57, 0xfc,
+  0x00, 0x03, 0xff, 0xff, 0x1b, 0x75, 0xff, 0xfe, 0xfc, 0xfc, 0xff, 0x00,
+  0xe0, 0xff, 0x48, 0xff, 0xff, 0xae, 0x5c, 0xcc, 0x00, 0x03, 0xff, 0xff,
+  0xae, 0x7f, 0xff, 0xfe, 0xcc, 0xcc, 0xff, 0x00, 0xe1, 0x40, 0x48, 0xde,
+  0x00, 0x5c, 0x95, 0xfe, 0xa4, 0x02, 0xe0, 0x00, 0x5c, 0xb4, 0xff, 0xfe,
+  0xfe, 0xfe, 0xe0, 0x00, 0xe1, 0x40, 0x48, 0x2e, 0x00, 0x18, 0x61, 0x41,
+  0xe8, 0x02, 0xed, 0x00, 0x18, 0xb0, 0xff, 0xfe, 0x41, 0x41, 0xed, 0x00,
+  0xe1, 0x3f, 0x48, 0x4e, 0x01, 0x8b, 0xb5, 0x0f, 0x75, 0x02, 0x3f, 0x01,
+  0x8b, 0x35, 0xff, 0xfe, 0x0f, 0x0f, 0x3f, 0x00, 0xe1, 0x3f, 0x48, 0x2f,
+  0x01, 0x60, 0x33, 0xff, 0xa0, 0x02, 0x30, 0x01, 0x60, 0x30, 0xff, 0xfe,
+  0xff, 0xff, 0x30, 0x00, 0xe1, 0xc1, 0x48, 0x7d, 0x7f, 0x59, 0x81, 0x01,
+  0xa7, 0x02, 0x7c, 0x7f, 0x59, 0x31, 0xff, 0xfe, 0x01, 0x01, 0x7c, 0x00,
+  0xe1, 0xc1, 0x48, 0x90, 0x7f, 0x8e, 0xd2, 0xc0, 0x72, 0x02, 0xcf, 0x7f,
+  0x8e, 0xb0, 0xff, 0xfe, 0xc0, 0xc0, 0xcf, 0x00, 0xe1, 0x6b, 0x48, 0x9c,
+  0xd5, 0x92, 0x62, 0x41, 0x6e, 0x02, 0x5a, 0xd5, 0x92, 0x71, 0xff, 0xfe,
+  0x41, 0x41, 0x5a, 0x00, 0xe1, 0x6b, 0x48, 0x22, 0xd5, 0xd5, 0xe0, 0x81,
+  0x2b, 0x02, 0xa0, 0xd5, 0xd5, 0xf0, 0xff, 0xfe, 0x81, 0x81, 0xa0, 0x00,
+  0xe1, 0x41, 0x48, 0xa0, 0xff, 0xe7, 0x82, 0x01, 0x19, 0x02, 0x9e, 0xff,
+  0xe7, 0xb1, 0xff, 0xfe, 0x01, 0x01, 0x9e, 0x00, 0xe1, 0x41, 0x48, 0xeb,
+  0xff, 0x08, 0xc1, 0xff, 0xf8, 0x02, 0xec, 0xff, 0x08, 0xb0, 0xff, 0xfe,
+  0xff, 0xff, 0xec, 0x00, 0xe2, 0x80, 0x48, 0xe9, 0xa5, 0x2c, 0x94, 0x80,
+  0xd4, 0x02, 0xe9, 0xa5, 0x2c, 0xb4, 0xff, 0xfe, 0x80, 0x80, 0xe9, 0x00,
+  0xe2, 0x01, 0x48, 0x6a, 0xd7, 0x9d, 0x86, 0x01, 0x63, 0x02, 0x6a, 0xd7,
+  0x9d, 0xb6, 0xff, 0xfe, 0x01, 0x01, 0x6a, 0x00, 0xe2, 0x0f, 0x48, 0xb7,
+  0x4a, 0xbe, 0x74, 0x0f, 0x42, 0x02, 0xb7, 0x4a, 0xbe, 0x74, 0xff, 0xfe,
+  0x0f, 0x0f, 0xb7, 0x00, 0xe2, 0x00, 0x48, 0xb7, 0xe9, 0x7b, 0x38, 0x00,
+  0x85, 0x02, 0xb7, 0xe9, 0x7b, 0x38, 0xff, 0xfe, 0x00, 0x00, 0xb7, 0x00,
+  0xe3, 0x40, 0x48, 0xb0, 0x00, 0x78, 0xc4, 0xfe, 0x88, 0x02, 0xb0, 0x00,
+  0x78, 0xb4, 0xff, 0xfe, 0xfe, 0xff, 0xb0, 0x00, 0xe3, 0x40, 0x48, 0xbd,
+  0x00, 0xfe, 0x92, 0xff, 0x02, 0x02, 0xbc, 0x00, 0xfe, 0xb1, 0xff, 0xfe,
+  0xff, 0x00, 0xbc, 0x00, 0xe3, 0x3f, 0x48, 0xb8, 0x01, 0xe9, 0x00, 0x7f,
+  0x17, 0x02, 0x37, 0x01, 0xe9, 0x31, 0xff, 0xfe, 0x7f, 0x80, 0x37, 0x00,
+  0xe3, 0x3f, 0x48, 0xac, 0x01, 0x3e, 0x16, 0x01, 0xc2, 0x02, 0xa9, 0x01,
+  0x3e, 0xb5, 0xff, 0xfe, 0x01, 0x02, 0xa9, 0x00, 0xe3, 0xc1, 0x48, 0x21,
+  0x7f, 0x6e, 0x72, 0x3f, 0x92, 0x02, 0xe0, 0x7f, 0x6e, 0xb0, 0xff, 0xfe,
+  0x3f, 0x40, 0xe0, 0x00, 0xe3, 0xc1, 0x48, 0x60, 0x7f, 0x26, 0x20, 0xc0,
+  0xda, 0x02, 0x9e, 0x7f, 0x26, 0xf0, 0xff, 0xfe, 0xc0, 0xc1, 0x9e, 0x00,
+  0xe3, 0x6b, 0x48, 0x51, 0xd5, 0xe9, 0xc4, 0x02, 0x17, 0x02, 0x4d, 0xd5,
+  0xe9, 0x35, 0xff, 0xfe, 0x02, 0x03, 0x4d, 0x00, 0xe3, 0x6b, 0x48, 0x1e,
+  0xd5, 0x84, 0xa6, 0x3f, 0x7c, 0x02, 0xdd, 0xd5, 0x84, 0xb4, 0xff, 0xfe,
+  0x3f, 0x40, 0xdd, 0x00, 0xe3, 0x41, 0x48, 0x00, 0xff, 0x3a, 0x67, 0x41,
+  0xc6, 0x02, 0xbe, 0xff, 0x3a, 0xb4, 0xff, 0xfe, 0x41, 0x42, 0xbe, 0x00,
+  0xe3, 0x41, 0x48, 0xca, 0xff, 0xa2, 0xf3, 0xff, 0x5e, 0x02, 0xca, 0xff,
+  0xa2, 0xb1, 0xff, 0xfe, 0xff, 0x00, 0xca, 0x00, 0xe4, 0x30, 0x48, 0x78,
+  0x16, 0xa8, 0xe3, 0xff, 0x58, 0x02, 0x78, 0x16, 0xa8, 0x70, 0xff, 0xfe,
+  0xff, 0xff, 0x78, 0x00, 0xe4, 0x30, 0x48, 0x11, 0xf3, 0x22, 0x13, 0x80,
+  0xde, 0x02, 0x11, 0xf3, 0x22, 0x31, 0xff, 0xfe, 0x80, 0x80, 0x11, 0x00,
+  0xe4, 0x30, 0x48, 0x71, 0xfe, 0xcc, 0xc0, 0x80, 0x34, 0x02, 0x71, 0xfe,
+  0xcc, 0x71, 0xff, 0xfe, 0x80, 0x80, 0x71, 0x00, 0xe4, 0x30, 0x48, 0x4c,
+  0x7b, 0xfa, 0x12, 0x80, 0x06, 0x02, 0x4c, 0x7b, 0xfa, 0xb0, 0xff, 0xfe,
+  0x80, 0x80, 0x4c, 0x00, 0xe4, 0x30, 0x48, 0xc0, 0xcb, 0x3f, 0x9d, 0x3f,
+  0xc1, 0x02, 0xc0, 0xcb, 0x3f, 0xbd, 0xff, 0xfe, 0x3f, 0x3f, 0xc0, 0x00,
+  0xe4, 0x30, 0x48, 0xab, 0xcb, 0xa1, 0x95, 0x02, 0x5f, 0x02, 0xab, 0xcb,
+  0xa1, 0xb5, 0xff, 0xfe, 0x02, 0x02, 0xab, 0x00, 0xe5, 0x30, 0x48, 0x0b,
+  0x98, 0xee, 0x97, 0x80, 0x12, 0x02, 0x8b, 0x98, 0xee, 0xf4, 0xff, 0xfe,
+  0x80, 0x80, 0x8b, 0x00, 0xe5, 0x30, 0x48, 0x56, 0x1f, 0xee, 0xe3, 0x3f,
+  0x12, 0x02, 0x17, 0x1f, 0xee, 0x31, 0xff, 0xfe, 0x3f, 0x3f, 0x17, 0x00,
+  0xe5, 0x30, 0x48, 0x46, 0xf7, 0xa5, 0xd6, 0x41, 0x5b, 0x02, 0x04, 0xf7,
+  0xa5, 0x35, 0xff, 0xfe, 0x41, 0x41, 0x04, 0x00, 0xe5, 0x30, 0x48, 0xf9,
+  0xd8, 0x00, 0x11, 0x0f, 0x00, 0x03, 0xea, 0xd8, 0x00, 0xb1, 0xff, 0xfe,
+  0x0f, 0x0f, 0xea, 0x00, 0xe5, 0x30, 0x48, 0x80, 0x3d, 0xd2, 0x44, 0x02,
+  0x2e, 0x02, 0x7d, 0x3d, 0xd2, 0x75, 0xff, 0xfe, 0x02, 0x02, 0x7d, 0x00,
+  0xe5, 0x30, 0x48, 0xe2, 0xae, 0xae, 0x52, 0x3f, 0x52, 0x02, 0xa2, 0xae,
+  0xae, 0xb1, 0xff, 0xfe, 0x3f, 0x3f, 0xa2, 0x00, 0xe6, 0x30, 0x48, 0x0d,
+  0x5e, 0xcc, 0x53, 0xc0, 0x34, 0x02, 0x0d, 0x5e, 0xcc, 0xf1, 0xff, 0xfe,
+  0xc1, 0xc0, 0x0d, 0x00, 0xe6, 0x30, 0x48, 0xef, 0xc8, 0x82, 0x6a, 0x3f,
+  0x7e, 0x02, 0xef, 0xc8, 0x82, 0x78, 0xff, 0xfe, 0x40, 0x3f, 0xef, 0x00,
+  0xe6, 0x30, 0x48, 0xe9, 0x9d, 0x61, 0x4d, 0x40, 0x9f, 0x02, 0xe9, 0x9d,
+  0x61, 0x7d, 0xff, 0xfe, 0x41, 0x40, 0xe9, 0x00, 0xe6, 0x30, 0x48, 0xd1,
+  0xbf, 0xe1, 0x84, 0x02, 0x1f, 0x02, 0xd1, 0xbf, 0xe1, 0x34, 0xff, 0xfe,
+  0x03, 0x02, 0xd1, 0x00, 0xe6, 0x30, 0x48, 0xff, 0xa8, 0x22, 0x41, 0x00,
+  0xde, 0x02, 0xff, 0xa8, 0x22, 0x71, 0xff, 0xfe, 0x01, 0x00, 0xff, 0x00,
+  0xe6, 0x30, 0x48, 0x89, 0x70, 0xb8, 0x02, 0x02, 0x48, 0x02, 0x89, 0x70,
+  0xb8, 0x30, 0xff, 0xfe, 0x03, 0x02, 0x89, 0x00, 0xe7, 0x30, 0x48, 0x4d,
+  0xd1, 0x83, 0x23, 0xfe, 0x7d, 0x02, 0x4e, 0xd1, 0x83, 0x30, 0xff, 0xfe,
+  0xff, 0xfe, 0x4e, 0x00, 0xe7, 0x30, 0x48, 0x3d, 0xf0, 0x5f, 0x93, 0x00,
+  0xa1, 0x02, 0x3c, 0xf0, 0x5f, 0x31, 0xff, 0xfe, 0x01, 0x00, 0x3c, 0x00,
+  0xe7, 0x30, 0x48, 0xb3, 0xa9, 0xe9, 0x01, 0xaa, 0x17, 0x02, 0x08, 0xa9,
+  0xe9, 0x31, 0xff, 0xfe, 0xab, 0xaa, 0x08, 0x00, 0xe7, 0x30, 0x48, 0x5a,
+  0x89, 0x54, 0xb6, 0x41, 0xac, 0x02, 0x17, 0x89, 0x54, 0x35, 0xff, 0xfe,
+  0x42, 0x41, 0x17, 0x00, 0xe7, 0x30, 0x48, 0xb6, 0x37, 0x41, 0xb6, 0x02,
+  0xbf, 0x02, 0xb2, 0x37, 0x41, 0xb5, 0xff, 0xfe, 0x03, 0x02, 0xb2, 0x00,
+  0xe7, 0x30, 0x48, 0x14, 0x47, 0x1f, 0xc0, 0x01, 0xe1, 0x02, 0x11, 0x47,
+  0x1f, 0x31, 0xff, 0xfe, 0x02, 0x01, 0x11, 0x00, 0xe8, 0x48, 0x48, 0x88,
+  0x1c, 0xf0, 0x98, 0x7f, 0x10, 0x02, 0x88, 0x1d, 0xf0, 0x38, 0xff, 0xfd,
+  0x7f, 0x7f, 0x88, 0x00, 0xe8, 0x48, 0x48, 0x78, 0x03, 0xfd, 0xb6, 0x41,
+  0x03, 0x02, 0x78, 0x04, 0xfd, 0x34, 0xff, 0xfd, 0x41, 0x41, 0x78, 0x00,
+  0xe8, 0x48, 0x48, 0xdf, 0x77, 0x6b, 0xf9, 0x3f, 0x95, 0x02, 0xdf, 0x78,
+  0x6b, 0x79, 0xff, 0xfd, 0x3f, 0x3f, 0xdf, 0x00, 0xe8, 0x48, 0x48, 0x70,
+  0x71, 0xb4, 0x05, 0x80, 0x4c, 0x02, 0x70, 0x72, 0xb4, 0x35, 0xff, 0xfd,
+  0x80, 0x80, 0x70, 0x00, 0xe8, 0x48, 0x48, 0x00, 0xff, 0x49, 0xd1, 0xff,
+  0xb7, 0x02, 0x00, 0x00, 0x49, 0x73, 0xff, 0xfd, 0xff, 0xff, 0x00, 0x00,
+  0xe8, 0x48, 0x48, 0x51, 0xbb, 0x30, 0x0e, 0x0f, 0xd0, 0x02, 0x51, 0xbc,
+  0x30, 0xbc, 0xff, 0xfd, 0x0f, 0x0f, 0x51, 0x00, 0xe9, 0x00, 0x48, 0x00,
+  0xbb, 0x45, 0xe5, 0xd3, 0x00, 0x03, 0x00, 0xbb, 0x45, 0x37, 0xff, 0xfe,
+  0xd3, 0xd3, 0x00, 0x00, 0xe9, 0x01, 0x48, 0x00, 0xf4, 0x92, 0xd0, 0x66,
+  0x00, 0x03, 0xfe, 0xf4, 0x92, 0xb0, 0xff, 0xfe, 0x66, 0x66, 0xfe, 0x00,
+  0xe9, 0x0f, 0x48, 0x00, 0xb4, 0x03, 0x11, 0xaa, 0x00, 0x03, 0xf1, 0xb4,
+  0x03, 0xb0, 0xff, 0xfe, 0xaa, 0xaa, 0xf1, 0x00, 0xe9, 0x3f, 0x48, 0x00,
+  0x02, 0xe4, 0xc0, 0x77, 0x00, 0x03, 0xc0, 0x02, 0xe4, 0xb0, 0xff, 0xfe,
+  0x77, 0x77, 0xc0, 0x00, 0xe9, 0x40, 0x48, 0x00, 0x01, 0x0a, 0xc7, 0x7d,
+  0x00, 0x03, 0xc0, 0x01, 0x0a, 0xb4, 0xff, 0xfe, 0x7d, 0x7d, 0xc0, 0x00,
+  0xe9, 0x7f, 0x48, 0x00, 0xfb, 0xcc, 0xd5, 0x11, 0x00, 0x03, 0x81, 0xfb,
+  0xcc, 0xb4, 0xff, 0xfe, 0x11, 0x11, 0x81, 0x00, 0xe9, 0x80, 0x48, 0x00,
+  0xd7, 0x46, 0x13, 0xc6, 0x00, 0x03, 0x80, 0xd7, 0x46, 0xf0, 0xff, 0xfe,
+  0xc6, 0xc6, 0x80, 0x00, 0xe9, 0x81, 0x48, 0x00, 0x75, 0xd3, 0x26, 0xc9,
+  0x00, 0x03, 0x7e, 0x75, 0xd3, 0x34, 0xff, 0xfe, 0xc9, 0xc9, 0x7e, 0x00,
+  0xe9, 0xfe, 0x48, 0x00, 0x26, 0xe8, 0x23, 0x2a, 0x00, 0x03, 0x02, 0x26,
+  0xe8, 0x30, 0xff, 0xfe, 0x2a, 0x2a, 0x02, 0x00, 0xe9, 0xff, 0x48, 0x00,
+  0xee, 0x89, 0x35, 0x7e, 0x00, 0x03, 0x01, 0xee, 0x89, 0x34, 0xff, 0xfe,
+  0x7e, 0x7e, 0x01, 0x00, 0xe9, 0x00, 0x48, 0x01, 0x32, 0x79, 0xe0, 0x1c,
+  0x00, 0x03, 0x00, 0x32, 0x79, 0x33, 0xff, 0xfe, 0x1c, 0x1c, 0x00, 0x00,
+  0xe9, 0x01, 0x48, 0x01, 0x0b, 0xfd, 0x74, 0x2e, 0x00, 0x03, 0xff, 0x0b,
+  0xfd, 0xb4, 0xff, 0xfe, 0x2e, 0x2e, 0xff, 0x00, 0xe9, 0x0f, 0x48, 0x01,
+  0xf6, 0x9b, 0x87, 0x27, 0x00, 0x03, 0xf2, 0xf6, 0x9b, 0xb4, 0xff, 0xfe,
+  0x27, 0x27, 0xf2, 0x00, 0xe9, 0x3f, 0x48, 0x01, 0x1a, 0x7d, 0xf1, 0xda,
+  0x00, 0x03, 0xc2, 0x1a, 0x7d, 0xb0, 0xff, 0xfe, 0xda, 0xda, 0xc2, 0x00,
+  0xe9, 0x40, 0x48, 0x01, 0x67, 0xfd, 0xc3, 0x63, 0x00, 0x03, 0xc1, 0x67,
+  0xfd, 0xb0, 0xff, 0xfe, 0x63, 0x63, 0xc1, 0x00, 0xe9, 0x7f, 0x48, 0x01,
+  0xc2, 0x0a, 0xd6, 0x04, 0x00, 0x03, 0x81, 0xc2, 0x0a, 0xb4, 0xff, 0xfe,
+  0x04, 0x04, 0x81, 0x00, 0xe9, 0x80, 0x48, 0x01, 0x75, 0xa0, 0x51, 0xb9,
+  0x00, 0x03, 0x81, 0x75, 0xa0, 0xf0, 0xff, 0xfe, 0xb9, 0xb9, 0x81, 0x00,
+  0xe9, 0x81, 0x48, 0x01, 0x07, 0x78, 0xa3, 0xfb, 0x00, 0x03, 0x80, 0x07,
+  0x78, 0xf0, 0xff, 0xfe, 0xfb, 0xfb, 0x80, 0x00, 0xe9, 0xfe, 0x48, 0x01,
+  0x44, 0xf5, 0x11, 0x51, 0x00, 0x03, 0x03, 0x44, 0xf5, 0x30, 0xff, 0xfe,
+  0x51, 0x51, 0x03, 0x00, 0xe9, 0xff, 0x48, 0x01, 0xe9, 0xae, 0x20, 0xb6,
+  0x00, 0x03, 0x01, 0xe9, 0xae, 0x30, 0xff, 0xfe, 0xb6, 0xb6, 0x01, 0x00,
+  0xe9, 0x00, 0x48, 0x0f, 0x2d, 0x80, 0xd0, 0x71, 0x00, 0x03, 0x0e, 0x2d,
+  0x80, 0x31, 0xff, 0xfe, 0x71, 0x71, 0x0e, 0x00, 0xe9, 0x01, 0x48, 0x0f,
+  0x8f, 0x50, 0x03, 0x90, 0x00, 0x03, 0x0e, 0x8f, 0x50, 0x31, 0xff, 0xfe,
+  0x90, 0x90, 0x0e, 0x00, 0xe9, 0x0f, 0x48, 0x0f, 0xdd, 0x68, 0xc4, 0xa7,
+  0x00, 0x03, 0xff, 0xdd, 0x68, 0xb4, 0xff, 0xfe, 0xa7, 0xa7, 0xff, 0x00,
+  0xe9, 0x3f, 0x48, 0x0f, 0xe8, 0x9f, 0x03, 0xbd, 0x00, 0x03, 0xd0, 0xe8,
+  0x9f, 0xb0, 0xff, 0xfe, 0xbd, 0xbd, 0xd0, 0x00, 0xe9, 0x40, 0x48, 0x0f,
+  0xbb, 0x93, 0xf1, 0x87, 0x00, 0x03, 0xcf, 0xbb, 0x93, 0xb0, 0xff, 0xfe,
+  0x87, 0x87, 0xcf, 0x00, 0xe9, 0x7f, 0x48, 0x0f, 0xa3, 0xfe, 0x36, 0x18,
+  0x00, 0x03, 0x8f, 0xa3, 0xfe, 0xb4, 0xff, 0xfe, 0x18, 0x18, 0x8f, 0x00,
+  0xe9, 0x80, 0x48, 0x0f, 0xb5, 0xb8, 0x52, 0x32, 0x00, 0x03, 0x8e, 0xb5,
+  0xb8, 0xf0, 0xff, 0xfe, 0x32, 0x32, 0x8e, 0x00, 0xe9, 0x81, 0x48, 0x0f,
+  0x2c, 0x3f, 0x33, 0xff, 0x00, 0x03, 0x8e, 0x2c, 0x3f, 0xf0, 0xff, 0xfe,
+  0xff, 0xff, 0x8e, 0x00, 0xe9, 0xfe, 0x48, 0x0f, 0xd4, 0xbf, 0x70, 0x49,
+  0x00, 0x03, 0x10, 0xd4, 0xbf, 0x30, 0xff, 0xfe, 0x49, 0x49, 0x10, 0x00,
+  0xe9, 0xff, 0x48, 0x0f, 0x84, 0x59, 0x75, 0xaf, 0x00, 0x03, 0x10, 0x84,
+  0x59, 0x34, 0xff, 0xfe, 0xaf, 0xaf, 0x10, 0x00, 0xe9, 0x00, 0x48, 0x3f,
+  0x13, 0xb5, 0xb1, 0xb9, 0x00, 0x03, 0x3f, 0x13, 0xb5, 0x31, 0xff, 0xfe,
+  0xb9, 0xb9, 0x3f, 0x00, 0xe9, 0x01, 0x48, 0x3f, 0x76, 0xe6, 0xe0, 0xef,
+  0x00, 0x03, 0x3d, 0x76, 0xe6, 0x31, 0xff, 0xfe, 0xef, 0xef, 0x3d, 0x00,
+  0xe9, 0x0f, 0x48, 0x3f, 0x20, 0x55, 0x00, 0x4f, 0x00, 0x03, 0x2f, 0x20,
+  0x55, 0x31, 0xff, 0xfe, 0x4f, 0x4f, 0x2f, 0x00, 0xe9, 0x3f, 0x48, 0x3f,
+  0x89, 0xd5, 0xa0, 0xe4, 0x00, 0x03, 0xff, 0x89, 0xd5, 0xb0, 0xff, 0xfe,
+  0xe4, 0xe4, 0xff, 0x00, 0xe9, 0x40, 0x48, 0x3f, 0xcd, 0xc8, 0x95, 0x20,
+  0x00, 0x03, 0xff, 0xcd, 0xc8, 0xb4, 0xff, 0xfe, 0x20, 0x20, 0xff, 0x00,
+  0xe9, 0x7f, 0x48, 0x3f, 0xf6, 0x2a, 0xc6, 0xe7, 0x00, 0x03, 0xbf, 0xf6,
+  0x2a, 0xb4, 0xff, 0xfe, 0xe7, 0xe7, 0xbf, 0x00, 0xe9, 0x80, 0x48, 0x3f,
+  0x7d, 0x0a, 0x40, 0x30, 0x00, 0x03, 0xbe, 0x7d, 0x0a, 0xf0, 0xff, 0xfe,
+  0x30, 0x30, 0xbe, 0x00, 0xe9, 0x81, 0x48, 0x3f, 0x81, 0xf5, 0xb3, 0x57,
+  0x00, 0x03, 0xbe, 0x81, 0xf5, 0xf0, 0xff, 0xfe, 0x57, 0x57, 0xbe, 0x00,
+  0xe9, 0xfe, 0x48, 0x3f, 0x62, 0xa0, 0xf1, 0x76, 0x00, 0x03, 0x41, 0x62,
+  0xa0, 0x30, 0xff, 0xfe, 0x76, 0x76, 0x41, 0x00, 0xe9, 0xff, 0x48, 0x3f,
+  0xac, 0xf8, 0x43, 0x4b, 0x00, 0x03, 0x40, 0xac, 0xf8, 0x30, 0xff, 0xfe,
+  0x4b, 0x4b, 0x40, 0x00, 0xe9, 0x00, 0x48, 0x40, 0xfb, 0x13, 0x33, 0x22,
+  0x00, 0x03, 0x40, 0xfb, 0x13, 0x31, 0xff, 0xfe, 0x22, 0x22, 0x40, 0x00,
+  0xe9, 0x01, 0x48, 0x40, 0x36, 0x44, 0x95, 0x07, 0x00, 0x03, 0x3f, 0x36,
+  0x44, 0x35, 0xff, 0xfe, 0x07, 0x07, 0x3f, 0x00, 0xe9, 0x0f, 0x48, 0x40,
+  0xed, 0x86, 0x67, 0x33, 0x00, 0x03, 0x31, 0xed, 0x86, 0x35, 0xff, 0xfe,
+  0x33, 0x33, 0x31, 0x00, 0xe9, 0x3f, 0x48, 0x40, 0x8d, 0x11, 0xb4, 0x2e,
+  0x00, 0x03, 0x00, 0x8d, 0x11, 0x37, 0xff, 0xfe, 0x2e, 0x2e, 0x00, 0x00,
+  0xe9, 0x40, 0x48, 0x40, 0x71, 0x59, 0x87, 0x06, 0x00, 0x03, 0x00, 0x71,
+  0x59, 0x37, 0xff, 0xfe, 0x06, 0x06, 0x00, 0x00, 0xe9, 0x7f, 0x48, 0x40,
+  0x3e, 0x1b, 0xf0, 0x56, 0x00, 0x03, 0xc0, 0x3e, 0x1b, 0xb0, 0xff, 0xfe,
+  0x56, 0x56, 0xc0, 0x00, 0xe9, 0x80, 0x48, 0x40, 0x76, 0x84, 0x83, 0x73,
+  0x00, 0x03, 0xc0, 0x76, 0x84, 0xf0, 0xff, 0xfe, 0x73, 0x73, 0xc0, 0x00,
+  0xe9, 0x81, 0x48, 0x40, 0xba, 0x3d, 0x30, 0x52, 0x00, 0x03, 0xbe, 0xba,
+  0x3d, 0xf0, 0xff, 0xfe, 0x52, 0x52, 0xbe, 0x00, 0xe9, 0xfe, 0x48, 0x40,
+  0x5b, 0x17, 0x22, 0xc4, 0x00, 0x03, 0x41, 0x5b, 0x17, 0x30, 0xff, 0xfe,
+  0xc4, 0xc4, 0x41, 0x00, 0xe9, 0xff, 0x48, 0x40, 0xe5, 0x23, 0xb4, 0x28,
+  0x00, 0x03, 0x40, 0xe5, 0x23, 0x34, 0xff, 0xfe, 0x28, 0x28, 0x40, 0x00,
+  0xe9, 0x00, 0x48, 0x7f, 0x58, 0x20, 0x55, 0xec, 0x00, 0x03, 0x7f, 0x58,
+  0x20, 0x35, 0xff, 0xfe, 0xec, 0xec, 0x7f, 0x00, 0xe9, 0x01, 0x48, 0x7f,
+  0xe9, 0x58, 0x36, 0xe0, 0x00, 0x03, 0x7d, 0xe9, 0x58, 0x35, 0xff, 0xfe,
+  0xe0, 0xe0, 0x7d, 0x00, 0xe9, 0x0f, 0x48, 0x7f, 0x98, 0x83, 0xb4, 0xda,
+  0x00, 0x03, 0x6f, 0x98, 0x83, 0x35, 0xff, 0xfe, 0xda, 0xda, 0x6f, 0x00,
+  0xe9, 0x3f, 0x48, 0x7f, 0xf7, 0x49, 0x14, 0xcf, 0x00, 0x03, 0x3f, 0xf7,
+  0x49, 0x35, 0xff, 0xfe, 0xcf, 0xcf, 0x3f, 0x00, 0xe9, 0x40, 0x48, 0x7f,
+  0x98, 0x72, 0xe0, 0x8a, 0x00, 0x03, 0x3e, 0x98, 0x72, 0x31, 0xff, 0xfe,
+  0x8a, 0x8a, 0x3e, 0x00, 0xe9, 0x7f, 0x48, 0x7f, 0x08, 0x4d, 0x54, 0xb9,
+  0x00, 0x03, 0xff, 0x08, 0x4d, 0xb4, 0xff, 0xfe, 0xb9, 0xb9, 0xff, 0x00,
+  0xe9, 0x80, 0x48, 0x7f, 0xd8, 0x85, 0x00, 0x50, 0x00, 0x03, 0xfe, 0xd8,
+  0x85, 0xf0, 0xff, 0xfe, 0x50, 0x50, 0xfe, 0x00, 0xe9, 0x81, 0x48, 0x7f,
+  0xfb, 0x43, 0xd7, 0xff, 0x00, 0x03, 0xfe, 0xfb, 0x43, 0xf4, 0xff, 0xfe,
+  0xff, 0xff, 0xfe, 0x00, 0xe9, 0xfe, 0x48, 0x7f, 0x1d, 0x03, 0xe4, 0x73,
+  0x00, 0x03, 0x80, 0x1d, 0x03, 0xf4, 0xff, 0xfe, 0x73, 0x73, 0x80, 0x00,
+  0xe9, 0xff, 0x48, 0x7f, 0x05, 0x3b, 0x47, 0xc8, 0x00, 0x03, 0x80, 0x05,
+  0x3b, 0xf4, 0xff, 0xfe, 0xc8, 0xc8, 0x80, 0x00, 0xe9, 0x00, 0x48, 0x80,
+  0x10, 0xdb, 0x44, 0xe1, 0x00, 0x03, 0x7f, 0x10, 0xdb, 0x75, 0xff, 0xfe,
+  0xe1, 0xe1, 0x7f, 0x00, 0xe9, 0x01, 0x48, 0x80, 0xed, 0x44, 0x10, 0xe5,
+  0x00, 0x03, 0x7e, 0xed, 0x44, 0x71, 0xff, 0xfe, 0xe5, 0xe5, 0x7e, 0x00,
+  0xe9, 0x0f, 0x48, 0x80, 0xab, 0x52, 0x66, 0x10, 0x00, 0x03, 0x70, 0xab,
+  0x52, 0x75, 0xff, 0xfe, 0x10, 0x10, 0x70, 0x00, 0xe9, 0x3f, 0x48, 0x80,
+  0x05, 0x07, 0xb3, 0xde, 0x00, 0x03, 0x41, 0x05, 0x07, 0x71, 0xff, 0xfe,
+  0xde, 0xde, 0x41, 0x00, 0xe9, 0x40, 0x48, 0x80, 0x92, 0x20, 0x26, 0x17,
+  0x00, 0x03, 0x3f, 0x92, 0x20, 0x75, 0xff, 0xfe, 0x17, 0x17, 0x3f, 0x00,
+  0xe9, 0x7f, 0x48, 0x80, 0xe4, 0x63, 0x83, 0xc3, 0x00, 0x03, 0x01, 0xe4,
+  0x63, 0x71, 0xff, 0xfe, 0xc3, 0xc3, 0x01, 0x00, 0xe9, 0x80, 0x48, 0x80,
+  0xfa, 0x07, 0xd0, 0x12, 0x00, 0x03, 0xff, 0xfa, 0x07, 0xb0, 0xff, 0xfe,
+  0x12, 0x12, 0xff, 0x00, 0xe9, 0x81, 0x48, 0x80, 0x1d, 0x43, 0x23, 0x97,
+  0x00, 0x03, 0xff, 0x1d, 0x43, 0xb0, 0xff, 0xfe, 0x97, 0x97, 0xff, 0x00,
+  0xe9, 0xfe, 0x48, 0x80, 0xe7, 0x58, 0x45, 0xdb, 0x00, 0x03, 0x82, 0xe7,
+  0x58, 0xb4, 0xff, 0xfe, 0xdb, 0xdb, 0x82, 0x00, 0xe9, 0xff, 0x48, 0x80,
+  0x10, 0xa7, 0xb1, 0xf6, 0x00, 0x03, 0x81, 0x10, 0xa7, 0xb0, 0xff, 0xfe,
+  0xf6, 0xf6, 0x81, 0x00, 0xe9, 0x00, 0x48, 0x81, 0x82, 0x88, 0x43, 0xae,
+  0x00, 0x03, 0x81, 0x82, 0x88, 0xb1, 0xff, 0xfe, 0xae, 0xae, 0x81, 0x00,
+  0xe9, 0x01, 0x48, 0x81, 0x11, 0x3f, 0x13, 0xe4, 0x00, 0x03, 0x80, 0x11,
+  0x3f, 0xb1, 0xff, 0xfe, 0xe4, 0xe4, 0x80, 0x00, 0xe9, 0x0f, 0x48, 0x81,
+  0xdb, 0x3a, 0x67, 0x14, 0x00, 0x03, 0x72, 0xdb, 0x3a, 0x75, 0xff, 0xfe,
+  0x14, 0x14, 0x72, 0x00, 0xe9, 0x3f, 0x48, 0x81, 0xb5, 0x88, 0x36, 0x96,
+  0x00, 0x03, 0x41, 0xb5, 0x88, 0x75, 0xff, 0xfe, 0x96, 0x96, 0x41, 0x00,
+  0xe9, 0x40, 0x48, 0x81, 0xef, 0x38, 0x20, 0xcc, 0x00, 0x03, 0x40, 0xef,
+  0x38, 0x71, 0xff, 0xfe, 0xcc, 0xcc, 0x40, 0x00, 0xe9, 0x7f, 0x48, 0x81,
+  0x70, 0x76, 0x14, 0x78, 0x00, 0x03, 0x01, 0x70, 0x76, 0x75, 0xff, 0xfe,
+  0x78, 0x78, 0x01, 0x00, 0xe9, 0x80, 0x48, 0x81, 0xee, 0x44, 0xc5, 0x70,
+  0x00, 0x03, 0x01, 0xee, 0x44, 0x35, 0xff, 0xfe, 0x70, 0x70, 0x01, 0x00,
+  0xe9, 0x81, 0x48, 0x81, 0xe5, 0xc3, 0xf2, 0x12, 0x00, 0x03, 0xff, 0xe5,
+  0xc3, 0xb0, 0xff, 0xfe, 0x12, 0x12, 0xff, 0x00, 0xe9, 0xfe, 0x48, 0x81,
+  0x3b, 0xf2, 0xb0, 0x64, 0x00, 0x03, 0x82, 0x3b, 0xf2, 0xb0, 0xff, 0xfe,
+  0x64, 0x64, 0x82, 0x00, 0xe9, 0xff, 0x48, 0x81, 0x07, 0xf8, 0xf2, 0xd4,
+  0x00, 0x03, 0x81, 0x07, 0xf8, 0xb0, 0xff, 0xfe, 0xd4, 0xd4, 0x81, 0x00,
+  0xe9, 0x00, 0x48, 0xfe, 0x72, 0x1e, 0xf2, 0x40, 0x00, 0x03, 0xfd, 0x72,
+  0x1e, 0xb1, 0xff, 0xfe, 0x40, 0x40, 0xfd, 0x00, 0xe9, 0x01, 0x48, 0xfe,
+  0xf8, 0x56, 0x92, 0x14, 0x00, 0x03, 0xfc, 0xf8, 0x56, 0xb1, 0xff, 0xfe,
+  0x14, 0x14, 0xfc, 0x00, 0xe9, 0x0f, 0x48, 0xfe, 0x26, 0x10, 0xd4, 0x6f,
+  0x00, 0x03, 0xee, 0x26, 0x10, 0xb5, 0xff, 0xfe, 0x6f, 0x6f, 0xee, 0x00,
+  0xe9, 0x3f, 0x48, 0xfe, 0x5d, 0x9c, 0x40, 0x05, 0x00, 0x03, 0xbe, 0x5d,
+  0x9c, 0xb1, 0xff, 0xfe, 0x05, 0x05, 0xbe, 0x00, 0xe9, 0x40, 0x48, 0xfe,
+  0x99, 0xb5, 0x66, 0x83, 0x00, 0x03, 0xbd, 0x99, 0xb5, 0xb5, 0xff, 0xfe,
+  0x83, 0x83, 0xbd, 0x00, 0xe9, 0x7f, 0x48, 0xfe, 0xc2, 0xe5, 0x55, 0x9f,
+  0x00, 0x03, 0x7f, 0xc2, 0xe5, 0x75, 0xff, 0xfe, 0x9f, 0x9f, 0x7f, 0x00,
+  0xe9, 0x80, 0x48, 0xfe, 0xe7, 0xae, 0x61, 0x53, 0x00, 0x03, 0x7e, 0xe7,
+  0xae, 0x31, 0xff, 0xfe, 0x53, 0x53, 0x7e, 0x00, 0xe9, 0x81, 0x48, 0xfe,
+  0xbd, 0x0f, 0xe5, 0xe4, 0x00, 0x03, 0x7d, 0xbd, 0x0f, 0x35, 0xff, 0xfe,
+  0xe4, 0xe4, 0x7d, 0x00, 0xe9, 0xfe, 0x48, 0xfe, 0xc7, 0x09, 0x91, 0x68,
+  0x00, 0x03, 0x00, 0xc7, 0x09, 0x33, 0xff, 0xfe, 0x68, 0x68, 0x00, 0x00,
+  0xe9, 0xff, 0x48, 0xfe, 0xeb, 0x68, 0x53, 0x98, 0x00, 0x03, 0xff, 0xeb,
+  0x68, 0xb0, 0xff, 0xfe, 0x98, 0x98, 0xff, 0x00, 0xe9, 0x00, 0x48, 0xff,
+  0x62, 0xd5, 0xc5, 0x53, 0x00, 0x03, 0xff, 0x62, 0xd5, 0xb5, 0xff, 0xfe,
+  0x53, 0x53, 0xff, 0x00, 0xe9, 0x01, 0x48, 0xff, 0xe6, 0x29, 0x83, 0xdd,
+  0x00, 0x03, 0xfe, 0xe6, 0x29, 0xb1, 0xff, 0xfe, 0xdd, 0xdd, 0xfe, 0x00,
+  0xe9, 0x0f, 0x48, 0xff, 0x2a, 0xbb, 0xd6, 0x00, 0x00, 0x03, 0xef, 0x2a,
+  0xbb, 0xb5, 0xff, 0xfe, 0x00, 0x00, 0xef, 0x00, 0xe9, 0x3f, 0x48, 0xff,
+  0x09, 0x36, 0x50, 0xd9, 0x00, 0x03, 0xbf, 0x09, 0x36, 0xb1, 0xff, 0xfe,
+  0xd9, 0xd9, 0xbf, 0x00, 0xe9, 0x40, 0x48, 0xff, 0x81, 0xe7, 0x83, 0x2b,
+  0x00, 0x03, 0xbf, 0x81, 0xe7, 0xb1, 0xff, 0xfe, 0x2b, 0x2b, 0xbf, 0x00,
+  0xe9, 0x7f, 0x48, 0xff, 0xe3, 0x29, 0x77, 0xc3, 0x00, 0x03, 0x80, 0xe3,
+  0x29, 0xb5, 0xff, 0xfe, 0xc3, 0xc3, 0x80, 0x00, 0xe9, 0x80, 0x48, 0xff,
+  0x03, 0x18, 0xa3, 0xc3, 0x00, 0x03, 0x7f, 0x03, 0x18, 0x31, 0xff, 0xfe,
+  0xc3, 0xc3, 0x7f, 0x00, 0xe9, 0x81, 0x48, 0xff, 0x92, 0x55, 0xf2, 0xe5,
+  0x00, 0x03, 0x7d, 0x92, 0x55, 0x31, 0xff, 0xfe, 0xe5, 0xe5, 0x7d, 0x00,
+  0xe9, 0xfe, 0x48, 0xff, 0x4b, 0x8a, 0xe1, 0xd6, 0x00, 0x03, 0x01, 0x4b,
+  0x8a, 0x31, 0xff, 0xfe, 0xd6, 0xd6, 0x01, 0x00, 0xe9, 0xff, 0x48, 0xff,
+  0x08, 0xbf, 0x61, 0xe0, 0x00, 0x03, 0x00, 0x08, 0xbf, 0x33, 0xff, 0xfe,
+  0xe0, 0xe0, 0x00, 0x00, 0xea, 0x48, 0x48, 0xaf, 0xfc, 0x0b, 0x69, 0x00,
+  0xf5, 0x02, 0xaf, 0xfc, 0x0b, 0x79, 0xff, 0xfd, 0x00, 0x00, 0xaf, 0x00,
+  0xea, 0x48, 0x48, 0x74, 0x53, 0x82, 0x7b, 0xfe, 0x7e, 0x02, 0x74, 0x53,
+  0x82, 0x7b, 0xff, 0xfd, 0xfe, 0xfe, 0x74, 0x00, 0xea, 0x48, 0x48, 0xe3,
+  0x3d, 0x79, 0x32, 0x3f, 0x87, 0x02, 0xe3, 0x3d, 0x79, 0x32, 0xff, 0xfd,
+  0x3f, 0x3f, 0xe3, 0x00, 0xea, 0x48, 0x48, 0x99, 0xba, 0x03, 0x6a, 0x7f,
+  0xfd, 0x02, 0x99, 0xba, 0x03, 0x7a, 0xff, 0xfd, 0x7f, 0x7f, 0x99, 0x00,
+  0xec, 0x00, 0x03, 0x60, 0xaa, 0xce, 0x5b, 0x40, 0x32, 0x02, 0x60, 0xaa,
+  0xce, 0x79, 0xff, 0xff, 0x40, 0x40, 0x79, 0x00, 0xec, 0x00, 0x03, 0xd7,
+  0x12, 0x87, 0xe4, 0x8a, 0x79, 0x02, 0xd7, 0x12, 0x87, 0xf4, 0xff, 0xff,
+  0x8a, 0x8a, 0xf4, 0x00, 0xec, 0x00, 0x03, 0x75, 0x9a, 0x12, 0x91, 0x16,
+  0xee, 0x02, 0x75, 0x9a, 0x12, 0xb1, 0xff, 0xff, 0x16, 0x16, 0xb1, 0x00,
+  0xec, 0x00, 0x03, 0xa6, 0x22, 0x34, 0x5a, 0x01, 0xcc, 0x02, 0xa6, 0x22,
+  0x34, 0x79, 0xff, 0xff, 0x01, 0x01, 0x79, 0x00, 0xec, 0x00, 0x03, 0x01,
+  0x50, 0x57, 0xce, 0x80, 0xa9, 0x02, 0x01, 0x50, 0x57, 0xfc, 0xff, 0xff,
+  0x80, 0x80, 0xfc, 0x00, 0xec, 0x00, 0x03, 0x1d, 0xcb, 0x3c, 0x3e, 0x41,
+  0xc4, 0x02, 0x1d, 0xcb, 0x3c, 0xbd, 0xff, 0xff, 0x41, 0x41, 0xbd, 0x00,
+  0xed, 0x00, 0x03, 0xb1, 0x79, 0x11, 0xd7, 0x02, 0xef, 0x02, 0xaf, 0x79,
+  0x11, 0xb5, 0xff, 0xff, 0x02, 0x02, 0xb5, 0x00, 0xed, 0x00, 0x03, 0x9c,
+  0xcd, 0xae, 0x36, 0x3f, 0x52, 0x02, 0x5c, 0xcd, 0xae, 0x75, 0xff, 0xff,
+  0x3f, 0x3f, 0x75, 0x00, 0xed, 0x00, 0x03, 0xc7, 0x8f, 0x9f, 0x92, 0xff,
+  0x61, 0x02, 0xc7, 0x8f, 0x9f, 0xb0, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x00,
+  0xed, 0x00, 0x03, 0x9a, 0xdd, 0x4e, 0xa7, 0x41, 0xb2, 0x02, 0x59, 0xdd,
+  0x4e, 0x75, 0xff, 0xff, 0x41, 0x41, 0x75, 0x00, 0xed, 0x00, 0x03, 0x82,
+  0x21, 0x51, 0xd0, 0x7f, 0xaf, 0x02, 0x02, 0x21, 0x51, 0x71, 0xff, 0xff,
+  0x7f, 0x7f, 0x71, 0x00, 0xed, 0x00, 0x03, 0x61, 0x1c, 0xdc, 0xf3, 0x40,
+  0x24, 0x02, 0x21, 0x1c, 0xdc, 0x31, 0xff, 0xff, 0x40, 0x40, 0x31, 0x00,
+  0xee, 0x00, 0x03, 0xae, 0x19, 0x5b, 0xc6, 0xff, 0xa5, 0x02, 0xae, 0x19,
+  0x5b, 0x76, 0xff, 0xff, 0xff, 0x00, 0x76, 0x00, 0xee, 0x00, 0x03, 0xce,
+  0xd2, 0xc7, 0x2b, 0x00, 0x39, 0x02, 0xce, 0xd2, 0xc7, 0x39, 0xff, 0xff,
+  0x00, 0x01, 0x39, 0x00, 0xee, 0x00, 0x03, 0x60, 0x9c, 0xf4, 0x74, 0x02,
+  0x0c, 0x02, 0x60, 0x9c, 0xf4, 0x74, 0xff, 0xff, 0x02, 0x03, 0x74, 0x00,
+  0xee, 0x00, 0x03, 0x1a, 0x64, 0x96, 0x93, 0xff, 0x6a, 0x02, 0x1a, 0x64,
+  0x96, 0x33, 0xff, 0xff, 0xff, 0x00, 0x33, 0x00, 0xee, 0x00, 0x03, 0xe7,
+  0x9d, 0xa6, 0xe5, 0x3f, 0x5a, 0x02, 0xe7, 0x9d, 0xa6, 0x75, 0xff, 0xff,
+  0x3f, 0x40, 0x75, 0x00, 0xee, 0x00, 0x03, 0x24, 0x21, 0xd8, 0x60, 0x01,
+  0x28, 0x02, 0x24, 0x21, 0xd8, 0x70, 0xff, 0xff, 0x01, 0x02, 0x70, 0x00,
+  0xef, 0x00, 0x03, 0x56, 0x37, 0x2c, 0x74, 0xc0, 0xd4, 0x02, 0x94, 0x37,
+  0x2c, 0xf4, 0xff, 0xff, 0xc0, 0xc1, 0xf4, 0x00, 0xef, 0x00, 0x03, 0xc1,
+  0x4a, 0x32, 0x36, 0x02, 0xce, 0x02, 0xbd, 0x4a, 0x32, 0xb5, 0xff, 0xff,
+  0x02, 0x03, 0xb5, 0x00, 0xef, 0x00, 0x03, 0xea, 0x68, 0x02, 0xc2, 0x81,
+  0xfe, 0x02, 0x67, 0x68, 0x02, 0x31, 0xff, 0xff, 0x81, 0x82, 0x31, 0x00,
+  0xef, 0x00, 0x03, 0xa4, 0x65, 0xa6, 0x57, 0xc0, 0x5a, 0x02, 0xe3, 0x65,
+  0xa6, 0xb4, 0xff, 0xff, 0xc0, 0xc1, 0xb4, 0x00, 0xef, 0x00, 0x03, 0xc6,
+  0x8c, 0xf3, 0x75, 0xc0, 0x0d, 0x02, 0x05, 0x8c, 0xf3, 0x35, 0xff, 0xff,
+  0xc0, 0xc1, 0x35, 0x00, 0xef, 0x00, 0x03, 0x76, 0x7c, 0x31, 0xe0, 0x0f,
+  0xcf, 0x02, 0x65, 0x7c, 0x31, 0x31, 0xff, 0xff, 0x0f, 0x10, 0x31, 0x00,
+  0xf0, 0x01, 0x48, 0x8a, 0xfd, 0x89, 0x84, 0x0b, 0x00, 0x03, 0x8a, 0xfd,
+  0x89, 0xb4, 0xff, 0xfe, 0x0b, 0x0b, 0x8a, 0x00, 0xf0, 0x01, 0x48, 0x87,
+  0xba, 0x9f, 0xdc, 0x7f, 0x00, 0x03, 0x87, 0xba, 0x9f, 0xfc, 0xff, 0xfe,
+  0x7f, 0x7f, 0x87, 0x00, 0xf0, 0x01, 0x48, 0x91, 0x85, 0x56, 0x83, 0x3a,
+  0x00, 0x03, 0x91, 0x85, 0x56, 0xb3, 0xff, 0xff, 0x3a, 0x3a, 0xb3, 0x00,
+  0xf0, 0x01, 0x48, 0x8d, 0xb5, 0x3b, 0x3a, 0x08, 0x00, 0x03, 0x8d, 0xb5,
+  0x3b, 0x3a, 0xff, 0xff, 0x08, 0x08, 0x3a, 0x00, 0xf0, 0x01, 0x48, 0x8b,
+  0xf9, 0xbd, 0x95, 0xdc, 0x00, 0x03, 0x8b, 0xf9, 0xbd, 0xb5, 0xff, 0xfe,
+  0xdc, 0xdc, 0x8b, 0x00, 0xf0, 0x01, 0x48, 0xe2, 0xbf, 0x40, 0xba, 0xcb,
+  0x00, 0x03, 0xe2, 0xbf, 0x40, 0xba, 0xff, 0xff, 0xcb, 0xcb, 0xba, 0x00,
+  0xf0, 0x01, 0x48, 0x3a, 0xcf, 0x1f, 0x79, 0x86, 0x00, 0x03, 0x3a, 0xcf,
+  0x1f, 0x79, 0xff, 0xfe, 0x86, 0x86, 0x3a, 0x00, 0xf0, 0x01, 0x48, 0xff,
+  0x61, 0x86, 0xfb, 0x40, 0x00, 0x03, 0xff, 0x61, 0x86, 0xfb, 0xff, 0xff,
+  0x40, 0x40, 0xfb, 0x00, 0xf0, 0x01, 0x48, 0x10, 0x85, 0x2e, 0x83, 0xc0,
+  0x00, 0x03, 0x10, 0x85, 0x2e, 0xb3, 0xff, 0xff, 0xc0, 0xc0, 0xb3, 0x00,
+  0xf0, 0x01, 0x48, 0x57, 0xdc, 0xc5, 0x93, 0x82, 0x00, 0x03, 0x57, 0xdc,
+  0xc5, 0xb3, 0xff, 0xff, 0x82, 0x82, 0xb3, 0x00, 0xf0, 0x01, 0x48, 0x68,
+  0xaf, 0x81, 0x66, 0xc9, 0x00, 0x03, 0x68, 0xaf, 0x81, 0x76, 0xff, 0xff,
+  0xc9, 0xc9, 0x76, 0x00, 0xf0, 0x01, 0x48, 0xc4, 0x2a, 0xea, 0x6a, 0x2b,
+  0x00, 0x03, 0xc4, 0x2a, 0xea, 0x7a, 0xff, 0xff, 0x2b, 0x2b, 0x7a, 0x00,
+  0xf0, 0x01, 0x48, 0xb4, 0x8c, 0x1e, 0xd1, 0xe2, 0x00, 0x03, 0xb4, 0x8c,
+  0x1e, 0xf1, 0xff, 0xfe, 0xe2, 0xe2, 0xb4, 0x00, 0xf0, 0x01, 0x48, 0xde,
+  0xaf, 0x59, 0x27, 0xa7, 0x00, 0x03, 0xde, 0xaf, 0x59, 0x37, 0xff, 0xff,
+  0xa7, 0xa7, 0x37, 0x00, 0xf0, 0x01, 0x48, 0x4e, 0x0e, 0x55, 0xde, 0x43,
+  0x00, 0x03, 0x4e, 0x0e, 0x55, 0xfe, 0xff, 0xff, 0x43, 0x43, 0xfe, 0x00,
+  0xf0, 0x01, 0x48, 0xe6, 0x62, 0x61, 0xda, 0x45, 0x00, 0x03, 0xe6, 0x62,
+  0x61, 0xfa, 0xff, 0xff, 0x45, 0x45, 0xfa, 0x00, 0xf0, 0x01, 0x48, 0x6f,
+  0x70, 0xdc, 0x72, 0x41, 0x00, 0x03, 0x6f, 0x70, 0xdc, 0x72, 0xff, 0xff,
+  0x41, 0x41, 0x72, 0x00, 0xf0, 0x01, 0x48, 0xb5, 0x2b, 0x93, 0xde, 0xd7,
+  0x00, 0x03, 0xb5, 0x2b, 0x93, 0xfe, 0xff, 0xff, 0xd7, 0xd7, 0xfe, 0x00,
+  0xf0, 0x01, 0x48, 0xb5, 0x96, 0xca, 0xc4, 0x55, 0x00, 0x03, 0xb5, 0x96,
+  0xca, 0xf4, 0xff, 0xfe, 0x55, 0x55, 0xb5, 0x00, 0xf0, 0x01, 0x48, 0xa5,
+  0x35, 0x46, 0x33, 0x95, 0x00, 0x03, 0xa5, 0x35, 0x46, 0x33, 0xff, 0xff,
+  0x95, 0x95, 0x33, 0x00, 0xf0, 0x00, 0x48, 0x12, 0xcd, 0xf2, 0x48, 0xa9,
+  0x00, 0x03, 0x12, 0xcd, 0xf2, 0x78, 0xff, 0xfe, 0xa9, 0xa9, 0x12, 0x00,
+  0xf0, 0x00, 0x48, 0xa3, 0x0d, 0x00, 0xe4, 0x55, 0x00, 0x03, 0xa3, 0x0d,
+  0x00, 0xf4, 0xff, 0xfe, 0x55, 0x55, 0xa3, 0x00, 0xf0, 0x00, 0x48, 0x60,
+  0x55, 0x1c, 0xe2, 0xc9, 0x00, 0x03, 0x60, 0x55, 0x1c, 0xf2, 0xff, 0xfe,
+  0xc9, 0xc9, 0x60, 0x00, 0xf0, 0x00, 0x48, 0x29, 0xf3, 0x74, 0x05, 0x83,
+  0x00, 0x03, 0x29, 0xf3, 0x74, 0x35, 0xff, 0xfe, 0x83, 0x83, 0x29, 0x00,
+  0xf1, 0x42, 0x48, 0x08, 0x61, 0x00, 0x92, 0xaa, 0x00, 0x03, 0x5d, 0x61,
+  0x00, 0x30, 0xff, 0xfe, 0xaa, 0xaa, 0x5d, 0x00, 0xf1, 0x42, 0x48, 0x16,
+  0x05, 0x00, 0xb2, 0x80, 0x00, 0x03, 0x95, 0x05, 0x00, 0xf0, 0xff, 0xfe,
+  0x80, 0x80, 0x95, 0x00, 0xf1, 0x42, 0x48, 0x59, 0xbd, 0x01, 0x71, 0x80,
+  0xff, 0x02, 0xd9, 0xbd, 0x01, 0xf0, 0xff, 0xfe, 0x80, 0x80, 0xd9, 0x00,
+  0xf1, 0x42, 0x48, 0xad, 0x5d, 0x01, 0xe0, 0x40, 0xff, 0x02, 0x6c, 0x5d,
+  0x01, 0x71, 0xff, 0xfe, 0x40, 0x40, 0x6c, 0x00, 0xf1, 0x42, 0x48, 0xf8,
+  0x1f, 0x7f, 0x52, 0x41, 0x81, 0x02, 0xb6, 0x1f, 0x7f, 0xb1, 0xff, 0xfe,
+  0x41, 0x41, 0xb6, 0x00, 0xf1, 0x42, 0x48, 0x82, 0x3b, 0x7f, 0x57, 0xaa,
+  0x81, 0x02, 0xd8, 0x3b, 0x7f, 0xb4, 0xff, 0xfe, 0xaa, 0xaa, 0xd8, 0x00,
+  0xf1, 0x42, 0x48, 0xd3, 0xb1, 0xd5, 0xa6, 0x81, 0x2b, 0x02, 0x51, 0xb1,
+  0xd5, 0x35, 0xff, 0xfe, 0x81, 0x81, 0x51, 0x00, 0xf1, 0x42, 0x48, 0xac,
+  0x2a, 0xd5, 0xe7, 0x02, 0x2b, 0x02, 0xaa, 0x2a, 0xd5, 0xb5, 0xff, 0xfe,
+  0x02, 0x02, 0xaa, 0x00, 0xf1, 0x42, 0x48, 0xda, 0x41, 0xff, 0xf6, 0xf8,
+  0x01, 0x02, 0xe1, 0x41, 0xff, 0xb4, 0xff, 0xfe, 0xf8, 0xf8, 0xe1, 0x00,
+  0xf1, 0x42, 0x48, 0xd0, 0x3e, 0xff, 0x81, 0x7f, 0x01, 0x02, 0x51, 0x3e,
+  0xff, 0x71, 0xff, 0xfe, 0x7f, 0x7f, 0x51, 0x00, 0xf3, 0x42, 0x48, 0x6f,
+  0x67, 0x00, 0x51, 0x02, 0x00, 0x03, 0x6c, 0x67, 0x00, 0x31, 0xff, 0xfe,
+  0x02, 0x03, 0x6c, 0x00, 0xf3, 0x42, 0x48, 0xf8, 0xc3, 0x00, 0x50, 0xfe,
+  0x00, 0x03, 0xf8, 0xc3, 0x00, 0xb0, 0xff, 0xfe, 0xfe, 0xff, 0xf8, 0x00,
+  0xf3, 0x42, 0x48, 0x34, 0xcc, 0x01, 0x35, 0x40, 0xff, 0x02, 0xf3, 0xcc,
+  0x01, 0xb4, 0xff, 0xfe, 0x40, 0x41, 0xf3, 0x00, 0xf3, 0x42, 0x48, 0xc6,
+  0x77, 0x01, 0x46, 0xfe, 0xff, 0x02, 0xc6, 0x77, 0x01, 0xb4, 0xff, 0xfe,
+  0xfe, 0xff, 0xc6, 0x00, 0xf3, 0x42, 0x48, 0xf7, 0xee, 0x7f, 0xc3, 0xff,
+  0x81, 0x02, 0xf7, 0xee, 0x7f, 0xb1, 0xff, 0xfe, 0xff, 0x00, 0xf7, 0x00,
+  0xf3, 0x42, 0x48, 0x47, 0xf3, 0x7f, 0xc1, 0x40, 0x81, 0x02, 0x06, 0xf3,
+  0x7f, 0x31, 0xff, 0xfe, 0x40, 0x41, 0x06, 0x00, 0xf3, 0x42, 0x48, 0xf3,
+  0xe5, 0xd5, 0xd7, 0x81, 0x2b, 0x02, 0x71, 0xe5, 0xd5, 0x35, 0xff, 0xfe,
+  0x81, 0x82, 0x71, 0x00, 0xf3, 0x42, 0x48, 0x25, 0x01, 0xd5, 0x07, 0x41,
+  0x2b, 0x02, 0xe3, 0x01, 0xd5, 0xb4, 0xff, 0xfe, 0x41, 0x42, 0xe3, 0x00,
+  0xf3, 0x42, 0x48, 0xed, 0x9c, 0xff, 0x27, 0x3f, 0x01, 0x02, 0xad, 0x9c,
+  0xff, 0xb5, 0xff, 0xfe, 0x3f, 0x40, 0xad, 0x00, 0xf3, 0x42, 0x48, 0x08,
+  0x29, 0xff, 0xd5, 0x3f, 0x01, 0x02, 0xc8, 0x29, 0xff, 0xb4, 0xff, 0xfe,
+  0x3f, 0x40, 0xc8, 0x00, 0xf4, 0x30, 0x48, 0x33, 0x00, 0x9f, 0x6b, 0x01,
+  0x61, 0x02, 0x33, 0x00, 0x9f, 0x7b, 0xff, 0xfe, 0x01, 0x01, 0x33, 0x00,
+  0xf4, 0x30, 0x48, 0x68, 0x00, 0x6a, 0x0a, 0x7f, 0x96, 0x02, 0x68, 0x00,
+  0x6a, 0x3a, 0xff, 0xfe, 0x7f, 0x7f, 0x68, 0x00, 0xf4, 0x2f, 0x48, 0x20,
+  0x01, 0xac, 0x3a, 0x0f, 0x54, 0x02, 0x20, 0x01, 0xac, 0x3a, 0xff, 0xfe,
+  0x0f, 0x0f, 0x20, 0x00, 0xf4, 0x2f, 0x48, 0x1e, 0x01, 0xd8, 0x4c, 0x41,
+  0x28, 0x02, 0x1e, 0x01, 0xd8, 0x7c, 0xff, 0xfe, 0x41, 0x41, 0x1e, 0x00,
+  0xf4, 0xb1, 0x48, 0x5e, 0x7f, 0x54, 0x70, 0xc0, 0xac, 0x02, 0x5e, 0x7f,
+  0x54, 0x70, 0xff, 0xfe, 0xc0, 0xc0, 0x5e, 0x00, 0xf4, 0xb1, 0x48, 0xd4,
+  0x7f, 0xc8, 0xd5, 0x3f, 0x38, 0x02, 0xd4, 0x7f, 0xc8, 0xf5, 0xff, 0xfe,
+  0x3f, 0x3f, 0xd4, 0x00, 0xf4, 0x5b, 0x48, 0x86, 0xd5, 0xc1, 0x0b, 0x40,
+  0x3f, 0x02, 0x86, 0xd5, 0xc1, 0x3b, 0xff, 0xfe, 0x40, 0x40, 0x86, 0x00,
+  0xf4, 0x5b, 0x48, 0x04, 0xd5, 0x5b, 0x5b, 0x40, 0xa5, 0x02, 0x04, 0xd5,
+  0x5b, 0x7b, 0xff, 0xfe, 0x40, 0x40, 0x04, 0x00, 0xf4, 0x31, 0x48, 0x74,
+  0xff, 0xeb, 0xe7, 0x40, 0x15, 0x02, 0x74, 0xff, 0xeb, 0xf7, 0xff, 0xfe,
+  0x40, 0x40, 0x74, 0x00, 0xf4, 0x31, 0x48, 0x24, 0xff, 0x32, 0xcf, 0x41,
+  0xce, 0x02, 0x24, 0xff, 0x32, 0xff, 0xff, 0xfe, 0x41, 0x41, 0x24, 0x00,
+  0xf5, 0x30, 0x48, 0x55, 0x00, 0xf6, 0x94, 0x01, 0x0a, 0x02, 0x53, 0x00,
+  0xf6, 0x35, 0xff, 0xfe, 0x01, 0x01, 0x53, 0x00, 0xf5, 0x30, 0x48, 0x09,
+  0x00, 0x41, 0x50, 0x00, 0xbf, 0x02, 0x08, 0x00, 0x41, 0x31, 0xff, 0xfe,
+  0x00, 0x00, 0x08, 0x00, 0xf5, 0x2f, 0x48, 0x78, 0x01, 0x34, 0xd7, 0x00,
+  0xcc, 0x02, 0x78, 0x01, 0x34, 0x35, 0xff, 0xfe, 0x00, 0x00, 0x78, 0x00,
+  0xf5, 0x2f, 0x48, 0x7c, 0x01, 0xf5, 0x47, 0xfe, 0x0b, 0x02, 0x7e, 0x01,
+  0xf5, 0x34, 0xff, 0xfe, 0xfe, 0xfe, 0x7e, 0x00, 0xf5, 0xb1, 0x48, 0xd7,
+  0x7f, 0x1f, 0xf6, 0x00, 0xe1, 0x02, 0xd6, 0x7f, 0x1f, 0xb5, 0xff, 0xfe,
+  0x00, 0x00, 0xd6, 0x00, 0xf5, 0xb1, 0x48, 0xa6, 0x7f, 0x55, 0xd2, 0x80,
+  0xab, 0x02, 0x25, 0x7f, 0x55, 0x31, 0xff, 0xfe, 0x80, 0x80, 0x25, 0x00,
+  0xf5, 0x5b, 0x48, 0x9d, 0xd5, 0x59, 0xd5, 0xaa, 0xa7, 0x02, 0xf3, 0xd5,
+  0x59, 0xb4, 0xff, 0xfe, 0xaa, 0xaa, 0xf3, 0x00, 0xf5, 0x5b, 0x48, 0x8a,
+  0xd5, 0x5e, 0x95, 0xaa, 0xa2, 0x02, 0xe0, 0xd5, 0x5e, 0xb4, 0xff, 0xfe,
+  0xaa, 0xaa, 0xe0, 0x00, 0xf5, 0x31, 0x48, 0x26, 0xff, 0x1e, 0xc7, 0xaa,
+  0xe2, 0x02, 0x7c, 0xff, 0x1e, 0x34, 0xff, 0xfe, 0xaa, 0xaa, 0x7c, 0x00,
+  0xf5, 0x31, 0x48, 0x63, 0xff, 0xf8, 0xd0, 0xff, 0x08, 0x02, 0x63, 0xff,
+  0xf8, 0x30, 0xff, 0xfe, 0xff, 0xff, 0x63, 0x00, 0xf6, 0x30, 0x48, 0x18,
+  0x00, 0x27, 0x4c, 0xc0, 0xd9, 0x02, 0x18, 0x00, 0x27, 0xfc, 0xff, 0xfe,
+  0xc1, 0xc0, 0x18, 0x00, 0xf6, 0x30, 0x48, 0x28, 0x00, 0x5a, 0xc4, 0xc0,
+  0xa6, 0x02, 0x28, 0x00, 0x5a, 0xf4, 0xff, 0xfe, 0xc1, 0xc0, 0x28, 0x00,
+  0xf6, 0x2f, 0x48, 0xfc, 0x01, 0xce, 0x49, 0x00, 0x32, 0x02, 0xfc, 0x01,
+  0xce, 0x79, 0xff, 0xfe, 0x01, 0x00, 0xfc, 0x00, 0xf6, 0x2f, 0x48, 0x93,
+  0x01, 0xce, 0x13, 0xff, 0x32, 0x02, 0x93, 0x01, 0xce, 0x33, 0xff, 0xfe,
+  0x00, 0xff, 0x93, 0x00, 0xf6, 0xb1, 0x48, 0x37, 0x7f, 0xdb, 0xb2, 0xc0,
+  0x25, 0x02, 0x37, 0x7f, 0xdb, 0xb0, 0xff, 0xfe, 0xc1, 0xc0, 0x37, 0x00,
+  0xf6, 0xb1, 0x48, 0xff, 0x7f, 0xf1, 0xb1, 0x7f, 0x0f, 0x02, 0xff, 0x7f,
+  0xf1, 0xb1, 0xff, 0xfe, 0x80, 0x7f, 0xff, 0x00, 0xf6, 0x5b, 0x48, 0x12,
+  0xd5, 0xd2, 0x6b, 0xde, 0x2e, 0x02, 0x12, 0xd5, 0xd2, 0xf9, 0xff, 0xfe,
+  0xdf, 0xde, 0x12, 0x00, 0xf6, 0x5b, 0x48, 0x83, 0xd5, 0xaa, 0xb9, 0x81,
+  0x56, 0x02, 0x83, 0xd5, 0xaa, 0xb9, 0xff, 0xfe, 0x82, 0x81, 0x83, 0x00,
+  0xf6, 0x31, 0x48, 0xba, 0xff, 0x1f, 0x19, 0x0f, 0xe1, 0x02, 0xba, 0xff,
+  0x1f, 0x39, 0xff, 0xfe, 0x10, 0x0f, 0xba, 0x00, 0xf6, 0x31, 0x48, 0x6f,
+  0xff, 0xf2, 0xe5, 0x40, 0x0e, 0x02, 0x6f, 0xff, 0xf2, 0x75, 0xff, 0xfe,
+  0x41, 0x40, 0x6f, 0x00, 0xf7, 0x30, 0x48, 0x39, 0x00, 0x72, 0xb2, 0x80,
+  0x8e, 0x02, 0xb7, 0x00, 0x72, 0xf0, 0xff, 0xfe, 0x81, 0x80, 0xb7, 0x00,
+  0xf7, 0x30, 0x48, 0xce, 0x00, 0x48, 0x47, 0x02, 0xb8, 0x02, 0xcb, 0x00,
+  0x48, 0xb5, 0xff, 0xfe, 0x03, 0x02, 0xcb, 0x00, 0xf7, 0x2f, 0x48, 0xb2,
+  0x01, 0x91, 0x30, 0x01, 0x6f, 0x02, 0xaf, 0x01, 0x91, 0xb1, 0xff, 0xfe,
+  0x02, 0x01, 0xaf, 0x00, 0xf7, 0x2f, 0x48, 0x92, 0x01, 0xe7, 0x47, 0x00,
+  0x19, 0x02, 0x91, 0x01, 0xe7, 0xb5, 0xff, 0xfe, 0x01, 0x00, 0x91, 0x00,
+  0xf7, 0xb1, 0x48, 0xe1, 0x7f, 0xe4, 0x25, 0x3f, 0x1c, 0x02, 0xa1, 0x7f,
+  0xe4, 0xb5, 0xff, 0xfe, 0x40, 0x3f, 0xa1, 0x00, 0xf7, 0xb1, 0x48, 0xf2,
+  0x7f, 0xb0, 0x43, 0x0f, 0x50, 0x02, 0xe2, 0x7f, 0xb0, 0xb1, 0xff, 0xfe,
+  0x10, 0x0f, 0xe2, 0x00, 0xf7, 0x5b, 0x48, 0x37, 0xd5, 0x2b, 0x82, 0xfe,
+  0xd5, 0x02, 0x37, 0xd5, 0x2b, 0x30, 0xff, 0xfe, 0xff, 0xfe, 0x37, 0x00,
+  0xf7, 0x5b, 0x48, 0x8c, 0xd5, 0x75, 0x41, 0xfe, 0x8b, 0x02, 0x8d, 0xd5,
+  0x75, 0xb0, 0xff, 0xfe, 0xff, 0xfe, 0x8d, 0x00, 0xf7, 0x31, 0x48, 0x42,
+  0xff, 0x6c, 0xb7, 0x02, 0x94, 0x02, 0x3f, 0xff, 0x6c, 0x35, 0xff, 0xfe,
+  0x03, 0x02, 0x3f, 0x00, 0xf7, 0x31, 0x48, 0x48, 0xff, 0xb2, 0xe1, 0x81,
+  0x4e, 0x02, 0xc6, 0xff, 0xb2, 0xf0, 0xff, 0xfe, 0x82, 0x81, 0xc6, 0x00,
+  0xf8, 0x48, 0x48, 0xcc, 0xbd, 0x59, 0xc5, 0x01, 0xa7, 0x02, 0xcc, 0xbd,
+  0x59, 0xfd, 0xff, 0xfd, 0x01, 0x01, 0xcc, 0x00, 0xf8, 0x48, 0x48, 0x24,
+  0x23, 0x21, 0x8d, 0x3f, 0xdf, 0x02, 0x24, 0x23, 0x21, 0xbd, 0xff, 0xfd,
+  0x3f, 0x3f, 0x24, 0x00, 0xf8, 0x48, 0x48, 0x26, 0xd0, 0x7f, 0x5a, 0x41,
+  0x81, 0x02, 0x26, 0xd0, 0x7f, 0x7a, 0xff, 0xfd, 0x41, 0x41, 0x26, 0x00,
+  0xf8, 0x48, 0x48, 0x7b, 0xcb, 0x8c, 0x96, 0xd6, 0x74, 0x02, 0x7b, 0xcb,
+  0x8c, 0xbe, 0xff, 0xfd, 0xd6, 0xd6, 0x7b, 0x00, 0xf8, 0x48, 0x48, 0xaa,
+  0xf7, 0x77, 0x39, 0xff, 0x89, 0x02, 0xaa, 0xf7, 0x77, 0x39, 0xff, 0xfd,
+  0xff, 0xff, 0xaa, 0x00, 0xf8, 0x48, 0x48, 0x95, 0xb8, 0x65, 0x08, 0xff,
+  0x9b, 0x02, 0x95, 0xb8, 0x65, 0x38, 0xff, 0xfd, 0xff, 0xff, 0x95, 0x00,
+  0xf9, 0x00, 0x03, 0xfa, 0x4b, 0x00, 0xc0, 0x01, 0x00, 0x03, 0xf8, 0x4b,
+  0x00, 0xb1, 0xff, 0xff, 0x01, 0x01, 0xb1, 0x00, 0xf9, 0x00, 0x03, 0x99,
+  0xb6, 0x00, 0xf5, 0xaa, 0x00, 0x03, 0xef, 0xb6, 0x00, 0xb4, 0xff, 0xff,
+  0xaa, 0xaa, 0xb4, 0x00, 0xf9, 0xff, 0x02, 0x0f, 0x02, 0x01, 0x57, 0xfe,
+  0xff, 0x02, 0x11, 0x02, 0x01, 0x34, 0xff, 0xff, 0xfe, 0xfe, 0x34, 0x00,
+  0xf9, 0xff, 0x02, 0x2e, 0xd5, 0x01, 0xc5, 0xaa, 0xff, 0x02, 0x84, 0xd5,
+  0x01, 0xf4, 0xff, 0xff, 0xaa, 0xaa, 0xf4, 0x00, 0xf9, 0x81, 0x02, 0xdc,
+  0xa5, 0x7f, 0x30, 0x7f, 0x81, 0x02, 0x5c, 0xa5, 0x7f, 0x71, 0xff, 0xff,
+  0x7f, 0x7f, 0x71, 0x00, 0xf9, 0x81, 0x02, 0xbf, 0x81, 0x7f, 0x73, 0x41,
+  0x81, 0x02, 0x7e, 0x81, 0x7f, 0x71, 0xff, 0xff, 0x41, 0x41, 0x71, 0x00,
+  0xf9, 0x2b, 0x02, 0xf9, 0x75, 0xd5, 0x65, 0xc0, 0x2b, 0x02, 0x39, 0x75,
+  0xd5, 0x35, 0xff, 0xff, 0xc0, 0xc0, 0x35, 0x00, 0xf9, 0x2b, 0x02, 0xac,
+  0x39, 0xd5, 0x05, 0x0f, 0x2b, 0x02, 0x9d, 0x39, 0xd5, 0xb5, 0xff, 0xff,
+  0x0f, 0x0f, 0xb5, 0x00, 0xf9, 0x01, 0x02, 0x08, 0xfd, 0xff, 0xa5, 0x7f,
+  0x01, 0x02, 0x89, 0xfd, 0xff, 0xb4, 0xff, 0xff, 0x7f, 0x7f, 0xb4, 0x00,
+  0xf9, 0x01, 0x02, 0x99, 0xc7, 0xff, 0xd2, 0x0f, 0x01, 0x02, 0x89, 0xc7,
+  0xff, 0xb1, 0xff, 0xff, 0x0f, 0x0f, 0xb1, 0x00, 0xfa, 0x48, 0x48, 0x49,
+  0x3d, 0xdb, 0x31, 0x81, 0x25, 0x02, 0x49, 0x3d, 0xdb, 0x31, 0xff, 0xfd,
+  0x81, 0x81, 0x49, 0x00, 0xfa, 0x48, 0x48, 0x74, 0xb7, 0xbd, 0x08, 0xfe,
+  0x43, 0x02, 0x74, 0xb7, 0xbd, 0x38, 0xff, 0xfd, 0xfe, 0xfe, 0x74, 0x00,
+  0xfa, 0x48, 0x48, 0x7b, 0xb7, 0x88, 0xf2, 0xaa, 0x78, 0x02, 0x7b, 0xb7,
+  0x88, 0xf2, 0xff, 0xfd, 0xaa, 0xaa, 0x7b, 0x00, 0xfa, 0x48, 0x48, 0x6f,
+  0xa6, 0x64, 0xd2, 0x81, 0x9c, 0x02, 0x6f, 0xa6, 0x64, 0xf2, 0xff, 0xfd,
+  0x81, 0x81, 0x6f, 0x00, 0xfb, 0x00, 0x03, 0x40, 0x86, 0x00, 0xa4, 0x40,
+  0x00, 0x03, 0xfe, 0x86, 0x00, 0xb4, 0xff, 0xff, 0x40, 0x41, 0xb4, 0x00,
+  0xfb, 0x00, 0x03, 0x35, 0xbe, 0x00, 0x24, 0x7f, 0x00, 0x03, 0xb4, 0xbe,
+  0x00, 0xf4, 0xff, 0xff, 0x7f, 0x80, 0xf4, 0x00, 0xfb, 0xff, 0x02, 0xd3,
+  0x36, 0x01, 0xb3, 0xaa, 0xff, 0x02, 0x28, 0x36, 0x01, 0x31, 0xff, 0xff,
+  0xaa, 0xab, 0x31, 0x00, 0xfb, 0xff, 0x02, 0x30, 0xd1, 0x01, 0x87, 0x0f,
+  0xff, 0x02, 0x20, 0xd1, 0x01, 0x35, 0xff, 0xff, 0x0f, 0x10, 0x35, 0x00,
+  0xfb, 0x81, 0x02, 0x37, 0x79, 0x7f, 0x06, 0x00, 0x81, 0x02, 0x35, 0x79,
+  0x7f, 0x35, 0xff, 0xff, 0x00, 0x01, 0x35, 0x00, 0xfb, 0x81, 0x02, 0xaf,
+  0xff, 0x7f, 0x91, 0x41, 0x81, 0x02, 0x6d, 0xff, 0x7f, 0x71, 0xff, 0xff,
+  0x41, 0x42, 0x71, 0x00, 0xfb, 0x2b, 0x02, 0x62, 0x0e, 0xd5, 0xd1, 0x02,
+  0x2b, 0x02, 0x5f, 0x0e, 0xd5, 0x31, 0xff, 0xff, 0x02, 0x03, 0x31, 0x00,
+  0xfb, 0x2b, 0x02, 0x07, 0x0e, 0xd5, 0xc5, 0x40, 0x2b, 0x02, 0xc6, 0x0e,
+  0xd5, 0xb4, 0xff, 0xff, 0x40, 0x41, 0xb4, 0x00, 0xfb, 0x01, 0x02, 0x09,
+  0x02, 0xff, 0xf5, 0x40, 0x01, 0x02, 0xc8, 0x02, 0xff, 0xb4, 0xff, 0xff,
+  0x40, 0x41, 0xb4, 0x00, 0xfb, 0x01, 0x02, 0xfd, 0xfb, 0xff, 0x32, 0xff,
+  0x01, 0x02, 0xfc, 0xfb, 0xff, 0xb1, 0xff, 0xff, 0xff, 0x00, 0xb1, 0x00,
+  0xfc, 0x00, 0x03, 0x50, 0x00, 0xad, 0xaf, 0x81, 0x53, 0x02, 0x50, 0x00,
+  0xad, 0xbf, 0xff, 0xff, 0x81, 0x81, 0xbf, 0x00, 0xfc, 0x00, 0x03, 0x5a,
+  0x00, 0x34, 0xe6, 0xe0, 0xcc, 0x02, 0x5a, 0x00, 0x34, 0xf6, 0xff, 0xff,
+  0xe0, 0xe0, 0xf6, 0x00, 0xfc, 0xff, 0x02, 0xaf, 0x01, 0x0f, 0x1b, 0x81,
+  0xf1, 0x02, 0xaf, 0x01, 0x0f, 0x3b, 0xff, 0xff, 0x81, 0x81, 0x3b, 0x00,
+  0xfc, 0xff, 0x02, 0x31, 0x01, 0xd0, 0xf4, 0x0f, 0x30, 0x02, 0x31, 0x01,
+  0xd0, 0xf4, 0xff, 0xff, 0x0f, 0x0f, 0xf4, 0x00, 0xfc, 0x81, 0x02, 0xf2,
+  0x7f, 0x7c, 0x9f, 0xff, 0x84, 0x02, 0xf2, 0x7f, 0x7c, 0xbf, 0xff, 0xff,
+  0xff, 0xff, 0xbf, 0x00, 0xfc, 0x81, 0x02, 0xd5, 0x7f, 0xb3, 0x5c, 0x80,
+  0x4d, 0x02, 0xd5, 0x7f, 0xb3, 0x7c, 0xff, 0xff, 0x80, 0x80, 0x7c, 0x00,
+  0xfc, 0x2b, 0x02, 0x8f, 0xd5, 0x11, 0x04, 0x7f, 0xef, 0x02, 0x8f, 0xd5,
+  0x11, 0x34, 0xff, 0xff, 0x7f, 0x7f, 0x34, 0x00, 0xfc, 0x2b, 0x02, 0x38,
+  0xd5, 0x7a, 0xfa, 0x80, 0x86, 0x02, 0x38, 0xd5, 0x7a, 0xfa, 0xff, 0xff,
+  0x80, 0x80, 0xfa, 0x00, 0xfc, 0x01, 0x02, 0x0f, 0xff, 0xf5, 0x37, 0xaa,
+  0x0b, 0x02, 0x0f, 0xff, 0xf5, 0x37, 0xff, 0xff, 0xaa, 0xaa, 0x37, 0x00,
+  0xfc, 0x01, 0x02, 0x09, 0xff, 0xe1, 0x09, 0x41, 0x1f, 0x02, 0x09, 0xff,
+  0xe1, 0x39, 0xff, 0xff, 0x41, 0x41, 0x39, 0x00, 0xfd, 0x00, 0x03, 0xf0,
+  0x00, 0xde, 0xa6, 0x7f, 0x22, 0x02, 0x70, 0x00, 0xde, 0x75, 0xff, 0xff,
+  0x7f, 0x7f, 0x75, 0x00, 0xfd, 0x00, 0x03, 0x6b, 0x00, 0xbe, 0xa7, 0xfe,
+  0x42, 0x02, 0x6d, 0x00, 0xbe, 0x34, 0xff, 0xff, 0xfe, 0xfe, 0x34, 0x00,
+  0xfd, 0xff, 0x02, 0xfd, 0x01, 0x4b, 0x32, 0x00, 0xb5, 0x02, 0xfc, 0x01,
+  0x4b, 0xb1, 0xff, 0xff, 0x00, 0x00, 0xb1, 0x00, 0xfd, 0xff, 0x02, 0xdb,
+  0x01, 0x77, 0xb2, 0x3f, 0x89, 0x02, 0x9b, 0x01, 0x77, 0xb1, 0xff, 0xff,
+  0x3f, 0x3f, 0xb1, 0x00, 0xfd, 0x81, 0x02, 0x2b, 0x7f, 0x59, 0x37, 0x3f,
+  0xa7, 0x02, 0xec, 0x7f, 0x59, 0xb4, 0xff, 0xff, 0x3f, 0x3f, 0xb4, 0x00,
+  0xfd, 0x81, 0x02, 0x95, 0x7f, 0x04, 0xb6, 0x81, 0xfc, 0x02, 0x13, 0x7f,
+  0x04, 0x35, 0xff, 0xff, 0x81, 0x81, 0x35, 0x00, 0xfd, 0x2b, 0x02, 0x25,
+  0xd5, 0x57, 0x91, 0xc0, 0xa9, 0x02, 0x65, 0xd5, 0x57, 0x30, 0xff, 0xff,
+  0xc0, 0xc0, 0x30, 0x00, 0xfd, 0x2b, 0x02, 0xa8, 0xd5, 0x6b, 0xb5, 0x81,
+  0x95, 0x02, 0x27, 0xd5, 0x6b, 0x35, 0xff, 0xff, 0x81, 0x81, 0x35, 0x00,
+  0xfd, 0x01, 0x02, 0x7d, 0xff, 0xb1, 0xb3, 0xff, 0x4f, 0x02, 0x7e, 0xff,
+  0xb1, 0x30, 0xff, 0xff, 0xff, 0xff, 0x30, 0x00, 0xfd, 0x01, 0x02, 0xf2,
+  0xff, 0xf7, 0xf4, 0xae, 0x09, 0x02, 0x43, 0xff, 0xf7, 0x35, 0xff, 0xff,
+  0xae, 0xae, 0x35, 0x00, 0xfe, 0x00, 0x03, 0x87, 0x00, 0x2c, 0xbd, 0x3f,
+  0xd4, 0x02, 0x87, 0x00, 0x2c, 0x3d, 0xff, 0xff, 0x3f, 0x40, 0x3d, 0x00,
+  0xfe, 0x00, 0x03, 0x4e, 0x00, 0xa5, 0xd2, 0x81, 0x5b, 0x02, 0x4e, 0x00,
+  0xa5, 0xf0, 0xff, 0xff, 0x81, 0x82, 0xf0, 0x00, 0xfe, 0xff, 0x02, 0x47,
+  0x01, 0x46, 0x12, 0x7f, 0xba, 0x02, 0x47, 0x01, 0x46, 0xb0, 0xff, 0xff,
+  0x7f, 0x80, 0xb0, 0x00, 0xfe, 0xff, 0x02, 0xe3, 0x01, 0xdd, 0x19, 0xaa,
+  0x23, 0x02, 0xe3, 0x01, 0xdd, 0xb9, 0xff, 0xff, 0xaa, 0xab, 0xb9, 0x00,
+  0xfe, 0x81, 0x02, 0x1a, 0x7f, 0xba, 0x24, 0x40, 0x46, 0x02, 0x1a, 0x7f,
+  0xba, 0x34, 0xff, 0xff, 0x40, 0x41, 0x34, 0x00, 0xfe, 0x81, 0x02, 0x09,
+  0x7f, 0xca, 0x36, 0xaa, 0x36, 0x02, 0x09, 0x7f, 0xca, 0xb4, 0xff, 0xff,
+  0xaa, 0xab, 0xb4, 0x00, 0xfe, 0x2b, 0x02, 0xe9, 0xd5, 0xf9, 0xec, 0x3f,
+  0x07, 0x02, 0xe9, 0xd5, 0xf9, 0x7c, 0xff, 0xff, 0x3f, 0x40, 0x7c, 0x00,
+  0xfe, 0x2b, 0x02, 0xd7, 0xd5, 0x11, 0x6e, 0xaa, 0xef, 0x02, 0xd7, 0xd5,
+  0x11, 0xfc, 0xff, 0xff, 0xaa, 0xab, 0xfc, 0x00, 0xfe, 0x01, 0x02, 0x03,
+  0xff, 0xec, 0xe2, 0x40, 0x14, 0x02, 0x03, 0xff, 0xec, 0x70, 0xff, 0xff,
+  0x40, 0x41, 0x70, 0x00, 0xfe, 0x01, 0x02, 0xd8, 0xff, 0xc7, 0x52, 0x81,
+  0x39, 0x02, 0xd8, 0xff, 0xc7, 0xf0, 0xff, 0xff, 0x81, 0x82, 0xf0, 0x00,
+  0xff, 0x00, 0x03, 0xa0, 0x00, 0xb0, 0xb7, 0x80, 0x50, 0x02, 0x1f, 0x00,
+  0xb0, 0x35, 0xff, 0xff, 0x80, 0x81, 0x35, 0x00, 0xff, 0x00, 0x03, 0x8a,
+  0x00, 0xad, 0xc0, 0x7f, 0x53, 0x02, 0x09, 0x00, 0xad, 0x31, 0xff, 0xff,
+  0x7f, 0x80, 0x31, 0x00, 0xff, 0xff, 0x02, 0xc6, 0x01, 0x3f, 0x43, 0x80,
+  0xc1, 0x02, 0x45, 0x01, 0x3f, 0x31, 0xff, 0xff, 0x80, 0x81, 0x31, 0x00,
+  0xff, 0xff, 0x02, 0xa3, 0x01, 0xd7, 0x13, 0x7f, 0x29, 0x02, 0x23, 0x01,
+  0xd7, 0x31, 0xff, 0xff, 0x7f, 0x80, 0x31, 0x00, 0xff, 0x81, 0x02, 0xe7,
+  0x7f, 0x9f, 0x40, 0x01, 0x61, 0x02, 0xe4, 0x7f, 0x9f, 0xb1, 0xff, 0xff,
+  0x01, 0x02, 0xb1, 0x00, 0xff, 0x81, 0x02, 0x2f, 0x7f, 0x5c, 0x05, 0xc0,
+  0xa4, 0x02, 0x6e, 0x7f, 0x5c, 0x34, 0xff, 0xff, 0xc0, 0xc1, 0x34, 0x00,
+  0xff, 0x2b, 0x02, 0x3e, 0xd5, 0x8f, 0xd6, 0xfe, 0x71, 0x02, 0x3e, 0xd5,
+  0x8f, 0x34, 0xff, 0xff, 0xfe, 0xff, 0x34, 0x00, 0xff, 0x2b, 0x02, 0x9f,
+  0xd5, 0x06, 0x64, 0xfe, 0xfa, 0x02, 0x9f, 0xd5, 0x06, 0xb4, 0xff, 0xff,
+  0xfe, 0xff, 0xb4, 0x00, 0xff, 0x01, 0x02, 0xe0, 0xff, 0x12, 0x34, 0x01,
+  0xee, 0x02, 0xdd, 0xff, 0x12, 0xb5, 0xff, 0xff, 0x01, 0x02, 0xb5, 0x00,
+  0xff, 0x01, 0x02, 0xaa, 0xff, 0x6b, 0x50, 0xff, 0x95, 0x02, 0xa9, 0xff,
+  0x6b, 0xb1, 0xff, 0xff, 0xff, 0x00, 0xb1, 0x00, 0x69, 0x67, 0x48, 0x70,
+  0x1f, 0x55, 0xd9, 0x67, 0x00, 0x03, 0x38, 0x1f, 0x55, 0x39, 0x3d, 0xfe,
+  0x67, 0x67, 0x38, 0x00, 0x69, 0x71, 0x48, 0x49, 0x8b, 0x2b, 0x7f, 0x71,
+  0x00, 0x03, 0x21, 0x8b, 0x2b, 0x3d, 0x3d, 0xfe, 0x71, 0x71, 0x21, 0x00,
+  0x69, 0x54, 0x48, 0x31, 0xd2, 0x55, 0xfc, 0x54, 0x00, 0x03, 0x85, 0xd2,
+  0x55, 0x3c, 0x3d, 0xfe, 0x54, 0x54, 0x85, 0x00, 0x69, 0x72, 0x48, 0x36,
+  0xaa, 0x8b, 0x8b, 0x72, 0x00, 0x03, 0x09, 0xaa, 0x8b, 0x39, 0x3d, 0xfe,
+  0x72, 0x72, 0x09, 0x00, 0x69, 0x36, 0x48, 0x32, 0xfa, 0x2f, 0x3a, 0x36,
+  0x00, 0x03, 0x68, 0xfa, 0x2f, 0x38, 0x3d, 0xfe, 0x36, 0x36, 0x68, 0x00,
+  0x69, 0x25, 0x48, 0x06, 0x11, 0x24, 0xab, 0x25, 0x00, 0x03, 0x32, 0x11,
+  0x24, 0x38, 0x3d, 0xfe, 0x25, 0x25, 0x32, 0x00, 0x69, 0x60, 0x48, 0x44,
+  0x73, 0x8c, 0x8b, 0x60, 0x00, 0x03, 0x05, 0x73, 0x8c, 0x39, 0x3d, 0xfe,
+  0x60, 0x60, 0x05, 0x00, 0x69, 0x09, 0x48, 0x68, 0x49, 0x6c, 0xcd, 0x09,
+  0x00, 0x03, 0x78, 0x49, 0x6c, 0x3c, 0x3d, 0xfe, 0x09, 0x09, 0x78, 0x00,
+  0x69, 0x23, 0x48, 0x59, 0x36, 0x2b, 0x68, 0x23, 0x00, 0x03, 0x82, 0x36,
+  0x2b, 0x38, 0x3d, 0xfe, 0x23, 0x23, 0x82, 0x00, 0x69, 0x83, 0x48, 0x99,
+  0x49, 0xb8, 0x9e, 0x83, 0x00, 0x03, 0x82, 0x49, 0xb8, 0x3d, 0x3d, 0xfe,
+  0x83, 0x83, 0x82, 0x00, 0x69, 0x20, 0x48, 0x21, 0xe2, 0x20, 0x8c, 0x20,
+  0x00, 0x03, 0x41, 0xe2, 0x20, 0x3c, 0x3d, 0xfe, 0x20, 0x20, 0x41, 0x00,
+  0x69, 0x16, 0x48, 0x19, 0xc8, 0x3c, 0xb8, 0x16, 0x00, 0x03, 0x35, 0xc8,
+  0x3c, 0x38, 0x3d, 0xfe, 0x16, 0x16, 0x35, 0x00, 0x69, 0x62, 0x48, 0x23,
+  0x12, 0x9a, 0x1a, 0x62, 0x00, 0x03, 0x85, 0x12, 0x9a, 0x38, 0x3d, 0xfe,
+  0x62, 0x62, 0x85, 0x00, 0x69, 0x63, 0x48, 0x51, 0xf0, 0x29, 0x3b, 0x63,
+  0x00, 0x03, 0x15, 0xf0, 0x29, 0x39, 0x3d, 0xfe, 0x63, 0x63, 0x15, 0x00,
+  0x69, 0x16, 0x48, 0x28, 0x53, 0x34, 0x2e, 0x16, 0x00, 0x03, 0x44, 0x53,
+  0x34, 0x3c, 0x3d, 0xfe, 0x16, 0x16, 0x44, 0x00, 0x69, 0x39, 0x48, 0x97,
+  0x52, 0x79, 0xe9, 0x39, 0x00, 0x03, 0x37, 0x52, 0x79, 0x39, 0x3d, 0xfe,
+  0x39, 0x39, 0x37, 0x00, 0x69, 0x32, 0x48, 0x24, 0x79, 0x3f, 0x4c, 0x32,
+  0x00, 0x03, 0x56, 0x79, 0x3f, 0x3c, 0x3d, 0xfe, 0x32, 0x32, 0x56, 0x00,
+  0x69, 0x78, 0x48, 0x89, 0x04, 0x6f, 0xbc, 0x78, 0x00, 0x03, 0x67, 0x04,
+  0x6f, 0x3d, 0x3d, 0xfe, 0x78, 0x78, 0x67, 0x00, 0x69, 0x46, 0x48, 0x46,
+  0x4c, 0x16, 0x4a, 0x46, 0x00, 0x03, 0x92, 0x4c, 0x16, 0x38, 0x3d, 0xfe,
+  0x46, 0x46, 0x92, 0x00, 0x69, 0x48, 0x48, 0x46, 0x4f, 0xfb, 0x38, 0x48,
+  0x00, 0x03, 0x94, 0x4f, 0xfb, 0x38, 0x3d, 0xfe, 0x48, 0x48, 0x94, 0x00,
+  0x69, 0x14, 0x48, 0x41, 0xe0, 0xb3, 0x48, 0x14, 0x00, 0x03, 0x55, 0xe0,
+  0xb3, 0x38, 0x3d, 0xfe, 0x14, 0x14, 0x55, 0x00, 0x69, 0x75, 0x48, 0x91,
+  0xbc, 0xeb, 0x8f, 0x75, 0x00, 0x03, 0x67, 0xbc, 0xeb, 0x3d, 0x3d, 0xfe,
+  0x75, 0x75, 0x67, 0x00, 0x69, 0x54, 0x48, 0x47, 0x3e, 0x1f, 0xd8, 0x54,
+  0x00, 0x03, 0x01, 0x3e, 0x1f, 0x39, 0x3d, 0xfe, 0x54, 0x54, 0x01, 0x00,
+  0x69, 0x27, 0x48, 0x63, 0xc2, 0x9e, 0xf8, 0x27, 0x00, 0x03, 0x90, 0xc2,
+  0x9e, 0x38, 0x3d, 0xfe, 0x27, 0x27, 0x90, 0x00, 0x69, 0x31, 0x48, 0x55,
+  0x34, 0xae, 0x5c, 0x31, 0x00, 0x03, 0x86, 0x34, 0xae, 0x3c, 0x3d, 0xfe,
+  0x31, 0x31, 0x86, 0x00, 0x69, 0x67, 0x48, 0x58, 0xe4, 0x5d, 0xd8, 0x67,
+  0x00, 0x03, 0x25, 0xe4, 0x5d, 0x39, 0x3d, 0xfe, 0x67, 0x67, 0x25, 0x00,
+  0x69, 0x96, 0x48, 0x29, 0x99, 0x7f, 0xd8, 0x96, 0x00, 0x03, 0x25, 0x99,
+  0x7f, 0x39, 0x3d, 0xfe, 0x96, 0x96, 0x25, 0x00, 0x69, 0x87, 0x48, 0x16,
+  0xcb, 0x2d, 0x0f, 0x87, 0x00, 0x03, 0x04, 0xcb, 0x2d, 0x3d, 0x3d, 0xfe,
+  0x87, 0x87, 0x04, 0x00, 0x69, 0x53, 0x48, 0x17, 0x42, 0xb2, 0x5e, 0x53,
+  0x00, 0x03, 0x70, 0x42, 0xb2, 0x3c, 0x3d, 0xfe, 0x53, 0x53, 0x70, 0x00,
+  0x69, 0x22, 0x48, 0x52, 0xe8, 0x9e, 0xe9, 0x22, 0x00, 0x03, 0x75, 0xe8,
+  0x9e, 0x38, 0x3d, 0xfe, 0x22, 0x22, 0x75, 0x00, 0x69, 0x71, 0x48, 0x78,
+  0x96, 0x2e, 0x8d, 0x71, 0x00, 0x03, 0x50, 0x96, 0x2e, 0x3d, 0x3d, 0xfe,
+  0x71, 0x71, 0x50, 0x00, 0x69, 0x15, 0x48, 0x86, 0xef, 0x2a, 0x3e, 0x15,
+  0x00, 0x03, 0x01, 0xef, 0x2a, 0x3d, 0x3d, 0xfe, 0x15, 0x15, 0x01, 0x00,
+  0x69, 0x27, 0x48, 0x56, 0x6d, 0xd4, 0x79, 0x27, 0x00, 0x03, 0x84, 0x6d,
+  0xd4, 0x38, 0x3d, 0xfe, 0x27, 0x27, 0x84, 0x00, 0x69, 0x49, 0x48, 0x09,
+  0xce, 0x86, 0xcd, 0x49, 0x00, 0x03, 0x59, 0xce, 0x86, 0x3c, 0x3d, 0xfe,
+  0x49, 0x49, 0x59, 0x00, 0x69, 0x85, 0x48, 0x97, 0xd8, 0x2e, 0x9b, 0x85,
+  0x00, 0x03, 0x83, 0xd8, 0x2e, 0x39, 0x3d, 0xfe, 0x85, 0x85, 0x83, 0x00,
+  0x69, 0x45, 0x48, 0x12, 0xe1, 0x7c, 0x4b, 0x45, 0x00, 0x03, 0x58, 0xe1,
+  0x7c, 0x38, 0x3d, 0xfe, 0x45, 0x45, 0x58, 0x00, 0x69, 0x15, 0x48, 0x53,
+  0x6e, 0xd6, 0x3c, 0x15, 0x00, 0x03, 0x68, 0x6e, 0xd6, 0x3c, 0x3d, 0xfe,
+  0x15, 0x15, 0x68, 0x00, 0x69, 0x26, 0x48, 0x34, 0x3d, 0xda, 0x4f, 0x26,
+  0x00, 0x03, 0x61, 0x3d, 0xda, 0x3c, 0x3d, 0xfe, 0x26, 0x26, 0x61, 0x00,
+  0x69, 0x96, 0x48, 0x00, 0x99, 0x48, 0x9c, 0x96, 0x00, 0x03, 0x96, 0x99,
+  0x48, 0x3c, 0x3d, 0xfe, 0x96, 0x96, 0x96, 0x00, 0x69, 0x62, 0x48, 0x41,
+  0x28, 0xa4, 0x08, 0x62, 0x00, 0x03, 0x03, 0x28, 0xa4, 0x39, 0x3d, 0xfe,
+  0x62, 0x62, 0x03, 0x00, 0x69, 0x86, 0x48, 0x55, 0x73, 0x1b, 0x29, 0x86,
+  0x00, 0x03, 0x42, 0x73, 0x1b, 0x39, 0x3d, 0xfe, 0x86, 0x86, 0x42, 0x00,
+  0x69, 0x54, 0x48, 0x67, 0x8c, 0x0a, 0xcd, 0x54, 0x00, 0x03, 0x22, 0x8c,
+  0x0a, 0x3d, 0x3d, 0xfe, 0x54, 0x54, 0x22, 0x00, 0x69, 0x52, 0x48, 0x82,
+  0x64, 0x59, 0x58, 0x52, 0x00, 0x03, 0x34, 0x64, 0x59, 0x39, 0x3d, 0xfe,
+  0x52, 0x52, 0x34, 0x00, 0x69, 0x03, 0x48, 0x67, 0x49, 0x06, 0xeb, 0x03,
+  0x00, 0x03, 0x71, 0x49, 0x06, 0x38, 0x3d, 0xfe, 0x03, 0x03, 0x71, 0x00,
+  0x69, 0x35, 0x48, 0x65, 0x26, 0xcf, 0x99, 0x35, 0x00, 0x03, 0x01, 0x26,
+  0xcf, 0x39, 0x3d, 0xfe, 0x35, 0x35, 0x01, 0x00, 0x69, 0x87, 0x48, 0x34,
+  0x6e, 0x3e, 0x4a, 0x87, 0x00, 0x03, 0x21, 0x6e, 0x3e, 0x39, 0x3d, 0xfe,
+  0x87, 0x87, 0x21, 0x00, 0x69, 0x42, 0x48, 0x11, 0x5c, 0x49, 0x98, 0x42,
+  0x00, 0x03, 0x53, 0x5c, 0x49, 0x38, 0x3d, 0xfe, 0x42, 0x42, 0x53, 0x00,
+  0x69, 0x00, 0x48, 0x08, 0x0f, 0x13, 0x5d, 0x00, 0x00, 0x03, 0x09, 0x0f,
+  0x13, 0x3c, 0x3d, 0xfe, 0x00, 0x00, 0x09, 0x00, 0x69, 0x46, 0x48, 0x35,
+  0x45, 0x69, 0x4a, 0x46, 0x00, 0x03, 0x81, 0x45, 0x69, 0x38, 0x3d, 0xfe,
+  0x46, 0x46, 0x81, 0x00, 0x69, 0x78, 0x48, 0x95, 0x81, 0xa8, 0x6e, 0x78,
+  0x00, 0x03, 0x73, 0x81, 0xa8, 0x3d, 0x3d, 0xfe, 0x78, 0x78, 0x73, 0x00,
+  0x69, 0x37, 0x48, 0x24, 0x14, 0x59, 0xbf, 0x37, 0x00, 0x03, 0x62, 0x14,
+  0x59, 0x3c, 0x3d, 0xfe, 0x37, 0x37, 0x62, 0x00, 0x69, 0x55, 0x48, 0x50,
+  0xc2, 0x7d, 0xdc, 0x55, 0x00, 0x03, 0x05, 0xc2, 0x7d, 0x3d, 0x3d, 0xfe,
+  0x55, 0x55, 0x05, 0x00, 0x69, 0x86, 0x48, 0x47, 0xc0, 0xd3, 0x6c, 0x86,
+  0x00, 0x03, 0x33, 0xc0, 0xd3, 0x3d, 0x3d, 0xfe, 0x86, 0x86, 0x33, 0x00,
+  0x69, 0x73, 0x48, 0x72, 0x70, 0xaf, 0xcb, 0x73, 0x00, 0x03, 0x46, 0x70,
+  0xaf, 0x39, 0x3d, 0xfe, 0x73, 0x73, 0x46, 0x00, 0x69, 0x60, 0x48, 0x36,
+  0xc6, 0x5c, 0x3c, 0x60, 0x00, 0x03, 0x96, 0xc6, 0x5c, 0x3c, 0x3d, 0xfe,
+  0x60, 0x60, 0x96, 0x00, 0x69, 0x47, 0x48, 0x13, 0xe4, 0xb3, 0x2b, 0x47,
+  0x00, 0x03, 0x61, 0xe4, 0xb3, 0x38, 0x3d, 0xfe, 0x47, 0x47, 0x61, 0x00,
+  0x69, 0x81, 0x48, 0x85, 0x3e, 0xbd, 0x7b, 0x81, 0x00, 0x03, 0x67, 0x3e,
+  0xbd, 0x39, 0x3d, 0xfe, 0x81, 0x81, 0x67, 0x00, 0x69, 0x64, 0x48, 0x87,
+  0x15, 0x7b, 0xbb, 0x64, 0x00, 0x03, 0x52, 0x15, 0x7b, 0x39, 0x3d, 0xfe,
+  0x64, 0x64, 0x52, 0x00, 0x69, 0x27, 0x48, 0x61, 0x9b, 0x94, 0xfc, 0x27,
+  0x00, 0x03, 0x88, 0x9b, 0x94, 0x3c, 0x3d, 0xfe, 0x27, 0x27, 0x88, 0x00,
+  0x69, 0x53, 0x48, 0x29, 0x2a, 0xc9, 0xd8, 0x53, 0x00, 0x03, 0x82, 0x2a,
+  0xc9, 0x38, 0x3d, 0xfe, 0x53, 0x53, 0x82, 0x00, 0x69, 0x62, 0x48, 0x38,
+  0x77, 0x3a, 0x5e, 0x62, 0x00, 0x03, 0x00, 0x77, 0x3a, 0x3d, 0x3d, 0xfe,
+  0x62, 0x62, 0x00, 0x00, 0x69, 0x48, 0x48, 0x59, 0x30, 0xf1, 0xd9, 0x48,
+  0x00, 0x03, 0x08, 0x30, 0xf1, 0x39, 0x3d, 0xfe, 0x48, 0x48, 0x08, 0x00,
+  0x69, 0x18, 0x48, 0x71, 0x4b, 0xaa, 0xcb, 0x18, 0x00, 0x03, 0x90, 0x4b,
+  0xaa, 0x38, 0x3d, 0xfe, 0x18, 0x18, 0x90, 0x00, 0x69, 0x17, 0x48, 0x66,
+  0x3b, 0x74, 0xba, 0x17, 0x00, 0x03, 0x83, 0x3b, 0x74, 0x38, 0x3d, 0xfe,
+  0x17, 0x17, 0x83, 0x00, 0x69, 0x12, 0x48, 0x50, 0x32, 0xf9, 0x9b, 0x12,
+  0x00, 0x03, 0x63, 0x32, 0xf9, 0x38, 0x3d, 0xfe, 0x12, 0x12, 0x63, 0x00,
+  0x69, 0x37, 0x48, 0x34, 0x74, 0x9b, 0x2a, 0x37, 0x00, 0x03, 0x71, 0x74,
+  0x9b, 0x38, 0x3d, 0xfe, 0x37, 0x37, 0x71, 0x00, 0x69, 0x33, 0x48, 0x46,
+  0x8f, 0xa7, 0x5a, 0x33, 0x00, 0x03, 0x79, 0x8f, 0xa7, 0x38, 0x3d, 0xfe,
+  0x33, 0x33, 0x79, 0x00, 0x69, 0x52, 0x48, 0x95, 0x58, 0x08, 0x4b, 0x52,
+  0x00, 0x03, 0x48, 0x58, 0x08, 0x39, 0x3d, 0xfe, 0x52, 0x52, 0x48, 0x00,
+  0x69, 0x08, 0x48, 0x88, 0xb3, 0xca, 0x0d, 0x08, 0x00, 0x03, 0x97, 0xb3,
+  0xca, 0x3c, 0x3d, 0xfe, 0x08, 0x08, 0x97, 0x00, 0x69, 0x69, 0x48, 0x65,
+  0xbf, 0x01, 0x7d, 0x69, 0x00, 0x03, 0x35, 0xbf, 0x01, 0x3d, 0x3d, 0xfe,
+  0x69, 0x69, 0x35, 0x00, 0x69, 0x16, 0x48, 0x96, 0x0d, 0xb2, 0xf9, 0x16,
+  0x00, 0x03, 0x13, 0x0d, 0xb2, 0x39, 0x3d, 0xfe, 0x16, 0x16, 0x13, 0x00,
+  0x69, 0x51, 0x48, 0x73, 0x6d, 0x19, 0xfd, 0x51, 0x00, 0x03, 0x25, 0x6d,
+  0x19, 0x3d, 0x3d, 0xfe, 0x51, 0x51, 0x25, 0x00, 0x69, 0x21, 0x48, 0x46,
+  0x46, 0x88, 0x8f, 0x21, 0x00, 0x03, 0x68, 0x46, 0x88, 0x3c, 0x3d, 0xfe,
+  0x21, 0x21, 0x68, 0x00, 0x69, 0x63, 0x48, 0x32, 0xd9, 0x49, 0x2a, 0x63,
+  0x00, 0x03, 0x95, 0xd9, 0x49, 0x38, 0x3d, 0xfe, 0x63, 0x63, 0x95, 0x00,
+  0x69, 0x38, 0x48, 0x11, 0x92, 0x6c, 0xb8, 0x38, 0x00, 0x03, 0x49, 0x92,
+  0x6c, 0x38, 0x3d, 0xfe, 0x38, 0x38, 0x49, 0x00, 0x69, 0x72, 0x48, 0x45,
+  0x06, 0xc9, 0xaf, 0x72, 0x00, 0x03, 0x18, 0x06, 0xc9, 0x3d, 0x3d, 0xfe,
+  0x72, 0x72, 0x18, 0x00, 0x69, 0x85, 0x48, 0x41, 0xf3, 0xb5, 0xd9, 0x85,
+  0x00, 0x03, 0x27, 0xf3, 0xb5, 0x39, 0x3d, 0xfe, 0x85, 0x85, 0x27, 0x00,
+  0x69, 0x42, 0x48, 0x66, 0x7c, 0x8e, 0x1e, 0x42, 0x00, 0x03, 0x08, 0x7c,
+  0x8e, 0x3d, 0x3d, 0xfe, 0x42, 0x42, 0x08, 0x00, 0x69, 0x80, 0x48, 0x24,
+  0x17, 0xa0, 0xc9, 0x80, 0x00, 0x03, 0x05, 0x17, 0xa0, 0x39, 0x3d, 0xfe,
+  0x80, 0x80, 0x05, 0x00, 0x69, 0x46, 0x48, 0x30, 0xfb, 0xfc, 0xec, 0x46,
+  0x00, 0x03, 0x76, 0xfb, 0xfc, 0x3c, 0x3d, 0xfe, 0x46, 0x46, 0x76, 0x00,
+  0x69, 0x09, 0x48, 0x71, 0x99, 0xe6, 0x8c, 0x09, 0x00, 0x03, 0x80, 0x99,
+  0xe6, 0x3c, 0x3d, 0xfe, 0x09, 0x09, 0x80, 0x00, 0x69, 0x13, 0x48, 0x52,
+  0xc5, 0xd3, 0x5e, 0x13, 0x00, 0x03, 0x65, 0xc5, 0xd3, 0x3c, 0x3d, 0xfe,
+  0x13, 0x13, 0x65, 0x00, 0x69, 0x21, 0x48, 0x77, 0x78, 0xb7, 0x4b, 0x21,
+  0x00, 0x03, 0x99, 0x78, 0xb7, 0x38, 0x3d, 0xfe, 0x21, 0x21, 0x99, 0x00,
+  0x69, 0x99, 0x48, 0x42, 0xd4, 0xa5, 0x8b, 0x99, 0x00, 0x03, 0x42, 0xd4,
+  0xa5, 0x39, 0x3d, 0xfe, 0x99, 0x99, 0x42, 0x00, 0x69, 0x65, 0x48, 0x83,
+  0xb3, 0x87, 0x28, 0x65, 0x00, 0x03, 0x48, 0xb3, 0x87, 0x39, 0x3d, 0xfe,
+  0x65, 0x65, 0x48, 0x00, 0x69, 0x86, 0x48, 0x62, 0x00, 0x85, 0x2d, 0x86,
+  0x00, 0x03, 0x49, 0x00, 0x85, 0x3d, 0x3d, 0xfe, 0x86, 0x86, 0x49, 0x00,
+  0x69, 0x08, 0x48, 0x13, 0xf8, 0x27, 0x5b, 0x08, 0x00, 0x03, 0x22, 0xf8,
+  0x27, 0x38, 0x3d, 0xfe, 0x08, 0x08, 0x22, 0x00, 0x69, 0x04, 0x48, 0x59,
+  0xdd, 0x05, 0xdd, 0x04, 0x00, 0x03, 0x64, 0xdd, 0x05, 0x3c, 0x3d, 0xfe,
+  0x04, 0x04, 0x64, 0x00, 0x69, 0x18, 0x48, 0x25, 0x1e, 0x9d, 0xdf, 0x18,
+  0x00, 0x03, 0x44, 0x1e, 0x9d, 0x3c, 0x3d, 0xfe, 0x18, 0x18, 0x44, 0x00,
+  0x69, 0x66, 0x48, 0x34, 0x7d, 0xd6, 0xaa, 0x66, 0x00, 0x03, 0x00, 0x7d,
+  0xd6, 0x39, 0x3d, 0xfe, 0x66, 0x66, 0x00, 0x00, 0x69, 0x50, 0x48, 0x90,
+  0xc9, 0x7a, 0x0c, 0x50, 0x00, 0x03, 0x40, 0xc9, 0x7a, 0x3d, 0x3d, 0xfe,
+  0x50, 0x50, 0x40, 0x00, 0x69, 0x06, 0x48, 0x68, 0x63, 0x49, 0xfb, 0x06,
+  0x00, 0x03, 0x75, 0x63, 0x49, 0x38, 0x3d, 0xfe, 0x06, 0x06, 0x75, 0x00,
+  0x69, 0x02, 0x48, 0x21, 0x22, 0x87, 0xbb, 0x02, 0x00, 0x03, 0x24, 0x22,
+  0x87, 0x38, 0x3d, 0xfe, 0x02, 0x02, 0x24, 0x00, 0x69, 0x17, 0x48, 0x73,
+  0xa6, 0x24, 0x3e, 0x17, 0x00, 0x03, 0x90, 0xa6, 0x24, 0x3c, 0x3d, 0xfe,
+  0x17, 0x17, 0x90, 0x00, 0x69, 0x11, 0x48, 0x77, 0x56, 0xd4, 0x99, 0x11,
+  0x00, 0x03, 0x89, 0x56, 0xd4, 0x38, 0x3d, 0xfe, 0x11, 0x11, 0x89, 0x00,
+  0x69, 0x53, 0x48, 0x19, 0x5b, 0xf1, 0x5e, 0x53, 0x00, 0x03, 0x72, 0x5b,
+  0xf1, 0x3c, 0x3d, 0xfe, 0x53, 0x53, 0x72, 0x00, 0x69, 0x42, 0x48, 0x17,
+  0x4a, 0xf6, 0x28, 0x42, 0x00, 0x03, 0x59, 0x4a, 0xf6, 0x38, 0x3d, 0xfe,
+  0x42, 0x42, 0x59, 0x00, 0x69, 0x58, 0x48, 0x55, 0xbd, 0xba, 0xfe, 0x58,
+  0x00, 0x03, 0x13, 0xbd, 0xba, 0x3d, 0x3d, 0xfe, 0x58, 0x58, 0x13, 0x00,
+  0x69, 0x29, 0x48, 0x62, 0x36, 0xf1, 0x3c, 0x29, 0x00, 0x03, 0x91, 0x36,
+  0xf1, 0x3c, 0x3d, 0xfe, 0x29, 0x29, 0x91, 0x00, 0x69, 0x69, 0x48, 0x73,
+  0xf4, 0x93, 0x8f, 0x69, 0x00, 0x03, 0x43, 0xf4, 0x93, 0x3d, 0x3d, 0xfe,
+  0x69, 0x69, 0x43, 0x00, 0x65, 0x30, 0x48, 0x49, 0xc2, 0xdf, 0xdb, 0x20,
+  0x00, 0x03, 0x70, 0xc2, 0xdf, 0x38, 0x3d, 0xfe, 0x20, 0x20, 0x70, 0x00,
+  0x65, 0x30, 0x48, 0x92, 0xd3, 0xae, 0xed, 0x66, 0x00, 0x03, 0x59, 0xd3,
+  0xae, 0x3d, 0x3d, 0xfe, 0x66, 0x66, 0x59, 0x00, 0x65, 0x30, 0x48, 0x76,
+  0x75, 0x92, 0x5e, 0x15, 0x00, 0x03, 0x91, 0x75, 0x92, 0x3c, 0x3d, 0xfe,
+  0x15, 0x15, 0x91, 0x00, 0x65, 0x30, 0x48, 0x24, 0xce, 0xc8, 0xbc, 0x72,
+  0x00, 0x03, 0x96, 0xce, 0xc8, 0x3c, 0x3d, 0xfe, 0x72, 0x72, 0x96, 0x00,
+  0x65, 0x30, 0x48, 0x52, 0x1b, 0xc7, 0x8e, 0x12, 0x00, 0x03, 0x64, 0x1b,
+  0xc7, 0x3c, 0x3d, 0xfe, 0x12, 0x12, 0x64, 0x00, 0x65, 0x30, 0x48, 0x06,
+  0x2a, 0x15, 0x9b, 0x82, 0x00, 0x03, 0x89, 0x2a, 0x15, 0x38, 0x3d, 0xfe,
+  0x82, 0x82, 0x89, 0x00, 0x65, 0x30, 0x48, 0x23, 0x8f, 0x55, 0xa8, 0x20,
+  0x00, 0x03, 0x43, 0x8f, 0x55, 0x38, 0x3d, 0xfe, 0x20, 0x20, 0x43, 0x00,
+  0x65, 0x30, 0x48, 0x04, 0x30, 0x30, 0x2f, 0x03, 0x00, 0x03, 0x08, 0x30,
+  0x30, 0x3c, 0x3d, 0xfe, 0x03, 0x03, 0x08, 0x00, 0x65, 0x30, 0x48, 0x12,
+  0x27, 0x00, 0x39, 0x35, 0x00, 0x03, 0x48, 0x27, 0x00, 0x38, 0x3d, 0xfe,
+  0x35, 0x35, 0x48, 0x00, 0x65, 0x30, 0x48, 0x60, 0x0c, 0xd7, 0x08, 0x53,
+  0x00, 0x03, 0x13, 0x0c, 0xd7, 0x39, 0x3d, 0xfe, 0x53, 0x53, 0x13, 0x00,
+  0x65, 0x30, 0x48, 0x60, 0x2c, 0x45, 0x6d, 0x76, 0x00, 0x03, 0x37, 0x2c,
+  0x45, 0x3d, 0x3d, 0xfe, 0x76, 0x76, 0x37, 0x00, 0x65, 0x30, 0x48, 0x59,
+  0xa1, 0x9d, 0xaf, 0x11, 0x00, 0x03, 0x71, 0xa1, 0x9d, 0x3c, 0x3d, 0xfe,
+  0x11, 0x11, 0x71, 0x00, 0x65, 0x30, 0x48, 0x71, 0xff, 0x84, 0x6d, 0x67,
+  0x00, 0x03, 0x39, 0xff, 0x84, 0x3d, 0x3d, 0xfe, 0x67, 0x67, 0x39, 0x00,
+  0x65, 0x30, 0x48, 0x11, 0xcd, 0xf5, 0x9f, 0x08, 0x00, 0x03, 0x20, 0xcd,
+  0xf5, 0x3c, 0x3d, 0xfe, 0x08, 0x08, 0x20, 0x00, 0x65, 0x30, 0x48, 0x81,
+  0x13, 0x9e, 0xb9, 0x35, 0x00, 0x03, 0x17, 0x13, 0x9e, 0x39, 0x3d, 0xfe,
+  0x35, 0x35, 0x17, 0x00, 0x65, 0x30, 0x48, 0x35, 0xc4, 0x10, 0xad, 0x18,
+  0x00, 0x03, 0x54, 0xc4, 0x10, 0x3c, 0x3d, 0xfe, 0x18, 0x18, 0x54, 0x00,
+  0x65, 0x30, 0x48, 0x00, 0x51, 0x18, 0x2d, 0x60, 0x00, 0x03, 0x61, 0x51,
+  0x18, 0x3c, 0x3d, 0xfe, 0x60, 0x60, 0x61, 0x00, 0x65, 0x30, 0x48, 0x63,
+  0x7e, 0x12, 0xba, 0x19, 0x00, 0x03, 0x82, 0x7e, 0x12, 0x38, 0x3d, 0xfe,
+  0x19, 0x19, 0x82, 0x00, 0x65, 0x30, 0x48, 0x56, 0x91, 0xe3, 0x3e, 0x40,
+  0x00, 0x03, 0x96, 0x91, 0xe3, 0x3c, 0x3d, 0xfe, 0x40, 0x40, 0x96, 0x00,
+  0x65, 0x30, 0x48, 0x08, 0x73, 0x95, 0x48, 0x72, 0x00, 0x03, 0x80, 0x73,
+  0x95, 0x38, 0x3d, 0xfe, 0x72, 0x72, 0x80, 0x00, 0x65, 0x30, 0x48, 0x03,
+  0x7d, 0xb7, 0x9a, 0x00, 0x00, 0x03, 0x03, 0x7d, 0xb7, 0x38, 0x3d, 0xfe,
+  0x00, 0x00, 0x03, 0x00, 0x65, 0x30, 0x48, 0x16, 0xaf, 0xfe, 0xf8, 0x42,
+  0x00, 0x03, 0x58, 0xaf, 0xfe, 0x38, 0x3d, 0xfe, 0x42, 0x42, 0x58, 0x00,
+  0x65, 0x30, 0x48, 0x88, 0x0f, 0xe1, 0xd8, 0x97, 0x00, 0x03, 0x85, 0x0f,
+  0xe1, 0x39, 0x3d, 0xfe, 0x97, 0x97, 0x85, 0x00, 0x65, 0x30, 0x48, 0x29,
+  0xf3, 0xe6, 0x5d, 0x54, 0x00, 0x03, 0x84, 0xf3, 0xe6, 0x3c, 0x3d, 0xfe,
+  0x54, 0x54, 0x84, 0x00, 0x65, 0x30, 0x48, 0x91, 0xb0, 0x99, 0x2d, 0x16,
+  0x00, 0x03, 0x08, 0xb0, 0x99, 0x3d, 0x3d, 0xfe, 0x16, 0x16, 0x08, 0x00,
+  0x65, 0x30, 0x48, 0x87, 0xd4, 0x6d, 0xbe, 0x58, 0x00, 0x03, 0x45, 0xd4,
+  0x6d, 0x3d, 0x3d, 0xfe, 0x58, 0x58, 0x45, 0x00, 0x65, 0x30, 0x48, 0x27,
+  0xf0, 0x2e, 0xc9, 0x68, 0x00, 0x03, 0x96, 0xf0, 0x2e, 0x38, 0x3d, 0xfe,
+  0x68, 0x68, 0x96, 0x00, 0x65, 0x30, 0x48, 0x54, 0x9e, 0xb9, 0xc9, 0x56,
+  0x00, 0x03, 0x11, 0x9e, 0xb9, 0x39, 0x3d, 0xfe, 0x56, 0x56, 0x11, 0x00,
+  0x65, 0x30, 0x48, 0x21, 0x96, 0x2e, 0xff, 0x59, 0x00, 0x03, 0x81, 0x96,
+  0x2e, 0x3c, 0x3d, 0xfe, 0x59, 0x59, 0x81, 0x00, 0x65, 0x30, 0x48, 0x79,
+  0x4f, 0x96, 0x5b, 0x78, 0x00, 0x03, 0x58, 0x4f, 0x96, 0x39, 0x3d, 0xfe,
+  0x78, 0x78, 0x58, 0x00, 0x65, 0x30, 0x48, 0x81, 0xa5, 0x20, 0x8e, 0x64,
+  0x00, 0x03, 0x45, 0xa5, 0x20, 0x3d, 0x3d, 0xfe, 0x64, 0x64, 0x45, 0x00,
+  0x65, 0x30, 0x48, 0x71, 0x20, 0x51, 0x8a, 0x30, 0x00, 0x03, 0x01, 0x20,
+  0x51, 0x39, 0x3d, 0xfe, 0x30, 0x30, 0x01, 0x00, 0x65, 0x30, 0x48, 0x20,
+  0x51, 0x25, 0x39, 0x62, 0x00, 0x03, 0x83, 0x51, 0x25, 0x38, 0x3d, 0xfe,
+  0x62, 0x62, 0x83, 0x00, 0x65, 0x30, 0x48, 0x13, 0xd3, 0xe6, 0x8b, 0x85,
+  0x00, 0x03, 0x99, 0xd3, 0xe6, 0x38, 0x3d, 0xfe, 0x85, 0x85, 0x99, 0x00,
+  0x65, 0x30, 0x48, 0x90, 0x10, 0xcf, 0x39, 0x00, 0x00, 0x03, 0x91, 0x10,
+  0xcf, 0x38, 0x3d, 0xfe, 0x00, 0x00, 0x91, 0x00, 0x65, 0x30, 0x48, 0x04,
+  0x2a, 0x82, 0x8c, 0x32, 0x00, 0x03, 0x36, 0x2a, 0x82, 0x3c, 0x3d, 0xfe,
+  0x32, 0x32, 0x36, 0x00, 0x65, 0x30, 0x48, 0x41, 0xc6, 0xfb, 0xba, 0x68,
+  0x00, 0x03, 0x09, 0xc6, 0xfb, 0x39, 0x3d, 0xfe, 0x68, 0x68, 0x09, 0x00,
+  0x65, 0x30, 0x48, 0x91, 0x22, 0xab, 0x8f, 0x24, 0x00, 0x03, 0x16, 0x22,
+  0xab, 0x3d, 0x3d, 0xfe, 0x24, 0x24, 0x16, 0x00, 0x65, 0x30, 0x48, 0x21,
+  0xeb, 0x7a, 0x9f, 0x98, 0x00, 0x03, 0x20, 0xeb, 0x7a, 0x3d, 0x3d, 0xfe,
+  0x98, 0x98, 0x20, 0x00, 0x65, 0x30, 0x48, 0x70, 0xf3, 0x40, 0xfc, 0x22,
+  0x00, 0x03, 0x92, 0xf3, 0x40, 0x3c, 0x3d, 0xfe, 0x22, 0x22, 0x92, 0x00,
+  0x65, 0x30, 0x48, 0x84, 0x84, 0x22, 0x7a, 0x86, 0x00, 0x03, 0x70, 0x84,
+  0x22, 0x39, 0x3d, 0xfe, 0x86, 0x86, 0x70, 0x00, 0x65, 0x30, 0x48, 0x97,
+  0x9e, 0xf1, 0xec, 0x84, 0x00, 0x03, 0x81, 0x9e, 0xf1, 0x3d, 0x3d, 0xfe,
+  0x84, 0x84, 0x81, 0x00, 0x65, 0x30, 0x48, 0x89, 0xd0, 0x9b, 0x9e, 0x32,
+  0x00, 0x03, 0x21, 0xd0, 0x9b, 0x3d, 0x3d, 0xfe, 0x32, 0x32, 0x21, 0x00,
+  0x65, 0x30, 0x48, 0x12, 0x1c, 0xed, 0x49, 0x79, 0x00, 0x03, 0x92, 0x1c,
+  0xed, 0x38, 0x3d, 0xfe, 0x79, 0x79, 0x92, 0x00, 0x65, 0x30, 0x48, 0x76,
+  0xf1, 0xdd, 0x2e, 0x82, 0x00, 0x03, 0x58, 0xf1, 0xdd, 0x3d, 0x3d, 0xfe,
+  0x82, 0x82, 0x58, 0x00, 0x65, 0x30, 0x48, 0x54, 0xe2, 0x9d, 0x6b, 0x67,
+  0x00, 0x03, 0x22, 0xe2, 0x9d, 0x39, 0x3d, 0xfe, 0x67, 0x67, 0x22, 0x00,
+  0x65, 0x30, 0x48, 0x21, 0x89, 0x35, 0x6c, 0x68, 0x00, 0x03, 0x89, 0x89,
+  0x35, 0x3c, 0x3d, 0xfe, 0x68, 0x68, 0x89, 0x00, 0x65, 0x30, 0x48, 0x82,
+  0x44, 0x39, 0xff, 0x24, 0x00, 0x03, 0x07, 0x44, 0x39, 0x3d, 0x3d, 0xfe,
+  0x24, 0x24, 0x07, 0x00, 0x65, 0x30, 0x48, 0x67, 0x2d, 0x6d, 0x4f, 0x43,
+  0x00, 0x03, 0x11, 0x2d, 0x6d, 0x3d, 0x3d, 0xfe, 0x43, 0x43, 0x11, 0x00,
+  0x65, 0x30, 0x48, 0x21, 0xa4, 0x27, 0xbe, 0x43, 0x00, 0x03, 0x64, 0xa4,
+  0x27, 0x3c, 0x3d, 0xfe, 0x43, 0x43, 0x64, 0x00, 0x65, 0x30, 0x48, 0x18,
+  0x76, 0xbb, 0x2b, 0x38, 0x00, 0x03, 0x57, 0x76, 0xbb, 0x38, 0x3d, 0xfe,
+  0x38, 0x38, 0x57, 0x00, 0x65, 0x30, 0x48, 0x77, 0xbf, 0xcc, 0xfd, 0x61,
+  0x00, 0x03, 0x39, 0xbf, 0xcc, 0x3d, 0x3d, 0xfe, 0x61, 0x61, 0x39, 0x00,
+  0x65, 0x30, 0x48, 0x52, 0x97, 0xd0, 0x58, 0x64, 0x00, 0x03, 0x16, 0x97,
+  0xd0, 0x39, 0x3d, 0xfe, 0x64, 0x64, 0x16, 0x00, 0x65, 0x30, 0x48, 0x10,
+  0xe8, 0x42, 0x7e, 0x76, 0x00, 0x03, 0x86, 0xe8, 0x42, 0x3c, 0x3d, 0xfe,
+  0x76, 0x76, 0x86, 0x00, 0x65, 0x30, 0x48, 0x81, 0xff, 0x07, 0xe9, 0x75,
+  0x00, 0x03, 0x57, 0xff, 0x07, 0x39, 0x3d, 0xfe, 0x75, 0x75, 0x57, 0x00,
+  0x65, 0x30, 0x48, 0x62, 0x49, 0x49, 0xce, 0x56, 0x00, 0x03, 0x18, 0x49,
+  0x49, 0x3d, 0x3d, 0xfe, 0x56, 0x56, 0x18, 0x00, 0x65, 0x30, 0x48, 0x61,
+  0xc1, 0x74, 0x1c, 0x10, 0x00, 0x03, 0x71, 0xc1, 0x74, 0x3c, 0x3d, 0xfe,
+  0x10, 0x10, 0x71, 0x00, 0x65, 0x30, 0x48, 0x36, 0xa8, 0xf6, 0x5a, 0x96,
+  0x00, 0x03, 0x32, 0xa8, 0xf6, 0x39, 0x3d, 0xfe, 0x96, 0x96, 0x32, 0x00,
+  0x65, 0x30, 0x48, 0x20, 0x45, 0x05, 0x58, 0x88, 0x00, 0x03, 0x08, 0x45,
+  0x05, 0x39, 0x3d, 0xfe, 0x88, 0x88, 0x08, 0x00, 0x65, 0x30, 0x48, 0x07,
+  0x4c, 0x62, 0x8a, 0x01, 0x00, 0x03, 0x08, 0x4c, 0x62, 0x38, 0x3d, 0xfe,
+  0x01, 0x01, 0x08, 0x00, 0x65, 0x30, 0x48, 0x20, 0xd3, 0x7e, 0x9a, 0x26,
+  0x00, 0x03, 0x46, 0xd3, 0x7e, 0x38, 0x3d, 0xfe, 0x26, 0x26, 0x46, 0x00,
+  0x65, 0x30, 0x48, 0x35, 0x07, 0xe8, 0x4b, 0x45, 0x00, 0x03, 0x81, 0x07,
+  0xe8, 0x38, 0x3d, 0xfe, 0x45, 0x45, 0x81, 0x00, 0x65, 0x30, 0x48, 0x48,
+  0x89, 0xd5, 0x8d, 0x41, 0x00, 0x03, 0x90, 0x89, 0xd5, 0x3c, 0x3d, 0xfe,
+  0x41, 0x41, 0x90, 0x00, 0x65, 0x30, 0x48, 0x73, 0xef, 0x9c, 0x8e, 0x63,
+  0x00, 0x03, 0x36, 0xef, 0x9c, 0x3d, 0x3d, 0xfe, 0x63, 0x63, 0x36, 0x00,
+  0x65, 0x30, 0x48, 0x74, 0xe0, 0xd4, 0xc8, 0x92, 0x00, 0x03, 0x66, 0xe0,
+  0xd4, 0x39, 0x3d, 0xfe, 0x92, 0x92, 0x66, 0x00, 0x65, 0x30, 0x48, 0x44,
+  0x31, 0x9b, 0x8a, 0x15, 0x00, 0x03, 0x59, 0x31, 0x9b, 0x38, 0x3d, 0xfe,
+  0x15, 0x15, 0x59, 0x00, 0x65, 0x30, 0x48, 0x83, 0x3a, 0x10, 0x3c, 0x62,
+  0x00, 0x03, 0x45, 0x3a, 0x10, 0x3d, 0x3d, 0xfe, 0x62, 0x62, 0x45, 0x00,
+  0x65, 0x30, 0x48, 0x72, 0xe0, 0x45, 0x28, 0x58, 0x00, 0x03, 0x30, 0xe0,
+  0x45, 0x39, 0x3d, 0xfe, 0x58, 0x58, 0x30, 0x00, 0x65, 0x30, 0x48, 0x89,
+  0x63, 0x34, 0x89, 0x70, 0x00, 0x03, 0x60, 0x63, 0x34, 0x39, 0x3d, 0xfe,
+  0x70, 0x70, 0x60, 0x00, 0x65, 0x30, 0x48, 0x03, 0x49, 0x80, 0x09, 0x80,
+  0x00, 0x03, 0x84, 0x49, 0x80, 0x38, 0x3d, 0xfe, 0x80, 0x80, 0x84, 0x00,
+  0x65, 0x30, 0x48, 0x23, 0xf7, 0xb2, 0xc9, 0x67, 0x00, 0x03, 0x91, 0xf7,
+  0xb2, 0x38, 0x3d, 0xfe, 0x67, 0x67, 0x91, 0x00, 0x65, 0x30, 0x48, 0x35,
+  0xa4, 0x25, 0x6c, 0x64, 0x00, 0x03, 0x99, 0xa4, 0x25, 0x3c, 0x3d, 0xfe,
+  0x64, 0x64, 0x99, 0x00, 0x65, 0x30, 0x48, 0x71, 0xb5, 0x39, 0xbe, 0x71,
+  0x00, 0x03, 0x42, 0xb5, 0x39, 0x3d, 0x3d, 0xfe, 0x71, 0x71, 0x42, 0x00,
+  0x65, 0x30, 0x48, 0x97, 0xbd, 0xbf, 0x3d, 0x65, 0x00, 0x03, 0x63, 0xbd,
+  0xbf, 0x3d, 0x3d, 0xfe, 0x65, 0x65, 0x63, 0x00, 0x65, 0x30, 0x48, 0x73,
+  0x87, 0x21, 0x7e, 0x65, 0x00, 0x03, 0x38, 0x87, 0x21, 0x3d, 0x3d, 0xfe,
+  0x65, 0x65, 0x38, 0x00, 0x65, 0x30, 0x48, 0x10, 0xdf, 0xe9, 0xec, 0x81,
+  0x00, 0x03, 0x91, 0xdf, 0xe9, 0x3c, 0x3d, 0xfe, 0x81, 0x81, 0x91, 0x00,
+  0x65, 0x30, 0x48, 0x67, 0x5f, 0x84, 0xb9, 0x03, 0x00, 0x03, 0x71, 0x5f,
+  0x84, 0x38, 0x3d, 0xfe, 0x03, 0x03, 0x71, 0x00, 0x65, 0x30, 0x48, 0x70,
+  0x86, 0xec, 0xae, 0x89, 0x00, 0x03, 0x59, 0x86, 0xec, 0x3d, 0x3d, 0xfe,
+  0x89, 0x89, 0x59, 0x00, 0x65, 0x30, 0x48, 0x94, 0xb0, 0xd8, 0x1b, 0x10,
+  0x00, 0x03, 0x05, 0xb0, 0xd8, 0x39, 0x3d, 0xfe, 0x10, 0x10, 0x05, 0x00,
+  0x65, 0x30, 0x48, 0x68, 0x46, 0xf3, 0x1e, 0x80, 0x00, 0x03, 0x48, 0x46,
+  0xf3, 0x3d, 0x3d, 0xfe, 0x80, 0x80, 0x48, 0x00, 0x65, 0x30, 0x48, 0x80,
+  0xcd, 0xdf, 0x8f, 0x57, 0x00, 0x03, 0x38, 0xcd, 0xdf, 0x3d, 0x3d, 0xfe,
+  0x57, 0x57, 0x38, 0x00, 0x65, 0x30, 0x48, 0x61, 0x02, 0x3d, 0x4a, 0x26,
+  0x00, 0x03, 0x87, 0x02, 0x3d, 0x38, 0x3d, 0xfe, 0x26, 0x26, 0x87, 0x00,
+  0x65, 0x30, 0x48, 0x77, 0xfe, 0xdc, 0xbe, 0x58, 0x00, 0x03, 0x35, 0xfe,
+  0xdc, 0x3d, 0x3d, 0xfe, 0x58, 0x58, 0x35, 0x00, 0x65, 0x30, 0x48, 0x45,
+  0x17, 0x69, 0x1e, 0x20, 0x00, 0x03, 0x65, 0x17, 0x69, 0x3c, 0x3d, 0xfe,
+  0x20, 0x20, 0x65, 0x00, 0x65, 0x30, 0x48, 0x36, 0x27, 0xb0, 0x7b, 0x03,
+  0x00, 0x03, 0x40, 0x27, 0xb0, 0x38, 0x3d, 0xfe, 0x03, 0x03, 0x40, 0x00,
+  0x65, 0x30, 0x48, 0x62, 0xce, 0xc0, 0x3d, 0x13, 0x00, 0x03, 0x76, 0xce,
+  0xc0, 0x3c, 0x3d, 0xfe, 0x13, 0x13, 0x76, 0x00, 0x65, 0x30, 0x48, 0x42,
+  0x44, 0x7f, 0x78, 0x92, 0x00, 0x03, 0x34, 0x44, 0x7f, 0x39, 0x3d, 0xfe,
+  0x92, 0x92, 0x34, 0x00, 0x65, 0x30, 0x48, 0x81, 0x07, 0x02, 0x1f, 0x81,
+  0x00, 0x03, 0x63, 0x07, 0x02, 0x3d, 0x3d, 0xfe, 0x81, 0x81, 0x63, 0x00,
+  0x65, 0x30, 0x48, 0x86, 0xb7, 0xfd, 0x38, 0x67, 0x00, 0x03, 0x53, 0xb7,
+  0xfd, 0x39, 0x3d, 0xfe, 0x67, 0x67, 0x53, 0x00, 0x65, 0x30, 0x48, 0x63,
+  0xd6, 0xcd, 0xbe, 0x07, 0x00, 0x03, 0x70, 0xd6, 0xcd, 0x3c, 0x3d, 0xfe,
+  0x07, 0x07, 0x70, 0x00, 0x65, 0x30, 0x48, 0x32, 0xb5, 0xf7, 0x8f, 0x05,
+  0x00, 0x03, 0x38, 0xb5, 0xf7, 0x3c, 0x3d, 0xfe, 0x05, 0x05, 0x38, 0x00,
+  0x65, 0x30, 0x48, 0x41, 0xf4, 0xaa, 0x89, 0x77, 0x00, 0x03, 0x19, 0xf4,
+  0xaa, 0x39, 0x3d, 0xfe, 0x77, 0x77, 0x19, 0x00, 0x65, 0x30, 0x48, 0x20,
+  0xf0, 0x92, 0xd9, 0x47, 0x00, 0x03, 0x68, 0xf0, 0x92, 0x38, 0x3d, 0xfe,
+  0x47, 0x47, 0x68, 0x00, 0x65, 0x30, 0x48, 0x02, 0x56, 0xf6, 0xdf, 0x43,
+  0x00, 0x03, 0x46, 0x56, 0xf6, 0x3c, 0x3d, 0xfe, 0x43, 0x43, 0x46, 0x00,
+  0x65, 0x30, 0x48, 0x96, 0x38, 0x8a, 0xcd, 0x99, 0x00, 0x03, 0x96, 0x38,
+  0x8a, 0x3d, 0x3d, 0xfe, 0x99, 0x99, 0x96, 0x00, 0x65, 0x30, 0x48, 0x40,
+  0xcd, 0x61, 0x2e, 0x80, 0x00, 0x03, 0x20, 0xcd, 0x61, 0x3d, 0x3d, 0xfe,
+  0x80, 0x80, 0x20, 0x00, 0x65, 0x30, 0x48, 0x02, 0x89, 0xf7, 0xec, 0x20,
+  0x00, 0x03, 0x22, 0x89, 0xf7, 0x3c, 0x3d, 0xfe, 0x20, 0x20, 0x22, 0x00,
+  0x65, 0x30, 0x48, 0x16, 0xf0, 0x27, 0x5d, 0x69, 0x00, 0x03, 0x86, 0xf0,
+  0x27, 0x3c, 0x3d, 0xfe, 0x69, 0x69, 0x86, 0x00, 0x65, 0x30, 0x48, 0x12,
+  0xed, 0x5a, 0xaa, 0x91, 0x00, 0x03, 0x03, 0xed, 0x5a, 0x39, 0x3d, 0xfe,
+  0x91, 0x91, 0x03, 0x00, 0x65, 0x30, 0x48, 0x68, 0x90, 0x89, 0xfd, 0x06,
+  0x00, 0x03, 0x75, 0x90, 0x89, 0x3c, 0x3d, 0xfe, 0x06, 0x06, 0x75, 0x00,
+  0xe9, 0x18, 0x48, 0x39, 0x20, 0x2f, 0x3c, 0x18, 0x00, 0x03, 0x20, 0x20,
+  0x2f, 0x3d, 0x3d, 0xfe, 0x18, 0x18, 0x20, 0x00, 0xe9, 0x61, 0x48, 0x83,
+  0xc0, 0x4d, 0x98, 0x61, 0x00, 0x03, 0x21, 0xc0, 0x4d, 0x39, 0x3d, 0xfe,
+  0x61, 0x61, 0x21, 0x00, 0xe9, 0x94, 0x48, 0x42, 0x92, 0xbf, 0x6f, 0x94,
+  0x00, 0x03, 0x48, 0x92, 0xbf, 0x3c, 0x3d, 0xfe, 0x94, 0x94, 0x48, 0x00,
+  0xe9, 0x02, 0x48, 0x60, 0xd0, 0x1f, 0xac, 0x02, 0x00, 0x03, 0x57, 0xd0,
+  0x1f, 0x3d, 0x3d, 0xfe, 0x02, 0x02, 0x57, 0x00, 0xe9, 0x74, 0x48, 0x28,
+  0xa2, 0x1e, 0xac, 0x74, 0x00, 0x03, 0x53, 0xa2, 0x1e, 0x3c, 0x3d, 0xfe,
+  0x74, 0x74, 0x53, 0x00, 0xe9, 0x73, 0x48, 0x80, 0xba, 0x6a, 0x9f, 0x73,
+  0x00, 0x03, 0x07, 0xba, 0x6a, 0x3d, 0x3d, 0xfe, 0x73, 0x73, 0x07, 0x00,
+  0xe9, 0x24, 0x48, 0x28, 0x66, 0xd2, 0x5d, 0x24, 0x00, 0x03, 0x04, 0x66,
+  0xd2, 0x3d, 0x3d, 0xfe, 0x24, 0x24, 0x04, 0x00, 0xe9, 0x23, 0x48, 0x51,
+  0x8d, 0xe7, 0x8e, 0x23, 0x00, 0x03, 0x27, 0x8d, 0xe7, 0x3d, 0x3d, 0xfe,
+  0x23, 0x23, 0x27, 0x00, 0xe9, 0x54, 0x48, 0x92, 0xdd, 0x00, 0x6d, 0x54,
+  0x00, 0x03, 0x38, 0xdd, 0x00, 0x3d, 0x3d, 0xfe, 0x54, 0x54, 0x38, 0x00,
+  0xe9, 0x36, 0x48, 0x26, 0xa9, 0x68, 0x3a, 0x36, 0x00, 0x03, 0x89, 0xa9,
+  0x68, 0x38, 0x3d, 0xfe, 0x36, 0x36, 0x89, 0x00, 0xe9, 0x60, 0x48, 0x48,
+  0x07, 0x77, 0xdf, 0x60, 0x00, 0x03, 0x88, 0x07, 0x77, 0x3c, 0x3d, 0xfe,
+  0x60, 0x60, 0x88, 0x00, 0xe9, 0x08, 0x48, 0x46, 0xab, 0x0a, 0xdc, 0x08,
+  0x00, 0x03, 0x37, 0xab, 0x0a, 0x3d, 0x3d, 0xfe, 0x08, 0x08, 0x37, 0x00,
+  0xe9, 0x09, 0x48, 0x66, 0xdf, 0x1c, 0x68, 0x09, 0x00, 0x03, 0x56, 0xdf,
+  0x1c, 0x39, 0x3d, 0xfe, 0x09, 0x09, 0x56, 0x00, 0xe9, 0x55, 0x48, 0x83,
+  0xd6, 0xc9, 0xdc, 0x55, 0x00, 0x03, 0x27, 0xd6, 0xc9, 0x3d, 0x3d, 0xfe,
+  0x55, 0x55, 0x27, 0x00, 0xe9, 0x95, 0x48, 0x07, 0x4f, 0x98, 0x3e, 0x95,
+  0x00, 0x03, 0x11, 0x4f, 0x98, 0x3c, 0x3d, 0xfe, 0x95, 0x95, 0x11, 0x00,
+  0xe9, 0x13, 0x48, 0x73, 0x62, 0x4c, 0x19, 0x13, 0x00, 0x03, 0x60, 0x62,
+  0x4c, 0x39, 0x3d, 0xfe, 0x13, 0x13, 0x60, 0x00, 0xe9, 0x30, 0x48, 0x09,
+  0x94, 0x7a, 0x5f, 0x30, 0x00, 0x03, 0x79, 0x94, 0x7a, 0x3c, 0x3d, 0xfe,
+  0x30, 0x30, 0x79, 0x00, 0xe9, 0x93, 0x48, 0x04, 0x4d, 0x53, 0x58, 0x93,
+  0x00, 0x03, 0x10, 0x4d, 0x53, 0x38, 0x3d, 0xfe, 0x93, 0x93, 0x10, 0x00,
+  0xe9, 0x71, 0x48, 0x09, 0xc8, 0xf6, 0x79, 0x71, 0x00, 0x03, 0x38, 0xc8,
+  0xf6, 0x38, 0x3d, 0xfe, 0x71, 0x71, 0x38, 0x00, 0xe9, 0x38, 0x48, 0x44,
+  0x0d, 0x99, 0xea, 0x38, 0x00, 0x03, 0x05, 0x0d, 0x99, 0x39, 0x3d, 0xfe,
+  0x38, 0x38, 0x05, 0x00, 0xe9, 0x28, 0x48, 0x12, 0xff, 0xdd, 0x98, 0x28,
+  0x00, 0x03, 0x83, 0xff, 0xdd, 0x38, 0x3d, 0xfe, 0x28, 0x28, 0x83, 0x00,
+  0xe9, 0x52, 0x48, 0x93, 0xd6, 0x3f, 0x29, 0x52, 0x00, 0x03, 0x41, 0xd6,
+  0x3f, 0x39, 0x3d, 0xfe, 0x52, 0x52, 0x41, 0x00, 0xe9, 0x16, 0x48, 0x66,
+  0x46, 0xd5, 0x0a, 0x16, 0x00, 0x03, 0x49, 0x46, 0xd5, 0x39, 0x3d, 0xfe,
+  0x16, 0x16, 0x49, 0x00, 0xe9, 0x40, 0x48, 0x61, 0xba, 0x9b, 0x68, 0x40,
+  0x00, 0x03, 0x20, 0xba, 0x9b, 0x39, 0x3d, 0xfe, 0x40, 0x40, 0x20, 0x00,
+  0xe9, 0x67, 0x48, 0x86, 0x6d, 0x33, 0x88, 0x67, 0x00, 0x03, 0x18, 0x6d,
+  0x33, 0x39, 0x3d, 0xfe, 0x67, 0x67, 0x18, 0x00, 0xe9, 0x09, 0x48, 0x91,
+  0x8a, 0x90, 0x8b, 0x09, 0x00, 0x03, 0x82, 0x8a, 0x90, 0x39, 0x3d, 0xfe,
+  0x09, 0x09, 0x82, 0x00, 0xe9, 0x82, 0x48, 0x32, 0xb3, 0xc0, 0x09, 0x82,
+  0x00, 0x03, 0x50, 0xb3, 0xc0, 0x38, 0x3d, 0xfe, 0x82, 0x82, 0x50, 0x00,
+  0xe9, 0x64, 0x48, 0x49, 0x20, 0x5e, 0xbe, 0x64, 0x00, 0x03, 0x84, 0x20,
+  0x5e, 0x3c, 0x3d, 0xfe, 0x64, 0x64, 0x84, 0x00, 0xe9, 0x24, 0x48, 0x08,
+  0x51, 0x2b, 0xef, 0x24, 0x00, 0x03, 0x84, 0x51, 0x2b, 0x3c, 0x3d, 0xfe,
+  0x24, 0x24, 0x84, 0x00, 0xe9, 0x95, 0x48, 0x94, 0xfa, 0x2b, 0x6b, 0x95,
+  0x00, 0x03, 0x99, 0xfa, 0x2b, 0x38, 0x3d, 0xfe, 0x95, 0x95, 0x99, 0x00,
+  0xe9, 0x79, 0x48, 0x40, 0xaa, 0x36, 0x78, 0x79, 0x00, 0x03, 0x60, 0xaa,
+  0x36, 0x38, 0x3d, 0xfe, 0x79, 0x79, 0x60, 0x00, 0xe9, 0x43, 0x48, 0x87,
+  0x5f, 0x73, 0xcc, 0x43, 0x00, 0x03, 0x43, 0x5f, 0x73, 0x3d, 0x3d, 0xfe,
+  0x43, 0x43, 0x43, 0x00, 0xe9, 0x95, 0x48, 0x36, 0x3d, 0xd3, 0x1c, 0x95,
+  0x00, 0x03, 0x40, 0x3d, 0xd3, 0x3c, 0x3d, 0xfe, 0x95, 0x95, 0x40, 0x00,
+  0xe9, 0x63, 0x48, 0x58, 0x50, 0x65, 0x4a, 0x63, 0x00, 0x03, 0x94, 0x50,
+  0x65, 0x38, 0x3d, 0xfe, 0x63, 0x63, 0x94, 0x00, 0xe9, 0x65, 0x48, 0x40,
+  0x3e, 0xa7, 0x4a, 0x65, 0x00, 0x03, 0x74, 0x3e, 0xa7, 0x38, 0x3d, 0xfe,
+  0x65, 0x65, 0x74, 0x00, 0xe9, 0x93, 0x48, 0x53, 0xe5, 0x9b, 0x5b, 0x93,
+  0x00, 0x03, 0x60, 0xe5, 0x9b, 0x38, 0x3d, 0xfe, 0x93, 0x93, 0x60, 0x00,
+  0xe9, 0x85, 0x48, 0x52, 0xed, 0x12, 0xdb, 0x85, 0x00, 0x03, 0x67, 0xed,
+  0x12, 0x38, 0x3d, 0xfe, 0x85, 0x85, 0x67, 0x00, 0xe9, 0x77, 0x48, 0x54,
+  0xdc, 0xcb, 0x0a, 0x77, 0x00, 0x03, 0x76, 0xdc, 0xcb, 0x38, 0x3d, 0xfe,
+  0x77, 0x77, 0x76, 0x00, 0xe9, 0x44, 0x48, 0x35, 0xb8, 0x0b, 0xb9, 0x44,
+  0x00, 0x03, 0x91, 0xb8, 0x0b, 0x38, 0x3d, 0xfe, 0x44, 0x44, 0x91, 0x00,
+  0xe9, 0x93, 0x48, 0x78, 0x77, 0xe4, 0x19, 0x93, 0x00, 0x03, 0x85, 0x77,
+  0xe4, 0x38, 0x3d, 0xfe, 0x93, 0x93, 0x85, 0x00, 0xe9, 0x14, 0x48, 0x17,
+  0x71, 0x02, 0x7e, 0x14, 0x00, 0x03, 0x02, 0x71, 0x02, 0x3d, 0x3d, 0xfe,
+  0x14, 0x14, 0x02, 0x00, 0xe9, 0x73, 0x48, 0x92, 0x6d, 0x07, 0xdd, 0x73,
+  0x00, 0x03, 0x19, 0x6d, 0x07, 0x3d, 0x3d, 0xfe, 0x73, 0x73, 0x19, 0x00,
+  0xe9, 0x30, 0x48, 0x73, 0xed, 0x23, 0x7c, 0x30, 0x00, 0x03, 0x42, 0xed,
+  0x23, 0x3d, 0x3d, 0xfe, 0x30, 0x30, 0x42, 0x00, 0xe9, 0x48, 0x48, 0x34,
+  0xc2, 0x84, 0x1b, 0x48, 0x00, 0x03, 0x86, 0xc2, 0x84, 0x38, 0x3d, 0xfe,
+  0x48, 0x48, 0x86, 0x00, 0xe9, 0x63, 0x48, 0x27, 0xd8, 0x57, 0x0c, 0x63,
+  0x00, 0x03, 0x63, 0xd8, 0x57, 0x3c, 0x3d, 0xfe, 0x63, 0x63, 0x63, 0x00,
+  0xe9, 0x80, 0x48, 0x59, 0x40, 0xd5, 0xa9, 0x80, 0x00, 0x03, 0x79, 0x40,
+  0xd5, 0x38, 0x3d, 0xfe, 0x80, 0x80, 0x79, 0x00, 0xe9, 0x62, 0x48, 0x37,
+  0xe1, 0x3a, 0xeb, 0x62, 0x00, 0x03, 0x75, 0xe1, 0x3a, 0x38, 0x3d, 0xfe,
+  0x62, 0x62, 0x75, 0x00, 0xe9, 0x41, 0x48, 0x76, 0x3c, 0x9a, 0xed, 0x41,
+  0x00, 0x03, 0x35, 0x3c, 0x9a, 0x3d, 0x3d, 0xfe, 0x41, 0x41, 0x35, 0x00,
+  0xe9, 0x31, 0x48, 0x70, 0x4c, 0x2b, 0x6c, 0x31, 0x00, 0x03, 0x38, 0x4c,
+  0x2b, 0x3d, 0x3d, 0xfe, 0x31, 0x31, 0x38, 0x00, 0xe9, 0x85, 0x48, 0x43,
+  0xd9, 0xb3, 0xf9, 0x85, 0x00, 0x03, 0x58, 0xd9, 0xb3, 0x38, 0x3d, 0xfe,
+  0x85, 0x85, 0x58, 0x00, 0xe9, 0x08, 0x48, 0x98, 0x23, 0x81, 0x79, 0x08,
+  0x00, 0x03, 0x90, 0x23, 0x81, 0x39, 0x3d, 0xfe, 0x08, 0x08, 0x90, 0x00,
+  0xe9, 0x36, 0x48, 0x42, 0xf7, 0x2a, 0xfb, 0x36, 0x00, 0x03, 0x06, 0xf7,
+  0x2a, 0x39, 0x3d, 0xfe, 0x36, 0x36, 0x06, 0x00, 0xe9, 0x06, 0x48, 0x09,
+  0xb4, 0x5d, 0xcb, 0x06, 0x00, 0x03, 0x03, 0xb4, 0x5d, 0x39, 0x3d, 0xfe,
+  0x06, 0x06, 0x03, 0x00, 0xe9, 0x55, 0x48, 0x20, 0x12, 0x93, 0xb9, 0x55,
+  0x00, 0x03, 0x65, 0x12, 0x93, 0x38, 0x3d, 0xfe, 0x55, 0x55, 0x65, 0x00,
+  0xe9, 0x24, 0x48, 0x66, 0x61, 0x32, 0x1c, 0x24, 0x00, 0x03, 0x41, 0x61,
+  0x32, 0x3d, 0x3d, 0xfe, 0x24, 0x24, 0x41, 0x00, 0xe9, 0x09, 0x48, 0x75,
+  0xfd, 0xf8, 0xcb, 0x09, 0x00, 0x03, 0x66, 0xfd, 0xf8, 0x39, 0x3d, 0xfe,
+  0x09, 0x09, 0x66, 0x00, 0xe9, 0x27, 0x48, 0x21, 0x52, 0x82, 0x4f, 0x27,
+  0x00, 0x03, 0x94, 0x52, 0x82, 0x3c, 0x3d, 0xfe, 0x27, 0x27, 0x94, 0x00,
+  0xe9, 0x66, 0x48, 0x63, 0xdd, 0x82, 0x59, 0x66, 0x00, 0x03, 0x97, 0xdd,
+  0x82, 0x38, 0x3d, 0xfe, 0x66, 0x66, 0x97, 0x00, 0xe9, 0x73, 0x48, 0x12,
+  0x1c, 0x78, 0xea, 0x73, 0x00, 0x03, 0x38, 0x1c, 0x78, 0x38, 0x3d, 0xfe,
+  0x73, 0x73, 0x38, 0x00, 0xe9, 0x00, 0x48, 0x70, 0xb1, 0x5d, 0x2b, 0x00,
+  0x00, 0x03, 0x70, 0xb1, 0x5d, 0x39, 0x3d, 0xfe, 0x00, 0x00, 0x70, 0x00,
+  0xe9, 0x18, 0x48, 0x56, 0x4d, 0x7b, 0xdf, 0x18, 0x00, 0x03, 0x38, 0x4d,
+  0x7b, 0x3d, 0x3d, 0xfe, 0x18, 0x18, 0x38, 0x00, 0xe9, 0x08, 0x48, 0x38,
+  0x46, 0x2a, 0x1c, 0x08, 0x00, 0x03, 0x29, 0x46, 0x2a, 0x3d, 0x3d, 0xfe,
+  0x08, 0x08, 0x29, 0x00, 0xe9, 0x59, 0x48, 0x57, 0x72, 0xc4, 0x2a, 0x59,
+  0x00, 0x03, 0x97, 0x72, 0xc4, 0x38, 0x3d, 0xfe, 0x59, 0x59, 0x97, 0x00,
+  0xe9, 0x72, 0x48, 0x24, 0xc6, 0x66, 0xbe, 0x72, 0x00, 0x03, 0x51, 0xc6,
+  0x66, 0x3c, 0x3d, 0xfe, 0x72, 0x72, 0x51, 0x00, 0xe9, 0x04, 0x48, 0x07,
+  0x42, 0xbd, 0x78, 0x04, 0x00, 0x03, 0x02, 0x42, 0xbd, 0x39, 0x3d, 0xfe,
+  0x04, 0x04, 0x02, 0x00, 0xe9, 0x82, 0x48, 0x53, 0xf1, 0xb3, 0x58, 0x82,
+  0x00, 0x03, 0x70, 0xf1, 0xb3, 0x38, 0x3d, 0xfe, 0x82, 0x82, 0x70, 0x00,
+  0xe9, 0x47, 0x48, 0x21, 0xa9, 0xe0, 0x9e, 0x47, 0x00, 0x03, 0x73, 0xa9,
+  0xe0, 0x3c, 0x3d, 0xfe, 0x47, 0x47, 0x73, 0x00, 0xe9, 0x50, 0x48, 0x94,
+  0x41, 0xa1, 0x3d, 0x50, 0x00, 0x03, 0x44, 0x41, 0xa1, 0x3d, 0x3d, 0xfe,
+  0x50, 0x50, 0x44, 0x00, 0xe9, 0x46, 0x48, 0x40, 0xae, 0xe0, 0xec, 0x46,
+  0x00, 0x03, 0x93, 0xae, 0xe0, 0x3c, 0x3d, 0xfe, 0x46, 0x46, 0x93, 0x00,
+  0xe9, 0x24, 0x48, 0x63, 0x74, 0xb0, 0xcb, 0x24, 0x00, 0x03, 0x39, 0x74,
+  0xb0, 0x39, 0x3d, 0xfe, 0x24, 0x24, 0x39, 0x00, 0xe9, 0x24, 0x48, 0x05,
+  0x7c, 0xd8, 0x1b, 0x24, 0x00, 0x03, 0x81, 0x7c, 0xd8, 0x38, 0x3d, 0xfe,
+  0x24, 0x24, 0x81, 0x00, 0xe9, 0x74, 0x48, 0x80, 0x37, 0xdc, 0x1e, 0x74,
+  0x00, 0x03, 0x05, 0x37, 0xdc, 0x3d, 0x3d, 0xfe, 0x74, 0x74, 0x05, 0x00,
+  0xe9, 0x62, 0x48, 0x94, 0x0e, 0x04, 0x7c, 0x62, 0x00, 0x03, 0x31, 0x0e,
+  0x04, 0x3d, 0x3d, 0xfe, 0x62, 0x62, 0x31, 0x00, 0xe9, 0x53, 0x48, 0x71,
+  0x11, 0x86, 0x89, 0x53, 0x00, 0x03, 0x18, 0x11, 0x86, 0x39, 0x3d, 0xfe,
+  0x53, 0x53, 0x18, 0x00, 0xe9, 0x14, 0x48, 0x80, 0xe5, 0x73, 0x38, 0x14,
+  0x00, 0x03, 0x65, 0xe5, 0x73, 0x39, 0x3d, 0xfe, 0x14, 0x14, 0x65, 0x00,
+  0xe9, 0x76, 0x48, 0x43, 0x8e, 0x3d, 0xea, 0x76, 0x00, 0x03, 0x66, 0x8e,
+  0x3d, 0x38, 0x3d, 0xfe, 0x76, 0x76, 0x66, 0x00, 0xe9, 0x03, 0x48, 0x28,
+  0x47, 0xeb, 0xdc, 0x03, 0x00, 0x03, 0x24, 0x47, 0xeb, 0x3d, 0x3d, 0xfe,
+  0x03, 0x03, 0x24, 0x00, 0xe9, 0x18, 0x48, 0x10, 0x79, 0xf3, 0x9c, 0x18,
+  0x00, 0x03, 0x91, 0x79, 0xf3, 0x3c, 0x3d, 0xfe, 0x18, 0x18, 0x91, 0x00,
+  0xe9, 0x93, 0x48, 0x97, 0x98, 0x44, 0x3c, 0x93, 0x00, 0x03, 0x03, 0x98,
+  0x44, 0x3d, 0x3d, 0xfe, 0x93, 0x93, 0x03, 0x00, 0xe9, 0x49, 0x48, 0x47,
+  0x2a, 0x07, 0x9d, 0x49, 0x00, 0x03, 0x98, 0x2a, 0x07, 0x3c, 0x3d, 0xfe,
+  0x49, 0x49, 0x98, 0x00, 0xe9, 0x72, 0x48, 0x24, 0x57, 0x68, 0x8a, 0x72,
+  0x00, 0x03, 0x51, 0x57, 0x68, 0x38, 0x3d, 0xfe, 0x72, 0x72, 0x51, 0x00,
+  0xe9, 0x38, 0x48, 0x68, 0xba, 0xcc, 0x79, 0x38, 0x00, 0x03, 0x30, 0xba,
+  0xcc, 0x39, 0x3d, 0xfe, 0x38, 0x38, 0x30, 0x00, 0xe9, 0x87, 0x48, 0x17,
+  0x78, 0x60, 0x0a, 0x87, 0x00, 0x03, 0x29, 0x78, 0x60, 0x38, 0x3d, 0xfe,
+  0x87, 0x87, 0x29, 0x00, 0xe9, 0x85, 0x48, 0x15, 0x42, 0xa3, 0xb8, 0x85,
+  0x00, 0x03, 0x29, 0x42, 0xa3, 0x38, 0x3d, 0xfe, 0x85, 0x85, 0x29, 0x00,
+  0xe9, 0x32, 0x48, 0x12, 0x2d, 0x32, 0xe9, 0x32, 0x00, 0x03, 0x80, 0x2d,
+  0x32, 0x38, 0x3d, 0xfe, 0x32, 0x32, 0x80, 0x00, 0xe9, 0x23, 0x48, 0x30,
+  0x4f, 0x33, 0x98, 0x23, 0x00, 0x03, 0x06, 0x4f, 0x33, 0x39, 0x3d, 0xfe,
+  0x23, 0x23, 0x06, 0x00, 0xe9, 0x94, 0x48, 0x19, 0x4b, 0x61, 0x0c, 0x94,
+  0x00, 0x03, 0x24, 0x4b, 0x61, 0x3c, 0x3d, 0xfe, 0x94, 0x94, 0x24, 0x00,
+  0xe9, 0x98, 0x48, 0x45, 0x7a, 0xb3, 0x4b, 0x98, 0x00, 0x03, 0x47, 0x7a,
+  0xb3, 0x38, 0x3d, 0xfe, 0x98, 0x98, 0x47, 0x00, 0xe9, 0x51, 0x48, 0x81,
+  0x7c, 0x9c, 0x0b, 0x51, 0x00, 0x03, 0x30, 0x7c, 0x9c, 0x39, 0x3d, 0xfe,
+  0x51, 0x51, 0x30, 0x00, 0xe9, 0x45, 0x48, 0x73, 0x05, 0xab, 0xb9, 0x45,
+  0x00, 0x03, 0x28, 0x05, 0xab, 0x39, 0x3d, 0xfe, 0x45, 0x45, 0x28, 0x00,
+  0xe9, 0x47, 0x48, 0x47, 0x0d, 0x71, 0xa8, 0x47, 0x00, 0x03, 0x99, 0x0d,
+  0x71, 0x38, 0x3d, 0xfe, 0x47, 0x47, 0x99, 0x00, 0xe9, 0x66, 0x48, 0x99,
+  0xbc, 0xe3, 0x48, 0x66, 0x00, 0x03, 0x32, 0xbc, 0xe3, 0x39, 0x3d, 0xfe,
+  0x66, 0x66, 0x32, 0x00, 0xe9, 0x81, 0x48, 0x33, 0x0c, 0xdc, 0xd8, 0x81,
+  0x00, 0x03, 0x51, 0x0c, 0xdc, 0x38, 0x3d, 0xfe, 0x81, 0x81, 0x51, 0x00,
+  0xe9, 0x70, 0x48, 0x81, 0x7f, 0xf6, 0x2e, 0x70, 0x00, 0x03, 0x10, 0x7f,
+  0xf6, 0x3d, 0x3d, 0xfe, 0x70, 0x70, 0x10, 0x00, 0xe9, 0x19, 0x48, 0x68,
+  0x6a, 0xf3, 0x2d, 0x19, 0x00, 0x03, 0x49, 0x6a, 0xf3, 0x3d, 0x3d, 0xfe,
+  0x19, 0x19, 0x49, 0x00, 0xe9, 0x41, 0x48, 0x64, 0xa7, 0x07, 0xbd, 0x41,
+  0x00, 0x03, 0x23, 0xa7, 0x07, 0x3d, 0x3d, 0xfe, 0x41, 0x41, 0x23, 0x00,
+  0xe9, 0x91, 0x48, 0x92, 0xed, 0x98, 0x8f, 0x91, 0x00, 0x03, 0x01, 0xed,
+  0x98, 0x3d, 0x3d, 0xfe, 0x91, 0x91, 0x01, 0x00, 0xe9, 0x98, 0x48, 0x50,
+  0x71, 0x2a, 0x2d, 0x98, 0x00, 0x03, 0x52, 0x71, 0x2a, 0x3c, 0x3d, 0xfe,
+  0x98, 0x98, 0x52, 0x00, 0xe9, 0x50, 0x48, 0x11, 0x26, 0x4e, 0x89, 0x50,
+  0x00, 0x03, 0x61, 0x26, 0x4e, 0x38, 0x3d, 0xfe, 0x50, 0x50, 0x61, 0x00,
+  0xe9, 0x84, 0x48, 0x10, 0x1f, 0x72, 0xad, 0x84, 0x00, 0x03, 0x26, 0x1f,
+  0x72, 0x3c, 0x3d, 0xfe, 0x84, 0x84, 0x26, 0x00, 0xe5, 0x30, 0x48, 0x30,
+  0x2f, 0xff, 0xec, 0x41, 0x00, 0x03, 0x88, 0x2f, 0xff, 0x3c, 0x3d, 0xfe,
+  0x41, 0x41, 0x88, 0x00, 0xe5, 0x30, 0x48, 0x36, 0xfb, 0x0e, 0x99, 0x06,
+  0x00, 0x03, 0x30, 0xfb, 0x0e, 0x39, 0x3d, 0xfe, 0x06, 0x06, 0x30, 0x00,
+  0xe5, 0x30, 0x48, 0x30, 0xae, 0x95, 0x4d, 0x12, 0x00, 0x03, 0x18, 0xae,
+  0x95, 0x3d, 0x3d, 0xfe, 0x12, 0x12, 0x18, 0x00, 0xe5, 0x30, 0x48, 0x47,
+  0x56, 0x87, 0xfd, 0x58, 0x00, 0x03, 0x89, 0x56, 0x87, 0x3c, 0x3d, 0xfe,
+  0x58, 0x58, 0x89, 0x00, 0xe5, 0x30, 0x48, 0x14, 0xba, 0xba, 0xd9, 0x58,
+  0x00, 0x03, 0x56, 0xba, 0xba, 0x38, 0x3d, 0xfe, 0x58, 0x58, 0x56, 0x00,
+  0xe5, 0x30, 0x48, 0x60, 0x45, 0xeb, 0x68, 0x79, 0x00, 0x03, 0x80, 0x45,
+  0xeb, 0x38, 0x3d, 0xfe, 0x79, 0x79, 0x80, 0x00, 0xe5, 0x30, 0x48, 0x10,
+  0x89, 0x56, 0x5d, 0x90, 0x00, 0x03, 0x20, 0x89, 0x56, 0x3c, 0x3d, 0xfe,
+  0x90, 0x90, 0x20, 0x00, 0xe5, 0x30, 0x48, 0x40, 0xa0, 0x22, 0x2c, 0x54,
+  0x00, 0x03, 0x85, 0xa0, 0x22, 0x3c, 0x3d, 0xfe, 0x54, 0x54, 0x85, 0x00,
+  0xe5, 0x30, 0x48, 0x48, 0x7d, 0xa7, 0xac, 0x71, 0x00, 0x03, 0x76, 0x7d,
+  0xa7, 0x3c, 0x3d, 0xfe, 0x71, 0x71, 0x76, 0x00, 0xe5, 0x30, 0x48, 0x70,
+  0x69, 0xc3, 0xde, 0x40, 0x00, 0x03, 0x29, 0x69, 0xc3, 0x3d, 0x3d, 0xfe,
+  0x40, 0x40, 0x29, 0x00, 0xe5, 0x30, 0x48, 0x25, 0x67, 0x0d, 0xf8, 0x25,
+  0x00, 0x03, 0x99, 0x67, 0x0d, 0x38, 0x3d, 0xfe, 0x25, 0x25, 0x99, 0x00,
+  0xe5, 0x30, 0x48, 0x20, 0xc6, 0xff, 0x7e, 0x22, 0x00, 0x03, 0x97, 0xc6,
+  0xff, 0x3c, 0x3d, 0xfe, 0x22, 0x22, 0x97, 0x00, 0xe5, 0x30, 0x48, 0x44,
+  0xe3, 0x47, 0x6b, 0x84, 0x00, 0x03, 0x60, 0xe3, 0x47, 0x38, 0x3d, 0xfe,
+  0x84, 0x84, 0x60, 0x00, 0xe5, 0x30, 0x48, 0x16, 0x5e, 0x75, 0xbf, 0x86,
+  0x00, 0x03, 0x30, 0x5e, 0x75, 0x3c, 0x3d, 0xfe, 0x86, 0x86, 0x30, 0x00,
+  0xe5, 0x30, 0x48, 0x38, 0xfa, 0xf4, 0x4e, 0x84, 0x00, 0x03, 0x53, 0xfa,
+  0xf4, 0x3c, 0x3d, 0xfe, 0x84, 0x84, 0x53, 0x00, 0xe5, 0x30, 0x48, 0x97,
+  0x5f, 0xcf, 0xcc, 0x98, 0x00, 0x03, 0x98, 0x5f, 0xcf, 0x3c, 0x3d, 0xfe,
+  0x98, 0x98, 0x98, 0x00, 0xe5, 0x30, 0x48, 0x15, 0x77, 0x69, 0x6b, 0x92,
+  0x00, 0x03, 0x23, 0x77, 0x69, 0x38, 0x3d, 0xfe, 0x92, 0x92, 0x23, 0x00,
+  0xe5, 0x30, 0x48, 0x26, 0x86, 0x43, 0xfc, 0x34, 0x00, 0x03, 0x91, 0x86,
+  0x43, 0x3c, 0x3d, 0xfe, 0x34, 0x34, 0x91, 0x00, 0xe5, 0x30, 0x48, 0x42,
+  0x46, 0x02, 0xc8, 0x45, 0x00, 0x03, 0x96, 0x46, 0x02, 0x38, 0x3d, 0xfe,
+  0x45, 0x45, 0x96, 0x00, 0xe5, 0x30, 0x48, 0x12, 0x9d, 0x3a, 0xe9, 0x88,
+  0x00, 0x03, 0x24, 0x9d, 0x3a, 0x38, 0x3d, 0xfe, 0x88, 0x88, 0x24, 0x00,
+  0xe5, 0x30, 0x48, 0x76, 0x96, 0x81, 0xd9, 0x41, 0x00, 0x03, 0x35, 0x96,
+  0x81, 0x39, 0x3d, 0xfe, 0x41, 0x41, 0x35, 0x00, 0xe5, 0x30, 0x48, 0x75,
+  0x56, 0x4f, 0x9a, 0x75, 0x00, 0x03, 0x99, 0x56, 0x4f, 0x38, 0x3d, 0xfe,
+  0x75, 0x75, 0x99, 0x00, 0xe5, 0x30, 0x48, 0x06, 0xa8, 0x3e, 0xfc, 0x83,
+  0x00, 0x03, 0x22, 0xa8, 0x3e, 0x3c, 0x3d, 0xfe, 0x83, 0x83, 0x22, 0x00,
+  0xe5, 0x30, 0x48, 0x30, 0x92, 0x82, 0x18, 0x95, 0x00, 0x03, 0x34, 0x92,
+  0x82, 0x38, 0x3d, 0xfe, 0x95, 0x95, 0x34, 0x00, 0xe5, 0x30, 0x48, 0x21,
+  0x49, 0x4c, 0x2c, 0x43, 0x00, 0x03, 0x77, 0x49, 0x4c, 0x3c, 0x3d, 0xfe,
+  0x43, 0x43, 0x77, 0x00, 0xe5, 0x30, 0x48, 0x48, 0xd4, 0x51, 0xe9, 0x05,
+  0x00, 0x03, 0x43, 0xd4, 0x51, 0x39, 0x3d, 0xfe, 0x05, 0x05, 0x43, 0x00,
+  0xe5, 0x30, 0x48, 0x74, 0x97, 0x4b, 0xcc, 0x44, 0x00, 0x03, 0x29, 0x97,
+  0x4b, 0x3d, 0x3d, 0xfe, 0x44, 0x44, 0x29, 0x00, 0xe5, 0x30, 0x48, 0x53,
+  0xf0, 0xaf, 0x5b, 0x19, 0x00, 0x03, 0x34, 0xf0, 0xaf, 0x39, 0x3d, 0xfe,
+  0x19, 0x19, 0x34, 0x00, 0xe5, 0x30, 0x48, 0x31, 0x1e, 0x5e, 0xdf, 0x21,
+  0x00, 0x03, 0x10, 0x1e, 0x5e, 0x3d, 0x3d, 0xfe, 0x21, 0x21, 0x10, 0x00,
+  0xe5, 0x30, 0x48, 0x75, 0xcc, 0xaa, 0x3e, 0x44, 0x00, 0x03, 0x30, 0xcc,
+  0xaa, 0x3d, 0x3d, 0xfe, 0x44, 0x44, 0x30, 0x00, 0xe5, 0x30, 0x48, 0x29,
+  0x83, 0xa6, 0x3f, 0x81, 0x00, 0x03, 0x48, 0x83, 0xa6, 0x3c, 0x3d, 0xfe,
+  0x81, 0x81, 0x48, 0x00, 0xe5, 0x30, 0x48, 0x84, 0x7c, 0x9d, 0x2e, 0x05,
+  0x00, 0x03, 0x78, 0x7c, 0x9d, 0x3d, 0x3d, 0xfe, 0x05, 0x05, 0x78, 0x00,
+  0xe5, 0x30, 0x48, 0x59, 0x78, 0x78, 0x48, 0x89, 0x00, 0x03, 0x69, 0x78,
+  0x78, 0x38, 0x3d, 0xfe, 0x89, 0x89, 0x69, 0x00, 0xe5, 0x30, 0x48, 0x95,
+  0x21, 0xef, 0x7c, 0x88, 0x00, 0x03, 0x06, 0x21, 0xef, 0x3d, 0x3d, 0xfe,
+  0x88, 0x88, 0x06, 0x00, 0xe5, 0x30, 0x48, 0x90, 0xca, 0x65, 0x79, 0x62,
+  0x00, 0x03, 0x28, 0xca, 0x65, 0x39, 0x3d, 0xfe, 0x62, 0x62, 0x28, 0x00,
+  0xe5, 0x30, 0x48, 0x46, 0xf2, 0x37, 0xaf, 0x00, 0x00, 0x03, 0x46, 0xf2,
+  0x37, 0x3d, 0x3d, 0xfe, 0x00, 0x00, 0x46, 0x00, 0xe5, 0x30, 0x48, 0x28,
+  0xba, 0xd6, 0x09, 0x51, 0x00, 0x03, 0x77, 0xba, 0xd6, 0x38, 0x3d, 0xfe,
+  0x51, 0x51, 0x77, 0x00, 0xe5, 0x30, 0x48, 0x79, 0xe8, 0x8f, 0x7b, 0x69,
+  0x00, 0x03, 0x10, 0xe8, 0x8f, 0x39, 0x3d, 0xfe, 0x69, 0x69, 0x10, 0x00,
+  0xe5, 0x30, 0x48, 0x34, 0xa6, 0x2f, 0xca, 0x38, 0x00, 0x03, 0x95, 0xa6,
+  0x2f, 0x38, 0x3d, 0xfe, 0x38, 0x38, 0x95, 0x00, 0xe5, 0x30, 0x48, 0x53,
+  0x55, 0xcd, 0x2b, 0x94, 0x00, 0x03, 0x59, 0x55, 0xcd, 0x38, 0x3d, 0xfe,
+  0x94, 0x94, 0x59, 0x00, 0xe5, 0x30, 0x48, 0x07, 0xca, 0x0b, 0x2c, 0x81,
+  0x00, 0x03, 0x25, 0xca, 0x0b, 0x3c, 0x3d, 0xfe, 0x81, 0x81, 0x25, 0x00,
+  0xe5, 0x30, 0x48, 0x06, 0x01, 0x86, 0x0e, 0x19, 0x00, 0x03, 0x86, 0x01,
+  0x86, 0x3c, 0x3d, 0xfe, 0x19, 0x19, 0x86, 0x00, 0xe5, 0x30, 0x48, 0x91,
+  0x93, 0xdf, 0x59, 0x28, 0x00, 0x03, 0x63, 0x93, 0xdf, 0x39, 0x3d, 0xfe,
+  0x28, 0x28, 0x63, 0x00, 0xe5, 0x30, 0x48, 0x72, 0x13, 0x84, 0x6c, 0x87,
+  0x00, 0x03, 0x84, 0x13, 0x84, 0x3c, 0x3d, 0xfe, 0x87, 0x87, 0x84, 0x00,
+  0xe5, 0x30, 0x48, 0x03, 0xc6, 0x1c, 0x8a, 0x34, 0x00, 0x03, 0x68, 0xc6,
+  0x1c, 0x38, 0x3d, 0xfe, 0x34, 0x34, 0x68, 0x00, 0xe5, 0x30, 0x48, 0x35,
+  0x82, 0x5b, 0x29, 0x78, 0x00, 0x03, 0x57, 0x82, 0x5b, 0x38, 0x3d, 0xfe,
+  0x78, 0x78, 0x57, 0x00, 0xe5, 0x30, 0x48, 0x79, 0xd9, 0xa7, 0x2f, 0x40,
+  0x00, 0x03, 0x39, 0xd9, 0xa7, 0x3d, 0x3d, 0xfe, 0x40, 0x40, 0x39, 0x00,
+  0xe5, 0x30, 0x48, 0x31, 0xed, 0xf8, 0x0b, 0x94, 0x00, 0x03, 0x37, 0xed,
+  0xf8, 0x38, 0x3d, 0xfe, 0x94, 0x94, 0x37, 0x00, 0xe5, 0x30, 0x48, 0x26,
+  0x73, 0x90, 0x5e, 0x57, 0x00, 0x03, 0x68, 0x73, 0x90, 0x3c, 0x3d, 0xfe,
+  0x57, 0x57, 0x68, 0x00, 0xe5, 0x30, 0x48, 0x72, 0xea, 0x92, 0x9e, 0x36,
+  0x00, 0x03, 0x35, 0xea, 0x92, 0x3d, 0x3d, 0xfe, 0x36, 0x36, 0x35, 0x00,
+  0xe5, 0x30, 0x48, 0x39, 0xa0, 0x50, 0x1e, 0x76, 0x00, 0x03, 0x62, 0xa0,
+  0x50, 0x3c, 0x3d, 0xfe, 0x76, 0x76, 0x62, 0x00, 0xe5, 0x30, 0x48, 0x81,
+  0x43, 0x87, 0x2f, 0x82, 0x00, 0x03, 0x99, 0x43, 0x87, 0x3c, 0x3d, 0xfe,
+  0x82, 0x82, 0x99, 0x00, 0xe5, 0x30, 0x48, 0x40, 0x2f, 0xc0, 0x09, 0x34,
+  0x00, 0x03, 0x06, 0x2f, 0xc0, 0x39, 0x3d, 0xfe, 0x34, 0x34, 0x06, 0x00,
+  0xe5, 0x30, 0x48, 0x20, 0xd8, 0x46, 0xbf, 0x44, 0x00, 0x03, 0x76, 0xd8,
+  0x46, 0x3c, 0x3d, 0xfe, 0x44, 0x44, 0x76, 0x00, 0xe5, 0x30, 0x48, 0x05,
+  0xfb, 0xd8, 0x6c, 0x07, 0x00, 0x03, 0x97, 0xfb, 0xd8, 0x3c, 0x3d, 0xfe,
+  0x07, 0x07, 0x97, 0x00, 0xe5, 0x30, 0x48, 0x14, 0x22, 0x35, 0xba, 0x59,
+  0x00, 0x03, 0x54, 0x22, 0x35, 0x38, 0x3d, 0xfe, 0x59, 0x59, 0x54, 0x00,
+  0xe5, 0x30, 0x48, 0x65, 0x73, 0xb8, 0xec, 0x29, 0x00, 0x03, 0x35, 0x73,
+  0xb8, 0x3d, 0x3d, 0xfe, 0x29, 0x29, 0x35, 0x00, 0xe5, 0x30, 0x48, 0x34,
+  0xb8, 0xe8, 0x1a, 0x36, 0x00, 0x03, 0x97, 0xb8, 0xe8, 0x38, 0x3d, 0xfe,
+  0x36, 0x36, 0x97, 0x00, 0xe5, 0x30, 0x48, 0x56, 0xf9, 0x3a, 0x5b, 0x68,
+  0x00, 0x03, 0x88, 0xf9, 0x3a, 0x38, 0x3d, 0xfe, 0x68, 0x68, 0x88, 0x00,
+  0xe5, 0x30, 0x48, 0x38, 0x72, 0xce, 0x5d, 0x36, 0x00, 0x03, 0x02, 0x72,
+  0xce, 0x3d, 0x3d, 0xfe, 0x36, 0x36, 0x02, 0x00, 0xe5, 0x30, 0x48, 0x62,
+  0x59, 0x13, 0x3e, 0x62, 0x00, 0x03, 0x99, 0x59, 0x13, 0x3c, 0x3d, 0xfe,
+  0x62, 0x62, 0x99, 0x00, 0xe5, 0x30, 0x48, 0x20, 0x7f, 0xcb, 0x39, 0x24,
+  0x00, 0x03, 0x96, 0x7f, 0xcb, 0x38, 0x3d, 0xfe, 0x24, 0x24, 0x96, 0x00,
+  0xe5, 0x30, 0x48, 0x65, 0x88, 0x0f, 0x8d, 0x10, 0x00, 0x03, 0x55, 0x88,
+  0x0f, 0x3d, 0x3d, 0xfe, 0x10, 0x10, 0x55, 0x00, 0xe5, 0x30, 0x48, 0x39,
+  0x80, 0x53, 0x4c, 0x49, 0x00, 0x03, 0x89, 0x80, 0x53, 0x3c, 0x3d, 0xfe,
+  0x49, 0x49, 0x89, 0x00, 0xe5, 0x30, 0x48, 0x84, 0x83, 0xbc, 0xa8, 0x17,
+  0x00, 0x03, 0x66, 0x83, 0xbc, 0x39, 0x3d, 0xfe, 0x17, 0x17, 0x66, 0x00,
+  0xe5, 0x30, 0x48, 0x75, 0x05, 0x1e, 0x6a, 0x26, 0x00, 0x03, 0x48, 0x05,
+  0x1e, 0x39, 0x3d, 0xfe, 0x26, 0x26, 0x48, 0x00, 0xe5, 0x30, 0x48, 0x57,
+  0xe1, 0xbe, 0xa8, 0x90, 0x00, 0x03, 0x66, 0xe1, 0xbe, 0x38, 0x3d, 0xfe,
+  0x90, 0x90, 0x66, 0x00, 0xe5, 0x30, 0x48, 0x57, 0x77, 0x5a, 0x9f, 0x19,
+  0x00, 0x03, 0x38, 0x77, 0x5a, 0x3d, 0x3d, 0xfe, 0x19, 0x19, 0x38, 0x00,
+  0xe5, 0x30, 0x48, 0x10, 0x37, 0x11, 0xe9, 0x12, 0x00, 0x03, 0x98, 0x37,
+  0x11, 0x38, 0x3d, 0xfe, 0x12, 0x12, 0x98, 0x00, 0xe5, 0x30, 0x48, 0x13,
+  0x2e, 0xf6, 0x0b, 0x80, 0x00, 0x03, 0x33, 0x2e, 0xf6, 0x38, 0x3d, 0xfe,
+  0x80, 0x80, 0x33, 0x00, 0xe5, 0x30, 0x48, 0x88, 0xfe, 0x6b, 0x48, 0x18,
+  0x00, 0x03, 0x69, 0xfe, 0x6b, 0x39, 0x3d, 0xfe, 0x18, 0x18, 0x69, 0x00,
+  0xe5, 0x30, 0x48, 0x06, 0x45, 0x74, 0xf9, 0x97, 0x00, 0x03, 0x09, 0x45,
+  0x74, 0x38, 0x3d, 0xfe, 0x97, 0x97, 0x09, 0x00, 0xe5, 0x30, 0x48, 0x41,
+  0xb3, 0x8b, 0x69, 0x82, 0x00, 0x03, 0x59, 0xb3, 0x8b, 0x38, 0x3d, 0xfe,
+  0x82, 0x82, 0x59, 0x00, 0xe5, 0x30, 0x48, 0x82, 0x92, 0xf0, 0xe9, 0x40,
+  0x00, 0x03, 0x42, 0x92, 0xf0, 0x39, 0x3d, 0xfe, 0x40, 0x40, 0x42, 0x00,
+  0xe5, 0x30, 0x48, 0x67, 0x00, 0xef, 0x69, 0x75, 0x00, 0x03, 0x92, 0x00,
+  0xef, 0x38, 0x3d, 0xfe, 0x75, 0x75, 0x92, 0x00, 0xe5, 0x30, 0x48, 0x59,
+  0x0b, 0xbd, 0xcd, 0x90, 0x00, 0x03, 0x69, 0x0b, 0xbd, 0x3c, 0x3d, 0xfe,
+  0x90, 0x90, 0x69, 0x00, 0xe5, 0x30, 0x48, 0x45, 0x25, 0x3d, 0xea, 0x16,
+  0x00, 0x03, 0x28, 0x25, 0x3d, 0x39, 0x3d, 0xfe, 0x16, 0x16, 0x28, 0x00,
+  0xe5, 0x30, 0x48, 0x51, 0xd3, 0xa0, 0x8a, 0x56, 0x00, 0x03, 0x94, 0xd3,
+  0xa0, 0x38, 0x3d, 0xfe, 0x56, 0x56, 0x94, 0x00, 0xe5, 0x30, 0x48, 0x42,
+  0xa6, 0x9e, 0x9d, 0x91, 0x00, 0x03, 0x51, 0xa6, 0x9e, 0x3c, 0x3d, 0xfe,
+  0x91, 0x91, 0x51, 0x00, 0xe5, 0x30, 0x48, 0x58, 0x6f, 0x4a, 0xbe, 0x60,
+  0x00, 0x03, 0x97, 0x6f, 0x4a, 0x3c, 0x3d, 0xfe, 0x60, 0x60, 0x97, 0x00,
+  0xe5, 0x30, 0x48, 0x38, 0x4f, 0x10, 0x0e, 0x86, 0x00, 0x03, 0x51, 0x4f,
+  0x10, 0x3c, 0x3d, 0xfe, 0x86, 0x86, 0x51, 0x00, 0xe5, 0x30, 0x48, 0x77,
+  0xe5, 0x47, 0xfb, 0x90, 0x00, 0x03, 0x87, 0xe5, 0x47, 0x38, 0x3d, 0xfe,
+  0x90, 0x90, 0x87, 0x00, 0xe5, 0x30, 0x48, 0x96, 0x0d, 0xb7, 0x4c, 0x68,
+  0x00, 0x03, 0x27, 0x0d, 0xb7, 0x3d, 0x3d, 0xfe, 0x68, 0x68, 0x27, 0x00,
+  0xe5, 0x30, 0x48, 0x68, 0xe2, 0xc0, 0xea, 0x52, 0x00, 0x03, 0x15, 0xe2,
+  0xc0, 0x39, 0x3d, 0xfe, 0x52, 0x52, 0x15, 0x00, 0xe5, 0x30, 0x48, 0x55,
+  0x09, 0xcf, 0xab, 0x01, 0x00, 0x03, 0x54, 0x09, 0xcf, 0x39, 0x3d, 0xfe,
+  0x01, 0x01, 0x54, 0x00, 0xe5, 0x30, 0x48, 0x63, 0xfb, 0x90, 0x4e, 0x38,
+  0x00, 0x03, 0x24, 0xfb, 0x90, 0x3d, 0x3d, 0xfe, 0x38, 0x38, 0x24, 0x00,
+  0xe5, 0x30, 0x48, 0x71, 0x58, 0xf5, 0xbe, 0x71, 0x00, 0x03, 0x99, 0x58,
+  0xf5, 0x3c, 0x3d, 0xfe, 0x71, 0x71, 0x99, 0x00, 0xe5, 0x30, 0x48, 0x41,
+  0x39, 0x91, 0xd8, 0x66, 0x00, 0x03, 0x74, 0x39, 0x91, 0x38, 0x3d, 0xfe,
+  0x66, 0x66, 0x74, 0x00, 0xe5, 0x30, 0x48, 0x21, 0x2f, 0xf1, 0xdb, 0x62,
+  0x00, 0x03, 0x59, 0x2f, 0xf1, 0x38, 0x3d, 0xfe, 0x62, 0x62, 0x59, 0x00,
+  0xe5, 0x30, 0x48, 0x05, 0x7b, 0x6e, 0xee, 0x44, 0x00, 0x03, 0x60, 0x7b,
+  0x6e, 0x3c, 0x3d, 0xfe, 0x44, 0x44, 0x60, 0x00, 0xe5, 0x30, 0x48, 0x89,
+  0xa4, 0xcb, 0xcc, 0x94, 0x00, 0x03, 0x94, 0xa4, 0xcb, 0x3c, 0x3d, 0xfe,
+  0x94, 0x94, 0x94, 0x00, 0xe5, 0x30, 0x48, 0x49, 0xee, 0xa2, 0xce, 0x35,
+  0x00, 0x03, 0x13, 0xee, 0xa2, 0x3d, 0x3d, 0xfe, 0x35, 0x35, 0x13, 0x00,
+  0xe5, 0x30, 0x48, 0x20, 0x63, 0xf7, 0xde, 0x27, 0x00, 0x03, 0x92, 0x63,
+  0xf7, 0x3c, 0x3d, 0xfe, 0x27, 0x27, 0x92, 0x00, 0xe5, 0x30, 0x48, 0x30,
+  0x31, 0x34, 0x8f, 0x97, 0x00, 0x03, 0x33, 0x31, 0x34, 0x3c, 0x3d, 0xfe,
+  0x97, 0x97, 0x33, 0x00, 0xe5, 0x30, 0x48, 0x66, 0x18, 0x3c, 0x49, 0x88,
+  0x00, 0x03, 0x78, 0x18, 0x3c, 0x38, 0x3d, 0xfe, 0x88, 0x88, 0x78, 0x00,
+  0xe5, 0x30, 0x48, 0x16, 0xf1, 0x8a, 0xcd, 0x05, 0x00, 0x03, 0x11, 0xf1,
+  0x8a, 0x3d, 0x3d, 0xfe, 0x05, 0x05, 0x11, 0x00, 0xe5, 0x30, 0x48, 0x98,
+  0xac, 0x5c, 0x4b, 0x81, 0x00, 0x03, 0x17, 0xac, 0x5c, 0x39, 0x3d, 0xfe,
+  0x81, 0x81, 0x17, 0x00, 0xe5, 0x30, 0x48, 0x57, 0x77, 0x89, 0xb9, 0x35,
+  0x00, 0x03, 0x22, 0x77, 0x89, 0x39, 0x3d, 0xfe, 0x35, 0x35, 0x22, 0x00,
+  0xe5, 0x30, 0x48, 0x44, 0xab, 0x33, 0x59, 0x67, 0x00, 0x03, 0x77, 0xab,
+  0x33, 0x38, 0x3d, 0xfe, 0x67, 0x67, 0x77, 0x00, 0xe5, 0x30, 0x48, 0x40,
+  0x9e, 0xbe, 0xbd, 0x09, 0x00, 0x03, 0x31, 0x9e, 0xbe, 0x3d, 0x3d, 0xfe,
+  0x09, 0x09, 0x31, 0x00, 0x69, 0x00, 0x48, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0x00, 0x03, 0x00, 0x00, 0x00, 0x38, 0x3d, 0xfe, 0x00, 0x00, 0x00, 0x00,
+  0xe9, 0x00, 0x48, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x03, 0x99, 0x00,
+  0x00, 0x38, 0x3d, 0xfe, 0x00, 0x00, 0x99, 0x00, 0x69, 0x00, 0x48, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0x38, 0x3d, 0xfe,
+  0x00, 0x00, 0x01, 0x00, 0xe9, 0x00, 0x48, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x00, 0x03, 0x00, 0x00, 0x00, 0x39, 0x3d, 0xfe, 0x00, 0x00, 0x00, 0x00,
+  0x69, 0x01, 0x48, 0x99, 0x00, 0x00, 0x08, 0x01, 0x00, 0x03, 0x00, 0x00,
+  0x00, 0x39, 0x3d, 0xfe, 0x01, 0x01, 0x00, 0x00, 0xe9, 0x01, 0x48, 0x99,
+  0x00, 0x00, 0x08, 0x01, 0x00, 0x03, 0x97, 0x00, 0x00, 0x39, 0x3d, 0xfe,
+  0x01, 0x01, 0x97, 0x00, 0x69, 0x01, 0x48, 0x99, 0x00, 0x00, 0x09, 0x01,
+  0x00, 0x03, 0x01, 0x00, 0x00, 0x39, 0x3d, 0xfe, 0x01, 0x01, 0x01, 0x00,
+  0xe9, 0x01, 0x48, 0x99, 0x00, 0x00, 0x09, 0x01, 0x00, 0x03, 0x98, 0x00,
+  0x00, 0x39, 0x3d, 0xfe, 0x01, 0x01, 0x98, 0x00, 0x69, 0x99, 0x48, 0x99,
+  0x00, 0x00, 0x08, 0x99, 0x00, 0x03, 0x98, 0x00, 0x00, 0x39, 0x3d, 0xfe,
+  0x99, 0x99, 0x98, 0x00, 0xe9, 0x99, 0x48, 0x99, 0x00, 0x00, 0x08, 0x99,
+  0x00, 0x03, 0x99, 0x00, 0x00, 0x38, 0x3d, 0xfe, 0x99, 0x99, 0x99, 0x00,
+  0x69, 0x99, 0x48, 0x99, 0x00, 0x00, 0x09, 0x99, 0x00, 0x03, 0x99, 0x00,
+  0x00, 0x39, 0x3d, 0xfe, 0x99, 0x99, 0x99, 0x00, 0xe9, 0x99, 0x48, 0x99,
+  0x00, 0x00, 0x09, 0x99, 0x00, 0x03, 0x00, 0x00, 0x00, 0x39, 0x3d, 0xfe,
+  0x99, 0x99, 0x00, 0x00, 0x69, 0x50, 0x48, 0x50, 0x00, 0x00, 0x08, 0x50,
+  0x00, 0x03, 0x00, 0x00, 0x00, 0x39, 0x3d, 0xfe, 0x50, 0x50, 0x00, 0x00,
+  0xe9, 0x50, 0x48, 0x50, 0x00, 0x00, 0x08, 0x50, 0x00, 0x03, 0x99, 0x00,
+  0x00, 0x38, 0x3d, 0xfe, 0x50, 0x50, 0x99, 0x00, 0x69, 0x50, 0x48, 0x50,
+  0x00, 0x00, 0x09, 0x50, 0x00, 0x03, 0x01, 0x00, 0x00, 0x39, 0x3d, 0xfe,
+  0x50, 0x50, 0x01, 0x00, 0xe9, 0x50, 0x48, 0x50, 0x00, 0x00, 0x09, 0x50,
+  0x00, 0x03, 0x00, 0x00, 0x00, 0x39, 0x3d, 0xfe, 0x50, 0x50, 0x00, 0x00,
+  0x69, 0x01, 0x48, 0x09, 0x00, 0x00, 0x08, 0x01, 0x00, 0x03, 0x10, 0x00,
+  0x00, 0x38, 0x3d, 0xfe, 0x01, 0x01, 0x10, 0x00, 0xe9, 0x01, 0x48, 0x09,
+  0x00, 0x00, 0x08, 0x01, 0x00, 0x03, 0x07, 0x00, 0x00, 0x39, 0x3d, 0xfe,
+  0x01, 0x01, 0x07, 0x00, 0x69, 0x01, 0x48, 0x09, 0x00, 0x00, 0x09, 0x01,
+  0x00, 0x03, 0x11, 0x00, 0x00, 0x38, 0x3d, 0xfe, 0x01, 0x01, 0x11, 0x00,
+  0xe9, 0x01, 0x48, 0x09, 0x00, 0x00, 0x09, 0x01, 0x00, 0x03, 0x08, 0x00,
+  0x00, 0x39, 0x3d, 0xfe, 0x01, 0x01, 0x08, 0x00, 0x69, 0x09, 0x48, 0x01,
+  0x00, 0x00, 0x08, 0x09, 0x00, 0x03, 0x10, 0x00, 0x00, 0x38, 0x3d, 0xfe,
+  0x09, 0x09, 0x10, 0x00, 0xe9, 0x09, 0x48, 0x01, 0x00, 0x00, 0x08, 0x09,
+  0x00, 0x03, 0x91, 0x00, 0x00, 0x38, 0x3d, 0xfe, 0x09, 0x09, 0x91, 0x00,
+  0x69, 0x09, 0x48, 0x01, 0x00, 0x00, 0x09, 0x09, 0x00, 0x03, 0x11, 0x00,
+  0x00, 0x38, 0x3d, 0xfe, 0x09, 0x09, 0x11, 0x00, 0xe9, 0x09, 0x48, 0x01,
+  0x00, 0x00, 0x09, 0x09, 0x00, 0x03, 0x92, 0x00, 0x00, 0x38, 0x3d, 0xfe,
+  0x09, 0x09, 0x92, 0x00, 0x69, 0x01, 0x48, 0x00, 0x00, 0x00, 0x08, 0x01,
+  0x00, 0x03, 0x01, 0x00, 0x00, 0x38, 0x3d, 0xfe, 0x01, 0x01, 0x01, 0x00,
+  0xe9, 0x01, 0x48, 0x00, 0x00, 0x00, 0x08, 0x01, 0x00, 0x03, 0x98, 0x00,
+  0x00, 0x38, 0x3d, 0xfe, 0x01, 0x01, 0x98, 0x00, 0x69, 0x01, 0x48, 0x00,
+  0x00, 0x00, 0x09, 0x01, 0x00, 0x03, 0x02, 0x00, 0x00, 0x38, 0x3d, 0xfe,
+  0x01, 0x01, 0x02, 0x00, 0xe9, 0x01, 0x48, 0x00, 0x00, 0x00, 0x09, 0x01,
+  0x00, 0x03, 0x99, 0x00, 0x00, 0x38, 0x3d, 0xfe, 0x01, 0x01, 0x99, 0x00,
+  0x69, 0x01, 0x48, 0x10, 0x00, 0x00, 0x08, 0x01, 0x00, 0x03, 0x11, 0x00,
+  0x00, 0x38, 0x3d, 0xfe, 0x01, 0x01, 0x11, 0x00, 0xe9, 0x01, 0x48, 0x10,
+  0x00, 0x00, 0x08, 0x01, 0x00, 0x03, 0x08, 0x00, 0x00, 0x39, 0x3d, 0xfe,
+  0x01, 0x01, 0x08, 0x00, 0x69, 0x01, 0x48, 0x10, 0x00, 0x00, 0x09, 0x01,
+  0x00, 0x03, 0x12, 0x00, 0x00, 0x38, 0x3d, 0xfe, 0x01, 0x01, 0x12, 0x00,
+  0xe9, 0x01, 0x48, 0x10, 0x00, 0x00, 0x09, 0x01, 0x00, 0x03, 0x09, 0x00,
+  0x00, 0x39, 0x3d, 0xfe, 0x01, 0x01, 0x09, 0x00, 0x69, 0x10, 0x48, 0x90,
+  0x00, 0x00, 0x08, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x39, 0x3d, 0xfe,
+  0x10, 0x10, 0x00, 0x00, 0xe9, 0x10, 0x48, 0x90, 0x00, 0x00, 0x08, 0x10,
+  0x00, 0x03, 0x79, 0x00, 0x00, 0x39, 0x3d, 0xfe, 0x10, 0x10, 0x79, 0x00,
+  0x69, 0x10, 0x48, 0x90, 0x00, 0x00, 0x09, 0x10, 0x00, 0x03, 0x01, 0x00,
+  0x00, 0x39, 0x3d, 0xfe, 0x10, 0x10, 0x01, 0x00, 0xe9, 0x10, 0x48, 0x90,
+  0x00, 0x00, 0x09, 0x10, 0x00, 0x03, 0x80, 0x00, 0x00, 0x39, 0x3d, 0xfe,
+  0x10, 0x10, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x06
+};
+unsigned int __6502_functional_test_bin_len = 65536;
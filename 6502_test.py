@@ -0,0 +1,574 @@
+#!/usr/bin/env python3
+# NMOS 6502 functional test generator ********************
+# Writes 6502_test.h, the image 6502run runs as the      *
+# built-in suite of its NMOS core. A short driver at     *
+# $0400 walks a table of vectors, one instruction each:  *
+# it sets A, X, Y, P, the operand and the stack, runs    *
+# the instruction from a slot in RAM and compares the    *
+# registers, flags, stack pointer and the bytes it may   *
+# have written with what the NMOS model below expects.   *
+# The model is written from the data sheet, not from     *
+# 6502.c, so the two check each other. It covers every   *
+# documented opcode in every addressing mode, decimal    *
+# ADC and SBC on valid BCD (result and carry only, as    *
+# Klaus' functional test does), the stable undocumented  *
+# opcodes and the NOPs the 65C02 put new instructions    *
+# on, BRK, RTI, JSR, RTS and JMP ($xxFF).                *
+#                                                        *
+#   python3 6502_test.py > 6502_test.h                   *
+##########################################################
+
+import random
+import sys
+
+# the vector the driver is on is at ($00); a failing check traps at FAIL
+TABLE = 0x0700
+VECTOR = 20
+SLOT = 0x0500
+TARGET = 0x0600      # INX, JMP ret: where jumps, calls and BRK land
+TARGET_RTI = 0x0605  # the same, where RTI lands
+ZP = 0x30
+ABS = 0x0300
+PTR_X = 0x40         # ($40) -> $0300 for (zp,X)
+PTR_Y = 0x42         # set per vector for (zp),Y
+PAD = 0x48           # PHA: moves SP without touching a flag
+
+C, Z, I, D, B, U, V, N = 1, 2, 4, 8, 16, 32, 64, 128
+
+# addressing mode: operand bytes
+MODES = {'imp': 0, 'acc': 0, 'imm': 1, 'zp': 1, 'zpx': 1, 'zpy': 1, 'rel': 1,
+         'abs': 2, 'absx': 2, 'absy': 2, 'ind': 2, 'indx': 1, 'indy': 1}
+
+OPCODES = {}
+
+
+def ops(mnemonic, *pairs):
+    for op, mode in pairs:
+        OPCODES[op] = (mnemonic, mode)
+
+
+ALU = (('imm', 0x09), ('zp', 0x05), ('zpx', 0x15), ('abs', 0x0D),
+       ('absx', 0x1D), ('absy', 0x19), ('indx', 0x01), ('indy', 0x11))
+for name, base in (('ORA', 0x00), ('AND', 0x20), ('EOR', 0x40), ('ADC', 0x60),
+                   ('LDA', 0xA0), ('CMP', 0xC0), ('SBC', 0xE0)):
+    ops(name, *((base + off, mode) for mode, off in ALU))
+ops('STA', *((0x80 + off, mode) for mode, off in ALU if mode != 'imm'))
+SHIFT = (('acc', 0x0A), ('zp', 0x06), ('zpx', 0x16), ('abs', 0x0E), ('absx', 0x1E))
+for name, base in (('ASL', 0x00), ('ROL', 0x20), ('LSR', 0x40), ('ROR', 0x60)):
+    ops(name, *((base + off, mode) for mode, off in SHIFT))
+for name, base in (('DEC', 0xC0), ('INC', 0xE0)):
+    ops(name, *((base + off, mode) for mode, off in SHIFT if mode != 'acc'))
+for name, op in (('BPL', 0x10), ('BMI', 0x30), ('BVC', 0x50), ('BVS', 0x70),
+                 ('BCC', 0x90), ('BCS', 0xB0), ('BNE', 0xD0), ('BEQ', 0xF0)):
+    ops(name, (op, 'rel'))
+for name, op in (('BRK', 0x00), ('PHP', 0x08), ('CLC', 0x18), ('PLP', 0x28),
+                 ('SEC', 0x38), ('RTI', 0x40), ('PHA', 0x48), ('CLI', 0x58),
+                 ('RTS', 0x60), ('PLA', 0x68), ('SEI', 0x78), ('DEY', 0x88),
+                 ('TXA', 0x8A), ('TYA', 0x98), ('TXS', 0x9A), ('TAY', 0xA8),
+                 ('TAX', 0xAA), ('CLV', 0xB8), ('TSX', 0xBA), ('INY', 0xC8),
+                 ('DEX', 0xCA), ('CLD', 0xD8), ('INX', 0xE8), ('NOP', 0xEA),
+                 ('SED', 0xF8)):
+    ops(name, (op, 'imp'))
+ops('BIT', (0x24, 'zp'), (0x2C, 'abs'))
+ops('JSR', (0x20, 'abs'))
+ops('JMP', (0x4C, 'abs'), (0x6C, 'ind'))
+ops('STX', (0x86, 'zp'), (0x96, 'zpy'), (0x8E, 'abs'))
+ops('STY', (0x84, 'zp'), (0x94, 'zpx'), (0x8C, 'abs'))
+ops('LDX', (0xA2, 'imm'), (0xA6, 'zp'), (0xB6, 'zpy'), (0xAE, 'abs'), (0xBE, 'absy'))
+ops('LDY', (0xA0, 'imm'), (0xA4, 'zp'), (0xB4, 'zpx'), (0xAC, 'abs'), (0xBC, 'absx'))
+ops('CPX', (0xE0, 'imm'), (0xE4, 'zp'), (0xEC, 'abs'))
+ops('CPY', (0xC0, 'imm'), (0xC4, 'zp'), (0xCC, 'abs'))
+DOCUMENTED = set(OPCODES)
+
+RMW = (('zp', 0x07), ('zpx', 0x17), ('abs', 0x0F), ('absx', 0x1F),
+       ('absy', 0x1B), ('indx', 0x03), ('indy', 0x13))
+for name, base in (('SLO', 0x00), ('RLA', 0x20), ('SRE', 0x40), ('RRA', 0x60),
+                   ('DCP', 0xC0), ('ISB', 0xE0)):
+    ops(name, *((base + off, mode) for mode, off in RMW))
+ops('SAX', (0x87, 'zp'), (0x97, 'zpy'), (0x8F, 'abs'), (0x83, 'indx'))
+ops('LAX', (0xA7, 'zp'), (0xB7, 'zpy'), (0xAF, 'abs'), (0xBF, 'absy'),
+    (0xA3, 'indx'), (0xB3, 'indy'))
+ops('NOP', *((op, 'imp') for op in (0x1A, 0x3A, 0x5A, 0x7A, 0xDA, 0xFA)))
+ops('NOP', *((op, 'imm') for op in (0x80, 0x82, 0x89, 0xC2, 0xE2)))
+ops('NOP', *((op, 'zp') for op in (0x04, 0x44, 0x64)))
+ops('NOP', *((op, 'zpx') for op in (0x14, 0x34, 0x54, 0x74, 0xD4, 0xF4)))
+ops('NOP', (0x0C, 'abs'))
+ops('NOP', *((op, 'absx') for op in (0x1C, 0x3C, 0x5C, 0x7C, 0xDC, 0xFC)))
+
+ASSEMBLE = {(name, mode): op for op, (name, mode) in OPCODES.items()
+            if op in DOCUMENTED}
+
+
+class Cpu:
+    """The NMOS 6502, one instruction at a time."""
+
+    def __init__(self, mem):
+        self.mem = mem
+        self.a = self.x = self.y = 0
+        self.sp = 0xFF
+        self.p = U
+        self.pc = 0
+
+    def flag(self, f, on):
+        self.p = self.p | f if on else self.p & ~f
+
+    def nz(self, v):
+        self.flag(Z, v == 0)
+        self.flag(N, v & 0x80)
+        return v
+
+    def push(self, v):
+        self.mem[0x100 + self.sp] = v
+        self.sp = (self.sp - 1) & 0xFF
+
+    def pull(self):
+        self.sp = (self.sp + 1) & 0xFF
+        return self.mem[0x100 + self.sp]
+
+    def word(self, address, wrap=False):
+        high = (address & 0xFF00) | ((address + 1) & 0xFF) if wrap else address + 1
+        return self.mem[address] | self.mem[high & 0xFFFF] << 8
+
+    def address(self, mode):
+        m, pc = self.mem, self.pc
+        b1 = m[(pc + 1) & 0xFFFF]
+        b2 = m[(pc + 2) & 0xFFFF]
+        if mode == 'zp': return b1
+        if mode == 'zpx': return (b1 + self.x) & 0xFF
+        if mode == 'zpy': return (b1 + self.y) & 0xFF
+        if mode == 'abs': return b1 | b2 << 8
+        if mode == 'absx': return ((b1 | b2 << 8) + self.x) & 0xFFFF
+        if mode == 'absy': return ((b1 | b2 << 8) + self.y) & 0xFFFF
+        if mode == 'ind': return self.word(b1 | b2 << 8, wrap=True)
+        if mode == 'indx': return self.word((b1 + self.x) & 0xFF, wrap=True)
+        if mode == 'indy': return (self.word(b1, wrap=True) + self.y) & 0xFFFF
+        if mode in ('imm', 'rel'): return (pc + 1) & 0xFFFF
+        return None
+
+    def adc(self, v):
+        a, c = self.a, self.p & C
+        binary = a + v + c
+        if self.p & D:
+            low = (a & 0x0F) + (v & 0x0F) + c
+            if low >= 0x0A:
+                low = ((low + 6) & 0x0F) + 0x10
+            s = (a & 0xF0) + (v & 0xF0) + low
+            if s >= 0xA0:
+                s += 0x60
+            self.flag(C, s >= 0x100)
+            self.a = s & 0xFF
+        else:
+            self.flag(C, binary > 0xFF)
+            self.a = binary & 0xFF
+        # N, V and Z of the binary sum on the NMOS part; valid in binary mode
+        self.flag(V, (a ^ binary) & (v ^ binary) & 0x80)
+        self.flag(N, binary & 0x80)
+        self.flag(Z, not binary & 0xFF)
+
+    def sbc(self, v):
+        a, c = self.a, self.p & C
+        binary = a - v - (1 - c)
+        if self.p & D:
+            low = (a & 0x0F) - (v & 0x0F) + c - 1
+            if low < 0:
+                low = ((low - 6) & 0x0F) - 0x10
+            s = (a & 0xF0) - (v & 0xF0) + low
+            if s < 0:
+                s -= 0x60
+            self.a = s & 0xFF
+        else:
+            self.a = binary & 0xFF
+        self.flag(C, binary >= 0)
+        self.flag(V, (a ^ v) & (a ^ binary) & 0x80)
+        self.flag(N, binary & 0x80)
+        self.flag(Z, not binary & 0xFF)
+
+    def compare(self, r, v):
+        self.flag(C, r >= v)
+        self.nz((r - v) & 0xFF)
+
+    def shift(self, name, v):
+        c = self.p & C
+        if name in ('ASL', 'SLO'):
+            self.flag(C, v & 0x80)
+            return (v << 1) & 0xFF
+        if name in ('ROL', 'RLA'):
+            self.flag(C, v & 0x80)
+            return (v << 1 | c) & 0xFF
+        if name in ('LSR', 'SRE'):
+            self.flag(C, v & 1)
+            return v >> 1
+        self.flag(C, v & 1)
+        return v >> 1 | c << 7
+
+    def step(self):
+        m = self.mem
+        name, mode = OPCODES[m[self.pc]]
+        ea = self.address(mode)
+        size = 1 + MODES[mode]
+        nextpc = (self.pc + size) & 0xFFFF
+        v = m[ea] if ea is not None else self.a
+
+        if name == 'LDA': self.a = self.nz(v)
+        elif name == 'LDX': self.x = self.nz(v)
+        elif name == 'LDY': self.y = self.nz(v)
+        elif name == 'LAX': self.a = self.x = self.nz(v)
+        elif name == 'STA': m[ea] = self.a
+        elif name == 'STX': m[ea] = self.x
+        elif name == 'STY': m[ea] = self.y
+        elif name == 'SAX': m[ea] = self.a & self.x
+        elif name == 'ORA': self.a = self.nz(self.a | v)
+        elif name == 'AND': self.a = self.nz(self.a & v)
+        elif name == 'EOR': self.a = self.nz(self.a ^ v)
+        elif name == 'ADC': self.adc(v)
+        elif name == 'SBC': self.sbc(v)
+        elif name == 'CMP': self.compare(self.a, v)
+        elif name == 'CPX': self.compare(self.x, v)
+        elif name == 'CPY': self.compare(self.y, v)
+        elif name == 'BIT':
+            self.flag(Z, not self.a & v)
+            self.p = (self.p & 0x3F) | (v & 0xC0)
+        elif name in ('ASL', 'ROL', 'LSR', 'ROR'):
+            r = self.nz(self.shift(name, v))
+            if mode == 'acc': self.a = r
+            else: m[ea] = r
+        elif name in ('SLO', 'RLA', 'SRE', 'RRA'):
+            r = m[ea] = self.shift(name, v)
+            if name == 'SLO': self.a = self.nz(self.a | r)
+            elif name == 'RLA': self.a = self.nz(self.a & r)
+            elif name == 'SRE': self.a = self.nz(self.a ^ r)
+            else: self.adc(r)
+        elif name in ('INC', 'DEC', 'ISB', 'DCP'):
+            r = m[ea] = (v + (1 if name in ('INC', 'ISB') else -1)) & 0xFF
+            if name == 'ISB': self.sbc(r)
+            elif name == 'DCP': self.compare(self.a, r)
+            else: self.nz(r)
+        elif name == 'INX': self.x = self.nz((self.x + 1) & 0xFF)
+        elif name == 'INY': self.y = self.nz((self.y + 1) & 0xFF)
+        elif name == 'DEX': self.x = self.nz((self.x - 1) & 0xFF)
+        elif name == 'DEY': self.y = self.nz((self.y - 1) & 0xFF)
+        elif name == 'TAX': self.x = self.nz(self.a)
+        elif name == 'TAY': self.y = self.nz(self.a)
+        elif name == 'TXA': self.a = self.nz(self.x)
+        elif name == 'TYA': self.a = self.nz(self.y)
+        elif name == 'TSX': self.x = self.nz(self.sp)
+        elif name == 'TXS': self.sp = self.x
+        elif name == 'PHA': self.push(self.a)
+        elif name == 'PHP': self.push(self.p | B | U)
+        elif name == 'PLA': self.a = self.nz(self.pull())
+        elif name == 'PLP': self.p = self.pull() & ~B | U
+        elif name in ('CLC', 'SEC'): self.flag(C, name == 'SEC')
+        elif name in ('CLI', 'SEI'): self.flag(I, name == 'SEI')
+        elif name in ('CLD', 'SED'): self.flag(D, name == 'SED')
+        elif name == 'CLV': self.flag(V, False)
+        elif name == 'NOP': pass
+        elif name == 'JMP': nextpc = ea
+        elif name == 'JSR':
+            ret = (self.pc + 2) & 0xFFFF
+            self.push(ret >> 8)
+            self.push(ret & 0xFF)
+            nextpc = ea
+        elif name == 'RTS':
+            low = self.pull()
+            nextpc = ((self.pull() << 8 | low) + 1) & 0xFFFF
+        elif name == 'RTI':
+            self.p = self.pull() & ~B | U
+            low = self.pull()
+            nextpc = self.pull() << 8 | low
+        elif name == 'BRK':
+            ret = (self.pc + 2) & 0xFFFF
+            self.push(ret >> 8)
+            self.push(ret & 0xFF)
+            self.push(self.p | B | U)
+            self.flag(I, True)
+            nextpc = self.word(0xFFFE)
+        elif mode == 'rel':
+            bit, on = {'BPL': (N, 0), 'BMI': (N, 1), 'BVC': (V, 0), 'BVS': (V, 1),
+                       'BCC': (C, 0), 'BCS': (C, 1), 'BNE': (Z, 0), 'BEQ': (Z, 1)}[name]
+            if bool(self.p & bit) == bool(on):
+                nextpc = (nextpc + (v ^ 0x80) - 0x80) & 0xFFFF
+        else:
+            raise ValueError(name)
+        self.pc = nextpc
+
+
+class Assembler:
+    """Enough of an assembler for the driver: labels, branches, JMP."""
+
+    def __init__(self, mem, origin):
+        self.mem, self.pc = mem, origin
+        self.labels, self.fixups = {}, []
+
+    def label(self, name):
+        self.labels[name] = self.pc
+
+    def byte(self, *values):
+        for v in values:
+            self.mem[self.pc] = v
+            self.pc += 1
+
+    def __call__(self, name, mode='imp', operand=0):
+        self.byte(ASSEMBLE[(name, mode)])
+        if isinstance(operand, str):
+            self.fixups.append((self.pc, mode, operand))
+            operand = 0
+        if MODES[mode] == 1:
+            self.byte(operand & 0xFF)
+        elif MODES[mode] == 2:
+            self.byte(operand & 0xFF, operand >> 8)
+
+    def link(self):
+        for at, mode, name in self.fixups:
+            target = self.labels[name]
+            if mode == 'rel':
+                offset = target - (at + 1)
+                assert -128 <= offset < 128, name
+                self.mem[at] = offset & 0xFF
+            else:
+                self.mem[at], self.mem[at + 1] = target & 0xFF, target >> 8
+
+
+# vector fields, copied to $50..$63 by the driver
+F_OP, F_B1, F_B2, F_A, F_X, F_Y, F_P, F_M, F_PTR = range(9)
+F_EA, F_EX, F_EY, F_EP, F_MASK, F_ESP, F_EZP, F_EABS, F_ESTACK, F_END = range(10, 20)
+COPY = 0x50
+SAVE = 0x70
+
+
+def driver(mem):
+    asm = Assembler(mem, 0x0400)
+    asm('CLD')
+    asm('LDX', 'imm', 0xFF)
+    asm('TXS')
+    asm('LDA', 'imm', TABLE & 0xFF)
+    asm('STA', 'zp', 0x00)
+    asm('LDA', 'imm', TABLE >> 8)
+    asm('STA', 'zp', 0x01)
+    asm.label('next')
+    asm('LDY', 'imm', VECTOR - 1)
+    asm.label('copy')
+    asm('LDA', 'indy', 0x00)
+    asm('STA', 'absy', COPY)
+    asm('DEY')
+    asm('BPL', 'rel', 'copy')
+    asm('LDA', 'zp', COPY + F_END)
+    asm('BEQ', 'rel', 'run')
+    asm('JMP', 'abs', 'done')
+    asm.label('run')
+    for i in range(3):
+        asm('LDA', 'zp', COPY + F_OP + i)
+        asm('STA', 'abs', SLOT + i)
+    asm('LDA', 'zp', COPY + F_M)
+    asm('STA', 'zp', ZP)
+    asm('STA', 'abs', ABS)
+    asm('STA', 'abs', 0x0100)
+    asm('LDA', 'imm', (TARGET - 1) >> 8)      # RTS pulls $0100, $0101
+    asm('STA', 'abs', 0x0101)
+    asm('LDA', 'imm', TARGET_RTI >> 8)        # RTI pulls $0100..$0102
+    asm('STA', 'abs', 0x0102)
+    asm('LDA', 'zp', COPY + F_PTR)
+    asm('STA', 'zp', PTR_Y)
+    asm('LDA', 'zp', COPY + F_PTR + 1)
+    asm('STA', 'zp', PTR_Y + 1)
+    asm('LDX', 'zp', COPY + F_X)
+    asm('LDY', 'zp', COPY + F_Y)
+    asm('LDA', 'zp', COPY + F_P)
+    asm('PHA')
+    asm('LDA', 'zp', COPY + F_A)
+    asm('PLP')
+    asm('JMP', 'abs', SLOT)
+    asm.label('ret')
+    asm('PHP')
+    asm('STA', 'zp', SAVE)
+    asm('STX', 'zp', SAVE + 1)
+    asm('STY', 'zp', SAVE + 2)
+    asm('PLA')
+    asm('STA', 'zp', SAVE + 3)
+    asm('TSX')
+    asm('STX', 'zp', SAVE + 4)
+    asm('LDX', 'imm', 0xFF)
+    asm('TXS')
+    asm('CLD')
+    for save, field in ((SAVE, F_EA), (SAVE + 1, F_EX), (SAVE + 2, F_EY),
+                        (SAVE + 3, F_EP), (SAVE + 4, F_ESP), (ZP, F_EZP)):
+        asm('LDA', 'zp', save)
+        if field == F_EP:
+            asm('AND', 'zp', COPY + F_MASK)
+        asm('CMP', 'zp', COPY + field)
+        asm('BNE', 'rel', 'fail')
+    for address, field in ((ABS, F_EABS), (0x01FF, F_ESTACK)):
+        asm('LDA', 'abs', address)
+        asm('CMP', 'zp', COPY + field)
+        asm('BNE', 'rel', 'fail')
+    asm('CLC')
+    asm('LDA', 'zp', 0x00)
+    asm('ADC', 'imm', VECTOR)
+    asm('STA', 'zp', 0x00)
+    asm('BCC', 'rel', 'again')
+    asm('INC', 'zp', 0x01)
+    asm.label('again')
+    asm('JMP', 'abs', 'next')
+    asm.label('fail')
+    asm('JMP', 'abs', 'fail')
+    asm.label('done')
+    asm('JMP', 'abs', 'done')
+    asm.link()
+    assert asm.pc <= SLOT
+
+    slot = Assembler(mem, SLOT + 3)
+    slot('JMP', 'abs', asm.labels['ret'])
+    for origin in (TARGET, TARGET_RTI):
+        target = Assembler(mem, origin)
+        target('INX')
+        target('JMP', 'abs', asm.labels['ret'])
+    mem[0xFFFE], mem[0xFFFF] = TARGET & 0xFF, TARGET >> 8
+    mem[PTR_X], mem[PTR_X + 1] = ABS & 0xFF, ABS >> 8
+    # JMP ($02FF) takes its high byte from $0200, JMP ($0210) from $0211
+    mem[0x02FF], mem[0x0200] = TARGET & 0xFF, TARGET >> 8
+    mem[0x0210], mem[0x0211] = TARGET_RTI & 0xFF, TARGET_RTI >> 8
+    return asm.labels
+
+
+class Vectors:
+    def __init__(self, mem, labels):
+        self.mem, self.labels = mem, labels
+        self.at = TABLE
+
+    def add(self, op, operand, a, x, y, p, m, ptr=ABS, mask=0xFF):
+        mem = self.mem
+        mode = OPCODES[op][1]
+        size = 1 + MODES[mode]
+        code = [op] + [operand & 0xFF, operand >> 8][:size - 1] + [PAD] * 2
+        # what the driver does before it jumps to the slot
+        mem[SLOT:SLOT + 3] = bytes(code[:3])
+        mem[ZP] = mem[ABS] = mem[0x0100] = m
+        mem[0x0101], mem[0x0102] = (TARGET - 1) >> 8, TARGET_RTI >> 8
+        mem[PTR_Y], mem[PTR_Y + 1] = ptr & 0xFF, ptr >> 8
+        mem[0x01FF] = p
+        cpu = Cpu(mem)
+        cpu.a, cpu.x, cpu.y, cpu.p, cpu.pc = a, x, y, p & ~B | U, SLOT
+        steps = 0
+        while cpu.pc != self.labels['ret']:
+            cpu.step()
+            steps += 1
+            assert steps < 8, hex(op)
+        cpu.push(cpu.p | B | U)    # the PHP at ret
+        cpu.sp = (cpu.sp + 1) & 0xFF
+        flags = mem[0x100 + cpu.sp]
+        vector = code[:3] + [a, x, y, p, m, ptr & 0xFF, ptr >> 8,
+                             cpu.a, cpu.x, cpu.y, flags & mask, mask, cpu.sp,
+                             mem[ZP], mem[ABS], mem[0x01FF], 0]
+        mem[self.at:self.at + VECTOR] = bytes(vector)
+        self.at += VECTOR
+
+    def end(self):
+        self.mem[self.at + F_END] = 0xFF
+        self.at += VECTOR
+        assert self.at <= 0xFFF0, hex(self.at)
+
+
+VALUES = (0x00, 0x01, 0x02, 0x0F, 0x3F, 0x40, 0x41, 0x7F, 0x80, 0x81, 0xAA, 0xC0, 0xFE, 0xFF)
+EDGES = (0x00, 0x01, 0x0F, 0x3F, 0x40, 0x7F, 0x80, 0x81, 0xFE, 0xFF)
+INDEX = (0x00, 0x01, 0x7F, 0xD5, 0xFF)
+
+
+def operands(mode, x, y):
+    """Operand and (zp),Y pointer that make the effective address $30 or $0300."""
+    return {'zp': ZP, 'zpx': (ZP - x) & 0xFF, 'zpy': (ZP - y) & 0xFF,
+            'abs': ABS, 'absx': ABS - x, 'absy': ABS - y,
+            'indx': (PTR_X - x) & 0xFF, 'indy': PTR_Y}.get(mode, 0), ABS - y
+
+
+def generate(vectors, rng):
+    def byte():
+        return rng.randrange(256)
+
+    def flags(binary):
+        p = byte()
+        return p & ~D if binary else p
+
+    for op in sorted(OPCODES):
+        name, mode = OPCODES[op]
+        binary = name in ('ADC', 'SBC', 'RRA', 'ISB')
+        if name in ('JMP', 'JSR', 'BRK', 'RTS', 'RTI'):
+            for _ in range(4):
+                a, x, y, p = byte(), byte(), byte(), byte()
+                if name == 'RTS':
+                    vectors.add(op, 0, a, x, y, p, (TARGET - 1) & 0xFF)
+                elif name == 'JMP' and mode == 'ind':
+                    m = byte() & ~0x06 | 0x01    # never $06: a 65C02 would land right
+                    vectors.add(op, 0x02FF, a, x, y, p, m)
+                    vectors.add(op, 0x0210, a, x, y, p, m)
+                else:
+                    vectors.add(op, TARGET, a, x, y, p, byte())
+            continue
+        if mode == 'rel':
+            for i in range(24):
+                offset = 1 if i < 20 else 0    # taken with 1 skips the PAD after it
+                vectors.add(op, offset, byte(), byte(), byte(), byte(), byte())
+            continue
+        if mode in ('imm',) and name in ('ADC', 'SBC', 'AND', 'ORA', 'EOR', 'CMP', 'CPX', 'CPY'):
+            pairs = [(r, m) for r in EDGES for m in EDGES]
+            if name in ('AND', 'ORA', 'EOR'):
+                pairs = pairs[::2]
+            for r, m in pairs:
+                x, y = byte(), byte()
+                if name == 'CPX': x = r
+                if name == 'CPY': y = r
+                vectors.add(op, m, r, x, y, flags(binary), byte())
+            continue
+        indexes = INDEX if mode in ('zpx', 'zpy', 'absx', 'absy', 'indx', 'indy') else (0,)
+        for index in indexes:
+            for _ in range(2 if len(indexes) > 1 else 4 if name == 'NOP' else 6):
+                a, x, y, m = byte(), byte(), byte(), rng.choice(VALUES + (byte(),))
+                if mode in ('zpx', 'absx', 'indx'): x = index
+                if mode in ('zpy', 'absy', 'indy'): y = index
+                operand, ptr = operands(mode, x, y)
+                if mode == 'imm': operand = m
+                vectors.add(op, operand, a, x, y, flags(binary), m, ptr)
+
+    # decimal mode: only the result and the carry are defined on the NMOS part
+    bcd = [(t << 4 | u) for t in range(10) for u in range(10)]
+    for op in (0x69, 0x65, 0xE9, 0xE5):
+        for _ in range(100):
+            a, m = rng.choice(bcd), rng.choice(bcd)
+            p = byte() | D
+            operand = m if OPCODES[op][1] == 'imm' else ZP
+            vectors.add(op, operand, a, byte(), byte(), p, m, mask=~(N | V | Z) & 0xFF)
+    for a, m in ((0x00, 0x00), (0x99, 0x01), (0x99, 0x99), (0x50, 0x50), (0x09, 0x01),
+                 (0x01, 0x09), (0x00, 0x01), (0x10, 0x01), (0x90, 0x10)):
+        for carry in (0, C):
+            for op in (0x69, 0xE9):
+                vectors.add(op, m, a, 0, 0, D | carry, m, mask=~(N | V | Z) & 0xFF)
+
+
+def main():
+    mem = bytearray(0x10000)
+    labels = driver(mem)
+    vectors = Vectors(mem, labels)
+    generate(vectors, random.Random(6502))
+    count = (vectors.at - TABLE) // VECTOR
+    vectors.end()
+    # the driver leaves its last state in RAM; the image starts clean
+    for address in list(range(0x0000, 0x0200)) + [ABS] + list(range(SLOT, SLOT + 3)):
+        if address not in (0x00, 0x01, PTR_X, PTR_X + 1):
+            mem[address] = 0
+    mem[0x00] = mem[0x01] = 0
+
+    out = sys.stdout
+    out.write('/********************************************************\n')
+    out.write('NMOS 6502 functional test, written by 6502_test.py\n\n')
+    out.write('%d vectors at $%04X, one instruction each. Starts at $0400,\n' % (count, TABLE))
+    out.write('passes at $%04X and traps at $%04X on the first check\n' % (labels['done'], labels['fail']))
+    out.write('that fails; the vector it was on is at ($00).\n')
+    out.write('********************************************************/\n\n')
+    out.write('unsigned char __6502_functional_test_bin[] = {\n')
+    for i in range(0, 0x10000, 12):
+        row = ', '.join('0x%02x' % b for b in mem[i:i + 12])
+        out.write('  %s%s\n' % (row, ',' if i + 12 < 0x10000 else ''))
+    out.write('};\n')
+    out.write('unsigned int __6502_functional_test_bin_len = 65536;\n')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,262 @@
+/* Batch runner *****************************************
+ * Runs many independent machines in parallel on a pool *
+ * of host threads and aggregates results and speed.    *
+ *                                                      *
+ *   6502batch [-j threads] [-r repeat] [-k]            *
+ *             [-c maxcycles] [script.fs ...]           *
+ *                                                      *
+ * Every script is typed into its own TaliForth machine *
+ * and -k adds a run of the Klaus 65C02 test suite. If  *
+ * script.fs has a script.expected file next to it, the *
+ * console output must match it for the job to pass.    *
+ ********************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <time.h>
+#include <sys/sysinfo.h>
+
+#define M6502_TLS _Thread_local
+#define CHIPS_IMPL
+#include "6502.c"
+#include "6522.h"
+#include "machine.c"
+
+#include "forth.h"
+#include "65C02_test.h"
+
+#define FORTH_START 0x8000
+#define FORTH_SIZE 0x8000
+
+#define KLAUS_START_PC 0x400
+#define KLAUS_SUCCESS_PC 0x24F1
+
+// Cycles run between two checks of the job state
+#define QUANTUM 10000
+// Empty console reads after the end of the script before a job counts as done
+#define IDLE_POLLS 1000
+#define DEFAULT_MAX_CYCLES 2000000000u
+
+enum job_kind { JOB_FORTH, JOB_KLAUS };
+enum job_result { RESULT_PASS, RESULT_FAIL, RESULT_TIMEOUT };
+
+typedef struct {
+    enum job_kind kind;
+    const char *name;
+    const char *script;
+    size_t script_len;
+    const char *expected;
+    size_t expected_len;
+
+    // filled in by the worker
+    enum job_result result;
+    uint32_t cycles;
+    uint64_t instructions;
+    double seconds;
+    uint16_t end_pc;
+} job_t;
+
+static job_t *jobs;
+static size_t job_count;
+static atomic_size_t next_job;
+static uint32_t max_cycles = DEFAULT_MAX_CYCLES;
+
+static double now_seconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+//load the job into m and wire the CPU to it
+static void job_start(job_t *job, machine_t *m, script_console_t *con) {
+    if (job->kind == JOB_KLAUS) {
+        machine_init(m, MACHINE_RAW);
+        machine_load(m, 0, __65C02_extended_opcodes_test_bin, 0x10000);
+        machine_reset(m);
+        hookexternal(NULL);
+        pc = KLAUS_START_PC;
+        return;
+    }
+
+    machine_init(m, 0);
+    machine_load(m, FORTH_START, taliforth_pico_bin, FORTH_SIZE);
+    machine_script(m, con, job->script, job->script_len);
+    machine_reset(m);
+    hookexternal(machine_tick);
+}
+
+static bool job_done(job_t *job) {
+    if (clockticks6502 >= max_cycles) {
+        job->result = RESULT_TIMEOUT;
+        return true;
+    }
+    if (job->kind == JOB_KLAUS) {
+        if (!trapped6502) return false;
+        job->result = pc == KLAUS_SUCCESS_PC ? RESULT_PASS : RESULT_FAIL;
+        return true;
+    }
+
+    script_console_t *con = machine->user;
+    if (con->idle < IDLE_POLLS) return false;
+    if (job->expected && (con->out_len != job->expected_len ||
+        memcmp(con->out, job->expected, con->out_len) != 0)) {
+        job->result = RESULT_FAIL;
+    } else {
+        job->result = RESULT_PASS;
+    }
+    return true;
+}
+
+static void job_finish(job_t *job, double t0) {
+    if (job->kind == JOB_FORTH) {
+        script_console_t *con = machine->user;
+        free(con->out);
+    }
+    job->seconds = now_seconds() - t0;
+    job->cycles = clockticks6502;
+    job->instructions = instructions;
+    job->end_pc = pc;
+}
+
+static void *worker(void *arg) {
+    machine_t *m = malloc(sizeof(machine_t));
+    script_console_t con;
+    (void)arg;
+
+    for (;;) {
+        size_t i = atomic_fetch_add(&next_job, 1);
+        if (i >= job_count) break;
+
+        job_t *job = &jobs[i];
+        double t0 = now_seconds();
+        job_start(job, m, &con);
+        while (!job_done(job)) {
+            exec6502(QUANTUM);
+        }
+        job_finish(job, t0);
+    }
+
+    free(m);
+    return NULL;
+}
+
+static char *read_file(const char *path, size_t *len) {
+    FILE *f = fopen(path, "rb");
+    if (!f) return NULL;
+
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    char *data = malloc(size + 1);
+    *len = fread(data, 1, size, f);
+    data[*len] = 0;
+    fclose(f);
+    return data;
+}
+
+static void usage() {
+    fprintf(stderr, "usage: 6502batch [-j threads] [-r repeat] [-k] [-c maxcycles] [script.fs ...]\n");
+    exit(2);
+}
+
+int main(int argc, char **argv) {
+    int threads = get_nprocs();
+    int repeat = 1;
+    int klaus = 0;
+    int argi = 1;
+
+    // unistd.h (and with it getopt) clashes with brk() in 6502.c
+    for (; argi < argc && argv[argi][0] == '-'; argi++) {
+        const char *opt = argv[argi];
+        if (!strcmp(opt, "-k")) {
+            klaus = 1;
+            continue;
+        }
+        if (argi + 1 == argc) usage();
+        if (!strcmp(opt, "-j")) threads = atoi(argv[++argi]);
+        else if (!strcmp(opt, "-r")) repeat = atoi(argv[++argi]);
+        else if (!strcmp(opt, "-c")) max_cycles = strtoul(argv[++argi], NULL, 0);
+        else usage();
+    }
+    int scripts = argc - argi;
+    if ((scripts == 0 && !klaus) || threads < 1 || repeat < 1) usage();
+
+    job_count = (size_t)(scripts + klaus) * repeat;
+    jobs = calloc(job_count, sizeof(job_t));
+
+    size_t n = 0;
+    for (int r = 0; r < repeat; r++) {
+        if (klaus) {
+            jobs[n].kind = JOB_KLAUS;
+            jobs[n].name = "klaus-65c02";
+            n++;
+        }
+        for (int s = 0; s < scripts; s++) {
+            const char *path = argv[argi + s];
+            job_t *job = &jobs[n++];
+
+            job->kind = JOB_FORTH;
+            job->name = path;
+            if (r > 0) {
+                // repeats share the script loaded on the first round
+                job_t *first = &jobs[s + klaus];
+                job->script = first->script;
+                job->script_len = first->script_len;
+                job->expected = first->expected;
+                job->expected_len = first->expected_len;
+                continue;
+            }
+            job->script = read_file(path, &job->script_len);
+            if (!job->script) {
+                fprintf(stderr, "cannot read %s\n", path);
+                return 2;
+            }
+
+            // script.fs -> script.expected
+            char *exp_path = malloc(strlen(path) + 10);
+            strcpy(exp_path, path);
+            char *dot = strrchr(exp_path, '.');
+            if (dot && !strchr(dot, '/')) *dot = 0;
+            strcat(exp_path, ".expected");
+            job->expected = read_file(exp_path, &job->expected_len);
+            free(exp_path);
+        }
+    }
+
+    if ((size_t)threads > job_count) threads = (int)job_count;
+    pthread_t *pool = malloc(threads * sizeof(pthread_t));
+
+    double t0 = now_seconds();
+    for (int t = 0; t < threads; t++) {
+        pthread_create(&pool[t], NULL, worker, NULL);
+    }
+    for (int t = 0; t < threads; t++) {
+        pthread_join(pool[t], NULL);
+    }
+    double wall = now_seconds() - t0;
+
+    static const char *result_names[] = { "pass", "FAIL", "TIMEOUT" };
+    size_t passed = 0;
+    uint64_t total_cycles = 0, total_instructions = 0;
+
+    for (size_t i = 0; i < job_count; i++) {
+        job_t *job = &jobs[i];
+        printf("%-6s %-30s cycles %10u instr %10llu pc %04X %8.3f s %8.2f MHz\n",
+               result_names[job->result], job->name, job->cycles,
+               (unsigned long long)job->instructions, job->end_pc, job->seconds,
+               job->seconds > 0 ? job->cycles / job->seconds / 1e6 : 0.0);
+        if (job->result == RESULT_PASS) passed++;
+        total_cycles += job->cycles;
+        total_instructions += job->instructions;
+    }
+
+    printf("\n%zu jobs, %zu passed, %zu failed on %d threads in %.3f s\n",
+           job_count, passed, job_count - passed, threads, wall);
+    printf("aggregate %.2f emulated MHz, %.2f M instructions/s\n",
+           total_cycles / wall / 1e6, total_instructions / wall / 1e6);
+
+    return passed == job_count ? 0 : 1;
+}
@@ -0,0 +1,332 @@
+/* Benchmark suite **************************************
+ * Runs a fixed corpus on one thread and reports, for   *
+ * each benchmark, emulated MHz, host nanoseconds per   *
+ * instruction and cycles per instruction as JSON.      *
+ *                                                      *
+ *   6502bench [-r repeat] [-b baseline.json]           *
+ *             [-t percent] [-m mhz] [name ...]         *
+ *                                                      *
+ * The corpus is the Klaus 65C02 suite, TaliForth       *
+ * running sieve, fib and string loops from scripted    *
+ * input, and a VIA timer interrupt loop. Every         *
+ * benchmark also checks its own result. Each one runs  *
+ * repeat times and the fastest run is kept. With -b,   *
+ * a benchmark more than percent (default 5) slower     *
+ * than in the baseline, an earlier output of this      *
+ * tool, counts as a regression; -m sets a floor in     *
+ * MHz for all of them. The exit code is 0 only when    *
+ * every benchmark passed without a regression. Where   *
+ * the host has hardware performance counters, host     *
+ * cycles, instructions, branch misses and L1D/LLC      *
+ * misses per emulated instruction are reported too.    *
+ ********************************************************/
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define CHIPS_IMPL
+#include "6502.c"
+#include "6522.h"
+#include "machine.c"
+#include "hostperf.h"
+
+#include "forth.h"
+#include "65C02_test.h"
+
+#define FORTH_START 0x8000
+#define FORTH_SIZE 0x8000
+
+#define KLAUS_START_PC 0x400
+#define KLAUS_SUCCESS_PC 0x24F1
+
+#define QUANTUM 10000
+// Empty console reads after the end of the script before a benchmark is done
+#define IDLE_POLLS 1000
+#define MAX_CYCLES 2000000000u
+
+#define DEFAULT_TOLERANCE 5.0
+
+enum bench_kind { BENCH_KLAUS, BENCH_FORTH, BENCH_VIA };
+
+typedef struct {
+    const char *name;
+    enum bench_kind kind;
+    const char *script;  //TaliForth input
+    const char *expect;  //must appear in the console output
+} bench_t;
+
+// VIA timer 1 in free-running mode interrupts every 256 cycles while the
+// main loop keeps reading timer 2; it stops on a jump to itself once the
+// handler has counted VIA_IRQS interrupts
+#define VIA_START 0x0200
+#define VIA_DONE_PC 0x0226
+#define VIA_IRQS 0xC000
+static const uint8_t via_program[] = {
+    0xA2, 0xFF,             // 0200  LDX #$FF
+    0x9A,                   // 0202  TXS
+    0xA9, 0x40,             // 0203  LDA #$40
+    0x8D, 0x9B, 0xFF,       // 0205  STA ACR      T1 free running
+    0xA9, 0xC0,             // 0208  LDA #$C0
+    0x8D, 0x9E, 0xFF,       // 020A  STA IER      enable T1 interrupts
+    0xA9, 0xFE,             // 020D  LDA #$FE
+    0x8D, 0x94, 0xFF,       // 020F  STA T1CL
+    0xA9, 0x00,             // 0212  LDA #$00
+    0x8D, 0x95, 0xFF,       // 0214  STA T1CH     start T1
+    0x58,                   // 0217  CLI
+    0xAD, 0x98, 0xFF,       // 0218  LDA T2CL
+    0xE6, 0x10,             // 021B  INC $10
+    0xD0, 0xF9,             // 021D  BNE $0218
+    0xA5, 0x13,             // 021F  LDA $13
+    0xC9, VIA_IRQS >> 8,    // 0221  CMP #>VIA_IRQS
+    0x90, 0xF3,             // 0223  BCC $0218
+    0x78,                   // 0225  SEI
+    0x4C, 0x26, 0x02,       // 0226  JMP $0226
+};
+#define VIA_IRQ_HANDLER 0x0240
+static const uint8_t via_handler[] = {
+    0x48,                   // 0240  PHA
+    0xAD, 0x94, 0xFF,       // 0241  LDA T1CL     acknowledge
+    0xE6, 0x12,             // 0244  INC $12
+    0xD0, 0x02,             // 0246  BNE $024A
+    0xE6, 0x13,             // 0248  INC $13
+    0x68,                   // 024A  PLA
+    0x40,                   // 024B  RTI
+};
+
+static const bench_t corpus[] = {
+    { "klaus-65c02", BENCH_KLAUS, NULL, NULL },
+    { "forth-sieve", BENCH_FORTH,
+      "8190 constant size\n"
+      "create flags size allot\n"
+      ": sieve flags size 1 fill 0 size 0 do flags i + c@ if i 2* 3 + dup i + "
+      "begin dup size < while 0 over flags + c! over + repeat 2drop 1+ then loop ;\n"
+      ": bench 2 0 do sieve drop loop sieve . ;\n"
+      "bench\n",
+      " 1899 " },
+    { "forth-fib", BENCH_FORTH,
+      ": fib dup 2 < if exit then dup 1- recurse swap 2 - recurse + ;\n"
+      "23 fib .\n",
+      " 28657 " },
+    { "forth-string", BENCH_FORTH,
+      "create buf 64 allot\n"
+      ": text s\" the quick brown fox jumps over the lazy dog   \" ;\n"
+      ": strs 0 1500 0 do text buf swap move buf 46 text compare + "
+      "buf 46 s\" lazy\" search nip nip + buf 46 -trailing nip + "
+      "buf 46 4 /string s\" quick\" compare + loop ;\n"
+      "strs u.\n",
+      " 64500 " },
+    { "via-timer", BENCH_VIA, NULL, NULL },
+};
+#define CORPUS_SIZE (sizeof(corpus) / sizeof(corpus[0]))
+
+typedef struct {
+    bool pass;
+    uint32_t cycles;
+    uint64_t instructions;
+    double seconds;
+    hostperf_sample_t perf;
+} bench_result_t;
+
+static machine_t board;
+
+static double now_seconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static bench_result_t bench_run(const bench_t *b) {
+    script_console_t con;
+    bench_result_t r = { .pass = false };
+
+    switch (b->kind) {
+        case BENCH_KLAUS:
+            machine_init(&board, MACHINE_RAW);
+            machine_load(&board, 0, __65C02_extended_opcodes_test_bin, 0x10000);
+            machine_reset(&board);
+            hookexternal(NULL);
+            pc = KLAUS_START_PC;
+            break;
+        case BENCH_FORTH:
+            machine_init(&board, 0);
+            machine_load(&board, FORTH_START, taliforth_pico_bin, FORTH_SIZE);
+            machine_script(&board, &con, b->script, strlen(b->script));
+            machine_reset(&board);
+            hookexternal(machine_tick);
+            break;
+        case BENCH_VIA:
+            machine_init(&board, 0);
+            machine_load(&board, VIA_START, via_program, sizeof(via_program));
+            machine_load(&board, VIA_IRQ_HANDLER, via_handler, sizeof(via_handler));
+            board.mem[0xFFFC] = VIA_START & 0xFF;
+            board.mem[0xFFFD] = VIA_START >> 8;
+            board.mem[0xFFFE] = VIA_IRQ_HANDLER & 0xFF;
+            board.mem[0xFFFF] = VIA_IRQ_HANDLER >> 8;
+            machine_reset(&board);
+            hookexternal(machine_tick);
+            break;
+    }
+
+    hostperf_start();
+    double t0 = now_seconds();
+    while (clockticks6502 < MAX_CYCLES) {
+        exec6502(QUANTUM);
+        if (b->kind == BENCH_FORTH) {
+            if (con.idle >= IDLE_POLLS) {
+                r.pass = memmem(con.out, con.out_len, b->expect, strlen(b->expect)) != NULL;
+                break;
+            }
+        } else if (trapped6502) {
+            if (b->kind == BENCH_KLAUS) {
+                r.pass = pc == KLAUS_SUCCESS_PC;
+            } else {
+                r.pass = pc == VIA_DONE_PC && board.mem[0x13] == VIA_IRQS >> 8;
+            }
+            break;
+        }
+    }
+    r.seconds = now_seconds() - t0;
+    hostperf_stop(&r.perf);
+    r.cycles = clockticks6502;
+    r.instructions = instructions;
+
+    if (b->kind == BENCH_FORTH) free(con.out);
+    return r;
+}
+
+// Baseline speeds, read back from an earlier output of this tool, which
+// puts each benchmark on a line of its own
+typedef struct {
+    char name[32];
+    double mhz;
+} baseline_t;
+
+static baseline_t baseline[CORPUS_SIZE];
+static int baseline_count;
+
+static bool baseline_read(const char *path) {
+    FILE *f = fopen(path, "r");
+    char line[512];
+
+    if (!f) return false;
+    while (fgets(line, sizeof(line), f) && baseline_count < (int)CORPUS_SIZE) {
+        char *name = strstr(line, "\"name\": \"");
+        char *mhz = strstr(line, "\"mhz\": ");
+        if (!name || !mhz) continue;
+
+        baseline_t *bl = &baseline[baseline_count++];
+        name += strlen("\"name\": \"");
+        size_t len = strcspn(name, "\"");
+        if (len >= sizeof(bl->name)) len = sizeof(bl->name) - 1;
+        memcpy(bl->name, name, len);
+        bl->name[len] = 0;
+        bl->mhz = strtod(mhz + strlen("\"mhz\": "), NULL);
+    }
+    fclose(f);
+    return true;
+}
+
+static double baseline_mhz(const char *name) {
+    for (int i = 0; i < baseline_count; i++) {
+        if (!strcmp(baseline[i].name, name)) return baseline[i].mhz;
+    }
+    return 0.0;
+}
+
+static void usage() {
+    fprintf(stderr, "usage: 6502bench [-r repeat] [-b baseline.json] [-t percent] [-m mhz] [name ...]\n");
+    exit(2);
+}
+
+int main(int argc, char **argv) {
+    int repeat = 3;
+    const char *baseline_path = NULL;
+    double tolerance = DEFAULT_TOLERANCE;
+    double min_mhz = 0.0;
+    int argi = 1;
+
+    // unistd.h (and with it getopt) clashes with brk() in 6502.c
+    for (; argi < argc && argv[argi][0] == '-'; argi++) {
+        const char *opt = argv[argi];
+        if (argi + 1 == argc) usage();
+        if (!strcmp(opt, "-r")) repeat = atoi(argv[++argi]);
+        else if (!strcmp(opt, "-b")) baseline_path = argv[++argi];
+        else if (!strcmp(opt, "-t")) tolerance = atof(argv[++argi]);
+        else if (!strcmp(opt, "-m")) min_mhz = atof(argv[++argi]);
+        else usage();
+    }
+    if (repeat < 1 || tolerance < 0) usage();
+    if (baseline_path && !baseline_read(baseline_path)) {
+        fprintf(stderr, "cannot read %s\n", baseline_path);
+        return 2;
+    }
+
+    bool selected[CORPUS_SIZE];
+    for (size_t i = 0; i < CORPUS_SIZE; i++) {
+        selected[i] = argi == argc;
+    }
+    for (int s = argi; s < argc; s++) {
+        size_t i = 0;
+        while (i < CORPUS_SIZE && strcmp(corpus[i].name, argv[s])) i++;
+        if (i == CORPUS_SIZE) {
+            fprintf(stderr, "unknown benchmark %s\n", argv[s]);
+            return 2;
+        }
+        selected[i] = true;
+    }
+
+    bool all_ok = true;
+    bool first = true;
+    int counters = hostperf_open();
+
+    printf("{\n  \"repeat\": %d,\n  \"tolerance_percent\": %.1f,\n  \"min_mhz\": %.1f,\n", repeat, tolerance, min_mhz);
+    printf("  \"host_counters\": %d,\n", counters);
+    printf("  \"benchmarks\": [\n");
+    for (size_t i = 0; i < CORPUS_SIZE; i++) {
+        if (!selected[i]) continue;
+        const bench_t *b = &corpus[i];
+
+        bench_result_t best = bench_run(b);
+        for (int n = 1; n < repeat && best.pass; n++) {
+            bench_result_t r = bench_run(b);
+            if (!r.pass) best = r;
+            else if (r.seconds < best.seconds) best = r;
+        }
+
+        double mhz = best.seconds > 0 ? best.cycles / best.seconds / 1e6 : 0.0;
+        double ns = best.instructions ? best.seconds * 1e9 / best.instructions : 0.0;
+        double cpi = best.instructions ? (double)best.cycles / best.instructions : 0.0;
+        double base = baseline_mhz(b->name);
+        double change = base > 0 ? 100.0 * (mhz - base) / base : 0.0;
+        bool regression = (base > 0 && change < -tolerance) || mhz < min_mhz;
+
+        if (!best.pass || regression) all_ok = false;
+        fprintf(stderr, "%-6s %-14s %8.2f MHz %7.2f ns/instr %5.2f cycles/instr%s\n",
+                best.pass ? "pass" : "FAIL", b->name, mhz, ns, cpi,
+                regression ? "  REGRESSION" : "");
+
+        printf("%s    {\"name\": \"%s\", \"pass\": %s, \"cycles\": %u, \"instructions\": %llu, "
+               "\"seconds\": %.6f, \"mhz\": %.3f, \"ns_per_instruction\": %.3f, "
+               "\"cycles_per_instruction\": %.4f, ",
+               first ? "" : ",\n", b->name, best.pass ? "true" : "false",
+               best.cycles, (unsigned long long)best.instructions, best.seconds,
+               mhz, ns, cpi);
+        for (int c = 0; c < HOSTPERF_COUNTERS; c++) {
+            printf("\"host_%s_per_instruction\": ", hostperf_names[c]);
+            if (best.perf.valid[c] && best.instructions) {
+                printf("%.4f, ", (double)best.perf.value[c] / best.instructions);
+            } else {
+                printf("null, ");
+            }
+        }
+        printf("\"baseline_mhz\": %.3f, \"change_percent\": %.2f, \"regression\": %s}",
+               base, change, regression ? "true" : "false");
+        first = false;
+    }
+    printf("\n  ],\n  \"pass\": %s\n}\n", all_ok ? "true" : "false");
+
+    return all_ok ? 0 : 1;
+}
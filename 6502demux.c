@@ -0,0 +1,354 @@
+/* Link demultiplexer ***********************************
+ * Splits the link of an emulator with MUX_LINK on      *
+ * (muxlink.c) into its channels: the console to        *
+ * stdout, unless -q, and the trace, profile and        *
+ * snapshots to files, while stdin goes to the console. *
+ *                                                      *
+ *   6502demux [-q] [-o prefix] [-t count] [-p]         *
+ *             [-s address:length] ... device           *
+ *   6502demux [-q] [-o prefix] [-t count] [-p]         *
+ *             [-s address:length] ... -- command ...   *
+ *                                                      *
+ * -t traces the first count instructions into          *
+ * prefix.trace, a line for each, -p counts the         *
+ * instructions run in each page of memory into         *
+ * prefix.profile, and -s saves length bytes of memory  *
+ * from address, both in hex, into prefix-address.bin,  *
+ * with the registers at that moment, once stdin has    *
+ * ended. The trace drops what the link cannot keep up  *
+ * with; the instruction count on each line shows the   *
+ * gaps.                                                *
+ * The prefix is "6502demux". A command runs with its   *
+ * console on pipes, a device is the USB serial port of *
+ * the Pico.                                            *
+ ********************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <poll.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#include "hostlink.c"
+#include "rxflow.c"
+#define FASTLOAD_PROTOCOL_ONLY
+#include "fastload.c"
+#define MUX_PROTOCOL_ONLY
+#include "muxlink.c"
+
+#define MAX_SNAPSHOTS 16
+// Nothing from the emulator for this long ends a wait for an answer; a
+// request is only read once the console input before it has been
+#define ANSWER_TIMEOUT_MS 10000
+#define POLL_MS 100
+
+typedef struct {
+    uint8_t command;
+    uint16_t address, len;
+} request_t;
+
+typedef struct {
+    int in, out;
+    pid_t child;
+    bool quiet;
+    bool stopped; // XOFF came and no XON yet
+    fastload_t frame;
+    const char *prefix;
+
+    // a record of each channel is put together here, from as many frames
+    // as it took
+    uint8_t record[MUX_CHANNELS][MUX_SNAPSHOT_HEADER + FASTLOAD_DATA];
+    uint32_t have[MUX_CHANNELS];
+    uint64_t bytes[MUX_CHANNELS], frames[MUX_CHANNELS], records[MUX_CHANNELS];
+    FILE *trace;
+    uint64_t profile[256];
+
+    // the answer to the last request
+    bool answered;
+    uint8_t status;
+    uint16_t value;
+    uint64_t bad;
+} link_t;
+
+static void usage(void) {
+    fprintf(stderr, "usage: 6502demux [-q] [-o prefix] [-t count] [-p] [-s address:length] ... device\n"
+                    "       6502demux [-q] [-o prefix] [-t count] [-p] [-s address:length] ... -- command [arg ...]\n");
+    exit(2);
+}
+
+static uint32_t get32(const uint8_t *p) {
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+// length of the record of channel that starts in data, once that much of
+// it is in
+static uint32_t record_length(int channel, const uint8_t *data, uint32_t have) {
+    switch (channel) {
+        case MUX_TRACE:
+            return MUX_TRACE_RECORD;
+        case MUX_PROFILE:
+            return MUX_PROFILE_RECORD;
+        default:
+            return have < MUX_SNAPSHOT_HEADER ? MUX_SNAPSHOT_HEADER : MUX_SNAPSHOT_HEADER + (data[14] | (data[15] << 8));
+    }
+}
+
+static void record(link_t *l, int channel, const uint8_t *r) {
+    char path[4096];
+    l->records[channel]++;
+    switch (channel) {
+        case MUX_TRACE:
+            if (!l->trace) {
+                snprintf(path, sizeof(path), "%s.trace", l->prefix);
+                l->trace = fopen(path, "w");
+                if (!l->trace) {
+                    perror(path);
+                    exit(1);
+                }
+            }
+            fprintf(l->trace, "%10u %04X %02X A=%02X X=%02X Y=%02X SP=%02X P=%02X\n", get32(r), r[4] | (r[5] << 8),
+                    r[6], r[7], r[8], r[9], r[10], r[11]);
+            break;
+        case MUX_PROFILE:
+            for (int i = 0; i < 256; i++) l->profile[i] += get32(r + 4 * i);
+            break;
+        case MUX_SNAPSHOT: {
+            uint16_t address = r[12] | (r[13] << 8), len = r[14] | (r[15] << 8);
+            snprintf(path, sizeof(path), "%s-%04X.bin", l->prefix, address);
+            FILE *f = fopen(path, "wb");
+            if (!f || fwrite(r + MUX_SNAPSHOT_HEADER, 1, len, f) != len) {
+                perror(path);
+                exit(1);
+            }
+            fclose(f);
+            fprintf(stderr, "6502demux: %s, PC=%04X A=%02X X=%02X Y=%02X SP=%02X P=%02X after %u instructions\n",
+                    path, r[0] | (r[1] << 8), r[2], r[3], r[4], r[5], r[6], get32(r + 8));
+            break;
+        }
+    }
+}
+
+// bytes of a channel, as a frame brought them
+static void channel_data(link_t *l, int channel, const uint8_t *data, uint32_t len) {
+    if (channel <= MUX_CONSOLE || channel >= MUX_COMMAND) {
+        l->bad++;
+        return;
+    }
+    l->bytes[channel] += len;
+    l->frames[channel]++;
+    uint8_t *r = l->record[channel];
+    for (uint32_t i = 0; i < len; i++) {
+        r[l->have[channel]++] = data[i];
+        if (l->have[channel] == record_length(channel, r, l->have[channel])) {
+            record(l, channel, r);
+            l->have[channel] = 0;
+        }
+    }
+}
+
+static void show(link_t *l, uint8_t c) {
+    if (!l->quiet) putchar(c);
+}
+
+// take in what the emulator sent: false once it has closed
+static bool link_read(link_t *l) {
+    uint8_t buf[4096];
+    ssize_t n = read(l->out, buf, sizeof(buf));
+    if (n <= 0) return false;
+
+    for (ssize_t i = 0; i < n; i++) {
+        uint8_t c = buf[i];
+        if (c == RXFLOW_XOFF || c == RXFLOW_XON) {
+            l->stopped = c == RXFLOW_XOFF;
+            continue;
+        }
+        int taken = fastload_byte(&l->frame, c);
+        if (taken == FASTLOAD_PASS_SOH) show(l, FASTLOAD_SOH);
+        if (taken <= FASTLOAD_PASS_SOH) show(l, c);
+        if (taken != FASTLOAD_READY) continue;
+
+        fastload_t *f = &l->frame;
+        if (f->bad) {
+            l->bad++;
+        } else if (f->got == MUX_KIND && f->len) {
+            channel_data(l, f->body[0], f->body + 1, f->len - 1);
+        } else if (f->got == FASTLOAD_ANSWER && f->len == 4) {
+            l->answered = true;
+            l->status = f->body[1];
+            l->value = f->body[2] | (f->body[3] << 8);
+        }
+        fastload_done(f);
+    }
+    fflush(stdout);
+    return true;
+}
+
+// wait for the emulator to send something: 1 when it did, 0 when not, -1
+// once it has closed
+static int link_wait(link_t *l, int timeout_ms) {
+    struct pollfd pfd = { .fd = l->out, .events = POLLIN };
+    if (poll(&pfd, 1, timeout_ms) < 0) return -1;
+    if (!(pfd.revents & (POLLIN | POLLHUP))) return 0;
+    return link_read(l) ? 1 : -1;
+}
+
+// send a request and wait for its answer, again while the emulator has no
+// room for what it would send: the status, or -1 without an answer
+static int request(link_t *l, request_t r, uint16_t *value) {
+    uint8_t body[FASTLOAD_HEADER] = { r.command, r.address & 0xFF, r.address >> 8, r.len & 0xFF, r.len >> 8 };
+    uint8_t frame[FASTLOAD_FRAME];
+    size_t n = fastload_encode(FASTLOAD_REQUEST, body, sizeof(body), frame);
+
+    while (1) {
+        l->answered = false;
+        if (write(l->in, frame, n) != (ssize_t)n) return -1;
+        for (int waited = 0; !l->answered && waited < ANSWER_TIMEOUT_MS; waited += POLL_MS) {
+            int got = link_wait(l, POLL_MS);
+            if (got < 0) return -1;
+            if (got) waited = 0;
+        }
+        if (!l->answered) return -1;
+        if (l->status != FASTLOAD_FULL) break;
+        link_wait(l, 10);
+    }
+    *value = l->value;
+    return l->status;
+}
+
+static bool send_request(link_t *l, request_t r, uint16_t *value) {
+    int status = request(l, r, value);
+    if (status == FASTLOAD_OK) return true;
+    fprintf(stderr, "6502demux: %c at $%04X %s\n", r.command, r.address,
+            status < 0 ? "got no answer, is MUX_LINK on?" : "was refused");
+    return false;
+}
+
+// stdin to the console until it ends, and what comes back split up
+static void forward(link_t *l) {
+    uint8_t buf[RXFLOW_PACKET];
+    while (1) {
+        struct pollfd pfd[2] = { { .fd = l->out, .events = POLLIN },
+                                 { .fd = STDIN_FILENO, .events = POLLIN } };
+        if (poll(pfd, l->stopped ? 1 : 2, POLL_MS) < 0) return;
+        if ((pfd[0].revents & (POLLIN | POLLHUP)) && !link_read(l)) return;
+        if (!l->stopped && (pfd[1].revents & (POLLIN | POLLHUP))) {
+            ssize_t n = read(STDIN_FILENO, buf, sizeof(buf));
+            if (n <= 0 || write(l->in, buf, n) != n) return;
+        }
+    }
+}
+
+// wait until nothing has come for a while, for the last frames
+static void drain(link_t *l) {
+    while (link_wait(l, l->child > 0 ? -1 : 5 * POLL_MS) > 0) {}
+}
+
+static void report(link_t *l, uint32_t trace_dropped) {
+    static const char *names[MUX_CHANNELS] = { "console", "trace", "profile", "snapshot", "command" };
+    for (int i = MUX_TRACE; i < MUX_COMMAND; i++) {
+        if (!l->frames[i]) continue;
+        fprintf(stderr, "6502demux: %s: %llu bytes in %llu frames, %llu records\n", names[i],
+                (unsigned long long)l->bytes[i], (unsigned long long)l->frames[i],
+                (unsigned long long)l->records[i]);
+    }
+    if (l->frames[MUX_TRACE]) fprintf(stderr, "6502demux: %u trace records dropped\n", trace_dropped);
+    if (l->bad) fprintf(stderr, "6502demux: %llu bad frames\n", (unsigned long long)l->bad);
+    if (!l->records[MUX_PROFILE]) return;
+
+    char path[4096];
+    uint64_t total = 0;
+    snprintf(path, sizeof(path), "%s.profile", l->prefix);
+    FILE *f = fopen(path, "w");
+    if (!f) {
+        perror(path);
+        exit(1);
+    }
+    for (int i = 0; i < 256; i++) total += l->profile[i];
+    for (int i = 0; i < 256; i++) {
+        if (l->profile[i]) {
+            fprintf(f, "%02X00 %12llu %5.1f%%\n", i, (unsigned long long)l->profile[i], 100.0 * l->profile[i] / total);
+        }
+    }
+    fclose(f);
+    fprintf(stderr, "6502demux: %llu instructions profiled into %s\n", (unsigned long long)total, path);
+}
+
+int main(int argc, char **argv) {
+    static link_t l;
+    request_t snapshots[MAX_SNAPSHOTS];
+    int count = 0;
+    long trace = 0;
+    bool profile = false;
+    int argi = 1;
+
+    l.prefix = "6502demux";
+    // unistd.h is fine here, but the options are parsed as in the other tools
+    for (; argi < argc && argv[argi][0] == '-' && strcmp(argv[argi], "--"); argi++) {
+        if (!strcmp(argv[argi], "-q")) {
+            l.quiet = true;
+            continue;
+        }
+        if (!strcmp(argv[argi], "-p")) {
+            profile = true;
+            continue;
+        }
+        if (argi + 1 == argc) usage();
+        char *arg = argv[++argi];
+        if (!strcmp(argv[argi - 1], "-o")) {
+            l.prefix = arg;
+        } else if (!strcmp(argv[argi - 1], "-t")) {
+            trace = strtol(arg, NULL, 0);
+        } else if (!strcmp(argv[argi - 1], "-s") && count < MAX_SNAPSHOTS && strchr(arg, ':')) {
+            long address = strtol(arg, NULL, 16), len = strtol(strchr(arg, ':') + 1, NULL, 16);
+            if (address < 0 || len <= 0 || len > FASTLOAD_DATA || address + len > 0x10000) usage();
+            snapshots[count++] = (request_t){ MUX_SNAPSHOT_TAKE, address, len };
+        } else {
+            usage();
+        }
+    }
+    if (argi == argc || trace < 0 || trace > 0xFFFFFFFFL) usage();
+
+    fastload_init(&l.frame, 0);
+    if (!strcmp(argv[argi], "--")) {
+        if (++argi == argc) usage();
+        l.child = start_command(argv + argi, &l.in, &l.out);
+        if (l.child < 0) {
+            perror("6502demux");
+            return 2;
+        }
+    } else {
+        l.in = l.out = open_device(argv[argi]);
+        if (l.in < 0) {
+            perror(argv[argi]);
+            return 2;
+        }
+    }
+    signal(SIGPIPE, SIG_IGN);
+
+    uint16_t value;
+    uint32_t dropped = 0;
+    bool ok = true;
+    if (trace) ok &= send_request(&l, (request_t){ MUX_TRACE_ON, trace & 0xFFFF, trace >> 16 }, &value);
+    if (profile) ok &= send_request(&l, (request_t){ MUX_PROFILE_DUMP, 1, 0 }, &value);
+    if (ok) forward(&l);
+
+    // what was asked for, now that the input has ended
+    if (ok && trace) {
+        ok &= send_request(&l, (request_t){ MUX_TRACE_ON, 0, 0 }, &value);
+        dropped = value;
+    }
+    if (ok && profile) ok &= send_request(&l, (request_t){ MUX_PROFILE_DUMP, 0, 0 }, &value);
+    for (int i = 0; ok && i < count; i++) ok &= send_request(&l, snapshots[i], &value);
+
+    if (l.child > 0) close(l.in);
+    drain(&l);
+    if (l.child > 0) waitpid(l.child, NULL, 0);
+    if (l.trace) fclose(l.trace);
+    report(&l, dropped);
+    fflush(stdout);
+    return ok ? 0 : 1;
+}
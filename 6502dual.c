@@ -0,0 +1,167 @@
+/* Dual-core host model *********************************
+ * The 6502emu.c split between the CPU core and the I/O *
+ * core, run on two host threads through dualcore.h so  *
+ * the queues can be exercised on Linux.                *
+ *                                                      *
+ *   6502dual            TaliForth on stdin/stdout      *
+ *   6502dual -s count   queue stress test              *
+ *                                                      *
+ * Without -s, the CPU thread runs TaliForth while the  *
+ * I/O thread feeds stdin in and prints its output, and *
+ * both stop once stdin is at its end and TaliForth has *
+ * gone idle. -s pushes count sequenced entries through *
+ * both queues at full speed and checks every one.      *
+ ********************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <poll.h>
+
+#define CHIPS_IMPL
+#include "6502.c"
+#include "6522.h"
+#include "machine.c"
+#include "dualcore.h"
+
+#include "forth.h"
+
+#define FORTH_START 0x8000
+#define FORTH_SIZE 0x8000
+
+#define QUANTUM 10000
+// Empty console reads after the end of input before the CPU stops
+#define IDLE_POLLS 1000
+
+static spsc_t to_io;
+static spsc_t from_io;
+static atomic_bool input_done;
+static atomic_bool cpu_done;
+
+static uint32_t idle;
+static uint32_t stress_count;
+static atomic_uint stress_errors;
+
+static int queue_getc(machine_t *m) {
+    uint32_t ch;
+    (void)m;
+    if (spsc_pop(&from_io, &ch)) {
+        idle = 0;
+        return ch & 0xFF;
+    }
+    if (atomic_load(&input_done)) idle++;
+    return -1;
+}
+
+static void queue_putc(machine_t *m, uint8_t ch) {
+    (void)m;
+    spsc_push_wait(&to_io, DUAL_CONSOLE | ch);
+}
+
+// Second core: stdin -> from_io, to_io -> stdout
+static void io_core() {
+    int pending = -1;
+    uint32_t item;
+
+    for (;;) {
+        if (pending < 0 && !atomic_load(&input_done)) {
+            struct pollfd pfd = { .fd = 0, .events = POLLIN };
+            if (poll(&pfd, 1, 0) > 0) {
+                pending = getchar();
+                if (pending == EOF) {
+                    pending = -1;
+                    atomic_store(&input_done, true);
+                }
+            }
+        }
+        if (pending >= 0 && spsc_push(&from_io, (uint8_t)pending)) {
+            pending = -1;
+        }
+
+        bool drained = true;
+        while (spsc_pop(&to_io, &item)) {
+            if ((item & DUAL_TAG_MASK) == DUAL_CONSOLE) putchar(item & 0xFF);
+            drained = false;
+        }
+        if (drained) {
+            fflush(stdout);
+            if (atomic_load(&cpu_done)) return;
+            dual_relax();
+        }
+    }
+}
+
+// Second core in stress mode: echo every entry back, checking the sequence
+static void stress_core() {
+    uint32_t expect = 0;
+    uint32_t item;
+
+    while (expect < stress_count) {
+        if (!spsc_pop(&to_io, &item)) {
+            dual_relax();
+            continue;
+        }
+        if (item != expect) atomic_fetch_add(&stress_errors, 1);
+        spsc_push_wait(&from_io, item);
+        expect++;
+    }
+}
+
+static int stress(uint32_t count) {
+    uint32_t sent = 0, received = 0;
+    uint32_t item;
+
+    stress_count = count;
+    dual_launch(stress_core);
+    while (received < count) {
+        bool progress = false;
+        if (sent < count && spsc_push(&to_io, sent)) {
+            sent++;
+            progress = true;
+        }
+        if (spsc_pop(&from_io, &item)) {
+            if (item != received) atomic_fetch_add(&stress_errors, 1);
+            received++;
+            progress = true;
+        }
+        if (!progress) dual_relax();
+    }
+    dual_join();
+
+    printf("%u entries each way, %u errors\n", count, atomic_load(&stress_errors));
+    return atomic_load(&stress_errors) ? 1 : 0;
+}
+
+int main(int argc, char **argv) {
+    spsc_init(&to_io);
+    spsc_init(&from_io);
+
+    if (argc == 3 && !strcmp(argv[1], "-s")) {
+        return stress(strtoul(argv[2], NULL, 0));
+    }
+    if (argc != 1) {
+        fprintf(stderr, "usage: 6502dual [-s count]\n");
+        return 2;
+    }
+
+    // unbuffered, so poll() on the descriptor sees everything still unread
+    setvbuf(stdin, NULL, _IONBF, 0);
+
+    machine_t *m = malloc(sizeof(machine_t));
+    machine_init(m, 0);
+    machine_load(m, FORTH_START, taliforth_pico_bin, FORTH_SIZE);
+    m->getc = queue_getc;
+    m->putc = queue_putc;
+    machine_reset(m);
+    hookexternal(machine_tick);
+
+    dual_launch(io_core);
+    while (idle < IDLE_POLLS) {
+        exec6502(QUANTUM);
+    }
+    atomic_store(&cpu_done, true);
+    dual_join();
+
+    fprintf(stderr, "\n%u cycles, %llu instructions\n", clockticks6502, (unsigned long long)instructions);
+    return 0;
+}
@@ -0,0 +1,136 @@
+/* Two-CPU machine **************************************
+ * Two TaliForth machines on two threads, each with its *
+ * own RAM, connected by the mailbox device and a 4K    *
+ * window of shared memory at $6000.                    *
+ *                                                      *
+ *   6502duo coprocessor.fs < main.fs                   *
+ *                                                      *
+ * CPU 0 talks to stdin/stdout. CPU 1 is fed the        *
+ * coprocessor script and its console output goes to    *
+ * stderr. Both stop once stdin is at its end and CPU 0 *
+ * has gone idle.                                       *
+ ********************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <poll.h>
+
+#define M6502_TLS _Thread_local
+#define CHIPS_IMPL
+#include "6502.c"
+#include "6522.h"
+#include "machine.c"
+#include "mailbox.c"
+#include "dualcore.h"
+
+#include "forth.h"
+
+#define FORTH_START 0x8000
+#define FORTH_SIZE 0x8000
+
+#define QUANTUM 10000
+// Empty console reads after the end of input before CPU 0 stops
+#define IDLE_POLLS 1000
+
+static mailbox_t box;
+static mailbox_port_t ports[2] = { { &box, 0 }, { &box, 1 } };
+static machine_t machines[2];
+static script_console_t copro_script;
+static atomic_bool stop;
+
+static bool input_done;
+static uint32_t idle;
+
+static int stdin_getc(machine_t *m) {
+    struct pollfd pfd = { .fd = 0, .events = POLLIN };
+    (void)m;
+
+    if (!input_done && poll(&pfd, 1, 0) > 0) {
+        int ch = getchar();
+        if (ch != EOF) return ch;
+        input_done = true;
+    }
+    if (input_done) idle++;
+    return -1;
+}
+
+static void stdout_putc(machine_t *m, uint8_t ch) {
+    (void)m;
+    putchar(ch);
+}
+
+static void stderr_putc(machine_t *m, uint8_t ch) {
+    (void)m;
+    fputc(ch, stderr);
+}
+
+static void start(machine_t *m, int cpu) {
+    machine_init(m, 0);
+    machine_load(m, FORTH_START, taliforth_pico_bin, FORTH_SIZE);
+    mailbox_attach(m, &ports[cpu]);
+}
+
+// CPU 1, on the second thread
+static void copro_core() {
+    machine_t *m = &machines[1];
+
+    machine_reset(m);
+    hookexternal(machine_tick);
+    while (!atomic_load(&stop)) {
+        exec6502(QUANTUM);
+    }
+    fprintf(stderr, "\ncpu 1: %u cycles, %llu instructions\n", clockticks6502, (unsigned long long)instructions);
+}
+
+static char *read_file(const char *path, size_t *len) {
+    FILE *f = fopen(path, "rb");
+    if (!f) return NULL;
+
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    char *data = malloc(size + 1);
+    *len = fread(data, 1, size, f);
+    data[*len] = 0;
+    fclose(f);
+    return data;
+}
+
+int main(int argc, char **argv) {
+    if (argc != 2) {
+        fprintf(stderr, "usage: 6502duo coprocessor.fs < main.fs\n");
+        return 2;
+    }
+    size_t len;
+    char *script = read_file(argv[1], &len);
+    if (!script) {
+        fprintf(stderr, "cannot read %s\n", argv[1]);
+        return 2;
+    }
+
+    // unbuffered, so poll() on the descriptor sees everything still unread
+    setvbuf(stdin, NULL, _IONBF, 0);
+
+    mailbox_init(&box);
+    start(&machines[0], 0);
+    machines[0].getc = stdin_getc;
+    machines[0].putc = stdout_putc;
+    start(&machines[1], 1);
+    machine_script(&machines[1], &copro_script, script, len);
+    machines[1].putc = stderr_putc;
+
+    dual_launch(copro_core);
+
+    machine_reset(&machines[0]);
+    hookexternal(machine_tick);
+    while (idle < IDLE_POLLS) {
+        exec6502(QUANTUM);
+    }
+    fflush(stdout);
+    atomic_store(&stop, true);
+    dual_join();
+
+    fprintf(stderr, "cpu 0: %u cycles, %llu instructions\n", clockticks6502, (unsigned long long)instructions);
+    return 0;
+}
@@ -6,23 +6,124 @@
 
 #include <stdio.h>
 
-#include "pico/stdlib.h"
-#include "pico/time.h"
-#include "hardware/clocks.h"
-#include "hardware/vreg.h"
+#include "hal.h"
 #define CHIPS_IMPL
 #include "6502.c"
 #include "6522.h"
+#include "machine.c"
 
-#define VIA_BASE_ADDRESS UINT16_C(0xFF90)
+// If this is active, the VIA ports are mirrored on the GPIO pins
+#define VIA_GPIO
 
 // If this is active, then an overclock will be applied
 #define OVERCLOCK
+// If this is active, core 0 only runs the 6502 while core 1 services
+// the USB console and the GPIO pins, connected by SPSC queues
+//#define DUAL_CORE
+// If this is active, console input is read ahead into a receive buffer of
+// a few USB packets, which holds the host back with XON/XOFF and answers
+// ENQ with the bytes received, for 6502upload (rxflow.c)
+//#define CONSOLE_FLOW
+// If this is active too, 6502load can pause the CPU and write memory
+// images over the console (fastload.c)
+//#define FAST_LOAD
+// If this is active as well, trace, profile and snapshot streams go out
+// in frames next to the console, for 6502demux (muxlink.c)
+//#define MUX_LINK
 // Comment this to run your own ROM
 //#define TESTING
+// If this is active, the hot words of TaliForth run natively (forthtrap.c),
+// with the same results and about the same cycle count
+//#define FORTH_NATIVE
+// If this is active as well, FIND-NAME and SEARCH-WORDLIST take this many
+// cycles flat instead of the ROM's, which speeds up loading big sources
+//#define FORTH_FAST_FIND 150
+// If this is active, $42 and a service byte call the host (hostcall.c)
+//#define HOST_CALLS
+// If this is active, the DMA engine of dma.c answers at $F0B0
+#define DMA_ENGINE
+// If this is active, the math coprocessor of mathcop.c answers at $F0C0
+#define MATH_COPROCESSOR
+// If this is active too, UM* and UM/MOD of TaliForth use it
+//#define MATH_FORTH
+// If this is active, the floating point unit of fpu.c answers at $F0D0
+#define FPU_UNIT
+// If this is active, the cooked line input of linein.c answers at $F0E0
+#define LINE_INPUT
+// If this is active too, ACCEPT of TaliForth takes whole lines from it,
+// edited and echoed on the host, with its own history
+//#define LINE_FORTH
+
+#if defined(DUAL_CORE) && defined(TESTING)
+// the test suite prints its progress from core 0 all the way through
+#undef DUAL_CORE
+#endif
+#ifdef DUAL_CORE
+#include "dualcore.h"
+#endif
+
+#ifdef CONSOLE_FLOW
+#include "rxflow.c"
+rxflow_t console_rx; // on core 1 with DUAL_CORE
+#endif
+
+#ifdef FAST_LOAD
+#ifndef CONSOLE_FLOW
+#error FAST_LOAD needs CONSOLE_FLOW
+#endif
+#include "fastload.c"
+// Instructions between looks for a frame
+#define FASTLOAD_POLL 4096
+fastload_t fast_load; // decoded where console_rx is filled, run on core 0
+#endif
+
+#ifdef MUX_LINK
+#ifndef FAST_LOAD
+#error MUX_LINK needs FAST_LOAD
+#endif
+#include "muxlink.c"
+mux_t mux_link; // written on core 0, pumped where the console is written
+#endif
+
+#ifdef HOST_CALLS
+#include "hostcall.c"
+hostcall_t host_calls;
+#endif
+
+#ifdef DMA_ENGINE
+#include "dma.c"
+dma_t dma_engine;
+#endif
+
+#ifdef FPU_UNIT
+#include "fpu.c"
+fpu_t fpu_unit;
+#endif
+
+#if defined(FORTH_NATIVE) || defined(MATH_COPROCESSOR) || defined(LINE_INPUT)
+#include "forthdict.c"
+#endif
+
+#ifdef MATH_COPROCESSOR
+#include "mathcop.c"
+mathcop_t math_coprocessor;
+#endif
+
+#ifdef LINE_INPUT
+#include "linein.c"
+linein_t line_input;
+#endif
 
-// Delay startup by so many seconds
+#ifndef PICO_ON_DEVICE
+#define PICO_ON_DEVICE 0
+#endif
+
+// Delay startup by so many seconds, to give time to open the USB console
+#if PICO_ON_DEVICE
 #define START_DELAY 6
+#else
+#define START_DELAY 0
+#endif
 // The address at which to put your ROM file
 #define ROM_START 0x8000
 //Size of your ROM
@@ -32,8 +133,10 @@
 // Variable in which your rom data is stored
 #define ROM_VAR taliforth_pico_bin
 
-#ifdef VIA_BASE_ADDRESS
-m6522_t via;
+// Once console input has ended (host only), stop after this many empty reads
+#define IDLE_POLLS 1000
+
+#ifdef VIA_GPIO
 uint32_t gpio_dirs;
 uint32_t gpio_outs;
 #define GPIO_PORTA_MASK 0xFF  // PORTB of via is translated to GPIO pins 0 to 7
@@ -47,244 +150,441 @@ uint32_t gpio_outs;
 #define R_VAR __65C02_extended_opcodes_test_bin
 #define R_START 0
 #define R_SIZE 0x10000
+#define R_FLAGS MACHINE_RAW
 
-uint16_t old_pc = 0;
-uint16_t old_pc1 = 0;
-uint16_t old_pc2 = 0;
-uint16_t old_pc3 = 0;
-uint16_t old_pc4 = 0;
+#include "until.c"
+#define SUCCESS_PC 0x24F1
+// The suite keeps the number of the test it is on here
+#define TEST_NUMBER 0x202
 
 #else
 #include ROM_FILE
+#ifdef FORTH_NATIVE
+#include "forthtrap.c"
+forthtrap_t forth_traps;
+#endif
 #define R_VAR ROM_VAR
 #define R_START ROM_START
 #define R_SIZE ROM_SIZE
-uint32_t old_ticks = 0;
-
-
+#define R_FLAGS 0
 #endif
 
-uint8_t mem[0x10000];
-absolute_time_t start;
+machine_t board;
+uint64_t start;
 bool running = true;
-
-uint64_t via_pins = 0;
-
-void via_update() {
-    // uint8_t pa = M6522_GET_PA(via_pins);
-    // uint8_t pb = M6522_GET_PB(via_pins);
-
-    // //
-    // // Turn on led when first bit of PB is set
-    // gpio_put(PICO_DEFAULT_LED_PIN, pb & 1);
-
-    //printf("pins  %lx\n", (uint32_t)(via_pins & 0XFFFFFFFF));
-    //printf("irq   %lx\n", (uint32_t)(M6522_IRQ & 0XFFFFFFFF));
-    if ((uint32_t)(via_pins & 0XFFFFFFFF) & (uint32_t)(M6522_IRQ & 0XFFFFFFFF)) {
-        //printf("via irq\n");
-        irq6502(); 
-    }
+bool input_ended = false;
+uint32_t idle_polls = 0;
+
+#ifdef CONSOLE_FLOW
+// Room in the receive buffer for the next byte from the console
+static inline bool console_room() {
+#ifdef FAST_LOAD
+    // it may bring an SOH held back with it, and a frame waiting for the
+    // CPU holds up what comes after
+    return !atomic_load_explicit(&fast_load.ready, memory_order_acquire) &&
+           RXFLOW_SIZE - rxflow_count(&console_rx) >= 2;
+#else
+    return !rxflow_full(&console_rx);
+#endif
 }
 
-uint8_t read6502(uint16_t address) {
-#ifndef TESTING
-    if (address == 0xf004) {
-        int16_t ch = getchar_timeout_us(100);
-        if (ch == PICO_ERROR_TIMEOUT) {
-           return 0;
-        }
-        return (uint8_t) ch & 0xFF;
-#ifdef VIA_BASE_ADDRESS
-    } else if ((address & 0xFFF0) == VIA_BASE_ADDRESS) {
-        
-        via_pins &= ~(M6522_RS_PINS | M6522_CS2); // clear RS pins - set CS2 low
-        // Set via   RW high   set selected  set RS pins
-        via_pins |= (M6522_RW | M6522_CS1 | ((uint16_t)M6522_RS_PINS & address));
-
-        via_pins = m6522_tick(&via, via_pins);
-        // Via trigrred IRQ
-        uint8_t vdata = M6522_GET_DATA(via_pins);
-        //printf("reading from VIA: %04X %02X \n", address, vdata);
-        via_update();
-        //old_ticks > 0 ? old_ticks-- : 0;
-        return vdata;
+// Top up the receive buffer once it runs low, waiting up to timeout_us for
+// the first byte, and send the host what the buffer has to say. false once
+// console input has ended
+bool console_receive(uint32_t timeout_us) {
+    char reply[RXFLOW_REPLY];
+    bool open = true;
+    int ch;
+
+#ifdef FAST_LOAD
+    // frames do not go into the buffer, so they are read whenever they come
+    bool wanted = rxflow_low(&console_rx) || fastload_framing(&fast_load) ||
+                  atomic_load_explicit(&fast_load.paused, memory_order_relaxed);
+#else
+    bool wanted = rxflow_low(&console_rx);
 #endif
-    }
+    if (wanted) {
+        while (console_room() && (ch = hal_getchar(timeout_us)) != HAL_NO_CHAR) {
+            if (ch == HAL_EOF) {
+                open = false;
+                break;
+            }
+            timeout_us = 0;
+#ifdef FAST_LOAD
+            int taken = fastload_byte(&fast_load, ch);
+            if (taken == FASTLOAD_READY) {
+                break;
+            }
+            if (taken == FASTLOAD_TAKEN) {
+                continue;
+            }
+            if (taken == FASTLOAD_PASS_SOH) {
+                rxflow_put(&console_rx, FASTLOAD_SOH);
+            }
 #endif
-    return mem[address];
+            rxflow_put(&console_rx, ch);
+            // answered before anything after it is counted
+            if (console_rx.enquiry) {
+                break;
+            }
+        }
+    }
+    int n = rxflow_reply(&console_rx, reply);
+    for (int i = 0; i < n; i++) {
+        hal_putchar(reply[i]);
+    }
+    return open;
 }
+#endif
 
-void write6502(uint16_t address, uint8_t value) {
-#ifdef TESTING
-    mem[address] = value;
-    if (address == 0x202) {
-        printf("next test is %d\n", value);
-    }
+#ifdef DUAL_CORE
+spsc_t to_io;   // core 0 -> core 1: console output and GPIO updates
+spsc_t from_io; // core 1 -> core 0: console input
+
+// Core 1: moves console characters between the console and the queues and
+// applies GPIO changes made by the 6502 through the VIA
+void io_core() {
+    int pending = HAL_NO_CHAR;
+    bool input_open = true;
+    uint32_t dirs = 0;
+    uint32_t item;
+
+    while (1) {
+#ifdef CONSOLE_FLOW
+        if (input_open && !console_receive(0)) {
+            pending = HAL_EOF;
+            input_open = false;
+        }
+        int ch;
+        while ((ch = rxflow_peek(&console_rx)) >= 0 && spsc_push(&from_io, DUAL_CONSOLE | ch)) {
+            rxflow_get(&console_rx);
+        }
+        // the end goes after the last byte
+        if (pending == HAL_EOF && ch < 0 && spsc_push(&from_io, DUAL_CONTROL | DUAL_INPUT_ENDED)) {
+            pending = HAL_NO_CHAR;
+        }
 #else
-    if (address == 0xf001) {
-        printf("%c", value);
-#ifdef VIA_BASE_ADDRESS
-    } else if ((address & 0xFFF0) == VIA_BASE_ADDRESS) {
-        //printf("writing to VIA %04X val: %02X\n", address, value);
-        via_pins &= ~(M6522_RW | M6522_RS_PINS | M6522_CS2); // SET RW pin low to write - clear data pins - clear RS pins
-        // Set via selected      set RS pins                 set data pins
-        via_pins |= (M6522_CS1 | ((uint16_t)M6522_RS_PINS & address));
-        M6522_SET_DATA(via_pins, value);
-        
-
-
-        if (((uint16_t)M6522_RS_PINS & address) == M6522_REG_DDRB) {
-            // Setting DDRB / Set pins to in/output
-            gpio_dirs &= ~((uint32_t)GPIO_PORTB_MASK);
-            gpio_dirs |= (uint32_t)(value << GPIO_PORTB_BASE_PIN) & (uint32_t)GPIO_PORTB_MASK;
-            gpio_set_dir_all_bits(gpio_dirs);
+        if (pending == HAL_NO_CHAR && input_open) {
+            pending = hal_getchar(0);
         }
-
-        if (((uint16_t)M6522_RS_PINS & address) == M6522_REG_RB) {
-            // Setting DDRB / Set pins to in/output
-            gpio_outs &= ~((uint32_t)GPIO_PORTB_MASK);
-            gpio_outs |= (uint32_t)(value << GPIO_PORTB_BASE_PIN) & (uint32_t)GPIO_PORTB_MASK;
-            gpio_put_masked(gpio_dirs, gpio_outs);
+        if (pending == HAL_EOF) {
+            if (spsc_push(&from_io, DUAL_CONTROL | DUAL_INPUT_ENDED)) {
+                pending = HAL_NO_CHAR;
+                input_open = false;
+            }
+        } else if (pending >= 0 && spsc_push(&from_io, DUAL_CONSOLE | (uint8_t)pending)) {
+            pending = HAL_NO_CHAR;
         }
+#endif
 
-        if (((uint16_t)M6522_RS_PINS & address) == M6522_REG_DDRA) {
-            // Setting DDRB / Set pins to in/output
-            gpio_dirs &= ~((uint32_t)GPIO_PORTA_MASK);
-            gpio_dirs |= (uint32_t)(value << GPIO_PORTA_BASE_PIN) & (uint32_t)GPIO_PORTA_MASK;
-            gpio_set_dir_all_bits(gpio_dirs);
+        while (spsc_pop(&to_io, &item)) {
+            switch (item & DUAL_TAG_MASK) {
+                case DUAL_CONSOLE:
+                    hal_putchar(item & 0xFF);
+                    break;
+                case DUAL_GPIO_DIRS:
+                    dirs = item & ~DUAL_TAG_MASK;
+                    hal_gpio_set_dirs(dirs);
+                    break;
+                case DUAL_GPIO_OUTS:
+                    hal_gpio_put(dirs, item & ~DUAL_TAG_MASK);
+                    break;
+                case DUAL_CONTROL:
+                    if ((item & ~DUAL_TAG_MASK) == DUAL_STOP) {
+#ifdef MUX_LINK
+                        // what the channels still hold
+                        while (mux_pump(&mux_link)) {}
+#endif
+                        return;
+                    }
+                    break;
+            }
         }
+#ifdef MUX_LINK
+        // one frame between looks at the console
+        mux_pump(&mux_link);
+#endif
+        dual_relax();
+    }
+}
+#endif
 
-        if (((uint16_t)M6522_RS_PINS & address) == M6522_REG_RA) {
-            // Setting DDRB / Set pins to in/output
-            gpio_outs &= ~((uint32_t)GPIO_PORTA_MASK);
-            gpio_outs |= (uint32_t)(value << GPIO_PORTA_BASE_PIN) & (uint32_t)GPIO_PORTA_MASK;
-            gpio_put_masked(gpio_dirs, gpio_outs);
+int console_getc(machine_t *m) {
+#ifdef DUAL_CORE
+    uint32_t item;
+    while (spsc_pop(&from_io, &item)) {
+        if ((item & DUAL_TAG_MASK) == DUAL_CONSOLE) {
+            return item & 0xFF;
         }
-        
-        via_pins = m6522_tick(&via, via_pins);
-
-        via_update();
-        //old_ticks > 0 ? old_ticks-- : 0;
+        input_ended = true;
+    }
+#elif defined(CONSOLE_FLOW)
+    if (!input_ended && !console_receive(rxflow_count(&console_rx) ? 0 : 100)) {
+        input_ended = true;
+    }
+    int ch = rxflow_get(&console_rx);
+    if (ch >= 0) {
+        return ch;
+    }
+#else
+    int ch = hal_getchar(100);
+    if (ch >= 0) {
+        return ch;
+    }
+    if (ch == HAL_EOF) {
+        input_ended = true;
+    }
 #endif
-    } else {
-        mem[address] = value;
+    if (input_ended && ++idle_polls >= IDLE_POLLS) {
+        running = false;
     }
+    return -1;
+}
+
+void console_putc(machine_t *m, uint8_t c) {
+#ifdef DUAL_CORE
+    spsc_push_wait(&to_io, DUAL_CONSOLE | c);
+#else
+    hal_putchar(c);
 #endif
 }
 
+#ifdef VIA_GPIO
+void gpio_dirs_changed() {
+#ifdef DUAL_CORE
+    spsc_push_wait(&to_io, DUAL_GPIO_DIRS | gpio_dirs);
+#else
+    hal_gpio_set_dirs(gpio_dirs);
+#endif
+}
 
+void gpio_outs_changed() {
+#ifdef DUAL_CORE
+    spsc_push_wait(&to_io, DUAL_GPIO_OUTS | gpio_outs);
+#else
+    hal_gpio_put(gpio_dirs, gpio_outs);
+#endif
+}
+
+void via_gpio(machine_t *m, uint8_t reg, uint8_t value) {
+    if (reg == M6522_REG_DDRB) {
+        // Setting DDRB / Set pins to in/output
+        gpio_dirs &= ~((uint32_t)GPIO_PORTB_MASK);
+        gpio_dirs |= (uint32_t)(value << GPIO_PORTB_BASE_PIN) & (uint32_t)GPIO_PORTB_MASK;
+        gpio_dirs_changed();
+    }
 
+    if (reg == M6522_REG_RB) {
+        // Setting RB / Set output pins
+        gpio_outs &= ~((uint32_t)GPIO_PORTB_MASK);
+        gpio_outs |= (uint32_t)(value << GPIO_PORTB_BASE_PIN) & (uint32_t)GPIO_PORTB_MASK;
+        gpio_outs_changed();
+    }
 
-void callback() {
-    #ifdef TESTING
-        if ((pc == old_pc) && (old_pc == old_pc1)) {
+    if (reg == M6522_REG_DDRA) {
+        // Setting DDRA / Set pins to in/output
+        gpio_dirs &= ~((uint32_t)GPIO_PORTA_MASK);
+        gpio_dirs |= (uint32_t)(value << GPIO_PORTA_BASE_PIN) & (uint32_t)GPIO_PORTA_MASK;
+        gpio_dirs_changed();
+    }
 
-            if (clockticks6502%1000000 == 0) {
-                absolute_time_t now = get_absolute_time();
-                int64_t elapsed = absolute_time_diff_us(start, now);
+    if (reg == M6522_REG_RA) {
+        // Setting RA / Set output pins
+        gpio_outs &= ~((uint32_t)GPIO_PORTA_MASK);
+        gpio_outs |= (uint32_t)(value << GPIO_PORTA_BASE_PIN) & (uint32_t)GPIO_PORTA_MASK;
+        gpio_outs_changed();
+    }
+}
+#endif
 
-                float khz = (double)clockticks6502 / (double)(elapsed);
 
-                printf("Average emulated speed was %.3f MHz\n", khz);
-            }
-            
-            if (old_pc == 0x24F1) {
-                printf("65C02 test suite passed sucessfully!\n\n");
-
-                absolute_time_t now = get_absolute_time();
-                int64_t elapsed = absolute_time_diff_us(start, now);
-
-                float khz = (double)clockticks6502 / (double)(elapsed);
-
-                printf("Average emulated speed was %.3f MHz\n", khz);
-                printf("Average emulated speed was %.3f MHz\n", khz);
-                
-            } else {
-                printf("65C02 test suite failed\n");
-                printf("pc %04X opcode: %02X test: %d status: %02X \n", old_pc, opcode, mem[0x202], status);
-                printf("a %02X x: %02X y: %02X value: %02X \n\n", a, x, y, value);
-            }
 
-            running= false;
-            
-            
-        }
-        old_pc4 = old_pc3;
-        old_pc3 = old_pc2;
-        old_pc2 = old_pc1;
-        old_pc1 = old_pc;
-        old_pc = pc;
-    #endif
-    //if (clockticks6502 % 100 == 0) {
-        // absolute_time_t now = get_absolute_time();
-        // int64_t elapsed = absolute_time_diff_us(start, now);
-
-        // float khz = (float)clockticks6502 / (float)(elapsed/1000.0);
-
-        // printf("kHz %.2f\n", khz);
-    //}
-
-#ifdef VIA_BASE_ADDRESS
+void callback() {
     // one tick for each clock to keep accurate time
-    for (uint16_t i = 0; i < clockticks6502-old_ticks; i++) {
-        via_pins = m6522_tick(&via, via_pins);
+    machine_tick();
+#ifdef MUX_LINK
+    if (mux_link.watching) {
+        mux_step(&mux_link);
     }
+#endif
+}
 
-    via_update();
-    
-    old_ticks = clockticks6502;
+#ifdef FAST_LOAD
+// Every FASTLOAD_POLL instructions: runs a frame that has come in, and
+// while 6502load has the CPU paused, waits for the next one. Without
+// DUAL_CORE this is also where the multiplexed link sends a frame
+void fast_load_poll() {
+    bool paused;
+    do {
+        paused = atomic_load_explicit(&fast_load.paused, memory_order_relaxed);
+#ifdef DUAL_CORE
+        if (paused) {
+            dual_relax();
+        }
+#else
+        if (!input_ended && !console_receive(paused ? 100 : 0)) {
+            input_ended = true;
+        }
+#ifdef MUX_LINK
+        mux_pump(&mux_link);
+#endif
+#endif
+        if (atomic_load_explicit(&fast_load.ready, memory_order_acquire)) {
+            fastload_run(&fast_load, &board);
+        }
+        // no one left to start it again
+        if (paused && input_ended) {
+            running = false;
+        }
+    } while (paused && running);
+}
 #endif
-    
+
+#ifdef TESTING
+// The suite ends on a branch or jump to itself, which the core detects
+void test_report() {
+    uint64_t elapsed = hal_time_us() - start;
+    float mhz = (double)clockticks6502 / (double)(elapsed);
+
+    if (pc == SUCCESS_PC) {
+        printf("65C02 test suite passed sucessfully!\n\n");
+        printf("Average emulated speed was %.3f MHz\n", mhz);
+    } else {
+        printf("65C02 test suite failed\n");
+        printf("pc %04X opcode: %02X test: %d status: %02X \n", pc, opcode, board.mem[TEST_NUMBER], status);
+        printf("a %02X x: %02X y: %02X value: %02X \n\n", a, x, y, value);
+    }
 }
+#endif
 
 
 
 int main() {
 #ifdef OVERCLOCK
-    vreg_set_voltage(VREG_VOLTAGE_1_15);
-    set_sys_clock_khz(280000, true);
+    hal_overclock();
 #endif
-    stdio_init_all();
+    hal_init();
 
     for(uint8_t i = START_DELAY; i > 0; i--) {
         printf("Starting in %d \n", i);
-        sleep_ms(1000);
+        hal_sleep_ms(1000);
     }
 
     printf("Starting\n");
 
+#ifdef CONSOLE_FLOW
+    rxflow_init(&console_rx);
+#endif
+#ifdef FAST_LOAD
+    fastload_init(&fast_load, FASTLOAD_REQUEST);
+#endif
+#ifdef MUX_LINK
+    mux_init(&mux_link, hal_putchar);
+    mux_open(&mux_link, MUX_TRACE, 4096, 1);
+    mux_open(&mux_link, MUX_PROFILE, 2048, 3);
+    mux_open(&mux_link, MUX_SNAPSHOT, 8192, 2);
+    mux_open(&mux_link, MUX_COMMAND, 256, 4);
+    mux_commands(&mux_link, &fast_load);
+#endif
+
     if (R_START + R_SIZE > 0x10000) {
         printf("Your rom will not fit. Either adjust ROM_START or ROM_SIZE\n");
         while(1) {}
     }
-    for (int i = R_START; i < R_SIZE + R_START; i++) {
-        mem[i] = R_VAR[i-R_START];
-    }
+    machine_init(&board, R_FLAGS);
+    machine_load(&board, R_START, R_VAR, R_SIZE);
+    board.getc = console_getc;
+    board.putc = console_putc;
+#ifdef DMA_ENGINE
+    dma_init(&dma_engine);
+    dma_attach(&board, &dma_engine);
+#endif
+#ifdef MATH_COPROCESSOR
+    mathcop_init(&math_coprocessor);
+    mathcop_attach(&board, &math_coprocessor);
+#if defined(MATH_FORTH) && !defined(TESTING)
+    printf("%d Forth words use the math coprocessor\n", mathcop_patch(&board, R_START));
+#endif
+#endif
+#ifdef FPU_UNIT
+    fpu_init(&fpu_unit);
+    fpu_attach(&board, &fpu_unit);
+#endif
+#if defined(FORTH_NATIVE) && !defined(TESTING)
+    printf("%d Forth words run natively\n", forthtrap_load(&forth_traps, &board, R_START));
+#ifdef FORTH_FAST_FIND
+    forthtrap_cost(&forth_traps, "find-name", FORTH_FAST_FIND, 0, 0);
+    forthtrap_cost(&forth_traps, "search-wordlist", FORTH_FAST_FIND, 0, 0);
+#endif
+#endif
+#ifdef LINE_INPUT
+    // after the native words, which it keeps
+    linein_init(&line_input);
+    linein_attach(&board, &line_input);
+#if defined(LINE_FORTH) && !defined(TESTING)
+    if (linein_forth(&board, &line_input, R_START)) printf("ACCEPT takes whole lines\n");
+#endif
+#endif
 
-    hookexternal(callback);
-    reset6502();
-#ifdef VIA_BASE_ADDRESS
-    // setup VIA
-    m6522_init(&via);
-    m6522_reset(&via);
+#ifdef VIA_GPIO
+    board.via_write = via_gpio;
     gpio_dirs = 0; //GPIO_PORTB_MASK | GPIO_PORTA_MASK;
     gpio_outs = 0;
     // Init GPIO
     // Set pins 0 to 7 as output as well as the LED, the others as input
-    gpio_init_mask(gpio_dirs);
-    gpio_set_dir_all_bits(gpio_dirs);
-
+    hal_gpio_init(gpio_dirs);
+    hal_gpio_set_dirs(gpio_dirs);
 #endif
 
-
+    machine_reset(&board);
+    start = hal_time_us();
+#ifdef HOST_CALLS
+    hostcall_init(&host_calls);
+    hostcall_enable(&board, &host_calls);
+#endif
 
 #ifdef TESTING
+    hookexternal(NULL);
     pc = 0X400;
+    // full speed between test numbers, the suite ends on a trap
+    until_t until;
+    until_init(&until);
+    until_add(&until, UNTIL_CHANGE, TEST_NUMBER, 0);
+    while (run_until(&until, UINT32_MAX) >= 0) {
+        printf("next test is %d\n", board.mem[TEST_NUMBER]);
+    }
+    test_report();
+#else
+#ifdef DUAL_CORE
+    // after the last printf, from here on core 1 owns the console
+    spsc_init(&to_io);
+    spsc_init(&from_io);
+    dual_launch(io_core);
+#endif
+    hookexternal(callback);
+#ifdef FAST_LOAD
+    uint32_t fast_load_steps = 0;
 #endif
-    start = get_absolute_time();
-
     while (running) {
         step6502();
+#ifdef FAST_LOAD
+        if (++fast_load_steps == FASTLOAD_POLL) {
+            fast_load_steps = 0;
+            fast_load_poll();
+        }
+#endif
     }
+#endif
+
+#if defined(MUX_LINK) && !defined(DUAL_CORE)
+    while (mux_pump(&mux_link)) {}
+#endif
+#ifdef DUAL_CORE
+    spsc_push_wait(&to_io, DUAL_CONTROL | DUAL_STOP);
+#if !PICO_ON_DEVICE
+    dual_join();
+#endif
+#endif
+    fflush(stdout);
     return 0;
 }
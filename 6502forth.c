@@ -0,0 +1,497 @@
+/* Native Forth words ***********************************
+ * Checks the native TaliForth words of forthtrap.c     *
+ * against the ROM code they replace.                   *
+ *                                                      *
+ *   6502forth [-k] [-c] [-l] [-f cycles] [-s samples]  *
+ *             [script.fs ...]                          *
+ *                                                      *
+ * Every script, or without any a built-in set that     *
+ * leans on those words, is typed into a TaliForth      *
+ * machine twice: once on the ROM code and once with    *
+ * the native words. Both runs must print the same.     *
+ * -c runs the second time with UM* and UM/MOD patched  *
+ * to use the math coprocessor of mathcop.c instead.    *
+ * -l runs it with ACCEPT taking whole lines from the   *
+ * line discipline of linein.c instead.                 *
+ * -f charges each FIND-NAME and SEARCH-WORDLIST the    *
+ * given cycles flat, as a hashed dictionary would,     *
+ * instead of what the ROM's walk of the lists takes.   *
+ * -k calls each word on its own with random arguments, *
+ * both ways, compares the stack and memory they leave  *
+ * and fits the cycles the ROM code took to the cost    *
+ * table. Exit code 0 when everything matched.          *
+ ********************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define CHIPS_IMPL
+#include "6502.c"
+#include "6522.h"
+#include "machine.c"
+#include "forthdict.c"
+#include "forthtrap.c"
+#include "mathcop.c"
+#include "linein.c"
+
+#include "forth.h"
+
+#define FORTH_START 0x8000
+#define FORTH_SIZE 0x8000
+
+#define QUANTUM 10000
+// Empty console reads after the end of the script before a run is done
+#define IDLE_POLLS 1000
+#define MAX_CYCLES 2000000000u
+
+// -k: a word is called from a stub in RAM with its arguments on the data
+// stack at CALL_X and returns to a jump to itself
+#define CALL_STUB 0x7E00
+#define CALL_X 0x50
+#define CALL_MAX_CYCLES 10000000u
+#define SCRATCH 0x4000
+#define SCRATCH_SIZE 0x2000
+#define HOLD_END 0x6F00
+#define DEFAULT_SAMPLES 2000
+#define MAX_SAMPLES 100000
+
+typedef struct {
+    const char *name;
+    const char *script;
+} script_t;
+
+static const script_t builtin[] = {
+    { "output",
+      ": dots 0 do i . loop ;\n"
+      "3000 dots\n"
+      "hex 3000 dots decimal\n"
+      ": doubles 0 do i 1000 um* d. loop ;\n"
+      "800 doubles\n" },
+    { "parse",
+      ": parse 0 1500 0 do s\" 1234567\" 0 0 2swap >number 2drop drop + loop ;\n"
+      "parse u.\n"
+      "1 2 3 4 5 6 7 8 9 10 11 12 13 14 15 16 17 18 19 20 + + + + + + + + + + + + + + + + + + + .\n"
+      "hex ff 7fff abcd + + . decimal\n" },
+    { "memory",
+      "create buf 200 allot create buf2 200 allot\n"
+      ": text s\" the quick brown fox jumps over the lazy dog   \" ;\n"
+      ": strs 0 1500 0 do text buf swap move buf 46 text compare + "
+      "buf buf 1+ 100 move buf 1+ buf 100 move "
+      "buf 200 i fill buf2 200 i 1+ fill buf 200 buf2 200 compare + loop ;\n"
+      "strs .\n" },
+    { "math",
+      ": muls 0 3000 0 do i 1+ 37 * 5 / + i 13 um* 7 um/mod + + loop ;\n"
+      "muls u.\n"
+      ": scale 0 2000 0 do i 355 113 */ + loop ;\n"
+      "scale u.\n" },
+};
+#define BUILTIN_SIZE (sizeof(builtin) / sizeof(builtin[0]))
+
+static machine_t board;
+static forthtrap_t traps;
+static mathcop_t cop;
+static linein_t lines;
+// Flat cost of a dictionary lookup with -f, -1 for the ROM's own
+static int find_cycles = -1;
+
+// What the second run of a script uses
+enum run_mode { RUN_ROM, RUN_NATIVE, RUN_MATHCOP, RUN_LINEIN };
+
+static double now_seconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static char *read_file(const char *path, size_t *len) {
+    FILE *f = fopen(path, "rb");
+    if (!f) return NULL;
+    fseek(f, 0, SEEK_END);
+    *len = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    char *data = malloc(*len + 1);
+    *len = fread(data, 1, *len, f);
+    fclose(f);
+    return data;
+}
+
+static void usage() {
+    fprintf(stderr, "usage: 6502forth [-k] [-c] [-l] [-f cycles] [-s samples] [script.fs ...]\n");
+    exit(2);
+}
+
+/* Scripts **********************************************/
+
+typedef struct {
+    char *out;
+    size_t out_len;
+    uint32_t cycles;
+    uint64_t instructions;
+    double seconds;
+} run_t;
+
+static run_t run_script(const char *script, size_t len, enum run_mode mode) {
+    script_console_t con;
+    run_t r;
+
+    machine_clear_points(&board);
+    machine_init(&board, 0);
+    machine_load(&board, FORTH_START, taliforth_pico_bin, FORTH_SIZE);
+    machine_script(&board, &con, script, len);
+    if (mode == RUN_NATIVE) {
+        forthtrap_load(&traps, &board, FORTH_START);
+        if (find_cycles >= 0) {
+            forthtrap_cost(&traps, "find-name", find_cycles, 0, 0);
+            forthtrap_cost(&traps, "search-wordlist", find_cycles, 0, 0);
+        }
+    }
+    if (mode == RUN_MATHCOP) {
+        mathcop_init(&cop);
+        mathcop_attach(&board, &cop);
+        mathcop_patch(&board, FORTH_START);
+    }
+    if (mode == RUN_LINEIN) {
+        linein_init(&lines);
+        linein_forth(&board, &lines, FORTH_START);
+    }
+    machine_reset(&board);
+    hookexternal(machine_tick);
+
+    double t0 = now_seconds();
+    while (con.idle < IDLE_POLLS && clockticks6502 < MAX_CYCLES) {
+        exec6502(QUANTUM);
+    }
+    r.seconds = now_seconds() - t0;
+    r.cycles = clockticks6502;
+    r.instructions = instructions;
+    r.out = con.out;
+    r.out_len = con.out_len;
+    return r;
+}
+
+static bool compare_script(const char *name, const char *script, size_t len, enum run_mode mode,
+                           uint64_t *calls) {
+    run_t rom = run_script(script, len, RUN_ROM);
+    run_t nat = run_script(script, len, mode);
+    bool same = rom.out_len == nat.out_len && !memcmp(rom.out, nat.out, rom.out_len);
+
+    uint64_t n = 0;
+    if (mode == RUN_MATHCOP) {
+        for (int i = 0; i < MATHCOP_OPS; i++) {
+            calls[i] += cop.ops[i];
+            n += cop.ops[i];
+        }
+    } else if (mode == RUN_LINEIN) {
+        calls[0] += lines.lines;
+        calls[1] += lines.bytes;
+        n = lines.lines;
+    } else {
+        for (int i = 0; i < traps.count; i++) {
+            calls[i] += traps.calls[i];
+            n += traps.calls[i];
+        }
+    }
+    printf("%-16s %12u %12u %+7.2f%% %12llu %12llu %8.3f %8.3f %6.2fx %8llu  %s\n",
+           name, rom.cycles, nat.cycles, 100.0 * ((double)nat.cycles - rom.cycles) / rom.cycles,
+           (unsigned long long)rom.instructions, (unsigned long long)nat.instructions,
+           rom.seconds, nat.seconds, nat.seconds > 0 ? rom.seconds / nat.seconds : 0.0,
+           (unsigned long long)n, same ? "same" : "DIFFERENT");
+    free(rom.out);
+    free(nat.out);
+    return same;
+}
+
+/* Calibration ******************************************/
+
+static machine_t booted;
+static uint32_t seed = 0x6502;
+
+static uint32_t rnd() {
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    return seed;
+}
+
+// Arguments of one call: the cells on the data stack, top first, BASE and
+// the scratch memory the word works on
+typedef struct {
+    uint16_t cell[4];
+    int cells;
+    uint16_t base;
+    uint8_t scratch[SCRATCH_SIZE];
+} sample_t;
+
+static void sample_cells(sample_t *s, int cells, uint16_t c0, uint16_t c1, uint16_t c2, uint16_t c3) {
+    s->cells = cells;
+    s->cell[0] = c0;
+    s->cell[1] = c1;
+    s->cell[2] = c2;
+    s->cell[3] = c3;
+}
+
+// Random arguments for the word, with the edge cases it has to get right
+static void sample_make(sample_t *s, const char *word) {
+    static const uint16_t bases[] = { 2, 8, 10, 16, 36, 10 };
+    static const char chars[] = "0123456789abcdefxyzABCDEFXYZ:@[`{ ";
+    s->base = bases[rnd() % 6];
+    for (int i = 0; i < SCRATCH_SIZE; i++) s->scratch[i] = rnd();
+
+    uint16_t a1 = SCRATCH + 0x200 + rnd() % 0x800, a2 = a1 + rnd() % 600 - 300;
+    uint16_t u = rnd() % 8 ? rnd() % 600 : (rnd() % 3) * 256;
+    uint16_t r = rnd();
+    if (!strcmp(word, "um*")) {
+        sample_cells(s, 2, rnd() % 8 ? r : 0, rnd() % 8 ? rnd() : 0xFFFF, 0, 0);
+    } else if (!strcmp(word, "um/mod")) {
+        uint16_t d = r ? r : 1;
+        sample_cells(s, 3, d, rnd() % d, rnd(), 0);
+    } else if (!strcmp(word, "cmove") || !strcmp(word, "cmove>")) {
+        sample_cells(s, 3, u, a2, a1, 0);
+    } else if (!strcmp(word, "fill")) {
+        if (rnd() % 8 == 0) a1 = 0x8000 - rnd() % 64;
+        sample_cells(s, 3, r & 0xFF, u, a1, 0);
+    } else if (!strcmp(word, "compare")) {
+        uint16_t u1 = rnd() % 40, u2 = rnd() % 8 ? rnd() % 40 : u1;
+        memcpy(s->scratch + (a2 - SCRATCH), s->scratch + (a1 - SCRATCH), 40);
+        s->scratch[a2 - SCRATCH + rnd() % 48] ^= rnd() % 2 ? 1 : 0x80;
+        sample_cells(s, 4, u2, a2, u1, a1);
+    } else if (!strcmp(word, ">number")) {
+        for (int i = 0; i < 48; i++) {
+            s->scratch[a1 - SCRATCH + i] = rnd() % 4 ? chars[rnd() % 16] : chars[rnd() % (sizeof(chars) - 1)];
+        }
+        sample_cells(s, 4, rnd() % 16 ? rnd() % 48 : 0, a1, rnd() % 64, rnd());
+    } else if (!strcmp(word, "#")) {
+        sample_cells(s, 2, rnd() % 2 ? rnd() : 0, rnd(), 0, 0);
+    } else if (!strcmp(word, "find-name") || !strcmp(word, "search-wordlist")) {
+        static const char *names[] = { "dup", "DUP", "Swap", "find-name", "cmove>", "s\"", ":", "words",
+                                       "forth", "editor-wordlist", "l", "nosuchword", "1234", "xyzzy" };
+        const char *name = names[rnd() % (sizeof(names) / sizeof(names[0]))];
+        u = strlen(name);
+        memcpy(s->scratch + (a1 - SCRATCH), name, u);
+        if (rnd() % 16 == 0) u = 0;
+        if (word[0] == 'f') sample_cells(s, 2, u, a1, 0, 0);
+        else sample_cells(s, 3, rnd() % 4 ? 0 : rnd() % 4, u, a1, 0);
+    }
+}
+
+// Call the word at xt with the sample, on the ROM code or natively at no
+// cost. Returns the cycles from the stub to the return
+static uint32_t sample_call(const sample_t *s, uint16_t xt, bool native) {
+    machine_clear_points(&board);
+    board = booted;
+    if (native) {
+        forthtrap_load(&traps, &board, FORTH_START);
+        memset(traps.cycles, 0, sizeof(traps.cycles));
+        memset(traps.unit_cycles, 0, sizeof(traps.unit_cycles));
+        memset(traps.unit2_cycles, 0, sizeof(traps.unit2_cycles));
+    }
+    machine_reset(&board);
+    hookexternal(NULL);
+
+    uint8_t *mem = board.mem;
+    const uint8_t stub[] = { 0x20, xt & 0xFF, xt >> 8, 0x4C, (CALL_STUB + 3) & 0xFF, (CALL_STUB + 3) >> 8 };
+    memcpy(mem + CALL_STUB, stub, sizeof(stub));
+    memcpy(mem + SCRATCH, s->scratch, SCRATCH_SIZE);
+    if (traps.base) {
+        mem[traps.base] = s->base & 0xFF;
+        mem[traps.base + 1] = s->base >> 8;
+    }
+    if (traps.hold) {
+        mem[traps.hold] = HOLD_END & 0xFF;
+        mem[traps.hold + 1] = HOLD_END >> 8;
+    }
+    x = CALL_X - 2 * s->cells;
+    for (int i = 0; i < s->cells; i++) forthtrap_set(&board, i, s->cell[i]);
+    sp = 0xFF;
+    pc = CALL_STUB;
+
+    while (!trapped6502 && clockticks6502 < CALL_MAX_CYCLES) exec6502(QUANTUM);
+    return clockticks6502;
+}
+
+// What the two runs must agree on: the data stack from X up, BASE and
+// the hold pointer, and all memory from page 2 up. Zero page below X and
+// the return stack hold the scratch of the ROM code
+static bool sample_same(const machine_t *rom, uint8_t rom_x) {
+    if (x != rom_x) return false;
+    if (memcmp(rom->mem + x, board.mem + x, CALL_X - x)) return false;
+    if (traps.base && memcmp(rom->mem + traps.base, board.mem + traps.base, 2)) return false;
+    if (traps.hold && memcmp(rom->mem + traps.hold, board.mem + traps.hold, 2)) return false;
+    return !memcmp(rom->mem + 0x200, board.mem + 0x200, 0x10000 - 0x200);
+}
+
+static double det3(double a[3][3]) {
+    return a[0][0] * (a[1][1] * a[2][2] - a[1][2] * a[2][1]) -
+           a[0][1] * (a[1][0] * a[2][2] - a[1][2] * a[2][0]) +
+           a[0][2] * (a[1][0] * a[2][1] - a[1][1] * a[2][0]);
+}
+
+// Least squares cost = fit[0] + units * fit[1] + units2 * fit[2], from the
+// sums of the normal equations: sum[i][j] of column i times column j, with
+// the calls and both kinds of units as columns 0 to 2, and rhs[i] of column
+// i times the cost, each weighted by 1 / cost^2 so that it is the relative
+// error that is fitted. A word without one kind of units fits fewer terms
+static void fit3(double sum[3][3], const double rhs[3], double fit[3]) {
+    bool used[3] = { true, sum[1][1] > 0, sum[2][2] > 0 };
+    double a[3][3];
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) a[i][j] = used[i] && used[j] ? sum[i][j] : i == j;
+    }
+    double d = det3(a);
+    for (int k = 0; k < 3; k++) {
+        fit[k] = 0;
+        if (!used[k] || d == 0) continue;
+        double b[3][3];
+        memcpy(b, a, sizeof(b));
+        for (int i = 0; i < 3; i++) b[i][k] = used[i] ? rhs[i] : 0;
+        fit[k] = det3(b) / d;
+    }
+    if (d == 0 && sum[0][0] > 0) fit[0] = rhs[0] / sum[0][0];
+}
+
+static bool calibrate(int samples) {
+    static machine_t rom;
+    static sample_t s;
+    static int32_t units[MAX_SAMPLES], units2[MAX_SAMPLES];
+    static uint32_t costs[MAX_SAMPLES];
+    bool ok = true;
+
+    // A booted TaliForth, for the zero page it sets up
+    run_t boot = run_script("", 0, RUN_ROM);
+    free(boot.out);
+    machine_clear_points(&board);
+    booted = board;
+
+    forthtrap_load(&traps, &board, FORTH_START);
+    forthtrap_t found = traps;
+    machine_clear_points(&board);
+    printf("BASE at $%02X, hold pointer at $%02X, digits at $%04X\n\n",
+           found.base, found.hold, found.digits);
+    printf("%-15s %6s %6s %8s %8s %8s %9s %8s %8s %9s %9s %9s\n", "word", "entry", "calls", "declined",
+           "cycles", "per unit", "per unit2", "table", "per unit", "per unit2", "mean err", "max err");
+
+    for (int w = 0; w < found.count; w++) {
+        const char *name = found.word[w]->name;
+        double sum[3][3] = { { 0 } }, rhs[3] = { 0 }, fit[3];
+        int declined = 0, mismatches = 0;
+        for (int i = 0; i < samples; i++) {
+            sample_make(&s, name);
+            uint32_t rom_cycles = sample_call(&s, found.xt[w], false);
+            uint8_t rom_x = x;
+            rom = board;
+            rom.points = NULL;
+            uint32_t nat_cycles = sample_call(&s, found.xt[w], true);
+            if (!traps.calls[w]) {
+                declined++;
+                units[i] = -1;
+                continue;
+            }
+            if (!sample_same(&rom, rom_x)) {
+                units[i] = -1;
+                if (mismatches++ < 5) {
+                    printf("  %s differs for", name);
+                    for (int c = 0; c < s.cells; c++) printf(" %04X", s.cell[c]);
+                    printf(" base %u\n", s.base);
+                }
+                continue;
+            }
+            units[i] = traps.units;
+            units2[i] = traps.units2;
+            costs[i] = rom_cycles - nat_cycles;
+            double weight = 1.0 / ((double)costs[i] * costs[i]);
+            double col[3] = { 1, units[i], units2[i] };
+            for (int j = 0; j < 3; j++) {
+                for (int k = 0; k < 3; k++) sum[j][k] += weight * col[j] * col[k];
+                rhs[j] += weight * col[j] * costs[i];
+            }
+        }
+
+        fit3(sum, rhs, fit);
+        int n = 0;
+        uint16_t table = found.word[w]->cycles, table_unit = found.word[w]->unit_cycles;
+        uint16_t table_unit2 = found.word[w]->unit2_cycles;
+        double err = 0, max_err = 0;
+        for (int i = 0; i < samples; i++) {
+            if (units[i] < 0) continue;
+            n++;
+            double e = (double)table + (double)table_unit * units[i] + (double)table_unit2 * units2[i] - costs[i];
+            if (e < 0) e = -e;
+            err += e / costs[i];
+            if (e / costs[i] > max_err) max_err = e / costs[i];
+        }
+        printf("%-15s  $%04X %6d %8d %8.1f %8.2f %9.2f %8u %8u %9u %8.2f%% %8.2f%%%s\n", name,
+               found.entry[w], samples, declined, fit[0], fit[1], fit[2], table, table_unit, table_unit2,
+               n ? 100 * err / n : 0.0, 100 * max_err, mismatches ? "  MISMATCH" : "");
+        if (mismatches) ok = false;
+    }
+    return ok;
+}
+
+int main(int argc, char **argv) {
+    bool calibration = false;
+    enum run_mode mode = RUN_NATIVE;
+    int samples = DEFAULT_SAMPLES;
+    int argi = 1;
+
+    // unistd.h (and with it getopt) clashes with brk() in 6502.c
+    for (; argi < argc && argv[argi][0] == '-'; argi++) {
+        const char *opt = argv[argi];
+        if (!strcmp(opt, "-k")) {
+            calibration = true;
+            continue;
+        }
+        if (!strcmp(opt, "-c")) {
+            mode = RUN_MATHCOP;
+            continue;
+        }
+        if (!strcmp(opt, "-l")) {
+            mode = RUN_LINEIN;
+            continue;
+        }
+        if (argi + 1 == argc) usage();
+        if (!strcmp(opt, "-s")) samples = atoi(argv[++argi]);
+        else if (!strcmp(opt, "-f")) find_cycles = atoi(argv[++argi]);
+        else usage();
+    }
+    if (samples < 1 || samples > MAX_SAMPLES || find_cycles > 0xFFFF) usage();
+
+    if (calibration) return calibrate(samples) ? 0 : 1;
+
+    uint64_t calls[FORTHTRAP_MAX] = { 0 };
+    bool ok = true;
+    printf("%-16s %12s %12s %8s %12s %12s %8s %8s %7s %8s\n", "script", "rom cycles", "cycles",
+           "", "rom instr", "instr", "rom s", "s", "speed", "calls");
+    if (argi == argc) {
+        for (uint32_t i = 0; i < BUILTIN_SIZE; i++) {
+            ok &= compare_script(builtin[i].name, builtin[i].script, strlen(builtin[i].script), mode, calls);
+        }
+    }
+    for (; argi < argc; argi++) {
+        size_t len;
+        char *script = read_file(argv[argi], &len);
+        if (!script) {
+            fprintf(stderr, "cannot read %s\n", argv[argi]);
+            return 2;
+        }
+        ok &= compare_script(argv[argi], script, len, mode, calls);
+        free(script);
+    }
+
+    if (mode == RUN_MATHCOP) {
+        static const char *ops[MATHCOP_OPS] = { "udiv", "sdiv", "umul", "smul" };
+        printf("\ncoprocessor operations:");
+        for (int i = 0; i < MATHCOP_OPS; i++) printf(" %s %llu", ops[i], (unsigned long long)calls[i]);
+        printf("\n");
+        return ok ? 0 : 1;
+    }
+    if (mode == RUN_LINEIN) {
+        printf("\nlines %llu of %llu bytes\n", (unsigned long long)calls[0], (unsigned long long)calls[1]);
+        return ok ? 0 : 1;
+    }
+    printf("\nnative calls:");
+    for (int i = 0; i < traps.count; i++) printf(" %s %llu", traps.word[i]->name, (unsigned long long)calls[i]);
+    printf("\n");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,252 @@
+/* Fast loader ******************************************
+ * Writes memory images into a running emulator over    *
+ * its console with the fast load protocol of           *
+ * fastload.c (FAST_LOAD in 6502emu.c), then starts it  *
+ * again, instead of a rebuild and reflash.             *
+ *                                                      *
+ *   6502load [-q] [-g address] image[@address] ...     *
+ *            device                                    *
+ *   6502load [-q] [-g address] image[@address] ...     *
+ *            -- command [arg ...]                      *
+ *                                                      *
+ * Images go at $8000, where 6502emu has its ROM,       *
+ * unless an address in hex follows the name. Every     *
+ * frame is checked against the CRC of what the         *
+ * emulator then has in memory, and sent again when it  *
+ * does not match. The CPU is paused for the load and   *
+ * reset through its vector afterwards, or started at   *
+ * -g. The device is the USB serial port of the Pico;   *
+ * a command is run with its console on pipes, and once *
+ * it is loaded stdin goes to it. What it prints goes   *
+ * to stdout unless -q.                                 *
+ ********************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <poll.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#include "hostlink.c"
+#include "rxflow.c"
+#define FASTLOAD_PROTOCOL_ONLY
+#include "fastload.c"
+
+#define MAX_IMAGES 16
+#define DEFAULT_ADDRESS 0x8000
+// Nothing from the emulator for this long means a frame got lost
+#define ANSWER_TIMEOUT_MS 2000
+#define RETRIES 3
+
+typedef struct {
+    const char *path;
+    uint16_t address;
+} image_t;
+
+typedef struct {
+    int in, out;
+    pid_t child;
+    bool quiet;
+    bool stopped;      // XOFF came and no XON yet
+    fastload_t answer; // the decoder of answers
+} link_t;
+
+static void usage(void) {
+    fprintf(stderr, "usage: 6502load [-q] [-g address] image[@address] ... device\n"
+                    "       6502load [-q] [-g address] image[@address] ... -- command [arg ...]\n");
+    exit(2);
+}
+
+static void show(link_t *l, uint8_t c) {
+    if (!l->quiet) putchar(c);
+}
+
+// take in what the emulator sent, up to a whole answer: false once it has
+// closed
+static bool link_read(link_t *l) {
+    uint8_t c;
+    while (!atomic_load(&l->answer.ready)) {
+        struct pollfd pfd = { .fd = l->out, .events = POLLIN };
+        if (poll(&pfd, 1, 0) <= 0) return true;
+        if (read(l->out, &c, 1) != 1) return false;
+        if (c == RXFLOW_XOFF || c == RXFLOW_XON) {
+            l->stopped = c == RXFLOW_XOFF;
+            continue;
+        }
+        int taken = fastload_byte(&l->answer, c);
+        if (taken == FASTLOAD_PASS_SOH) show(l, FASTLOAD_SOH);
+        if (taken <= FASTLOAD_PASS_SOH) show(l, c);
+    }
+    return true;
+}
+
+// send a request and wait for its answer, again after a timeout or a bad
+// frame: the status, or -1 when the emulator does not answer
+static int request(link_t *l, uint8_t command, uint16_t address, const uint8_t *data, uint16_t len,
+                   uint16_t *value) {
+    static uint8_t body[FASTLOAD_HEADER + FASTLOAD_DATA], frame[FASTLOAD_FRAME];
+    body[0] = command;
+    body[1] = address & 0xFF;
+    body[2] = address >> 8;
+    body[3] = len & 0xFF;
+    body[4] = len >> 8;
+    if (data) memcpy(body + FASTLOAD_HEADER, data, len);
+    size_t n = fastload_encode(FASTLOAD_REQUEST, body, FASTLOAD_HEADER + (data ? len : 0), frame);
+
+    for (int tries = 0; tries <= RETRIES; tries++) {
+        size_t sent = 0;
+        while (sent < n) {
+            ssize_t w = write(l->in, frame + sent, n - sent);
+            if (w <= 0) return -1;
+            sent += w;
+        }
+        for (int waited = 0; waited < ANSWER_TIMEOUT_MS; waited += 10) {
+            struct pollfd pfd = { .fd = l->out, .events = POLLIN };
+            if (poll(&pfd, 1, 10) > 0) waited = 0;
+            if (!link_read(l)) return -1;
+            if (!atomic_load(&l->answer.ready)) continue;
+
+            fastload_t *a = &l->answer;
+            bool ours = !a->bad && a->len == 4 && a->body[0] == command;
+            uint8_t status = a->body[1];
+            *value = a->body[2] | (a->body[3] << 8);
+            fastload_done(a);
+            if (ours && status != FASTLOAD_BAD) return status;
+            break;
+        }
+        fprintf(stderr, "6502load: no good answer to %c at $%04X, sending it again\n", command, address);
+    }
+    return -1;
+}
+
+static bool load(link_t *l, const image_t *image, uint64_t *bytes) {
+    FILE *f = fopen(image->path, "rb");
+    static uint8_t data[FASTLOAD_DATA];
+    uint32_t address = image->address;
+    size_t len;
+
+    if (!f) {
+        fprintf(stderr, "cannot read %s\n", image->path);
+        return false;
+    }
+    while (address < 0x10000 && (len = fread(data, 1, FASTLOAD_DATA, f)) > 0) {
+        if (address + len > 0x10000) len = 0x10000 - address;
+        uint16_t crc, want = fastload_crc(data, len);
+        int status;
+        for (int tries = 0; (status = request(l, FASTLOAD_WRITE, address, data, len, &crc)) == FASTLOAD_OK &&
+                            crc != want && tries < RETRIES; tries++) {
+            fprintf(stderr, "6502load: CRC mismatch at $%04X, sending it again\n", address);
+        }
+        if (status != FASTLOAD_OK || crc != want) {
+            fprintf(stderr, "6502load: writing $%04X failed\n", address);
+            fclose(f);
+            return false;
+        }
+        address += len;
+        *bytes += len;
+    }
+    fclose(f);
+    return true;
+}
+
+// stdin to the emulator, what it prints to stdout, until both have ended
+static void forward(link_t *l) {
+    bool input = true;
+    uint8_t buf[RXFLOW_PACKET];
+    while (1) {
+        struct pollfd pfd[2] = { { .fd = l->out, .events = POLLIN },
+                                 { .fd = STDIN_FILENO, .events = POLLIN } };
+        if (poll(pfd, input && !l->stopped ? 2 : 1, 100) < 0) break;
+        if ((pfd[0].revents & (POLLIN | POLLHUP)) && !link_read(l)) break;
+        if (atomic_load(&l->answer.ready)) fastload_done(&l->answer);
+        if (input && !l->stopped && (pfd[1].revents & (POLLIN | POLLHUP))) {
+            ssize_t n = read(STDIN_FILENO, buf, sizeof(buf));
+            if (n <= 0 || write(l->in, buf, n) != n) {
+                input = false;
+                close(l->in);
+            }
+        }
+        fflush(stdout);
+    }
+}
+
+int main(int argc, char **argv) {
+    image_t images[MAX_IMAGES];
+    int count = 0;
+    long go = -1;
+    link_t l = { 0 };
+    int argi = 1;
+
+    // unistd.h is fine here, but the options are parsed as in the other tools
+    for (; argi < argc && argv[argi][0] == '-' && strcmp(argv[argi], "--"); argi++) {
+        if (!strcmp(argv[argi], "-q")) {
+            l.quiet = true;
+            continue;
+        }
+        if (argi + 1 == argc) usage();
+        if (!strcmp(argv[argi], "-g")) go = strtol(argv[++argi], NULL, 16);
+        else usage();
+    }
+    for (; argi < argc && strcmp(argv[argi], "--") && argc - argi > 1; argi++) {
+        if (count == MAX_IMAGES) usage();
+        char *at = strrchr(argv[argi], '@');
+        images[count].address = DEFAULT_ADDRESS;
+        if (at) {
+            *at = 0;
+            images[count].address = strtol(at + 1, NULL, 16);
+        }
+        images[count++].path = argv[argi];
+    }
+    if (!count || argi == argc || go > 0xFFFF) usage();
+
+    fastload_init(&l.answer, FASTLOAD_ANSWER);
+    if (!strcmp(argv[argi], "--")) {
+        if (++argi == argc) usage();
+        l.child = start_command(argv + argi, &l.in, &l.out);
+        if (l.child < 0) {
+            perror("6502load");
+            return 2;
+        }
+    } else {
+        l.in = l.out = open_device(argv[argi]);
+        if (l.in < 0) {
+            perror(argv[argi]);
+            return 2;
+        }
+    }
+    signal(SIGPIPE, SIG_IGN);
+
+    uint16_t value;
+    if (request(&l, FASTLOAD_PAUSE, 0, NULL, 0, &value) != FASTLOAD_OK) {
+        fprintf(stderr, "6502load: no answer, is FAST_LOAD on?\n");
+        return 1;
+    }
+    fprintf(stderr, "6502load: paused at $%04X\n", value);
+
+    uint64_t bytes = 0;
+    double t0 = now_seconds();
+    for (int i = 0; i < count; i++) {
+        if (!load(&l, &images[i], &bytes)) return 1;
+    }
+    double seconds = now_seconds() - t0;
+
+    int status = go >= 0 ? request(&l, FASTLOAD_GO, go, NULL, 0, &value)
+                         : request(&l, FASTLOAD_RESET, 0, NULL, 0, &value);
+    if (status != FASTLOAD_OK) {
+        fprintf(stderr, "6502load: could not start the CPU again\n");
+        return 1;
+    }
+    fprintf(stderr, "6502load: %llu bytes in %.3f s, %.0f bytes/s, running from $%04X\n",
+            (unsigned long long)bytes, seconds, seconds > 0 ? bytes / seconds : 0.0, value);
+
+    if (l.child > 0) {
+        forward(&l);
+        waitpid(l.child, NULL, 0);
+    }
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,441 @@
+/* Opcode microbenchmarks *******************************
+ * Loops every opcode on its own, millions of times,    *
+ * and reports the host cost per emulated instruction   *
+ * for each execution engine, so slow handlers in       *
+ * 6502.c stand out.                                    *
+ *                                                      *
+ *   6502micro [-n count] [-e engine] [-p]              *
+ *             [opcode ...]                             *
+ *                                                      *
+ * Each opcode runs from a block of copies of itself    *
+ * with harmless operands; each jump lands on the next  *
+ * copy, calls and returns loop on a single             *
+ * instruction. Opcodes with a page crossing penalty    *
+ * get a second row with X and Y at $FF, and ADC/SBC a  *
+ * second row in decimal mode. The engines are          *
+ * exec6502() and its loop on the separate              *
+ * addrtable/optable/ticktable that opdesc6502[] is     *
+ * built from (split), a switch with a case per opcode  *
+ * (switch) and threaded code with a computed goto per  *
+ * opcode (threaded). Costs are in nanoseconds and, on  *
+ * x86, time stamp counter ticks per instruction.       *
+ * With -p, host cycles, instructions, branch misses    *
+ * and L1D/LLC misses per instruction are added from    *
+ * the hardware counters, where the host has them.      *
+ ********************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HAVE_TSC 1
+#else
+#define HAVE_TSC 0
+#endif
+
+#define CHIPS_IMPL
+#include "6502.c"
+#include "6522.h"
+#include "machine.c"
+#include "hostperf.h"
+
+#define DEFAULT_COUNT 2000000
+#define QUANTUM 10000
+
+// Test program layout
+#define CODE_START 0x4000
+#define CODE_COPIES 4096
+#define OPERAND_ZP 0x10     // zero page operand and immediate value
+#define OPERAND_PTR 0x20    // zero page pointer for the indirect modes
+#define OPERAND_ABS 0x0380  // absolute operand and pointer target
+#define JUMP_TABLE 0x2000   // entry i points at copy i + 1 for JMP (ind) and JMP (abs,X)
+#define STACK_FILL 0x40     // every pull reads $40: RTI returns to $4040, RTS to $4041
+
+#define VARIANT_PAGE 0x01     // X = Y = $FF, indexed accesses cross a page
+#define VARIANT_DECIMAL 0x02  // decimal flag set
+
+typedef struct {
+    void (*fn)();
+    const char *name;
+    int operands;
+} micro_mode_t;
+
+#define MODE(fn, n) { fn, #fn, n }
+static const micro_mode_t modes[] = {
+    MODE(imp, 0), MODE(acc, 0), MODE(imm, 1), MODE(zp, 1), MODE(zpx, 1),
+    MODE(zpy, 1), MODE(rel, 1), MODE(rel2, 2), MODE(abso, 2), MODE(absx, 2),
+    MODE(absy, 2), MODE(ind, 2), MODE(aindx, 2), MODE(indx, 1), MODE(indy, 1),
+    MODE(indzp, 1),
+};
+#define MODE_COUNT (sizeof(modes) / sizeof(modes[0]))
+
+typedef struct {
+    void (*fn)();
+    const char *name;
+} handler_t;
+
+#define H(fn) { fn, #fn }
+static const handler_t handlers[] = {
+    H(adc), H(and), H(asl), H(bcc), H(bcs), H(beq), H(bit), H(bmi), H(bne), H(bpl),
+    H(brk), H(bvc), H(bvs), H(clc), H(cld), H(cli), H(clv), H(cmp), H(cpx), H(cpy),
+    H(dec), H(dex), H(dey), H(eor), H(inc), H(inx), H(iny), H(jmp), H(jsr), H(lda),
+    H(ldx), H(ldy), H(lsr), H(nop), H(ora), H(pha), H(php), H(pla), H(plp), H(rol),
+    H(ror), H(rti), H(rts), H(sbc), H(sec), H(sed), H(sei), H(sta), H(stx), H(sty),
+    H(tax), H(tay), H(tsx), H(txa), H(txs), H(tya),
+    H(bra), H(phx), H(plx), H(phy), H(ply), H(stz), H(tsb), H(trb),
+    H(rmb0), H(rmb1), H(rmb2), H(rmb3), H(rmb4), H(rmb5), H(rmb6), H(rmb7),
+    H(smb0), H(smb1), H(smb2), H(smb3), H(smb4), H(smb5), H(smb6), H(smb7),
+    H(bbr0), H(bbr1), H(bbr2), H(bbr3), H(bbr4), H(bbr5), H(bbr6), H(bbr7),
+    H(bbs0), H(bbs1), H(bbs2), H(bbs3), H(bbs4), H(bbs5), H(bbs6), H(bbs7),
+    H(hcall), H(wai), H(stp),
+};
+#define HANDLER_COUNT (sizeof(handlers) / sizeof(handlers[0]))
+
+#define MAX_ENGINES 4
+
+typedef struct {
+    const char *name;
+    void (*run)(uint8_t op, uint8_t variant, uint64_t count);
+} engine_t;
+
+typedef struct {
+    uint8_t op;
+    uint8_t variant;
+    double cycles_per_instr;  // emulated
+    double ns[MAX_ENGINES];   // per engine
+    double ticks[MAX_ENGINES];
+    hostperf_sample_t perf[MAX_ENGINES];
+    uint64_t done[MAX_ENGINES];  // emulated instructions
+} row_t;
+
+static machine_t board;
+static uint64_t count = DEFAULT_COUNT;
+static bool counters;
+
+static const micro_mode_t *mode_of(uint8_t op) {
+    for (size_t i = 0; i < MODE_COUNT; i++) {
+        if (modes[i].fn == addrtable[op]) return &modes[i];
+    }
+    return NULL;
+}
+
+static const char *handler_name(uint8_t op) {
+    for (size_t i = 0; i < HANDLER_COUNT; i++) {
+        if (handlers[i].fn == optable[op]) return handlers[i].name;
+    }
+    return "?";
+}
+
+static double now_ns() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static uint64_t host_ticks() {
+#if HAVE_TSC
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+// Load the loop for op into m and wire the CPU to it, ready to run
+static void micro_setup(machine_t *m, uint8_t op, uint8_t variant) {
+    const micro_mode_t *mode = mode_of(op);
+    uint16_t start = CODE_START;
+    uint16_t p = CODE_START;
+
+    machine_init(m, MACHINE_RAW);
+    memset(m->mem + 0x100, STACK_FILL, 0x100);
+    m->mem[OPERAND_PTR] = OPERAND_ABS & 0xFF;
+    m->mem[OPERAND_PTR + 1] = OPERAND_ABS >> 8;
+    m->mem[0xFFFE] = CODE_START & 0xFF;  // BRK lands back on itself
+    m->mem[0xFFFF] = CODE_START >> 8;
+
+    switch (op) {
+        case 0x00: // BRK
+            m->mem[p] = op;
+            break;
+        case 0x40: // RTI
+            start = (STACK_FILL << 8) | STACK_FILL;
+            m->mem[start] = op;
+            break;
+        case 0x60: // RTS
+            start = ((STACK_FILL << 8) | STACK_FILL) + 1;
+            m->mem[start] = op;
+            break;
+        case 0x20: // JSR abs
+            m->mem[p] = op;
+            m->mem[p + 1] = CODE_START & 0xFF;
+            m->mem[p + 2] = CODE_START >> 8;
+            break;
+        case 0x4C: // JMP abs
+        case 0x6C: // JMP (ind)
+        case 0x7C: // JMP (abs,X)
+            // a jump onto itself traps, so each copy jumps to the next and
+            // the last one back to the first
+            for (int i = 0; i < CODE_COPIES; i++) {
+                uint16_t next = i + 1 < CODE_COPIES ? p + 3 : CODE_START;
+                uint16_t entry = JUMP_TABLE + 2 * i;
+                m->mem[entry] = next & 0xFF;
+                m->mem[entry + 1] = next >> 8;
+                m->mem[p++] = op;
+                m->mem[p++] = (op == 0x4C ? next : entry) & 0xFF;
+                m->mem[p++] = (op == 0x4C ? next : entry) >> 8;
+            }
+            break;
+        default:
+            for (int i = 0; i < CODE_COPIES; i++) {
+                m->mem[p++] = op;
+                if (mode->fn == rel) {
+                    m->mem[p++] = 0;  // taken or not, the branch lands on the next copy
+                } else if (mode->fn == rel2) {
+                    m->mem[p++] = OPERAND_ZP;
+                    m->mem[p++] = 0;
+                } else if (mode->fn == indx || mode->fn == indy || mode->fn == indzp) {
+                    m->mem[p++] = OPERAND_PTR;
+                } else if (mode->operands == 1) {
+                    m->mem[p++] = OPERAND_ZP;
+                } else if (mode->operands == 2) {
+                    m->mem[p++] = OPERAND_ABS & 0xFF;
+                    m->mem[p++] = OPERAND_ABS >> 8;
+                }
+            }
+            m->mem[p++] = 0x4C;
+            m->mem[p++] = CODE_START & 0xFF;
+            m->mem[p++] = CODE_START >> 8;
+            break;
+    }
+
+    machine_reset(m);
+    hookexternal(NULL);
+    pc = start;
+    sp = 0xFF;
+    x = y = (variant & VARIANT_PAGE) ? 0xFF : 0;
+    status = FLAG_CONSTANT | ((variant & VARIANT_DECIMAL) ? FLAG_DECIMAL : 0);
+}
+
+static void run_table(uint8_t op, uint8_t variant, uint64_t n) {
+    micro_setup(&board, op, variant);
+    while (instructions < n) {
+        exec6502(QUANTUM);
+    }
+}
+
+// exec6502() dispatching through three tables instead of opdesc6502[]. the
+// loops have no points, so fetch6502() always gives an opcode here
+static void run_split(uint8_t op, uint8_t variant, uint64_t n) {
+    micro_setup(&board, op, variant);
+    while (instructions < n) {
+        opcode = (uint8_t)fetch6502(pc++);
+        penaltyop = 0;
+        penaltyaddr = 0;
+
+        (*addrtable[opcode])();
+        (*optable[opcode])();
+        clockticks6502 += ticktable[opcode];
+        if (penaltyop && penaltyaddr) clockticks6502++;
+
+        instructions++;
+    }
+}
+
+// one opcode with its table entries as constants, so the compiler makes
+// direct calls of them and may inline them
+#define MICRO_OP(o) \
+    addrtable[o](); \
+    optable[o](); \
+    clockticks6502 += ticktable[o]; \
+    if (penaltyop && penaltyaddr) clockticks6502++; \
+    instructions++;
+#define MICRO_ROW(h, X) \
+    X(h##0) X(h##1) X(h##2) X(h##3) X(h##4) X(h##5) X(h##6) X(h##7) \
+    X(h##8) X(h##9) X(h##A) X(h##B) X(h##C) X(h##D) X(h##E) X(h##F)
+#define MICRO_ALL(X) \
+    MICRO_ROW(0x0, X) MICRO_ROW(0x1, X) MICRO_ROW(0x2, X) MICRO_ROW(0x3, X) \
+    MICRO_ROW(0x4, X) MICRO_ROW(0x5, X) MICRO_ROW(0x6, X) MICRO_ROW(0x7, X) \
+    MICRO_ROW(0x8, X) MICRO_ROW(0x9, X) MICRO_ROW(0xA, X) MICRO_ROW(0xB, X) \
+    MICRO_ROW(0xC, X) MICRO_ROW(0xD, X) MICRO_ROW(0xE, X) MICRO_ROW(0xF, X)
+
+// a switch with a case per opcode: one indirect jump per instruction
+// instead of the two indirect calls of the tables
+#define SWITCH_CASE(o) case o: MICRO_OP(o) break;
+static void run_switch(uint8_t op, uint8_t variant, uint64_t n) {
+    micro_setup(&board, op, variant);
+    while (instructions < n) {
+        opcode = (uint8_t)fetch6502(pc++);
+        penaltyop = 0;
+        penaltyaddr = 0;
+
+        switch (opcode) {
+            MICRO_ALL(SWITCH_CASE)
+        }
+    }
+}
+
+// threaded code through computed gotos: every opcode ends in its own
+// indirect jump to the next, so the host predicts each one on its own
+#define THREADED_LABEL(o) &&op_##o,
+#define THREADED_OP(o) op_##o: MICRO_OP(o) THREADED_NEXT
+#define THREADED_NEXT \
+    if (instructions >= n) return; \
+    opcode = (uint8_t)fetch6502(pc++); \
+    penaltyop = 0; \
+    penaltyaddr = 0; \
+    goto *labels[opcode];
+static void run_threaded(uint8_t op, uint8_t variant, uint64_t n) {
+    static void *const labels[256] = { MICRO_ALL(THREADED_LABEL) };
+
+    micro_setup(&board, op, variant);
+    THREADED_NEXT
+    MICRO_ALL(THREADED_OP)
+}
+
+static const engine_t engines[] = {
+    { "table", run_table },
+    { "split", run_split },
+    { "switch", run_switch },
+    { "threaded", run_threaded },
+};
+#define ENGINE_COUNT (sizeof(engines) / sizeof(engines[0]))
+
+// Run op on engine e and fill in its cost per instruction
+static void measure(row_t *row, int e) {
+    hostperf_start();
+    double t0 = now_ns();
+    uint64_t k0 = host_ticks();
+    engines[e].run(row->op, row->variant, count);
+    uint64_t k1 = host_ticks();
+    double t1 = now_ns();
+    hostperf_stop(&row->perf[e]);
+
+    row->done[e] = instructions;
+    row->ns[e] = (t1 - t0) / instructions;
+    row->ticks[e] = (double)(k1 - k0) / instructions;
+    if (e == 0) row->cycles_per_instr = (double)clockticks6502 / instructions;
+}
+
+static void print_counters(const row_t *row, int e) {
+    for (int i = 0; i < HOSTPERF_COUNTERS; i++) {
+        if (row->perf[e].valid[i]) {
+            printf(" %7.2f", (double)row->perf[e].value[i] / row->done[e]);
+        } else {
+            printf("       -");
+        }
+    }
+}
+
+static const char *variant_name(uint8_t variant) {
+    if (variant & VARIANT_PAGE) return "page";
+    if (variant & VARIANT_DECIMAL) return "decimal";
+    return "";
+}
+
+static void usage() {
+    fprintf(stderr, "usage: 6502micro [-n count] [-e engine] [-p] [opcode ...]\n");
+    exit(2);
+}
+
+int main(int argc, char **argv) {
+    bool engine_on[ENGINE_COUNT];
+    bool op_on[256];
+    int argi = 1;
+
+    for (size_t e = 0; e < ENGINE_COUNT; e++) engine_on[e] = true;
+
+    // unistd.h (and with it getopt) clashes with brk() in 6502.c
+    for (; argi < argc && argv[argi][0] == '-'; argi++) {
+        const char *opt = argv[argi];
+        if (!strcmp(opt, "-p")) {
+            counters = true;
+            continue;
+        }
+        if (argi + 1 == argc) usage();
+        if (!strcmp(opt, "-n")) {
+            count = strtoull(argv[++argi], NULL, 0);
+        } else if (!strcmp(opt, "-e")) {
+            const char *name = argv[++argi];
+            size_t e = 0;
+            while (e < ENGINE_COUNT && strcmp(engines[e].name, name)) e++;
+            if (e == ENGINE_COUNT) usage();
+            for (size_t i = 0; i < ENGINE_COUNT; i++) engine_on[i] = i == e;
+        } else {
+            usage();
+        }
+    }
+    if (count < 1) usage();
+    for (int op = 0; op < 256; op++) op_on[op] = argi == argc;
+    for (; argi < argc; argi++) {
+        op_on[strtoul(argv[argi], NULL, 16) & 0xFF] = true;
+    }
+
+    if (counters && hostperf_open() == 0) {
+        fprintf(stderr, "no hardware performance counters on this host, running without them\n");
+        counters = false;
+    }
+
+    static row_t rows[512];
+    int row_count = 0;
+    for (int op = 0; op < 256; op++) {
+        if (!op_on[op]) continue;
+        const micro_mode_t *mode = mode_of(op);
+        rows[row_count++] = (row_t){ .op = op };
+        if (mode->fn == absx || mode->fn == absy || mode->fn == indy) {
+            rows[row_count++] = (row_t){ .op = op, .variant = VARIANT_PAGE };
+        }
+        if (optable[op] == adc || optable[op] == sbc) {
+            rows[row_count++] = (row_t){ .op = op, .variant = VARIANT_DECIMAL };
+        }
+    }
+
+    printf("op  handler mode   variant  cycles");
+    for (size_t e = 0; e < ENGINE_COUNT; e++) {
+        if (!engine_on[e]) continue;
+        printf(" %9s ns%s", engines[e].name, HAVE_TSC ? "     tsc" : "");
+        if (counters) printf("  cycles   instr  brmiss l1dmiss llcmiss");
+    }
+    printf("\n");
+
+    for (int r = 0; r < row_count; r++) {
+        row_t *row = &rows[r];
+        // the emulated cycle count always comes from the table engine
+        measure(row, 0);
+        printf("%02X  %-7s %-6s %-8s %6.2f", row->op, handler_name(row->op),
+               mode_of(row->op)->name, variant_name(row->variant), row->cycles_per_instr);
+        for (size_t e = 0; e < ENGINE_COUNT; e++) {
+            if (!engine_on[e]) continue;
+            if (e > 0) measure(row, e);
+            printf(" %12.2f", row->ns[e]);
+            if (HAVE_TSC) printf(" %7.1f", row->ticks[e]);
+            if (counters) print_counters(row, e);
+        }
+        printf("\n");
+        fflush(stdout);
+    }
+
+    // average per addressing mode, plain rows only
+    printf("\nmode   opcodes");
+    for (size_t e = 0; e < ENGINE_COUNT; e++) {
+        if (engine_on[e]) printf(" %9s ns", engines[e].name);
+    }
+    printf("\n");
+    for (size_t i = 0; i < MODE_COUNT; i++) {
+        double sum[ENGINE_COUNT] = { 0 };
+        int n = 0;
+        for (int r = 0; r < row_count; r++) {
+            if (rows[r].variant || mode_of(rows[r].op) != &modes[i]) continue;
+            for (size_t e = 0; e < ENGINE_COUNT; e++) sum[e] += rows[r].ns[e];
+            n++;
+        }
+        if (!n) continue;
+        printf("%-6s %7d", modes[i].name, n);
+        for (size_t e = 0; e < ENGINE_COUNT; e++) {
+            if (engine_on[e]) printf(" %12.2f", sum[e] / n);
+        }
+        printf("\n");
+    }
+    return 0;
+}
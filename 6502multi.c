@@ -0,0 +1,126 @@
+/* Multiplexed machines *********************************
+ * Runs one TaliForth machine per script on a single    *
+ * host thread, time-sliced by sched.c.                 *
+ *                                                      *
+ *   6502multi [-q quantum] script.fs ...               *
+ *                                                      *
+ * Console output of machine n is printed line by line  *
+ * with an "n: " prefix. Per-machine                    *
+ * utilisation and latency are reported at the end.     *
+ ********************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define CHIPS_IMPL
+#include "6502.c"
+#include "6522.h"
+#include "machine.c"
+#include "sched.c"
+
+#include "forth.h"
+
+#define FORTH_START 0x8000
+#define FORTH_SIZE 0x8000
+
+#define DEFAULT_QUANTUM 1000
+// Empty console reads after the end of the script before a machine is stopped
+#define IDLE_POLLS 1000
+
+typedef struct {
+    script_console_t script; // first, so script_getc() can use the channel
+    int number;
+    char line[256];
+    size_t line_len;
+} channel_t;
+
+static uint64_t now_us() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static void channel_flush(channel_t *c) {
+    if (c->line_len) {
+        printf("%d: %.*s\n", c->number, (int)c->line_len, c->line);
+        c->line_len = 0;
+    }
+}
+
+static void channel_putc(machine_t *m, uint8_t ch) {
+    channel_t *c = m->user;
+    if (ch == '\n' || c->line_len == sizeof(c->line)) {
+        channel_flush(c);
+    }
+    if (ch != '\n') c->line[c->line_len++] = ch;
+}
+
+static char *read_file(const char *path, size_t *len) {
+    FILE *f = fopen(path, "rb");
+    if (!f) return NULL;
+
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    char *data = malloc(size + 1);
+    *len = fread(data, 1, size, f);
+    data[*len] = 0;
+    fclose(f);
+    return data;
+}
+
+int main(int argc, char **argv) {
+    uint32_t quantum = DEFAULT_QUANTUM;
+    int argi = 1;
+
+    if (argi + 1 < argc && !strcmp(argv[argi], "-q")) {
+        quantum = strtoul(argv[argi + 1], NULL, 0);
+        argi += 2;
+    }
+    int count = argc - argi;
+    if (count < 1 || count > SCHED_MAX_MACHINES || quantum == 0) {
+        fprintf(stderr, "usage: 6502multi [-q quantum] script.fs ... (at most %d)\n", SCHED_MAX_MACHINES);
+        return 2;
+    }
+
+    sched_t sched;
+    machine_t *machines = malloc(count * sizeof(machine_t));
+    channel_t *channels = calloc(count, sizeof(channel_t));
+
+    sched_init(&sched, quantum, now_us);
+    for (int n = 0; n < count; n++) {
+        size_t len;
+        char *script = read_file(argv[argi + n], &len);
+        if (!script) {
+            fprintf(stderr, "cannot read %s\n", argv[argi + n]);
+            return 2;
+        }
+
+        machine_t *m = &machines[n];
+        machine_init(m, 0);
+        machine_load(m, FORTH_START, taliforth_pico_bin, FORTH_SIZE);
+        machine_script(m, &channels[n].script, script, len);
+        m->putc = channel_putc;
+        m->user = &channels[n];
+        channels[n].number = n;
+        machine_reset(m);
+        hookexternal(machine_tick);
+        sched_add(&sched);
+    }
+
+    int n;
+    while ((n = sched_slice(&sched)) >= 0) {
+        if (channels[n].script.idle >= IDLE_POLLS) {
+            sched_stop(&sched, n);
+        }
+    }
+
+    for (n = 0; n < count; n++) {
+        channel_flush(&channels[n]);
+    }
+    printf("\n");
+    sched_print_stats(&sched);
+    return 0;
+}
@@ -0,0 +1,19 @@
+/* NMOS 6502 core ***************************************
+ * 6502.c built a second time for the original NMOS     *
+ * 6502: no 65C02 instructions, the undocumented        *
+ * opcodes, BRK leaving D alone and the JMP ($xxFF)     *
+ * page wrap. Compile it as its own source file next to *
+ * one that includes 6502.c, with the same M6502_TLS:   *
+ * it runs on that file's registers through             *
+ * exec6502_nmos() and step6502_nmos(), and             *
+ * 6502variants.c picks between the two at run time.    *
+ ********************************************************/
+
+#define M6502_NMOS
+#define M6502_CORE_ONLY
+#define UNDOCUMENTED
+
+#define exec6502 exec6502_nmos
+#define step6502 step6502_nmos
+
+#include "6502.c"
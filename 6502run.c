@@ -0,0 +1,208 @@
+/* Headless runner **************************************
+ * Loads a test image into a machine that is RAM only   *
+ * and runs it until it traps on a branch or jump to    *
+ * itself, which the core detects without any hook, or  *
+ * executes STP.                                        *
+ *                                                      *
+ *   6502run [-m variant] [-a address] [-s start]       *
+ *           [-p success] [-c maxcycles] [-r repeat]    *
+ *           [-b address] [-l address] [-w address]     *
+ *           [-h] [-q] [image]                          *
+ *                                                      *
+ * -m picks the CPU, 65c02 (default) or nmos. Without   *
+ * an image it runs that CPU's built-in suite: Klaus'   *
+ * 65C02 test, or the NMOS functional test that         *
+ * 6502_test.py generates. The image is loaded at -a    *
+ * (default 0) and started at -s, or through the reset  *
+ * vector. A trap at the -p address is a pass; without  *
+ * -p any trap is. -b, -l and -w set a breakpoint, read *
+ * watchpoint or write watchpoint (hex, repeatable);    *
+ * every hit is printed and the run goes on. -h turns   *
+ * on the host calls of hostcall.c ($42 and a service   *
+ * byte). -c is a soft limit: the instruction that      *
+ * reaches it still completes, so a run can end a few   *
+ * cycles past it. Exit codes: 0 pass, 1 trapped        *
+ * elsewhere, 2 bad arguments, 3 cycle limit reached.   *
+ ********************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define CHIPS_IMPL
+#include "6502.c"
+#include "6522.h"
+#include "machine.c"
+#include "6502variants.c"
+#include "hostcall.c"
+
+#include "65C02_test.h"
+#include "6502_test.h"
+
+#define KLAUS_START_PC 0x400
+#define KLAUS_SUCCESS_PC 0x24F1
+
+// 6502_test.h is written by 6502_test.py; a failed check traps at
+// NMOS_FAIL_PC with the vector it was on at ($00)
+#define NMOS_START_PC 0x0400
+#define NMOS_SUCCESS_PC 0x04AB
+#define NMOS_FAIL_PC 0x04A8
+
+#define QUANTUM 1000000
+#define MAX_POINTS 64
+#define DEFAULT_MAX_CYCLES 2000000000u
+
+enum run_result { RUN_PASS, RUN_FAIL, RUN_USAGE, RUN_TIMEOUT };
+
+static machine_t board;
+static hostcall_t host_calls;
+
+typedef struct {
+    uint8_t kind;
+    uint16_t address;
+} point_t;
+
+static void report_hit() {
+    const char *kind = board.hit == MACHINE_PAGE_BREAK ? "break" :
+                       board.hit == MACHINE_PAGE_RWATCH ? "read" : "write";
+    printf("%-7s %04X pc %04X a %02X x %02X y %02X sp %02X p %02X cycles %u\n",
+           kind, board.hit_address, pc, a, x, y, sp, status, clockticks6502);
+}
+
+static double now_seconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static uint8_t *read_file(const char *path, uint32_t *len) {
+    FILE *f = fopen(path, "rb");
+    if (!f) return NULL;
+
+    uint8_t *data = malloc(0x10000);
+    *len = fread(data, 1, 0x10000, f);
+    fclose(f);
+    return data;
+}
+
+static void usage() {
+    fprintf(stderr, "usage: 6502run [-m 65c02|nmos] [-a address] [-s start] [-p success] [-c maxcycles] [-r repeat]\n"
+                    "               [-b address] [-l address] [-w address] [-h] [-q] [image]\n"
+                    "-c is a soft limit: the instruction that reaches it still completes\n");
+    exit(RUN_USAGE);
+}
+
+int main(int argc, char **argv) {
+    const variant6502_t *cpu = &variants6502[0];
+    uint32_t load = 0;
+    long start = -1, success = -1;
+    uint32_t max_cycles = DEFAULT_MAX_CYCLES;
+    int repeat = 1;
+    int quiet = 0;
+    bool hostcalls = false;
+    point_t points[MAX_POINTS];
+    int point_count = 0;
+    int argi = 1;
+
+    // unistd.h (and with it getopt) clashes with brk() in 6502.c
+    for (; argi < argc && argv[argi][0] == '-'; argi++) {
+        const char *opt = argv[argi];
+        if (!strcmp(opt, "-q")) {
+            quiet = 1;
+            continue;
+        }
+        if (!strcmp(opt, "-h")) {
+            hostcalls = true;
+            continue;
+        }
+        if (argi + 1 == argc) usage();
+        if (!strcmp(opt, "-m")) {
+            cpu = variant6502(argv[++argi]);
+            if (!cpu) usage();
+        }
+        else if (!strcmp(opt, "-a")) load = strtoul(argv[++argi], NULL, 16);
+        else if (!strcmp(opt, "-s")) start = strtol(argv[++argi], NULL, 16);
+        else if (!strcmp(opt, "-p")) success = strtol(argv[++argi], NULL, 16);
+        else if (!strcmp(opt, "-c")) max_cycles = strtoul(argv[++argi], NULL, 0);
+        else if (!strcmp(opt, "-r")) repeat = atoi(argv[++argi]);
+        else if (strlen(opt) == 2 && strchr("blw", opt[1]) && point_count < MAX_POINTS) {
+            uint8_t kind = opt[1] == 'b' ? MACHINE_PAGE_BREAK :
+                           opt[1] == 'l' ? MACHINE_PAGE_RWATCH : MACHINE_PAGE_WWATCH;
+            points[point_count++] = (point_t){ kind, strtoul(argv[++argi], NULL, 16) };
+        }
+        else usage();
+    }
+    if (argc - argi > 1 || load > 0xFFFF || start > 0xFFFF || success > 0xFFFF || repeat < 1) usage();
+
+    const uint8_t *image = __65C02_extended_opcodes_test_bin;
+    uint32_t size = 0x10000;
+    if (argi < argc) {
+        image = read_file(argv[argi], &size);
+        if (!image) {
+            fprintf(stderr, "cannot read %s\n", argv[argi]);
+            return RUN_USAGE;
+        }
+    } else if (!strcmp(cpu->name, "nmos")) {
+        image = __6502_functional_test_bin;
+        if (start < 0) start = NMOS_START_PC;
+        if (success < 0) success = NMOS_SUCCESS_PC;
+    } else {
+        if (start < 0) start = KLAUS_START_PC;
+        if (success < 0) success = KLAUS_SUCCESS_PC;
+    }
+
+    enum run_result result = RUN_PASS;
+    uint64_t total_cycles = 0, total_instructions = 0;
+    double total_seconds = 0;
+
+    for (int r = 0; r < repeat; r++) {
+        machine_clear_points(&board);
+        machine_init(&board, MACHINE_RAW);
+        machine_load(&board, load, image, size);
+        for (int i = 0; i < point_count; i++) {
+            machine_point(&board, points[i].kind, points[i].address, true);
+        }
+        machine_reset(&board);
+        hookexternal(NULL);
+        if (hostcalls) {
+            hostcall_init(&host_calls);
+            hostcall_enable(&board, &host_calls);
+        }
+        if (start >= 0) pc = start;
+
+        double t0 = now_seconds();
+        while (!trapped6502 && clockticks6502 < max_cycles) {
+            uint32_t left = max_cycles - clockticks6502;
+            uint8_t reason = cpu->exec(left < QUANTUM ? left : QUANTUM);
+            if (reason == STOP6502_BREAK || reason == STOP6502_WATCH) report_hit();
+            if (reason == STOP6502_STP) break;
+        }
+        double seconds = now_seconds() - t0;
+
+        enum run_result run;
+        if (!trapped6502 && stop6502 != STOP6502_STP) run = RUN_TIMEOUT;
+        else if (success >= 0 && pc != success) run = RUN_FAIL;
+        else run = RUN_PASS;
+        if (run != RUN_PASS) result = run;
+
+        total_cycles += clockticks6502;
+        total_instructions += instructions;
+        total_seconds += seconds;
+
+        if (!quiet || run != RUN_PASS) {
+            static const char *names[] = { "pass", "FAIL", "", "TIMEOUT" };
+            printf("%-7s pc %04X a %02X x %02X y %02X sp %02X p %02X cycles %u instr %llu %.3f s %.2f MHz\n",
+                   names[run], pc, a, x, y, sp, status, clockticks6502,
+                   (unsigned long long)instructions, seconds,
+                   seconds > 0 ? clockticks6502 / seconds / 1e6 : 0.0);
+        }
+    }
+
+    if (repeat > 1) {
+        printf("%d runs, %llu cycles, %llu instructions in %.3f s, %.2f MHz, %.2f M instructions/s\n",
+               repeat, (unsigned long long)total_cycles, (unsigned long long)total_instructions,
+               total_seconds, total_cycles / total_seconds / 1e6, total_instructions / total_seconds / 1e6);
+    }
+    return result;
+}
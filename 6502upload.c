@@ -0,0 +1,181 @@
+/* Console uploader *************************************
+ * Streams a file into the console of 6502emu as fast   *
+ * as it takes it in, paced by the XON/XOFF of its      *
+ * receive buffer (rxflow.c, CONSOLE_FLOW), and checks  *
+ * that every byte arrived.                             *
+ *                                                      *
+ *   6502upload [-q] file device                        *
+ *   6502upload [-q] file -- command [arg ...]          *
+ *                                                      *
+ * The device is the USB serial port of the Pico, the   *
+ * command an emulator to run with its console on a     *
+ * pipe, such as 6502emu_host. What it prints goes to   *
+ * stdout, without the flow control, unless -q. An ENQ  *
+ * before and after the file has the receive buffer     *
+ * count what came in, which must be all of it. Prints  *
+ * the rate to stderr; exit code 0 when nothing was     *
+ * dropped.                                             *
+ ********************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <poll.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#include "hostlink.c"
+#include "rxflow.c"
+
+// Nothing from the emulator for this long ends a wait for an ENQ answer
+#define ANSWER_TIMEOUT_MS 10000
+#define POLL_MS 100
+
+typedef struct {
+    int in, out;        // to and from the emulator
+    pid_t child;        // 0 for a device
+    bool quiet;
+    bool stopped;       // XOFF came and no XON yet
+    bool answering;     // inside ACK ... ACK
+    uint32_t answer;
+    bool answered;
+    uint64_t stops;
+} link_t;
+
+static void usage(void) {
+    fprintf(stderr, "usage: 6502upload [-q] file device\n"
+                    "       6502upload [-q] file -- command [arg ...]\n");
+    exit(2);
+}
+
+// take in what the emulator printed: false once it has closed
+static bool link_read(link_t *l) {
+    uint8_t buf[4096], shown[4096];
+    ssize_t n = read(l->out, buf, sizeof(buf));
+    size_t len = 0;
+    if (n <= 0) return false;
+
+    for (ssize_t i = 0; i < n; i++) {
+        uint8_t c = buf[i];
+        if (c == RXFLOW_XOFF) {
+            l->stopped = true;
+            l->stops++;
+        } else if (c == RXFLOW_XON) {
+            l->stopped = false;
+        } else if (c == RXFLOW_ACK) {
+            if (l->answering) l->answered = true;
+            else l->answer = 0;
+            l->answering = !l->answering;
+        } else if (l->answering && c >= '0' && c <= '9') {
+            l->answer = l->answer * 10 + c - '0';
+        } else {
+            shown[len++] = c;
+        }
+    }
+    if (!l->quiet && len) fwrite(shown, 1, len, stdout);
+    return true;
+}
+
+// wait for the emulator to print something or, when writing, to take
+// more: 1 when it printed, 0 when not, -1 once it has closed
+static int link_wait(link_t *l, bool writing, int timeout_ms) {
+    struct pollfd pfd[2] = { { .fd = l->out, .events = POLLIN },
+                             { .fd = l->in, .events = POLLOUT } };
+    if (poll(pfd, writing && !l->stopped ? 2 : 1, timeout_ms) < 0) return -1;
+    if (!(pfd[0].revents & (POLLIN | POLLHUP))) return 0;
+    return link_read(l) ? 1 : -1;
+}
+
+// send ENQ and wait for the count of bytes since the last one; -1 on a
+// timeout
+static long link_enquire(link_t *l) {
+    uint8_t enq = RXFLOW_ENQ;
+    l->answered = false;
+    if (write(l->in, &enq, 1) != 1) return -1;
+    for (int waited = 0; !l->answered && waited < ANSWER_TIMEOUT_MS; waited += POLL_MS) {
+        int printed = link_wait(l, false, POLL_MS);
+        if (printed < 0) return -1;
+        if (printed) waited = 0;
+    }
+    return l->answered ? (long)l->answer : -1;
+}
+
+int main(int argc, char **argv) {
+    link_t l = { 0 };
+    int argi = 1;
+
+    if (argi < argc && !strcmp(argv[argi], "-q")) {
+        l.quiet = true;
+        argi++;
+    }
+    if (argc - argi < 2) usage();
+    const char *path = argv[argi++];
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        fprintf(stderr, "cannot read %s\n", path);
+        return 2;
+    }
+    if (!strcmp(argv[argi], "--")) {
+        if (++argi == argc) usage();
+        l.child = start_command(argv + argi, &l.in, &l.out);
+        if (l.child < 0) {
+            perror("6502upload");
+            return 2;
+        }
+    } else {
+        l.in = l.out = open_device(argv[argi]);
+        if (l.in < 0) {
+            perror(argv[argi]);
+            return 2;
+        }
+    }
+    signal(SIGPIPE, SIG_IGN);
+
+    // count from here
+    if (link_enquire(&l) < 0) {
+        fprintf(stderr, "6502upload: no answer to ENQ, is CONSOLE_FLOW on?\n");
+        return 1;
+    }
+
+    uint8_t packet[RXFLOW_PACKET];
+    size_t len = 0, pos = 0;
+    uint64_t sent = 0;
+    double t0 = now_seconds();
+    while (1) {
+        if (pos == len) {
+            len = fread(packet, 1, sizeof(packet), f);
+            pos = 0;
+            if (!len) break;
+        }
+        if (link_wait(&l, true, POLL_MS) < 0) break;
+        if (l.stopped) continue;
+        struct pollfd pfd = { .fd = l.in, .events = POLLOUT };
+        if (poll(&pfd, 1, 0) <= 0) continue;
+        ssize_t n = write(l.in, packet + pos, len - pos);
+        if (n <= 0) break;
+        pos += n;
+        sent += n;
+    }
+    long received = link_enquire(&l);
+    double seconds = now_seconds() - t0;
+    fclose(f);
+
+    long dropped = received < 0 ? -1 : (long)sent - received;
+    fprintf(stderr, "\n6502upload: %llu bytes in %.3f s, %.0f bytes/s, %llu XOFF, ",
+            (unsigned long long)sent, seconds, seconds > 0 ? sent / seconds : 0.0,
+            (unsigned long long)l.stops);
+    if (received < 0) fprintf(stderr, "no count from the receiver\n");
+    else fprintf(stderr, "%ld received, %ld dropped\n", received, dropped);
+
+    // let the emulator finish what it was given
+    if (l.child > 0) {
+        close(l.in);
+        while (link_wait(&l, false, -1) >= 0) {}
+        waitpid(l.child, NULL, 0);
+    }
+    fflush(stdout);
+    return dropped == 0 ? 0 : 1;
+}
@@ -0,0 +1,35 @@
+/* CPU variants *****************************************
+ * The cores built into one program, selected by name   *
+ * at run time: the 65C02 of 6502.c and the NMOS 6502   *
+ * of 6502nmos.c, which must be linked in. Both run on  *
+ * the same registers, so machine_reset() and the rest  *
+ * work unchanged; a variant costs one indirect call    *
+ * per exec6502() or step6502() and nothing per         *
+ * instruction. Include after 6502.c.                   *
+ ********************************************************/
+
+#include <string.h>
+
+uint8_t exec6502_nmos(uint32_t tickcount);
+void step6502_nmos();
+
+typedef struct {
+    const char *name;
+    uint8_t (*exec)(uint32_t tickcount);
+    void (*step)();
+} variant6502_t;
+
+static const variant6502_t variants6502[] = {
+    { "65c02", exec6502, step6502 },
+    { "nmos", exec6502_nmos, step6502_nmos },
+};
+
+#define VARIANTS6502 (sizeof(variants6502) / sizeof(variants6502[0]))
+
+//returns the variant called name, or NULL if there is none
+const variant6502_t *variant6502(const char *name) {
+    for (uint32_t i = 0; i < VARIANTS6502; i++) {
+        if (!strcmp(variants6502[i].name, name)) return &variants6502[i];
+    }
+    return NULL;
+}
@@ -0,0 +1,114 @@
+/* DMA device *******************************************
+ * Block copy, fill and compare on the memory of the    *
+ * machine, for firmware that moves screen buffers and  *
+ * frames around. Writing the mode register runs the    *
+ * whole transfer natively. The cycles it would keep    *
+ * the bus busy are stolen from the CPU, added to       *
+ * clockticks6502, unless the turbo bit is set.         *
+ * Include after machine.c.                             *
+ *                                                      *
+ * Registers, from the window base:                     *
+ *   +0  source   low, high byte (compare: first)       *
+ *   +2  dest     low, high byte (compare: second)      *
+ *   +4  length   low, high byte, 0 does nothing        *
+ *   +6  mode     write: start the operation in bits    *
+ *                0-1, 0 copy (overlaps as memmove),    *
+ *                1 fill, 2 compare; bit 7 turbo        *
+ *   +7  fill     the byte that fill stores             *
+ *   +8  result   compare: 0 equal, 1 first greater,    *
+ *                $FF first smaller                     *
+ *   +9  offset   compare: low, high byte of the first  *
+ *                difference, the length when none      *
+ ********************************************************/
+
+#include <stdint.h>
+#include <string.h>
+
+#define DMA_SLOT 1 //device window at $F0B0
+
+#define DMA_SOURCE 0x0
+#define DMA_DEST   0x2
+#define DMA_LENGTH 0x4
+#define DMA_MODE   0x6
+#define DMA_FILL   0x7
+#define DMA_RESULT 0x8
+#define DMA_OFFSET 0x9
+
+#define DMA_OP_COPY    0
+#define DMA_OP_FILL    1
+#define DMA_OP_COMPARE 2
+#define DMA_OP_MASK    0x03
+#define DMA_TURBO      0x80
+
+//bus cycles per byte: a read and a write to copy, a write to fill, two
+//reads to compare
+#define DMA_COPY_CYCLES    2
+#define DMA_FILL_CYCLES    1
+#define DMA_COMPARE_CYCLES 2
+
+typedef struct {
+    uint8_t reg[16];
+    uint64_t transfers;
+    uint64_t stolen; //cycles taken from the CPU
+} dma_t;
+
+void dma_init(dma_t *d) {
+    memset(d, 0, sizeof(*d));
+}
+
+static uint16_t dma_reg16(const dma_t *d, uint8_t reg) {
+    return d->reg[reg] | (d->reg[reg + 1] << 8);
+}
+
+static void dma_run(machine_t *m, dma_t *d) {
+    uint16_t source = dma_reg16(d, DMA_SOURCE), dest = dma_reg16(d, DMA_DEST);
+    uint16_t length = dma_reg16(d, DMA_LENGTH);
+    uint32_t cycles = 0;
+
+    switch (d->reg[DMA_MODE] & DMA_OP_MASK) {
+        case DMA_OP_COPY:
+            machine_copy(m, source, dest, length);
+            cycles = length * DMA_COPY_CYCLES;
+            break;
+        case DMA_OP_FILL:
+            machine_fill(m, dest, length, d->reg[DMA_FILL]);
+            cycles = length * DMA_FILL_CYCLES;
+            break;
+        case DMA_OP_COMPARE: {
+            uint32_t offset = machine_compare(m, source, dest, length);
+            d->reg[DMA_RESULT] = 0;
+            if (offset < length) {
+                d->reg[DMA_RESULT] = read6502(source + offset) < read6502(dest + offset) ? 0xFF : 0x01;
+            }
+            d->reg[DMA_OFFSET] = offset & 0xFF;
+            d->reg[DMA_OFFSET + 1] = offset >> 8;
+            cycles = (offset < length ? offset + 1 : length) * DMA_COMPARE_CYCLES;
+            break;
+        }
+        default:
+            return;
+    }
+    d->transfers++;
+    if (!(d->reg[DMA_MODE] & DMA_TURBO)) {
+        clockticks6502 += cycles;
+        d->stolen += cycles;
+    }
+}
+
+static uint8_t dma_read(machine_t *m, void *state, uint8_t reg) {
+    dma_t *d = state;
+    (void)m;
+    return d->reg[reg];
+}
+
+static void dma_write(machine_t *m, void *state, uint8_t reg, uint8_t value) {
+    dma_t *d = state;
+    if (reg >= DMA_RESULT) return;
+    d->reg[reg] = value;
+    if (reg == DMA_MODE) dma_run(m, d);
+}
+
+//map the DMA engine into its window of m
+void dma_attach(machine_t *m, dma_t *d) {
+    machine_attach(m, DMA_SLOT, (machine_dev_t){ dma_read, dma_write, d });
+}
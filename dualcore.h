@@ -0,0 +1,117 @@
+#pragma once
+/* Dual-core plumbing ***********************************
+ * Lock-free single-producer/single-consumer queues and *
+ * a way to start code on the second core: core 1 of    *
+ * the RP2040 through pico_multicore, or a pthread on   *
+ * the host so the same design can be tested on Linux.  *
+ ********************************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+
+#ifndef PICO_ON_DEVICE
+#define PICO_ON_DEVICE 0
+#endif
+
+// Entries per queue, must be a power of two
+#define SPSC_SIZE 256
+
+// Keep producer and consumer indexes on separate cache lines on the host
+#if PICO_ON_DEVICE
+#define SPSC_ALIGN 4
+#else
+#define SPSC_ALIGN 64
+#endif
+
+// Queue entries are tagged so one queue can carry several kinds of message
+#define DUAL_TAG_MASK     0xC0000000u
+#define DUAL_CONSOLE      0x00000000u // low byte is a console character
+#define DUAL_GPIO_DIRS    0x40000000u // low bits are the GPIO direction mask
+#define DUAL_GPIO_OUTS    0x80000000u // low bits are the GPIO output values
+#define DUAL_CONTROL      0xC0000000u // low bits are one of the codes below
+
+#define DUAL_STOP         0x0 // core 0 has stopped running the 6502
+#define DUAL_INPUT_ENDED  0x1 // console input has ended (host only)
+
+typedef struct {
+    _Alignas(SPSC_ALIGN) _Atomic uint32_t head; // written by the producer only
+    _Alignas(SPSC_ALIGN) _Atomic uint32_t tail; // written by the consumer only
+    _Alignas(SPSC_ALIGN) uint32_t data[SPSC_SIZE];
+} spsc_t;
+
+static inline void spsc_init(spsc_t *q) {
+    atomic_store_explicit(&q->head, 0, memory_order_relaxed);
+    atomic_store_explicit(&q->tail, 0, memory_order_relaxed);
+}
+
+// Returns false when the queue is full
+static inline bool spsc_push(spsc_t *q, uint32_t item) {
+    uint32_t head = atomic_load_explicit(&q->head, memory_order_relaxed);
+    uint32_t tail = atomic_load_explicit(&q->tail, memory_order_acquire);
+
+    if (head - tail == SPSC_SIZE) return false;
+    q->data[head & (SPSC_SIZE - 1)] = item;
+    atomic_store_explicit(&q->head, head + 1, memory_order_release);
+    return true;
+}
+
+// Returns false when the queue is empty
+static inline bool spsc_pop(spsc_t *q, uint32_t *item) {
+    uint32_t tail = atomic_load_explicit(&q->tail, memory_order_relaxed);
+    uint32_t head = atomic_load_explicit(&q->head, memory_order_acquire);
+
+    if (head == tail) return false;
+    *item = q->data[tail & (SPSC_SIZE - 1)];
+    atomic_store_explicit(&q->tail, tail + 1, memory_order_release);
+    return true;
+}
+
+static inline uint32_t spsc_count(spsc_t *q) {
+    return atomic_load_explicit(&q->head, memory_order_acquire) -
+           atomic_load_explicit(&q->tail, memory_order_acquire);
+}
+
+#if PICO_ON_DEVICE
+#include "pico/multicore.h"
+
+static inline void dual_relax(void) {
+    tight_loop_contents();
+}
+
+static inline void dual_launch(void (*entry)(void)) {
+    multicore_launch_core1(entry);
+}
+
+#else
+#include <pthread.h>
+#include <sched.h>
+
+// Host threads may share a core, so give the other side a chance to run
+static inline void dual_relax(void) {
+    sched_yield();
+}
+
+static pthread_t dual_thread;
+
+static void *dual_thread_entry(void *entry) {
+    ((void (*)(void))entry)();
+    return NULL;
+}
+
+static inline void dual_launch(void (*entry)(void)) {
+    pthread_create(&dual_thread, NULL, dual_thread_entry, (void *)entry);
+}
+
+// Wait for the second core's entry function to return (host only)
+static inline void dual_join(void) {
+    pthread_join(dual_thread, NULL);
+}
+#endif
+
+// Spin until there is room, for producers that must not drop data
+static inline void spsc_push_wait(spsc_t *q, uint32_t item) {
+    while (!spsc_push(q, item)) {
+        dual_relax();
+    }
+}
@@ -0,0 +1,251 @@
+/* Fast load ********************************************
+ * A binary protocol on the console that pauses the     *
+ * CPU, writes memory at the speed of the link, checks  *
+ * it with CRCs and starts the CPU again, so a new      *
+ * image needs no rebuild of the firmware. 6502load is  *
+ * the other end.                                       *
+ *                                                      *
+ * A frame is SOH, a kind byte ('L' to the emulator,    *
+ * 'l' back), the body with its CRC-16/CCITT, low byte  *
+ * first, and EOT. Inside, SOH, EOT, ENQ, ACK, DLE, XON *
+ * and XOFF are sent as DLE and the byte XOR $20, so    *
+ * neither the receive buffer nor a terminal acts on    *
+ * them. SOH followed by anything but the kind byte is  *
+ * passed on as console input.                          *
+ *                                                      *
+ * A request body is a command, an address and a length *
+ * (both low byte first) and, for FASTLOAD_WRITE, the   *
+ * data. The answer is the command, a status and a      *
+ * 16-bit value. Commands it does not know go to the    *
+ * other hook, such as those of muxlink.c. A decoder of *
+ * kind 0 takes frames of any kind, for a               *
+ * demultiplexer. FASTLOAD_PROTOCOL_ONLY leaves out the *
+ * part that runs requests, for host tools; otherwise   *
+ * include after machine.c.                             *
+ ********************************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdatomic.h>
+
+#define FASTLOAD_SOH 0x01
+#define FASTLOAD_EOT 0x04
+#define FASTLOAD_DLE 0x10
+
+#define FASTLOAD_REQUEST 'L'
+#define FASTLOAD_ANSWER  'l'
+
+//commands; the answer value is given after each
+#define FASTLOAD_PAUSE 'P' //stop the CPU; its PC
+#define FASTLOAD_WRITE 'W' //data to mem[] from address on; CRC of what is there now
+#define FASTLOAD_CRC   'C' //CRC of length bytes of mem[] from address
+#define FASTLOAD_GO    'G' //set PC to address and run
+#define FASTLOAD_RESET 'X' //reset through the vector and run; the new PC
+
+//answer status
+#define FASTLOAD_OK      0
+#define FASTLOAD_BAD     1 //CRC or framing error, or too long
+#define FASTLOAD_UNKNOWN 2 //no such command, or the length does not match
+#define FASTLOAD_RUNNING 3 //the command needs the CPU paused
+#define FASTLOAD_FULL    4 //no room for what it would send, try again
+
+#define FASTLOAD_DATA 4096 //most data in one frame
+#define FASTLOAD_HEADER 5
+//a frame with every byte escaped
+#define FASTLOAD_FRAME (2 + 2 * (FASTLOAD_HEADER + FASTLOAD_DATA + 2) + 1)
+
+//what fastload_byte() made of a byte
+#define FASTLOAD_PASS     0 //not part of a frame
+#define FASTLOAD_PASS_SOH 1 //nor was the SOH before it
+#define FASTLOAD_TAKEN    2
+#define FASTLOAD_READY    3 //a frame is in
+
+typedef struct fastload fastload_t;
+
+struct fastload {
+    //the decoder, on the thread that reads the link. got is the kind of
+    //the frame in body
+    uint8_t kind, got;
+    uint8_t state;
+    bool escape, overflow;
+    uint32_t len;
+    uint8_t body[FASTLOAD_HEADER + FASTLOAD_DATA + 2];
+
+    //set by the decoder, cleared once the frame has been dealt with
+    _Atomic bool ready;
+    bool bad;
+
+    //the machine side
+    _Atomic bool paused;
+    uint64_t frames, bytes, errors;
+
+    //runs a command fastload_command() does not know: its status, and the
+    //answer value in value
+    uint8_t (*other)(fastload_t *f, uint16_t *value);
+    //sends an answer frame whole, instead of through the console of the
+    //machine a byte at a time
+    void (*send)(fastload_t *f, const uint8_t *frame, size_t len);
+    void *user;
+};
+
+void fastload_init(fastload_t *f, uint8_t kind) {
+    memset(f, 0, sizeof(*f));
+    f->kind = kind;
+}
+
+uint16_t fastload_crc(const uint8_t *data, size_t len) {
+    uint16_t crc = 0xFFFF;
+    for (size_t i = 0; i < len; i++) {
+        crc ^= data[i] << 8;
+        for (int b = 0; b < 8; b++) crc = crc & 0x8000 ? (crc << 1) ^ 0x1021 : crc << 1;
+    }
+    return crc;
+}
+
+static bool fastload_special(uint8_t c) {
+    return c == 0x01 || c == 0x04 || c == 0x05 || c == 0x06 || c == 0x10 || c == 0x11 || c == 0x13;
+}
+
+//frame body with its CRC into out, at most FASTLOAD_FRAME bytes: returns
+//their number
+size_t fastload_encode(uint8_t kind, const uint8_t *body, size_t len, uint8_t *out) {
+    uint16_t crc = fastload_crc(body, len);
+    size_t n = 0;
+    out[n++] = FASTLOAD_SOH;
+    out[n++] = kind;
+    for (size_t i = 0; i < len + 2; i++) {
+        uint8_t c = i < len ? body[i] : i == len ? crc & 0xFF : crc >> 8;
+        if (fastload_special(c)) {
+            out[n++] = FASTLOAD_DLE;
+            c ^= 0x20;
+        }
+        out[n++] = c;
+    }
+    out[n++] = FASTLOAD_EOT;
+    return n;
+}
+
+//true while a frame is coming in, whose bytes go nowhere else
+static inline bool fastload_framing(const fastload_t *f) {
+    return f->state != 0;
+}
+
+//one byte from the link. no byte may be given while a frame is ready
+int fastload_byte(fastload_t *f, uint8_t c) {
+    enum { IDLE, SOH, BODY };
+    switch (f->state) {
+        case IDLE:
+            if (c != FASTLOAD_SOH) return FASTLOAD_PASS;
+            f->state = SOH;
+            return FASTLOAD_TAKEN;
+        case SOH:
+            f->state = IDLE;
+            if (f->kind ? c != f->kind : c < '@') return FASTLOAD_PASS_SOH;
+            f->state = BODY;
+            f->got = c;
+            f->len = 0;
+            f->escape = f->overflow = false;
+            return FASTLOAD_TAKEN;
+    }
+    if (c == FASTLOAD_SOH) {
+        //a frame cut short: start again
+        f->errors++;
+        f->state = SOH;
+        return FASTLOAD_TAKEN;
+    }
+    if (c == FASTLOAD_EOT) {
+        f->state = IDLE;
+        f->bad = f->overflow || f->len < 2 ||
+                 fastload_crc(f->body, f->len - 2) != (f->body[f->len - 2] | (f->body[f->len - 1] << 8));
+        if (!f->bad) f->len -= 2;
+        else f->errors++;
+        atomic_store_explicit(&f->ready, true, memory_order_release);
+        return FASTLOAD_READY;
+    }
+    if (c == FASTLOAD_DLE) {
+        f->escape = true;
+        return FASTLOAD_TAKEN;
+    }
+    if (f->escape) c ^= 0x20;
+    f->escape = false;
+    if (f->len < sizeof(f->body)) f->body[f->len++] = c;
+    else f->overflow = true;
+    return FASTLOAD_TAKEN;
+}
+
+//the ready frame has been dealt with, the decoder may go on
+static inline void fastload_done(fastload_t *f) {
+    atomic_store_explicit(&f->ready, false, memory_order_release);
+}
+
+#ifndef FASTLOAD_PROTOCOL_ONLY
+
+static void fastload_answer(fastload_t *f, machine_t *m, uint8_t command, uint8_t status, uint16_t value) {
+    uint8_t body[4] = { command, status, value & 0xFF, value >> 8 };
+    uint8_t frame[2 + 2 * (sizeof(body) + 2) + 1];
+    size_t n = fastload_encode(FASTLOAD_ANSWER, body, sizeof(body), frame);
+    if (status != FASTLOAD_OK) f->errors++;
+    if (f->send) {
+        f->send(f, frame, n);
+        return;
+    }
+    for (size_t i = 0; i < n; i++) m->putc(m, frame[i]);
+}
+
+static uint8_t fastload_command(fastload_t *f, machine_t *m, uint16_t *value) {
+    uint8_t command = f->body[0];
+    uint16_t address = f->body[1] | (f->body[2] << 8);
+    uint16_t len = f->body[3] | (f->body[4] << 8);
+    const uint8_t *data = f->body + FASTLOAD_HEADER;
+    bool paused = atomic_load_explicit(&f->paused, memory_order_relaxed);
+
+    if (f->len < FASTLOAD_HEADER) return FASTLOAD_UNKNOWN;
+    if (!paused && (command == FASTLOAD_WRITE || command == FASTLOAD_GO || command == FASTLOAD_RESET)) {
+        return FASTLOAD_RUNNING;
+    }
+    switch (command) {
+        case FASTLOAD_PAUSE:
+            atomic_store_explicit(&f->paused, true, memory_order_relaxed);
+            *value = pc;
+            return FASTLOAD_OK;
+        case FASTLOAD_WRITE:
+            if (f->len != (uint32_t)(FASTLOAD_HEADER + len) || (uint32_t)address + len > 0x10000) return FASTLOAD_UNKNOWN;
+            //native routines of the old image would run in the middle of the new one
+            machine_clear_points(m);
+            m->native = NULL;
+            memcpy(m->mem + address, data, len);
+            f->bytes += len;
+            *value = fastload_crc(m->mem + address, len);
+            return FASTLOAD_OK;
+        case FASTLOAD_CRC:
+            if ((uint32_t)address + len > 0x10000) return FASTLOAD_UNKNOWN;
+            *value = fastload_crc(m->mem + address, len);
+            return FASTLOAD_OK;
+        case FASTLOAD_GO:
+            pc = address;
+            *value = pc;
+            break;
+        case FASTLOAD_RESET:
+            machine_reset(m);
+            *value = pc;
+            break;
+        default:
+            return f->other ? f->other(f, value) : FASTLOAD_UNKNOWN;
+    }
+    atomic_store_explicit(&f->paused, false, memory_order_relaxed);
+    return FASTLOAD_OK;
+}
+
+//run the ready frame on m, on the thread of its CPU, and answer through
+//its console
+void fastload_run(fastload_t *f, machine_t *m) {
+    uint16_t value = 0;
+    uint8_t status = f->bad ? FASTLOAD_BAD : fastload_command(f, m, &value);
+    fastload_answer(f, m, f->bad ? 0 : f->body[0], status, value);
+    f->frames++;
+    fastload_done(f);
+}
+
+#endif
@@ -0,0 +1,82 @@
+/* TaliForth dictionary *********************************
+ * Finds the words of a TaliForth ROM in memory. The    *
+ * FORTH word list is found by its shape rather than by *
+ * a fixed address, so any build of the ROM can be      *
+ * loaded. Include after machine.c.                     *
+ ********************************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+//dictionary header: length, flags, next header, xt, end of code, name
+#define FORTH_HDR_NEXT 2
+#define FORTH_HDR_XT   4
+#define FORTH_HDR_Z    6
+#define FORTH_HDR_NAME 8
+#define FORTH_NAME_MAX 31
+#define FORTH_FLAG_IMMEDIATE 0x04
+#define FORTH_FLAG_UF        0x10 //the code starts with a JSR to a stack check
+
+static uint16_t forthdict_word16(const machine_t *m, uint16_t address) {
+    return m->mem[address] | (m->mem[(uint16_t)(address + 1)] << 8);
+}
+
+//a plausible header at address, with its code in the ROM from rom up
+static bool forthdict_header(const machine_t *m, uint32_t address, uint16_t rom) {
+    const uint8_t *h = m->mem + address;
+    if (h[0] == 0 || h[0] > FORTH_NAME_MAX || address + FORTH_HDR_NAME + h[0] > 0x10000) return false;
+
+    uint16_t next = forthdict_word16(m, address + FORTH_HDR_NEXT);
+    uint16_t xt = forthdict_word16(m, address + FORTH_HDR_XT);
+    uint16_t z = forthdict_word16(m, address + FORTH_HDR_Z);
+    if ((next && next < rom) || xt < rom || z < xt) return false;
+    for (int i = 0; i < h[0]; i++) {
+        uint8_t c = h[FORTH_HDR_NAME + i];
+        if (c <= ' ' || c > '~' || (c >= 'A' && c <= 'Z')) return false;
+    }
+    return true;
+}
+
+//words on the list that starts at address, 0 when it is not one
+static int forthdict_chain(const machine_t *m, uint16_t address, uint16_t rom) {
+    int words = 0;
+    while (address) {
+        if (!forthdict_header(m, address, rom) || words > 0x1000) return 0;
+        address = forthdict_word16(m, address + FORTH_HDR_NEXT);
+        words++;
+    }
+    return words;
+}
+
+//the first header of the FORTH word list of the ROM loaded from rom up,
+//the longest list in it, or 0
+static uint16_t forthdict_list(const machine_t *m, uint16_t rom) {
+    uint16_t list = 0;
+    int longest = 0;
+    for (uint32_t a = rom; a < 0x10000; a++) {
+        if (!forthdict_header(m, a, rom)) continue;
+        int words = forthdict_chain(m, a, rom);
+        if (words > longest) {
+            longest = words;
+            list = a;
+        }
+    }
+    return list;
+}
+
+static uint16_t forthdict_find(const machine_t *m, uint16_t list, const char *name, uint16_t *xt) {
+    for (uint16_t h = list; h; h = forthdict_word16(m, h + FORTH_HDR_NEXT)) {
+        if (m->mem[h] == strlen(name) && !memcmp(m->mem + h + FORTH_HDR_NAME, name, m->mem[h])) {
+            *xt = forthdict_word16(m, h + FORTH_HDR_XT);
+            return h;
+        }
+    }
+    return 0;
+}
+
+//where a word's own work starts: behind the stack check it opens with
+static uint16_t forthdict_entry(const machine_t *m, uint16_t header, uint16_t xt) {
+    if ((m->mem[header + 1] & FORTH_FLAG_UF) && m->mem[xt] == 0x20) return xt + 3;
+    return xt;
+}
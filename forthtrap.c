@@ -0,0 +1,560 @@
+/* TaliForth native words *******************************
+ * Runs the hot words of the TaliForth ROM on the host: *
+ * UM*, UM/MOD, CMOVE and CMOVE> (and with them MOVE),  *
+ * FILL, COMPARE, >NUMBER, # and the dictionary search  *
+ * of FIND-NAME and SEARCH-WORDLIST, which looks names  *
+ * up in a hash index of the word lists. The index      *
+ * takes in new words as they are defined and is built  *
+ * again when a list is cut back, or when a header it   *
+ * has changes. The addresses of the words come from    *
+ * the dictionary of the ROM in memory, so any build of *
+ * it can be loaded. Each word gets a native point of   *
+ * the machine just behind its stack check; the host    *
+ * then works on mem[] with the data stack at X in zero *
+ * page, adds the cycles the ROM code would have taken  *
+ * and returns as its RTS would. Include after          *
+ * forthdict.c.                                         *
+ ********************************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#define FORTHTRAP_MAX 16
+
+//what a word needs to have found in the ROM besides its own code
+#define FORTHTRAP_NEED_BASE 0x01 //the zero page address of BASE
+#define FORTHTRAP_NEED_HOLD 0x02 //the hold pointer and the digits of #
+#define FORTHTRAP_NEED_ORDER 0x04 //the user area: search order and word lists
+
+#define FORTHTRAP_WORDLISTS 12 //as many as WORDLIST hands out
+#define FORTHTRAP_INDEX 4096   //slots of the hash index, a power of two
+
+typedef struct forthtrap forthtrap_t;
+
+//run does the work of the word on the stack at X and returns the units of
+//work done (bytes, digits, set bits, headers looked at), or -1 to leave the
+//call to the ROM code: arguments the ROM would abort on, or memory that is
+//not plain RAM. a word with a second kind of work leaves its count in
+//units2. it must not change anything before it has decided
+typedef struct {
+    const char *name;
+    int32_t (*run)(machine_t *m, forthtrap_t *ft);
+    uint8_t needs;           //FORTHTRAP_NEED_*
+    uint16_t cycles;         //cost of a call, calibrated with 6502forth -k
+    uint16_t unit_cycles;    //and of every unit of work
+    uint16_t unit2_cycles;   //and of every unit of the second kind
+} forthtrap_word_t;
+
+//a word of the index; rank is its place on its word list, 1 for the oldest,
+//and same the place among the words there with a name of its length
+typedef struct {
+    uint16_t nt; //0 for a free slot
+    uint16_t next; //the link in its header when it was taken in
+    uint16_t rank;
+    uint16_t same;
+    uint8_t wid;
+} forthtrap_slot_t;
+
+typedef struct {
+    bool indexed[FORTHTRAP_WORDLISTS];
+    uint16_t head[FORTHTRAP_WORDLISTS]; //newest word of each list the index has
+    uint32_t sign[FORTHTRAP_WORDLISTS]; //and its length, link and name, hashed
+    uint16_t count[FORTHTRAP_WORDLISTS];
+    uint16_t lengths[FORTHTRAP_WORDLISTS][FORTH_NAME_MAX + 1]; //words with a name of each length
+    uint16_t words;
+    uint64_t builds; //times it was built from scratch
+    forthtrap_slot_t slot[FORTHTRAP_INDEX];
+} forthtrap_index_t;
+
+struct forthtrap {
+    int count;
+    const forthtrap_word_t *word[FORTHTRAP_MAX];
+    uint16_t xt[FORTHTRAP_MAX];          //each word
+    uint16_t entry[FORTHTRAP_MAX];       //and its native point
+    uint16_t cycles[FORTHTRAP_MAX];      //its cost, from the table
+    uint16_t unit_cycles[FORTHTRAP_MAX];
+    uint16_t unit2_cycles[FORTHTRAP_MAX];
+    uint64_t calls[FORTHTRAP_MAX];       //calls run natively
+    int32_t units;                       //work done by the last one
+    int32_t units2;                      //and of the second kind
+
+    uint8_t base;    //zero page address of BASE, 0 when not found
+    uint8_t hold;    //zero page address of the hold pointer
+    uint16_t digits; //digit characters of #
+
+    uint8_t up;        //zero page address of the user area pointer
+    uint8_t order;     //offsets in the user area of #ORDER,
+    uint8_t search;    //the search order
+    uint8_t wordlists; //and the newest word of each word list
+    forthtrap_index_t index;
+};
+
+static uint16_t forthtrap_cell(const machine_t *m, int i) {
+    uint8_t at = x + 2 * i;
+    return m->mem[at] | (m->mem[(uint8_t)(at + 1)] << 8);
+}
+
+static void forthtrap_set(machine_t *m, int i, uint16_t value) {
+    uint8_t at = x + 2 * i;
+    m->mem[at] = value & 0xFF;
+    m->mem[(uint8_t)(at + 1)] = value >> 8;
+}
+
+//DIGIT? of the ROM, which folds lower case letters and compares the
+//value with the low byte of BASE only: the value, or -1
+static int forthtrap_digit(uint8_t c, uint8_t base) {
+    if (c < '0') return -1;
+    if (c > '9') {
+        if (c < 'A') return -1;
+        if (c >= 'a' && c < '{') c -= 'a' - 'A';
+        c -= 'A' - '9' - 1;
+    }
+    c -= '0';
+    return c < base ? c : -1;
+}
+
+// ( u1 u2 -- ud )
+static int32_t forthtrap_um_star(machine_t *m, forthtrap_t *ft) {
+    uint16_t u1 = forthtrap_cell(m, 1), u2 = forthtrap_cell(m, 0);
+    //the ROM has a short way out for u2 = 0, not worth a call
+    if (!u2) return -1;
+    uint32_t ud = (uint32_t)u1 * u2;
+    forthtrap_set(m, 1, ud & 0xFFFF);
+    forthtrap_set(m, 0, ud >> 16);
+    //it adds once per set bit of u1
+    return __builtin_popcount(u1);
+}
+
+// ( ud u -- rem quot )
+static int32_t forthtrap_um_slash_mod(machine_t *m, forthtrap_t *ft) {
+    uint16_t u = forthtrap_cell(m, 0);
+    uint32_t ud = ((uint32_t)forthtrap_cell(m, 1) << 16) | forthtrap_cell(m, 2);
+    //division by zero aborts, an overflow leaves what the loop leaves
+    if (!u || ud >> 16 >= u) return -1;
+    x += 2;
+    forthtrap_set(m, 1, ud % u);
+    forthtrap_set(m, 0, ud / u);
+    //the remainder is stored once per set bit of the quotient
+    return __builtin_popcount(ud / u);
+}
+
+// ( addr1 addr2 u -- ), byte by byte from the start, so overlaps repeat
+static int32_t forthtrap_cmove(machine_t *m, forthtrap_t *ft) {
+    uint16_t u = forthtrap_cell(m, 0), to = forthtrap_cell(m, 1), from = forthtrap_cell(m, 2);
+    if (!machine_plain(m, from, u, MACHINE_PAGE_RWATCH) ||
+        !machine_plain(m, to, u, MACHINE_PAGE_WWATCH)) return -1;
+    for (uint32_t i = 0; i < u; i++) {
+        m->mem[(uint16_t)(to + i)] = m->mem[(uint16_t)(from + i)];
+    }
+    x += 6;
+    //the ROM copies whole pages in 16 cycles a byte and the rest in 22
+    ft->units2 = u & 0xFF;
+    return u;
+}
+
+// ( addr1 addr2 u -- ), byte by byte from the end
+static int32_t forthtrap_cmove_up(machine_t *m, forthtrap_t *ft) {
+    uint16_t u = forthtrap_cell(m, 0), to = forthtrap_cell(m, 1), from = forthtrap_cell(m, 2);
+    if (!machine_plain(m, from, u, MACHINE_PAGE_RWATCH) ||
+        !machine_plain(m, to, u, MACHINE_PAGE_WWATCH)) return -1;
+    for (uint32_t i = u; i-- > 0;) {
+        m->mem[(uint16_t)(to + i)] = m->mem[(uint16_t)(from + i)];
+    }
+    x += 6;
+    //the ROM reads each page from Y = 255 down to 1 off a pointer with the
+    //low byte of addr1, which takes a cycle more where it crosses a page
+    int32_t over = (from & 0xFF) + (u & 0xFF) - 256;
+    ft->units2 = (u >> 8) * (from & 0xFF) + (over > 0 ? over : 0);
+    return u;
+}
+
+// ( addr u char -- ), which never writes from $8000 up
+static int32_t forthtrap_fill(machine_t *m, forthtrap_t *ft) {
+    uint16_t u = forthtrap_cell(m, 1), address = forthtrap_cell(m, 2);
+    //the ROM is done with nothing to write in a few cycles, cheaper than a call
+    if (!u || address >= 0x8000) return -1;
+    uint32_t n = 0x8000 - address;
+    if (u < n) n = u;
+    if (!machine_plain(m, address, n, MACHINE_PAGE_WWATCH)) return -1;
+    memset(m->mem + address, forthtrap_cell(m, 0) & 0xFF, n);
+    x += 6;
+    //it checks the address against $7FFF again for each byte of page $7F
+    if (address + n > 0x7F00) ft->units2 = address + n - (address > 0x7F00 ? address : 0x7F00);
+    return n;
+}
+
+// ( addr1 u1 addr2 u2 -- n )
+static int32_t forthtrap_compare(machine_t *m, forthtrap_t *ft) {
+    uint16_t u2 = forthtrap_cell(m, 0), addr2 = forthtrap_cell(m, 1);
+    uint16_t u1 = forthtrap_cell(m, 2), addr1 = forthtrap_cell(m, 3);
+    uint16_t n = u1 < u2 ? u1 : u2;
+    if (!machine_plain(m, addr1, n, MACHINE_PAGE_RWATCH) ||
+        !machine_plain(m, addr2, n, MACHINE_PAGE_RWATCH)) return -1;
+
+    int result = u1 == u2 ? 0 : u1 < u2 ? -1 : 1;
+    uint16_t i;
+    for (i = 0; i < n; i++) {
+        uint8_t c1 = m->mem[(uint16_t)(addr1 + i)], c2 = m->mem[(uint16_t)(addr2 + i)];
+        if (c1 != c2) {
+            result = c1 < c2 ? -1 : 1;
+            break;
+        }
+    }
+    x += 6;
+    forthtrap_set(m, 0, (uint16_t)result);
+    return i;
+}
+
+// ( ud1 addr1 u1 -- ud2 addr2 u2 )
+static int32_t forthtrap_to_number(machine_t *m, forthtrap_t *ft) {
+    uint16_t u = forthtrap_cell(m, 0), address = forthtrap_cell(m, 1);
+    //the ROM looks at one character before it tests u, and counts down
+    //its low byte only
+    if (u == 0 || u > 0xFF || !machine_plain(m, address, u, MACHINE_PAGE_RWATCH)) return -1;
+
+    uint8_t base = m->mem[ft->base];
+    uint32_t ud = ((uint32_t)forthtrap_cell(m, 2) << 16) | forthtrap_cell(m, 3);
+    int32_t digits = 0;
+    for (; u; u--, address++, digits++) {
+        int d = forthtrap_digit(m->mem[address], base);
+        if (d < 0) break;
+        ft->units2 += __builtin_popcount(ud);
+        ud = ud * base + d;
+    }
+    forthtrap_set(m, 0, u);
+    forthtrap_set(m, 1, address);
+    forthtrap_set(m, 2, ud >> 16);
+    forthtrap_set(m, 3, ud & 0xFFFF);
+    return digits;
+}
+
+// ( ud1 -- ud2 ), holds the digit of ud1 mod BASE
+static int32_t forthtrap_number_sign(machine_t *m, forthtrap_t *ft) {
+    uint16_t base = forthdict_word16(m, ft->base);
+    uint16_t hold = forthdict_word16(m, ft->hold) - 1;
+    if (!base || !machine_plain(m, hold, 1, MACHINE_PAGE_WWATCH)) return -1;
+
+    uint32_t ud = ((uint32_t)forthtrap_cell(m, 0) << 16) | forthtrap_cell(m, 1);
+    //the ROM indexes its digit table with the low byte of the remainder
+    m->mem[hold] = m->mem[(uint16_t)(ft->digits + (uint8_t)(ud % base))];
+    m->mem[ft->hold] = hold & 0xFF;
+    m->mem[(uint8_t)(ft->hold + 1)] = hold >> 8;
+    forthtrap_set(m, 0, (ud / base) >> 16);
+    forthtrap_set(m, 1, (ud / base) & 0xFFFF);
+    return 0;
+}
+
+/* Dictionary search ************************************/
+
+//the slot of name on word list wid: the one that holds it, or the free
+//one where it goes. the index is never more than 3/4 full
+static forthtrap_slot_t *forthtrap_slot(forthtrap_index_t *ix, const machine_t *m,
+                                        const uint8_t *name, uint8_t len, uint8_t wid) {
+    uint32_t h = 2166136261u ^ wid;
+    for (int i = 0; i < len; i++) h = (h ^ name[i]) * 16777619u;
+    for (;; h++) {
+        forthtrap_slot_t *s = &ix->slot[h & (FORTHTRAP_INDEX - 1)];
+        if (!s->nt) return s;
+        if (s->wid == wid && m->mem[s->nt] == len && !memcmp(m->mem + s->nt + FORTH_HDR_NAME, name, len)) return s;
+    }
+}
+
+//the length, link and name of the header at h, hashed: a word cut back
+//and defined again at the same address has other ones
+static uint32_t forthtrap_sign(const machine_t *m, uint16_t h) {
+    uint8_t len = m->mem[h] <= FORTH_NAME_MAX ? m->mem[h] : 0;
+    uint32_t sign = (2166136261u ^ len) * 16777619u;
+    sign = (sign ^ forthdict_word16(m, h + FORTH_HDR_NEXT)) * 16777619u;
+    for (int i = 0; i < len; i++) sign = (sign ^ m->mem[(uint16_t)(h + FORTH_HDR_NAME + i)]) * 16777619u;
+    return sign;
+}
+
+//the words on list wid from head down to the newest one the index has, or
+//-1 when that one is not on the list any more
+static int forthtrap_new_words(const forthtrap_index_t *ix, const machine_t *m, uint8_t wid, uint16_t head) {
+    uint16_t known = ix->indexed[wid] ? ix->head[wid] : 0;
+    int n = 0;
+    for (uint16_t h = head; h != known; h = forthdict_word16(m, h + FORTH_HDR_NEXT)) {
+        if (!h || n == FORTHTRAP_INDEX) return -1;
+        n++;
+    }
+    if (known && forthtrap_sign(m, known) != ix->sign[wid]) return -1;
+    return n;
+}
+
+//take in the n words from head down; a newer word hides an older one
+//of the same name
+static bool forthtrap_add_words(forthtrap_index_t *ix, const machine_t *m, uint8_t wid, uint16_t head, int n) {
+    uint16_t count = ix->count[wid];
+    uint16_t *lengths = ix->lengths[wid];
+    uint16_t same[FORTH_NAME_MAX + 1];
+    uint16_t h = head;
+    ix->count[wid] += n;
+    ix->head[wid] = head;
+    ix->sign[wid] = head ? forthtrap_sign(m, head) : 0;
+    ix->indexed[wid] = true;
+    for (int i = 0; i < n; i++, h = forthdict_word16(m, h + FORTH_HDR_NEXT)) {
+        if (m->mem[h] <= FORTH_NAME_MAX) lengths[m->mem[h]]++;
+    }
+    memcpy(same, lengths, sizeof(same));
+    for (h = head; n; n--, h = forthdict_word16(m, h + FORTH_HDR_NEXT)) {
+        uint8_t len = m->mem[h];
+        if (len <= FORTH_NAME_MAX) same[len]--;
+        if (!len || len > FORTH_NAME_MAX || h + FORTH_HDR_NAME + len > 0x10000) continue;
+        forthtrap_slot_t *s = forthtrap_slot(ix, m, m->mem + h + FORTH_HDR_NAME, len, wid);
+        if (s->nt && s->rank > count) continue;
+        if (!s->nt && ++ix->words > FORTHTRAP_INDEX * 3 / 4) return false;
+        s->nt = h;
+        s->next = forthdict_word16(m, h + FORTH_HDR_NEXT);
+        s->rank = count + n;
+        s->same = same[len] + 1;
+        s->wid = wid;
+    }
+    return true;
+}
+
+//forget every list, to build the index again from scratch
+static void forthtrap_drop(forthtrap_index_t *ix) {
+    memset(ix->indexed, 0, sizeof(ix->indexed));
+    memset(ix->count, 0, sizeof(ix->count));
+    memset(ix->lengths, 0, sizeof(ix->lengths));
+    memset(ix->slot, 0, sizeof(ix->slot));
+    ix->words = 0;
+    ix->builds++;
+}
+
+//bring list wid up to date: take in the words defined since, or build
+//the index again when the list has been cut back, or its newest word
+//defined again in the same place
+static bool forthtrap_sync(forthtrap_t *ft, const machine_t *m, uint16_t up, uint8_t wid) {
+    forthtrap_index_t *ix = &ft->index;
+    uint16_t head = forthdict_word16(m, up + ft->wordlists + 2 * wid);
+    if (ix->indexed[wid] && ix->head[wid] == head && (!head || forthtrap_sign(m, head) == ix->sign[wid])) return true;
+
+    int n = forthtrap_new_words(ix, m, wid, head);
+    if (n < 0) {
+        forthtrap_drop(ix);
+        if ((n = forthtrap_new_words(ix, m, wid, head)) < 0) return false;
+    }
+    if (forthtrap_add_words(ix, m, wid, head, n)) return true;
+    ix->indexed[wid] = false;
+    return false;
+}
+
+//the newest word called name on list wid, 0 when there is none. adds to
+//visits the words the ROM would have looked at, and to ft->units2 those of
+//them with a name of the same length, which it compares byte by byte.
+//-1 when the header found has another link than when it was taken in:
+//the list has changed below its newest word, so the index is dropped
+static int32_t forthtrap_lookup(forthtrap_t *ft, const machine_t *m, uint8_t wid,
+                                const uint8_t *name, uint8_t len, int32_t *visits) {
+    forthtrap_slot_t *s = forthtrap_slot(&ft->index, m, name, len, wid);
+    if (!s->nt) {
+        *visits += ft->index.count[wid];
+        ft->units2 += ft->index.lengths[wid][len];
+        return 0;
+    }
+    if (forthdict_word16(m, s->nt + FORTH_HDR_NEXT) != s->next) {
+        forthtrap_drop(&ft->index);
+        return -1;
+    }
+    *visits += ft->index.count[wid] - s->rank + 1;
+    ft->units2 += ft->index.lengths[wid][len] - s->same + 1;
+    return s->nt;
+}
+
+//name, in the lower case of the dictionary; false when no word can have it
+static bool forthtrap_name(const machine_t *m, uint16_t address, uint16_t u, uint8_t *name) {
+    if (u > FORTH_NAME_MAX) return false;
+    for (int i = 0; i < u; i++) {
+        uint8_t c = m->mem[(uint16_t)(address + i)];
+        name[i] = c >= 'A' && c <= 'Z' ? c + 'a' - 'A' : c;
+    }
+    return true;
+}
+
+// ( addr u -- nt ), through the search order
+static int32_t forthtrap_find_name(machine_t *m, forthtrap_t *ft) {
+    uint16_t u = forthtrap_cell(m, 0), address = forthtrap_cell(m, 1);
+    uint16_t up = forthdict_word16(m, ft->up);
+    uint8_t order = m->mem[(uint16_t)(up + ft->order)];
+    const uint8_t *wid = m->mem + (uint16_t)(up + ft->search);
+    uint8_t name[FORTH_NAME_MAX];
+    bool named = forthtrap_name(m, address, u, name);
+    int32_t nt = 0;
+    int32_t visits = 0;
+
+    //the ROM gives up on an empty name in a few cycles, cheaper than a call
+    if (!u || order > FORTHTRAP_WORDLISTS || up + ft->search + order > 0x10000) return -1;
+    for (int i = 0; i < order; i++) {
+        if (wid[i] >= FORTHTRAP_WORDLISTS || !forthtrap_sync(ft, m, up, wid[i])) return -1;
+    }
+    //building the index again for a later list drops the earlier ones
+    for (int i = 0; i < order; i++) {
+        if (!ft->index.indexed[wid[i]] && !forthtrap_sync(ft, m, up, wid[i])) return -1;
+    }
+    for (int i = 0; i < order && !nt; i++) {
+        if (!named) visits += ft->index.count[wid[i]];
+        else nt = forthtrap_lookup(ft, m, wid[i], name, u, &visits);
+    }
+    if (nt < 0) return -1;
+    x += 2;
+    forthtrap_set(m, 0, nt);
+    return visits;
+}
+
+// ( addr u wid -- 0 | xt 1 | xt -1 )
+static int32_t forthtrap_search_wordlist(machine_t *m, forthtrap_t *ft) {
+    uint16_t wid = forthtrap_cell(m, 0), u = forthtrap_cell(m, 1), address = forthtrap_cell(m, 2);
+    uint16_t up = forthdict_word16(m, ft->up);
+    uint8_t name[FORTH_NAME_MAX];
+    int32_t nt = 0;
+    int32_t visits = 0;
+
+    //the ROM leaves addr for an empty name, in a few cycles
+    if (wid >= FORTHTRAP_WORDLISTS || !u) return -1;
+    if (!forthtrap_sync(ft, m, up, wid)) return -1;
+    if (forthtrap_name(m, address, u, name)) nt = forthtrap_lookup(ft, m, wid, name, u, &visits);
+    else visits = ft->index.count[wid];
+    if (nt < 0) return -1;
+    if (!nt) {
+        x += 4;
+        forthtrap_set(m, 0, 0);
+        return visits;
+    }
+    x += 2;
+    forthtrap_set(m, 1, forthdict_word16(m, nt + FORTH_HDR_XT));
+    forthtrap_set(m, 0, m->mem[(uint16_t)(nt + 1)] & FORTH_FLAG_IMMEDIATE ? 1 : 0xFFFF);
+    return visits;
+}
+
+//cycles as measured on the ROM code by 6502forth -k. on its random calls
+//each word is within 3% of the ROM on average; the worst call is off by
+//17% for >number, 10% for compare and 6% or less for the others
+static const forthtrap_word_t forthtrap_words[] = {
+    { "um*",             forthtrap_um_star,         0,                    419, 17, 0 },
+    { "um/mod",          forthtrap_um_slash_mod,    0,                    1226, 13, 0 },
+    { "cmove",           forthtrap_cmove,           0,                    58, 17, 6 },
+    { "cmove>",          forthtrap_cmove_up,        0,                    84, 16, 1 },
+    { "fill",            forthtrap_fill,            0,                    66, 44, 6 },
+    { "compare",         forthtrap_compare,         0,                    80, 79, 0 },
+    { ">number",         forthtrap_to_number,       FORTHTRAP_NEED_BASE,  175, 1138, 18 },
+    { "#",               forthtrap_number_sign,     FORTHTRAP_NEED_BASE | FORTHTRAP_NEED_HOLD, 3298, 0, 0 },
+    { "find-name",       forthtrap_find_name,       FORTHTRAP_NEED_ORDER, 134, 46, 18 },
+    { "search-wordlist", forthtrap_search_wordlist, FORTHTRAP_NEED_ORDER, 122, 49, 19 },
+};
+#define FORTHTRAP_WORDS (sizeof(forthtrap_words) / sizeof(forthtrap_words[0]))
+
+//the native point of the machine: run the word entered at address
+static bool forthtrap_native(machine_t *m, uint16_t address) {
+    forthtrap_t *ft = m->native_state;
+    //the data and return stacks are used directly
+    if (!machine_plain(m, 0, 0x200, MACHINE_PAGE_RWATCH | MACHINE_PAGE_WWATCH)) return false;
+    for (int i = 0; i < ft->count; i++) {
+        if (ft->entry[i] != address) continue;
+        ft->units2 = 0;
+        int32_t units = ft->word[i]->run(m, ft);
+        if (units < 0) return false;
+
+        pc = forthdict_word16(m, BASE_STACK + (uint8_t)(sp + 1)) + 1;
+        sp += 2;
+        clockticks6502 += ft->cycles[i] + units * ft->unit_cycles[i] + ft->units2 * ft->unit2_cycles[i];
+        ft->calls[i]++;
+        ft->units = units;
+        return true;
+    }
+    return false;
+}
+
+//the data that #, >NUMBER and the dictionary search use is found in the
+//code of the words that own it, so it follows the build
+static void forthtrap_data(forthtrap_t *ft, const machine_t *m, uint16_t list) {
+    const uint8_t *c;
+    uint16_t h, xt;
+
+    //BASE: dex dex lda #base sta 0,x stz 1,x rts
+    if ((h = forthdict_find(m, list, "base", &xt))) {
+        c = m->mem + xt;
+        if (c[0] == 0xCA && c[1] == 0xCA && c[2] == 0xA9 && c[4] == 0x95) ft->base = c[3];
+    }
+
+    //HOLD: lda p bne +2 dec p+1 dec p lda 0,x sta (p)
+    if ((h = forthdict_find(m, list, "hold", &xt))) {
+        c = m->mem + forthdict_entry(m, h, xt);
+        uint8_t p = c[1];
+        if (c[0] == 0xA5 && c[2] == 0xD0 && c[4] == 0xC6 && c[5] == (uint8_t)(p + 1) &&
+            c[6] == 0xC6 && c[7] == p && c[10] == 0x92 && c[11] == p) ft->hold = p;
+    }
+
+    //FIND-NAME: lda 0,x ora 1,x bne +3 jmp fail stz i ldy #order lda i cmp (up),y
+    //bne +3 jmp fail clc adc #search tay lda (up),y asl clc adc #wordlists
+    if ((h = forthdict_find(m, list, "find-name", &xt))) {
+        c = m->mem + forthdict_entry(m, h, xt);
+        uint8_t up = c[16];
+        if (c[0] == 0xB5 && c[2] == 0x15 && c[9] == 0x64 && c[11] == 0xA0 && c[15] == 0xD1 &&
+            c[23] == 0x69 && c[26] == 0xB1 && c[27] == up && c[28] == 0x0A && c[30] == 0x69 && c[34] == up) {
+            ft->up = up;
+            ft->order = c[12];
+            ft->search = c[24];
+            ft->wordlists = c[31];
+        }
+    }
+
+    //#: tay lda digits,y
+    if (ft->hold && (h = forthdict_find(m, list, "#", &xt))) {
+        uint16_t z = forthdict_word16(m, h + FORTH_HDR_Z);
+        for (uint32_t a = xt; a + 3 < z; a++) {
+            if (m->mem[a] == 0xA8 && m->mem[a + 1] == 0xB9) {
+                ft->digits = forthdict_word16(m, a + 2);
+            }
+        }
+        if (!ft->digits) ft->hold = 0;
+    }
+}
+
+//find the words in the TaliForth ROM loaded from rom up and run them
+//natively from now on. returns the number of words found
+int forthtrap_load(forthtrap_t *ft, machine_t *m, uint16_t rom) {
+    memset(ft, 0, sizeof(*ft));
+
+    uint16_t list = forthdict_list(m, rom);
+    if (!list) return 0;
+    forthtrap_data(ft, m, list);
+
+    for (uint32_t i = 0; i < FORTHTRAP_WORDS; i++) {
+        const forthtrap_word_t *w = &forthtrap_words[i];
+        uint16_t h, xt;
+        if ((w->needs & FORTHTRAP_NEED_BASE) && !ft->base) continue;
+        if ((w->needs & FORTHTRAP_NEED_HOLD) && !ft->hold) continue;
+        if ((w->needs & FORTHTRAP_NEED_ORDER) && !ft->up) continue;
+        if (!(h = forthdict_find(m, list, w->name, &xt))) continue;
+
+        ft->word[ft->count] = w;
+        ft->xt[ft->count] = xt;
+        ft->entry[ft->count] = forthdict_entry(m, h, xt);
+        ft->cycles[ft->count] = w->cycles;
+        ft->unit_cycles[ft->count] = w->unit_cycles;
+        ft->unit2_cycles[ft->count] = w->unit2_cycles;
+        machine_point(m, MACHINE_PAGE_NATIVE, ft->entry[ft->count], true);
+        ft->count++;
+    }
+    m->native = forthtrap_native;
+    m->native_state = ft;
+    return ft->count;
+}
+
+//charge cycles per call, unit_cycles per unit of work and unit2_cycles per
+//unit of the second kind for the word called name from now on, instead of
+//what the ROM code takes: false when it is not loaded
+bool forthtrap_cost(forthtrap_t *ft, const char *name, uint16_t cycles, uint16_t unit_cycles,
+                    uint16_t unit2_cycles) {
+    for (int i = 0; i < ft->count; i++) {
+        if (strcmp(ft->word[i]->name, name)) continue;
+        ft->cycles[i] = cycles;
+        ft->unit_cycles[i] = unit_cycles;
+        ft->unit2_cycles[i] = unit2_cycles;
+        return true;
+    }
+    return false;
+}
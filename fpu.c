@@ -0,0 +1,259 @@
+/* Floating point unit **********************************
+ * A stack of eight numbers, for firmware that would    *
+ * otherwise do its floating point in 6502 code.        *
+ * Numbers come in and go out as IEEE-754 single or     *
+ * double values in memory, or as 16-bit integers in a  *
+ * register, and are kept as doubles. Writing the       *
+ * command register runs a command; the unit is then    *
+ * busy for the cycles it takes, and any access but a   *
+ * read of the status holds the CPU until it is done,   *
+ * like a wait state. Include after machine.c.          *
+ *                                                      *
+ * Registers, from the window base:                     *
+ *   +0  address  low, high byte: where the load and    *
+ *                store commands read or write          *
+ *   +2  command  write: run one, FPU_* below           *
+ *   +3  status   bit 7 busy, bit 6 error: stack over-  *
+ *                or underflow, an integer out of       *
+ *                range, or a result that is not finite *
+ *                (a division by zero, the square root  *
+ *                or log of a negative number, an       *
+ *                overflow); kept until FPU_CLEAR. bit  *
+ *                5 the top is negative, bit 4 it is    *
+ *                zero, bits 0-3 the depth              *
+ *   +4  integer  low, high byte, signed: for           *
+ *                FPU_PUSH_INT and FPU_POP_INT          *
+ ********************************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+
+#define FPU_SLOT 3 //device window at $F0D0
+
+#define FPU_ADDRESS 0x0
+#define FPU_COMMAND 0x2
+#define FPU_STATUS  0x3
+#define FPU_INTEGER 0x4
+
+//commands; binary operations take the second from the top first, so
+//FPU_SUB leaves second - top
+#define FPU_CLEAR        0x00 //empty the stack, clear the error
+#define FPU_PUSH_INT     0x01 //push the integer register
+#define FPU_POP_INT      0x02 //pop into the integer register, rounded to zero
+#define FPU_LOAD_SINGLE  0x03 //push the single at address
+#define FPU_LOAD_DOUBLE  0x04 //push the double at address
+#define FPU_STORE_SINGLE 0x05 //pop to a single at address
+#define FPU_STORE_DOUBLE 0x06 //pop to a double at address
+#define FPU_DUP          0x07
+#define FPU_DROP         0x08
+#define FPU_SWAP         0x09
+#define FPU_ADD          0x10
+#define FPU_SUB          0x11
+#define FPU_MUL          0x12
+#define FPU_DIV          0x13
+#define FPU_NEG          0x14
+#define FPU_ABS          0x15
+#define FPU_SQRT         0x16
+#define FPU_SIN          0x17 //radians
+#define FPU_COS          0x18
+#define FPU_LOG          0x19 //natural
+#define FPU_EXP          0x1A
+#define FPU_COMMANDS     0x1B
+
+#define FPU_BUSY     0x80
+#define FPU_ERROR    0x40
+#define FPU_NEGATIVE 0x20
+#define FPU_ZERO     0x10
+
+#define FPU_DEPTH 8
+
+//cycles a command keeps the unit busy
+static const uint16_t fpu_latencies[FPU_COMMANDS] = {
+    [FPU_CLEAR] = 2, [FPU_PUSH_INT] = 10, [FPU_POP_INT] = 12,
+    [FPU_LOAD_SINGLE] = 10, [FPU_LOAD_DOUBLE] = 12, [FPU_STORE_SINGLE] = 12, [FPU_STORE_DOUBLE] = 14,
+    [FPU_DUP] = 2, [FPU_DROP] = 2, [FPU_SWAP] = 2,
+    [FPU_ADD] = 16, [FPU_SUB] = 16, [FPU_MUL] = 26, [FPU_DIV] = 40,
+    [FPU_NEG] = 2, [FPU_ABS] = 2, [FPU_SQRT] = 36,
+    [FPU_SIN] = 120, [FPU_COS] = 120, [FPU_LOG] = 100, [FPU_EXP] = 100,
+};
+
+typedef struct {
+    uint8_t reg[16];
+    double stack[FPU_DEPTH];
+    int depth;
+    bool error;
+    uint32_t ready;                 //clockticks6502 when the command is done
+    uint16_t latency[FPU_COMMANDS];
+    uint64_t commands;
+    uint64_t stalled;               //cycles the CPU waited on the unit
+} fpu_t;
+
+void fpu_init(fpu_t *f) {
+    memset(f, 0, sizeof(*f));
+    memcpy(f->latency, fpu_latencies, sizeof(f->latency));
+}
+
+//cycles command keeps the unit busy
+void fpu_latency(fpu_t *f, uint8_t command, uint16_t cycles) {
+    if (command < FPU_COMMANDS) f->latency[command] = cycles;
+}
+
+static uint16_t fpu_reg16(const fpu_t *f, uint8_t reg) {
+    return f->reg[reg] | (f->reg[reg + 1] << 8);
+}
+
+//size bytes at the address register, little endian
+static uint64_t fpu_load(const fpu_t *f, int size) {
+    uint16_t address = fpu_reg16(f, FPU_ADDRESS);
+    uint64_t value = 0;
+    for (int i = 0; i < size; i++) value |= (uint64_t)read6502(address + i) << (8 * i);
+    return value;
+}
+
+static void fpu_store(const fpu_t *f, uint64_t value, int size) {
+    uint16_t address = fpu_reg16(f, FPU_ADDRESS);
+    for (int i = 0; i < size; i++) write6502(address + i, value >> (8 * i));
+}
+
+static bool fpu_push(fpu_t *f, double value) {
+    if (f->depth == FPU_DEPTH) return false;
+    f->stack[f->depth++] = value;
+    return true;
+}
+
+//false when the result is infinite or not a number
+static bool fpu_unary(fpu_t *f, double (*op)(double)) {
+    if (f->depth < 1) return false;
+    f->stack[f->depth - 1] = op(f->stack[f->depth - 1]);
+    return isfinite(f->stack[f->depth - 1]);
+}
+
+static double fpu_neg(double value) {
+    return -value;
+}
+
+static bool fpu_run(fpu_t *f, uint8_t command) {
+    double *top = f->stack + (f->depth ? f->depth - 1 : 0);
+    int needs = 0;
+
+    switch (command) {
+        case FPU_POP_INT: case FPU_STORE_SINGLE: case FPU_STORE_DOUBLE: case FPU_DUP: case FPU_DROP:
+            needs = 1;
+            break;
+        case FPU_SWAP: case FPU_ADD: case FPU_SUB: case FPU_MUL: case FPU_DIV:
+            needs = 2;
+            break;
+    }
+    if (f->depth < needs) return false;
+
+    switch (command) {
+        case FPU_CLEAR:
+            f->depth = 0;
+            f->error = false;
+            return true;
+        case FPU_PUSH_INT:
+            return fpu_push(f, (int16_t)fpu_reg16(f, FPU_INTEGER));
+        case FPU_POP_INT: {
+            double value = trunc(f->stack[--f->depth]);
+            int16_t i = value < INT16_MIN ? INT16_MIN : value > INT16_MAX ? INT16_MAX : isnan(value) ? 0 : value;
+            f->reg[FPU_INTEGER] = (uint16_t)i & 0xFF;
+            f->reg[FPU_INTEGER + 1] = (uint16_t)i >> 8;
+            return value == i;
+        }
+        case FPU_LOAD_SINGLE: {
+            uint32_t bits = fpu_load(f, 4);
+            float value;
+            memcpy(&value, &bits, 4);
+            return fpu_push(f, value);
+        }
+        case FPU_LOAD_DOUBLE: {
+            uint64_t bits = fpu_load(f, 8);
+            double value;
+            memcpy(&value, &bits, 8);
+            return fpu_push(f, value);
+        }
+        case FPU_STORE_SINGLE: {
+            float value = f->stack[--f->depth];
+            uint32_t bits;
+            memcpy(&bits, &value, 4);
+            fpu_store(f, bits, 4);
+            return true;
+        }
+        case FPU_STORE_DOUBLE: {
+            uint64_t bits;
+            memcpy(&bits, &f->stack[--f->depth], 8);
+            fpu_store(f, bits, 8);
+            return true;
+        }
+        case FPU_DUP:
+            return fpu_push(f, *top);
+        case FPU_DROP:
+            f->depth--;
+            return true;
+        case FPU_SWAP: {
+            double value = top[0];
+            top[0] = top[-1];
+            top[-1] = value;
+            return true;
+        }
+        case FPU_ADD: top[-1] += top[0]; f->depth--; return isfinite(top[-1]);
+        case FPU_SUB: top[-1] -= top[0]; f->depth--; return isfinite(top[-1]);
+        case FPU_MUL: top[-1] *= top[0]; f->depth--; return isfinite(top[-1]);
+        case FPU_DIV: top[-1] /= top[0]; f->depth--; return isfinite(top[-1]);
+        case FPU_NEG:  return fpu_unary(f, fpu_neg);
+        case FPU_ABS:  return fpu_unary(f, fabs);
+        case FPU_SQRT: return fpu_unary(f, sqrt);
+        case FPU_SIN:  return fpu_unary(f, sin);
+        case FPU_COS:  return fpu_unary(f, cos);
+        case FPU_LOG:  return fpu_unary(f, log);
+        case FPU_EXP:  return fpu_unary(f, exp);
+    }
+    return false;
+}
+
+//hold the CPU until the last command is done
+static void fpu_wait(fpu_t *f) {
+    int32_t left = (int32_t)(f->ready - clockticks6502);
+    if (left > 0) {
+        clockticks6502 += left;
+        f->stalled += left;
+    }
+}
+
+static uint8_t fpu_read(machine_t *m, void *state, uint8_t reg) {
+    fpu_t *f = state;
+    (void)m;
+    if (reg == FPU_STATUS) {
+        uint8_t status = f->depth;
+        if ((int32_t)(f->ready - clockticks6502) > 0) status |= FPU_BUSY;
+        if (f->error) status |= FPU_ERROR;
+        if (f->depth && f->stack[f->depth - 1] < 0) status |= FPU_NEGATIVE;
+        if (f->depth && f->stack[f->depth - 1] == 0) status |= FPU_ZERO;
+        return status;
+    }
+    fpu_wait(f);
+    return f->reg[reg];
+}
+
+static void fpu_write(machine_t *m, void *state, uint8_t reg, uint8_t value) {
+    fpu_t *f = state;
+    (void)m;
+    fpu_wait(f);
+    if (reg != FPU_COMMAND) {
+        f->reg[reg] = value;
+        return;
+    }
+    if (value >= FPU_COMMANDS || !fpu_run(f, value)) {
+        f->error = true;
+        if (value >= FPU_COMMANDS) return;
+    }
+    f->commands++;
+    f->ready = clockticks6502 + f->latency[value];
+}
+
+//map the unit into its window of m
+void fpu_attach(machine_t *m, fpu_t *f) {
+    machine_attach(m, FPU_SLOT, (machine_dev_t){ fpu_read, fpu_write, f });
+}
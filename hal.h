@@ -0,0 +1,25 @@
+#pragma once
+/* Hardware abstraction layer ***************************
+ * Console, time and GPIO for 6502emu.c. hal_pico.c     *
+ * implements it with pico_stdlib on the RP2040 and     *
+ * hal_host.c with POSIX calls on Linux.                *
+ ********************************************************/
+
+#include <stdint.h>
+
+#define HAL_NO_CHAR -1 // nothing arrived before the timeout
+#define HAL_EOF     -2 // console input has ended, never on the Pico
+
+void hal_init(void);
+void hal_overclock(void);
+
+// Wait up to timeout_us for a console character
+int hal_getchar(uint32_t timeout_us);
+void hal_putchar(uint8_t c);
+
+uint64_t hal_time_us(void);
+void hal_sleep_ms(uint32_t ms);
+
+void hal_gpio_init(uint32_t mask);
+void hal_gpio_set_dirs(uint32_t dirs);
+void hal_gpio_put(uint32_t mask, uint32_t values);
@@ -0,0 +1,83 @@
+/* Linux implementation of hal.h. The console is stdin/stdout, switched to
+ * unbuffered, unechoed input when it is a terminal, and GPIO goes nowhere.
+ */
+
+#define _GNU_SOURCE // ppoll()
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <poll.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "hal.h"
+
+static struct termios saved_termios;
+static bool input_ended;
+
+static void restore_terminal(void) {
+    tcsetattr(STDIN_FILENO, TCSANOW, &saved_termios);
+}
+
+void hal_init(void) {
+    if (isatty(STDIN_FILENO) && tcgetattr(STDIN_FILENO, &saved_termios) == 0) {
+        struct termios raw = saved_termios;
+        raw.c_lflag &= ~(ICANON | ECHO);
+        tcsetattr(STDIN_FILENO, TCSANOW, &raw);
+        atexit(restore_terminal);
+    }
+}
+
+void hal_overclock(void) {
+}
+
+int hal_getchar(uint32_t timeout_us) {
+    struct pollfd pfd = { .fd = STDIN_FILENO, .events = POLLIN };
+    uint8_t c;
+
+    if (input_ended) {
+        return HAL_EOF;
+    }
+    if (poll(&pfd, 1, 0) <= 0) {
+        // nothing waiting: a good time to show what the 6502 printed
+        struct timespec ts = { timeout_us / 1000000, (timeout_us % 1000000) * 1000L };
+        fflush(stdout);
+        if (ppoll(&pfd, 1, &ts, NULL) <= 0) {
+            return HAL_NO_CHAR;
+        }
+    }
+    if (read(STDIN_FILENO, &c, 1) != 1) {
+        input_ended = true;
+        return HAL_EOF;
+    }
+    return c;
+}
+
+void hal_putchar(uint8_t c) {
+    putchar(c);
+}
+
+uint64_t hal_time_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+void hal_sleep_ms(uint32_t ms) {
+    struct timespec ts = { ms / 1000, (ms % 1000) * 1000000L };
+    nanosleep(&ts, NULL);
+}
+
+void hal_gpio_init(uint32_t mask) {
+    (void)mask;
+}
+
+void hal_gpio_set_dirs(uint32_t dirs) {
+    (void)dirs;
+}
+
+void hal_gpio_put(uint32_t mask, uint32_t values) {
+    (void)mask;
+    (void)values;
+}
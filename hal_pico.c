@@ -0,0 +1,50 @@
+/* pico_stdlib implementation of hal.h */
+
+#include <stdio.h>
+
+#include "pico/stdlib.h"
+#include "pico/time.h"
+#include "hardware/clocks.h"
+#include "hardware/vreg.h"
+#include "hal.h"
+
+void hal_init(void) {
+    stdio_init_all();
+}
+
+void hal_overclock(void) {
+    vreg_set_voltage(VREG_VOLTAGE_1_15);
+    set_sys_clock_khz(280000, true);
+}
+
+int hal_getchar(uint32_t timeout_us) {
+    int ch = getchar_timeout_us(timeout_us);
+    if (ch == PICO_ERROR_TIMEOUT) {
+        return HAL_NO_CHAR;
+    }
+    return ch & 0xFF;
+}
+
+void hal_putchar(uint8_t c) {
+    putchar(c);
+}
+
+uint64_t hal_time_us(void) {
+    return time_us_64();
+}
+
+void hal_sleep_ms(uint32_t ms) {
+    sleep_ms(ms);
+}
+
+void hal_gpio_init(uint32_t mask) {
+    gpio_init_mask(mask);
+}
+
+void hal_gpio_set_dirs(uint32_t dirs) {
+    gpio_set_dir_all_bits(dirs);
+}
+
+void hal_gpio_put(uint32_t mask, uint32_t values) {
+    gpio_put_masked(mask, values);
+}
@@ -0,0 +1,170 @@
+/* Host calls *******************************************
+ * Services for 65C02 code behind the reserved opcode   *
+ * $42: the byte after it picks one, which runs on the  *
+ * host with its arguments in A and in a block of zero  *
+ * page at X, and costs the 6502 a configurable number  *
+ * of cycles. A service clears the carry when it ran;   *
+ * an unknown one, or any while host calls are off (the *
+ * default), is a two-byte NOP that leaves it alone, so *
+ * SEC in front tells. Include after machine.c.         *
+ ********************************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#define HOSTCALL_COPY    0x00 //X+0 source, X+2 destination, X+4 length, overlaps allowed
+#define HOSTCALL_FILL    0x01 //X+0 destination, X+2 length, A the byte
+#define HOSTCALL_COMPARE 0x02 //X+0 first, X+2 second, X+4 length: A = 0, 1 or $FF, Z and N
+#define HOSTCALL_CRC16   0x03 //X+0 address, X+2 length, X+4 CRC-16/XMODEM, updated
+#define HOSTCALL_CRC32   0x04 //X+0 address, X+2 length, X+4 CRC-32 as zlib's crc32(), updated
+#define HOSTCALL_MUL32   0x05 //X+0 and X+4 factors: X+0 the 64-bit product
+#define HOSTCALL_DIV32   0x06 //X+0 dividend, X+4 divisor: X+0 quotient, X+4 remainder,
+                              //the carry set and the block left alone when dividing by 0
+#define HOSTCALL_SERVICES 7
+
+typedef struct {
+    const char *name;
+    uint16_t cycles;      //per call
+    uint16_t unit_cycles; //per byte of memory worked on
+} hostcall_service_t;
+
+//about what a 65C02 routine that does the same takes
+static const hostcall_service_t hostcall_services[HOSTCALL_SERVICES] = {
+    { "copy",    20,   16 },
+    { "fill",    20,   11 },
+    { "compare", 20,   16 },
+    { "crc16",   20,   30 },
+    { "crc32",   20,   50 },
+    { "mul32",   1200, 0 },
+    { "div32",   1500, 0 },
+};
+
+typedef struct hostcall {
+    uint16_t cycles[HOSTCALL_SERVICES];
+    uint16_t unit_cycles[HOSTCALL_SERVICES];
+    uint64_t calls[HOSTCALL_SERVICES];
+} hostcall_t;
+
+static uint16_t hostcall_arg16(int i) {
+    return read6502((uint8_t)(x + i)) | (read6502((uint8_t)(x + i + 1)) << 8);
+}
+
+static uint32_t hostcall_arg32(int i) {
+    return hostcall_arg16(i) | ((uint32_t)hostcall_arg16(i + 2) << 16);
+}
+
+static void hostcall_set16(int i, uint16_t value) {
+    write6502((uint8_t)(x + i), value & 0xFF);
+    write6502((uint8_t)(x + i + 1), value >> 8);
+}
+
+static void hostcall_set32(int i, uint32_t value) {
+    hostcall_set16(i, value & 0xFFFF);
+    hostcall_set16(i + 2, value >> 16);
+}
+
+//bytes compared up to the first difference, the result in A
+static uint32_t hostcall_compare(machine_t *m, uint16_t first, uint16_t second, uint16_t len) {
+    uint32_t i = machine_compare(m, first, second, len);
+    a = 0;
+    if (i < len) {
+        a = read6502(first + i) < read6502(second + i) ? 0xFF : 0x01;
+        i++;
+    }
+    zerocalc(a);
+    signcalc(a);
+    return i;
+}
+
+static uint16_t hostcall_crc16(uint16_t crc, uint16_t address, uint16_t len) {
+    for (uint32_t i = 0; i < len; i++) {
+        crc ^= read6502(address + i) << 8;
+        for (int bit = 0; bit < 8; bit++) {
+            crc = crc & 0x8000 ? (crc << 1) ^ 0x1021 : crc << 1;
+        }
+    }
+    return crc;
+}
+
+static uint32_t hostcall_crc32(uint32_t crc, uint16_t address, uint16_t len) {
+    crc = ~crc;
+    for (uint32_t i = 0; i < len; i++) {
+        crc ^= read6502(address + i);
+        for (int bit = 0; bit < 8; bit++) {
+            crc = crc & 1 ? (crc >> 1) ^ 0xEDB88320 : crc >> 1;
+        }
+    }
+    return ~crc;
+}
+
+//the hook of the core: run the service on the machine of this thread
+static uint32_t hostcall_run(uint8_t service) {
+    machine_t *m = machine;
+    hostcall_t *h = m->hostcall;
+    uint32_t units = 0;
+
+    if (!h || service >= HOSTCALL_SERVICES) return 0;
+    clearcarry();
+    switch (service) {
+        case HOSTCALL_COPY:
+            units = hostcall_arg16(4);
+            machine_copy(m, hostcall_arg16(0), hostcall_arg16(2), units);
+            break;
+        case HOSTCALL_FILL:
+            units = hostcall_arg16(2);
+            machine_fill(m, hostcall_arg16(0), units, a);
+            break;
+        case HOSTCALL_COMPARE:
+            units = hostcall_compare(m, hostcall_arg16(0), hostcall_arg16(2), hostcall_arg16(4));
+            break;
+        case HOSTCALL_CRC16:
+            units = hostcall_arg16(2);
+            hostcall_set16(4, hostcall_crc16(hostcall_arg16(4), hostcall_arg16(0), units));
+            break;
+        case HOSTCALL_CRC32:
+            units = hostcall_arg16(2);
+            hostcall_set32(4, hostcall_crc32(hostcall_arg32(4), hostcall_arg16(0), units));
+            break;
+        case HOSTCALL_MUL32: {
+            uint64_t product = (uint64_t)hostcall_arg32(0) * hostcall_arg32(4);
+            hostcall_set32(0, product & 0xFFFFFFFF);
+            hostcall_set32(4, product >> 32);
+            break;
+        }
+        case HOSTCALL_DIV32: {
+            uint32_t dividend = hostcall_arg32(0), divisor = hostcall_arg32(4);
+            if (!divisor) {
+                setcarry();
+                break;
+            }
+            hostcall_set32(0, dividend / divisor);
+            hostcall_set32(4, dividend % divisor);
+            break;
+        }
+    }
+    h->calls[service]++;
+    return h->cycles[service] + units * h->unit_cycles[service];
+}
+
+//the default cost of every service
+void hostcall_init(hostcall_t *h) {
+    memset(h, 0, sizeof(*h));
+    for (int i = 0; i < HOSTCALL_SERVICES; i++) {
+        h->cycles[i] = hostcall_services[i].cycles;
+        h->unit_cycles[i] = hostcall_services[i].unit_cycles;
+    }
+}
+
+//what a service costs the 6502: cycles per call and unit_cycles per byte
+void hostcall_cost(hostcall_t *h, uint8_t service, uint16_t cycles, uint16_t unit_cycles) {
+    if (service >= HOSTCALL_SERVICES) return;
+    h->cycles[service] = cycles;
+    h->unit_cycles[service] = unit_cycles;
+}
+
+//turn host calls on for m and the CPU of this thread; NULL turns them off
+void hostcall_enable(machine_t *m, hostcall_t *h) {
+    m->hostcall = h;
+    hookhostcall(h ? hostcall_run : NULL);
+}
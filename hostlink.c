@@ -0,0 +1,58 @@
+/* Host link ********************************************
+ * The other end of the emulator's console for host     *
+ * tools: the USB serial port of the Pico, or an        *
+ * emulator run as a child with its console on pipes.   *
+ ********************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <fcntl.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/types.h>
+
+//inline, so tools that never time anything build without warnings
+static inline double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+//the serial port at path
+static int open_device(const char *path) {
+    int fd = open(path, O_RDWR | O_NOCTTY);
+    struct termios t;
+    if (fd < 0) return -1;
+    if (tcgetattr(fd, &t) == 0) {
+        // raw, and XON/XOFF seen here rather than by the driver
+        cfmakeraw(&t);
+        t.c_iflag &= ~(IXON | IXOFF);
+        cfsetspeed(&t, B115200);
+        tcsetattr(fd, TCSANOW, &t);
+    }
+    return fd;
+}
+
+//run argv with in writing to its stdin and out reading its stdout
+static pid_t start_command(char **argv, int *in, int *out) {
+    int to[2], from[2];
+    if (pipe(to) || pipe(from)) return -1;
+    pid_t pid = fork();
+    if (pid == 0) {
+        dup2(to[0], STDIN_FILENO);
+        dup2(from[1], STDOUT_FILENO);
+        close(to[0]);
+        close(to[1]);
+        close(from[0]);
+        close(from[1]);
+        execvp(argv[0], argv);
+        perror(argv[0]);
+        _exit(127);
+    }
+    close(to[0]);
+    close(from[1]);
+    *in = to[1];
+    *out = from[0];
+    return pid;
+}
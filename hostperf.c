@@ -0,0 +1,104 @@
+/* Linux implementation of hostperf.h with perf_event_open(2). Each counter
+ * is opened on its own rather than as a group, so one the PMU lacks does not
+ * take the others down with it.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "hostperf.h"
+
+const char *hostperf_names[HOSTPERF_COUNTERS] = {
+    "cycles", "instructions", "branch_misses", "l1d_misses", "llc_misses"
+};
+
+#ifdef __linux__
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+
+static int fds[HOSTPERF_COUNTERS] = { -1, -1, -1, -1, -1 };
+
+static const struct {
+    uint32_t type;
+    uint64_t config;
+} events[HOSTPERF_COUNTERS] = {
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES },
+    { PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D |
+                          (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                          (PERF_COUNT_HW_CACHE_RESULT_MISS << 16) },
+    { PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_LL |
+                          (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                          (PERF_COUNT_HW_CACHE_RESULT_MISS << 16) },
+};
+
+int hostperf_open(void) {
+    int available = 0;
+
+    for (int i = 0; i < HOSTPERF_COUNTERS; i++) {
+        struct perf_event_attr attr;
+        memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = events[i].type;
+        attr.config = events[i].config;
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+        fds[i] = syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+        if (fds[i] >= 0) available++;
+    }
+    return available;
+}
+
+void hostperf_close(void) {
+    for (int i = 0; i < HOSTPERF_COUNTERS; i++) {
+        if (fds[i] >= 0) close(fds[i]);
+        fds[i] = -1;
+    }
+}
+
+void hostperf_start(void) {
+    for (int i = 0; i < HOSTPERF_COUNTERS; i++) {
+        if (fds[i] < 0) continue;
+        ioctl(fds[i], PERF_EVENT_IOC_RESET, 0);
+        ioctl(fds[i], PERF_EVENT_IOC_ENABLE, 0);
+    }
+}
+
+void hostperf_stop(hostperf_sample_t *s) {
+    for (int i = 0; i < HOSTPERF_COUNTERS; i++) {
+        uint64_t data[3]; // value, time enabled, time running
+
+        s->value[i] = 0;
+        s->valid[i] = false;
+        if (fds[i] < 0) continue;
+        ioctl(fds[i], PERF_EVENT_IOC_DISABLE, 0);
+        if (read(fds[i], data, sizeof(data)) != sizeof(data) || data[2] == 0) continue;
+
+        s->value[i] = data[2] < data[1] ? (uint64_t)((double)data[0] * data[1] / data[2]) : data[0];
+        s->valid[i] = true;
+    }
+}
+
+#else
+
+int hostperf_open(void) {
+    return 0;
+}
+
+void hostperf_close(void) {
+}
+
+void hostperf_start(void) {
+}
+
+void hostperf_stop(hostperf_sample_t *s) {
+    memset(s, 0, sizeof(*s));
+}
+
+#endif
@@ -0,0 +1,39 @@
+#pragma once
+/* Host performance counters ****************************
+ * Counts host CPU events around a stretch of emulation *
+ * with perf_event_open(2), so changes to the core can  *
+ * be judged on mispredicts and cache misses and not on *
+ * wall-clock time alone. Counters the kernel refuses   *
+ * (no PMU, a VM, perf_event_paranoid) read as missing  *
+ * and everything else keeps working. This lives in its *
+ * own translation unit because unistd.h clashes with   *
+ * brk() in 6502.c.                                     *
+ ********************************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+enum {
+    HOSTPERF_CYCLES,
+    HOSTPERF_INSTRUCTIONS,
+    HOSTPERF_BRANCH_MISSES,
+    HOSTPERF_L1D_MISSES,
+    HOSTPERF_LLC_MISSES,
+    HOSTPERF_COUNTERS
+};
+
+extern const char *hostperf_names[HOSTPERF_COUNTERS];
+
+typedef struct {
+    uint64_t value[HOSTPERF_COUNTERS];
+    bool valid[HOSTPERF_COUNTERS];
+} hostperf_sample_t;
+
+// Open the counters for this thread, user space only. Returns how many
+// are available; with none, hostperf_start()/hostperf_stop() do nothing
+int hostperf_open(void);
+void hostperf_close(void);
+
+void hostperf_start(void);
+// Values since hostperf_start(), scaled up if the kernel had to multiplex
+void hostperf_stop(hostperf_sample_t *s);
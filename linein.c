@@ -0,0 +1,335 @@
+/* Cooked line input ************************************
+ * A line discipline on the host: characters from the   *
+ * console are edited, echoed and kept in a history     *
+ * natively, and only whole lines go to the 6502. It    *
+ * reads the console through the getc and putc of the   *
+ * machine, and only while a line is wanted, so bytes   *
+ * at $F004 stay raw. A line is wanted by writing the   *
+ * command register of the device, which then writes it *
+ * to memory and shows it in the status, or, with       *
+ * linein_forth(), by TaliForth's ACCEPT, which then    *
+ * takes it in one native call instead of a KEY loop    *
+ * per character. Include after forthdict.c.            *
+ *                                                      *
+ * Keys: backspace or delete, ^U erases the line, ^W    *
+ * the word before the cursor, ^P or up and ^N or down  *
+ * go through the history. Return or newline ends the   *
+ * line, as does filling the buffer.                    *
+ *                                                      *
+ * Registers, from the window base:                     *
+ *   +0  address  low, high byte: where the line goes   *
+ *   +2  size     the most bytes it takes, 0 for 256    *
+ *   +3  command  write 1 to want a line, 0 to cancel   *
+ *       status   read: bit 7 a line is in, bit 0 one   *
+ *                is wanted. reading it while one is    *
+ *                wanted takes in what has been typed   *
+ *   +4  length   of the line, without its end          *
+ *   +5  mode     bit 0 echo, bit 1 echo the end of the *
+ *                line as CR LF; both set at the start  *
+ ********************************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#define LINEIN_SLOT 4 //device window at $F0E0
+
+#define LINEIN_ADDRESS 0x0
+#define LINEIN_SIZE    0x2
+#define LINEIN_COMMAND 0x3
+#define LINEIN_STATUS  0x3
+#define LINEIN_LENGTH  0x4
+#define LINEIN_MODE    0x5
+
+#define LINEIN_READY  0x80
+#define LINEIN_WANTED 0x01
+
+#define LINEIN_ECHO    0x01
+#define LINEIN_NEWLINE 0x02
+
+#define LINEIN_MAX     256
+#define LINEIN_HISTORY 16
+
+//cycles to take in a line: a call, and every byte written, as the DMA
+//engine steals them. a wait for one costs a poll of the console
+#define LINEIN_CYCLES      100
+#define LINEIN_BYTE_CYCLES 1
+#define LINEIN_POLL_CYCLES 20
+
+typedef struct {
+    uint8_t reg[16];
+
+    uint8_t line[LINEIN_MAX];   //being typed
+    int len;
+    bool done;                  //line holds a whole one
+    uint8_t escape;             //bytes of an ESC [ sequence seen
+
+    uint8_t history[LINEIN_HISTORY][LINEIN_MAX];
+    int history_len[LINEIN_HISTORY];
+    int histories;              //lines kept, the newest at histories - 1
+    int recall;                 //the one shown, histories for none
+
+    //ACCEPT of TaliForth, and the native routines that were there before
+    uint16_t accept;            //its native point, 0 when not trapped
+    uint8_t status, count;      //zero page of its history index and line length
+    uint8_t buffer, limit;      //of the buffer and its size
+    uint8_t pointer;            //of the history entry
+    uint16_t history_base;      //its history in memory, 128 bytes a line
+    bool (*native)(machine_t *m, uint16_t address);
+    void *native_state;
+
+    uint64_t lines;
+    uint64_t bytes;
+} linein_t;
+
+void linein_init(linein_t *l) {
+    memset(l, 0, sizeof(*l));
+    l->reg[LINEIN_MODE] = LINEIN_ECHO | LINEIN_NEWLINE;
+}
+
+static void linein_echo(machine_t *m, bool echo, const char *s, int len) {
+    if (!echo || !m->putc) return;
+    for (int i = 0; i < len; i++) m->putc(m, s[i]);
+}
+
+static void linein_erase(machine_t *m, linein_t *l, bool echo, int to) {
+    for (; l->len > to; l->len--) linein_echo(m, echo, "\b \b", 3);
+}
+
+static void linein_recall(machine_t *m, linein_t *l, bool echo, int recall) {
+    int first = l->histories > LINEIN_HISTORY ? l->histories - LINEIN_HISTORY : 0;
+    if (recall < first || recall > l->histories) return;
+    linein_erase(m, l, echo, 0);
+    l->recall = recall;
+    if (recall == l->histories) return;
+    const uint8_t *h = l->history[recall % LINEIN_HISTORY];
+    l->len = l->history_len[recall % LINEIN_HISTORY];
+    memcpy(l->line, h, l->len);
+    linein_echo(m, echo, (const char *)h, l->len);
+}
+
+static void linein_keep(linein_t *l) {
+    if (!l->len) return;
+    if (l->histories) {
+        int newest = (l->histories - 1) % LINEIN_HISTORY;
+        if (l->history_len[newest] == l->len && !memcmp(l->history[newest], l->line, l->len)) return;
+    }
+    memcpy(l->history[l->histories % LINEIN_HISTORY], l->line, l->len);
+    l->history_len[l->histories % LINEIN_HISTORY] = l->len;
+    l->histories++;
+}
+
+//one typed character into a line of at most limit bytes; eol is echoed
+//when return or newline ends it
+static void linein_key(machine_t *m, linein_t *l, uint8_t c, int limit, bool echo, const char *eol) {
+    if (l->escape == 1) {
+        l->escape = c == '[' ? 2 : 0;
+        return;
+    }
+    if (l->escape == 2) {
+        if (c >= '0' && c <= '9') return;
+        l->escape = 0;
+        if (c == 'A') linein_recall(m, l, echo, l->recall - 1);
+        if (c == 'B') linein_recall(m, l, echo, l->recall + 1);
+        return;
+    }
+    switch (c) {
+        case '\r': case '\n':
+            linein_echo(m, echo, eol, strlen(eol));
+            l->done = true;
+            return;
+        case 0x08: case 0x7F:
+            //as ACCEPT does, with a bell in front at the start of the line
+            if (!l->len) {
+                linein_echo(m, echo, "\a\b \b", 4);
+                return;
+            }
+            linein_erase(m, l, echo, l->len - 1);
+            return;
+        case 0x15: //^U
+            linein_erase(m, l, echo, 0);
+            return;
+        case 0x17: { //^W
+            int to = l->len;
+            while (to && l->line[to - 1] == ' ') to--;
+            while (to && l->line[to - 1] != ' ') to--;
+            linein_erase(m, l, echo, to);
+            return;
+        }
+        case 0x10: //^P
+            linein_recall(m, l, echo, l->recall - 1);
+            return;
+        case 0x0E: //^N
+            linein_recall(m, l, echo, l->recall + 1);
+            return;
+        case 0x1B:
+            l->escape = 1;
+            return;
+    }
+    l->line[l->len++] = c;
+    linein_echo(m, echo, (const char *)&c, 1);
+    if (l->len >= limit) l->done = true;
+}
+
+//take in what has been typed: true once a whole line is in
+static bool linein_edit(machine_t *m, linein_t *l, int limit, bool echo, const char *eol) {
+    int c;
+    //what is left of a line typed for a bigger buffer
+    if (l->len >= limit) {
+        l->len = limit;
+        l->done = true;
+    }
+    while (!l->done && m->getc && (c = m->getc(m)) >= 0) linein_key(m, l, c, limit, echo, eol);
+    return l->done;
+}
+
+//the line has been handed over: start the next
+static void linein_next(linein_t *l) {
+    linein_keep(l);
+    l->lines++;
+    l->bytes += l->len;
+    l->len = 0;
+    l->done = false;
+    l->recall = l->histories;
+}
+
+static void linein_store(machine_t *m, uint16_t address, const uint8_t *data, int len) {
+    if (machine_plain(m, address, len, MACHINE_PAGE_WWATCH)) {
+        memcpy(m->mem + address, data, len);
+        return;
+    }
+    for (int i = 0; i < len; i++) write6502(address + i, data[i]);
+}
+
+static uint8_t linein_read(machine_t *m, void *state, uint8_t reg) {
+    linein_t *l = state;
+    if (reg != LINEIN_STATUS || !(l->reg[LINEIN_STATUS] & LINEIN_WANTED)) return l->reg[reg];
+
+    int size = l->reg[LINEIN_SIZE] ? l->reg[LINEIN_SIZE] : LINEIN_MAX;
+    uint8_t mode = l->reg[LINEIN_MODE];
+    if (!linein_edit(m, l, size, mode & LINEIN_ECHO, mode & LINEIN_NEWLINE ? "\r\n" : "")) {
+        return l->reg[LINEIN_STATUS];
+    }
+    linein_store(m, l->reg[LINEIN_ADDRESS] | (l->reg[LINEIN_ADDRESS + 1] << 8), l->line, l->len);
+    clockticks6502 += LINEIN_CYCLES + l->len * LINEIN_BYTE_CYCLES;
+    l->reg[LINEIN_LENGTH] = l->len;
+    l->reg[LINEIN_STATUS] = LINEIN_READY;
+    linein_next(l);
+    return l->reg[LINEIN_STATUS];
+}
+
+static void linein_write(machine_t *m, void *state, uint8_t reg, uint8_t value) {
+    linein_t *l = state;
+    (void)m;
+    if (reg == LINEIN_COMMAND) {
+        l->reg[LINEIN_STATUS] = value == 1 ? LINEIN_WANTED : 0;
+        return;
+    }
+    if (reg != LINEIN_LENGTH) l->reg[reg] = value;
+}
+
+//map the device into its window of m
+void linein_attach(machine_t *m, linein_t *l) {
+    machine_attach(m, LINEIN_SLOT, (machine_dev_t){ linein_read, linein_write, l });
+}
+
+/* TaliForth ********************************************/
+
+// ( addr n -- n ), with what the ROM leaves behind: its zero page, the
+// line in its history and the history index moved on
+static bool linein_accept(machine_t *m, linein_t *l, uint16_t address) {
+    uint16_t n = forthdict_word16(m, (uint8_t)x), buffer = forthdict_word16(m, (uint8_t)(x + 2));
+    //the ROM counts in the low byte of n only
+    int limit = n & 0xFF;
+    uint8_t status = ((m->mem[l->status] & 0xF7) + 1) | 0x08;
+    uint16_t entry = l->history_base + (status & 0x07) * 128;
+    if (!limit || !machine_plain(m, 0, 0x200, MACHINE_PAGE_RWATCH | MACHINE_PAGE_WWATCH) ||
+        !machine_plain(m, buffer, limit, MACHINE_PAGE_RWATCH | MACHINE_PAGE_WWATCH) ||
+        !machine_plain(m, entry, 128, MACHINE_PAGE_WWATCH)) return false;
+
+    if (!linein_edit(m, l, limit, true, " ")) {
+        //come back to the same point after a poll, as KEY would
+        pc = address;
+        clockticks6502 += LINEIN_POLL_CYCLES;
+        return true;
+    }
+    memcpy(m->mem + buffer, l->line, l->len);
+    x += 2;
+    m->mem[(uint8_t)x] = l->len;
+    m->mem[(uint8_t)(x + 1)] = 0;
+
+    int kept = l->len < 0x80 ? l->len : 0x7F;
+    m->mem[entry] = kept;
+    memcpy(m->mem + entry + 1, l->line, kept);
+    m->mem[l->status] = status;
+    m->mem[l->count] = kept;
+    m->mem[l->buffer] = buffer & 0xFF;
+    m->mem[(uint8_t)(l->buffer + 1)] = buffer >> 8;
+    m->mem[l->limit] = limit;
+    m->mem[(uint8_t)(l->limit + 1)] = 0;
+    m->mem[l->pointer] = (entry + 1) & 0xFF;
+    m->mem[(uint8_t)(l->pointer + 1)] = (entry + 1) >> 8;
+
+    pc = forthdict_word16(m, BASE_STACK + (uint8_t)(sp + 1)) + 1;
+    sp += 2;
+    clockticks6502 += LINEIN_CYCLES + l->len * LINEIN_BYTE_CYCLES;
+    linein_next(l);
+    return true;
+}
+
+static bool linein_native(machine_t *m, uint16_t address) {
+    linein_t *l = m->native_state;
+    if (address == l->accept) return linein_accept(m, l, address);
+    if (!l->native) return false;
+    m->native_state = l->native_state;
+    bool done = l->native(m, address);
+    m->native_state = l;
+    return done;
+}
+
+//have ACCEPT of the TaliForth ROM loaded from rom up take whole lines from
+//l. the zero page and history it uses are found in its code, so it follows
+//the build. native routines already set up, such as those of forthtrap.c,
+//keep working. false when ACCEPT is not as expected
+bool linein_forth(machine_t *m, linein_t *l, uint16_t rom) {
+    uint16_t list = forthdict_list(m, rom), h, xt;
+    if (!list || !(h = forthdict_find(m, list, "accept", &xt))) return false;
+    uint16_t entry = forthdict_entry(m, h, xt);
+    uint16_t z = forthdict_word16(m, h + FORTH_HDR_Z);
+    const uint8_t *c = m->mem + entry;
+
+    //lda 0,x ora 1,x bne +9 ... lda 0,x sta limit stz limit+1 lda 2,x sta
+    //buffer lda 3,x sta buffer+1 inx inx ldy #0 lda status and #$F7 inc a
+    //ora #8 sta status
+    if (c[0] != 0xB5 || c[2] != 0x15 || c[4] != 0xD0 || c[15] != 0xB5 || c[17] != 0x85 ||
+        c[19] != 0x64 || c[20] != (uint8_t)(c[18] + 1) || c[23] != 0x85 || c[27] != 0x85 ||
+        c[28] != (uint8_t)(c[24] + 1) || c[33] != 0xA5 || c[35] != 0x29 || c[36] != 0xF7 ||
+        c[37] != 0x1A || c[40] != 0x85 || c[41] != c[34]) return false;
+
+    //at the end: jsr history sta count ldy #0 sta (pointer),y, and the
+    //history routine opens with lda #<base sta pointer lda #>base sta pointer+1
+    uint16_t history = 0;
+    for (uint32_t a = entry; a + 9 <= z; a++) {
+        const uint8_t *e = m->mem + a;
+        if (e[0] == 0x20 && e[3] == 0x85 && e[5] == 0xA0 && e[6] == 0x00 && e[7] == 0x91) {
+            history = forthdict_word16(m, a + 1);
+            l->count = e[4];
+            l->pointer = e[8];
+        }
+    }
+    c = m->mem + history;
+    if (!history || c[0] != 0xA9 || c[2] != 0x85 || c[3] != l->pointer || c[4] != 0xA9 ||
+        c[6] != 0x85 || c[7] != (uint8_t)(l->pointer + 1)) return false;
+
+    l->history_base = c[1] | (c[5] << 8);
+    l->status = m->mem[entry + 34];
+    l->limit = m->mem[entry + 18];
+    l->buffer = m->mem[entry + 24];
+    l->accept = entry;
+    l->native = m->native;
+    l->native_state = m->native_state;
+    machine_point(m, MACHINE_PAGE_NATIVE, entry, true);
+    m->native = linein_native;
+    m->native_state = l;
+    return true;
+}
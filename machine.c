@@ -0,0 +1,400 @@
+/* Machine model ****************************************
+ * 64K of RAM, the console ports at $F001/$F004, a 6522 *
+ * VIA, optional devices in 16-byte windows from $F0A0  *
+ * and an optional window of memory shared with other   *
+ * machines, behind the read6502()/write6502() bus the  *
+ * CPU core expects. Include after 6502.c and 6522.h.   *
+ ********************************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MACHINE_CONSOLE_OUT 0xF001
+#define MACHINE_CONSOLE_IN  0xF004
+#define MACHINE_VIA_BASE    0xFF90
+//device windows, free in the TaliForth ROM between its kernel and the vectors
+#define MACHINE_DEV_BASE    0xF0A0
+#define MACHINE_DEV_SLOTS   6
+
+#define MACHINE_RAW 0x01 //no I/O decoding, the whole 64K is RAM (Klaus test images)
+
+//page flags, accesses to pages without flags go straight to mem
+#define MACHINE_PAGE_IO     0x01 //console, device windows or VIA
+#define MACHINE_PAGE_SHARED 0x02 //part of the shared window
+#define MACHINE_PAGE_BREAK  0x04 //has execution breakpoints
+#define MACHINE_PAGE_RWATCH 0x08 //has read watchpoints
+#define MACHINE_PAGE_WWATCH 0x10 //has write watchpoints
+#define MACHINE_PAGE_NATIVE 0x20 //has routines the host runs natively
+
+//breakpoints, watchpoints and native routines are the page flags above,
+//one bitmap each
+#define MACHINE_POINT_KINDS 4
+#define MACHINE_POINT_BITMAP 0x2000
+
+typedef struct machine machine_t;
+
+//a memory-mapped device, reg is the offset within its 16-byte window
+typedef struct {
+    uint8_t (*read)(machine_t *m, void *state, uint8_t reg);
+    void (*write)(machine_t *m, void *state, uint8_t reg, uint8_t value);
+    void *state;
+} machine_dev_t;
+
+struct machine {
+    uint8_t mem[0x10000];
+    uint8_t page[0x100];
+    uint8_t flags;
+
+    m6522_t via;
+    uint64_t via_pins;
+    uint32_t old_ticks;
+
+    //console, getc returns -1 when no character is waiting
+    int (*getc)(machine_t *m);
+    void (*putc)(machine_t *m, uint8_t c);
+    void *user;
+
+    //called after every write to a VIA register, e.g. to mirror the ports on GPIO pins
+    void (*via_write)(machine_t *m, uint8_t reg, uint8_t value);
+
+    machine_dev_t dev[MACHINE_DEV_SLOTS];
+
+    //shared_size bytes from shared_base live in shared instead of mem
+    uint8_t *shared;
+    uint16_t shared_base, shared_size;
+
+    //a bit per address for each point kind, allocated with the first point.
+    //hit is the kind and hit_address the address of the last one hit
+    uint8_t *points;
+    uint8_t hit;
+    uint16_t hit_address;
+    uint64_t hit_instructions;
+
+    //runs the routine at a MACHINE_PAGE_NATIVE point on the host: true when
+    //it did, as if the 6502 had run it up to its RTS, false to run the code
+    bool (*native)(machine_t *m, uint16_t address);
+    void *native_state;
+
+    //the host call services of hostcall.c, NULL when they are off
+    void *hostcall;
+};
+
+//the machine the CPU on this thread is currently wired to
+M6502_TLS machine_t *machine;
+
+void machine_init(machine_t *m, uint8_t flags) {
+    memset(m->mem, 0, sizeof(m->mem));
+    memset(m->page, 0, sizeof(m->page));
+    if (!(flags & MACHINE_RAW)) {
+        m->page[MACHINE_CONSOLE_IN >> 8] |= MACHINE_PAGE_IO;
+        m->page[MACHINE_DEV_BASE >> 8] |= MACHINE_PAGE_IO;
+        m->page[MACHINE_VIA_BASE >> 8] |= MACHINE_PAGE_IO;
+    }
+    m->flags = flags;
+    m6522_init(&m->via);
+    m6522_reset(&m->via);
+    m->via_pins = 0;
+    m->old_ticks = 0;
+    m->getc = NULL;
+    m->putc = NULL;
+    m->user = NULL;
+    m->via_write = NULL;
+    memset(m->dev, 0, sizeof(m->dev));
+    m->shared = NULL;
+    m->shared_base = 0;
+    m->shared_size = 0;
+    m->points = NULL;
+    m->hit = 0;
+    m->native = NULL;
+    m->native_state = NULL;
+    m->hostcall = NULL;
+}
+
+//map a device into window slot (0 at $F0A0, 1 at $F0B0, ...)
+void machine_attach(machine_t *m, int slot, machine_dev_t dev) {
+    m->dev[slot] = dev;
+}
+
+//map size bytes at base to memory shared with other machines. the bus does
+//no locking, machines synchronise through a device such as the mailbox.
+//base and size must be multiples of 256
+void machine_share(machine_t *m, uint16_t base, uint16_t size, uint8_t *shared) {
+    m->shared = shared;
+    m->shared_base = base;
+    m->shared_size = size;
+    for (uint32_t p = base >> 8; p < (uint32_t)(base + size) >> 8; p++) {
+        m->page[p] |= MACHINE_PAGE_SHARED;
+    }
+}
+
+static int machine_point_index(uint8_t kind) {
+    return kind == MACHINE_PAGE_BREAK ? 0 : kind == MACHINE_PAGE_RWATCH ? 1 :
+           kind == MACHINE_PAGE_WWATCH ? 2 : 3;
+}
+
+static bool machine_point_at(machine_t *m, uint8_t kind, uint16_t address) {
+    const uint8_t *bits = m->points + machine_point_index(kind) * MACHINE_POINT_BITMAP;
+    return bits[address >> 3] & (1 << (address & 7));
+}
+
+//set or clear a breakpoint (MACHINE_PAGE_BREAK), a read or write
+//watchpoint (MACHINE_PAGE_RWATCH, MACHINE_PAGE_WWATCH) or the entry of a
+//native routine (MACHINE_PAGE_NATIVE) at address. only pages that hold
+//one leave the fast path of the bus
+void machine_point(machine_t *m, uint8_t kind, uint16_t address, bool on) {
+    if (!m->points) {
+        if (!on) return;
+        m->points = calloc(MACHINE_POINT_KINDS, MACHINE_POINT_BITMAP);
+    }
+    uint8_t *bits = m->points + machine_point_index(kind) * MACHINE_POINT_BITMAP;
+    if (on) {
+        bits[address >> 3] |= 1 << (address & 7);
+        m->page[address >> 8] |= kind;
+        return;
+    }
+    bits[address >> 3] &= ~(1 << (address & 7));
+    const uint8_t *page = bits + ((address & 0xFF00) >> 3);
+    for (int i = 0; i < 0x100 >> 3; i++) {
+        if (page[i]) return;
+    }
+    m->page[address >> 8] &= ~kind;
+}
+
+//remove every breakpoint, watchpoint and native routine and free their bitmaps
+void machine_clear_points(machine_t *m) {
+    for (int p = 0; p < 0x100; p++) {
+        m->page[p] &= ~(MACHINE_PAGE_BREAK | MACHINE_PAGE_RWATCH | MACHINE_PAGE_WWATCH | MACHINE_PAGE_NATIVE);
+    }
+    free(m->points);
+    m->points = NULL;
+    m->hit = 0;
+}
+
+//true when none of the len bytes from address sits behind a device, the
+//shared window or a watchpoint of kind (MACHINE_PAGE_RWATCH or
+//MACHINE_PAGE_WWATCH), so that mem[] can stand in for the bus. the range
+//may not wrap around the end of memory
+bool machine_plain(const machine_t *m, uint16_t address, uint32_t len, uint8_t kind) {
+    if (!len) return true;
+    if (address + len > 0x10000) return false;
+    for (uint32_t p = address >> 8; p <= (address + len - 1) >> 8; p++) {
+        if (m->page[p] & (MACHINE_PAGE_IO | MACHINE_PAGE_SHARED | kind)) return false;
+    }
+    return true;
+}
+
+static void machine_watch(machine_t *m, uint8_t kind, uint16_t address) {
+    if (!machine_point_at(m, kind, address)) return;
+    m->hit = kind;
+    m->hit_address = address;
+    halt6502(STOP6502_WATCH);
+}
+
+void machine_load(machine_t *m, uint16_t start, const uint8_t *data, uint32_t size) {
+    if (start + size > 0x10000) size = 0x10000 - start;
+    memcpy(m->mem + start, data, size);
+}
+
+//wire the CPU on this thread to m and reset both
+void machine_reset(machine_t *m) {
+    machine = m;
+    m6522_reset(&m->via);
+    m->via_pins = 0;
+    m->old_ticks = 0;
+
+    clockticks6502 = 0;
+    clockgoal6502 = 0;
+    instructions = 0;
+    m->hit = 0;
+    status = FLAG_CONSTANT;
+    reset6502();
+}
+
+static void machine_via_update(machine_t *m) {
+    if ((uint32_t)(m->via_pins & 0XFFFFFFFF) & (uint32_t)(M6522_IRQ & 0XFFFFFFFF)) {
+        irq6502();
+    }
+}
+
+static uint8_t machine_read_io(machine_t *m, uint16_t address) {
+    if (address == MACHINE_CONSOLE_IN) {
+        int ch = m->getc ? m->getc(m) : -1;
+        if (ch < 0) {
+            return 0;
+        }
+        return (uint8_t)ch;
+    } else if ((address & 0xFFF0) == MACHINE_VIA_BASE) {
+        m->via_pins &= ~(M6522_RS_PINS | M6522_CS2);
+        m->via_pins |= (M6522_RW | M6522_CS1 | ((uint16_t)M6522_RS_PINS & address));
+        m->via_pins = m6522_tick(&m->via, m->via_pins);
+        uint8_t vdata = M6522_GET_DATA(m->via_pins);
+        machine_via_update(m);
+        return vdata;
+    } else if ((uint16_t)(address - MACHINE_DEV_BASE) < MACHINE_DEV_SLOTS * 16) {
+        machine_dev_t *dev = &m->dev[(address - MACHINE_DEV_BASE) >> 4];
+        if (dev->read) return dev->read(m, dev->state, address & 0x0F);
+    } else if ((uint16_t)(address - m->shared_base) < m->shared_size) {
+        return m->shared[address - m->shared_base];
+    }
+    return m->mem[address];
+}
+
+static void machine_write_io(machine_t *m, uint16_t address, uint8_t value) {
+    if (address == MACHINE_CONSOLE_OUT) {
+        if (m->putc) m->putc(m, value);
+        return;
+    } else if ((address & 0xFFF0) == MACHINE_VIA_BASE) {
+        m->via_pins &= ~(M6522_RW | M6522_RS_PINS | M6522_CS2);
+        m->via_pins |= (M6522_CS1 | ((uint16_t)M6522_RS_PINS & address));
+        M6522_SET_DATA(m->via_pins, value);
+        if (m->via_write) m->via_write(m, address & M6522_RS_PINS, value);
+        m->via_pins = m6522_tick(&m->via, m->via_pins);
+        machine_via_update(m);
+        return;
+    } else if ((uint16_t)(address - MACHINE_DEV_BASE) < MACHINE_DEV_SLOTS * 16) {
+        machine_dev_t *dev = &m->dev[(address - MACHINE_DEV_BASE) >> 4];
+        if (dev->write) dev->write(m, dev->state, address & 0x0F, value);
+        return;
+    } else if ((uint16_t)(address - m->shared_base) < m->shared_size) {
+        m->shared[address - m->shared_base] = value;
+        return;
+    }
+    m->mem[address] = value;
+}
+
+uint8_t read6502(uint16_t address) {
+    machine_t *m = machine;
+    uint8_t flags = m->page[address >> 8];
+
+    if (flags) {
+        if (flags & MACHINE_PAGE_RWATCH) machine_watch(m, MACHINE_PAGE_RWATCH, address);
+        if (flags & (MACHINE_PAGE_IO | MACHINE_PAGE_SHARED)) return machine_read_io(m, address);
+    }
+    return m->mem[address];
+}
+
+void write6502(uint16_t address, uint8_t value) {
+    machine_t *m = machine;
+    uint8_t flags = m->page[address >> 8];
+
+    if (flags) {
+        if (flags & MACHINE_PAGE_WWATCH) machine_watch(m, MACHINE_PAGE_WWATCH, address);
+        if (flags & (MACHINE_PAGE_IO | MACHINE_PAGE_SHARED)) {
+            machine_write_io(m, address, value);
+            return;
+        }
+    }
+    m->mem[address] = value;
+}
+
+//block operations for devices and host services, with the effect of the
+//single accesses through the bus but mem[] used directly where that is
+//plain RAM. m is the machine of the CPU on this thread
+
+//copy len bytes as memmove() would
+void machine_copy(machine_t *m, uint16_t from, uint16_t to, uint32_t len) {
+    if (machine_plain(m, from, len, MACHINE_PAGE_RWATCH) && machine_plain(m, to, len, MACHINE_PAGE_WWATCH)) {
+        memmove(m->mem + to, m->mem + from, len);
+        return;
+    }
+    if ((uint16_t)(to - from) < len) {
+        for (uint32_t i = len; i-- > 0;) write6502(to + i, read6502(from + i));
+    } else {
+        for (uint32_t i = 0; i < len; i++) write6502(to + i, read6502(from + i));
+    }
+}
+
+void machine_fill(machine_t *m, uint16_t to, uint32_t len, uint8_t value) {
+    if (machine_plain(m, to, len, MACHINE_PAGE_WWATCH)) {
+        memset(m->mem + to, value, len);
+        return;
+    }
+    for (uint32_t i = 0; i < len; i++) write6502(to + i, value);
+}
+
+//the offset of the first difference in len bytes, or len
+uint32_t machine_compare(machine_t *m, uint16_t first, uint16_t second, uint32_t len) {
+    uint32_t i = 0;
+    if (machine_plain(m, first, len, MACHINE_PAGE_RWATCH) && machine_plain(m, second, len, MACHINE_PAGE_RWATCH)) {
+        while (i < len && m->mem[first + i] == m->mem[second + i]) i++;
+        return i;
+    }
+    while (i < len && read6502(first + i) == read6502(second + i)) i++;
+    return i;
+}
+
+//a breakpoint stops the CPU in front of the instruction; when execution
+//resumes without an instruction in between, the same one lets it run.
+//a native routine that the host ran is not fetched at all
+uint16_t fetch6502(uint16_t address) {
+    machine_t *m = machine;
+    uint8_t flags = m->page[address >> 8];
+
+    if (flags) {
+        if ((flags & MACHINE_PAGE_BREAK) && machine_point_at(m, MACHINE_PAGE_BREAK, address)) {
+            bool resumed = m->hit == MACHINE_PAGE_BREAK && m->hit_address == address &&
+                           m->hit_instructions == instructions;
+            if (!resumed) {
+                m->hit = MACHINE_PAGE_BREAK;
+                m->hit_address = address;
+                m->hit_instructions = instructions;
+                return OPDESC_STOP;
+            }
+            m->hit = 0;
+        }
+        if ((flags & MACHINE_PAGE_NATIVE) && machine_point_at(m, MACHINE_PAGE_NATIVE, address) &&
+            m->native(m, address)) {
+            return OPDESC_NATIVE;
+        }
+        if (flags & (MACHINE_PAGE_IO | MACHINE_PAGE_SHARED)) return machine_read_io(m, address);
+    }
+    return m->mem[address];
+}
+
+//console fed from a script, with the output collected in a growing buffer.
+//idle counts the reads made after the script ran out
+typedef struct {
+    const char *in;
+    size_t in_len, in_pos;
+    uint32_t idle;
+    char *out;
+    size_t out_len, out_cap;
+} script_console_t;
+
+static int script_getc(machine_t *m) {
+    script_console_t *c = m->user;
+    if (c->in_pos < c->in_len) {
+        return (uint8_t)c->in[c->in_pos++];
+    }
+    c->idle++;
+    return -1;
+}
+
+static void script_putc(machine_t *m, uint8_t ch) {
+    script_console_t *c = m->user;
+    if (c->out_len == c->out_cap) {
+        c->out_cap = c->out_cap ? c->out_cap * 2 : 4096;
+        c->out = realloc(c->out, c->out_cap);
+    }
+    c->out[c->out_len++] = ch;
+}
+
+void machine_script(machine_t *m, script_console_t *c, const char *in, size_t len) {
+    *c = (script_console_t){ .in = in, .in_len = len };
+    m->getc = script_getc;
+    m->putc = script_putc;
+    m->user = c;
+}
+
+//per-instruction hook: clock the VIA for the cycles the last instruction took
+void machine_tick() {
+    machine_t *m = machine;
+
+    for (uint32_t i = 0; i < clockticks6502 - m->old_ticks; i++) {
+        m->via_pins = m6522_tick(&m->via, m->via_pins);
+    }
+    machine_via_update(m);
+    m->old_ticks = clockticks6502;
+}
@@ -0,0 +1,111 @@
+/* Mailbox device ***************************************
+ * Connects two machines that run on separate threads   *
+ * (or cores) and share a window of memory. Each CPU    *
+ * has a one-byte inbox and eight semaphores are shared *
+ * between them. Sending, receiving and the semaphores  *
+ * are the synchronisation points: a send or a release  *
+ * publishes every earlier write to the shared window,  *
+ * a receive or an acquire makes them visible, and      *
+ * plain accesses to the window need no locking.        *
+ * Include after machine.c.                             *
+ *                                                      *
+ * Registers, from the window base:                     *
+ *   +0  status   bit 7 a message is waiting for me     *
+ *                bit 6 the peer has taken my last one  *
+ *   +1  data     read: take the waiting message        *
+ *                write: send a message to the peer,    *
+ *                ignored while it has not taken the    *
+ *                previous one                          *
+ *   +2  cpu      0 or 1, which CPU is reading          *
+ *   +8  sem 0..7 read: try to acquire, $80 when this   *
+ *   ..+15        read got it, 0 when it is held        *
+ *                write: release                        *
+ ********************************************************/
+
+#include <stdint.h>
+#include <stdatomic.h>
+
+#define MAILBOX_SLOT 0 //device window at $F0A0
+
+#define MAILBOX_STATUS 0x0
+#define MAILBOX_DATA   0x1
+#define MAILBOX_CPU    0x2
+#define MAILBOX_SEM    0x8
+
+#define MAILBOX_SEMAPHORES 8
+
+//shared memory window, below TaliForth's buffers at the top of RAM
+#define MAILBOX_SHARED_BASE 0x6000
+#define MAILBOX_SHARED_SIZE 0x1000
+
+typedef struct {
+    _Atomic uint8_t full[2]; //inbox of CPU n holds a message
+    uint8_t msg[2];
+    _Atomic uint8_t sem[MAILBOX_SEMAPHORES];
+    uint8_t shared[MAILBOX_SHARED_SIZE];
+} mailbox_t;
+
+//one CPU's side of the mailbox
+typedef struct {
+    mailbox_t *box;
+    uint8_t cpu;
+} mailbox_port_t;
+
+void mailbox_init(mailbox_t *box) {
+    for (int i = 0; i < 2; i++) {
+        atomic_store(&box->full[i], 0);
+        box->msg[i] = 0;
+    }
+    for (int i = 0; i < MAILBOX_SEMAPHORES; i++) {
+        atomic_store(&box->sem[i], 0);
+    }
+    memset(box->shared, 0, sizeof(box->shared));
+}
+
+static uint8_t mailbox_read(machine_t *m, void *state, uint8_t reg) {
+    mailbox_port_t *port = state;
+    mailbox_t *box = port->box;
+    uint8_t me = port->cpu, peer = port->cpu ^ 1;
+    (void)m;
+
+    if (reg >= MAILBOX_SEM) {
+        uint8_t held = atomic_exchange_explicit(&box->sem[reg - MAILBOX_SEM], 1, memory_order_acquire);
+        return held ? 0 : 0x80;
+    }
+
+    switch (reg) {
+        case MAILBOX_STATUS:
+            return (atomic_load_explicit(&box->full[me], memory_order_relaxed) ? 0x80 : 0) |
+                   (atomic_load_explicit(&box->full[peer], memory_order_relaxed) ? 0 : 0x40);
+        case MAILBOX_DATA: {
+            if (!atomic_load_explicit(&box->full[me], memory_order_acquire)) return 0;
+            uint8_t msg = box->msg[me];
+            atomic_store_explicit(&box->full[me], 0, memory_order_release);
+            return msg;
+        }
+        case MAILBOX_CPU:
+            return me;
+    }
+    return 0;
+}
+
+static void mailbox_write(machine_t *m, void *state, uint8_t reg, uint8_t value) {
+    mailbox_port_t *port = state;
+    mailbox_t *box = port->box;
+    uint8_t peer = port->cpu ^ 1;
+    (void)m;
+
+    if (reg >= MAILBOX_SEM) {
+        atomic_store_explicit(&box->sem[reg - MAILBOX_SEM], 0, memory_order_release);
+    } else if (reg == MAILBOX_DATA) {
+        if (atomic_load_explicit(&box->full[peer], memory_order_acquire)) return;
+        box->msg[peer] = value;
+        atomic_store_explicit(&box->full[peer], 1, memory_order_release);
+    }
+}
+
+//wire machine m up as CPU port->cpu of the mailbox, with the shared window
+void mailbox_attach(machine_t *m, mailbox_port_t *port) {
+    machine_attach(m, MAILBOX_SLOT, (machine_dev_t){ mailbox_read, mailbox_write, port });
+    machine_share(m, MAILBOX_SHARED_BASE, MAILBOX_SHARED_SIZE, port->box->shared);
+}
@@ -0,0 +1,208 @@
+/* Math coprocessor *************************************
+ * Integer multiply and divide, which the 6502 does in  *
+ * shift and add loops of hundreds of cycles. Writing   *
+ * the operation register starts it; the result is      *
+ * ready a configurable number of cycles later. Until   *
+ * then the status shows busy, and reading the result   *
+ * holds the CPU for the cycles left, like a wait       *
+ * state. mathcop_patch() rewrites UM* and UM/MOD of a  *
+ * TaliForth ROM in memory to use it. Include after     *
+ * forthdict.c.                                         *
+ *                                                      *
+ * Registers, from the window base:                     *
+ *   +0  a        32-bit operand, low byte first; the   *
+ *                multiplies use its low 16 bits        *
+ *   +4  b        16-bit operand, multiplier or divisor *
+ *   +6  op       write: start, 0 unsigned divide 32/16 *
+ *                1 signed divide (the quotient rounded *
+ *                to zero), 2 unsigned multiply 16x16,  *
+ *                3 signed multiply                     *
+ *   +7  status   bit 7 busy, bit 6 error: division by  *
+ *                zero or a quotient over 16 bits       *
+ *   +8  result   multiply: the 32-bit product; divide: *
+ *                the quotient, +A the remainder. $FFFF *
+ *                for both on an error                  *
+ ********************************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#define MATHCOP_SLOT 2 //device window at $F0C0
+
+#define MATHCOP_A      0x0
+#define MATHCOP_B      0x4
+#define MATHCOP_OP     0x6
+#define MATHCOP_STATUS 0x7
+#define MATHCOP_RESULT 0x8
+
+#define MATHCOP_UDIV 0
+#define MATHCOP_SDIV 1
+#define MATHCOP_UMUL 2
+#define MATHCOP_SMUL 3
+#define MATHCOP_OPS  4
+
+#define MATHCOP_BUSY  0x80
+#define MATHCOP_ERROR 0x40
+
+//cycles from the start to the result, about a hardware divider and
+//multiplier working a bit per cycle
+static const uint16_t mathcop_latencies[MATHCOP_OPS] = { 18, 18, 10, 10 };
+
+typedef struct {
+    uint8_t reg[16];
+    uint32_t ready;                    //clockticks6502 when the result is in
+    uint16_t latency[MATHCOP_OPS];
+    uint64_t ops[MATHCOP_OPS];
+    uint64_t stalled;                  //cycles the CPU waited on a result
+} mathcop_t;
+
+void mathcop_init(mathcop_t *mc) {
+    memset(mc, 0, sizeof(*mc));
+    memcpy(mc->latency, mathcop_latencies, sizeof(mc->latency));
+}
+
+//cycles from the start of op to its result
+void mathcop_latency(mathcop_t *mc, uint8_t op, uint16_t cycles) {
+    if (op < MATHCOP_OPS) mc->latency[op] = cycles;
+}
+
+static void mathcop_result(mathcop_t *mc, uint32_t result, bool error) {
+    if (error) {
+        result = 0xFFFFFFFF;
+        mc->reg[MATHCOP_STATUS] |= MATHCOP_ERROR;
+    }
+    for (int i = 0; i < 4; i++) mc->reg[MATHCOP_RESULT + i] = result >> (8 * i);
+}
+
+static void mathcop_run(mathcop_t *mc, uint8_t op) {
+    uint32_t a = 0;
+    for (int i = 0; i < 4; i++) a |= (uint32_t)mc->reg[MATHCOP_A + i] << (8 * i);
+    uint16_t b = mc->reg[MATHCOP_B] | (mc->reg[MATHCOP_B + 1] << 8);
+
+    mc->reg[MATHCOP_STATUS] = 0;
+    switch (op) {
+        case MATHCOP_UDIV: {
+            uint32_t q = b ? a / b : 0;
+            mathcop_result(mc, (q & 0xFFFF) | ((b ? a % b : 0) << 16), !b || q > 0xFFFF);
+            break;
+        }
+        case MATHCOP_SDIV: {
+            int64_t q = b ? (int64_t)(int32_t)a / (int16_t)b : 0;
+            int64_t r = b ? (int64_t)(int32_t)a % (int16_t)b : 0;
+            mathcop_result(mc, (q & 0xFFFF) | ((uint32_t)r << 16), !b || q < INT16_MIN || q > INT16_MAX);
+            break;
+        }
+        case MATHCOP_UMUL:
+            mathcop_result(mc, (uint32_t)(uint16_t)a * b, false);
+            break;
+        case MATHCOP_SMUL:
+            mathcop_result(mc, (uint32_t)((int32_t)(int16_t)a * (int16_t)b), false);
+            break;
+        default:
+            return;
+    }
+    mc->ops[op]++;
+    mc->ready = clockticks6502 + mc->latency[op];
+}
+
+static int32_t mathcop_left(const mathcop_t *mc) {
+    int32_t left = (int32_t)(mc->ready - clockticks6502);
+    return left > 0 ? left : 0;
+}
+
+static uint8_t mathcop_read(machine_t *m, void *state, uint8_t reg) {
+    mathcop_t *mc = state;
+    int32_t left = mathcop_left(mc);
+    (void)m;
+    if (reg == MATHCOP_STATUS) return mc->reg[reg] | (left ? MATHCOP_BUSY : 0);
+    if (reg >= MATHCOP_RESULT && reg < MATHCOP_RESULT + 4 && left) {
+        clockticks6502 += left;
+        mc->stalled += left;
+    }
+    return mc->reg[reg];
+}
+
+static void mathcop_write(machine_t *m, void *state, uint8_t reg, uint8_t value) {
+    mathcop_t *mc = state;
+    (void)m;
+    if (reg < MATHCOP_OP) mc->reg[reg] = value;
+    else if (reg == MATHCOP_OP) mathcop_run(mc, value);
+}
+
+//map the coprocessor into its window of m
+void mathcop_attach(machine_t *m, mathcop_t *mc) {
+    machine_attach(m, MATHCOP_SLOT, (machine_dev_t){ mathcop_read, mathcop_write, mc });
+}
+
+/* TaliForth ********************************************/
+
+#define MATHCOP_BASE (MACHINE_DEV_BASE + MATHCOP_SLOT * 16)
+#define MC_LO(reg) ((MATHCOP_BASE + (reg)) & 0xFF)
+#define MC_HI(reg) ((MATHCOP_BASE + (reg)) >> 8)
+
+// ( u1 u2 -- ud ), behind the stack check
+static const uint8_t mathcop_um_star[] = {
+    0xB5, 0x02, 0x8D, MC_LO(0x0), MC_HI(0x0),   // lda 2,x   sta a
+    0xB5, 0x03, 0x8D, MC_LO(0x1), MC_HI(0x1),   // lda 3,x   sta a+1
+    0xB5, 0x00, 0x8D, MC_LO(0x4), MC_HI(0x4),   // lda 0,x   sta b
+    0xB5, 0x01, 0x8D, MC_LO(0x5), MC_HI(0x5),   // lda 1,x   sta b+1
+    0xA9, MATHCOP_UMUL,                         // lda #umul
+    0x8D, MC_LO(0x6), MC_HI(0x6),               // sta op
+    0xAD, MC_LO(0x8), MC_HI(0x8), 0x95, 0x02,   // lda result   sta 2,x
+    0xAD, MC_LO(0x9), MC_HI(0x9), 0x95, 0x03,   // lda result+1 sta 3,x
+    0xAD, MC_LO(0xA), MC_HI(0xA), 0x95, 0x00,   // lda result+2 sta 0,x
+    0xAD, MC_LO(0xB), MC_HI(0xB), 0x95, 0x01,   // lda result+3 sta 1,x
+    0x60,                                       // rts
+};
+
+// ( ud u -- rem quot ), behind the stack check and the test for division
+// by zero, which the ROM keeps
+static const uint8_t mathcop_um_slash_mod[] = {
+    0xB5, 0x04, 0x8D, MC_LO(0x0), MC_HI(0x0),   // lda 4,x   sta a
+    0xB5, 0x05, 0x8D, MC_LO(0x1), MC_HI(0x1),   // lda 5,x   sta a+1
+    0xB5, 0x02, 0x8D, MC_LO(0x2), MC_HI(0x2),   // lda 2,x   sta a+2
+    0xB5, 0x03, 0x8D, MC_LO(0x3), MC_HI(0x3),   // lda 3,x   sta a+3
+    0xB5, 0x00, 0x8D, MC_LO(0x4), MC_HI(0x4),   // lda 0,x   sta b
+    0xB5, 0x01, 0x8D, MC_LO(0x5), MC_HI(0x5),   // lda 1,x   sta b+1
+    0x9C, MC_LO(0x6), MC_HI(0x6),               // stz op    udiv
+    0xE8, 0xE8,                                 // inx inx
+    0xA0, 0xFC,                                 // ldy #-4
+    0xB9, MC_LO(0xC - 0x100), MC_HI(0xC - 0x100), // lda result+4-256,y
+    0x95, 0x00,                                 // sta 0,x   quotient, remainder
+    0xE8, 0xC8,                                 // inx iny
+    0xD0, 0xF7,                                 // bne lda
+    0xCA, 0xCA, 0xCA, 0xCA,                     // dex dex dex dex
+    0x60,                                       // rts
+};
+
+static bool mathcop_patch_word(machine_t *m, uint16_t list, const char *name,
+                               const uint8_t *check, size_t check_len,
+                               const uint8_t *code, size_t len) {
+    uint16_t h, xt;
+    if (!(h = forthdict_find(m, list, name, &xt))) return false;
+    uint16_t at = forthdict_entry(m, h, xt);
+    uint16_t z = forthdict_word16(m, h + FORTH_HDR_Z);
+    for (size_t i = 0; i < check_len; i++) {
+        //0 in check stands for any byte
+        if (check[i] && m->mem[(uint16_t)(at + i)] != check[i]) return false;
+    }
+    at += check_len;
+    if (at + len > (uint32_t)z + 1) return false;
+    memcpy(m->mem + at, code, len);
+    return true;
+}
+
+//rewrite UM* and UM/MOD of the TaliForth ROM loaded from rom up to run on
+//the coprocessor, which must be attached. returns the words patched
+int mathcop_patch(machine_t *m, uint16_t rom) {
+    //UM/MOD: lda 0,x ora 1,x bne +5 lda #err jmp error
+    static const uint8_t div_zero[] = { 0xB5, 0x00, 0x15, 0x01, 0xD0, 0x05, 0xA9, 0, 0x4C, 0, 0 };
+    uint16_t list = forthdict_list(m, rom);
+    int patched = 0;
+    if (!list) return 0;
+    patched += mathcop_patch_word(m, list, "um*", NULL, 0, mathcop_um_star, sizeof(mathcop_um_star));
+    patched += mathcop_patch_word(m, list, "um/mod", div_zero, sizeof(div_zero),
+                                  mathcop_um_slash_mod, sizeof(mathcop_um_slash_mod));
+    return patched;
+}
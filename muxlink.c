@@ -0,0 +1,235 @@
+/* Multiplexed link *************************************
+ * Trace, profile and snapshot streams next to the      *
+ * console on its one serial link. The console stays    *
+ * plain bytes and goes out first; every other channel  *
+ * has a buffer and a priority of its own and goes out  *
+ * in frames of fastload.c, kind 'm', each the channel  *
+ * number and at most MUX_CHUNK bytes. mux_pump() sends *
+ * one frame of the channel with the highest priority   *
+ * that has data, so console output waits behind one    *
+ * short frame at most. A record that finds its buffer  *
+ * full is dropped and counted, so telemetry never      *
+ * holds up the CPU. Records are written on the thread  *
+ * of the CPU and pumped on the one of the console.     *
+ *                                                      *
+ * The requests of fastload.c turn the streams on and   *
+ * off. Their answers, already frames, go out whole on  *
+ * the command channel, which has the top priority.     *
+ * MUX_PROTOCOL_ONLY leaves out the producers, for host *
+ * tools such as 6502demux; otherwise include after     *
+ * fastload.c.                                          *
+ ********************************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+
+#define MUX_KIND 'm'
+
+//channels. the console is plain bytes outside of frames
+#define MUX_CONSOLE  0
+#define MUX_TRACE    1 //a MUX_TRACE_RECORD per instruction while tracing
+#define MUX_PROFILE  2 //a MUX_PROFILE_RECORD for each dump
+#define MUX_SNAPSHOT 3 //a MUX_SNAPSHOT_HEADER and the memory it names
+#define MUX_COMMAND  4 //answers to requests, sent as the frames they are
+#define MUX_CHANNELS 5
+
+#define MUX_CHUNK 48 //most channel bytes in one frame
+
+//requests of fastload.c; the answer value is given after each
+#define MUX_TRACE_ON      'T' //trace the next address + 65536 * length instructions, 0 stops; records dropped since the last 'T'
+#define MUX_PROFILE_DUMP  'F' //send the counts so far and clear them, count on if address is 1
+#define MUX_SNAPSHOT_TAKE 'S' //send the registers and length bytes of mem[] from address
+
+//after each instruction: instructions (32 bits), the PC of the next one,
+//the opcode that ran, A, X, Y, SP and the status
+#define MUX_TRACE_RECORD 12
+//instructions run in each 256-byte page, 32 bits each
+#define MUX_PROFILE_RECORD (4 * 256)
+//PC, A, X, Y, SP, status, 0, instructions (32 bits), address and length
+#define MUX_SNAPSHOT_HEADER 16
+
+typedef struct {
+    uint8_t *data;
+    uint32_t size;    //a power of two, 0 while the channel is closed
+    uint8_t priority; //higher goes first
+    _Atomic uint32_t head; //written by the producer only
+    _Atomic uint32_t tail; //written by the pump only
+    uint32_t dropped; //records that found no room, on the producer side
+    uint64_t bytes, frames; //sent, on the pump side
+} mux_channel_t;
+
+typedef struct {
+    mux_channel_t channel[MUX_CHANNELS];
+    void (*putc)(uint8_t c); //the link
+
+    //the producers, on the thread of the CPU. watching is true while
+    //mux_step() has something to do
+    bool watching;
+    uint32_t trace_left, trace_dropped;
+    bool profiling;
+    uint32_t profile[256];
+} mux_t;
+
+void mux_init(mux_t *mux, void (*putc)(uint8_t c)) {
+    memset(mux, 0, sizeof(*mux));
+    mux->putc = putc;
+}
+
+//give channel a buffer of size bytes, a power of two, and a priority
+bool mux_open(mux_t *mux, int channel, uint32_t size, uint8_t priority) {
+    mux_channel_t *ch = &mux->channel[channel];
+    ch->data = malloc(size);
+    if (!ch->data) return false;
+    ch->size = size;
+    ch->priority = priority;
+    return true;
+}
+
+//len bytes on channel as one record, or none of them when they do not fit:
+//false then
+bool mux_write(mux_t *mux, int channel, const uint8_t *data, uint32_t len) {
+    mux_channel_t *ch = &mux->channel[channel];
+    uint32_t head = atomic_load_explicit(&ch->head, memory_order_relaxed);
+    uint32_t tail = atomic_load_explicit(&ch->tail, memory_order_acquire);
+
+    if (ch->size - (head - tail) < len) {
+        ch->dropped++;
+        return false;
+    }
+    for (uint32_t i = 0; i < len; i++) ch->data[(head + i) & (ch->size - 1)] = data[i];
+    atomic_store_explicit(&ch->head, head + len, memory_order_release);
+    return true;
+}
+
+//send one frame of the channel with the highest priority that has data:
+//false when none had any
+bool mux_pump(mux_t *mux) {
+    mux_channel_t *best = NULL;
+    uint32_t head = 0;
+    int channel = 0;
+
+    for (int i = 1; i < MUX_CHANNELS; i++) {
+        mux_channel_t *ch = &mux->channel[i];
+        uint32_t h = atomic_load_explicit(&ch->head, memory_order_acquire);
+        if (h == atomic_load_explicit(&ch->tail, memory_order_relaxed)) continue;
+        if (best && ch->priority <= best->priority) continue;
+        best = ch;
+        head = h;
+        channel = i;
+    }
+    if (!best) return false;
+
+    if (channel == MUX_COMMAND) {
+        //whole frames, as mux_write() put them in
+        uint32_t tail = atomic_load_explicit(&best->tail, memory_order_relaxed);
+        for (uint32_t i = tail; i != head; i++) mux->putc(best->data[i & (best->size - 1)]);
+        atomic_store_explicit(&best->tail, head, memory_order_release);
+        best->bytes += head - tail;
+        best->frames++;
+        return true;
+    }
+
+    uint8_t body[1 + MUX_CHUNK], frame[2 + 2 * (sizeof(body) + 2) + 1];
+    uint32_t tail = atomic_load_explicit(&best->tail, memory_order_relaxed);
+    uint32_t len = head - tail < MUX_CHUNK ? head - tail : MUX_CHUNK;
+    body[0] = channel;
+    for (uint32_t i = 0; i < len; i++) body[1 + i] = best->data[(tail + i) & (best->size - 1)];
+    atomic_store_explicit(&best->tail, tail + len, memory_order_release);
+
+    size_t n = fastload_encode(MUX_KIND, body, 1 + len, frame);
+    for (size_t i = 0; i < n; i++) mux->putc(frame[i]);
+    best->bytes += len;
+    best->frames++;
+    return true;
+}
+
+#ifndef MUX_PROTOCOL_ONLY
+
+static void mux_put32(uint8_t *out, uint32_t v) {
+    out[0] = v;
+    out[1] = v >> 8;
+    out[2] = v >> 16;
+    out[3] = v >> 24;
+}
+
+//after every instruction while watching
+void mux_step(mux_t *mux) {
+    if (mux->profiling) mux->profile[pc >> 8]++;
+    if (!mux->trace_left) return;
+
+    uint8_t r[MUX_TRACE_RECORD];
+    mux_put32(r, (uint32_t)instructions);
+    r[4] = pc & 0xFF;
+    r[5] = pc >> 8;
+    r[6] = opcode;
+    r[7] = a;
+    r[8] = x;
+    r[9] = y;
+    r[10] = sp;
+    r[11] = status;
+    mux_write(mux, MUX_TRACE, r, sizeof(r));
+    if (!--mux->trace_left) mux->watching = mux->profiling;
+}
+
+static uint8_t mux_command(fastload_t *f, uint16_t *value) {
+    mux_t *mux = f->user;
+    uint16_t address = f->body[1] | (f->body[2] << 8);
+    uint16_t len = f->body[3] | (f->body[4] << 8);
+    static uint8_t r[MUX_SNAPSHOT_HEADER + FASTLOAD_DATA];
+
+    switch (f->body[0]) {
+        case MUX_TRACE_ON: {
+            uint32_t dropped = mux->channel[MUX_TRACE].dropped - mux->trace_dropped;
+            mux->trace_dropped += dropped;
+            mux->trace_left = address | (uint32_t)len << 16;
+            *value = dropped < 0xFFFF ? dropped : 0xFFFF;
+            break;
+        }
+        case MUX_PROFILE_DUMP:
+            for (int i = 0; i < 256; i++) mux_put32(r + 4 * i, mux->profile[i]);
+            if (!mux_write(mux, MUX_PROFILE, r, MUX_PROFILE_RECORD)) return FASTLOAD_FULL;
+            memset(mux->profile, 0, sizeof(mux->profile));
+            mux->profiling = address == 1;
+            *value = 0;
+            break;
+        case MUX_SNAPSHOT_TAKE:
+            if (len > FASTLOAD_DATA || address + len > 0x10000) return FASTLOAD_UNKNOWN;
+            r[0] = pc & 0xFF;
+            r[1] = pc >> 8;
+            r[2] = a;
+            r[3] = x;
+            r[4] = y;
+            r[5] = sp;
+            r[6] = status;
+            r[7] = 0;
+            mux_put32(r + 8, (uint32_t)instructions);
+            memcpy(r + 12, f->body + 1, 4);
+            memcpy(r + MUX_SNAPSHOT_HEADER, machine->mem + address, len);
+            if (!mux_write(mux, MUX_SNAPSHOT, r, MUX_SNAPSHOT_HEADER + len)) return FASTLOAD_FULL;
+            *value = 0;
+            break;
+        default:
+            return FASTLOAD_UNKNOWN;
+    }
+    mux->watching = mux->trace_left || mux->profiling;
+    return FASTLOAD_OK;
+}
+
+//an answer of fastload.c, dropped when there is no room: the sender of the
+//request tries again
+static void mux_answer(fastload_t *f, const uint8_t *frame, size_t len) {
+    mux_write(f->user, MUX_COMMAND, frame, len);
+}
+
+//take the requests above through f, and send all of its answers on
+//MUX_COMMAND so they do not end up inside the frames of other channels
+void mux_commands(mux_t *mux, fastload_t *f) {
+    f->other = mux_command;
+    f->send = mux_answer;
+    f->user = mux;
+}
+
+#endif
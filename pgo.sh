@@ -0,0 +1,106 @@
+#!/bin/sh
+# Profile-guided build of the host tools.
+#
+#   ./pgo.sh [build-dir]
+#
+# Builds the tools once as a baseline, then with instrumentation, trains
+# them on the benchmark corpus (the Klaus suite and TaliForth sessions)
+# and rebuilds them from the collected profile, so the hot handlers of
+# 6502.c and the bus in machine.c are laid out for the real instruction
+# mix. When llvm-bolt is installed, 6502bench and 6502emu_host are also
+# relinked with relocations and laid out again by BOLT from an
+# instrumented run. Prints the emulated MHz of every benchmark before
+# and after.
+
+set -e
+
+SRC=$(cd "$(dirname "$0")" && pwd)
+BUILD=${1:-$SRC/build-pgo}
+BASE=$BUILD/base
+PGO=$BUILD/pgo
+PROFILE=$BUILD/profile
+REPEAT=3
+
+# A TaliForth session for 6502emu_host, which reads its console from stdin
+forth_session() {
+    cat <<'FORTH'
+8190 constant size
+create flags size allot
+: sieve flags size 1 fill 0 size 0 do flags i + c@ if i 2* 3 + dup i + begin dup size < while 0 over flags + c! over + repeat 2drop 1+ then loop ;
+sieve .
+: fib dup 2 < if exit then dup 1- recurse swap 2 - recurse + ;
+20 fib .
+create buf 64 allot
+: text s" the quick brown fox jumps over the lazy dog   " ;
+: strs 0 300 0 do text buf swap move buf 46 text compare + buf 46 s" lazy" search nip nip + buf 46 -trailing nip + loop ;
+strs u.
+words
+FORTH
+}
+
+# Run the training workload against the tools in directory $1
+train() {
+    "$1/6502bench" -r 1 > /dev/null 2>&1
+    forth_session | "$1/6502emu_host" > /dev/null
+}
+
+# Configure and build directory $1 with the cache settings that follow
+build() {
+    dir=$1
+    shift
+    cmake -S "$SRC" -B "$dir" -DCMAKE_BUILD_TYPE=Release "$@" > /dev/null
+    cmake --build "$dir" -j"$(nproc)" > /dev/null
+}
+
+# name and MHz of every benchmark in a 6502bench JSON report
+mhz() {
+    sed -n 's/.*"name": "\([^"]*\)".*"mhz": \([0-9.]*\).*/\1 \2/p' "$1"
+}
+
+echo "baseline build"
+build "$BASE" -DPGO=OFF
+"$BASE/6502bench" -r $REPEAT > "$BUILD/before.json"
+
+echo "instrumented build and training run"
+rm -rf "$PROFILE"
+build "$PGO" -DPGO=GENERATE -DPGO_DIR="$PROFILE"
+train "$PGO"
+if ls "$PROFILE"/*.profraw > /dev/null 2>&1; then
+    llvm-profdata merge -o "$PROFILE/default.profdata" "$PROFILE"/*.profraw
+fi
+
+echo "optimised build"
+if command -v llvm-bolt > /dev/null; then
+    build "$PGO" -DPGO=USE -DBOLT_READY=ON
+else
+    build "$PGO" -DPGO=USE -DBOLT_READY=OFF
+fi
+"$PGO/6502bench" -r $REPEAT > "$BUILD/after.json"
+AFTER=$BUILD/after.json
+
+if command -v llvm-bolt > /dev/null; then
+    echo "BOLT layout"
+    for tool in 6502bench 6502emu_host; do
+        rm -f "$BUILD/$tool.fdata"
+        llvm-bolt "$PGO/$tool" -instrument -instrumentation-file="$BUILD/$tool.fdata" \
+            -o "$PGO/$tool.inst" > /dev/null
+        mv "$PGO/$tool" "$PGO/$tool.pgo"
+        mv "$PGO/$tool.inst" "$PGO/$tool"
+    done
+    train "$PGO"
+    for tool in 6502bench 6502emu_host; do
+        llvm-bolt "$PGO/$tool.pgo" -o "$PGO/$tool" -data="$BUILD/$tool.fdata" \
+            -reorder-blocks=ext-tsp -reorder-functions=hfsort -split-functions -split-all-cold > /dev/null
+    done
+    "$PGO/6502bench" -r $REPEAT > "$BUILD/after-bolt.json"
+    AFTER=$BUILD/after-bolt.json
+fi
+
+echo
+echo "benchmark            before MHz   after MHz   change"
+mhz "$BUILD/before.json" > "$BUILD/before.txt"
+mhz "$AFTER" | awk 'NR == FNR { before[$1] = $2; next }
+    $1 in before { printf "%-18s %12.2f %11.2f %+7.1f%%\n", $1, before[$1], $2, 100 * ($2 - before[$1]) / before[$1] }' \
+    "$BUILD/before.txt" -
+echo
+echo "optimised tools are in $PGO"
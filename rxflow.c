@@ -0,0 +1,100 @@
+/* Console receive buffer *******************************
+ * Reads console input ahead of the 6502, a few USB CDC *
+ * packets' worth, and holds the host back with XON/    *
+ * XOFF: XOFF goes out when the buffer fills up to two  *
+ * packets short of full, XON once it has drained to    *
+ * less than a packet. The buffer is topped up only     *
+ * when it runs low, so the console is read in bursts.  *
+ * ENQ from the host is not passed on but answered with *
+ * ACK, the number of bytes received since the last ENQ *
+ * in decimal and ACK again, so a sender can check that *
+ * nothing was lost. Used from one thread only.         *
+ ********************************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#define RXFLOW_PACKET 64 //a full-speed USB CDC bulk packet
+#define RXFLOW_SIZE   (8 * RXFLOW_PACKET)
+#define RXFLOW_STOP   (RXFLOW_SIZE - 2 * RXFLOW_PACKET) //for packets on the way
+#define RXFLOW_START  RXFLOW_PACKET
+
+#define RXFLOW_XON  0x11
+#define RXFLOW_XOFF 0x13
+#define RXFLOW_ENQ  0x05
+#define RXFLOW_ACK  0x06
+
+//longest answer rxflow_reply() makes
+#define RXFLOW_REPLY 24
+
+typedef struct {
+    uint8_t data[RXFLOW_SIZE];
+    uint32_t head, tail;
+    bool stopped; //XOFF is out
+    bool enquiry; //ENQ came in, not answered yet
+    uint32_t since;
+    uint64_t received;
+    uint64_t stops;
+    uint32_t peak;
+} rxflow_t;
+
+void rxflow_init(rxflow_t *f) {
+    *f = (rxflow_t){ 0 };
+}
+
+static inline uint32_t rxflow_count(const rxflow_t *f) {
+    return f->head - f->tail;
+}
+
+//true when the buffer has run low enough to be topped up
+static inline bool rxflow_low(const rxflow_t *f) {
+    return rxflow_count(f) < RXFLOW_START;
+}
+
+static inline bool rxflow_full(const rxflow_t *f) {
+    return rxflow_count(f) == RXFLOW_SIZE;
+}
+
+//a byte from the host; the caller reads no more while it is full
+void rxflow_put(rxflow_t *f, uint8_t c) {
+    if (c == RXFLOW_ENQ) {
+        f->enquiry = true;
+        return;
+    }
+    f->data[f->head++ % RXFLOW_SIZE] = c;
+    f->since++;
+    f->received++;
+    if (rxflow_count(f) > f->peak) f->peak = rxflow_count(f);
+}
+
+//the next byte, or -1 when none is waiting
+int rxflow_peek(const rxflow_t *f) {
+    return rxflow_count(f) ? f->data[f->tail % RXFLOW_SIZE] : -1;
+}
+
+int rxflow_get(rxflow_t *f) {
+    int c = rxflow_peek(f);
+    if (c >= 0) f->tail++;
+    return c;
+}
+
+//what to send the host now, XON or XOFF and the answer to an ENQ, into
+//out: returns its length
+int rxflow_reply(rxflow_t *f, char *out) {
+    int n = 0;
+    if (!f->stopped && rxflow_count(f) >= RXFLOW_STOP) {
+        out[n++] = RXFLOW_XOFF;
+        f->stopped = true;
+        f->stops++;
+    } else if (f->stopped && rxflow_count(f) < RXFLOW_START) {
+        out[n++] = RXFLOW_XON;
+        f->stopped = false;
+    }
+    if (f->enquiry) {
+        n += snprintf(out + n, RXFLOW_REPLY - n, "%c%lu%c", RXFLOW_ACK, (unsigned long)f->since, RXFLOW_ACK);
+        f->enquiry = false;
+        f->since = 0;
+    }
+    return n;
+}
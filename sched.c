@@ -0,0 +1,116 @@
+/* Time-sliced scheduler ********************************
+ * Shares one CPU (one RP2040 core or one host thread)  *
+ * between several machines. Each machine gets a fixed  *
+ * quantum of cycles through exec6502() in turn, so all *
+ * of them see the same emulated throughput; switching  *
+ * is a save6502()/load6502() of the registers and a    *
+ * change of the machine pointer.                       *
+ * Include after machine.c.                             *
+ ********************************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define SCHED_MAX_MACHINES 8
+
+typedef struct {
+    machine_t *m;
+    context6502_t cpu;
+    bool running;
+
+    //statistics, times in microseconds
+    uint64_t slices;
+    uint64_t busy_us;        //time spent running this machine
+    uint64_t last_end_us;    //end of its last slice
+    uint64_t wait_total_us;  //time spent waiting for the next slice
+    uint64_t wait_max_us;
+} sched_slot_t;
+
+typedef struct {
+    int count;
+    int next;
+    uint32_t quantum;
+    uint64_t (*now_us)();
+    uint64_t start_us;
+    sched_slot_t slot[SCHED_MAX_MACHINES];
+} sched_t;
+
+void sched_init(sched_t *s, uint32_t quantum, uint64_t (*now_us)()) {
+    s->count = 0;
+    s->next = 0;
+    s->quantum = quantum;
+    s->now_us = now_us;
+    s->start_us = now_us();
+}
+
+//add the machine the CPU is currently wired to, as left by machine_reset()
+//and hookexternal(). returns its slot, or -1 when the scheduler is full
+int sched_add(sched_t *s) {
+    if (s->count == SCHED_MAX_MACHINES) return -1;
+
+    sched_slot_t *slot = &s->slot[s->count];
+    slot->m = machine;
+    save6502(&slot->cpu);
+    slot->running = true;
+    slot->slices = 0;
+    slot->busy_us = 0;
+    slot->last_end_us = s->now_us();
+    slot->wait_total_us = 0;
+    slot->wait_max_us = 0;
+    return s->count++;
+}
+
+//switch the CPU to a slot, e.g. to inspect its registers between slices
+void sched_switch(sched_t *s, int n) {
+    machine = s->slot[n].m;
+    load6502(&s->slot[n].cpu);
+}
+
+//run one quantum on the next running machine, round robin.
+//returns the slot that ran, or -1 when no machine is running
+int sched_slice(sched_t *s) {
+    for (int tries = 0; tries < s->count; tries++) {
+        int n = s->next;
+        s->next = (n + 1) % s->count;
+
+        sched_slot_t *slot = &s->slot[n];
+        if (!slot->running) continue;
+
+        uint64_t begin = s->now_us();
+        uint64_t wait = begin - slot->last_end_us;
+        slot->wait_total_us += wait;
+        if (wait > slot->wait_max_us) slot->wait_max_us = wait;
+
+        machine = slot->m;
+        load6502(&slot->cpu);
+        exec6502(s->quantum);
+        save6502(&slot->cpu);
+
+        slot->last_end_us = s->now_us();
+        slot->busy_us += slot->last_end_us - begin;
+        slot->slices++;
+        return n;
+    }
+    return -1;
+}
+
+void sched_stop(sched_t *s, int n) {
+    s->slot[n].running = false;
+}
+
+void sched_print_stats(sched_t *s) {
+    uint64_t elapsed = s->now_us() - s->start_us;
+
+    printf("machine  slices    cycles       instr    util  MHz      wait avg/max us\n");
+    for (int n = 0; n < s->count; n++) {
+        sched_slot_t *slot = &s->slot[n];
+        printf("%7d %7llu %9lu %11llu %6.1f%% %6.2f %9.1f/%llu\n", n,
+               (unsigned long long)slot->slices,
+               (unsigned long)slot->cpu.clockticks6502,
+               (unsigned long long)slot->cpu.instructions,
+               elapsed ? 100.0 * slot->busy_us / elapsed : 0.0,
+               slot->busy_us ? (double)slot->cpu.clockticks6502 / slot->busy_us : 0.0,
+               slot->slices ? (double)slot->wait_total_us / slot->slices : 0.0,
+               (unsigned long long)slot->wait_max_us);
+    }
+}
@@ -0,0 +1,143 @@
+/* Run until ********************************************
+ * Runs the CPU at full speed until one of a set of     *
+ * conditions holds. Every condition is compiled into   *
+ * something the core already stops on, so it is only   *
+ * looked at when its event happens: PC reached and     *
+ * call into become breakpoints, a byte changing a      *
+ * write watchpoint, an instruction count the cycle     *
+ * budget of each exec6502() call. Include after        *
+ * machine.c.                                           *
+ ********************************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define UNTIL_MAX 16
+#define UNTIL_QUANTUM 1000000
+
+#define UNTIL_PC           0 //pc reaches address
+#define UNTIL_CHANGE       1 //the byte at address gets a new value
+#define UNTIL_INSTRUCTIONS 2 //count more instructions have run
+#define UNTIL_CALL         3 //a JSR to address arrives there
+
+typedef struct {
+    uint8_t kind;
+    uint16_t address;
+    uint64_t count;
+    uint8_t value; //UNTIL_CHANGE: the byte when the run started
+    bool owned;    //the point was set by run_until(), not by the caller
+} until_cond_t;
+
+typedef struct {
+    until_cond_t cond[UNTIL_MAX];
+    int count;
+    uint8_t (*exec)(uint32_t tickcount); //exec6502(), or another variant
+    uint8_t reason; //STOP6502_* reason of the last run
+} until_t;
+
+void until_init(until_t *u) {
+    u->count = 0;
+    u->exec = exec6502;
+    u->reason = STOP6502_BUDGET;
+}
+
+//add a condition, returns its index or -1 when the set is full
+int until_add(until_t *u, uint8_t kind, uint16_t address, uint64_t count) {
+    if (u->count == UNTIL_MAX) return -1;
+    u->cond[u->count] = (until_cond_t){ .kind = kind, .address = address, .count = count };
+    return u->count++;
+}
+
+//true when the return address on the stack belongs to a JSR to address
+static bool until_called(const machine_t *m, uint16_t address) {
+    uint16_t ret = m->mem[BASE_STACK + (uint8_t)(sp + 1)] | (m->mem[BASE_STACK + (uint8_t)(sp + 2)] << 8);
+    uint16_t jsr = ret - 2;
+    return m->mem[jsr] == 0x20 &&
+           (m->mem[(uint16_t)(jsr + 1)] | (m->mem[(uint16_t)(jsr + 2)] << 8)) == address;
+}
+
+//the condition that the stop of the CPU satisfies, or -1
+static int until_check(until_t *u, machine_t *m, uint8_t reason, uint64_t target) {
+    for (int i = 0; i < u->count; i++) {
+        until_cond_t *c = &u->cond[i];
+        switch (c->kind) {
+            case UNTIL_PC:
+                if (reason == STOP6502_BREAK && m->hit_address == c->address) return i;
+                break;
+            case UNTIL_CALL:
+                if (reason == STOP6502_BREAK && m->hit_address == c->address && until_called(m, c->address)) return i;
+                break;
+            case UNTIL_CHANGE:
+                if (reason == STOP6502_WATCH && m->mem[c->address] != c->value) return i;
+                break;
+            case UNTIL_INSTRUCTIONS:
+                if (instructions >= target) return i;
+                break;
+        }
+    }
+    return -1;
+}
+
+//a stop that only came from our own points is not for the caller
+static bool until_ours(until_t *u, machine_t *m, uint8_t reason) {
+    uint8_t kind = reason == STOP6502_BREAK ? MACHINE_PAGE_BREAK : MACHINE_PAGE_WWATCH;
+    if (reason != STOP6502_BREAK && reason != STOP6502_WATCH) return false;
+    if (m->hit != kind) return false;
+    for (int i = 0; i < u->count; i++) {
+        const until_cond_t *c = &u->cond[i];
+        uint8_t ckind = c->kind == UNTIL_CHANGE ? MACHINE_PAGE_WWATCH : MACHINE_PAGE_BREAK;
+        if (c->owned && ckind == kind && c->address == m->hit_address) return true;
+    }
+    return false;
+}
+
+//run the CPU of this thread for at most max_cycles. returns the index of
+//the condition that held, or -1 when the CPU stopped for another reason or
+//the cycles ran out; u->reason says which
+int run_until(until_t *u, uint32_t max_cycles) {
+    machine_t *m = machine;
+    uint64_t target = UINT64_MAX;
+
+    for (int i = 0; i < u->count; i++) {
+        until_cond_t *c = &u->cond[i];
+        uint8_t kind = MACHINE_PAGE_BREAK;
+        switch (c->kind) {
+            case UNTIL_INSTRUCTIONS:
+                if (instructions + c->count < target) target = instructions + c->count;
+                continue;
+            case UNTIL_CHANGE:
+                c->value = m->mem[c->address];
+                kind = MACHINE_PAGE_WWATCH;
+                break;
+        }
+        c->owned = !(m->points && machine_point_at(m, kind, c->address));
+        machine_point(m, kind, c->address, true);
+    }
+
+    uint32_t start = clockticks6502;
+    int hit = -1;
+    u->reason = STOP6502_BUDGET;
+    while (hit < 0) {
+        if (instructions >= target) {
+            hit = until_check(u, m, STOP6502_BUDGET, target);
+            break;
+        }
+        uint32_t used = clockticks6502 - start;
+        if (used >= max_cycles) break;
+        uint32_t left = max_cycles - used;
+        uint32_t budget = left < UNTIL_QUANTUM ? left : UNTIL_QUANTUM;
+        //every instruction takes two cycles or more, so this cannot overshoot
+        if (target - instructions < budget / 2) budget = (target - instructions) * 2;
+
+        u->reason = u->exec(budget);
+        hit = until_check(u, m, u->reason, target);
+        if (hit < 0 && u->reason != STOP6502_BUDGET && !until_ours(u, m, u->reason)) break;
+    }
+
+    for (int i = 0; i < u->count; i++) {
+        const until_cond_t *c = &u->cond[i];
+        if (!c->owned || c->kind == UNTIL_INSTRUCTIONS) continue;
+        machine_point(m, c->kind == UNTIL_CHANGE ? MACHINE_PAGE_WWATCH : MACHINE_PAGE_BREAK, c->address, false);
+    }
+    return hit;
+}